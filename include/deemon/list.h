@@ -107,6 +107,14 @@ DFUNDEF WUNUSED DREF DeeListObject *DCALL DeeList_NewUninitialized(size_t n_elem
 DFUNDEF NONNULL((1)) void DCALL DeeList_FreeUninitialized(DREF DeeListObject *__restrict self);
 
 #ifdef CONFIG_BUILDING_DEEMON
+/* Internal layout of `List.Iterator' (used by the interpreter's `foreach' fast-path) */
+typedef struct {
+	Dee_OBJECT_HEAD
+	DREF DeeListObject *li_list;  /* [1..1][const] The list being iterated. */
+	DWEAK size_t        li_index; /* The current iteration index. */
+} DeeListIteratorObject;
+INTDEF DeeTypeObject DeeListIterator_Type;
+
 /* Concat a list and some generic sequence,
  * inheriting a reference from `self' in the process. */
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
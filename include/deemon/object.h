@@ -1647,6 +1647,12 @@ struct Dee_type_cmp {
 };
 
 
+/* Callbacks for `DeeObject_Foreach()' / `DeeObject_ForeachPair()' and `tp_foreach' / `tp_foreach_pair'
+ * @return: < 0: Stop enumeration and propagate this value.
+ * @return: >= 0: Continue enumeration (return values are summed up) */
+typedef WUNUSED_T NONNULL_T((2)) Dee_ssize_t (DCALL *Dee_foreach_t)(void *arg, DeeObject *elem);
+typedef WUNUSED_T NONNULL_T((2, 3)) Dee_ssize_t (DCALL *Dee_foreach_pair_t)(void *arg, DeeObject *key, DeeObject *value);
+
 struct Dee_type_nsi;
 struct Dee_type_seq {
 	/* Sequence operators. */
@@ -1663,6 +1669,22 @@ struct Dee_type_seq {
 	/* Optional sequence-extensions for providing optimized (but
 	 * less generic) variants for various sequence operations. */
 	struct Dee_type_nsi Dee_tpconst *tp_nsi;
+
+	/* Optional, internal iteration protocol: invoke `proc' for every element
+	 * that would be yielded by `tp_iter_self', without the need of allocating
+	 * an iterator, or having to go through `tp_iter_next' for every element.
+	 * Elements are passed as borrowed references that are only valid until
+	 * `proc' returns. When `proc' returns a negative value, enumeration stops
+	 * and that value is returned. Otherwise, the sum of all calls is returned.
+	 * `tp_foreach_pair' is the same, but for mappings, where it enumerates the
+	 * key/value pairs that would otherwise be yielded by `tp_iter_self'.
+	 * NOTE: These operators are only used when `tp_iter_self' is implemented by
+	 *       the same `struct type_seq' (that is: they are inherited alongside
+	 *       `tp_iter_self', and are ignored once a sub-class overrides it)
+	 * NOTE: These fields only exist when the owning type has `Dee_TF_SEQFOREACH' set.
+	 * @return: -1: An error occurred (or `proc' returned `-1') */
+	WUNUSED_T NONNULL_T((1, 2)) Dee_ssize_t (DCALL *tp_foreach)(DeeObject *__restrict self, Dee_foreach_t proc, void *arg);
+	WUNUSED_T NONNULL_T((1, 2)) Dee_ssize_t (DCALL *tp_foreach_pair)(DeeObject *__restrict self, Dee_foreach_pair_t proc, void *arg);
 };
 
 struct Dee_type_attr {
@@ -2447,6 +2469,11 @@ DeeObject_PInvokeOperator(DREF DeeObject **__restrict p_self, uint16_t name,
                                             * An example for where this flag should be used would be an object that only ever
                                             * holds references to `String' or `int' objects, but not to objects of its own type,
                                             * or any sort of container object capable of holding instances of the same type. */
+#define Dee_TF_SEQFOREACH       0x00000002 /* The type's `tp_seq' includes the `tp_foreach' and `tp_foreach_pair' fields.
+                                            * Those fields were added to `struct type_seq' after its initial layout, meaning
+                                            * that types compiled against older headers (e.g. in dex modules) don't have them.
+                                            * Without this flag, the core never looks at anything past `tp_nsi'.
+                                            * NOTE: This flag is propagated whenever the type inherits its `tp_seq' pointer. */
 #define Dee_TF_SINGLETON        0x80000000 /* This type is a singleton. */
 
 #ifdef DEE_SOURCE
@@ -2465,6 +2492,7 @@ DeeObject_PInvokeOperator(DREF DeeObject **__restrict p_self, uint16_t name,
 #define TP_FINTERHITABLE    Dee_TP_FINTERHITABLE
 #define TF_NONE             Dee_TF_NONE
 #define TF_NONLOOPING       Dee_TF_NONLOOPING
+#define TF_SEQFOREACH       Dee_TF_SEQFOREACH
 #define TF_SINGLETON        Dee_TF_SINGLETON
 #endif /* DEE_SOURCE */
 
@@ -3279,13 +3307,11 @@ DFUNDEF WUNUSED NONNULL((1, 2, 4)) Dee_ssize_t
 DFUNDEF WUNUSED WUNUSED NONNULL((1)) DREF DeeObject *(DCALL DeeObject_IterSelf)(DeeObject *__restrict self);
 DFUNDEF WUNUSED WUNUSED NONNULL((1)) DREF DeeObject *(DCALL DeeObject_IterNext)(DeeObject *__restrict self);
 
-typedef WUNUSED_T NONNULL_T((2)) Dee_ssize_t (DCALL *Dee_foreach_t)(void *arg, DeeObject *elem);
-typedef WUNUSED_T NONNULL_T((2, 3)) Dee_ssize_t (DCALL *Dee_foreach_pair_t)(void *arg, DeeObject *key, DeeObject *value);
-
 /* Invoke `proc' for each element of a general-purpose sequence.
  * When `*proc' returns < 0, that value is propagated.
  * Otherwise, return the sum of all calls to it.
- * NOTE: This function does some special optimizations for known sequence types.
+ * NOTE: When implemented, this function uses `tp_foreach' of `self', which
+ *       allows it to enumerate sequences without allocating an iterator.
  * @return: -1: An error occurred during iteration (or potentially inside of `*proc') */
 DFUNDEF WUNUSED WUNUSED NONNULL((1, 2)) Dee_ssize_t
 (DCALL DeeObject_Foreach)(DeeObject *__restrict self, Dee_foreach_t proc, void *arg);
@@ -53,6 +53,7 @@ struct DeeRegexCode {
 #define DEE_RE_CODE_FLAG_NORMAL     0x00 /* Normal flags. */
 #define DEE_RE_CODE_FLAG_NEEDGROUPS 0x01 /* Groups are expected to be correct (set if `REOP_GROUP_MATCH*' opcodes are used) */
 #define DEE_RE_CODE_FLAG_OPTGROUPS  0x02 /* The regex code contains optional groups (e.g. "foo(x)?bar" or "foo(|b(a)r)") */
+	struct DeeRegexDFA *rc_dfa; /* [0..1][owned] Lazily-built DFA used instead of `rc_code' when no groups are needed (s.a. `DeeRegex_Match()') */
 	__COMPILER_FLEXIBLE_ARRAY(__BYTE_TYPE__, rc_code); /* Code buffer (`REOP_*' instruction stream) */
 };
 
@@ -61,6 +62,7 @@ struct DeeRegexCode {
 #define DEE_REGEX_COMPILE_NORMAL 0x0000 /* Normal regex compiler flags */
 #define DEE_REGEX_COMPILE_ICASE  0x0001 /* Produce a case-insensitive pattern */
 #define DEE_REGEX_COMPILE_NOUTF8 0x0002 /* Disable utf-8 processing; pattern is parsed and matched as byte-only */
+#define DEE_REGEX_COMPILE_ALL    0x0003 /* Mask of all `DEE_REGEX_COMPILE_*' flags */
 
 /* Lazily compile `self' as a deemon regex pattern.
  * Regex patterns for strings are compiled once, and cached thereafter,
@@ -77,6 +79,49 @@ DeeString_GetRegex(/*String*/ DeeObject *__restrict self,
                    unsigned int compile_flags,
                    DeeObject *rules);
 
+/* Same as `DeeString_GetRegex()', but `self' may also be a `Regex' object,
+ * in which case the returned code remains valid for as long as a reference
+ * to `self' is held (`rules' are or'd with those of the `Regex' object).
+ * @return: * :   The compiled regex pattern.
+ * @return: NULL: An error occurred (including `self' not being a string or `Regex'). */
+DFUNDEF WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
+DeeObject_GetRegex(/*String|Regex*/ DeeObject *__restrict self,
+                   unsigned int compile_flags,
+                   DeeObject *rules);
+
+
+
+/************************************************************************/
+/* Regex object                                                         */
+/************************************************************************/
+
+typedef struct DeeRegexObject DeeRegexObject;
+struct DeeRegexObject {
+	Dee_OBJECT_HEAD
+	struct DeeRegexCode *re_codes[DEE_REGEX_COMPILE_ALL + 1];
+	                                 /* [0..1][lock(WRITE_ONCE)][owned] Compiled code, indexed by `DEE_REGEX_COMPILE_*'
+	                                  * Lazily compiled the first time the pattern is used with some set of flags. */
+	Dee_hash_t           re_hash;    /* [const] Hash of the pattern (same as `DeeString_Hash()' of the original string) */
+	size_t               re_size;    /* [const] Length of `re_pattern' (in bytes) */
+	unsigned int         re_flags;   /* [const] Compile flags from the "rules" given upon construction (set of `DEE_REGEX_COMPILE_*') */
+	__COMPILER_FLEXIBLE_ARRAY(char, re_pattern); /* [re_size] The pattern as utf-8 (followed by a NUL-character) */
+};
+
+/* A pre-compiled regex pattern. Instances are immutable (except for code
+ * being compiled lazily for different flags), and can be used concurrently
+ * by any number of threads. Also used internally by the implicit pattern
+ * cache of `DeeString_GetRegex()'. */
+DDATDEF DeeTypeObject DeeRegex_Type;
+#define DeeRegex_Check(ob)      DeeObject_InstanceOfExact(ob, &DeeRegex_Type) /* `Regex' is final */
+#define DeeRegex_CheckExact(ob) DeeObject_InstanceOfExact(ob, &DeeRegex_Type)
+
+/* Return the code of `self', compiled for `compile_flags' (set of `DEE_REGEX_COMPILE_*').
+ * The returned code remains valid until `self' is destroyed.
+ * @return: * :   The compiled regex pattern.
+ * @return: NULL: An error occurred. */
+DFUNDEF WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
+DeeRegex_GetCode(DeeRegexObject *__restrict self, unsigned int compile_flags);
+
 
 
 /************************************************************************/
@@ -622,6 +622,7 @@ INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL DeeSeq_Combinations(DeeObject
 INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL DeeSeq_RepeatCombinations(DeeObject *__restrict self, size_t r);
 INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL DeeSeq_Permutations(DeeObject *__restrict self);
 INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL DeeSeq_Permutations2(DeeObject *__restrict self, size_t r);
+INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL DeeSeq_Parallel(DeeObject *__restrict self, size_t chunk);
 
 /* Binary search for `keyed_search_item'
  * In case multiple elements match `keyed_search_item', the returned index
@@ -676,7 +677,9 @@ INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL DeeSeq_LStripSeq(DeeObject
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL DeeSeq_RStripSeq(DeeObject *self, DeeObject *seq, DeeObject *key);
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL DeeSeq_SplitSeq(DeeObject *self, DeeObject *sep_seq, DeeObject *key);
 
-/* Vector-sorting functions. */
+/* Vector-sorting functions.
+ * `DeeSeq_MergeSort()' is an adaptive, stable merge sort (pre-sorted runs are
+ * detected and re-used, and elements with equal keys retain their order). */
 INTDEF WUNUSED int DCALL
 DeeSeq_MergeSort(DREF DeeObject **__restrict dst,
                  DREF DeeObject *const *__restrict src,
@@ -3304,6 +3304,8 @@ WUNUSED NONNULL((1, 2)) Dee_ssize_t (Dee_unicode_printer_printobjectrepr)(struct
  *  - "utf-32-le", "utf32-le", "u32-le", "utf-32le", "utf32le", "u32le"
  *  - "utf-32-be", "utf32-be", "u32-be", "utf-32be", "utf32be", "u32be"
  *  - "string-escape", "backslash-escape", "c-escape"
+ * Additionally, the single-byte code pages from `lib/_codecs' (e.g. "cp437",
+ * "cp1252", "iso8859-15", ...) are implemented natively using lookup tables.
  * @throw: ValueError: The given `name' is not a recognized codec name.
  * @param: error_mode: One of `STRING_ERROR_F*'
  * @return: * :   The encoded/decoded variant of `self'
@@ -567,6 +567,7 @@ func("_lseek64", test: "return (int)_lseek64(1, 0, SEEK_SET);");
 func("_lseeki64", msvc, test: "return (int)_lseeki64(1, 0, SEEK_SET);");
 
 func("sendfile", "defined(CONFIG_HAVE_SYS_SENDFILE_H)", test: 'extern int outfd, infd; return (int)sendfile(outfd, infd, NULL, 16 * 1024 * 1024);');
+func("copy_file_range", "defined(CONFIG_HAVE_UNISTD_H) && defined(__USE_GNU) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))", test: 'extern int outfd, infd; return (int)copy_file_range(infd, NULL, outfd, NULL, 16 * 1024 * 1024, 0);');
 
 functest('chdir("..")', unix);
 functest('_chdir("..")', msvc);
@@ -4815,6 +4816,14 @@ feature("CONSTANT_NAN", "1", test: "extern int val[NAN != 0.0 ? 1 : -1]; return
 #define CONFIG_HAVE_sendfile
 #endif
 
+#ifdef CONFIG_NO_copy_file_range
+#undef CONFIG_HAVE_copy_file_range
+#elif !defined(CONFIG_HAVE_copy_file_range) && \
+      (defined(copy_file_range) || defined(__copy_file_range_defined) || (defined(CONFIG_HAVE_UNISTD_H) && \
+       defined(__USE_GNU) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))))
+#define CONFIG_HAVE_copy_file_range
+#endif
+
 #ifdef CONFIG_NO_chdir
 #undef CONFIG_HAVE_chdir
 #elif !defined(CONFIG_HAVE_chdir) && \
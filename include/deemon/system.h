@@ -133,6 +133,9 @@ DeeSystem_MakeAbsolute(/*String*/ DeeObject *__restrict filename);
 /* Return the current UTC realtime in microseconds since 01-01-1970T00:00:00+00:00 */
 DFUNDEF WUNUSED uint64_t DCALL DeeSystem_GetWalltime(void);
 
+/* Return the # of CPUs available on the host system (always >= 1) */
+DFUNDEF WUNUSED size_t DCALL DeeSystem_GetCpuCount(void);
+
 /* Return the last modified timestamp of `filename'
  * > uses the same format as `DeeSystem_GetWalltime()'
  * @return: (uint64_t)-1: An error was thrown */
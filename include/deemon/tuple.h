@@ -87,6 +87,16 @@ DDATDEF DeeTypeObject DeeTuple_Type;
 #define DeeTuple_Check(x)       DeeObject_InstanceOfExact(x, &DeeTuple_Type) /* `Tuple' is final */
 #define DeeTuple_CheckExact(x)  DeeObject_InstanceOfExact(x, &DeeTuple_Type)
 
+#ifdef CONFIG_BUILDING_DEEMON
+/* Internal layout of `Tuple.Iterator' (used by the interpreter's `foreach' fast-path) */
+typedef struct {
+	Dee_OBJECT_HEAD
+	DREF DeeTupleObject *ti_tuple; /* [1..1][const] Referenced tuple. */
+	DWEAK size_t         ti_index; /* [<= ti_tuple->t_size] Next-element index. */
+} DeeTupleIteratorObject;
+INTDEF DeeTypeObject DeeTupleIterator_Type;
+#endif /* CONFIG_BUILDING_DEEMON */
+
 
 /* Create new tuple objects. */
 DFUNDEF WUNUSED DREF DeeTupleObject *DCALL
@@ -0,0 +1,157 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_UTIL_WORKERPOOL_H
+#define GUARD_DEEMON_UTIL_WORKERPOOL_H 1
+
+#include "../api.h"
+#include "../object.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Dee_workerpool: A lazily started group of (detached) deemon threads.
+ *
+ * The pool only implements the life-cycle of its worker threads. What
+ * "work" is, and how it is queued, is up to the owner of the pool, who
+ * provides `wp_work' to take (and execute) a single unit of work.
+ *
+ * Worker threads are spawned by the first call to `Dee_workerpool_start()',
+ * and keep running until `Dee_workerpool_shutdown()' is called (once all
+ * pending work has been taken), or until they are interrupted (which
+ * happens when deemon shuts down).
+ *
+ * A worker pool is always embedded at the start of some object, and
+ * worker threads hold a reference to that object while running.
+ */
+
+DECL_BEGIN
+
+#ifdef DEE_SOURCE
+#define Dee_workerpool_object workerpool_object
+#endif /* DEE_SOURCE */
+
+typedef struct Dee_workerpool_object DeeWorkerPoolObject;
+struct Dee_thread_object;
+
+struct Dee_workerpool_object {
+	Dee_OBJECT_HEAD
+	/* [1..1][const] Take (and execute) one unit of work in worker number `index'
+	 * @return: true:  Some work was executed (look for more)
+	 * @return: false: No work is available right now */
+	WUNUSED_T NONNULL_T((1)) bool (DCALL *wp_work)(DeeWorkerPoolObject *__restrict self, size_t index);
+	DeeObject                      *wp_name;      /* [1..1][const] Name of worker threads (a string) */
+	size_t                          wp_workermax; /* [const] Max # of worker threads */
+	size_t                          wp_workerc;   /* [atomic][<= wp_workermax] # of spawned worker threads. */
+	DREF struct Dee_thread_object **wp_workerv;   /* [1..1][0..wp_workerc][owned][lock(WRITE_ONCE)] Worker threads. (Workers only
+	                                               * reference the pool while running, so this doesn't form a lasting loop) */
+	size_t                          wp_pending;   /* [atomic] # of units of work that were posted, but not yet taken (maintained
+	                                               * by the pool's owner; workers only exit after shutdown once this is 0) */
+	uint32_t                        wp_version;   /* [atomic] Incremented (and broadcast) when work is posted (futex word) */
+	uint32_t                        wp_running;   /* [atomic] # of worker threads still running (futex word) */
+	uint32_t                        wp_started;   /* [atomic] Non-zero once worker threads were (or are being) spawned. */
+	uint32_t                        wp_shutdown;  /* [atomic] Non-zero once `Dee_workerpool_shutdown()' was called. */
+};
+
+/* Initialize the worker pool fields of an object (the object header must already be initialized) */
+#define Dee_workerpool_init(self, work, name, workermax)                        \
+	(void)((self)->wp_work = (work), (self)->wp_name = (DeeObject *)(name),     \
+	       (self)->wp_workermax = (workermax), (self)->wp_workerc = 0,          \
+	       (self)->wp_workerv = NULL, (self)->wp_pending = 0,                   \
+	       (self)->wp_version = 0, (self)->wp_running = 0,                      \
+	       (self)->wp_started = 0, (self)->wp_shutdown = 0)
+
+/* Finalize the worker pool fields of an object (drop references to worker threads) */
+DFUNDEF NONNULL((1)) void DCALL Dee_workerpool_fini(DeeWorkerPoolObject *__restrict self);
+
+/* Wake up one, or all idle workers after new work was posted. */
+DFUNDEF NONNULL((1)) void DCALL Dee_workerpool_notify(DeeWorkerPoolObject *__restrict self);
+DFUNDEF NONNULL((1)) void DCALL Dee_workerpool_broadcast(DeeWorkerPoolObject *__restrict self);
+
+/* Make sure that worker threads have been spawned (no-op after the first call).
+ * If only some workers could be spawned, the pool makes do with those.
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown (no worker could be spawned; try again later). */
+DFUNDEF WUNUSED NONNULL((1)) int DCALL
+Dee_workerpool_start(DeeWorkerPoolObject *__restrict self);
+
+/* Return the index of the calling thread's worker, or `(size_t)-1' if
+ * the calling thread isn't one of the worker threads of `self' */
+DFUNDEF WUNUSED NONNULL((1)) size_t DCALL
+Dee_workerpool_selfindex(DeeWorkerPoolObject *__restrict self);
+
+/* Stop the pool, such that workers exit once all pending work has been taken.
+ * When `wait' is true, also wait for all workers to exit (unless the calling
+ * thread is one of the pool's workers)
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown. */
+DFUNDEF WUNUSED NONNULL((1)) int DCALL
+Dee_workerpool_shutdown(DeeWorkerPoolObject *__restrict self, bool wait);
+
+
+#ifdef CONFIG_BUILDING_DEEMON
+/* Parallel jobs are split into chunks, which are then processed by the
+ * calling thread, as well as a process-wide pool of worker threads (one
+ * per additional CPU). Workers (and the caller) claim chunks of pending
+ * jobs one at a time, such that faster threads automatically end up
+ * processing more chunks.
+ *
+ * The calling thread never blocks for as long as there are unclaimed chunks
+ * in its own job, which also makes it safe to start another parallel job
+ * from within a chunk (i.e. nested parallel jobs can't dead-lock). */
+struct Dee_parallel_job {
+	struct Dee_parallel_job *pj_link;   /* [0..1][lock(INTERNAL)] Next pending job. */
+	/* [1..1][const] Process items `[start, end)' of chunk number `index'.
+	 * @return: 0 : Success.
+	 * @return: -1: An error was thrown. */
+	WUNUSED_T NONNULL_T((1)) int (DCALL *pj_func)(struct Dee_parallel_job *__restrict self,
+	                                              size_t index, size_t start, size_t end);
+	size_t                   pj_size;   /* [const] Total # of items. */
+	size_t                   pj_chunk;  /* [const][!0] # of items per chunk. */
+	size_t                   pj_chunks; /* [const] Total # of chunks. */
+	size_t                   pj_next;   /* [lock(INTERNAL)] Index of the next chunk to hand out. */
+	size_t                   pj_done;   /* [atomic] # of chunks that have been completed. */
+	DREF DeeObject          *pj_error;  /* [0..1][lock(WRITE_ONCE)] The first error thrown by a chunk. */
+};
+
+#define Dee_parallel_job_init(self, func, size, chunk)           \
+	(void)((self)->pj_func   = (func),                            \
+	       (self)->pj_size   = (size),                            \
+	       (self)->pj_chunk  = (chunk),                           \
+	       (self)->pj_chunks = ((size) + (chunk) - 1) / (chunk),  \
+	       (self)->pj_next   = 0,                                 \
+	       (self)->pj_done   = 0,                                 \
+	       (self)->pj_error  = NULL)
+
+/* Return the # of worker threads used for parallel jobs (not counting the calling thread) */
+INTDEF WUNUSED size_t DCALL Dee_parallel_getworkers(void);
+
+/* Process all chunks of `self' (using the worker pool if possible)
+ * Once a chunk fails, chunks that haven't been started yet are skipped.
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown (the first error thrown by any chunk). */
+INTDEF WUNUSED NONNULL((1)) int DCALL
+Dee_parallel_job_exec(struct Dee_parallel_job *__restrict self);
+#endif /* CONFIG_BUILDING_DEEMON */
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_UTIL_WORKERPOOL_H */
@@ -55,6 +55,7 @@
 #include <hybrid/sched/yield.h>
 #include <hybrid/unaligned.h>
 
+#include "../objects/seq/range.h"
 #include "../objects/seq/varkwds.h"
 #include "../runtime/runtime_error.h"
 
@@ -154,6 +155,62 @@ construct_varkwds_mapping_impl(DeeCodeObject *__restrict code,
 }
 #endif /* !CONSTRUCT_VARKWDS_MAPPING_IMPL_DEFINED */
 
+#ifndef FOREACH_NEXT_DEFINED
+#define FOREACH_NEXT_DEFINED
+/* Same as `DeeObject_IterNext()', but used by `ASM_FOREACH', and with
+ * inline fast-paths for iterators of builtin sequences that are only
+ * referenced by the stack slot of the loop (which is the case for every
+ * `for (local x: seq)'-loop). Since no-one else can observe or advance
+ * such an iterator, its index can be advanced without the atomic
+ * compare-exchange loop that would normally be required.
+ *
+ * NOTE: Elements are still loaded one at a time (rather than prefetching
+ *       a batch of them), such that modifications made to a List by the
+ *       loop's body remain visible to subsequent iterations. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *ATTR_FASTCALL
+foreach_next(DeeObject *__restrict iter) {
+	DeeTypeObject *tp_iter;
+	if (DeeObject_IsShared(iter))
+		goto generic;
+	tp_iter = Dee_TYPE(iter);
+	if (tp_iter == &DeeTupleIterator_Type) {
+		DeeTupleIteratorObject *me = (DeeTupleIteratorObject *)iter;
+		DeeObject *result;
+		if (me->ti_index >= DeeTuple_SIZE(me->ti_tuple))
+			return ITER_DONE;
+		result = DeeTuple_GET(me->ti_tuple, me->ti_index);
+		++me->ti_index;
+		return_reference_(result);
+	} else if (tp_iter == &SeqIntRangeIterator_Type) {
+		IntRangeIterator *me = (IntRangeIterator *)iter;
+		dssize_t index, new_index;
+		index = me->iri_index;
+		if (OVERFLOW_SADD(index, me->iri_step, &new_index) ||
+		    (likely(me->iri_step >= 0) ? index >= me->iri_end
+		                               : index <= me->iri_end))
+			return ITER_DONE;
+		me->iri_index = new_index;
+		return DeeInt_NewSSize(index);
+	} else if (tp_iter == &DeeListIterator_Type) {
+		DeeListIteratorObject *me = (DeeListIteratorObject *)iter;
+		DeeListObject *list = me->li_list;
+		DREF DeeObject *result;
+		DeeList_LockRead(list);
+		if (me->li_index >= list->l_list.ol_elemc) {
+			DeeList_LockEndRead(list);
+			return ITER_DONE;
+		}
+		result = list->l_list.ol_elemv[me->li_index];
+		Dee_Incref(result);
+		DeeList_LockEndRead(list);
+		++me->li_index;
+		return result;
+	}
+generic:
+	return DeeObject_IterNext(iter);
+}
+#endif /* !FOREACH_NEXT_DEFINED */
+
 
 
 /* @return: * :        Prefixed object pointer (dereferences to non-NULL)
@@ -1277,7 +1334,7 @@ assert_ip_bounds:
 
 		TARGETSimm16(ASM_FOREACH, -1, +2) {
 			DREF DeeObject *elem;
-			elem = DeeObject_IterNext(TOP);
+			elem = foreach_next(TOP);
 			if unlikely(!elem)
 				HANDLE_EXCEPT();
 			if (elem == ITER_DONE) {
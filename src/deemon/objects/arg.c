@@ -1116,6 +1116,33 @@ PRIVATE struct type_nsi tpconst kmap_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+kmap_foreach_pair(KwdsMapping *self, Dee_foreach_pair_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	DeeKwdsObject *kwds = self->kmo_kwds;
+	size_t i;
+	for (i = 0; i <= kwds->kw_mask; ++i) {
+		DREF DeeObject *value;
+		struct kwds_entry *kwd = &kwds->kw_map[i];
+		if (kwd->ke_name == NULL)
+			continue;
+		DeeKwdsMapping_LockRead(self);
+		if unlikely(!self->kmo_argv) {
+			DeeKwdsMapping_LockEndRead(self);
+			break;
+		}
+		value = self->kmo_argv[kwd->ke_index];
+		Dee_Incref(value);
+		DeeKwdsMapping_LockEndRead(self);
+		temp = (*proc)(arg, (DeeObject *)kwd->ke_name, value);
+		Dee_Decref_unlikely(value);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+	}
+	return result;
+}
+
 PRIVATE struct type_seq kmap_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&kmap_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&kmap_size,
@@ -1126,7 +1153,9 @@ PRIVATE struct type_seq kmap_seq = {
 	/* .tp_range_get = */ NULL,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &kmap_nsi
+	/* .tp_nsi       = */ &kmap_nsi,
+	/* .tp_foreach      = */ NULL,
+	/* .tp_foreach_pair = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_pair_t, void *))&kmap_foreach_pair,
 };
 
 
@@ -1147,7 +1176,7 @@ PUBLIC DeeTypeObject DeeKwdsMapping_Type = {
 	/* .tp_doc      = */ NULL,
 	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeMapping_Type,
 	/* .tp_init = */ {
 		{
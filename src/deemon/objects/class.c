@@ -5044,6 +5044,8 @@ bind_class_operator(DeeTypeObject *__restrict type_type,
 	} else if (operator_name <= OPERATOR_SEQMAX) {
 		if unlikely(LAZY_ALLOCATE(class_type->tp_seq))
 			goto err;
+		/* The table was allocated by us, so it includes `tp_foreach' & friends. */
+		class_type->tp_features |= TF_SEQFOREACH;
 		/* compare operator. */
 		ASSERT(operator_name >= OPERATOR_SEQMIN);
 		wrapper = seq_wrappers[operator_name - OPERATOR_SEQMIN].ow_wrapper;
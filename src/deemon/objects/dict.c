@@ -1846,6 +1846,68 @@ PRIVATE struct type_cmp dict_cmp = {
 	/* .tp_ge   = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))NULL, // TODO: &dict_ge,
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+dict_foreach_pair(Dict *self, Dee_foreach_pair_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	DeeDict_LockRead(self);
+	for (i = 0; i <= self->d_mask; ++i) {
+		DREF DeeObject *key, *value;
+		key = self->d_elem[i].di_key;
+		if (key == NULL || key == dummy)
+			continue;
+		value = self->d_elem[i].di_value;
+		Dee_Incref(key);
+		Dee_Incref(value);
+		DeeDict_LockEndRead(self);
+		temp = (*proc)(arg, key, value);
+		Dee_Decref_unlikely(value);
+		Dee_Decref_unlikely(key);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		DeeDict_LockRead(self);
+	}
+	DeeDict_LockEndRead(self);
+	return result;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+dict_foreach(Dict *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	DeeDict_LockRead(self);
+	for (i = 0; i <= self->d_mask; ++i) {
+		DREF DeeTupleObject *pair;
+		DREF DeeObject *key, *value;
+		key = self->d_elem[i].di_key;
+		if (key == NULL || key == dummy)
+			continue;
+		value = self->d_elem[i].di_value;
+		Dee_Incref(key);
+		Dee_Incref(value);
+		DeeDict_LockEndRead(self);
+		pair = DeeTuple_NewUninitialized(2);
+		if unlikely(!pair) {
+			Dee_Decref(value);
+			Dee_Decref(key);
+			goto err;
+		}
+		DeeTuple_SET(pair, 0, key);   /* Inherit reference */
+		DeeTuple_SET(pair, 1, value); /* Inherit reference */
+		temp = (*proc)(arg, (DeeObject *)pair);
+		Dee_Decref_likely(pair);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		DeeDict_LockRead(self);
+	}
+	DeeDict_LockEndRead(self);
+	return result;
+err:
+	return -1;
+}
+
 PRIVATE struct type_seq dict_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&dict_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&dict_size,
@@ -1856,7 +1918,9 @@ PRIVATE struct type_seq dict_seq = {
 	/* .tp_range_get = */ NULL,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &dict_nsi
+	/* .tp_nsi       = */ &dict_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&dict_foreach,
+	/* .tp_foreach_pair = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_pair_t, void *))&dict_foreach_pair,
 };
 
 PRIVATE WUNUSED NONNULL((1)) int DCALL
@@ -2045,16 +2109,17 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1, 2, 3)) dssize_t DCALL
+dict_update_foreach_cb(void *arg, DeeObject *key, DeeObject *value) {
+	return dict_setitem((Dict *)arg, key, value);
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 dict_update(Dict *self, size_t argc, DeeObject *const *argv) {
-	DeeObject *items, *iterator;
-	int error;
+	DeeObject *items;
 	if (DeeArg_Unpack(argc, argv, "o:update", &items))
 		goto err;
-	iterator = DeeObject_IterSelf(items);
-	error    = dict_insert_iterator(self, iterator);
-	Dee_Decref(iterator);
-	if unlikely(error)
+	if unlikely(DeeObject_ForeachPair(items, &dict_update_foreach_cb, self) < 0)
 		goto err;
 	return_none;
 err:
@@ -2213,7 +2278,7 @@ PUBLIC DeeTypeObject DeeDict_Type = {
 	                         /**/ "as key and value to insert into @this ?."),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FNAMEOBJECT,
 	/* .tp_weakrefs = */ WEAKREF_SUPPORT_ADDR(Dict),
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeMapping_Type,
 	/* .tp_init = */ {
 		{
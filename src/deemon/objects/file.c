@@ -46,6 +46,10 @@
 #include <hybrid/minmax.h>
 #include <hybrid/typecore.h>
 
+#if defined(CONFIG_HAVE_sendfile) && defined(CONFIG_HAVE_SYS_SENDFILE_H)
+#include <sys/sendfile.h>
+#endif /* CONFIG_HAVE_sendfile && CONFIG_HAVE_SYS_SENDFILE_H */
+
 #include "../runtime/runtime_error.h"
 #include "../runtime/strings.h"
 
@@ -2431,6 +2435,194 @@ err:
 	return NULL;
 }
 
+/* Buffer size used by `File.copyto()' when data has to be copied by hand. */
+#ifndef FILE_COPYTO_BUFSIZE
+#define FILE_COPYTO_BUFSIZE (64 * 1024)
+#endif /* !FILE_COPYTO_BUFSIZE */
+
+#undef HAVE_file_copyto_sysfd
+#if defined(DeeSystemFile_GetHandle) && defined(DEESYSTEM_FILE_USE_UNIX) && \
+    (defined(CONFIG_HAVE_copy_file_range) || defined(CONFIG_HAVE_sendfile))
+#define HAVE_file_copyto_sysfd
+#endif /* ... */
+
+#ifdef HAVE_file_copyto_sysfd
+/* The max # of bytes transferred by a single `copy_file_range(2)' / `sendfile(2)' */
+#ifndef LINUX_SENDFILE_MAXCOUNT
+#define LINUX_SENDFILE_MAXCOUNT 0x7ffff000
+#endif /* !LINUX_SENDFILE_MAXCOUNT */
+
+/* Copy data between 2 descriptors without it passing through user-space.
+ * Stops early (without throwing an error) when the kernel can't do this
+ * for the given pair of descriptors, in which case the caller should copy
+ * the remainder by hand (which will also report any I/O error).
+ * @param: p_eof: Set to true if `src_fd' has reached its end.
+ * @return: * :         The # of bytes copied.
+ * @return: (dpos_t)-1: An error occurred (interrupt). */
+PRIVATE WUNUSED NONNULL((4)) dpos_t DCALL
+file_copyto_sysfd(int src_fd, int dst_fd, dpos_t maxbytes, bool *__restrict p_eof) {
+	dpos_t result = 0;
+#ifdef CONFIG_HAVE_copy_file_range
+	bool use_copy_file_range = true;
+#endif /* CONFIG_HAVE_copy_file_range */
+	while (result < maxbytes) {
+		ssize_t status = -1;
+		size_t chunk   = LINUX_SENDFILE_MAXCOUNT;
+		if (chunk > maxbytes - result)
+			chunk = (size_t)(maxbytes - result);
+		if (DeeThread_CheckInterrupt())
+			goto err;
+		DBG_ALIGNMENT_DISABLE();
+#ifdef CONFIG_HAVE_copy_file_range
+		if (use_copy_file_range) {
+			status = copy_file_range(src_fd, NULL, dst_fd, NULL, chunk, 0);
+			/* `EXDEV', `EINVAL' (not a pair of regular files), `EBADF' (`O_APPEND'), `ENOSYS', ... */
+			if (status < 0 && DeeSystem_GetErrno() != EINTR)
+				use_copy_file_range = false;
+		}
+		if (!use_copy_file_range)
+#endif /* CONFIG_HAVE_copy_file_range */
+		{
+#ifdef CONFIG_HAVE_sendfile
+			status = sendfile(dst_fd, src_fd, NULL, chunk);
+#endif /* CONFIG_HAVE_sendfile */
+		}
+		if (status < 0) {
+			int error = DeeSystem_GetErrno();
+			DBG_ALIGNMENT_ENABLE();
+			if (error == EINTR)
+				continue;
+			break; /* Let the caller copy the rest by hand. */
+		}
+		DBG_ALIGNMENT_ENABLE();
+		if (status == 0) {
+			*p_eof = true;
+			break;
+		}
+		result += (size_t)status;
+	}
+	return result;
+err:
+	return (dpos_t)-1;
+}
+#endif /* HAVE_file_copyto_sysfd */
+
+/* Copy up to `maxbytes' bytes from the current position of `self' to `dst'.
+ * @return: * :         The # of bytes copied (less than `maxbytes' if `self' reached its end).
+ * @return: (dpos_t)-1: An error occurred. */
+PRIVATE WUNUSED NONNULL((1, 2)) dpos_t DCALL
+file_docopyto(DeeObject *self, DeeObject *dst, dpos_t maxbytes) {
+	dpos_t result = 0;
+	size_t bufsize;
+	void *buffer;
+#ifdef HAVE_file_copyto_sysfd
+	if (DeeSystemFile_Check(self) && DeeSystemFile_Check(dst)) {
+		int src_fd = DeeSystemFile_GetHandle(self);
+		int dst_fd = DeeSystemFile_GetHandle(dst);
+		if (src_fd != -1 && dst_fd != -1) {
+			bool eof = false;
+			result = file_copyto_sysfd(src_fd, dst_fd, maxbytes, &eof);
+			if unlikely(result == (dpos_t)-1)
+				goto err;
+			if (eof)
+				return result;
+		}
+	}
+#endif /* HAVE_file_copyto_sysfd */
+	if (result >= maxbytes)
+		return result;
+
+	/* Copy (the remainder) by hand. */
+	bufsize = FILE_COPYTO_BUFSIZE;
+	if (bufsize > maxbytes - result)
+		bufsize = (size_t)(maxbytes - result);
+	buffer = Dee_Malloc(bufsize);
+	if unlikely(!buffer)
+		goto err;
+	while (result < maxbytes) {
+		size_t count = bufsize;
+		if (count > maxbytes - result)
+			count = (size_t)(maxbytes - result);
+		count = DeeFile_Read(self, buffer, count);
+		if unlikely(count == (size_t)-1)
+			goto err_buffer;
+		if (!count)
+			break; /* EOF */
+		if unlikely(DeeFile_WriteAll(dst, buffer, count) == (size_t)-1)
+			goto err_buffer;
+		result += count;
+	}
+	Dee_Free(buffer);
+	return result;
+err_buffer:
+	Dee_Free(buffer);
+err:
+	return (dpos_t)-1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+file_copyto(DeeObject *self, size_t argc,
+            DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *dst;
+	dpos_t result, maxbytes = (dpos_t)-1;
+	PRIVATE DEFINE_KWLIST(kwlist, { K(dst), K(maxbytes), KEND });
+	if (DeeArg_UnpackKw(argc, argv, kw, kwlist,
+	                    "o|" UNPdN(DEE_SIZEOF_DEE_POS_T) ":copyto",
+	                    &dst, &maxbytes))
+		goto err;
+	result = file_docopyto(self, dst, maxbytes);
+	if unlikely(result == (dpos_t)-1)
+		goto err;
+	return DeeInt_NewUInt64(result);
+err:
+	return NULL;
+}
+
+/* Asynchronous file I/O is implemented by `threading.AsyncIO' (which
+ * uses io_uring when available, and a thread pool otherwise) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+file_callasync(char const *__restrict name, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *aio_type, *aio, *result;
+	aio_type = DeeModule_GetExternString("threading", "AsyncIO");
+	if unlikely(!aio_type)
+		goto err;
+	aio = DeeObject_GetAttrString(aio_type, "default");
+	Dee_Decref(aio_type);
+	if unlikely(!aio)
+		goto err;
+	result = DeeObject_CallAttrString(aio, name, argc, argv);
+	Dee_Decref(aio);
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+file_preadasync(DeeObject *self, size_t argc,
+                DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *args[3];
+	PRIVATE DEFINE_KWLIST(kwlist, { K(pos), K(maxbytes), KEND });
+	if (DeeArg_UnpackKw(argc, argv, kw, kwlist, "oo:preadasync", &args[1], &args[2]))
+		goto err;
+	args[0] = self;
+	return file_callasync("pread", 3, args);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+file_pwriteasync(DeeObject *self, size_t argc,
+                 DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *args[3];
+	PRIVATE DEFINE_KWLIST(kwlist, { K(data), K(pos), KEND });
+	if (DeeArg_UnpackKw(argc, argv, kw, kwlist, "oo:pwriteasync", &args[1], &args[2]))
+		goto err;
+	args[0] = self;
+	return file_callasync("pwrite", 3, args);
+err:
+	return NULL;
+}
+
 struct whence_name {
 	char name[4];
 	int id;
@@ -2751,6 +2943,22 @@ PRIVATE struct type_method tpconst file_methods[] = {
 	              "(data:?DBytes,pos:?Dint,writeall=!t)->?Dint\n"
 	              "Similar to ?#write, but write data to a given file-offset "
 	              /**/ "@pos, rather than at the current file position"),
+	TYPE_KWMETHOD("preadasync", &file_preadasync,
+	              "(pos:?Dint,maxbytes:?Dint)->?Ethreading:Future\n"
+	              "Start reading up to @maxbytes bytes from @pos and return a ${threading.Future} "
+	              /**/ "for the ?DBytes that were read. Same as ${threading.AsyncIO.default.pread(this, pos, maxbytes)}"),
+	TYPE_KWMETHOD("pwriteasync", &file_pwriteasync,
+	              "(data:?DBytes,pos:?Dint)->?Ethreading:Future\n"
+	              "Start writing @data at @pos and return a ${threading.Future} for the number "
+	              /**/ "of bytes written. Same as ${threading.AsyncIO.default.pwrite(this, data, pos)}"),
+	TYPE_KWMETHOD("copyto", &file_copyto,
+	              "(dst:?DFile,maxbytes=!-1)->?Dint\n"
+	              "Copy up to @maxbytes (or everything when ${-1}) from the current position "
+	              /**/ "of @this file to @dst, returning the number of bytes copied. Stops early "
+	              /**/ "when the end of @this file is reached.\n"
+	              "When both files are system files, data is copied by the kernel (using "
+	              /**/ "${copy_file_range(2)} or ${sendfile(2)}) without passing through deemon. "
+	              /**/ "Otherwise, data is copied using ?#read and ?#write"),
 	TYPE_KWMETHOD("seek", &file_seek,
 	              "(off:?Dint,whence=!PSET)->?Dint\n"
 	              "(off:?Dint,whence:?Dint)->?Dint\n"
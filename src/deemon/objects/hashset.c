@@ -1746,6 +1746,29 @@ PRIVATE struct type_cmp hashset_cmp = {
 	/* .tp_ge   = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))NULL, // TODO: &hashset_ge,
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+hashset_foreach(HashSet *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	DeeHashSet_LockRead(self);
+	for (i = 0; i <= self->hs_mask; ++i) {
+		DREF DeeObject *key;
+		key = self->hs_elem[i].hsi_key;
+		if (key == NULL || key == dummy)
+			continue;
+		Dee_Incref(key);
+		DeeHashSet_LockEndRead(self);
+		temp = (*proc)(arg, key);
+		Dee_Decref_unlikely(key);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		DeeHashSet_LockRead(self);
+	}
+	DeeHashSet_LockEndRead(self);
+	return result;
+}
+
 PRIVATE struct type_seq hashset_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&hashset_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&hashset_size,
@@ -1756,7 +1779,9 @@ PRIVATE struct type_seq hashset_seq = {
 	/* .tp_range_get = */ NULL,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &hashset_nsi
+	/* .tp_nsi       = */ &hashset_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&hashset_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE WUNUSED NONNULL((1)) int DCALL
@@ -2027,7 +2052,7 @@ PUBLIC DeeTypeObject DeeHashSet_Type = {
 	                         /**/ "in @this HashSet, following a random order"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FNAMEOBJECT,
 	/* .tp_weakrefs = */ WEAKREF_SUPPORT_ADDR(HashSet),
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSet_Type,
 	/* .tp_init = */ {
 		{
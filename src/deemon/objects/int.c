@@ -136,9 +136,153 @@
 #endif /* !__OPTIMIZE_SIZE__ */
 #endif /* ... */
 
+/* Config option to lazily cache positive single-digit integers
+ * in [0,CONFIG_INT_SMALL_CACHE_LIMIT) once they are first created.
+ * Cached integers are shared (and thus never modified in-place),
+ * meaning that loop counters and indices stop needing a fresh heap
+ * allocation every time they are re-created. */
+#if (!defined(CONFIG_INT_SMALL_CACHED) && \
+     !defined(CONFIG_INT_SMALL_NORMAL))
+#if (defined(__OPTIMIZE_SIZE__) || defined(CONFIG_NO_CACHES) || \
+     defined(CONFIG_NO_INT_CACHES))
+#define CONFIG_INT_SMALL_NORMAL
+#else /* ... */
+#define CONFIG_INT_SMALL_CACHED
+#endif /* !... */
+#endif /* ... */
+
+#ifndef CONFIG_INT_SMALL_CACHE_LIMIT
+#define CONFIG_INT_SMALL_CACHE_LIMIT 65536
+#endif /* !CONFIG_INT_SMALL_CACHE_LIMIT */
+
 
 DECL_BEGIN
 
+#ifdef CONFIG_INT_SMALL_CACHED
+#define INT_SMALL_CACHE_PAGEBITS 8
+#define INT_SMALL_CACHE_PAGESIZE ((size_t)1 << INT_SMALL_CACHE_PAGEBITS)
+#define INT_SMALL_CACHE_PAGEMASK (INT_SMALL_CACHE_PAGESIZE - 1)
+
+/* Lazily allocated small integer cache.
+ * Pages (of `INT_SMALL_CACHE_PAGESIZE' integers each) are allocated
+ * on first use, and elements are allocated the first time that a
+ * value from the associated page is requested. */
+PRIVATE DREF DeeIntObject **int_small_cache[(CONFIG_INT_SMALL_CACHE_LIMIT +
+                                             INT_SMALL_CACHE_PAGEMASK) /
+                                            INT_SMALL_CACHE_PAGESIZE] = {
+	NULL,
+};
+
+#ifndef CONFIG_NO_THREADS
+PRIVATE Dee_atomic_rwlock_t int_small_cache_lock = DEE_ATOMIC_RWLOCK_INIT;
+#endif /* !CONFIG_NO_THREADS */
+#define int_small_cache_lock_reading()    Dee_atomic_rwlock_reading(&int_small_cache_lock)
+#define int_small_cache_lock_writing()    Dee_atomic_rwlock_writing(&int_small_cache_lock)
+#define int_small_cache_lock_tryread()    Dee_atomic_rwlock_tryread(&int_small_cache_lock)
+#define int_small_cache_lock_trywrite()   Dee_atomic_rwlock_trywrite(&int_small_cache_lock)
+#define int_small_cache_lock_canread()    Dee_atomic_rwlock_canread(&int_small_cache_lock)
+#define int_small_cache_lock_canwrite()   Dee_atomic_rwlock_canwrite(&int_small_cache_lock)
+#define int_small_cache_lock_waitread()   Dee_atomic_rwlock_waitread(&int_small_cache_lock)
+#define int_small_cache_lock_waitwrite()  Dee_atomic_rwlock_waitwrite(&int_small_cache_lock)
+#define int_small_cache_lock_read()       Dee_atomic_rwlock_read(&int_small_cache_lock)
+#define int_small_cache_lock_write()      Dee_atomic_rwlock_write(&int_small_cache_lock)
+#define int_small_cache_lock_tryupgrade() Dee_atomic_rwlock_tryupgrade(&int_small_cache_lock)
+#define int_small_cache_lock_upgrade()    Dee_atomic_rwlock_upgrade(&int_small_cache_lock)
+#define int_small_cache_lock_downgrade()  Dee_atomic_rwlock_downgrade(&int_small_cache_lock)
+#define int_small_cache_lock_endwrite()   Dee_atomic_rwlock_endwrite(&int_small_cache_lock)
+#define int_small_cache_lock_endread()    Dee_atomic_rwlock_endread(&int_small_cache_lock)
+#define int_small_cache_lock_end()        Dee_atomic_rwlock_end(&int_small_cache_lock)
+
+PRIVATE size_t DCALL
+int_small_cache_clearall(size_t max_clear) {
+	size_t i, result = 0;
+	for (i = 0; i < COMPILER_LENOF(int_small_cache); ++i) {
+		size_t j;
+		DREF DeeIntObject **page;
+		if (!atomic_read(&int_small_cache[i]))
+			continue;
+		int_small_cache_lock_write();
+		page = int_small_cache[i];
+		int_small_cache[i] = NULL;
+		int_small_cache_lock_endwrite();
+		if unlikely(!page)
+			continue;
+		for (j = 0; j < INT_SMALL_CACHE_PAGESIZE; ++j) {
+			DREF DeeIntObject *ob = page[j];
+			if (!ob)
+				continue;
+			if (!Dee_DecrefIfNotOne(ob)) {
+				result += offsetof(DeeIntObject, ob_digit) + sizeof(digit);
+				Dee_Decref(ob);
+			}
+		}
+		Dee_Free(page);
+		result += INT_SMALL_CACHE_PAGESIZE * sizeof(DREF DeeIntObject *);
+		if (result >= max_clear)
+			break;
+	}
+	return result;
+}
+
+/* Return a reference to the cached integer for `val'
+ * @param: val: Must be non-zero and less than `CONFIG_INT_SMALL_CACHE_LIMIT' */
+PRIVATE WUNUSED DREF DeeIntObject *DCALL
+int_small_cache_get(digit val) {
+	DREF DeeIntObject *result, **page, **new_page;
+	size_t pageno = (size_t)val >> INT_SMALL_CACHE_PAGEBITS;
+	size_t index  = (size_t)val & INT_SMALL_CACHE_PAGEMASK;
+	ASSERT(val != 0);
+	ASSERT(val < CONFIG_INT_SMALL_CACHE_LIMIT);
+	int_small_cache_lock_read();
+	page = int_small_cache[pageno];
+	if likely(page) {
+		result = page[index];
+		if likely(result) {
+			Dee_Incref(result);
+			int_small_cache_lock_endread();
+			return result;
+		}
+	}
+	int_small_cache_lock_endread();
+	result = DeeInt_Alloc(1);
+	if unlikely(!result)
+		goto err;
+	result->ob_digit[0] = val;
+
+	/* Failing to allocate the cache page isn't an error: just don't cache. */
+	new_page = NULL;
+	if (!page)
+		new_page = (DREF DeeIntObject **)Dee_TryCallocc(INT_SMALL_CACHE_PAGESIZE,
+		                                                 sizeof(DREF DeeIntObject *));
+	int_small_cache_lock_write();
+	page = int_small_cache[pageno];
+	if (!page) {
+		if unlikely(!new_page) {
+			int_small_cache_lock_endwrite();
+			return result;
+		}
+		int_small_cache[pageno] = page = new_page;
+		new_page = NULL;
+	}
+	if unlikely(page[index] != NULL) {
+		/* Special case: The integer has been created in the mean time. */
+		DREF DeeIntObject *new_result = page[index];
+		Dee_Incref(new_result);
+		int_small_cache_lock_endwrite();
+		Dee_Free(new_page);
+		Dee_Decref(result);
+		return new_result;
+	}
+	Dee_Incref(result); /* The reference stored in `int_small_cache' */
+	page[index] = result;
+	int_small_cache_lock_endwrite();
+	Dee_Free(new_page);
+	return result;
+err:
+	return NULL;
+}
+#endif /* CONFIG_INT_SMALL_CACHED */
+
 #ifndef CONFIG_HAVE_memend
 #define CONFIG_HAVE_memend
 #undef memend
@@ -172,6 +316,11 @@ INTERN size_t DCALL
 Dee_intcache_clearall(size_t max_clear) {
 	size_t i, result = 0;
 	struct free_int_set *set;
+#ifdef CONFIG_INT_SMALL_CACHED
+	result = int_small_cache_clearall(max_clear);
+	if (result >= max_clear)
+		return result;
+#endif /* CONFIG_INT_SMALL_CACHED */
 	for (i = 0; i < COMPILER_LENOF(free_ints); ++i) {
 		struct free_int *chain;
 		struct free_int *chain_end;
@@ -311,9 +460,15 @@ done:
 #else /* CONFIG_INT_CACHE_MAXCOUNT != 0 */
 
 INTERN size_t DCALL
+#ifdef CONFIG_INT_SMALL_CACHED
+Dee_intcache_clearall(size_t max_clear) {
+	return int_small_cache_clearall(max_clear);
+}
+#else /* CONFIG_INT_SMALL_CACHED */
 Dee_intcache_clearall(size_t UNUSED(max_clear)) {
 	return 0;
 }
+#endif /* !CONFIG_INT_SMALL_CACHED */
 
 
 INTERN WUNUSED DREF DeeIntObject *DCALL
@@ -1099,6 +1254,14 @@ DeeInt_NewUInt16(uint16_t val) {
 #if DIGIT_BITS >= 16
 	if (!val)
 		return_reference_(DeeInt_Zero);
+#ifdef CONFIG_INT_SMALL_CACHED
+#if CONFIG_INT_SMALL_CACHE_LIMIT <= UINT16_MAX
+	if (val < CONFIG_INT_SMALL_CACHE_LIMIT)
+#endif /* CONFIG_INT_SMALL_CACHE_LIMIT <= UINT16_MAX */
+	{
+		return (DREF DeeObject *)int_small_cache_get((digit)val);
+	}
+#endif /* CONFIG_INT_SMALL_CACHED */
 	result = DeeInt_Alloc(1);
 	if likely(result) {
 		result->ob_size     = 1;
@@ -1109,6 +1272,10 @@ DeeInt_NewUInt16(uint16_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = 1;
@@ -1141,6 +1308,10 @@ DeeInt_NewUInt32(uint32_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = 1;
@@ -1186,6 +1357,10 @@ DeeInt_NewUInt64(uint64_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = 1;
@@ -1225,6 +1400,16 @@ DeeInt_NewInt16(int16_t val) {
 		sign    = -1;
 		abs_val = (uint16_t)0 - (uint16_t)val;
 	}
+#ifdef CONFIG_INT_SMALL_CACHED
+#if CONFIG_INT_SMALL_CACHE_LIMIT <= INT16_MAX
+	if (sign > 0 && abs_val < CONFIG_INT_SMALL_CACHE_LIMIT)
+#else /* CONFIG_INT_SMALL_CACHE_LIMIT <= INT16_MAX */
+	if (sign > 0)
+#endif /* CONFIG_INT_SMALL_CACHE_LIMIT > INT16_MAX */
+	{
+		return (DREF DeeObject *)int_small_cache_get((digit)abs_val);
+	}
+#endif /* CONFIG_INT_SMALL_CACHED */
 	result = DeeInt_Alloc(1);
 	if likely(result) {
 		result->ob_size     = sign;
@@ -1239,6 +1424,10 @@ DeeInt_NewInt16(int16_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (sign > 0 && abs_val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)abs_val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = sign;
@@ -1278,6 +1467,10 @@ DeeInt_NewInt32(int32_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (sign > 0 && abs_val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)abs_val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = sign;
@@ -1329,6 +1522,10 @@ DeeInt_NewInt64(int64_t val) {
 		if (!val)
 			return_reference_(DeeInt_Zero);
 		/* Fast-path: The integer fits into a single digit. */
+#ifdef CONFIG_INT_SMALL_CACHED
+		if (sign > 0 && abs_val < CONFIG_INT_SMALL_CACHE_LIMIT)
+			return (DREF DeeObject *)int_small_cache_get((digit)abs_val);
+#endif /* CONFIG_INT_SMALL_CACHED */
 		result = DeeInt_Alloc(1);
 		if likely(result) {
 			result->ob_size     = sign;
@@ -3641,6 +3838,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_eq(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) == 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -3655,6 +3854,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_ne(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) != 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -3669,6 +3870,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_lo(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) < 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -3683,6 +3886,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_le(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) <= 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -3697,6 +3902,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_gr(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) > 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -3711,6 +3918,8 @@ PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_cmp_ge(DeeIntObject *self, DeeObject *some_object) {
 	dssize_t compare_value;
 	DREF DeeIntObject *rhs;
+	if (DeeInt_CheckExact(some_object))
+		return_bool(int_compareint(self, (DeeIntObject *)some_object) >= 0);
 	rhs = (DREF DeeIntObject *)DeeObject_Int(some_object);
 	if unlikely(!rhs)
 		goto err;
@@ -4108,6 +4317,30 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+int_pow_f(DeeIntObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *result;
+	DeeObject *y, *mod = NULL;
+	if (DeeArg_Unpack(argc, argv, "o|o:pow", &y, &mod))
+		goto err;
+	if (!mod)
+		return int_pow(self, y);
+	y = DeeObject_Int(y);
+	if unlikely(!y)
+		goto err;
+	mod = DeeObject_Int(mod);
+	if unlikely(!mod)
+		goto err_y;
+	result = int_powmod(self, (DeeIntObject *)y, (DeeIntObject *)mod);
+	Dee_Decref(mod);
+	Dee_Decref(y);
+	return result;
+err_y:
+	Dee_Decref(y);
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
 int_nextafter(DeeIntObject *self, size_t argc, DeeObject *const *argv) {
 	DREF DeeIntObject *y;
@@ -4215,6 +4448,13 @@ PRIVATE struct type_method tpconst int_methods[] = {
 	              "#tIntegerOverflow{@signed is ?f and @this integer is negative}"
 	              "Return the number of bits needed to represent @this integer in base-2"),
 	TYPE_METHOD("divmod", &int_divmod_f, numeric_divmod_doc),
+	TYPE_METHOD("pow", &int_pow_f,
+	            "(y:?.,mod?:?.)->?.\n"
+	            "#tDivideByZero{The given @mod is $0}"
+	            "#tNotImplemented{The given @y is negative}"
+	            "When @mod is given, return ${(this ** y) % mod} (with the same sign "
+	            /**/ "as @mod), without ever having to calculate the full power. "
+	            /**/ "Otherwise, same as ${this ** y}"),
 	TYPE_METHOD("nextafter", &int_nextafter,
 	            "(y:?.)->?.\n"
 	            "Same as ${this > y ? this - 1 : this < y ? this + 1 : this}"),
@@ -16,6 +16,7 @@
 
 #include "int_logic.h"
 
+#include <deemon/alloc.h>
 #include <deemon/api.h>
 #include <deemon/error.h>
 #include <deemon/int.h>
@@ -31,7 +32,13 @@ DECL_BEGIN
 
 #define KARATSUBA_CUTOFF         70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
-#define FIVEARY_CUTOFF           8
+#define TOOM3_CUTOFF             200
+#define NTT_CUTOFF               1000
+#define NTT_MAXSIZE             ((size_t)1 << 23) /* Max transform length supported by `ntt_primes' */
+#define NEWTON_DIV_CUTOFF        1500
+#define NEWTON_GUARD_BITS       (2 * DIGIT_BITS)
+#define NEWTON_BASE_BITS        (NEWTON_DIV_CUTOFF * DIGIT_BITS)
+#define MONTGOMERY_MAXSIZE       NEWTON_DIV_CUTOFF /* Above this, Barrett reduction is faster */
 
 #if DIGIT_BITS <= 31
 #define DeeInt_NewMedian(x) DeeInt_NewInt32(x)
@@ -181,6 +188,12 @@ err:
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_add(DeeIntObject *a, DeeObject *b_ob) {
 	DeeIntObject *z, *b;
+	if (DeeInt_CheckExact(b_ob)) {
+		/* Fast-path: single-digit operands don't need `DeeObject_Int()' */
+		b = (DeeIntObject *)b_ob;
+		if (ABS(a->ob_size) <= 1 && ABS(b->ob_size) <= 1)
+			return DeeInt_NewMedian(MEDIUM_VALUE(a) + MEDIUM_VALUE(b));
+	}
 	b = (DeeIntObject *)DeeObject_Int(b_ob);
 	if unlikely(!b)
 		goto err;
@@ -212,6 +225,12 @@ err:
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_sub(DeeIntObject *a, DeeObject *b_ob) {
 	DeeIntObject *z, *b;
+	if (DeeInt_CheckExact(b_ob)) {
+		/* Fast-path: single-digit operands don't need `DeeObject_Int()' */
+		b = (DeeIntObject *)b_ob;
+		if (ABS(a->ob_size) <= 1 && ABS(b->ob_size) <= 1)
+			return DeeInt_NewMedian(MEDIUM_VALUE(a) - MEDIUM_VALUE(b));
+	}
 	b = (DeeIntObject *)DeeObject_Int(b_ob);
 	if unlikely(!b)
 		goto err;
@@ -306,8 +325,9 @@ x_add_int3(DeeIntObject *__restrict a, uint32_t b) {
 	if (size_a == 2) {
 		uint64_t a_value;
 		a_value = a->ob_digit[0] | (a->ob_digit[1] << DIGIT_BITS);
-		if (a->ob_size < 0)
-			return (DREF DeeIntObject *)DeeInt_NewInt64((-(int64_t)a_value) + (int64_t)b);
+		/* Like the generic path below, this only adds magnitudes (the
+		 * caller negates the result when `a' is negative). Since `b' is
+		 * greater than 2 digits, the result is never a shared small int. */
 		return (DREF DeeIntObject *)DeeInt_NewUInt64(a_value + b);
 	}
 	ASSERT(size_a >= 3);
@@ -389,13 +409,8 @@ x_sub_revint3(uint32_t a, DeeIntObject *__restrict b) {
 		b_value |= b->ob_digit[0];
 		if (a == b_value)
 			return_reference_((DeeIntObject *)DeeInt_Zero);
-		if (a < b_value) {
-			z = (DeeIntObject *)DeeInt_NewUInt64(b_value - a);
-			if (z)
-				z->ob_size = -z->ob_size;
-			return z;
-		}
-		return (DeeIntObject *)DeeInt_NewUInt64(a - b_value);
+		/* Don't negate the result in-place: it may be a shared small int. */
+		return (DeeIntObject *)DeeInt_NewInt64((int64_t)a - (int64_t)b_value);
 	}
 	ASSERT(size_b == 2);
 	z = DeeInt_Alloc(3);
@@ -526,10 +541,10 @@ x_sub_int3(DeeIntObject *__restrict a, uint32_t b) {
 	DeeIntObject *z;
 	ASSERT(size_a >= 2);
 	if (size_a == 2) {
-		z = x_sub_revint3(b, a);
-		if (z)
-			z->ob_size = -z->ob_size;
-		return z;
+		uint64_t a_value;
+		a_value = a->ob_digit[0] | (a->ob_digit[1] << DIGIT_BITS);
+		/* Don't negate `x_sub_revint3()' in-place: it may return a shared small int. */
+		return (DeeIntObject *)DeeInt_NewInt64((int64_t)a_value - (int64_t)b);
 	}
 	if (size_a == 3) {
 		uint64_t a_value;
@@ -631,12 +646,12 @@ x_sub_revint2(twodigits a, DeeIntObject *__restrict b) {
 		return z;
 	}
 	ASSERT(2 == size_b);
-	if ((a & DIGIT_MASK) == b->ob_digit[0]) {
-		if (((a >> DIGIT_BITS) & DIGIT_MASK) == b->ob_digit[1])
+	if (((a >> DIGIT_BITS) & DIGIT_MASK) == b->ob_digit[1]) {
+		if ((a & DIGIT_MASK) == b->ob_digit[0])
 			return_reference_((DeeIntObject *)DeeInt_Zero);
-		if (((a >> DIGIT_BITS) & DIGIT_MASK) < b->ob_digit[1])
+		if ((a & DIGIT_MASK) < b->ob_digit[0])
 			goto do_reverse;
-	} else if ((a & DIGIT_MASK) < b->ob_digit[0]) {
+	} else if (((a >> DIGIT_BITS) & DIGIT_MASK) < b->ob_digit[1]) {
 do_reverse:
 		z = x_sub_int2(b, a);
 		if (z)
@@ -1032,6 +1047,70 @@ err:
 }
 
 
+/* Shift `a' by `shiftby' bits. `x_lshift_bits()' preserves the sign
+ * of `a', while `x_rshift_bits()' operates on (and returns) `|a|'. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
+x_lshift_bits(DeeIntObject *a, size_t shiftby) {
+	DeeIntObject *z;
+	twodigits accum;
+	dssize_t oldsize, newsize, wordshift, remshift, i, j;
+	wordshift = (dssize_t)(shiftby / DIGIT_BITS);
+	remshift  = (dssize_t)(shiftby - (size_t)wordshift * DIGIT_BITS);
+	oldsize   = ABS(a->ob_size);
+	newsize   = oldsize + wordshift;
+	if (remshift)
+		++newsize;
+	z = DeeInt_Alloc(newsize);
+	if unlikely(!z)
+		goto err;
+	if (a->ob_size < 0) {
+		ASSERT(z->ob_refcnt == 1);
+		z->ob_size = -z->ob_size;
+	}
+	for (i = 0; i < wordshift; i++)
+		z->ob_digit[i] = 0;
+	accum = 0;
+	for (i = wordshift, j = 0; j < oldsize; i++, j++) {
+		accum |= (twodigits)a->ob_digit[j] << remshift;
+		z->ob_digit[i] = (digit)(accum & DIGIT_MASK);
+		accum >>= DIGIT_BITS;
+	}
+	if (remshift) {
+		z->ob_digit[newsize - 1] = (digit)accum;
+	} else {
+		ASSERT(!accum);
+	}
+	return int_normalize(z);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
+x_rshift_bits(DeeIntObject *a, size_t shiftby) {
+	DeeIntObject *z;
+	digit lomask, himask;
+	dssize_t newsize, wordshift, loshift, hishift, i, j;
+	wordshift = (dssize_t)(shiftby / DIGIT_BITS);
+	newsize   = ABS(a->ob_size) - wordshift;
+	if (newsize <= 0)
+		return_reference_((DeeIntObject *)DeeInt_Zero);
+	loshift = (dssize_t)(shiftby % DIGIT_BITS);
+	hishift = DIGIT_BITS - loshift;
+	lomask  = ((digit)1 << hishift) - 1;
+	himask  = DIGIT_MASK ^ lomask;
+	z       = DeeInt_Alloc(newsize);
+	if unlikely(!z)
+		goto err;
+	for (i = 0, j = wordshift; i < newsize; i++, j++) {
+		z->ob_digit[i] = (a->ob_digit[j] >> loshift) & lomask;
+		if (i + 1 < newsize)
+			z->ob_digit[i] |= (a->ob_digit[j + 1] << hishift) & himask;
+	}
+	return int_normalize(z);
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
 x_mul(DeeIntObject *a, DeeIntObject *b) {
 	DeeIntObject *z;
@@ -1121,6 +1200,467 @@ err:
 	return -1;
 }
 
+/* Return a new, positive integer for `count' digits of `|n|', starting at `start' */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
+x_slice(DeeIntObject *n, dssize_t start, dssize_t count) {
+	DREF DeeIntObject *result;
+	dssize_t size_n = ABS(n->ob_size);
+	if (count > size_n - start)
+		count = size_n - start;
+	if (count <= 0)
+		return_reference_((DeeIntObject *)DeeInt_Zero);
+	result = DeeInt_Alloc(count);
+	if unlikely(!result)
+		goto err;
+	memcpyc(result->ob_digit, n->ob_digit + start, count, sizeof(digit));
+	return int_normalize(result);
+err:
+	return NULL;
+}
+
+/* Divide `x' by `n', where the caller knows that the division is exact */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
+x_divexact1(DeeIntObject *x, digit n) {
+	DREF DeeIntObject *z;
+	digit rem;
+	z = divrem1(x, n, &rem);
+	if unlikely(!z)
+		goto err;
+	ASSERT(rem == 0);
+	if (x->ob_size < 0)
+		z->ob_size = -z->ob_size;
+	return z;
+err:
+	return NULL;
+}
+
+/* Evaluate the 3-way split `x2*B^2k + x1*B^k + x0' at -2, -1 and 1.
+ * Intermediate values are signed, so use the sign-aware operators. */
+PRIVATE WUNUSED NONNULL((1, 2, 3, 4, 5, 6)) int DCALL
+t3_eval(DeeIntObject *x0, DeeIntObject *x1, DeeIntObject *x2,
+        DREF DeeIntObject **__restrict p_xm2,
+        DREF DeeIntObject **__restrict p_xm1,
+        DREF DeeIntObject **__restrict p_x1) {
+	DREF DeeIntObject *p, *xm1, *temp, *temp2;
+	p = (DREF DeeIntObject *)int_add(x0, (DeeObject *)x2);
+	if unlikely(!p)
+		goto err;
+	*p_x1 = (DREF DeeIntObject *)int_add(p, (DeeObject *)x1);
+	if unlikely(!*p_x1)
+		goto err_p;
+	xm1 = (DREF DeeIntObject *)int_sub(p, (DeeObject *)x1);
+	Dee_Decref(p);
+	if unlikely(!xm1)
+		goto err_x1;
+	temp = (DREF DeeIntObject *)int_add(xm1, (DeeObject *)x2);
+	if unlikely(!temp)
+		goto err_x1_xm1;
+	temp2 = (DREF DeeIntObject *)int_add(temp, (DeeObject *)temp);
+	Dee_Decref(temp);
+	if unlikely(!temp2)
+		goto err_x1_xm1;
+	*p_xm2 = (DREF DeeIntObject *)int_sub(temp2, (DeeObject *)x0);
+	Dee_Decref(temp2);
+	if unlikely(!*p_xm2)
+		goto err_x1_xm1;
+	*p_xm1 = xm1;
+	return 0;
+err_x1_xm1:
+	Dee_Decref(xm1);
+err_x1:
+	Dee_Decref(*p_x1);
+	goto err;
+err_p:
+	Dee_Decref(p);
+err:
+	return -1;
+}
+
+/* Toom-Cook 3-way multiplication (using Bodrato's interpolation sequence).
+ * Like `k_mul()', the signs of `a' and `b' are ignored. */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
+t3_mul(DeeIntObject *a, DeeIntObject *b) {
+	dssize_t asize = ABS(a->ob_size);
+	dssize_t bsize = ABS(b->ob_size);
+	dssize_t i, k;
+	DREF DeeIntObject *ret = NULL, *temp;
+	DREF DeeIntObject *a0 = NULL, *a1 = NULL, *a2 = NULL;
+	DREF DeeIntObject *b0 = NULL, *b1 = NULL, *b2 = NULL;
+	DREF DeeIntObject *am2 = NULL, *am1 = NULL, *ap1 = NULL;
+	DREF DeeIntObject *bm2 = NULL, *bm1 = NULL, *bp1 = NULL;
+	DREF DeeIntObject *r[5] = { NULL, NULL, NULL, NULL, NULL };
+	DREF DeeIntObject *rm1 = NULL, *rm2 = NULL;
+	ASSERT(asize <= bsize);
+	ASSERT(2 * asize > bsize);
+	k = (bsize + 2) / 3;
+	if unlikely((a0 = x_slice(a, 0, k)) == NULL)
+		goto err;
+	if unlikely((a1 = x_slice(a, k, k)) == NULL)
+		goto err;
+	if unlikely((a2 = x_slice(a, 2 * k, asize)) == NULL)
+		goto err;
+	if unlikely(t3_eval(a0, a1, a2, &am2, &am1, &ap1))
+		goto err;
+	Dee_Clear(a1);
+	if (a == b) {
+		b0 = a0, Dee_Incref(b0);
+		b2 = a2, Dee_Incref(b2);
+		bm2 = am2, Dee_Incref(bm2);
+		bm1 = am1, Dee_Incref(bm1);
+		bp1 = ap1, Dee_Incref(bp1);
+	} else {
+		if unlikely((b0 = x_slice(b, 0, k)) == NULL)
+			goto err;
+		if unlikely((b1 = x_slice(b, k, k)) == NULL)
+			goto err;
+		if unlikely((b2 = x_slice(b, 2 * k, bsize)) == NULL)
+			goto err;
+		if unlikely(t3_eval(b0, b1, b2, &bm2, &bm1, &bp1))
+			goto err;
+		Dee_Clear(b1);
+	}
+
+	/* Point-wise multiplication */
+	if unlikely((r[0] = (DREF DeeIntObject *)int_mul(a0, (DeeObject *)b0)) == NULL)
+		goto err;
+	if unlikely((r[1] = (DREF DeeIntObject *)int_mul(ap1, (DeeObject *)bp1)) == NULL)
+		goto err;
+	if unlikely((rm1 = (DREF DeeIntObject *)int_mul(am1, (DeeObject *)bm1)) == NULL)
+		goto err;
+	if unlikely((rm2 = (DREF DeeIntObject *)int_mul(am2, (DeeObject *)bm2)) == NULL)
+		goto err;
+	if unlikely((r[4] = (DREF DeeIntObject *)int_mul(a2, (DeeObject *)b2)) == NULL)
+		goto err;
+	Dee_Clear(a0);
+	Dee_Clear(a2);
+	Dee_Clear(am2);
+	Dee_Clear(am1);
+	Dee_Clear(ap1);
+	Dee_Clear(b0);
+	Dee_Clear(b2);
+	Dee_Clear(bm2);
+	Dee_Clear(bm1);
+	Dee_Clear(bp1);
+	SIGCHECK(goto err);
+
+	/* Interpolation */
+	/* r3 = (r(-2) - r(1)) / 3 */
+	temp = (DREF DeeIntObject *)int_sub(rm2, (DeeObject *)r[1]);
+	Dee_Clear(rm2);
+	if unlikely(!temp)
+		goto err;
+	r[3] = x_divexact1(temp, 3);
+	Dee_Decref(temp);
+	if unlikely(!r[3])
+		goto err;
+	/* r1 = (r(1) - r(-1)) / 2 */
+	temp = (DREF DeeIntObject *)int_sub(r[1], (DeeObject *)rm1);
+	Dee_Clear(r[1]);
+	if unlikely(!temp)
+		goto err;
+	r[1] = x_divexact1(temp, 2);
+	Dee_Decref(temp);
+	if unlikely(!r[1])
+		goto err;
+	/* r2 = r(-1) - r(0) */
+	r[2] = (DREF DeeIntObject *)int_sub(rm1, (DeeObject *)r[0]);
+	Dee_Clear(rm1);
+	if unlikely(!r[2])
+		goto err;
+	/* r3 = (r2 - r3) / 2 + 2 * r(inf) */
+	temp = (DREF DeeIntObject *)int_sub(r[2], (DeeObject *)r[3]);
+	Dee_Clear(r[3]);
+	if unlikely(!temp)
+		goto err;
+	r[3] = x_divexact1(temp, 2);
+	Dee_Decref(temp);
+	if unlikely(!r[3])
+		goto err;
+	for (i = 0; i < 2; ++i) {
+		temp = (DREF DeeIntObject *)int_add(r[3], (DeeObject *)r[4]);
+		if unlikely(!temp)
+			goto err;
+		Dee_Decref(r[3]);
+		r[3] = temp;
+	}
+	/* r2 = r2 + r1 - r(inf) */
+	temp = (DREF DeeIntObject *)int_add(r[2], (DeeObject *)r[1]);
+	if unlikely(!temp)
+		goto err;
+	Dee_Decref(r[2]);
+	r[2] = temp;
+	temp = (DREF DeeIntObject *)int_sub(r[2], (DeeObject *)r[4]);
+	if unlikely(!temp)
+		goto err;
+	Dee_Decref(r[2]);
+	r[2] = temp;
+	/* r1 = r1 - r3 */
+	temp = (DREF DeeIntObject *)int_sub(r[1], (DeeObject *)r[3]);
+	if unlikely(!temp)
+		goto err;
+	Dee_Decref(r[1]);
+	r[1] = temp;
+
+	/* Recomposition (all coefficients of the product are positive) */
+	ret = DeeInt_Alloc(asize + bsize);
+	if unlikely(!ret)
+		goto err;
+	bzeroc(ret->ob_digit, ret->ob_size, sizeof(digit));
+	for (i = 0; i < 5; ++i) {
+		ASSERT(r[i]->ob_size >= 0);
+		if (r[i]->ob_size == 0)
+			continue;
+		ASSERT(i * k + r[i]->ob_size <= ret->ob_size);
+		(void)v_iadd(ret->ob_digit + i * k, ret->ob_size - i * k,
+		             r[i]->ob_digit, r[i]->ob_size);
+		Dee_Clear(r[i]);
+	}
+	for (i = 0; i < 5; ++i)
+		Dee_XDecref(r[i]);
+	return int_normalize(ret);
+err:
+	for (i = 0; i < 5; ++i)
+		Dee_XDecref(r[i]);
+	Dee_XDecref(rm1);
+	Dee_XDecref(rm2);
+	Dee_XDecref(a0);
+	Dee_XDecref(a1);
+	Dee_XDecref(a2);
+	Dee_XDecref(am2);
+	Dee_XDecref(am1);
+	Dee_XDecref(ap1);
+	Dee_XDecref(b0);
+	Dee_XDecref(b1);
+	Dee_XDecref(b2);
+	Dee_XDecref(bm2);
+	Dee_XDecref(bm1);
+	Dee_XDecref(bp1);
+	return NULL;
+}
+
+
+/* Number-theoretic transform multiplication.
+ * The product is convolved modulo 3 NTT-friendly primes (all < 2^30, so
+ * 32-bit Montgomery arithmetic can be used), and re-assembled with the
+ * chinese remainder theorem. The 3 primes multiply to ~2^86, which leaves
+ * enough head-room for up to `NTT_MAXSIZE' convolution terms of 2 digits. */
+struct ntt_prime {
+	uint32_t np_mod;  /* Prime modulus (< 2^30) */
+	uint32_t np_ninv; /* -np_mod^-1 mod 2^32 */
+	uint32_t np_r2;   /* 2^64 mod np_mod (for conversion into Montgomery form) */
+	uint32_t np_one;  /* 2^32 mod np_mod (1 in Montgomery form) */
+};
+
+PRIVATE uint32_t const ntt_primes[3] = {
+	998244353, /* 119 * 2^23 + 1 */
+	167772161, /* 5 * 2^25 + 1 */
+	469762049  /* 7 * 2^26 + 1 */
+};
+#define NTT_PRIMITIVE_ROOT 3 /* Primitive root for all of `ntt_primes' */
+
+PRIVATE NONNULL((1)) void DCALL
+ntt_prime_init(struct ntt_prime *__restrict self, uint32_t mod) {
+	uint32_t inv = mod;
+	unsigned int i;
+	for (i = 0; i < 4; ++i)
+		inv *= 2 - mod * inv;
+	self->np_mod  = mod;
+	self->np_ninv = (uint32_t)0 - inv;
+	self->np_one  = (uint32_t)(((uint64_t)1 << 32) % mod);
+	self->np_r2   = (uint32_t)(((uint64_t)self->np_one * self->np_one) % mod);
+}
+
+LOCAL ATTR_PURE WUNUSED NONNULL((1)) uint32_t DCALL
+ntt_redc(struct ntt_prime const *__restrict p, uint64_t t) {
+	uint32_t m = (uint32_t)t * p->np_ninv;
+	uint32_t r = (uint32_t)((t + (uint64_t)m * p->np_mod) >> 32);
+	return r >= p->np_mod ? r - p->np_mod : r;
+}
+
+#define ntt_mulmod(p, a, b) ntt_redc(p, (uint64_t)(a) * (b))
+#define ntt_tomont(p, x)    ntt_redc(p, (uint64_t)(x) * (p)->np_r2)
+
+LOCAL ATTR_PURE WUNUSED NONNULL((1)) uint32_t DCALL
+ntt_powmod(struct ntt_prime const *__restrict p,
+           uint32_t base, uint32_t exp) {
+	uint32_t result = p->np_one;
+	while (exp) {
+		if (exp & 1)
+			result = ntt_mulmod(p, result, base);
+		base = ntt_mulmod(p, base, base);
+		exp >>= 1;
+	}
+	return result;
+}
+
+/* Fill `roots[0..n/2)' with powers of the `n'th (inverse) root of unity */
+PRIVATE NONNULL((1, 2)) void DCALL
+ntt_roots(struct ntt_prime const *__restrict p,
+          uint32_t *__restrict roots,
+          size_t n, bool inverse) {
+	size_t i;
+	uint32_t w;
+	w = ntt_tomont(p, NTT_PRIMITIVE_ROOT);
+	w = ntt_powmod(p, w, (uint32_t)((p->np_mod - 1) / n));
+	if (inverse)
+		w = ntt_powmod(p, w, (uint32_t)(n - 1));
+	roots[0] = p->np_one;
+	for (i = 1; i < n / 2; ++i)
+		roots[i] = ntt_mulmod(p, roots[i - 1], w);
+}
+
+/* In-place, iterative radix-2 transform of `a[0..n)' (in Montgomery form) */
+PRIVATE NONNULL((1, 2, 3)) void DCALL
+ntt_transform(struct ntt_prime const *__restrict p,
+              uint32_t *__restrict a,
+              uint32_t const *__restrict roots,
+              size_t n) {
+	size_t i, j, len;
+	uint32_t mod = p->np_mod;
+	for (i = 1, j = 0; i < n; ++i) {
+		size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j) {
+			uint32_t temp = a[i];
+			a[i] = a[j];
+			a[j] = temp;
+		}
+	}
+	for (len = 2; len <= n; len <<= 1) {
+		size_t half = len >> 1;
+		size_t step = n / len;
+		for (i = 0; i < n; i += len) {
+			uint32_t *lo = a + i;
+			uint32_t *hi = lo + half;
+			for (j = 0; j < half; ++j) {
+				uint32_t u = lo[j];
+				uint32_t v = ntt_mulmod(p, hi[j], roots[j * step]);
+				uint32_t s = u + v;
+				lo[j] = s >= mod ? s - mod : s;
+				hi[j] = u >= v ? u - v : u + mod - v;
+			}
+		}
+	}
+}
+
+/* Load the digits of `|x|' into `a[0..n)' (in Montgomery form) */
+PRIVATE NONNULL((1, 2, 3)) void DCALL
+ntt_load(struct ntt_prime const *__restrict p,
+         uint32_t *__restrict a,
+         DeeIntObject const *__restrict x,
+         size_t n) {
+	size_t i, size_x = (size_t)ABS(x->ob_size);
+	for (i = 0; i < size_x; ++i)
+		a[i] = ntt_tomont(p, x->ob_digit[i]);
+	bzeroc(a + size_x, n - size_x, sizeof(uint32_t));
+}
+
+PRIVATE ATTR_CONST WUNUSED uint32_t DCALL
+ntt_inverse(uint64_t x, uint32_t mod) {
+	uint64_t result = 1, exp = mod - 2;
+	x %= mod;
+	while (exp) {
+		if (exp & 1)
+			result = (result * x) % mod;
+		x = (x * x) % mod;
+		exp >>= 1;
+	}
+	return (uint32_t)result;
+}
+
+/* Like `k_mul()', the signs of `a' and `b' are ignored. */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
+ntt_mul(DeeIntObject *a, DeeIntObject *b) {
+	DREF DeeIntObject *ret;
+	dssize_t asize = ABS(a->ob_size);
+	dssize_t bsize = ABS(b->ob_size);
+	size_t i, n, count = (size_t)(asize + bsize - 1);
+	uint32_t *buf, *res[3], *fb, *roots;
+	uint32_t p0, p1, p2, inv_p0, inv_p0p1;
+	uint64_t p0p1, lo, hi;
+	unsigned int pi;
+	ASSERT(count <= NTT_MAXSIZE);
+	for (n = 2; n < count; n <<= 1)
+		;
+	buf = (uint32_t *)Dee_Mallocc(4 * n + n / 2, sizeof(uint32_t));
+	if unlikely(!buf)
+		goto err;
+	res[0] = buf;
+	res[1] = buf + n;
+	res[2] = buf + 2 * n;
+	fb     = buf + 3 * n;
+	roots  = buf + 4 * n;
+	for (pi = 0; pi < 3; ++pi) {
+		struct ntt_prime p;
+		uint32_t *fa = res[pi];
+		uint32_t scale;
+		ntt_prime_init(&p, ntt_primes[pi]);
+		ntt_roots(&p, roots, n, false);
+		ntt_load(&p, fa, a, n);
+		ntt_transform(&p, fa, roots, n);
+		if (a == b) {
+			for (i = 0; i < n; ++i)
+				fa[i] = ntt_mulmod(&p, fa[i], fa[i]);
+		} else {
+			ntt_load(&p, fb, b, n);
+			ntt_transform(&p, fb, roots, n);
+			for (i = 0; i < n; ++i)
+				fa[i] = ntt_mulmod(&p, fa[i], fb[i]);
+		}
+		SIGCHECK(goto err_buf);
+		ntt_roots(&p, roots, n, true);
+		ntt_transform(&p, fa, roots, n);
+		/* Divide by `n' and leave Montgomery form. */
+		scale = ntt_tomont(&p, ntt_inverse(n, p.np_mod));
+		for (i = 0; i < count; ++i)
+			fa[i] = ntt_redc(&p, ntt_mulmod(&p, fa[i], scale));
+	}
+
+	/* Combine using Garner's algorithm, and propagate carries
+	 * through a 128-bit accumulator (`hi:lo'). */
+	ret = DeeInt_Alloc(asize + bsize);
+	if unlikely(!ret)
+		goto err_buf;
+	p0       = ntt_primes[0];
+	p1       = ntt_primes[1];
+	p2       = ntt_primes[2];
+	p0p1     = (uint64_t)p0 * p1;
+	inv_p0   = ntt_inverse(p0, p1);
+	inv_p0p1 = ntt_inverse(p0p1, p2);
+	lo = hi = 0;
+	for (i = 0; i < (size_t)ret->ob_size; ++i) {
+		if (i < count) {
+			uint64_t x0, x1, x2, low, m_lo, m_hi;
+			x0  = res[0][i];
+			x1  = ((res[1][i] + p1 - x0 % p1) * inv_p0) % p1;
+			low = x0 + x1 * p0;
+			x2  = ((res[2][i] + p2 - low % p2) * inv_p0p1) % p2;
+			/* hi:lo += low + x2 * p0p1 */
+			m_lo = x2 * (p0p1 & UINT32_C(0xffffffff));
+			m_hi = x2 * (p0p1 >> 32);
+			lo += low;
+			hi += lo < low;
+			lo += m_lo;
+			hi += lo < m_lo;
+			lo += m_hi << 32;
+			hi += lo < (m_hi << 32);
+			hi += m_hi >> 32;
+		}
+		ret->ob_digit[i] = (digit)(lo & DIGIT_MASK);
+		lo = (lo >> DIGIT_BITS) | (hi << (64 - DIGIT_BITS));
+		hi >>= DIGIT_BITS;
+	}
+	ASSERT(lo == 0 && hi == 0);
+	Dee_Free(buf);
+	return int_normalize(ret);
+err_buf:
+	Dee_Free(buf);
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
 k_lopsided_mul(DeeIntObject *a, DeeIntObject *b);
 
@@ -1144,6 +1684,10 @@ k_mul(DeeIntObject *a, DeeIntObject *b) {
 	}
 	if (2 * asize <= bsize)
 		return k_lopsided_mul(a, b);
+	if (asize >= NTT_CUTOFF && (size_t)(asize + bsize) <= NTT_MAXSIZE)
+		return ntt_mul(a, b);
+	if (asize >= TOOM3_CUTOFF)
+		return t3_mul(a, b);
 	shift = bsize >> 1;
 	if (kmul_split(a, shift, &ah, &al) < 0)
 		goto fail;
@@ -1279,6 +1823,12 @@ err:
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_mul(DeeIntObject *a, DeeObject *b_ob) {
 	DREF DeeIntObject *z, *b;
+	if (DeeInt_CheckExact(b_ob)) {
+		/* Fast-path: single-digit operands don't need `DeeObject_Int()' */
+		b = (DeeIntObject *)b_ob;
+		if (ABS(a->ob_size) <= 1 && ABS(b->ob_size) <= 1)
+			return DeeInt_NewSTwoDigits((stwodigits)(MEDIUM_VALUE(a)) * MEDIUM_VALUE(b));
+	}
 	b = (DeeIntObject *)DeeObject_Int(b_ob);
 	if unlikely(!b)
 		goto err;
@@ -1303,6 +1853,9 @@ err:
 PRIVATE WUNUSED NONNULL((1, 2, 3)) DeeIntObject *DCALL
 x_divrem(DeeIntObject *v1, DeeIntObject *w1,
          DeeIntObject **__restrict p_rem);
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DeeIntObject *DCALL
+n_divrem(DeeIntObject *v1, DeeIntObject *w1,
+         DeeIntObject **__restrict p_rem);
 
 PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
 int_divrem(DeeIntObject *a,
@@ -1333,6 +1886,11 @@ int_divrem(DeeIntObject *a,
 		*p_rem = (DeeIntObject *)DeeInt_NewDigit(rem);
 		if unlikely(!*p_rem)
 			goto err_z;
+	} else if (size_b >= NEWTON_DIV_CUTOFF &&
+	           size_a - size_b >= NEWTON_DIV_CUTOFF) {
+		z = n_divrem(a, b, p_rem);
+		if unlikely(!z)
+			goto err;
 	} else {
 		z = x_divrem(a, b, p_rem);
 		if unlikely(!z)
@@ -1464,6 +2022,213 @@ err:
 }
 
 
+/* Return the number of bits needed to represent `|a|' */
+PRIVATE ATTR_PURE WUNUSED NONNULL((1)) size_t DCALL
+x_bitlength(DeeIntObject const *__restrict a) {
+	dssize_t size = ABS(a->ob_size);
+	if (size == 0)
+		return 0;
+	return (size_t)(size - 1) * DIGIT_BITS +
+	       (size_t)bits_in_digit(a->ob_digit[size - 1]);
+}
+
+/* Return `2^n' */
+#define x_pow2(n) x_lshift_bits((DeeIntObject *)DeeInt_One, n)
+
+/* Return an approximation of `2^(m + prec) / |d|', where `m' is the
+ * bit-length of `d', using Newton's iteration `x += x * (1 - d * x)'.
+ * The result has a relative error of less than `2^(GUARD - prec)'. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeIntObject *DCALL
+n_reciprocal(DeeIntObject *d, size_t prec) {
+	DREF DeeIntObject *dt, *y, *e, *temp, *result;
+	size_t h, m, mt, shift;
+	m     = x_bitlength(d);
+	shift = m > prec + NEWTON_GUARD_BITS ? m - (prec + NEWTON_GUARD_BITS) : 0;
+	mt    = m - shift;
+	dt    = x_rshift_bits(d, shift);
+	if unlikely(!dt)
+		goto err;
+	if (prec <= NEWTON_BASE_BITS) {
+		/* Use regular long division for the initial approximation. */
+		DREF DeeIntObject *rem;
+		temp = x_pow2(mt + prec);
+		if unlikely(!temp)
+			goto err_dt;
+		result = x_divrem(temp, dt, &rem);
+		Dee_Decref(temp);
+		Dee_Decref(dt);
+		if unlikely(!result)
+			goto err;
+		Dee_Decref(rem);
+		return result;
+	}
+	h = prec / 2 + NEWTON_GUARD_BITS;
+	ASSERT(h < prec);
+	y = n_reciprocal(dt, h);
+	if unlikely(!y)
+		goto err_dt;
+
+	/* e = 2^(mt + h) - dt * y */
+	temp = k_mul(dt, y);
+	Dee_Decref(dt);
+	if unlikely(!temp)
+		goto err_y;
+	e = x_pow2(mt + h);
+	if unlikely(!e)
+		goto err_y_temp;
+	result = x_sub(e, temp);
+	Dee_Decref(e);
+	Dee_Decref(temp);
+	if unlikely(!result)
+		goto err_y;
+	e = result;
+
+	/* result = (y << (prec - h)) + ((y * e) >> (mt + 2 * h - prec)) */
+	temp = k_mul(y, e);
+	if unlikely(!temp)
+		goto err_y_e;
+	result = x_rshift_bits(temp, mt + 2 * h - prec);
+	Dee_Decref(temp);
+	if unlikely(!result)
+		goto err_y_e;
+	temp = x_lshift_bits(y, prec - h);
+	Dee_Decref(y);
+	if unlikely(!temp)
+		goto err_e_result;
+	y = e->ob_size < 0 ? x_sub(temp, result)
+	                   : x_add(temp, result);
+	Dee_Decref(temp);
+	Dee_Decref(result);
+	Dee_Decref(e);
+	return y;
+err_e_result:
+	Dee_Decref(result);
+	Dee_Decref(e);
+	goto err;
+err_y_e:
+	Dee_Decref(e);
+	goto err_y;
+err_y_temp:
+	Dee_Decref(temp);
+err_y:
+	Dee_Decref(y);
+	goto err;
+err_dt:
+	Dee_Decref(dt);
+err:
+	return NULL;
+}
+
+/* Pre-computed reciprocal of a divisor, so that divisions by the
+ * same value (e.g.: the modulus in `int_powmod()') can be done with
+ * 2 multiplications each (aka. Barrett reduction). */
+struct newton_inv {
+	DREF DeeIntObject *ni_inv;   /* [1..1] ~= 2^(ni_dbits + ni_prec) / (w >> ni_shift) */
+	size_t             ni_shift; /* # of least significant divisor bits ignored by `ni_inv' */
+	size_t             ni_dbits; /* # of bits in `w >> ni_shift' */
+	size_t             ni_prec;  /* Precision (in bits) of `ni_inv' */
+};
+
+#define newton_inv_fini(self) Dee_Decref((self)->ni_inv)
+
+/* Initialize `self' for dividing numbers by `|w|', such that
+ * the quotients are expected to have up to `qbits' bits. */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+newton_inv_init(struct newton_inv *__restrict self,
+                DeeIntObject *w, size_t qbits) {
+	size_t wbits = x_bitlength(w);
+	self->ni_prec  = qbits + NEWTON_GUARD_BITS;
+	self->ni_shift = wbits > self->ni_prec ? wbits - self->ni_prec : 0;
+	self->ni_dbits = wbits - self->ni_shift;
+	self->ni_inv   = n_reciprocal(w, self->ni_prec);
+	if unlikely(!self->ni_inv)
+		goto err;
+	return 0;
+err:
+	return -1;
+}
+
+/* Divide `|v|' by `|w|', using the reciprocal `self' of `w' */
+PRIVATE WUNUSED NONNULL((1, 2, 3, 4)) DREF DeeIntObject *DCALL
+newton_inv_divrem(struct newton_inv const *__restrict self,
+                  DeeIntObject *v, DeeIntObject *w,
+                  DREF DeeIntObject **__restrict p_rem) {
+	DREF DeeIntObject *q, *r, *temp;
+	temp = x_rshift_bits(v, self->ni_shift);
+	if unlikely(!temp)
+		goto err;
+	q = k_mul(temp, self->ni_inv);
+	Dee_Decref(temp);
+	if unlikely(!q)
+		goto err;
+	temp = x_rshift_bits(q, self->ni_dbits + self->ni_prec);
+	Dee_Decref(q);
+	if unlikely(!temp)
+		goto err;
+	q = temp;
+
+	/* r = |v| - q * |w| */
+	temp = k_mul(q, w);
+	if unlikely(!temp)
+		goto err_q;
+	r = x_sub(v, temp);
+	Dee_Decref(temp);
+	if unlikely(!r)
+		goto err_q;
+
+	/* Correct the approximation (which is off by no more than a couple) */
+	for (;;) {
+		if (r->ob_size < 0) {
+			temp = x_sub(w, r); /* r + |w| */
+			if unlikely(!temp)
+				goto err_q_r;
+			if unlikely(int_dec(&q))
+				goto err_q_r_temp;
+		} else {
+			temp = x_sub(r, w); /* r - |w| */
+			if unlikely(!temp)
+				goto err_q_r;
+			if (temp->ob_size < 0) {
+				Dee_Decref(temp);
+				break;
+			}
+			if unlikely(int_inc(&q))
+				goto err_q_r_temp;
+		}
+		Dee_Decref(r);
+		r = temp;
+	}
+	*p_rem = r;
+	return q;
+err_q_r_temp:
+	Dee_Decref(temp);
+err_q_r:
+	Dee_Decref(r);
+err_q:
+	Dee_Decref(q);
+err:
+	return NULL;
+}
+
+/* Same as `x_divrem()', but use Newton's iteration to
+ * divide by the reciprocal of `w1', rather than long division. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DeeIntObject *DCALL
+n_divrem(DeeIntObject *v1, DeeIntObject *w1,
+         DeeIntObject **__restrict p_rem) {
+	struct newton_inv inv;
+	DREF DeeIntObject *result;
+	if (newton_inv_init(&inv, w1, x_bitlength(v1) - x_bitlength(w1) + 1))
+		goto err;
+	result = newton_inv_divrem(&inv, v1, w1, p_rem);
+	newton_inv_fini(&inv);
+	if unlikely(!result)
+		goto err;
+	return result;
+err:
+	*p_rem = NULL;
+	return NULL;
+}
+
 INTERN WUNUSED NONNULL((1, 2)) int DCALL
 int_divmod(DeeIntObject *v,
            DeeIntObject *w,
@@ -1561,8 +2326,7 @@ int_neg(DeeIntObject *v) {
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_shr(DeeIntObject *a, DeeObject *b) {
 	DeeIntObject *z = NULL;
-	digit lomask, himask;
-	dssize_t shiftby, newsize, wordshift, loshift, hishift, i, j;
+	dssize_t shiftby;
 	if (a->ob_size < 0) {
 		DeeIntObject *a1, *a2;
 		a1 = (DeeIntObject *)int_inv(a);
@@ -1581,25 +2345,7 @@ int_shr(DeeIntObject *a, DeeObject *b) {
 			err_shift_negative((DeeObject *)a, b, false);
 			goto rshift_error;
 		}
-		wordshift = shiftby / DIGIT_BITS;
-		newsize   = ABS(a->ob_size) - wordshift;
-		if (newsize <= 0)
-			return_reference_(DeeInt_Zero);
-		loshift = shiftby % DIGIT_BITS;
-		hishift = DIGIT_BITS - loshift;
-		lomask  = ((digit)1 << hishift) - 1;
-		himask  = DIGIT_MASK ^ lomask;
-		z       = DeeInt_Alloc(newsize);
-		if unlikely(!z)
-			goto rshift_error;
-		if (a->ob_size < 0)
-			z->ob_size = -(z->ob_size);
-		for (i = 0, j = wordshift; i < newsize; i++, j++) {
-			z->ob_digit[i] = (a->ob_digit[j] >> loshift) & lomask;
-			if (i + 1 < newsize)
-				z->ob_digit[i] |= (a->ob_digit[j + 1] << hishift) & himask;
-		}
-		z = int_normalize(z);
+		z = x_rshift_bits(a, (size_t)shiftby);
 	}
 rshift_error:
 	return (DeeObject *)maybe_small_int(z);
@@ -1607,42 +2353,15 @@ rshift_error:
 
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_shl(DeeIntObject *a, DeeObject *b) {
-	DeeIntObject *z = NULL;
-	twodigits accum;
-	dssize_t shiftby, oldsize, newsize, wordshift, remshift, i, j;
+	DeeIntObject *z;
+	dssize_t shiftby;
 	if (DeeObject_AsSSize(b, &shiftby))
 		goto err;
 	if (shiftby < 0) {
 		err_shift_negative((DeeObject *)a, b, true);
 		goto err;
 	}
-	wordshift = shiftby / DIGIT_BITS;
-	remshift  = shiftby - wordshift * DIGIT_BITS;
-	oldsize   = ABS(a->ob_size);
-	newsize   = oldsize + wordshift;
-	if (remshift)
-		++newsize;
-	z = DeeInt_Alloc(newsize);
-	if unlikely(!z)
-		goto err;
-	if (a->ob_size < 0) {
-		ASSERT(z->ob_refcnt == 1);
-		z->ob_size = -z->ob_size;
-	}
-	for (i = 0; i < wordshift; i++)
-		z->ob_digit[i] = 0;
-	accum = 0;
-	for (i = wordshift, j = 0; j < oldsize; i++, j++) {
-		accum |= (twodigits)a->ob_digit[j] << remshift;
-		z->ob_digit[i] = (digit)(accum & DIGIT_MASK);
-		accum >>= DIGIT_BITS;
-	}
-	if (remshift) {
-		z->ob_digit[newsize - 1] = (digit)accum;
-	} else {
-		ASSERT(!accum);
-	}
-	z = int_normalize(z);
+	z = x_lshift_bits(a, (size_t)shiftby);
 	return (DeeObject *)maybe_small_int(z);
 err:
 	return NULL;
@@ -1804,23 +2523,206 @@ err:
 }
 
 
+/* Reduction context for exponentiation. */
+struct pow_ctx {
+#define POW_CTX_PLAIN      0 /* No reduction */
+#define POW_CTX_MOD        1 /* Reduce modulo `pc_mod' (using long division) */
+#define POW_CTX_BARRETT    2 /* Reduce modulo `pc_mod' (using `pc_inv') */
+#define POW_CTX_MONTGOMERY 3 /* Montgomery multiplication modulo `pc_mod' (which is odd) */
+	unsigned int       pc_kind; /* Context kind (one of `POW_CTX_*') */
+	DeeIntObject      *pc_mod;  /* [1..1][valid_if(pc_kind != POW_CTX_PLAIN)] Positive modulus */
+	struct newton_inv  pc_inv;  /* [valid_if(pc_kind == POW_CTX_BARRETT)] Reciprocal of `pc_mod' */
+	digit             *pc_buf;  /* [0..2*|pc_mod|+1][owned][valid_if(pc_kind == POW_CTX_MONTGOMERY)] Work buffer */
+	digit              pc_minv; /* [valid_if(pc_kind == POW_CTX_MONTGOMERY)] -pc_mod^-1 mod DIGIT_BASE */
+};
+
+/* Montgomery reduction: return `|t| * DIGIT_BASE^-n mod pc_mod', where `|t| < pc_mod^2' */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
+pow_ctx_redc(struct pow_ctx *__restrict self, DeeIntObject *t) {
+	DREF DeeIntObject *result;
+	dssize_t i, j, n = self->pc_mod->ob_size;
+	dssize_t tsize = ABS(t->ob_size);
+	digit const *m = self->pc_mod->ob_digit;
+	digit *buf = self->pc_buf;
+	ASSERT(tsize <= 2 * n);
+	memcpyc(buf, t->ob_digit, tsize, sizeof(digit));
+	bzeroc(buf + tsize, 2 * n + 1 - tsize, sizeof(digit));
+	for (i = 0; i < n; ++i) {
+		twodigits carry = 0;
+		digit u = (digit)(((twodigits)buf[i] * self->pc_minv) & DIGIT_MASK);
+		for (j = 0; j < n; ++j) {
+			carry += buf[i + j] + (twodigits)u * m[j];
+			buf[i + j] = (digit)(carry & DIGIT_MASK);
+			carry >>= DIGIT_BITS;
+		}
+		for (j = i + n; carry; ++j) {
+			carry += buf[j];
+			buf[j] = (digit)(carry & DIGIT_MASK);
+			carry >>= DIGIT_BITS;
+		}
+	}
+	/* The result is `< 2 * pc_mod', so at most 1 subtraction is needed. */
+	if (buf[2 * n] != 0) {
+		(void)v_isub(buf + n, n + 1, m, n);
+	} else {
+		for (i = n - 1; i >= 0 && buf[n + i] == m[i]; --i)
+			;
+		if (i < 0 || buf[n + i] > m[i])
+			(void)v_isub(buf + n, n, m, n);
+	}
+	result = DeeInt_Alloc(n);
+	if unlikely(!result)
+		goto err;
+	memcpyc(result->ob_digit, buf + n, n, sizeof(digit));
+	return int_normalize(result);
+err:
+	return NULL;
+}
+
+/* Reduce `x' (which was created by the caller) in accordance to `self' */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeIntObject *DCALL
+pow_ctx_reduce(struct pow_ctx *__restrict self,
+               /*inherit(always)*/ DREF DeeIntObject *__restrict x) {
+	DREF DeeIntObject *q, *r;
+	switch (self->pc_kind) {
+
+	case POW_CTX_MOD:
+		if (int_divrem(x, self->pc_mod, &q, &r))
+			goto err_x;
+		Dee_Decref(q);
+		break;
+
+	case POW_CTX_BARRETT:
+		q = newton_inv_divrem(&self->pc_inv, x, self->pc_mod, &r);
+		if unlikely(!q)
+			goto err_x;
+		Dee_Decref(q);
+		break;
+
+	case POW_CTX_MONTGOMERY:
+		r = pow_ctx_redc(self, x);
+		break;
+
+	default:
+		return x;
+	}
+	Dee_Decref(x);
+	return r;
+err_x:
+	Dee_Decref(x);
+	return NULL;
+}
+
+/* Return `a * b', reduced in accordance to `self' */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DREF DeeIntObject *DCALL
+pow_ctx_mul(struct pow_ctx *__restrict self,
+            DeeIntObject *a, DeeIntObject *b) {
+	DREF DeeIntObject *result;
+	result = k_mul(a, b);
+	if likely(result)
+		result = pow_ctx_reduce(self, result);
+	return result;
+}
+
+/* Return the bit `bitno' of `|x|' */
+#define x_getbit(x, bitno) \
+	(((x)->ob_digit[(bitno) / DIGIT_BITS] >> ((bitno) % DIGIT_BITS)) & 1)
+
+/* Calculate `base ** exp' (where `exp > 0'), using left-to-right
+ * sliding-window exponentiation. `base' must already be reduced,
+ * and the result is reduced according to `self'. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DREF DeeIntObject *DCALL
+pow_ctx_pow(struct pow_ctx *__restrict self,
+            DeeIntObject *base, DeeIntObject *exp) {
+	DREF DeeIntObject *table[32], *result = NULL, *temp;
+	size_t i, j, nbits, table_size;
+	unsigned int k;
+	nbits = x_bitlength(exp);
+	ASSERT(nbits != 0);
+	/* Pick a window size (table_size = 2^(k - 1) odd powers) */
+	k = nbits <= 24 ? 1 : nbits <= 80 ? 3 : nbits <= 240
+	    ? 4 : nbits <= 672 ? 5 : 6;
+	table_size = (size_t)1 << (k - 1);
+	Dee_Incref(base);
+	table[0] = base;
+	if (table_size > 1) {
+		/* table[i] = base ** (2 * i + 1) */
+		temp = pow_ctx_mul(self, base, base);
+		if unlikely(!temp)
+			goto err_table_1;
+		for (i = 1; i < table_size; ++i) {
+			table[i] = pow_ctx_mul(self, table[i - 1], temp);
+			if unlikely(!table[i]) {
+				Dee_Decref(temp);
+				table_size = i;
+				goto err_table;
+			}
+		}
+		Dee_Decref(temp);
+	}
+	i = nbits;
+	while (i) {
+		size_t window;
+		SIGCHECK(goto err_table_result);
+		if (!x_getbit(exp, i - 1)) {
+			/* Zero-bits are simply squared */
+			temp = pow_ctx_mul(self, result, result);
+			if unlikely(!temp)
+				goto err_table_result;
+			Dee_Decref(result);
+			result = temp;
+			--i;
+			continue;
+		}
+		/* Find the longest window `[j, i)' (of up to `k'
+		 * bits) that starts and ends with a 1-bit. */
+		j = i > k ? i - k : 0;
+		while (!x_getbit(exp, j))
+			++j;
+		window = 0;
+		for (; i > j; --i) {
+			window = (window << 1) | x_getbit(exp, i - 1);
+			if (result) {
+				temp = pow_ctx_mul(self, result, result);
+				if unlikely(!temp)
+					goto err_table_result;
+				Dee_Decref(result);
+				result = temp;
+			}
+		}
+		if (result) {
+			temp = pow_ctx_mul(self, result, table[window >> 1]);
+			if unlikely(!temp)
+				goto err_table_result;
+			Dee_Decref(result);
+			result = temp;
+		} else {
+			result = table[window >> 1];
+			Dee_Incref(result);
+		}
+	}
+	for (i = 0; i < table_size; ++i)
+		Dee_Decref(table[i]);
+	return result;
+err_table_result:
+	Dee_XDecref(result);
+err_table:
+	for (i = 0; i < table_size; ++i)
+		Dee_Decref(table[i]);
+	return NULL;
+err_table_1:
+	Dee_Decref(base);
+	return NULL;
+}
+
 INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 int_pow(DeeIntObject *a, DeeObject *b_ob) {
-	DeeIntObject *z, *b;
-	dssize_t i, j, k;
-	DeeIntObject *table[32] = {
-		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
-	};
+	DREF DeeIntObject *result, *base, *b;
+	struct pow_ctx ctx;
 	b = (DeeIntObject *)DeeObject_Int(b_ob);
 	if unlikely(!b)
 		goto err;
-	a = (DeeIntObject *)a;
-	Dee_Incref(a);
 	if (b->ob_size < 0) {
-		Dee_Decref(a);
 		Dee_Decref(b);
 #if 0
 		return (*DeeFloat_Type.tp_math->tp_pow)(a, b);
@@ -1829,54 +2731,127 @@ int_pow(DeeIntObject *a, DeeObject *b_ob) {
 		goto err;
 #endif
 	}
-	z = (DeeIntObject *)DeeInt_One;
-	Dee_Incref(z);
-#define MULT(x, y, result)                                   \
-	do {                                                     \
-		DREF DeeIntObject *temp;                             \
-		temp = (DeeIntObject *)int_mul(x, (DeeObject *)(y)); \
-		if unlikely(!temp)                                   \
-			goto err_b_a_table_z;                            \
-		Dee_XDecref(result);                                 \
-		result = temp;                                       \
-	}	__WHILE0
-
-	if (b->ob_size <= FIVEARY_CUTOFF) {
-		for (i = b->ob_size - 1; i >= 0; --i) {
-			digit bi = b->ob_digit[i];
-			for (j = (digit)1 << (DIGIT_BITS - 1); j != 0; j >>= 1) {
-				MULT(z, z, z);
-				if (bi & j)
-					MULT(z, a, z);
-			}
-		}
+	if (b->ob_size == 0) {
+		Dee_Decref(b);
+		return_reference_(DeeInt_One);
+	}
+	base = a;
+	if (a->ob_size < 0) {
+		base = (DREF DeeIntObject *)int_neg(a);
+		if unlikely(!base)
+			goto err_b;
 	} else {
-		Dee_Incref(z);
-		table[0] = z;
-		for (i = 1; i < 32; ++i)
-			MULT(table[i - 1], a, table[i]);
-		for (i = b->ob_size - 1; i >= 0; --i) {
-			digit bi = b->ob_digit[i];
-			for (j = DIGIT_BITS - 5; j >= 0; j -= 5) {
-				int index = (bi >> j) & 0x1f;
-				for (k = 0; k < 5; ++k)
-					MULT(z, z, z);
-				if (index)
-					MULT(z, table[index], z);
-			}
-		}
+		Dee_Incref(base);
 	}
-out:
-	if (b->ob_size > FIVEARY_CUTOFF) {
-		for (i = 0; i < 32; ++i)
-			Dee_XDecref(table[i]);
+	ctx.pc_kind = POW_CTX_PLAIN;
+	result = pow_ctx_pow(&ctx, base, b);
+	Dee_Decref(base);
+	if (result && a->ob_size < 0 && (b->ob_digit[0] & 1)) {
+		DREF DeeObject *temp = int_neg(result);
+		Dee_Decref(result);
+		result = (DREF DeeIntObject *)temp;
 	}
-	Dee_Decref(a);
 	Dee_Decref(b);
-	return (DeeObject *)z;
-err_b_a_table_z:
-	Dee_Clear(z);
-	goto out;
+	return (DREF DeeObject *)result;
+err_b:
+	Dee_Decref(b);
+err:
+	return NULL;
+}
+
+/* Calculate `(a ** b) % m' (with the result having the same sign as `m') */
+INTERN WUNUSED NONNULL((1, 2, 3)) DREF DeeObject *DCALL
+int_powmod(DeeIntObject *a, DeeIntObject *b, DeeIntObject *m) {
+	DREF DeeIntObject *result, *base, *mod, *temp;
+	struct pow_ctx ctx;
+	dssize_t n;
+	int error;
+	if unlikely(m->ob_size == 0) {
+		err_divide_by_zero((DeeObject *)a, (DeeObject *)m);
+		goto err;
+	}
+	if unlikely(b->ob_size < 0) {
+		DERROR_NOTIMPLEMENTED();
+		goto err;
+	}
+	mod = m;
+	if (m->ob_size < 0) {
+		mod = (DREF DeeIntObject *)int_neg(m);
+		if unlikely(!mod)
+			goto err;
+	} else {
+		Dee_Incref(mod);
+	}
+	n = mod->ob_size;
+	if (n == 1 && mod->ob_digit[0] == 1) {
+		/* Everything is 0 (mod 1) */
+		Dee_Decref(mod);
+		return_reference_(DeeInt_Zero);
+	}
+	if (int_divmod(a, mod, NULL, &base))
+		goto err_mod;
+	if (b->ob_size == 0) {
+		Dee_Decref(base);
+		result = (DREF DeeIntObject *)DeeInt_One;
+		Dee_Incref(result);
+		goto done;
+	}
+	ctx.pc_mod = mod;
+	if ((mod->ob_digit[0] & 1) && n >= 2 && n < MONTGOMERY_MAXSIZE) {
+		digit inv = mod->ob_digit[0];
+		unsigned int i;
+		/* inv = mod^-1 mod DIGIT_BASE (each step doubles the # of correct bits) */
+		for (i = 0; i < 5; ++i)
+			inv = (digit)((inv * (2 - (twodigits)mod->ob_digit[0] * inv)) & DIGIT_MASK);
+		ctx.pc_minv = (digit)(((twodigits)DIGIT_BASE - inv) & DIGIT_MASK);
+		ctx.pc_buf  = (digit *)Dee_Mallocc(2 * (size_t)n + 1, sizeof(digit));
+		if unlikely(!ctx.pc_buf)
+			goto err_mod_base;
+		ctx.pc_kind = POW_CTX_MONTGOMERY;
+		/* Convert `base' into Montgomery form */
+		temp = x_lshift_bits(base, (size_t)n * DIGIT_BITS);
+		Dee_Decref(base);
+		if unlikely(!temp)
+			goto err_mod_buf;
+		error = int_divmod(temp, mod, NULL, &base);
+		Dee_Decref(temp);
+		if unlikely(error)
+			goto err_mod_buf;
+		result = pow_ctx_pow(&ctx, base, b);
+		Dee_Decref(base);
+		/* Convert the result back out of Montgomery form */
+		if likely(result)
+			result = pow_ctx_reduce(&ctx, result);
+		Dee_Free(ctx.pc_buf);
+	} else if (n >= NEWTON_DIV_CUTOFF) {
+		if (newton_inv_init(&ctx.pc_inv, mod, x_bitlength(mod) + 1))
+			goto err_mod_base;
+		ctx.pc_kind = POW_CTX_BARRETT;
+		result = pow_ctx_pow(&ctx, base, b);
+		Dee_Decref(base);
+		newton_inv_fini(&ctx.pc_inv);
+	} else {
+		ctx.pc_kind = POW_CTX_MOD;
+		result = pow_ctx_pow(&ctx, base, b);
+		Dee_Decref(base);
+	}
+	if unlikely(!result)
+		goto err_mod;
+done:
+	if (m->ob_size < 0 && result->ob_size != 0) {
+		temp = (DREF DeeIntObject *)int_sub(result, (DeeObject *)mod);
+		Dee_Decref(result);
+		result = temp;
+	}
+	Dee_Decref(mod);
+	return (DREF DeeObject *)result;
+err_mod_buf:
+	Dee_Free(ctx.pc_buf);
+	goto err_mod;
+err_mod_base:
+	Dee_Decref(base);
+err_mod:
+	Dee_Decref(mod);
 err:
 	return NULL;
 }
@@ -90,6 +90,7 @@ INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL int_and(DeeIntObject *a, De
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL int_xor(DeeIntObject *a, DeeObject *b);
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL int_or(DeeIntObject *a, DeeObject *b);
 INTDEF WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL int_pow(DeeIntObject *a, DeeObject *b);
+INTDEF WUNUSED NONNULL((1, 2, 3)) DREF DeeObject *DCALL int_powmod(DeeIntObject *a, DeeIntObject *b, DeeIntObject *m);
 
 INTDEF WUNUSED NONNULL((1)) int DCALL int_inc(DREF DeeIntObject **__restrict p_self);
 INTDEF WUNUSED NONNULL((1)) int DCALL int_dec(DREF DeeIntObject **__restrict p_self);
@@ -59,13 +59,7 @@ DeeSystem_DEFINE_memsetp(dee_memsetp)
 
 typedef DeeListObject List;
 
-typedef struct {
-	OBJECT_HEAD
-	DREF List   *li_list;  /* [1..1][const] The list being iterated. */
-	DWEAK size_t li_index; /* The current iteration index. */
-} ListIterator;
-
-INTDEF DeeTypeObject DeeListIterator_Type;
+typedef DeeListIteratorObject ListIterator;
 
 
 PRIVATE NONNULL((1)) void DCALL
@@ -1047,27 +1041,35 @@ err:
 	return -1;
 }
 
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+list_append_foreach_cb(void *arg, DeeObject *elem) {
+	return DeeList_Append((DeeObject *)arg, elem);
+}
+
 PUBLIC WUNUSED NONNULL((1, 2)) int
 (DCALL DeeList_AppendSequence)(DeeObject *self,
                                DeeObject *sequence) {
-	int error;
-	size_t fast_seqlen;
 	ASSERT_OBJECT_TYPE(self, &DeeList_Type);
 	ASSERT_OBJECT(sequence);
 	if (DeeTuple_CheckExact(sequence))
 		return DeeList_AppendVector(self, DeeTuple_SIZE(sequence), DeeTuple_ELEM(sequence));
-	fast_seqlen = DeeFastSeq_GetSize(sequence);
-	if (fast_seqlen != DEE_FASTSEQ_NOTFAST) {
-		/* TODO: Special optimization. */
+	if unlikely(sequence == self) {
+		/* Special case: append a list to itself (must only
+		 * append the elements that were there at the start) */
+		int error;
+		DREF DeeObject *copy;
+		copy = DeeList_Copy(self);
+		if unlikely(!copy)
+			goto err;
+		error = DeeList_AppendVector(self, DeeList_SIZE(copy), DeeList_ELEM(copy));
+		Dee_Decref(copy);
+		return error;
 	}
 
-	/* Fallback: Append elements from a general-purpose iterator. */
-	sequence = DeeObject_IterSelf(sequence);
-	if unlikely(!sequence)
+	/* Enumerate the sequence (using its native iteration protocol, if available) */
+	if unlikely(DeeObject_Foreach(sequence, &list_append_foreach_cb, self) < 0)
 		goto err;
-	error = DeeList_AppendIterator(self, sequence);
-	Dee_Decref(sequence);
-	return error;
+	return 0;
 err:
 	return -1;
 }
@@ -2382,6 +2384,27 @@ PRIVATE struct type_nsi tpconst list_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+list_foreach(List *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	DeeList_LockRead(self);
+	for (i = 0; i < DeeList_SIZE(self); ++i) {
+		DREF DeeObject *elem;
+		elem = DeeList_GET(self, i);
+		Dee_Incref(elem);
+		DeeList_LockEndRead(self);
+		temp = (*proc)(arg, elem);
+		Dee_Decref_unlikely(elem);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		DeeList_LockRead(self);
+	}
+	DeeList_LockEndRead(self);
+	return result;
+}
+
 PRIVATE struct type_seq list_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&list_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&list_size,
@@ -2392,7 +2415,9 @@ PRIVATE struct type_seq list_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&list_getrange,
 	/* .tp_range_del = */ (int (DCALL *)(DeeObject *, DeeObject *, DeeObject *))&list_delrange,
 	/* .tp_range_set = */ (int (DCALL *)(DeeObject *, DeeObject *, DeeObject *, DeeObject *))&list_setrange,
-	/* .tp_nsi       = */ &list_nsi
+	/* .tp_nsi       = */ &list_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&list_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 
@@ -3864,7 +3889,7 @@ PUBLIC DeeTypeObject DeeList_Type = {
 	                         "Perform a lexicographical comparison between @this List and the given @other sequence"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FNAMEOBJECT,
 	/* .tp_weakrefs = */ WEAKREF_SUPPORT_ADDR(List),
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
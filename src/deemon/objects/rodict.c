@@ -902,6 +902,23 @@ PRIVATE struct type_cmp rodict_cmp = {
 	/* .tp_ge   = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))NULL, // TODO: &rodict_ge,
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+rodict_foreach_pair(RoDict *self, Dee_foreach_pair_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	for (i = 0; i <= self->rd_mask; ++i) {
+		if (self->rd_elem[i].rdi_key == NULL)
+			continue;
+		temp = (*proc)(arg,
+		               self->rd_elem[i].rdi_key,
+		               self->rd_elem[i].rdi_value);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+	}
+	return result;
+}
+
 PRIVATE struct type_seq rodict_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&rodict_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&rodict_size,
@@ -912,7 +929,9 @@ PRIVATE struct type_seq rodict_seq = {
 	/* .tp_range_get = */ NULL,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &rodict_nsi
+	/* .tp_nsi       = */ &rodict_nsi,
+	/* .tp_foreach      = */ NULL,
+	/* .tp_foreach_pair = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_pair_t, void *))&rodict_foreach_pair,
 };
 
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
@@ -1042,7 +1061,7 @@ PUBLIC DeeTypeObject DeeRoDict_Type = {
 	/* .tp_doc      = */ NULL,
 	/* .tp_flags    = */ TP_FNORMAL | TP_FVARIABLE | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeMapping_Type,
 	/* .tp_init = */ {
 		{
@@ -1946,6 +1946,16 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+seq_parallel(DeeObject *self, size_t argc, DeeObject *const *argv) {
+	size_t chunk = 0;
+	if (DeeArg_Unpack(argc, argv, "|" UNPuSIZ ":parallel", &chunk))
+		goto err;
+	return DeeSeq_Parallel(self, chunk);
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 seq_distribute(DeeObject *self, size_t argc, DeeObject *const *argv) {
 	size_t segsize, mylen;
@@ -3080,6 +3090,22 @@ INTERN_TPCONST struct type_method tpconst seq_methods[] = {
 	            "Return a Sequence of sequences contains all elements from @this Sequence, "
 	            /**/ "with the first n sequences all consisting of @segment_size elements, before "
 	            /**/ "the last one contains the remainder of up to @segment_size elements"),
+	TYPE_METHOD("parallel",
+	            &seq_parallel,
+	            "(chunk=!0)->?Ert:SeqParallel\n"
+	            "#tIntegerOverflow{@chunk is negative, or too large}"
+	            "Returns a view of @this Sequence that implements $map, $filter, $reduce, "
+	            /**/ "$sum, $sorted, $any and $all by splitting elements into chunks of @chunk "
+	            /**/ "elements (or an automatically chosen amount when @chunk is $0), which are "
+	            /**/ "then processed in parallel by the calling thread and a shared pool of worker "
+	            /**/ "threads (one per additional CPU)\n"
+	            "Results are merged in order, but callbacks may be invoked in any order and from "
+	            /**/ "any thread. Before processing begins, elements are copied into a vector, such "
+	            /**/ "that later modifications of @this Sequence don't affect the operation\n"
+	            "${"
+	            /**/ "local squares = [:1000].parallel().map(x -> x * x);\n"
+	            /**/ "local total = [:1000].parallel(100).sum();"
+	            "}"),
 	TYPE_METHOD("distribute",
 	            &seq_distribute,
 	            "(bucket_count:?Dint)->?S?DSequence\n"
@@ -758,6 +758,19 @@ PRIVATE struct type_nsi tpconst cat_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+cat_foreach(Cat *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	for (i = 0; i < DeeTuple_SIZE(self); ++i) {
+		temp = DeeObject_Foreach(DeeTuple_GET(self, i), proc, arg);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+	}
+	return result;
+}
+
 PRIVATE struct type_seq cat_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&cat_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&cat_size,
@@ -768,7 +781,9 @@ PRIVATE struct type_seq cat_seq = {
 	/* .tp_range_get = */ NULL,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &cat_nsi
+	/* .tp_nsi       = */ &cat_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&cat_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 
@@ -814,7 +829,7 @@ INTERN DeeTypeObject SeqConcat_Type = {
 	/* .tp_doc      = */ NULL,
 	/* .tp_flags    = */ TP_FNORMAL | TP_FVARIABLE | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
@@ -192,6 +192,60 @@ DeeFastSeq_GetItemNB(DeeObject *__restrict self, size_t index) {
 }
 
 
+struct heapvec_data {
+	DREF DeeObject **hvd_vec;   /* [1..1][0..hvd_used][owned(Dee_Free)] Vector of elements. */
+	size_t           hvd_used;  /* Number of used slots in `hvd_vec' */
+	size_t           hvd_alloc; /* Number of allocated slots in `hvd_vec' */
+};
+
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+heapvec_append_cb(void *arg, DeeObject *elem) {
+	struct heapvec_data *data = (struct heapvec_data *)arg;
+	ASSERT(data->hvd_used <= data->hvd_alloc);
+	if unlikely(data->hvd_used >= data->hvd_alloc) {
+		/* Must allocate more memory. */
+		DREF DeeObject **new_vec;
+		size_t new_alloc = data->hvd_alloc * 2;
+		if unlikely(new_alloc < 16)
+			new_alloc = 16;
+		new_vec = (DREF DeeObject **)Dee_TryReallocc(data->hvd_vec, new_alloc,
+		                                             sizeof(DREF DeeObject *));
+		if unlikely(!new_vec) {
+			new_alloc = data->hvd_used + 1;
+			new_vec = (DREF DeeObject **)Dee_Reallocc(data->hvd_vec, new_alloc,
+			                                          sizeof(DREF DeeObject *));
+			if unlikely(!new_vec)
+				goto err;
+		}
+		data->hvd_vec   = new_vec;
+		data->hvd_alloc = new_alloc;
+	}
+	Dee_Incref(elem);
+	data->hvd_vec[data->hvd_used++] = elem;
+	return 0;
+err:
+	return -1;
+}
+
+/* Append all elements of `seq' to `data' (using `DeeObject_Foreach()', such
+ * that the native iteration protocol of `seq' is used, if available).
+ * Upon error, elements appended by this call are dropped once again, but
+ * `data->hvd_vec' / `data->hvd_alloc' may still have been updated.
+ * @return: 0 : Success
+ * @return: -1: Error */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+heapvec_appendseq(struct heapvec_data *__restrict data,
+                  DeeObject *__restrict seq) {
+	size_t start = data->hvd_used;
+	if unlikely(DeeObject_Foreach(seq, &heapvec_append_cb, data) < 0) {
+		Dee_Decrefv(data->hvd_vec + start, data->hvd_used - start);
+		data->hvd_used = start;
+		return -1;
+	}
+	return 0;
+}
+
+
 /* Allocate a suitable heap-vector for all the elements of a given sequence,
  * before returning that vector (then populated by [1..1] references), which
  * the caller must inherit upon success.
@@ -202,8 +256,9 @@ DeeFastSeq_GetItemNB(DeeObject *__restrict self, size_t index) {
 PUBLIC WUNUSED NONNULL((1, 2)) /*owned(Dee_Free)*/ DREF DeeObject **DCALL
 DeeSeq_AsHeapVector(DeeObject *__restrict self,
                     size_t *__restrict p_length) {
-	size_t i, fastsize, alloc_size;
-	DREF DeeObject **result, *iter, *elem, **new_result;
+	size_t i, fastsize;
+	DREF DeeObject **result, *elem;
+	struct heapvec_data data;
 	fastsize = DeeFastSeq_GetSize(self);
 	if (fastsize != DEE_FASTSEQ_NOTFAST) {
 		/* Optimization for fast-sequence-compatible objects. */
@@ -220,62 +275,35 @@ DeeSeq_AsHeapVector(DeeObject *__restrict self,
 		goto done;
 	}
 
-	/* Must use iterators. */
-	iter = DeeObject_IterSelf(self);
-	if unlikely(!iter)
-		goto err;
-	alloc_size = 16, i = 0;
-	result = (DREF DeeObject **)Dee_TryMallocc(alloc_size, sizeof(DREF DeeObject *));
-	if unlikely(!result) {
-		alloc_size = 1;
-		result = (DREF DeeObject **)Dee_Mallocc(alloc_size, sizeof(DREF DeeObject *));
-		goto err_r_iter;
+	/* Must enumerate the sequence. */
+	data.hvd_used  = 0;
+	data.hvd_alloc = 16;
+	data.hvd_vec   = (DREF DeeObject **)Dee_TryMallocc(data.hvd_alloc, sizeof(DREF DeeObject *));
+	if unlikely(!data.hvd_vec) {
+		data.hvd_alloc = 1;
+		data.hvd_vec   = (DREF DeeObject **)Dee_Mallocc(data.hvd_alloc, sizeof(DREF DeeObject *));
+		if unlikely(!data.hvd_vec)
+			goto err;
 	}
-
-	/* Iterate items. */
-	while (ITER_ISOK(elem = DeeObject_IterNext(iter))) {
-		ASSERT(i <= alloc_size);
-		if unlikely(i >= alloc_size) {
-			/* Must allocate more memory. */
-			size_t new_alloc_size;
-			new_alloc_size = alloc_size * 2;
-			new_result = (DREF DeeObject **)Dee_TryReallocc(result, new_alloc_size,
-			                                                sizeof(DREF DeeObject *));
-			if unlikely(!new_result) {
-				new_alloc_size = i + 1;
-				new_result = (DREF DeeObject **)Dee_Reallocc(result, new_alloc_size,
-				                                             sizeof(DREF DeeObject *));
-				if unlikely(!new_result)
-					goto err_r_iter_elem;
-			}
-			result     = new_result;
-			alloc_size = new_alloc_size;
-		}
-		result[i++] = elem; /* Inherit reference. */
-		if (DeeThread_CheckInterrupt())
-			goto err_r_iter;
+	if unlikely(heapvec_appendseq(&data, self)) {
+		Dee_Free(data.hvd_vec);
+		goto err;
 	}
-	if unlikely(!elem)
-		goto err_r_iter;
-	Dee_Decref(iter);
-	ASSERT(i <= alloc_size);
+	result = data.hvd_vec;
 
 	/* Free unused memory. */
-	if (i < alloc_size) {
-		new_result = (DREF DeeObject **)Dee_TryReallocc(result, i,
+	if (data.hvd_used < data.hvd_alloc) {
+		DREF DeeObject **new_result;
+		new_result = (DREF DeeObject **)Dee_TryReallocc(result, data.hvd_used,
 		                                                sizeof(DREF DeeObject *));
 		if likely(new_result)
 			result = new_result;
 	}
 
 	/* Save the resulting length. */
-	*p_length = i;
+	*p_length = data.hvd_used;
 done:
 	return result;
-err_r_iter_elem:
-	Dee_Decref(elem);
-err_r_iter:
-	Dee_Decref(iter);
 err_r_i:
 	Dee_Decrefv(result, i);
 	Dee_Free(result);
@@ -309,8 +337,9 @@ DeeSeq_AsHeapVectorWithAlloc(DeeObject *__restrict self,
                              /*[out]*/ size_t *__restrict p_allocated)
 #endif /* !Dee_MallocUsableSize */
 {
-	size_t i, fastsize, alloc_size;
-	DREF DeeObject **result, *iter, *elem, **new_result;
+	size_t i, fastsize;
+	DREF DeeObject **result, *elem;
+	struct heapvec_data data;
 	fastsize = DeeFastSeq_GetSize(self);
 	if (fastsize != DEE_FASTSEQ_NOTFAST) {
 		/* Optimization for fast-sequence-compatible objects. */
@@ -330,55 +359,29 @@ DeeSeq_AsHeapVectorWithAlloc(DeeObject *__restrict self,
 		goto done;
 	}
 
-	/* Must use iterators. */
-	iter = DeeObject_IterSelf(self);
-	if unlikely(!iter)
-		goto err;
-	alloc_size = 16;
-	i          = 0;
-	result = (DREF DeeObject **)Dee_TryMallocc(alloc_size, sizeof(DREF DeeObject *));
-	if unlikely(!result) {
-		alloc_size = 1;
-		result     = (DREF DeeObject **)Dee_Mallocc(alloc_size, sizeof(DREF DeeObject *));
-		goto err_r_iter;
+	/* Must enumerate the sequence. */
+	data.hvd_used  = 0;
+	data.hvd_alloc = 16;
+	data.hvd_vec   = (DREF DeeObject **)Dee_TryMallocc(data.hvd_alloc, sizeof(DREF DeeObject *));
+	if unlikely(!data.hvd_vec) {
+		data.hvd_alloc = 1;
+		data.hvd_vec   = (DREF DeeObject **)Dee_Mallocc(data.hvd_alloc, sizeof(DREF DeeObject *));
+		if unlikely(!data.hvd_vec)
+			goto err;
 	}
-
-	/* Iterate items. */
-	while (ITER_ISOK(elem = DeeObject_IterNext(iter))) {
-		ASSERT(i <= alloc_size);
-		if unlikely(i >= alloc_size) {
-			/* Must allocate more memory. */
-			size_t new_alloc_size = alloc_size * 2;
-			new_result = (DREF DeeObject **)Dee_TryReallocc(result, new_alloc_size, sizeof(DREF DeeObject *));
-			if unlikely(!new_result) {
-				new_alloc_size = i + 1;
-				new_result = (DREF DeeObject **)Dee_Reallocc(result, new_alloc_size, sizeof(DREF DeeObject *));
-				if unlikely(!new_result)
-					goto err_r_iter_elem;
-			}
-			result     = new_result;
-			alloc_size = new_alloc_size;
-		}
-		result[i++] = elem; /* Inherit reference. */
-		if (DeeThread_CheckInterrupt())
-			goto err_r_iter;
+	if unlikely(heapvec_appendseq(&data, self)) {
+		Dee_Free(data.hvd_vec);
+		goto err;
 	}
-	if unlikely(!elem)
-		goto err_r_iter;
-	Dee_Decref(iter);
-	ASSERT(i <= alloc_size);
+	result = data.hvd_vec;
 
 	/* Save the resulting length, and allocation. */
 #ifndef Dee_MallocUsableSize
-	*p_allocated = alloc_size;
+	*p_allocated = data.hvd_alloc;
 #endif /* !Dee_MallocUsableSize */
-	*p_length = i;
+	*p_length = data.hvd_used;
 done:
 	return result;
-err_r_iter_elem:
-	Dee_Decref(elem);
-err_r_iter:
-	Dee_Decref(iter);
 err_r_i:
 	Dee_Decrefv(result, i);
 	Dee_Free(result);
@@ -434,9 +437,9 @@ DeeSeq_AsHeapVectorWithAllocReuse(DeeObject *__restrict self,
 #endif /* !Dee_MallocUsableSize */
 {
 	DeeObject **new_elemv, **elemv = *p_vector;
-	DREF DeeObject *iterator, *elem;
+	DREF DeeObject *elem;
 #ifdef Dee_MallocUsableSize
-	size_t elema = Dee_MallocUsableSize(elemv);
+	size_t elema = Dee_MallocUsableSize(elemv) / sizeof(DREF DeeObject *);
 #else /* Dee_MallocUsableSize */
 	size_t elema = *p_allocated;
 #endif /* !Dee_MallocUsableSize */
@@ -462,49 +465,22 @@ DeeSeq_AsHeapVectorWithAllocReuse(DeeObject *__restrict self,
 			elemv[i] = elem; /* Inherit reference. */
 		}
 	} else {
-		/* Use iterators. */
-		iterator = DeeObject_IterSelf(self);
-		if unlikely(!iterator)
-			goto err;
-		elemc = 0;
-		while (ITER_ISOK(elem = DeeObject_IterNext(iterator))) {
-			ASSERT(elemc <= elema);
-			if (elemc >= elema) {
-				/* Allocate more memory. */
-				size_t new_elema = elema * 2;
-				if unlikely(new_elema < 16)
-					new_elema = 16;
-				new_elemv = (DeeObject **)Dee_TryReallocc(elemv, new_elema, sizeof(DeeObject *));
-				if unlikely(!new_elemv) {
-					new_elema = elemc + 1;
-					new_elemv = (DeeObject **)Dee_Reallocc(elemv, new_elema, sizeof(DeeObject *));
-					if unlikely(!new_elemv)
-						goto err_iterator_elemc;
-				}
-				elemv = new_elemv;
-				elema = new_elema;
-			}
-			elemv[elemc] = elem; /* Inherit reference. */
-			++elemc;
-		}
-		*p_vector = elemv;
+		/* Enumerate the sequence. */
+		struct heapvec_data data;
+		int error;
+		data.hvd_vec   = elemv;
+		data.hvd_used  = 0;
+		data.hvd_alloc = elema;
+		error = heapvec_appendseq(&data, self);
+		*p_vector = data.hvd_vec;
 #ifndef Dee_MallocUsableSize
-		*p_allocated = elema;
+		*p_allocated = data.hvd_alloc;
 #endif /* !Dee_MallocUsableSize */
-		if unlikely(!elem)
-			goto err_iterator;
-		Dee_Decref(iterator);
+		if unlikely(error)
+			goto err;
+		elemc = data.hvd_used;
 	}
 	return elemc;
-err_iterator_elemc:
-	Dee_Decrefv(elemv, elemc);
-	*p_vector = elemv;
-#ifndef Dee_MallocUsableSize
-	*p_allocated = elema;
-#endif /* !Dee_MallocUsableSize */
-err_iterator:
-	Dee_Decref(iterator);
-	goto err;
 err_i:
 	Dee_Decrefv(elemv, i);
 err:
@@ -551,9 +527,9 @@ DeeSeq_AsHeapVectorWithAllocReuseOffset(DeeObject *__restrict self,
 #endif /* !Dee_MallocUsableSize */
 {
 	DeeObject **new_elemv, **elemv = *p_vector;
-	DREF DeeObject *iterator, *elem;
+	DREF DeeObject *elem;
 #ifdef Dee_MallocUsableSize
-	size_t elema = Dee_MallocUsableSize(elemv);
+	size_t elema = Dee_MallocUsableSize(elemv) / sizeof(DREF DeeObject *);
 #else /* Dee_MallocUsableSize */
 	size_t elema = *p_allocated;
 #endif /* !Dee_MallocUsableSize */
@@ -582,51 +558,22 @@ DeeSeq_AsHeapVectorWithAllocReuseOffset(DeeObject *__restrict self,
 			elemv[offset + i] = elem; /* Inherit reference. */
 		}
 	} else {
-		/* Use iterators. */
-		iterator = DeeObject_IterSelf(self);
-		if unlikely(!iterator)
-			goto err;
-		elemc = 0;
-		while (ITER_ISOK(elem = DeeObject_IterNext(iterator))) {
-			ASSERT(elemc <= (elema - offset));
-			if (elemc >= (elema - offset)) {
-				/* Allocate more memory. */
-				size_t new_elema = elema * 2;
-				if unlikely(new_elema < 16)
-					new_elema = 16;
-				new_elemv = (DeeObject **)Dee_TryReallocc(elemv, new_elema,
-				                                          sizeof(DeeObject *));
-				if unlikely(!new_elemv) {
-					new_elema = offset + elemc + 1;
-					new_elemv = (DeeObject **)Dee_Reallocc(elemv, new_elema,
-					                                       sizeof(DeeObject *));
-					if unlikely(!new_elemv)
-						goto err_iterator_elemc;
-				}
-				elemv = new_elemv;
-				elema = new_elema;
-			}
-			elemv[offset + elemc] = elem; /* Inherit reference. */
-			++elemc;
-		}
-		*p_vector = elemv;
+		/* Enumerate the sequence. */
+		struct heapvec_data data;
+		int error;
+		data.hvd_vec   = elemv;
+		data.hvd_used  = offset;
+		data.hvd_alloc = elema;
+		error = heapvec_appendseq(&data, self);
+		*p_vector = data.hvd_vec;
 #ifndef Dee_MallocUsableSize
-		*p_allocated = elema;
+		*p_allocated = data.hvd_alloc;
 #endif /* !Dee_MallocUsableSize */
-		if unlikely(!elem)
-			goto err_iterator;
-		Dee_Decref(iterator);
+		if unlikely(error)
+			goto err;
+		elemc = data.hvd_used - offset;
 	}
 	return elemc;
-err_iterator_elemc:
-	Dee_Decrefv(elemv + offset, elemc);
-	*p_vector = elemv;
-#ifndef Dee_MallocUsableSize
-	*p_allocated = elema;
-#endif /* !Dee_MallocUsableSize */
-err_iterator:
-	Dee_Decref(iterator);
-	goto err;
 err_i:
 	Dee_Decrefv(elemv + offset, i);
 err:
@@ -0,0 +1,618 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_OBJECTS_SEQ_PARALLEL_C
+#define GUARD_DEEMON_OBJECTS_SEQ_PARALLEL_C 1
+
+#include "parallel.h"
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/error.h>
+#include <deemon/list.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/seq.h>
+#include <deemon/string.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/workerpool.h>
+
+#include "../../runtime/runtime_error.h"
+#include "../../runtime/strings.h"
+
+DECL_BEGIN
+
+/* Parallel sequence operations work by splitting a vector of items into
+ * chunks, which are then processed by the calling thread, as well as the
+ * shared pool of worker threads (s.a. `Dee_parallel_job_exec()'). Results
+ * are always stored at the index of their origin, meaning that results
+ * are merged in order. */
+
+/* Return the # of items per chunk to use when processing `size' items. */
+PRIVATE WUNUSED NONNULL((1)) size_t DCALL
+parallel_chunksize(SeqParallel *__restrict self, size_t size) {
+	size_t result = self->sp_chunk;
+	if (result == 0) {
+		/* Use a couple of chunks per thread, such that
+		 * differently-costly chunks are balanced out. */
+		size_t nchunks = (Dee_parallel_getworkers() + 1) * 4;
+		result = (size + nchunks - 1) / nchunks;
+		if (result == 0)
+			result = 1;
+	}
+	return result;
+}
+
+
+
+/************************************************************************/
+/* Operations                                                           */
+/************************************************************************/
+
+struct parallel_items_job {
+	struct Dee_parallel_job pij_job;     /* Underlying job. */
+	DeeObject             **pij_items;   /* [1..1][const][0..pij_job.pj_size] Items being processed. */
+	DeeObject              *pij_func;    /* [0..1][const] User-defined function. */
+	void                   *pij_results; /* [const] Per-item, or per-chunk results. */
+};
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+parallel_map_chunk(struct parallel_items_job *__restrict self,
+                   size_t UNUSED(index), size_t start, size_t end) {
+	DREF DeeObject **results = (DREF DeeObject **)self->pij_results;
+	for (; start < end; ++start) {
+		results[start] = DeeObject_Call(self->pij_func, 1, &self->pij_items[start]);
+		if unlikely(!results[start])
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+parallel_filter_chunk(struct parallel_items_job *__restrict self,
+                      size_t UNUSED(index), size_t start, size_t end) {
+	bool *keep = (bool *)self->pij_results;
+	for (; start < end; ++start) {
+		int temp;
+		DREF DeeObject *pred;
+		pred = DeeObject_Call(self->pij_func, 1, &self->pij_items[start]);
+		if unlikely(!pred)
+			goto err;
+		temp = DeeObject_Bool(pred);
+		Dee_Decref(pred);
+		if unlikely(temp < 0)
+			goto err;
+		keep[start] = temp != 0;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Combine 2 values using `combine', or `operator +' when `combine' is NULL */
+PRIVATE WUNUSED NONNULL((2, 3)) DREF DeeObject *DCALL
+parallel_combine(DeeObject *combine, DeeObject *lhs, DeeObject *rhs) {
+	DeeObject *args[2];
+	if (!combine)
+		return DeeObject_Add(lhs, rhs);
+	args[0] = lhs;
+	args[1] = rhs;
+	return DeeObject_Call(combine, 2, args);
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+parallel_reduce_chunk(struct parallel_items_job *__restrict self,
+                      size_t index, size_t start, size_t end) {
+	DREF DeeObject **results = (DREF DeeObject **)self->pij_results;
+	DREF DeeObject *result = self->pij_items[start];
+	Dee_Incref(result);
+	while (++start < end) {
+		DREF DeeObject *next;
+		next = parallel_combine(self->pij_func, result, self->pij_items[start]);
+		Dee_Decref(result);
+		if unlikely(!next)
+			goto err;
+		result = next;
+	}
+	results[index] = result;
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+parallel_sort_chunk(struct parallel_items_job *__restrict self,
+                    size_t UNUSED(index), size_t start, size_t end) {
+	DeeObject **sorted = (DeeObject **)self->pij_results;
+	return DeeSeq_MergeSort(sorted + start, self->pij_items + start,
+	                        end - start, self->pij_func);
+}
+
+struct parallel_any_job {
+	struct parallel_items_job paj_items; /* Underlying job (`pij_func' is the optional key) */
+	bool                      paj_want;  /* [const] The value being searched for. */
+	bool                      paj_found; /* [atomic] Set to true once an item equal to `paj_want' was found. */
+};
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+parallel_any_chunk(struct parallel_any_job *__restrict self,
+                   size_t UNUSED(index), size_t start, size_t end) {
+	for (; start < end; ++start) {
+		int temp;
+		DeeObject *item = self->paj_items.pij_items[start];
+		if (atomic_read(&self->paj_found))
+			break; /* Another thread already found a matching item. */
+		if (self->paj_items.pij_func) {
+			item = DeeObject_Call(self->paj_items.pij_func, 1, &item);
+			if unlikely(!item)
+				goto err;
+			temp = DeeObject_Bool(item);
+			Dee_Decref(item);
+		} else {
+			temp = DeeObject_Bool(item);
+		}
+		if unlikely(temp < 0)
+			goto err;
+		if ((temp != 0) == self->paj_want) {
+			atomic_write(&self->paj_found, true);
+			break;
+		}
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Load the items of `self->sp_seq' into a heap-vector, and initialize `job'
+ * @return: * :   The heap-vector of items (to-be freed by the caller)
+ * @return: NULL: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DREF DeeObject **DCALL
+parallel_items_init(SeqParallel *__restrict self,
+                    struct parallel_items_job *__restrict job,
+                    WUNUSED NONNULL((1)) int (DCALL *func)(struct Dee_parallel_job *__restrict self,
+                                                           size_t index, size_t start, size_t end),
+                    DeeObject *user_func) {
+	size_t count;
+	DREF DeeObject **items;
+	items = DeeSeq_AsHeapVector(self->sp_seq, &count);
+	if likely(items) {
+		Dee_parallel_job_init(&job->pij_job, func, count,
+		                  parallel_chunksize(self, count));
+		job->pij_items   = items;
+		job->pij_func    = user_func;
+		job->pij_results = NULL;
+	}
+	return items;
+}
+
+#define PARALLEL_CHUNKFUNC(func) \
+	((WUNUSED NONNULL((1)) int (DCALL *)(struct Dee_parallel_job *__restrict, size_t, size_t, size_t))(func))
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_map(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	struct parallel_items_job job;
+	DREF DeeObject **items, **results;
+	DREF DeeObject *result;
+	DeeObject *func;
+	if (DeeArg_Unpack(argc, argv, "o:map", &func))
+		goto err;
+	items = parallel_items_init(self, &job, PARALLEL_CHUNKFUNC(&parallel_map_chunk), func);
+	if unlikely(!items)
+		goto err;
+	if (job.pij_job.pj_size == 0) {
+		Dee_Free(items);
+		return DeeList_New();
+	}
+	results = (DREF DeeObject **)Dee_Callocc(job.pij_job.pj_size, sizeof(DREF DeeObject *));
+	if unlikely(!results)
+		goto err_items;
+	job.pij_results = results;
+	if unlikely(Dee_parallel_job_exec(&job.pij_job))
+		goto err_items_results;
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+	result = DeeList_NewVectorInheritedHeap(results, job.pij_job.pj_size, job.pij_job.pj_size);
+	if unlikely(!result)
+		goto err_results;
+	return result;
+err_items_results:
+	Dee_XDecrefv(results, job.pij_job.pj_size);
+	Dee_Free(results);
+err_items:
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+err:
+	return NULL;
+err_results:
+	Dee_Decrefv(results, job.pij_job.pj_size);
+	Dee_Free(results);
+	goto err;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_filter(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	struct parallel_items_job job;
+	DREF DeeObject **items;
+	DREF DeeObject *result;
+	DeeObject *func;
+	bool *keep;
+	size_t i, count;
+	if (DeeArg_Unpack(argc, argv, "o:filter", &func))
+		goto err;
+	items = parallel_items_init(self, &job, PARALLEL_CHUNKFUNC(&parallel_filter_chunk), func);
+	if unlikely(!items)
+		goto err;
+	if (job.pij_job.pj_size == 0) {
+		Dee_Free(items);
+		return DeeList_New();
+	}
+	keep = (bool *)Dee_Callocc(job.pij_job.pj_size, sizeof(bool));
+	if unlikely(!keep)
+		goto err_items;
+	job.pij_results = keep;
+	if unlikely(Dee_parallel_job_exec(&job.pij_job))
+		goto err_items_keep;
+
+	/* Compact the vector of items (in order), dropping items that weren't kept. */
+	for (i = count = 0; i < job.pij_job.pj_size; ++i) {
+		if (keep[i]) {
+			items[count++] = items[i];
+		} else {
+			Dee_Decref(items[i]);
+		}
+	}
+	Dee_Free(keep);
+	result = DeeList_NewVectorInheritedHeap(items, count, job.pij_job.pj_size);
+	if unlikely(!result) {
+		Dee_Decrefv(items, count);
+		Dee_Free(items);
+	}
+	return result;
+err_items_keep:
+	Dee_Free(keep);
+err_items:
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+err:
+	return NULL;
+}
+
+/* Reduce items using `combine' (or `operator +' when NULL), starting with `init' (when non-NULL) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_reduce_impl(SeqParallel *self, DeeObject *combine, DeeObject *init) {
+	struct parallel_items_job job;
+	DREF DeeObject **items, **results;
+	DREF DeeObject *result;
+	size_t i;
+	items = parallel_items_init(self, &job, PARALLEL_CHUNKFUNC(&parallel_reduce_chunk), combine);
+	if unlikely(!items)
+		goto err;
+	if (job.pij_job.pj_size == 0) {
+		Dee_Free(items);
+		if (init)
+			return_reference_(init);
+		return_none;
+	}
+	results = (DREF DeeObject **)Dee_Callocc(job.pij_job.pj_chunks, sizeof(DREF DeeObject *));
+	if unlikely(!results)
+		goto err_items;
+	job.pij_results = results;
+	if unlikely(Dee_parallel_job_exec(&job.pij_job))
+		goto err_items_results;
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+
+	/* Combine the results of individual chunks (in order) */
+	i = 0;
+	if (init) {
+		result = init;
+		Dee_Incref(result);
+	} else {
+		result = results[i++];
+	}
+	for (; i < job.pij_job.pj_chunks; ++i) {
+		DREF DeeObject *next;
+		next = parallel_combine(combine, result, results[i]);
+		Dee_Decref(result);
+		Dee_Decref(results[i]);
+		if unlikely(!next)
+			goto err_results_after_i;
+		result = next;
+	}
+	Dee_Free(results);
+	return result;
+err_results_after_i:
+	Dee_Decrefv(results + i + 1, job.pij_job.pj_chunks - (i + 1));
+	Dee_Free(results);
+	goto err;
+err_items_results:
+	Dee_XDecrefv(results, job.pij_job.pj_chunks);
+	Dee_Free(results);
+err_items:
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_reduce(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *combine, *init = NULL;
+	if (DeeArg_Unpack(argc, argv, "o|o:reduce", &combine, &init))
+		goto err;
+	return sp_reduce_impl(self, combine, init);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_sum(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":sum"))
+		goto err;
+	return sp_reduce_impl(self, NULL, NULL);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_sorted(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	struct parallel_items_job job;
+	DREF DeeObject **items, **sorted;
+	DREF DeeObject *result;
+	DeeObject *key = NULL;
+	if (DeeArg_Unpack(argc, argv, "|o:sorted", &key))
+		goto err;
+	if (key && DeeNone_Check(key))
+		key = NULL;
+	items = parallel_items_init(self, &job, PARALLEL_CHUNKFUNC(&parallel_sort_chunk), key);
+	if unlikely(!items)
+		goto err;
+	if (job.pij_job.pj_size == 0) {
+		Dee_Free(items);
+		return DeeList_New();
+	}
+	sorted = (DeeObject **)Dee_Mallocc(job.pij_job.pj_size, sizeof(DeeObject *));
+	if unlikely(!sorted)
+		goto err_items;
+	job.pij_results = sorted;
+	if unlikely(Dee_parallel_job_exec(&job.pij_job))
+		goto err_items_sorted;
+
+	/* Merge sorted chunks. Since the merge sort re-uses pre-sorted runs, this
+	 * only has to merge the runs produced by the individual chunks. */
+	if (job.pij_job.pj_chunks > 1) {
+		if unlikely(DeeSeq_MergeSort(items, sorted, job.pij_job.pj_size, key))
+			goto err_items_sorted;
+		Dee_Free(sorted);
+	} else {
+		Dee_Free(items);
+		items = sorted;
+	}
+	result = DeeList_NewVectorInheritedHeap(items, job.pij_job.pj_size, job.pij_job.pj_size);
+	if unlikely(!result)
+		goto err_items;
+	return result;
+err_items_sorted:
+	Dee_Free(sorted);
+err_items:
+	Dee_Decrefv(items, job.pij_job.pj_size);
+	Dee_Free(items);
+err:
+	return NULL;
+}
+
+/* @return: 1:  An item equal to `want' was found.
+ * @return: 0:  No item equal to `want' was found.
+ * @return: -1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+sp_any_impl(SeqParallel *self, size_t argc, DeeObject *const *argv,
+            char const *format, bool want) {
+	struct parallel_any_job job;
+	DREF DeeObject **items;
+	DeeObject *key = NULL;
+	int result;
+	if (DeeArg_Unpack(argc, argv, format, &key))
+		goto err;
+	if (key && DeeNone_Check(key))
+		key = NULL;
+	items = parallel_items_init(self, &job.paj_items, PARALLEL_CHUNKFUNC(&parallel_any_chunk), key);
+	if unlikely(!items)
+		goto err;
+	job.paj_want  = want;
+	job.paj_found = false;
+	result = Dee_parallel_job_exec(&job.paj_items.pij_job);
+	if likely(result == 0)
+		result = job.paj_found ? 1 : 0;
+	Dee_Decrefv(items, job.paj_items.pij_job.pj_size);
+	Dee_Free(items);
+	return result;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_any(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	int result = sp_any_impl(self, argc, argv, "|o:any", true);
+	if unlikely(result < 0)
+		goto err;
+	return_bool_(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+sp_all(SeqParallel *self, size_t argc, DeeObject *const *argv) {
+	int result = sp_any_impl(self, argc, argv, "|o:all", false);
+	if unlikely(result < 0)
+		goto err;
+	return_bool_(!result);
+err:
+	return NULL;
+}
+
+PRIVATE struct type_method tpconst sp_methods[] = {
+	TYPE_METHOD("map", &sp_map,
+	            "(func:?DCallable)->?DList\n"
+	            "Returns a list of ${func(x)} for every element ${x} of the underlying sequence"),
+	TYPE_METHOD("filter", &sp_filter,
+	            "(keep:?DCallable)->?DList\n"
+	            "Returns a list of all elements of the underlying sequence for which ${keep(x)} "
+	            /**/ "evaluates to ?t, retaining their original order"),
+	TYPE_METHOD("reduce", &sp_reduce,
+	            "(combine:?DCallable,init?)->\n"
+	            "Combine all elements of the underlying sequence using @combine\n"
+	            "Since elements are combined in chunks, @combine must be associative, "
+	            /**/ "though it doesn't have to be commutative. If given, @init is only "
+	            /**/ "combined once (with the combined elements of the first chunk)"),
+	TYPE_METHOD("sum", &sp_sum,
+	            "->\n"
+	            "Same as ${this.reduce((a, b) -> a + b)}. "
+	            /**/ "Returns ?N if the underlying sequence is empty"),
+	TYPE_METHOD("sorted", &sp_sorted,
+	            "(key:?DCallable=!N)->?DList\n"
+	            "Returns a stably sorted list of the elements of the underlying sequence\n"
+	            "Chunks are sorted in parallel, and then merged. Note that @key may be "
+	            /**/ "invoked more than once for the same element"),
+	TYPE_METHOD("any", &sp_any,
+	            "(key:?DCallable=!N)->?Dbool\n"
+	            "Returns ?t if ${key(x)} (or just ${x}) evaluates to ?t for any element\n"
+	            "Once a matching element is found, remaining chunks are skipped"),
+	TYPE_METHOD("all", &sp_all,
+	            "(key:?DCallable=!N)->?Dbool\n"
+	            "Returns ?t if ${key(x)} (or just ${x}) evaluates to ?t for all elements\n"
+	            "Once a non-matching element is found, remaining chunks are skipped"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_member tpconst sp_members[] = {
+	TYPE_MEMBER_FIELD_DOC(STR_seq, STRUCT_OBJECT, offsetof(SeqParallel, sp_seq), "->?DSequence"),
+	TYPE_MEMBER_FIELD("__chunk__", STRUCT_SIZE_T | STRUCT_CONST, offsetof(SeqParallel, sp_chunk)),
+	TYPE_MEMBER_END
+};
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+sp_ctor(SeqParallel *__restrict self) {
+	self->sp_seq   = Dee_EmptySeq;
+	self->sp_chunk = 0;
+	Dee_Incref(Dee_EmptySeq);
+	return 0;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+sp_copy(SeqParallel *__restrict self,
+        SeqParallel *__restrict other) {
+	self->sp_seq   = other->sp_seq;
+	self->sp_chunk = other->sp_chunk;
+	Dee_Incref(self->sp_seq);
+	return 0;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+sp_init(SeqParallel *__restrict self,
+        size_t argc, DeeObject *const *argv) {
+	self->sp_chunk = 0;
+	if (DeeArg_Unpack(argc, argv, "o|" UNPuSIZ ":_SeqParallel",
+	                  &self->sp_seq, &self->sp_chunk))
+		goto err;
+	Dee_Incref(self->sp_seq);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+sp_fini(SeqParallel *__restrict self) {
+	Dee_Decref(self->sp_seq);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+sp_visit(SeqParallel *__restrict self, dvisit_t proc, void *arg) {
+	Dee_Visit(self->sp_seq);
+}
+
+INTERN DeeTypeObject SeqParallel_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "_SeqParallel",
+	/* .tp_doc      = */ DOC("()\n"
+	                         "(seq:?DSequence,chunk=!0)"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)&sp_ctor,
+				/* .tp_copy_ctor = */ (dfunptr_t)&sp_copy,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)&sp_init,
+				TYPE_FIXED_ALLOCATOR(SeqParallel)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&sp_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&sp_visit,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ sp_methods,
+	/* .tp_getsets       = */ NULL,
+	/* .tp_members       = */ sp_members,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+/* Construct a view for performing operations on `self' in parallel.
+ * @param: chunk: # of elements per chunk (or `0' to choose automatically) */
+INTERN WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+DeeSeq_Parallel(DeeObject *__restrict self, size_t chunk) {
+	DREF SeqParallel *result;
+	result = DeeObject_MALLOC(SeqParallel);
+	if unlikely(!result)
+		goto done;
+	Dee_Incref(self);
+	result->sp_seq   = self;
+	result->sp_chunk = chunk;
+	DeeObject_Init(result, &SeqParallel_Type);
+done:
+	return (DREF DeeObject *)result;
+}
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_OBJECTS_SEQ_PARALLEL_C */
@@ -32,6 +32,7 @@
 #include <deemon/object.h>
 #include <deemon/seq.h>
 #include <deemon/string.h>
+#include <deemon/thread.h>
 #include <deemon/util/atomic.h>
 #include <deemon/util/lock.h>
 
@@ -935,6 +936,45 @@ err:
 
 
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+range_foreach(Range *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	DREF DeeObject *index;
+	index = self->r_start;
+	Dee_Incref(index);
+	for (;;) {
+		int error;
+		/* Check if the end has been reached */
+		error = likely(!self->r_rev)
+		        ? DeeObject_CompareLo(index, self->r_end)
+		        : DeeObject_CompareGr(index, self->r_end);
+		if (error <= 0) {
+			/* Error, or done. */
+			if unlikely(error < 0)
+				goto err_index;
+			break;
+		}
+		temp = (*proc)(arg, index);
+		if unlikely(temp < 0) {
+			Dee_Decref(index);
+			return temp;
+		}
+		result += temp;
+		error = self->r_step
+		        ? DeeObject_InplaceAdd(&index, self->r_step)
+		        : DeeObject_Inc(&index);
+		if unlikely(error)
+			goto err_index;
+		if (DeeThread_CheckInterrupt())
+			goto err_index;
+	}
+	Dee_Decref(index);
+	return result;
+err_index:
+	Dee_Decref(index);
+	return -1;
+}
+
 PRIVATE struct type_seq range_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&range_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&range_size,
@@ -945,7 +985,9 @@ PRIVATE struct type_seq range_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&range_getrange,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ NULL /* TODO */
+	/* .tp_nsi       = */ NULL /* TODO */,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&range_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE struct type_member tpconst range_members[] = {
@@ -1061,7 +1103,7 @@ INTERN DeeTypeObject SeqRange_Type = {
 	                         "(start, end, step?)"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
@@ -1459,6 +1501,30 @@ PRIVATE struct type_nsi tpconst intrange_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+intrange_foreach(IntRange *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	dssize_t index = self->ir_start;
+	size_t count   = intrange_nsi_getsize(self);
+	while (count) {
+		DREF DeeObject *elem;
+		elem = DeeInt_NewSSize(index);
+		if unlikely(!elem)
+			goto err;
+		temp = (*proc)(arg, elem);
+		Dee_Decref(elem);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		if (!--count)
+			break;
+		index += self->ir_step; /* Cannot overflow (the next index is still in-bounds) */
+	}
+	return result;
+err:
+	return -1;
+}
+
 PRIVATE struct type_seq intrange_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&intrange_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&intrange_size,
@@ -1469,7 +1535,9 @@ PRIVATE struct type_seq intrange_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&intrange_getrange,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &intrange_nsi
+	/* .tp_nsi       = */ &intrange_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&intrange_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 
@@ -1554,7 +1622,7 @@ INTERN DeeTypeObject SeqIntRange_Type = {
 	                         "(start:?Dint,end:?Dint,step=!1)"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
@@ -0,0 +1,750 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifdef __INTELLISENSE__
+#include "sort.c"
+#define DEFINE_sort_object
+//#define DEFINE_sort_keyed
+//#define DEFINE_sort_int64
+//#define DEFINE_sort_double
+//#define DEFINE_sort_bytes
+#endif /* __INTELLISENSE__ */
+
+#if (defined(DEFINE_sort_object) + defined(DEFINE_sort_keyed) + \
+     defined(DEFINE_sort_int64) + defined(DEFINE_sort_double) + \
+     defined(DEFINE_sort_bytes)) != 1
+#error "Must #define exactly one of these macros!"
+#endif /* DEFINE_sort_... */
+
+/* Adaptive, stable merge sort ("TimSort"), following the design of python's `listsort':
+ * - Natural runs (ascending, or strictly descending) are detected and re-used
+ * - Short runs are extended to `minrun' elements using binary insertion sort
+ * - Pending runs are kept balanced on a stack, and merged using galloping
+ *   once one of the two runs starts winning comparisons consistently.
+ *
+ * Every element type has a `LOCAL_lo(a, b)' operator which returns:
+ *  - 1:  `a < b'
+ *  - 0:  `!(a < b)'
+ *  - -1: An error was thrown
+ * All merge functions make sure that the vector remains a permutation of its
+ * original elements even when an error happens mid-way (so the caller is able
+ * to clean up any references stored within the elements). */
+
+DECL_BEGIN
+
+#ifdef DEFINE_sort_object
+#define LOCAL_T        DeeObject *
+#define LOCAL_lo(a, b) sort_object_lo(a, b)
+#define LOCAL_FUNC(x)  PP_CAT2(sort_object_, x)
+#elif defined(DEFINE_sort_keyed)
+#define LOCAL_T        struct sort_keyed
+#define LOCAL_lo(a, b) sort_object_lo((a).sk_key, (b).sk_key)
+#define LOCAL_FUNC(x)  PP_CAT2(sort_keyed_, x)
+#elif defined(DEFINE_sort_int64)
+#define LOCAL_T        struct sort_int64
+#define LOCAL_lo(a, b) ((a).i64_key < (b).i64_key)
+#define LOCAL_FUNC(x)  PP_CAT2(sort_int64_, x)
+#define LOCAL_IS_NATIVE
+#elif defined(DEFINE_sort_double)
+#define LOCAL_T        struct sort_double
+#define LOCAL_lo(a, b) ((a).sd_key < (b).sd_key)
+#define LOCAL_FUNC(x)  PP_CAT2(sort_double_, x)
+#define LOCAL_IS_NATIVE
+#elif defined(DEFINE_sort_bytes)
+#define LOCAL_T        struct sort_bytes
+#define LOCAL_lo(a, b) sort_bytes_lo(&(a), &(b))
+#define LOCAL_FUNC(x)  PP_CAT2(sort_bytes_, x)
+#define LOCAL_IS_NATIVE
+#endif /* ... */
+
+#define LOCAL_state            LOCAL_FUNC(state)
+#define LOCAL_binarysort       LOCAL_FUNC(binarysort)
+#define LOCAL_count_run        LOCAL_FUNC(count_run)
+#define LOCAL_reverse          LOCAL_FUNC(reverse)
+#define LOCAL_gallop_left      LOCAL_FUNC(gallop_left)
+#define LOCAL_gallop_right     LOCAL_FUNC(gallop_right)
+#define LOCAL_merge_lo         LOCAL_FUNC(merge_lo)
+#define LOCAL_merge_hi         LOCAL_FUNC(merge_hi)
+#define LOCAL_merge_runs       LOCAL_FUNC(merge_runs)
+#define LOCAL_merge_at         LOCAL_FUNC(merge_at)
+#define LOCAL_merge_collapse   LOCAL_FUNC(merge_collapse)
+#define LOCAL_merge_force      LOCAL_FUNC(merge_force)
+#define LOCAL_timsort          LOCAL_FUNC(timsort)
+#define LOCAL_job              LOCAL_FUNC(job)
+
+struct LOCAL_state {
+	LOCAL_T *ms_temp;       /* [1..1] Merge buffer (with space for at least half of all elements) */
+	size_t   ms_min_gallop; /* Current threshold for entering galloping mode */
+	size_t   ms_pendc;      /* Number of pending runs */
+	struct {
+		LOCAL_T *r_base;    /* [1..r_len] Start of the run */
+		size_t   r_len;     /* Number of elements in the run */
+	} ms_pendv[SORT_MAX_PENDING];
+};
+
+/* Sort [lo,hi) via binary insertion, given that [lo,start) is already sorted. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
+LOCAL_binarysort(LOCAL_T *lo, LOCAL_T *hi, LOCAL_T *start) {
+	ASSERT(lo < start && start <= hi);
+	for (; start < hi; ++start) {
+		LOCAL_T pivot = *start;
+		LOCAL_T *l = lo;
+		LOCAL_T *r = start;
+		do {
+			int error;
+			LOCAL_T *p = l + ((size_t)(r - l) >> 1);
+			error = LOCAL_lo(pivot, *p);
+			if unlikely(error < 0)
+				goto err;
+			if (error) {
+				r = p;
+			} else {
+				l = p + 1;
+			}
+		} while (l < r);
+		memmoveupc(l + 1, l, (size_t)(start - l), sizeof(LOCAL_T));
+		*l = pivot;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Return the length of the run starting at `lo'
+ * @return: (size_t)-1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) size_t DCALL
+LOCAL_count_run(LOCAL_T *lo, LOCAL_T *hi, bool *__restrict p_descending) {
+	int error;
+	size_t result;
+	*p_descending = false;
+	ASSERT(lo < hi);
+	if (lo + 1 == hi)
+		return 1;
+	error = LOCAL_lo(lo[1], lo[0]);
+	if unlikely(error < 0)
+		goto err;
+	result = 2;
+	if (error) {
+		/* Strictly descending (must be strict to preserve stability). */
+		*p_descending = true;
+		for (lo += 2; lo < hi; ++lo, ++result) {
+			error = LOCAL_lo(lo[0], lo[-1]);
+			if unlikely(error < 0)
+				goto err;
+			if (!error)
+				break;
+		}
+	} else {
+		for (lo += 2; lo < hi; ++lo, ++result) {
+			error = LOCAL_lo(lo[0], lo[-1]);
+			if unlikely(error < 0)
+				goto err;
+			if (error)
+				break;
+		}
+	}
+	return result;
+err:
+	return (size_t)-1;
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+LOCAL_reverse(LOCAL_T *lo, LOCAL_T *hi) {
+	--hi;
+	while (lo < hi) {
+		LOCAL_T temp = *lo;
+		*lo++ = *hi;
+		*hi-- = temp;
+	}
+}
+
+/* Locate the proper position of `key' within the sorted vector `a...+=n',
+ * starting the search at `hint'. If `a' contains elements equal to `key',
+ * return the position left of the left-most equal element.
+ * @return: * : `a[return - 1] < key <= a[return]'
+ * @return: -1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+LOCAL_gallop_left(LOCAL_T const *key, LOCAL_T const *a,
+                  Dee_ssize_t n, Dee_ssize_t hint) {
+	int error;
+	Dee_ssize_t ofs, lastofs, k;
+	ASSERT(n > 0 && hint >= 0 && hint < n);
+	a += hint;
+	lastofs = 0;
+	ofs     = 1;
+	error   = LOCAL_lo(*a, *key);
+	if unlikely(error < 0)
+		goto err;
+	if (error) {
+		/* a[hint] < key -- gallop right, until `a[hint + lastofs] < key <= a[hint + ofs]' */
+		Dee_ssize_t const maxofs = n - hint;
+		while (ofs < maxofs) {
+			error = LOCAL_lo(a[ofs], *key);
+			if unlikely(error < 0)
+				goto err;
+			if (!error)
+				break;
+			lastofs = ofs;
+			ofs     = (ofs << 1) + 1;
+			if unlikely(ofs <= 0)
+				ofs = maxofs;
+		}
+		if (ofs > maxofs)
+			ofs = maxofs;
+		lastofs += hint;
+		ofs += hint;
+	} else {
+		/* key <= a[hint] -- gallop left, until `a[hint - ofs] < key <= a[hint - lastofs]' */
+		Dee_ssize_t const maxofs = hint + 1;
+		while (ofs < maxofs) {
+			error = LOCAL_lo(*(a - ofs), *key);
+			if unlikely(error < 0)
+				goto err;
+			if (error)
+				break;
+			lastofs = ofs;
+			ofs     = (ofs << 1) + 1;
+			if unlikely(ofs <= 0)
+				ofs = maxofs;
+		}
+		if (ofs > maxofs)
+			ofs = maxofs;
+		k       = lastofs;
+		lastofs = hint - ofs;
+		ofs     = hint - k;
+	}
+	a -= hint;
+	ASSERT(-1 <= lastofs && lastofs < ofs && ofs <= n);
+
+	/* Binary search with invariant `a[lastofs - 1] < key <= a[ofs]' */
+	++lastofs;
+	while (lastofs < ofs) {
+		Dee_ssize_t m = lastofs + ((ofs - lastofs) >> 1);
+		error = LOCAL_lo(a[m], *key);
+		if unlikely(error < 0)
+			goto err;
+		if (error) {
+			lastofs = m + 1;
+		} else {
+			ofs = m;
+		}
+	}
+	return ofs;
+err:
+	return -1;
+}
+
+/* Same as `LOCAL_gallop_left()', but if `a' contains elements equal
+ * to `key', return the position right of the right-most equal element.
+ * @return: * : `a[return - 1] <= key < a[return]'
+ * @return: -1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+LOCAL_gallop_right(LOCAL_T const *key, LOCAL_T const *a,
+                   Dee_ssize_t n, Dee_ssize_t hint) {
+	int error;
+	Dee_ssize_t ofs, lastofs, k;
+	ASSERT(n > 0 && hint >= 0 && hint < n);
+	a += hint;
+	lastofs = 0;
+	ofs     = 1;
+	error   = LOCAL_lo(*key, *a);
+	if unlikely(error < 0)
+		goto err;
+	if (error) {
+		/* key < a[hint] -- gallop left, until `a[hint - ofs] <= key < a[hint - lastofs]' */
+		Dee_ssize_t const maxofs = hint + 1;
+		while (ofs < maxofs) {
+			error = LOCAL_lo(*key, *(a - ofs));
+			if unlikely(error < 0)
+				goto err;
+			if (!error)
+				break;
+			lastofs = ofs;
+			ofs     = (ofs << 1) + 1;
+			if unlikely(ofs <= 0)
+				ofs = maxofs;
+		}
+		if (ofs > maxofs)
+			ofs = maxofs;
+		k       = lastofs;
+		lastofs = hint - ofs;
+		ofs     = hint - k;
+	} else {
+		/* a[hint] <= key -- gallop right, until `a[hint + lastofs] <= key < a[hint + ofs]' */
+		Dee_ssize_t const maxofs = n - hint;
+		while (ofs < maxofs) {
+			error = LOCAL_lo(*key, a[ofs]);
+			if unlikely(error < 0)
+				goto err;
+			if (error)
+				break;
+			lastofs = ofs;
+			ofs     = (ofs << 1) + 1;
+			if unlikely(ofs <= 0)
+				ofs = maxofs;
+		}
+		if (ofs > maxofs)
+			ofs = maxofs;
+		lastofs += hint;
+		ofs += hint;
+	}
+	a -= hint;
+	ASSERT(-1 <= lastofs && lastofs < ofs && ofs <= n);
+
+	/* Binary search with invariant `a[lastofs - 1] <= key < a[ofs]' */
+	++lastofs;
+	while (lastofs < ofs) {
+		Dee_ssize_t m = lastofs + ((ofs - lastofs) >> 1);
+		error = LOCAL_lo(*key, a[m]);
+		if unlikely(error < 0)
+			goto err;
+		if (error) {
+			ofs = m;
+		} else {
+			lastofs = m + 1;
+		}
+	}
+	return ofs;
+err:
+	return -1;
+}
+
+/* Merge the `na' elements at `pa' with the `nb' elements at `pb' (where `pa + na == pb'),
+ * given that `na <= nb', `pb[0] < pa[0]', and `pa[na - 1]' belongs at the end of the merge. */
+PRIVATE WUNUSED NONNULL((1, 2, 4)) int DCALL
+LOCAL_merge_lo(struct LOCAL_state *__restrict ms,
+               LOCAL_T *pa, Dee_ssize_t na,
+               LOCAL_T *pb, Dee_ssize_t nb) {
+	int error;
+	Dee_ssize_t k, min_gallop;
+	LOCAL_T *dst;
+	ASSERT(na > 0 && nb > 0 && pa + na == pb);
+	memcpyc(ms->ms_temp, pa, (size_t)na, sizeof(LOCAL_T));
+	dst = pa;
+	pa  = ms->ms_temp;
+	*dst++ = *pb++;
+	--nb;
+	if (nb == 0)
+		goto succeed;
+	if (na == 1)
+		goto copy_b;
+	min_gallop = (Dee_ssize_t)ms->ms_min_gallop;
+	for (;;) {
+		Dee_ssize_t acount = 0; /* # of times A won in a row */
+		Dee_ssize_t bcount = 0; /* # of times B won in a row */
+
+		/* Do the straightforward thing until (if ever) one run appears to win consistently. */
+		for (;;) {
+			ASSERT(na > 1 && nb > 0);
+			error = LOCAL_lo(*pb, *pa);
+			if unlikely(error < 0)
+				goto err;
+			if (error) {
+				*dst++ = *pb++;
+				++bcount;
+				acount = 0;
+				--nb;
+				if (nb == 0)
+					goto succeed;
+				if (bcount >= min_gallop)
+					break;
+			} else {
+				*dst++ = *pa++;
+				++acount;
+				bcount = 0;
+				--na;
+				if (na == 1)
+					goto copy_b;
+				if (acount >= min_gallop)
+					break;
+			}
+		}
+
+		/* One run is winning consistently: gallop until that stops being the case. */
+		++min_gallop;
+		do {
+			ASSERT(na > 1 && nb > 0);
+			min_gallop -= min_gallop > 1;
+			ms->ms_min_gallop = (size_t)min_gallop;
+			k = LOCAL_gallop_right(pb, pa, na, 0);
+			if unlikely(k < 0)
+				goto err;
+			acount = k;
+			if (k) {
+				memcpyc(dst, pa, (size_t)k, sizeof(LOCAL_T));
+				dst += k;
+				pa += k;
+				na -= k;
+				if (na == 1)
+					goto copy_b;
+				/* na == 0 is impossible for consistent comparators,
+				 * but user-defined compare operators can be anything. */
+				if (na == 0)
+					goto succeed;
+			}
+			*dst++ = *pb++;
+			--nb;
+			if (nb == 0)
+				goto succeed;
+
+			k = LOCAL_gallop_left(pa, pb, nb, 0);
+			if unlikely(k < 0)
+				goto err;
+			bcount = k;
+			if (k) {
+				memmovedownc(dst, pb, (size_t)k, sizeof(LOCAL_T));
+				dst += k;
+				pb += k;
+				nb -= k;
+				if (nb == 0)
+					goto succeed;
+			}
+			*dst++ = *pa++;
+			--na;
+			if (na == 1)
+				goto copy_b;
+		} while (acount >= SORT_MIN_GALLOP || bcount >= SORT_MIN_GALLOP);
+		++min_gallop; /* Penalize leaving galloping mode */
+		ms->ms_min_gallop = (size_t)min_gallop;
+	}
+succeed:
+	error = 0;
+done:
+	if (na)
+		memcpyc(dst, pa, (size_t)na, sizeof(LOCAL_T));
+	return error;
+err:
+	error = -1;
+	goto done;
+copy_b:
+	ASSERT(na == 1 && nb > 0);
+	/* The last element of `pa' belongs at the end of the merge. */
+	memmovedownc(dst, pb, (size_t)nb, sizeof(LOCAL_T));
+	dst[nb] = *pa;
+	return 0;
+}
+
+/* Same as `LOCAL_merge_lo()', but requires `na >= nb' and merges from the right. */
+PRIVATE WUNUSED NONNULL((1, 2, 4)) int DCALL
+LOCAL_merge_hi(struct LOCAL_state *__restrict ms,
+               LOCAL_T *pa, Dee_ssize_t na,
+               LOCAL_T *pb, Dee_ssize_t nb) {
+	int error;
+	Dee_ssize_t k, min_gallop;
+	LOCAL_T *dst;
+	LOCAL_T *basea;
+	LOCAL_T *baseb;
+	ASSERT(na > 0 && nb > 0 && pa + na == pb);
+	memcpyc(ms->ms_temp, pb, (size_t)nb, sizeof(LOCAL_T));
+	dst   = pb + nb - 1;
+	basea = pa;
+	baseb = ms->ms_temp;
+	pb    = baseb + nb - 1;
+	pa += na - 1;
+	*dst-- = *pa--;
+	--na;
+	if (na == 0)
+		goto succeed;
+	if (nb == 1)
+		goto copy_a;
+	min_gallop = (Dee_ssize_t)ms->ms_min_gallop;
+	for (;;) {
+		Dee_ssize_t acount = 0; /* # of times A won in a row */
+		Dee_ssize_t bcount = 0; /* # of times B won in a row */
+
+		/* Do the straightforward thing until (if ever) one run appears to win consistently. */
+		for (;;) {
+			ASSERT(na > 0 && nb > 1);
+			error = LOCAL_lo(*pb, *pa);
+			if unlikely(error < 0)
+				goto err;
+			if (error) {
+				*dst-- = *pa--;
+				++acount;
+				bcount = 0;
+				--na;
+				if (na == 0)
+					goto succeed;
+				if (acount >= min_gallop)
+					break;
+			} else {
+				*dst-- = *pb--;
+				++bcount;
+				acount = 0;
+				--nb;
+				if (nb == 1)
+					goto copy_a;
+				if (bcount >= min_gallop)
+					break;
+			}
+		}
+
+		/* One run is winning consistently: gallop until that stops being the case. */
+		++min_gallop;
+		do {
+			ASSERT(na > 0 && nb > 1);
+			min_gallop -= min_gallop > 1;
+			ms->ms_min_gallop = (size_t)min_gallop;
+			k = LOCAL_gallop_right(pb, basea, na, na - 1);
+			if unlikely(k < 0)
+				goto err;
+			k = na - k;
+			acount = k;
+			if (k) {
+				dst -= k;
+				pa -= k;
+				memmoveupc(dst + 1, pa + 1, (size_t)k, sizeof(LOCAL_T));
+				na -= k;
+				if (na == 0)
+					goto succeed;
+			}
+			*dst-- = *pb--;
+			--nb;
+			if (nb == 1)
+				goto copy_a;
+
+			k = LOCAL_gallop_left(pa, baseb, nb, nb - 1);
+			if unlikely(k < 0)
+				goto err;
+			k = nb - k;
+			bcount = k;
+			if (k) {
+				dst -= k;
+				pb -= k;
+				memcpyc(dst + 1, pb + 1, (size_t)k, sizeof(LOCAL_T));
+				nb -= k;
+				if (nb == 1)
+					goto copy_a;
+				/* nb == 0 is impossible for consistent comparators,
+				 * but user-defined compare operators can be anything. */
+				if (nb == 0)
+					goto succeed;
+			}
+			*dst-- = *pa--;
+			--na;
+			if (na == 0)
+				goto succeed;
+		} while (acount >= SORT_MIN_GALLOP || bcount >= SORT_MIN_GALLOP);
+		++min_gallop; /* Penalize leaving galloping mode */
+		ms->ms_min_gallop = (size_t)min_gallop;
+	}
+succeed:
+	error = 0;
+done:
+	if (nb)
+		memcpyc(dst - (nb - 1), baseb, (size_t)nb, sizeof(LOCAL_T));
+	return error;
+err:
+	error = -1;
+	goto done;
+copy_a:
+	ASSERT(nb == 1 && na > 0);
+	/* The first element of `pb' belongs at the front of the merge. */
+	memmoveupc(dst + 1 - na, pa + 1 - na, (size_t)na, sizeof(LOCAL_T));
+	dst -= na;
+	*dst = *pb;
+	return 0;
+}
+
+/* Merge the adjacent sorted runs `pa...+=na' and `pb...+=nb' */
+PRIVATE WUNUSED NONNULL((1, 2, 4)) int DCALL
+LOCAL_merge_runs(struct LOCAL_state *__restrict ms,
+                 LOCAL_T *pa, Dee_ssize_t na,
+                 LOCAL_T *pb, Dee_ssize_t nb) {
+	Dee_ssize_t k;
+	ASSERT(na > 0 && nb > 0 && pa + na == pb);
+
+	/* Elements of `a' that are already in place can be skipped. */
+	k = LOCAL_gallop_right(pb, pa, na, 0);
+	if unlikely(k < 0)
+		goto err;
+	pa += k;
+	na -= k;
+	if (na == 0)
+		return 0;
+
+	/* Elements of `b' that are already in place can be skipped. */
+	nb = LOCAL_gallop_left(&pa[na - 1], pb, nb, nb - 1);
+	if (nb <= 0)
+		return (int)nb;
+	if (na <= nb)
+		return LOCAL_merge_lo(ms, pa, na, pb, nb);
+	return LOCAL_merge_hi(ms, pa, na, pb, nb);
+err:
+	return -1;
+}
+
+/* Merge the pending runs `i' and `i + 1' */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+LOCAL_merge_at(struct LOCAL_state *__restrict ms, size_t i) {
+	LOCAL_T *pa;
+	LOCAL_T *pb;
+	size_t na, nb;
+	ASSERT(ms->ms_pendc >= 2);
+	ASSERT(i == ms->ms_pendc - 2 || i == ms->ms_pendc - 3);
+	pa = ms->ms_pendv[i].r_base;
+	na = ms->ms_pendv[i].r_len;
+	pb = ms->ms_pendv[i + 1].r_base;
+	nb = ms->ms_pendv[i + 1].r_len;
+	ms->ms_pendv[i].r_len = na + nb;
+	if (i == ms->ms_pendc - 3)
+		ms->ms_pendv[i + 1] = ms->ms_pendv[i + 2];
+	--ms->ms_pendc;
+	return LOCAL_merge_runs(ms, pa, (Dee_ssize_t)na, pb, (Dee_ssize_t)nb);
+}
+
+/* Merge pending runs until the stack invariants are re-established:
+ * >> pendv[n - 2].r_len > pendv[n - 1].r_len + pendv[n].r_len
+ * >> pendv[n - 1].r_len > pendv[n].r_len */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+LOCAL_merge_collapse(struct LOCAL_state *__restrict ms) {
+	while (ms->ms_pendc > 1) {
+		size_t n = ms->ms_pendc - 2;
+		if ((n > 0 && ms->ms_pendv[n - 1].r_len <= ms->ms_pendv[n].r_len + ms->ms_pendv[n + 1].r_len) ||
+		    (n > 1 && ms->ms_pendv[n - 2].r_len <= ms->ms_pendv[n - 1].r_len + ms->ms_pendv[n].r_len)) {
+			if (ms->ms_pendv[n - 1].r_len < ms->ms_pendv[n + 1].r_len)
+				--n;
+		} else if (ms->ms_pendv[n].r_len > ms->ms_pendv[n + 1].r_len) {
+			break;
+		}
+		if unlikely(LOCAL_merge_at(ms, n))
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Merge all remaining pending runs. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+LOCAL_merge_force(struct LOCAL_state *__restrict ms) {
+	while (ms->ms_pendc > 1) {
+		size_t n = ms->ms_pendc - 2;
+		if (n > 0 && ms->ms_pendv[n - 1].r_len < ms->ms_pendv[n + 1].r_len)
+			--n;
+		if unlikely(LOCAL_merge_at(ms, n))
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Stable-sort `vec...+=count' in-place.
+ * @param: temp: Scratch buffer with space for at least `count / 2' elements.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown (`vec' is still a permutation of its original elements). */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+LOCAL_timsort(LOCAL_T *vec, size_t count, LOCAL_T *temp) {
+	struct LOCAL_state ms;
+	LOCAL_T *lo;
+	LOCAL_T *hi;
+	size_t minrun;
+	if (count < 2)
+		return 0;
+	ms.ms_temp       = temp;
+	ms.ms_min_gallop = SORT_MIN_GALLOP;
+	ms.ms_pendc      = 0;
+	lo     = vec;
+	hi     = vec + count;
+	minrun = sort_compute_minrun(count);
+	do {
+		bool descending;
+		size_t n = LOCAL_count_run(lo, hi, &descending);
+		if unlikely(n == (size_t)-1)
+			goto err;
+		if (descending)
+			LOCAL_reverse(lo, lo + n);
+
+		/* Extend short runs to `minrun' elements. */
+		if (n < minrun) {
+			size_t force = (size_t)(hi - lo);
+			if (force > minrun)
+				force = minrun;
+			if unlikely(LOCAL_binarysort(lo, lo + force, lo + n))
+				goto err;
+			n = force;
+		}
+		ASSERT(ms.ms_pendc < SORT_MAX_PENDING);
+		ms.ms_pendv[ms.ms_pendc].r_base = lo;
+		ms.ms_pendv[ms.ms_pendc].r_len  = n;
+		++ms.ms_pendc;
+		if unlikely(LOCAL_merge_collapse(&ms))
+			goto err;
+		lo += n;
+	} while (lo < hi);
+	if unlikely(LOCAL_merge_force(&ms))
+		goto err;
+	ASSERT(ms.ms_pendc == 1);
+	ASSERT(ms.ms_pendv[0].r_base == vec);
+	ASSERT(ms.ms_pendv[0].r_len == count);
+	return 0;
+err:
+	return -1;
+}
+
+#if defined(LOCAL_IS_NATIVE) && defined(SORT_HAVE_PARALLEL)
+/* Run task number `index' of `self' (s.a. `sort_parallel()')
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+LOCAL_job(struct sort_job *__restrict self, size_t index,
+          size_t UNUSED(start), size_t UNUSED(end)) {
+	struct sort_task *task = &self->sj_tasks[index];
+	LOCAL_T *base = (LOCAL_T *)task->st_base;
+	LOCAL_T *temp = (LOCAL_T *)task->st_temp;
+	if (task->st_nb == 0) {
+		return LOCAL_timsort(base, task->st_na, temp);
+	} else {
+		struct LOCAL_state ms;
+		ms.ms_temp       = temp;
+		ms.ms_min_gallop = SORT_MIN_GALLOP;
+		ms.ms_pendc      = 0;
+		return LOCAL_merge_runs(&ms, base, (Dee_ssize_t)task->st_na,
+		                        base + task->st_na, (Dee_ssize_t)task->st_nb);
+	}
+}
+#endif /* LOCAL_IS_NATIVE && SORT_HAVE_PARALLEL */
+
+#undef LOCAL_state
+#undef LOCAL_binarysort
+#undef LOCAL_count_run
+#undef LOCAL_reverse
+#undef LOCAL_gallop_left
+#undef LOCAL_gallop_right
+#undef LOCAL_merge_lo
+#undef LOCAL_merge_hi
+#undef LOCAL_merge_runs
+#undef LOCAL_merge_at
+#undef LOCAL_merge_collapse
+#undef LOCAL_merge_force
+#undef LOCAL_timsort
+#undef LOCAL_job
+#undef LOCAL_IS_NATIVE
+#undef LOCAL_FUNC
+#undef LOCAL_lo
+#undef LOCAL_T
+
+DECL_END
+
+#undef DEFINE_sort_object
+#undef DEFINE_sort_keyed
+#undef DEFINE_sort_int64
+#undef DEFINE_sort_double
+#undef DEFINE_sort_bytes
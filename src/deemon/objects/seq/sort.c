@@ -23,87 +23,214 @@
 #include <deemon/alloc.h>
 #include <deemon/api.h>
 #include <deemon/error.h>
+#include <deemon/float.h>
+#include <deemon/int.h>
 #include <deemon/object.h>
 #include <deemon/seq.h>
+#include <deemon/string.h>
 #include <deemon/system-features.h>
+#include <deemon/util/workerpool.h>
+
+#include <hybrid/minmax.h>
+
+#include <stdint.h> /* int64_t, uint8_t */
 
 DECL_BEGIN
 
-PRIVATE WUNUSED int DCALL
-mergesort_impl(DREF DeeObject **__restrict dst,
-               DeeObject **__restrict temp,
-               DREF DeeObject *const *__restrict src,
-               size_t objc) {
-	int error;
-	switch (objc) {
+/* Max # of pending runs (enough for 2**64 elements) */
+#define SORT_MAX_PENDING 85
 
-	case 0:
-		break;
+/* Initial threshold for entering galloping mode during merges. */
+#define SORT_MIN_GALLOP 7
 
-	case 1:
-		dst[0] = src[0];
-		break;
+/* Compute the minimum run length for a vector of `n' elements, such
+ * that `n / minrun' is equal to, or slightly less than, a power of 2. */
+PRIVATE ATTR_CONST WUNUSED size_t DCALL
+sort_compute_minrun(size_t n) {
+	size_t r = 0;
+	while (n >= 64) {
+		r |= n & 1;
+		n >>= 1;
+	}
+	return n + r;
+}
 
-	case 2:
-		error = DeeObject_CompareLo(src[0], src[1]);
-		if unlikely(error < 0 &&
-		            !DeeError_Catch(&DeeError_TypeError) &&
-		            !DeeError_Catch(&DeeError_NotImplemented))
-			goto err;
-		if (error <= 0) {
-			dst[0] = src[1];
-			dst[1] = src[0];
-		} else {
-			dst[0] = src[0];
-			dst[1] = src[1];
-		}
-		break;
+/* Compare objects for sorting. Objects that cannot be compared are
+ * treated as "not less", meaning that their relative order is kept.
+ * @return: 1:  `a < b'
+ * @return: 0:  `!(a < b)'
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+sort_object_lo(DeeObject *a, DeeObject *b) {
+	int result = DeeObject_CompareLo(a, b);
+	if unlikely(result < 0) {
+		if (DeeError_Catch(&DeeError_TypeError) ||
+		    DeeError_Catch(&DeeError_NotImplemented))
+			result = 0;
+	}
+	return result;
+}
+
+/* Decorated sort elements (key + value) */
+struct sort_keyed {
+	DREF DeeObject *sk_key;   /* [1..1] Result of `key(sk_value)' */
+	DeeObject      *sk_value; /* [1..1] The object being sorted */
+};
+
+struct sort_int64 {
+	int64_t    i64_key;   /* Value of an `int' that fits into 64 bits */
+	DeeObject *i64_value; /* [1..1] The object being sorted */
+};
+
+struct sort_double {
+	double     sd_key;   /* Value of a `float' */
+	DeeObject *sd_value; /* [1..1] The object being sorted */
+};
+
+struct sort_bytes {
+	uint8_t const *sb_str;   /* [0..sb_len] Characters of a single-byte `string' */
+	size_t         sb_len;   /* Length of `sb_str' */
+	DeeObject     *sb_value; /* [1..1] The object being sorted */
+};
+
+/* Same as `compare_strings(a, b) < 0' for single-byte strings. */
+PRIVATE ATTR_PURE WUNUSED NONNULL((1, 2)) int DCALL
+sort_bytes_lo(struct sort_bytes const *a, struct sort_bytes const *b) {
+	int diff = memcmp(a->sb_str, b->sb_str, MIN(a->sb_len, b->sb_len));
+	if (diff != 0)
+		return diff < 0;
+	return a->sb_len < b->sb_len;
+}
 
-	default: {
-		size_t s1, s2;
-		DeeObject **iter1;
-		DeeObject **iter2;
-		s1    = objc / 2;
-		s2    = objc - s1;
-		error = mergesort_impl(temp, dst, src, s1);
-		if unlikely(error < 0)
-			goto err;
-		error = mergesort_impl(temp + s1, dst + s1, src + s1, s2);
-		if unlikely(error < 0)
-			goto err;
-		iter1 = temp;
-		iter2 = temp + s1;
-		while (s1 && s2) {
-			error = DeeObject_CompareLo(*iter1, *iter2);
-			if unlikely(error < 0) {
-				if (!DeeError_Catch(&DeeError_TypeError) &&
-				    !DeeError_Catch(&DeeError_NotImplemented))
-					goto err;
-			}
-			if (error <= 0) {
-				*dst++ = *iter2++;
-				--s2;
-			} else {
-				*dst++ = *iter1++;
-				--s1;
-			}
-		}
-		if (s1) {
-			ASSERT(!s2);
-			memcpyc(dst, iter1, s1,
-			        sizeof(DREF DeeObject *));
-		} else if (s2) {
-			memcpyc(dst, iter2, s2,
-			        sizeof(DREF DeeObject *));
-		}
-	}	break;
 
+/* Large vectors of native keys (which can be compared without having to
+ * invoke any user-code) are sorted in parallel (using the parallel-job
+ * worker pool that is also used by `Sequence.parallel') */
+#ifndef CONFIG_NO_THREADS
+#define SORT_HAVE_PARALLEL
+
+/* Min # of elements before parallel sorting is considered */
+#ifndef SORT_PARALLEL_THRESHOLD
+#define SORT_PARALLEL_THRESHOLD 65536
+#endif /* !SORT_PARALLEL_THRESHOLD */
+
+/* Min # of elements per parallel chunk */
+#ifndef SORT_PARALLEL_MINCHUNK
+#define SORT_PARALLEL_MINCHUNK 16384
+#endif /* !SORT_PARALLEL_MINCHUNK */
+
+/* Max # of parallel chunks */
+#ifndef SORT_PARALLEL_MAXCHUNKS
+#define SORT_PARALLEL_MAXCHUNKS 8
+#endif /* !SORT_PARALLEL_MAXCHUNKS */
+
+struct sort_task {
+	void  *st_base; /* [1..1] Base of elements */
+	size_t st_na;   /* # of elements to sort (or # of elements in first run when `st_nb != 0') */
+	size_t st_nb;   /* # of elements in second run (or `0' when `st_na' elements should be sorted) */
+	void  *st_temp; /* [1..1] Scratch buffer */
+};
+
+struct sort_job {
+	struct Dee_parallel_job sj_job;                            /* Underlying job (1 task per chunk) */
+	struct sort_task        sj_tasks[SORT_PARALLEL_MAXCHUNKS]; /* Tasks being run */
+};
+
+typedef WUNUSED_T NONNULL_T((1)) int
+(DCALL *sort_task_t)(struct sort_job *__restrict self, size_t index,
+                     size_t start, size_t end);
+
+/* Run the first `count' tasks of `self' in parallel, and wait for them to complete.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+sort_job_exec(struct sort_job *__restrict self,
+              sort_task_t func, size_t count) {
+	Dee_parallel_job_init(&self->sj_job,
+	                      (WUNUSED_T NONNULL_T((1)) int (DCALL *)(struct Dee_parallel_job *__restrict,
+	                                                              size_t, size_t, size_t))func,
+	                      count, 1);
+	return Dee_parallel_job_exec(&self->sj_job);
+}
+
+/* Return the # of chunks to use when sorting `n' native elements (`1' for sequential) */
+PRIVATE WUNUSED size_t DCALL
+sort_parallel_chunks(size_t n) {
+	size_t ncpu, result;
+	if (n < SORT_PARALLEL_THRESHOLD)
+		return 1;
+	ncpu = Dee_parallel_getworkers() + 1;
+	if (ncpu <= 1)
+		return 1;
+	result = n / SORT_PARALLEL_MINCHUNK;
+	if (result > ncpu)
+		result = ncpu;
+	if (result > SORT_PARALLEL_MAXCHUNKS)
+		result = SORT_PARALLEL_MAXCHUNKS;
+	return result;
+}
+
+/* Sort `base...+=n' by sorting `nchunks' chunks in parallel, and then merging them
+ * pair-wise (again in parallel). `temp' must have space for `n' elements.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 4, 5)) int DCALL
+sort_parallel(void *base, size_t n, size_t elemsize,
+              void *temp, sort_task_t func, size_t nchunks) {
+	struct sort_job job;
+	size_t bounds[SORT_PARALLEL_MAXCHUNKS + 1];
+	size_t i, count, width;
+	ASSERT(nchunks >= 2 && nchunks <= SORT_PARALLEL_MAXCHUNKS);
+	for (i = 0; i <= nchunks; ++i)
+		bounds[i] = (n * i) / nchunks;
+
+	/* Sort individual chunks. */
+	for (i = 0; i < nchunks; ++i) {
+		job.sj_tasks[i].st_base = (uint8_t *)base + bounds[i] * elemsize;
+		job.sj_tasks[i].st_na   = bounds[i + 1] - bounds[i];
+		job.sj_tasks[i].st_nb   = 0;
+		job.sj_tasks[i].st_temp = (uint8_t *)temp + bounds[i] * elemsize;
+	}
+	if unlikely(sort_job_exec(&job, func, nchunks))
+		goto err;
+
+	/* Merge chunks pair-wise. */
+	for (width = 1; width < nchunks; width *= 2) {
+		count = 0;
+		for (i = 0; i + width < nchunks; i += 2 * width) {
+			size_t mid = bounds[i + width];
+			size_t end = bounds[MIN(i + 2 * width, nchunks)];
+			job.sj_tasks[count].st_base = (uint8_t *)base + bounds[i] * elemsize;
+			job.sj_tasks[count].st_na   = mid - bounds[i];
+			job.sj_tasks[count].st_nb   = end - mid;
+			job.sj_tasks[count].st_temp = (uint8_t *)temp + bounds[i] * elemsize;
+			++count;
+		}
+		if unlikely(sort_job_exec(&job, func, count))
+			goto err;
 	}
 	return 0;
 err:
 	return -1;
 }
+#endif /* !CONFIG_NO_THREADS */
+
+DECL_END
+
+#ifndef __INTELLISENSE__
+#define DEFINE_sort_object
+#include "sort-impl.c.inl"
+#define DEFINE_sort_keyed
+#include "sort-impl.c.inl"
+#define DEFINE_sort_int64
+#include "sort-impl.c.inl"
+#define DEFINE_sort_double
+#include "sort-impl.c.inl"
+#define DEFINE_sort_bytes
+#include "sort-impl.c.inl"
+#endif /* !__INTELLISENSE__ */
 
+DECL_BEGIN
 
 PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
 compare_lo(DeeObject *lhs, DeeObject *rhs, DeeObject *key) {
@@ -124,83 +251,6 @@ err:
 	return -1;
 }
 
-PRIVATE WUNUSED NONNULL((5)) int DCALL
-mergesort_impl_p(DREF DeeObject **__restrict dst,
-                 DeeObject **__restrict temp,
-                 DREF DeeObject *const *__restrict src,
-                 size_t objc,
-                 DeeObject *key) {
-	int error;
-	switch (objc) {
-
-	case 0:
-		break;
-
-	case 1:
-		dst[0] = src[0];
-		break;
-
-	case 2:
-		error = compare_lo(src[0], src[1], key);
-		if (error <= 0) {
-			if unlikely(error < 0 &&
-			            !DeeError_Catch(&DeeError_TypeError) &&
-			            !DeeError_Catch(&DeeError_NotImplemented))
-				goto err;
-			dst[0] = src[1];
-			dst[1] = src[0];
-		} else {
-			dst[0] = src[0];
-			dst[1] = src[1];
-		}
-		break;
-
-	default: {
-		size_t s1, s2;
-		DeeObject *const *iter1;
-		DeeObject *const *iter2;
-		s1    = objc / 2;
-		s2    = objc - s1;
-		error = mergesort_impl_p(temp, dst, src, s1, key);
-		if unlikely(error < 0)
-			goto err;
-		error = mergesort_impl_p(temp + s1, dst + s1, src + s1, s2, key);
-		if unlikely(error < 0)
-			goto err;
-		iter1 = temp;
-		iter2 = temp + s1;
-		while (s1 && s2) {
-			error = compare_lo(*iter1, *iter2, key);
-			if (error <= 0) {
-				if unlikely(error < 0 &&
-				            !DeeError_Catch(&DeeError_TypeError) &&
-				            !DeeError_Catch(&DeeError_NotImplemented))
-					goto err;
-				*dst++ = *iter2++;
-				--s2;
-			} else {
-				*dst++ = *iter1++;
-				--s1;
-			}
-		}
-		if (s1) {
-			ASSERT(!s2);
-			memcpyc(dst, iter1, s1,
-			        sizeof(DREF DeeObject *));
-		} else if (s2) {
-			memcpyc(dst, iter2, s2,
-			        sizeof(DREF DeeObject *));
-		}
-	}	break;
-
-	}
-	return 0;
-err:
-	return -1;
-}
-
-
-
 PRIVATE WUNUSED int DCALL
 insertsort_impl(DREF DeeObject **__restrict dst,
                 DREF DeeObject *const *__restrict src,
@@ -255,66 +305,172 @@ err:
 	return -1;
 }
 
-
+#ifdef SORT_HAVE_PARALLEL
+#define SORT_NATIVE_TEMPSIZE(n, nchunks) ((nchunks) > 1 ? (n) : (n) / 2)
+#define SORT_NATIVE_SORT(T, func, vec, n, nchunks)                         \
+	((nchunks) > 1 ? sort_parallel(vec, n, sizeof(T), (vec) + (n),         \
+	                               &PP_CAT2(func, job), nchunks)           \
+	               : PP_CAT2(func, timsort)(vec, n, (vec) + (n)))
+#else /* SORT_HAVE_PARALLEL */
+#define sort_parallel_chunks(n) 1
+#define SORT_NATIVE_TEMPSIZE(n, nchunks) ((void)(nchunks), (n) / 2)
+#define SORT_NATIVE_SORT(T, func, vec, n, nchunks) \
+	PP_CAT2(func, timsort)(vec, n, (vec) + (n))
+#endif /* !SORT_HAVE_PARALLEL */
+
+/* Try to sort `values' using native keys (`keys[i]' being the sort key of `values[i]')
+ * This is possible when all keys are `int' (that fit into 64 bits), all keys are `float',
+ * or all keys are single-byte `string' objects. Comparing native keys is equivalent to
+ * the respective compare operators, but doesn't require any callbacks or allocations.
+ * @return: 1 : Native sorting isn't possible (or memory is tight)
+ * @return: 0 : Success (sorted objects were written to `dst')
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
+sort_native(DREF DeeObject **__restrict dst,
+            DeeObject *const *keys,
+            DeeObject *const *values,
+            size_t objc) {
+	size_t i, nchunks;
+	void *buf;
+	DeeTypeObject *tp = Dee_TYPE(keys[0]);
+	nchunks = sort_parallel_chunks(objc);
+	if (tp == &DeeInt_Type) {
+		struct sort_int64 *vec;
+		buf = Dee_TryMallocc(objc + SORT_NATIVE_TEMPSIZE(objc, nchunks),
+		                     sizeof(struct sort_int64));
+		if unlikely(!buf)
+			goto nope;
+		vec = (struct sort_int64 *)buf;
+		for (i = 0; i < objc; ++i) {
+			if (!DeeInt_CheckExact(keys[i]) ||
+			    !DeeInt_TryAsInt64(keys[i], &vec[i].i64_key))
+				goto nope_vec;
+			vec[i].i64_value = values[i];
+		}
+		if unlikely(SORT_NATIVE_SORT(struct sort_int64, sort_int64_, vec, objc, nchunks))
+			goto err_vec;
+		for (i = 0; i < objc; ++i)
+			dst[i] = vec[i].i64_value;
+		Dee_Free(buf);
+	} else if (tp == &DeeFloat_Type) {
+		struct sort_double *vec;
+		buf = Dee_TryMallocc(objc + SORT_NATIVE_TEMPSIZE(objc, nchunks),
+		                     sizeof(struct sort_double));
+		if unlikely(!buf)
+			goto nope;
+		vec = (struct sort_double *)buf;
+		for (i = 0; i < objc; ++i) {
+			if (!DeeFloat_CheckExact(keys[i]))
+				goto nope_vec;
+			vec[i].sd_key   = DeeFloat_VALUE(keys[i]);
+			vec[i].sd_value = values[i];
+		}
+		if unlikely(SORT_NATIVE_SORT(struct sort_double, sort_double_, vec, objc, nchunks))
+			goto err_vec;
+		for (i = 0; i < objc; ++i)
+			dst[i] = vec[i].sd_value;
+		Dee_Free(buf);
+	} else if (tp == &DeeString_Type) {
+		struct sort_bytes *vec;
+		buf = Dee_TryMallocc(objc + SORT_NATIVE_TEMPSIZE(objc, nchunks),
+		                     sizeof(struct sort_bytes));
+		if unlikely(!buf)
+			goto nope;
+		vec = (struct sort_bytes *)buf;
+		for (i = 0; i < objc; ++i) {
+			DeeStringObject *str = (DeeStringObject *)keys[i];
+			if (!DeeString_CheckExact(str))
+				goto nope_vec;
+			if (str->s_data && str->s_data->u_width != STRING_WIDTH_1BYTE)
+				goto nope_vec;
+			vec[i].sb_str   = (uint8_t const *)DeeString_STR(str);
+			vec[i].sb_len   = DeeString_SIZE(str);
+			vec[i].sb_value = values[i];
+		}
+		if unlikely(SORT_NATIVE_SORT(struct sort_bytes, sort_bytes_, vec, objc, nchunks))
+			goto err_vec;
+		for (i = 0; i < objc; ++i)
+			dst[i] = vec[i].sb_value;
+		Dee_Free(buf);
+	} else {
+		goto nope;
+	}
+	return 0;
+nope_vec:
+	Dee_Free(buf);
+nope:
+	return 1;
+err_vec:
+	Dee_Free(buf);
+	return -1;
+}
 
 INTERN WUNUSED int DCALL
 DeeSeq_MergeSort(DREF DeeObject **__restrict dst,
                  DREF DeeObject *const *__restrict src,
                  size_t objc, DeeObject *key) {
-	int result = 0;
+	int result;
+	size_t i;
+	DREF DeeObject **keys;
 	ASSERT(dst != src);
-	switch (objc) {
-
-	case 0:
-		break;
-
-	case 1:
-		dst[0] = src[0];
-		break;
-
-	case 2: {
-		int temp;
-		/* Optimization for sorting 2 objects. */
-		temp = key
-		       ? compare_lo(src[0], src[1], key)
-		       : DeeObject_CompareLo(src[0], src[1]);
-		if (temp <= 0) {
-			if unlikely(temp < 0 &&
-			            !DeeError_Catch(&DeeError_TypeError) &&
-			            !DeeError_Catch(&DeeError_NotImplemented))
-				goto err;
-			dst[0] = src[1];
-			dst[1] = src[0];
-		} else {
-			dst[0] = src[0];
-			dst[1] = src[1];
-		}
-	}	break;
-
-	default: {
+	if (objc < 2) {
+		memcpyc(dst, src, objc, sizeof(DREF DeeObject *));
+		return 0;
+	}
+	if (!key) {
 		DeeObject **temp;
-		/* Default case: Do an actual merge-sort. */
-		temp = (DeeObject **)Dee_TryMallocc(objc, sizeof(DeeObject *));
+		result = sort_native(dst, src, src, objc);
+		if (result <= 0)
+			return result;
+		temp = (DeeObject **)Dee_TryMallocc(objc / 2, sizeof(DeeObject *));
 		if unlikely(!temp) {
 			/* Use a fallback sorting function */
-			result = key
-			         ? insertsort_impl_p(dst, src, objc, key)
-			         : insertsort_impl(dst, src, objc);
-		} else {
-			result = key
-			         ? mergesort_impl_p(dst, temp, src, objc, key)
-			         : mergesort_impl(dst, temp, src, objc);
-			Dee_Free(temp);
+			return insertsort_impl(dst, src, objc);
 		}
-	}	break;
+		memcpyc(dst, src, objc, sizeof(DREF DeeObject *));
+		result = sort_object_timsort(dst, objc, temp);
+		Dee_Free(temp);
+	} else {
+		struct sort_keyed *vec;
+		keys = (DREF DeeObject **)Dee_TryMallocc(objc, sizeof(DREF DeeObject *));
+		if unlikely(!keys)
+			goto fallback_keyed;
+		for (i = 0; i < objc; ++i) {
+			keys[i] = DeeObject_Call(key, 1, (DeeObject **)&src[i]);
+			if unlikely(!keys[i])
+				goto err_keys_i;
+		}
+		result = sort_native(dst, keys, src, objc);
+		if (result > 0) {
+			vec = (struct sort_keyed *)Dee_TryMallocc(objc + objc / 2,
+			                                          sizeof(struct sort_keyed));
+			if unlikely(!vec) {
+				Dee_Decrefv(keys, objc);
+				Dee_Free(keys);
+				goto fallback_keyed;
+			}
+			for (i = 0; i < objc; ++i) {
+				vec[i].sk_key   = keys[i];
+				vec[i].sk_value = src[i];
+			}
+			result = sort_keyed_timsort(vec, objc, vec + objc);
+			for (i = 0; i < objc; ++i)
+				dst[i] = vec[i].sk_value;
+			Dee_Free(vec);
+		}
+		Dee_Decrefv(keys, objc);
+		Dee_Free(keys);
 	}
 	return result;
-err:
+fallback_keyed:
+	/* Use a fallback sorting function */
+	return insertsort_impl_p(dst, src, objc, key);
+err_keys_i:
+	Dee_Decrefv(keys, i);
+	Dee_Free(keys);
 	return -1;
 }
 
-
-
 INTERN WUNUSED int DCALL
 DeeSeq_InsertionSort(DREF DeeObject **__restrict dst,
                      DREF DeeObject *const *__restrict src,
@@ -1456,6 +1456,27 @@ PRIVATE struct type_nsi tpconst svec_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+svec_foreach(SharedVector *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	SharedVector_LockRead(self);
+	for (i = 0; i < self->sv_length; ++i) {
+		DREF DeeObject *elem;
+		elem = self->sv_vector[i];
+		Dee_Incref(elem);
+		SharedVector_LockEndRead(self);
+		temp = (*proc)(arg, elem);
+		Dee_Decref_unlikely(elem);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+		SharedVector_LockRead(self);
+	}
+	SharedVector_LockEndRead(self);
+	return result;
+}
+
 PRIVATE struct type_seq svec_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&svec_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&svec_size,
@@ -1467,6 +1488,8 @@ PRIVATE struct type_seq svec_seq = {
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
 	/* .tp_nsi       = */ &svec_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&svec_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE struct type_getset tpconst svec_getsets[] = {
@@ -1540,7 +1563,7 @@ INTERN DeeTypeObject SharedVector_Type = {
 	/* .tp_doc      = */ NULL,
 	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
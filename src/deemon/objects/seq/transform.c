@@ -373,6 +373,35 @@ PRIVATE struct type_nsi tpconst trans_nsi = {
 	}
 };
 
+struct trans_foreach_data {
+	DeeObject    *tfd_fun;  /* [1..1] The function used for transforming. */
+	Dee_foreach_t tfd_proc; /* [1..1] Callback for transformed elements. */
+	void         *tfd_arg;  /* [?..?] Cookie for `tfd_proc' */
+};
+
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+trans_foreach_cb(void *arg, DeeObject *elem) {
+	dssize_t result;
+	struct trans_foreach_data *data = (struct trans_foreach_data *)arg;
+	elem = DeeObject_Call(data->tfd_fun, 1, &elem);
+	if unlikely(!elem)
+		goto err;
+	result = (*data->tfd_proc)(data->tfd_arg, elem);
+	Dee_Decref(elem);
+	return result;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+trans_foreach(Transformation *self, Dee_foreach_t proc, void *arg) {
+	struct trans_foreach_data data;
+	data.tfd_fun  = self->t_fun;
+	data.tfd_proc = proc;
+	data.tfd_arg  = arg;
+	return DeeObject_Foreach(self->t_seq, &trans_foreach_cb, &data);
+}
+
 PRIVATE struct type_seq trans_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&trans_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&trans_size,
@@ -383,7 +412,9 @@ PRIVATE struct type_seq trans_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&trans_getrange,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &trans_nsi
+	/* .tp_nsi       = */ &trans_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&trans_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE WUNUSED NONNULL((1)) int DCALL
@@ -439,7 +470,7 @@ INTERN DeeTypeObject SeqTransformation_Type = {
 	/* .tp_doc      = */ DOC("(seq:?DSequence,fun:?DCallable)"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
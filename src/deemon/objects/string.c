@@ -1351,6 +1351,44 @@ PRIVATE struct type_nsi tpconst string_nsi = {
 	}
 };
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+string_foreach(String *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	union dcharptr str;
+	size_t i, len;
+	int width = DeeString_WIDTH(self);
+	str.ptr = DeeString_WSTR(self);
+	len     = WSTR_LENGTH(str.ptr);
+	for (i = 0; i < len; ++i) {
+		DREF DeeObject *ch;
+		SWITCH_SIZEOF_WIDTH(width) {
+
+		CASE_WIDTH_1BYTE:
+			ch = DeeString_Chr(str.cp8[i]);
+			break;
+
+		CASE_WIDTH_2BYTE:
+			ch = DeeString_Chr(str.cp16[i]);
+			break;
+
+		CASE_WIDTH_4BYTE:
+			ch = DeeString_Chr(str.cp32[i]);
+			break;
+
+		}
+		if unlikely(!ch)
+			goto err;
+		temp = (*proc)(arg, ch);
+		Dee_Decref(ch);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+	}
+	return result;
+err:
+	return -1;
+}
+
 PRIVATE struct type_seq string_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&string_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&string_size,
@@ -1361,7 +1399,9 @@ PRIVATE struct type_seq string_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&string_range_get,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &string_nsi
+	/* .tp_nsi       = */ &string_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&string_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE struct type_member tpconst string_class_members[] = {
@@ -1821,7 +1861,7 @@ PUBLIC DeeTypeObject DeeString_Type = {
 	                         "}"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FVARIABLE | TP_FNAMEOBJECT | TP_FFINAL,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
@@ -1094,15 +1094,9 @@ err:
 
 
 /*  ====== `Tuple.Iterator' type implementation ======  */
-typedef struct {
-	OBJECT_HEAD
-	DREF Tuple  *ti_tuple; /* [1..1][const] Referenced tuple. */
-	DWEAK size_t ti_index; /* [<= ti_tuple->t_size] Next-element index. */
-} TupleIterator;
+typedef DeeTupleIteratorObject TupleIterator;
 #define READ_INDEX(x) atomic_read(&(x)->ti_index)
 
-INTDEF DeeTypeObject DeeTupleIterator_Type;
-
 PRIVATE NONNULL((1)) int DCALL
 tuple_iterator_ctor(TupleIterator *__restrict self) {
 	self->ti_tuple = (DREF Tuple *)Dee_EmptyTuple;
@@ -1612,6 +1606,19 @@ PRIVATE struct type_nsi tpconst tuple_nsi = {
 };
 
 
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+tuple_foreach(Tuple *self, Dee_foreach_t proc, void *arg) {
+	dssize_t temp, result = 0;
+	size_t i;
+	for (i = 0; i < self->t_size; ++i) {
+		temp = (*proc)(arg, self->t_elem[i]);
+		if unlikely(temp < 0)
+			return temp;
+		result += temp;
+	}
+	return result;
+}
+
 PRIVATE struct type_seq tuple_seq = {
 	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&tuple_iter,
 	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&tuple_size,
@@ -1622,7 +1629,9 @@ PRIVATE struct type_seq tuple_seq = {
 	/* .tp_range_get = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *, DeeObject *))&tuple_getrange,
 	/* .tp_range_del = */ NULL,
 	/* .tp_range_set = */ NULL,
-	/* .tp_nsi       = */ &tuple_nsi
+	/* .tp_nsi       = */ &tuple_nsi,
+	/* .tp_foreach      = */ (Dee_ssize_t (DCALL *)(DeeObject *__restrict, Dee_foreach_t, void *))&tuple_foreach,
+	/* .tp_foreach_pair = */ NULL,
 };
 
 PRIVATE WUNUSED NONNULL((1)) DREF Tuple *DCALL
@@ -2155,7 +2164,7 @@ PUBLIC DeeTypeObject DeeTuple_Type = {
 	                         /**/ "either (s.a. ?A{op:getrange}?DSequence)"),
 	/* .tp_flags    = */ TP_FNORMAL | TP_FVARIABLE | TP_FFINAL | TP_FNAMEOBJECT,
 	/* .tp_weakrefs = */ 0,
-	/* .tp_features = */ TF_NONE,
+	/* .tp_features = */ TF_SEQFOREACH,
 	/* .tp_base     = */ &DeeSeq_Type,
 	/* .tp_init = */ {
 		{
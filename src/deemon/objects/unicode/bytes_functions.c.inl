@@ -4165,7 +4165,7 @@ struct DeeRegexExecWithRange {
 };
 
 struct DeeRegexBaseExec {
-	DREF String               *rx_pattern;  /* [1..1] Pattern string (only a reference within objects in "./reproxy.c.inl") */
+	DREF DeeObject            *rx_pattern;  /* [1..1] Pattern string or `Regex' (only a reference within objects in "./reproxy.c.inl") */
 	struct DeeRegexCode const *rx_code;     /* [1..1] Regex code */
 	void const                *rx_inbase;   /* [0..rx_insize][valid_if(rx_startoff < rx_endoff)] Input data to scan
 	                                         * When `rx_code' was compiled with `DEE_REGEX_COMPILE_NOUTF8', this data
@@ -4207,9 +4207,7 @@ bytes_generic_regex_getargs(Bytes *self, size_t argc, DeeObject *const *argv,
 	                    &pattern, &result->rx_startoff, &result->rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
-	result->rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
+	result->rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
 	if unlikely(!result->rx_code)
 		goto err;
 	result->rx_nmatch = 0;
@@ -4238,9 +4236,7 @@ bytes_search_regex_getargs(Bytes *self, size_t argc, DeeObject *const *argv,
 	                    &result->rewr_exec.rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
-	result->rewr_exec.rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
+	result->rewr_exec.rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
 	if unlikely(!result->rewr_exec.rx_code)
 		goto err;
 	result->rewr_exec.rx_nmatch = 0;
@@ -4763,8 +4759,6 @@ bytes_rereplace(Bytes *self, size_t argc, DeeObject *const *argv, DeeObject *kw)
 	                    "oo|" UNPuSIZ "o:rereplace",
 	                    &pattern, &replace, &maxreplace, &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
 	if (DeeObject_AssertTypeExact(replace, &DeeString_Type))
 		goto err;
 	replace_start = DeeString_AsUtf8(replace);
@@ -4772,7 +4766,7 @@ bytes_rereplace(Bytes *self, size_t argc, DeeObject *const *argv, DeeObject *kw)
 		goto err;
 	replace_end = replace_start + WSTR_LENGTH(replace_start);
 	exec.rx_eflags = 0; /* TODO: NOTBOL/NOTEOL */
-	exec.rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
+	exec.rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NOUTF8, rules);
 	if unlikely(!exec.rx_code)
 		goto err;
 	exec.rx_nmatch   = COMPILER_LENOF(groups);
@@ -4893,9 +4887,7 @@ bytes_base_regex_getargs(Bytes *self, size_t argc, DeeObject *const *argv,
 	                    &result->rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(result->rx_pattern, &DeeString_Type))
-		goto err;
-	result->rx_code = DeeString_GetRegex((DeeObject *)result->rx_pattern,
+	result->rx_code = DeeObject_GetRegex(result->rx_pattern,
 	                                     DEE_REGEX_COMPILE_NOUTF8, rules);
 	if unlikely(!result->rx_code)
 		goto err;
@@ -5943,7 +5935,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 
 	/* Regex functions. */
 	TYPE_KWMETHOD("rematch", &bytes_rematch,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?X2?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?X2?Dint?N\n"
 	              "#tValueError{The given @pattern is malformed}"
 	              "#r{The number of leading bytes in ${this.substr(start, end)} "
 	              /*    */ "matched by @pattern, or ?N if @pattern doesn't match}"
@@ -5953,14 +5945,14 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "escape sequences. Furthermore, unicode character escape sequences cannot be used in "
 	              "@pattern. For more information, see ?Arematch?Dstring"),
 	TYPE_KWMETHOD("rematches", &bytes_rematches,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Check if @pattern matches the entirety of the specified range of @this ?.\n"
 	              "This function behaves identical to ${this.rematch(...) == ?#this}"),
 	TYPE_KWMETHOD("refind", &bytes_refind,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -5968,7 +5960,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "Find the first sub-string matched by @pattern, and return its start/end indices, or ?N if no match exists\n"
 	              "Note that using ?N in an expand expression will expand to the all ?N-values"),
 	TYPE_KWMETHOD("rerfind", &bytes_rerfind,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -5976,7 +5968,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "Find the last sub-string matched by @pattern, and return its start/end indices, "
 	              /**/ "or ?N if no match exists (s.a. #refind)"),
 	TYPE_KWMETHOD("reindex", &bytes_reindex,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -5984,7 +5976,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#refind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("rerindex", &bytes_rerindex,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -5992,7 +5984,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#rerfind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("relocate", &bytes_relocate,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -6002,7 +5994,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              /**/ "given regular expression, or ?N if not found\n"
 	              "This function has nothing to do with relocations! - it's pronounced R.E. locate"),
 	TYPE_KWMETHOD("rerlocate", &bytes_rerlocate,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -6011,7 +6003,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "In other words: return the last sub-string matched by the "
 	              /**/ "given regular expression, or ?N if not found"),
 	TYPE_KWMETHOD("repartition", &bytes_repartition,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -6028,7 +6020,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "	);\n"
 	              "}}"),
 	TYPE_KWMETHOD("rerpartition", &bytes_rerpartition,
-	              "(pattern:?Dstring,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -6045,7 +6037,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "	);\n"
 	              "}}"),
 	TYPE_KWMETHOD("rereplace", &bytes_rereplace,
-	              "(pattern:?Dstring,replace:?.,max:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?.\n"
+	              "(pattern:?X2?Dstring?DRegex,replace:?.,max:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6061,7 +6053,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              /**/ "#C{\\#&}|Outputs a literal $r\"#&\" into the returned ?."
 	              "}"),
 	TYPE_KWMETHOD("refindall", &bytes_refindall,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?T2?Dint?Dint\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6069,7 +6061,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "Locations where @pattern matches epsilon are not included in the returned sequence\n"
 	              "Note that the matches returned are ordered ascendingly"),
 	TYPE_KWMETHOD("relocateall", &bytes_relocateall,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6079,7 +6071,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "Locations where @pattern matches epsilon are not included in the returned sequence\n"
 	              "This function has nothing to do with relocations! - it's pronounced R.E. locate all"),
 	TYPE_KWMETHOD("resplit", &bytes_resplit,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6097,7 +6089,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "strings between matches, use ?#relocateall instead, which also behaves "
 	              "as a sequence"),
 	TYPE_KWMETHOD("restartswith", &bytes_restartswith,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6108,7 +6100,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              /**/ "}"
 	              "}"),
 	TYPE_KWMETHOD("reendswith", &bytes_reendswith,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6120,25 +6112,25 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              /**/ "}"
 	              "}"),
 	TYPE_KWMETHOD("restrip", &bytes_restrip,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all leading and trailing matches for @pattern from @this ?. and return the result (s.a. ?#strip)"),
 	TYPE_KWMETHOD("relstrip", &bytes_relstrip,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all leading matches for @pattern from @this ?. and return the result (s.a. ?#lstrip)"),
 	TYPE_KWMETHOD("rerstrip", &bytes_rerstrip,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all trailing matches for @pattern from @this ?. and return the result (s.a. ?#lstrip)"),
 	TYPE_KWMETHOD("recount", &bytes_recount,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?Dint\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6146,7 +6138,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "Hint: This is the same as ${##this.refindall(pattern)} or ${##this.relocateall(pattern)}\n"
 	              "Instances where @pattern matches epsilon are not counted"),
 	TYPE_KWMETHOD("recontains", &bytes_recontains,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -6164,7 +6156,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 
 	/* Regex functions that return the start-/end-offsets of all groups (rather than only the whole match) */
 	TYPE_KWMETHOD("regmatch", &bytes_regmatch,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#rematch, but rather than only return the number of characters that were "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
@@ -6187,28 +6179,28 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "start of @this ?.. If you want to search for @pattern and get the offsets of "
 	              "all of the matched groups, you should use ?#regfind instead."),
 	TYPE_KWMETHOD("regfind", &bytes_regfind,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#refind, but rather than only return the character-range "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regrfind", &bytes_regrfind,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#rerfind, but rather than only return the character-range "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regfindall", &bytes_regfindall,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#refindall, but rather than only return the character-ranges "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regindex", &bytes_regindex,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -6216,7 +6208,7 @@ INTERN_TPCONST struct type_method tpconst bytes_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#regfind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("regrindex", &bytes_regrindex,
-	              "(pattern:?Dstring,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?Dstring?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -0,0 +1,1763 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_OBJECTS_UNICODE_CODEC_PAGES_C_INL
+#define GUARD_DEEMON_OBJECTS_UNICODE_CODEC_PAGES_C_INL 1
+
+#ifdef __INTELLISENSE__
+#include "codec.c"
+#endif /* !__INTELLISENSE__ */
+
+#include <deemon/api.h>
+
+#include <stdint.h>
+
+DECL_BEGIN
+
+/* Native lookup tables for the single-byte code pages from `lib/_codecs'.
+ *
+ * Every code page maps each of the 256 possible byte values to a unicode
+ * character (which are all part of the BMP). Bytes that aren't defined by
+ * a code page map to `0' (except for byte `0x00', which always maps to
+ * U+0000). For encoding, every code page also has a list of the unicode
+ * characters it can encode, sorted such that they can be binary-searched.
+ * Each entry of that list encodes the character as `(ch << 8) | byte'.
+ *
+ * Code pages that are ASCII-compatible (bytes 0x00-0x7f decode to U+0000-
+ * U+007F) don't list ASCII characters for encoding, since those are always
+ * handled by an ASCII fast-path. */
+struct codec_page {
+	char            cp_name[12]; /* Normalized codec name (s.a. `DeeCodec_NormalizeName()') */
+#define CODEC_PAGE_FNORMAL 0x00  /* Normal flags */
+#define CODEC_PAGE_FASCII  0x01  /* Bytes 0x00-0x7f decode to U+0000-U+007F */
+#define CODEC_PAGE_FLATIN1 0x02  /* All bytes decode to characters <= U+00FF */
+	uint8_t         cp_flags;    /* Code page flags (set of `CODEC_PAGE_F*') */
+	uint8_t         cp_replace;  /* The byte used to encode '?' (used by `STRING_ERROR_FREPLAC') */
+	uint16_t const *cp_decode;   /* [256] Byte -> unicode character (`0' if undefined) */
+	uint32_t const *cp_encode;   /* [cp_nencode] Sorted list of `(ch << 8) | byte' */
+	size_t          cp_nencode;  /* # of characters in `cp_encode' */
+};
+
+/*[[[deemon
+import * from deemon;
+import enumerate from util;
+import fs;
+local codecsDir = fs.joinpath(fs.headof(__FILE__), "../../../../lib/_codecs");
+local pages = [];
+function hex(x: int, n: int): string {
+	return x.tostr(radix: 16, precision: n).upper();
+}
+for (local filename: fs.dir(codecsDir).sorted()) {
+	if (!filename.endswith(".dee") || filename.startswith("_"))
+		continue;
+	local name = filename[:-4];
+	if (name == "iso8859-1")
+		continue; // Already handled by `convert_latin1()'
+	local cp = import("_codecs." + name).cp.ordinals;
+	assert #cp == 256;
+	local isAscii = true;
+	local isLatin1 = true;
+	for (local i, ch: enumerate(cp)) {
+		if (i < 128 && ch != i)
+			isAscii = false;
+		if (ch > 0xff)
+			isLatin1 = false;
+	}
+	local enc = Dict();
+	for (local i, ch: enumerate(cp)) {
+		if (ch == 0 && i != 0)
+			continue; // Undefined byte
+		if (isAscii && i < 128)
+			continue; // Handled by the ASCII fast-path
+		enc.setdefault(ch, i);
+	}
+	local items = List(enc.items).sorted();
+	local cname = "codec_" + name.replace("-", "_");
+	print("PRIVATE uint16_t const ", cname, "_decode[256] = {");
+	for (local i: [:256:16])
+		print("\t", ", ".join(for (local ch: cp[i:i+16]) "0x" + hex(ch, 4)), ",");
+	print("};");
+	print("PRIVATE uint32_t const ", cname, "_encode[", #items, "] = {");
+	for (local i: [:#items:12])
+		print("\t", ", ".join(for (local ch, b: items[i:i+12]) "0x" + hex(ch, 4) + hex(b, 2)), ",");
+	print("};");
+	local flags = [];
+	if (isAscii)
+		flags.append("CODEC_PAGE_FASCII");
+	if (isLatin1)
+		flags.append("CODEC_PAGE_FLATIN1");
+	pages.append((name, cname, flags ? " | ".join(flags) : "CODEC_PAGE_FNORMAL",
+	              isAscii ? 0x3f : enc[0x3f]));
+}
+local nameWidth = 0;
+for (local name: pages.each[0]) {
+	if (nameWidth < #name)
+		nameWidth = #name;
+}
+print("PRIVATE struct codec_page const codec_pages[", #pages, "] = {");
+for (local name, cname, flags, replace: pages) {
+	print("\t{ ", (repr(name) + ",").ljust(nameWidth + 4), flags, ", 0x", hex(replace, 2), ", ",
+	      cname, "_decode, ", cname, "_encode, COMPILER_LENOF(", cname, "_encode) },");
+}
+print("};");
+]]]*/
+PRIVATE uint16_t const codec_cp037_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+	0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+	0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C,
+	0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC,
+	0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+	0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+	0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1,
+	0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+	0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE,
+	0x005E, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x005B, 0x005D, 0x00AF, 0x00A8, 0x00B4, 0x00D7,
+	0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5,
+	0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF,
+	0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F,
+};
+PRIVATE uint32_t const codec_cp037_encode[256] = {
+	0x000000, 0x000101, 0x000202, 0x000303, 0x000437, 0x00052D, 0x00062E, 0x00072F, 0x000816, 0x000905, 0x000A25, 0x000B0B,
+	0x000C0C, 0x000D0D, 0x000E0E, 0x000F0F, 0x001010, 0x001111, 0x001212, 0x001313, 0x00143C, 0x00153D, 0x001632, 0x001726,
+	0x001818, 0x001919, 0x001A3F, 0x001B27, 0x001C1C, 0x001D1D, 0x001E1E, 0x001F1F, 0x002040, 0x00215A, 0x00227F, 0x00237B,
+	0x00245B, 0x00256C, 0x002650, 0x00277D, 0x00284D, 0x00295D, 0x002A5C, 0x002B4E, 0x002C6B, 0x002D60, 0x002E4B, 0x002F61,
+	0x0030F0, 0x0031F1, 0x0032F2, 0x0033F3, 0x0034F4, 0x0035F5, 0x0036F6, 0x0037F7, 0x0038F8, 0x0039F9, 0x003A7A, 0x003B5E,
+	0x003C4C, 0x003D7E, 0x003E6E, 0x003F6F, 0x00407C, 0x0041C1, 0x0042C2, 0x0043C3, 0x0044C4, 0x0045C5, 0x0046C6, 0x0047C7,
+	0x0048C8, 0x0049C9, 0x004AD1, 0x004BD2, 0x004CD3, 0x004DD4, 0x004ED5, 0x004FD6, 0x0050D7, 0x0051D8, 0x0052D9, 0x0053E2,
+	0x0054E3, 0x0055E4, 0x0056E5, 0x0057E6, 0x0058E7, 0x0059E8, 0x005AE9, 0x005BBA, 0x005CE0, 0x005DBB, 0x005EB0, 0x005F6D,
+	0x006079, 0x006181, 0x006282, 0x006383, 0x006484, 0x006585, 0x006686, 0x006787, 0x006888, 0x006989, 0x006A91, 0x006B92,
+	0x006C93, 0x006D94, 0x006E95, 0x006F96, 0x007097, 0x007198, 0x007299, 0x0073A2, 0x0074A3, 0x0075A4, 0x0076A5, 0x0077A6,
+	0x0078A7, 0x0079A8, 0x007AA9, 0x007BC0, 0x007C4F, 0x007DD0, 0x007EA1, 0x007F07, 0x008020, 0x008121, 0x008222, 0x008323,
+	0x008424, 0x008515, 0x008606, 0x008717, 0x008828, 0x008929, 0x008A2A, 0x008B2B, 0x008C2C, 0x008D09, 0x008E0A, 0x008F1B,
+	0x009030, 0x009131, 0x00921A, 0x009333, 0x009434, 0x009535, 0x009636, 0x009708, 0x009838, 0x009939, 0x009A3A, 0x009B3B,
+	0x009C04, 0x009D14, 0x009E3E, 0x009FFF, 0x00A041, 0x00A1AA, 0x00A24A, 0x00A3B1, 0x00A49F, 0x00A5B2, 0x00A66A, 0x00A7B5,
+	0x00A8BD, 0x00A9B4, 0x00AA9A, 0x00AB8A, 0x00AC5F, 0x00ADCA, 0x00AEAF, 0x00AFBC, 0x00B090, 0x00B18F, 0x00B2EA, 0x00B3FA,
+	0x00B4BE, 0x00B5A0, 0x00B6B6, 0x00B7B3, 0x00B89D, 0x00B9DA, 0x00BA9B, 0x00BB8B, 0x00BCB7, 0x00BDB8, 0x00BEB9, 0x00BFAB,
+	0x00C064, 0x00C165, 0x00C262, 0x00C366, 0x00C463, 0x00C567, 0x00C69E, 0x00C768, 0x00C874, 0x00C971, 0x00CA72, 0x00CB73,
+	0x00CC78, 0x00CD75, 0x00CE76, 0x00CF77, 0x00D0AC, 0x00D169, 0x00D2ED, 0x00D3EE, 0x00D4EB, 0x00D5EF, 0x00D6EC, 0x00D7BF,
+	0x00D880, 0x00D9FD, 0x00DAFE, 0x00DBFB, 0x00DCFC, 0x00DDAD, 0x00DEAE, 0x00DF59, 0x00E044, 0x00E145, 0x00E242, 0x00E346,
+	0x00E443, 0x00E547, 0x00E69C, 0x00E748, 0x00E854, 0x00E951, 0x00EA52, 0x00EB53, 0x00EC58, 0x00ED55, 0x00EE56, 0x00EF57,
+	0x00F08C, 0x00F149, 0x00F2CD, 0x00F3CE, 0x00F4CB, 0x00F5CF, 0x00F6CC, 0x00F7E1, 0x00F870, 0x00F9DD, 0x00FADE, 0x00FBDB,
+	0x00FCDC, 0x00FD8D, 0x00FE8E, 0x00FFDF,
+};
+PRIVATE uint16_t const codec_cp10000_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+	0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+	0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+	0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x2126, 0x00E6, 0x00F8,
+	0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+	0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x00A4, 0x2039, 0x203A, 0xFB01, 0xFB02,
+	0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+	0x0000, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7,
+};
+PRIVATE uint32_t const codec_cp10000_encode[127] = {
+	0x00A0CA, 0x00A1C1, 0x00A2A2, 0x00A3A3, 0x00A4DB, 0x00A5B4, 0x00A7A4, 0x00A8AC, 0x00A9A9, 0x00AABB, 0x00ABC7, 0x00ACC2,
+	0x00AEA8, 0x00AFF8, 0x00B0A1, 0x00B1B1, 0x00B4AB, 0x00B5B5, 0x00B6A6, 0x00B7E1, 0x00B8FC, 0x00BABC, 0x00BBC8, 0x00BFC0,
+	0x00C0CB, 0x00C1E7, 0x00C2E5, 0x00C3CC, 0x00C480, 0x00C581, 0x00C6AE, 0x00C782, 0x00C8E9, 0x00C983, 0x00CAE6, 0x00CBE8,
+	0x00CCED, 0x00CDEA, 0x00CEEB, 0x00CFEC, 0x00D184, 0x00D2F1, 0x00D3EE, 0x00D4EF, 0x00D5CD, 0x00D685, 0x00D8AF, 0x00D9F4,
+	0x00DAF2, 0x00DBF3, 0x00DC86, 0x00DFA7, 0x00E088, 0x00E187, 0x00E289, 0x00E38B, 0x00E48A, 0x00E58C, 0x00E6BE, 0x00E78D,
+	0x00E88F, 0x00E98E, 0x00EA90, 0x00EB91, 0x00EC93, 0x00ED92, 0x00EE94, 0x00EF95, 0x00F196, 0x00F298, 0x00F397, 0x00F499,
+	0x00F59B, 0x00F69A, 0x00F7D6, 0x00F8BF, 0x00F99D, 0x00FA9C, 0x00FB9E, 0x00FC9F, 0x00FFD8, 0x0131F5, 0x0152CE, 0x0153CF,
+	0x0178D9, 0x0192C4, 0x02C6F6, 0x02C7FF, 0x02D8F9, 0x02D9FA, 0x02DAFB, 0x02DBFE, 0x02DCF7, 0x02DDFD, 0x03C0B9, 0x2013D0,
+	0x2014D1, 0x2018D4, 0x2019D5, 0x201AE2, 0x201CD2, 0x201DD3, 0x201EE3, 0x2020A0, 0x2021E0, 0x2022A5, 0x2026C9, 0x2030E4,
+	0x2039DC, 0x203ADD, 0x2044DA, 0x2122AA, 0x2126BD, 0x2202B6, 0x2206C6, 0x220FB8, 0x2211B7, 0x221AC3, 0x221EB0, 0x222BBA,
+	0x2248C5, 0x2260AD, 0x2264B2, 0x2265B3, 0x25CAD7, 0xFB01DE, 0xFB02DF,
+};
+PRIVATE uint16_t const codec_cp10006_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C4, 0x00B9, 0x00B2, 0x00C9, 0x00B3, 0x00D6, 0x00DC, 0x0385, 0x00E0, 0x00E2, 0x00E4, 0x0384, 0x00A8, 0x00E7, 0x00E9, 0x00E8,
+	0x00EA, 0x00EB, 0x00A3, 0x2122, 0x00EE, 0x00EF, 0x2022, 0x00BD, 0x2030, 0x00F4, 0x00F6, 0x00A6, 0x00AD, 0x00F9, 0x00FB, 0x00FC,
+	0x2020, 0x0393, 0x0394, 0x0398, 0x039B, 0x039E, 0x03A0, 0x00DF, 0x00AE, 0x00A9, 0x03A3, 0x03AA, 0x00A7, 0x2260, 0x00B0, 0x0387,
+	0x0391, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x0392, 0x0395, 0x0396, 0x0397, 0x0399, 0x039A, 0x039C, 0x03A6, 0x03AB, 0x03A8, 0x03A9,
+	0x03AC, 0x039D, 0x00AC, 0x039F, 0x03A1, 0x2248, 0x03A4, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x03A5, 0x03A7, 0x0386, 0x0388, 0x0153,
+	0x2013, 0x2015, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x0389, 0x038A, 0x038C, 0x038E, 0x03AD, 0x03AE, 0x03AF, 0x03CC, 0x038F,
+	0x03CD, 0x03B1, 0x03B2, 0x03C8, 0x03B4, 0x03B5, 0x03C6, 0x03B3, 0x03B7, 0x03B9, 0x03BE, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BF,
+	0x03C0, 0x03CE, 0x03C1, 0x03C3, 0x03C4, 0x03B8, 0x03C9, 0x03C2, 0x03C7, 0x03C5, 0x03B6, 0x03CA, 0x03CB, 0x0390, 0x03B0, 0x0000,
+};
+PRIVATE uint32_t const codec_cp10006_encode[127] = {
+	0x00A0CA, 0x00A392, 0x00A5B4, 0x00A69B, 0x00A7AC, 0x00A88C, 0x00A9A9, 0x00ABC7, 0x00ACC2, 0x00AD9C, 0x00AEA8, 0x00B0AE,
+	0x00B1B1, 0x00B282, 0x00B384, 0x00B981, 0x00BBC8, 0x00BD97, 0x00C480, 0x00C983, 0x00D685, 0x00DC86, 0x00DFA7, 0x00E088,
+	0x00E289, 0x00E48A, 0x00E78D, 0x00E88F, 0x00E98E, 0x00EA90, 0x00EB91, 0x00EE94, 0x00EF95, 0x00F499, 0x00F69A, 0x00F7D6,
+	0x00F99D, 0x00FB9E, 0x00FC9F, 0x0153CF, 0x03848B, 0x038587, 0x0386CD, 0x0387AF, 0x0388CE, 0x0389D7, 0x038AD8, 0x038CD9,
+	0x038EDA, 0x038FDF, 0x0390FD, 0x0391B0, 0x0392B5, 0x0393A1, 0x0394A2, 0x0395B6, 0x0396B7, 0x0397B8, 0x0398A3, 0x0399B9,
+	0x039ABA, 0x039BA4, 0x039CBB, 0x039DC1, 0x039EA5, 0x039FC3, 0x03A0A6, 0x03A1C4, 0x03A3AA, 0x03A4C6, 0x03A5CB, 0x03A6BC,
+	0x03A7CC, 0x03A8BE, 0x03A9BF, 0x03AAAB, 0x03ABBD, 0x03ACC0, 0x03ADDB, 0x03AEDC, 0x03AFDD, 0x03B0FE, 0x03B1E1, 0x03B2E2,
+	0x03B3E7, 0x03B4E4, 0x03B5E5, 0x03B6FA, 0x03B7E8, 0x03B8F5, 0x03B9E9, 0x03BAEB, 0x03BBEC, 0x03BCED, 0x03BDEE, 0x03BEEA,
+	0x03BFEF, 0x03C0F0, 0x03C1F2, 0x03C2F7, 0x03C3F3, 0x03C4F4, 0x03C5F9, 0x03C6E6, 0x03C7F8, 0x03C8E3, 0x03C9F6, 0x03CAFB,
+	0x03CBFC, 0x03CCDE, 0x03CDE0, 0x03CEF1, 0x2013D0, 0x2015D1, 0x2018D4, 0x2019D5, 0x201CD2, 0x201DD3, 0x2020A0, 0x202296,
+	0x2026C9, 0x203098, 0x212293, 0x2248C5, 0x2260AD, 0x2264B2, 0x2265B3,
+};
+PRIVATE uint16_t const codec_cp10007_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+	0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x0406, 0x00AE, 0x00A9, 0x2122, 0x0402, 0x0452, 0x2260, 0x0403, 0x0453,
+	0x221E, 0x00B1, 0x2264, 0x2265, 0x0456, 0x00B5, 0x2202, 0x0408, 0x0404, 0x0454, 0x0407, 0x0457, 0x0409, 0x0459, 0x040A, 0x045A,
+	0x0458, 0x0405, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x040B, 0x045B, 0x040C, 0x045C, 0x0455,
+	0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x201E, 0x040E, 0x045E, 0x040F, 0x045F, 0x2116, 0x0401, 0x0451, 0x044F,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x00A4,
+};
+PRIVATE uint32_t const codec_cp10007_encode[128] = {
+	0x00A0CA, 0x00A2A2, 0x00A3A3, 0x00A4FF, 0x00A7A4, 0x00A9A9, 0x00ABC7, 0x00ACC2, 0x00AEA8, 0x00B0A1, 0x00B1B1, 0x00B5B5,
+	0x00B6A6, 0x00BBC8, 0x00F7D6, 0x0192C4, 0x0401DD, 0x0402AB, 0x0403AE, 0x0404B8, 0x0405C1, 0x0406A7, 0x0407BA, 0x0408B7,
+	0x0409BC, 0x040ABE, 0x040BCB, 0x040CCD, 0x040ED8, 0x040FDA, 0x041080, 0x041181, 0x041282, 0x041383, 0x041484, 0x041585,
+	0x041686, 0x041787, 0x041888, 0x041989, 0x041A8A, 0x041B8B, 0x041C8C, 0x041D8D, 0x041E8E, 0x041F8F, 0x042090, 0x042191,
+	0x042292, 0x042393, 0x042494, 0x042595, 0x042696, 0x042797, 0x042898, 0x042999, 0x042A9A, 0x042B9B, 0x042C9C, 0x042D9D,
+	0x042E9E, 0x042F9F, 0x0430E0, 0x0431E1, 0x0432E2, 0x0433E3, 0x0434E4, 0x0435E5, 0x0436E6, 0x0437E7, 0x0438E8, 0x0439E9,
+	0x043AEA, 0x043BEB, 0x043CEC, 0x043DED, 0x043EEE, 0x043FEF, 0x0440F0, 0x0441F1, 0x0442F2, 0x0443F3, 0x0444F4, 0x0445F5,
+	0x0446F6, 0x0447F7, 0x0448F8, 0x0449F9, 0x044AFA, 0x044BFB, 0x044CFC, 0x044DFD, 0x044EFE, 0x044FDF, 0x0451DE, 0x0452AC,
+	0x0453AF, 0x0454B9, 0x0455CF, 0x0456B4, 0x0457BB, 0x0458C0, 0x0459BD, 0x045ABF, 0x045BCC, 0x045CCE, 0x045ED9, 0x045FDB,
+	0x2013D0, 0x2014D1, 0x2018D4, 0x2019D5, 0x201CD2, 0x201DD3, 0x201ED7, 0x2020A0, 0x2022A5, 0x2026C9, 0x2116DC, 0x2122AA,
+	0x2202B6, 0x2206C6, 0x221AC3, 0x221EB0, 0x2248C5, 0x2260AD, 0x2264B2, 0x2265B3,
+};
+PRIVATE uint16_t const codec_cp10029_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C4, 0x0100, 0x0101, 0x00C9, 0x0104, 0x00D6, 0x00DC, 0x00E1, 0x0105, 0x010C, 0x00E4, 0x010D, 0x0106, 0x0107, 0x00E9, 0x0179,
+	0x017A, 0x010E, 0x00ED, 0x010F, 0x0112, 0x0113, 0x0116, 0x00F3, 0x0117, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x011A, 0x011B, 0x00FC,
+	0x2020, 0x00B0, 0x0118, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x0119, 0x00A8, 0x2260, 0x0123, 0x012E,
+	0x012F, 0x012A, 0x2264, 0x2265, 0x012B, 0x0136, 0x2202, 0x2211, 0x0142, 0x013B, 0x013C, 0x013D, 0x013E, 0x0139, 0x013A, 0x0145,
+	0x0146, 0x0143, 0x00AC, 0x221A, 0x0144, 0x0147, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x0148, 0x0150, 0x00D5, 0x0151, 0x014C,
+	0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x014D, 0x0154, 0x0155, 0x0158, 0x2039, 0x203A, 0x0159, 0x0156,
+	0x0157, 0x0160, 0x201A, 0x201E, 0x0161, 0x015A, 0x015B, 0x00C1, 0x0164, 0x0165, 0x00CD, 0x017D, 0x017E, 0x016A, 0x00D3, 0x00D4,
+	0x016B, 0x016E, 0x00DA, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x00DD, 0x00FD, 0x0137, 0x017B, 0x0141, 0x017C, 0x0122, 0x02C7,
+};
+PRIVATE uint32_t const codec_cp10029_encode[128] = {
+	0x00A0CA, 0x00A3A3, 0x00A7A4, 0x00A8AC, 0x00A9A9, 0x00ABC7, 0x00ACC2, 0x00AEA8, 0x00B0A1, 0x00B6A6, 0x00BBC8, 0x00C1E7,
+	0x00C480, 0x00C983, 0x00CDEA, 0x00D3EE, 0x00D4EF, 0x00D5CD, 0x00D685, 0x00DAF2, 0x00DC86, 0x00DDF8, 0x00DFA7, 0x00E187,
+	0x00E48A, 0x00E98E, 0x00ED92, 0x00F397, 0x00F499, 0x00F59B, 0x00F69A, 0x00F7D6, 0x00FA9C, 0x00FC9F, 0x00FDF9, 0x010081,
+	0x010182, 0x010484, 0x010588, 0x01068C, 0x01078D, 0x010C89, 0x010D8B, 0x010E91, 0x010F93, 0x011294, 0x011395, 0x011696,
+	0x011798, 0x0118A2, 0x0119AB, 0x011A9D, 0x011B9E, 0x0122FE, 0x0123AE, 0x012AB1, 0x012BB4, 0x012EAF, 0x012FB0, 0x0136B5,
+	0x0137FA, 0x0139BD, 0x013ABE, 0x013BB9, 0x013CBA, 0x013DBB, 0x013EBC, 0x0141FC, 0x0142B8, 0x0143C1, 0x0144C4, 0x0145BF,
+	0x0146C0, 0x0147C5, 0x0148CB, 0x014CCF, 0x014DD8, 0x0150CC, 0x0151CE, 0x0154D9, 0x0155DA, 0x0156DF, 0x0157E0, 0x0158DB,
+	0x0159DE, 0x015AE5, 0x015BE6, 0x0160E1, 0x0161E4, 0x0164E8, 0x0165E9, 0x016AED, 0x016BF0, 0x016EF1, 0x016FF3, 0x0170F4,
+	0x0171F5, 0x0172F6, 0x0173F7, 0x01798F, 0x017A90, 0x017BFB, 0x017CFD, 0x017DEB, 0x017EEC, 0x02C7FF, 0x2013D0, 0x2014D1,
+	0x2018D4, 0x2019D5, 0x201AE2, 0x201CD2, 0x201DD3, 0x201EE3, 0x2020A0, 0x2022A5, 0x2026C9, 0x2039DC, 0x203ADD, 0x2122AA,
+	0x2202B6, 0x2206C6, 0x2211B7, 0x221AC3, 0x2260AD, 0x2264B2, 0x2265B3, 0x25CAD7,
+};
+PRIVATE uint16_t const codec_cp10079_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+	0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+	0x00DD, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+	0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x2126, 0x00E6, 0x00F8,
+	0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+	0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x00A4, 0x00D0, 0x00F0, 0x00DE, 0x00FE,
+	0x00FD, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+	0x0000, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7,
+};
+PRIVATE uint32_t const codec_cp10079_encode[127] = {
+	0x00A0CA, 0x00A1C1, 0x00A2A2, 0x00A3A3, 0x00A4DB, 0x00A5B4, 0x00A7A4, 0x00A8AC, 0x00A9A9, 0x00AABB, 0x00ABC7, 0x00ACC2,
+	0x00AEA8, 0x00AFF8, 0x00B0A1, 0x00B1B1, 0x00B4AB, 0x00B5B5, 0x00B6A6, 0x00B7E1, 0x00B8FC, 0x00BABC, 0x00BBC8, 0x00BFC0,
+	0x00C0CB, 0x00C1E7, 0x00C2E5, 0x00C3CC, 0x00C480, 0x00C581, 0x00C6AE, 0x00C782, 0x00C8E9, 0x00C983, 0x00CAE6, 0x00CBE8,
+	0x00CCED, 0x00CDEA, 0x00CEEB, 0x00CFEC, 0x00D0DC, 0x00D184, 0x00D2F1, 0x00D3EE, 0x00D4EF, 0x00D5CD, 0x00D685, 0x00D8AF,
+	0x00D9F4, 0x00DAF2, 0x00DBF3, 0x00DC86, 0x00DDA0, 0x00DEDE, 0x00DFA7, 0x00E088, 0x00E187, 0x00E289, 0x00E38B, 0x00E48A,
+	0x00E58C, 0x00E6BE, 0x00E78D, 0x00E88F, 0x00E98E, 0x00EA90, 0x00EB91, 0x00EC93, 0x00ED92, 0x00EE94, 0x00EF95, 0x00F0DD,
+	0x00F196, 0x00F298, 0x00F397, 0x00F499, 0x00F59B, 0x00F69A, 0x00F7D6, 0x00F8BF, 0x00F99D, 0x00FA9C, 0x00FB9E, 0x00FC9F,
+	0x00FDE0, 0x00FEDF, 0x00FFD8, 0x0131F5, 0x0152CE, 0x0153CF, 0x0178D9, 0x0192C4, 0x02C6F6, 0x02C7FF, 0x02D8F9, 0x02D9FA,
+	0x02DAFB, 0x02DBFE, 0x02DCF7, 0x02DDFD, 0x03C0B9, 0x2013D0, 0x2014D1, 0x2018D4, 0x2019D5, 0x201AE2, 0x201CD2, 0x201DD3,
+	0x201EE3, 0x2022A5, 0x2026C9, 0x2030E4, 0x2044DA, 0x2122AA, 0x2126BD, 0x2202B6, 0x2206C6, 0x220FB8, 0x2211B7, 0x221AC3,
+	0x221EB0, 0x222BBA, 0x2248C5, 0x2260AD, 0x2264B2, 0x2265B3, 0x25CAD7,
+};
+PRIVATE uint16_t const codec_cp10081_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+	0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+	0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+	0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x2126, 0x00E6, 0x00F8,
+	0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+	0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x011E, 0x011F, 0x0130, 0x0131, 0x015E, 0x015F,
+	0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+	0x0000, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0000, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7,
+};
+PRIVATE uint32_t const codec_cp10081_encode[126] = {
+	0x00A0CA, 0x00A1C1, 0x00A2A2, 0x00A3A3, 0x00A5B4, 0x00A7A4, 0x00A8AC, 0x00A9A9, 0x00AABB, 0x00ABC7, 0x00ACC2, 0x00AEA8,
+	0x00AFF8, 0x00B0A1, 0x00B1B1, 0x00B4AB, 0x00B5B5, 0x00B6A6, 0x00B7E1, 0x00B8FC, 0x00BABC, 0x00BBC8, 0x00BFC0, 0x00C0CB,
+	0x00C1E7, 0x00C2E5, 0x00C3CC, 0x00C480, 0x00C581, 0x00C6AE, 0x00C782, 0x00C8E9, 0x00C983, 0x00CAE6, 0x00CBE8, 0x00CCED,
+	0x00CDEA, 0x00CEEB, 0x00CFEC, 0x00D184, 0x00D2F1, 0x00D3EE, 0x00D4EF, 0x00D5CD, 0x00D685, 0x00D8AF, 0x00D9F4, 0x00DAF2,
+	0x00DBF3, 0x00DC86, 0x00DFA7, 0x00E088, 0x00E187, 0x00E289, 0x00E38B, 0x00E48A, 0x00E58C, 0x00E6BE, 0x00E78D, 0x00E88F,
+	0x00E98E, 0x00EA90, 0x00EB91, 0x00EC93, 0x00ED92, 0x00EE94, 0x00EF95, 0x00F196, 0x00F298, 0x00F397, 0x00F499, 0x00F59B,
+	0x00F69A, 0x00F7D6, 0x00F8BF, 0x00F99D, 0x00FA9C, 0x00FB9E, 0x00FC9F, 0x00FFD8, 0x011EDA, 0x011FDB, 0x0130DC, 0x0131DD,
+	0x0152CE, 0x0153CF, 0x015EDE, 0x015FDF, 0x0178D9, 0x0192C4, 0x02C6F6, 0x02C7FF, 0x02D8F9, 0x02D9FA, 0x02DAFB, 0x02DBFE,
+	0x02DCF7, 0x02DDFD, 0x03C0B9, 0x2013D0, 0x2014D1, 0x2018D4, 0x2019D5, 0x201AE2, 0x201CD2, 0x201DD3, 0x201EE3, 0x2020A0,
+	0x2021E0, 0x2022A5, 0x2026C9, 0x2030E4, 0x2122AA, 0x2126BD, 0x2202B6, 0x2206C6, 0x220FB8, 0x2211B7, 0x221AC3, 0x221EB0,
+	0x222BBA, 0x2248C5, 0x2260AD, 0x2264B2, 0x2265B3, 0x25CAD7,
+};
+PRIVATE uint16_t const codec_cp1026_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+	0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+	0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x007B, 0x00F1, 0x00C7, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021,
+	0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x011E, 0x0130, 0x002A, 0x0029, 0x003B, 0x005E,
+	0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x005B, 0x00D1, 0x015F, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+	0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0131, 0x003A, 0x00D6, 0x015E, 0x0027, 0x003D, 0x00DC,
+	0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x007D, 0x0060, 0x00A6, 0x00B1,
+	0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+	0x00B5, 0x00F6, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x005D, 0x0024, 0x0040, 0x00AE,
+	0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7,
+	0x00E7, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x007E, 0x00F2, 0x00F3, 0x00F5,
+	0x011F, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x005C, 0x00F9, 0x00FA, 0x00FF,
+	0x00FC, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x0023, 0x00D2, 0x00D3, 0x00D5,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x0022, 0x00D9, 0x00DA, 0x009F,
+};
+PRIVATE uint32_t const codec_cp1026_encode[256] = {
+	0x000000, 0x000101, 0x000202, 0x000303, 0x000437, 0x00052D, 0x00062E, 0x00072F, 0x000816, 0x000905, 0x000A25, 0x000B0B,
+	0x000C0C, 0x000D0D, 0x000E0E, 0x000F0F, 0x001010, 0x001111, 0x001212, 0x001313, 0x00143C, 0x00153D, 0x001632, 0x001726,
+	0x001818, 0x001919, 0x001A3F, 0x001B27, 0x001C1C, 0x001D1D, 0x001E1E, 0x001F1F, 0x002040, 0x00214F, 0x0022FC, 0x0023EC,
+	0x0024AD, 0x00256C, 0x002650, 0x00277D, 0x00284D, 0x00295D, 0x002A5C, 0x002B4E, 0x002C6B, 0x002D60, 0x002E4B, 0x002F61,
+	0x0030F0, 0x0031F1, 0x0032F2, 0x0033F3, 0x0034F4, 0x0035F5, 0x0036F6, 0x0037F7, 0x0038F8, 0x0039F9, 0x003A7A, 0x003B5E,
+	0x003C4C, 0x003D7E, 0x003E6E, 0x003F6F, 0x0040AE, 0x0041C1, 0x0042C2, 0x0043C3, 0x0044C4, 0x0045C5, 0x0046C6, 0x0047C7,
+	0x0048C8, 0x0049C9, 0x004AD1, 0x004BD2, 0x004CD3, 0x004DD4, 0x004ED5, 0x004FD6, 0x0050D7, 0x0051D8, 0x0052D9, 0x0053E2,
+	0x0054E3, 0x0055E4, 0x0056E5, 0x0057E6, 0x0058E7, 0x0059E8, 0x005AE9, 0x005B68, 0x005CDC, 0x005DAC, 0x005E5F, 0x005F6D,
+	0x00608D, 0x006181, 0x006282, 0x006383, 0x006484, 0x006585, 0x006686, 0x006787, 0x006888, 0x006989, 0x006A91, 0x006B92,
+	0x006C93, 0x006D94, 0x006E95, 0x006F96, 0x007097, 0x007198, 0x007299, 0x0073A2, 0x0074A3, 0x0075A4, 0x0076A5, 0x0077A6,
+	0x0078A7, 0x0079A8, 0x007AA9, 0x007B48, 0x007CBB, 0x007D8C, 0x007ECC, 0x007F07, 0x008020, 0x008121, 0x008222, 0x008323,
+	0x008424, 0x008515, 0x008606, 0x008717, 0x008828, 0x008929, 0x008A2A, 0x008B2B, 0x008C2C, 0x008D09, 0x008E0A, 0x008F1B,
+	0x009030, 0x009131, 0x00921A, 0x009333, 0x009434, 0x009535, 0x009636, 0x009708, 0x009838, 0x009939, 0x009A3A, 0x009B3B,
+	0x009C04, 0x009D14, 0x009E3E, 0x009FFF, 0x00A041, 0x00A1AA, 0x00A2B0, 0x00A3B1, 0x00A49F, 0x00A5B2, 0x00A68E, 0x00A7B5,
+	0x00A8BD, 0x00A9B4, 0x00AA9A, 0x00AB8A, 0x00ACBA, 0x00ADCA, 0x00AEAF, 0x00AFBC, 0x00B090, 0x00B18F, 0x00B2EA, 0x00B3FA,
+	0x00B4BE, 0x00B5A0, 0x00B6B6, 0x00B7B3, 0x00B89D, 0x00B9DA, 0x00BA9B, 0x00BB8B, 0x00BCB7, 0x00BDB8, 0x00BEB9, 0x00BFAB,
+	0x00C064, 0x00C165, 0x00C262, 0x00C366, 0x00C463, 0x00C567, 0x00C69E, 0x00C74A, 0x00C874, 0x00C971, 0x00CA72, 0x00CB73,
+	0x00CC78, 0x00CD75, 0x00CE76, 0x00CF77, 0x00D169, 0x00D2ED, 0x00D3EE, 0x00D4EB, 0x00D5EF, 0x00D67B, 0x00D7BF, 0x00D880,
+	0x00D9FD, 0x00DAFE, 0x00DBFB, 0x00DC7F, 0x00DF59, 0x00E044, 0x00E145, 0x00E242, 0x00E346, 0x00E443, 0x00E547, 0x00E69C,
+	0x00E7C0, 0x00E854, 0x00E951, 0x00EA52, 0x00EB53, 0x00EC58, 0x00ED55, 0x00EE56, 0x00EF57, 0x00F149, 0x00F2CD, 0x00F3CE,
+	0x00F4CB, 0x00F5CF, 0x00F6A1, 0x00F7E1, 0x00F870, 0x00F9DD, 0x00FADE, 0x00FBDB, 0x00FCE0, 0x00FFDF, 0x011E5A, 0x011FD0,
+	0x01305B, 0x013179, 0x015E7C, 0x015F6A,
+};
+PRIVATE uint16_t const codec_cp1250_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0000, 0x201E, 0x2026, 0x2020, 0x2021, 0x0000, 0x2030, 0x0160, 0x2039, 0x015A, 0x0164, 0x017D, 0x0179,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x2122, 0x0161, 0x203A, 0x015B, 0x0165, 0x017E, 0x017A,
+	0x00A0, 0x02C7, 0x02D8, 0x0141, 0x00A4, 0x0104, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x015E, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x017B,
+	0x00B0, 0x00B1, 0x02DB, 0x0142, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x0105, 0x015F, 0x00BB, 0x013D, 0x02DD, 0x013E, 0x017C,
+	0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+	0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7, 0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+	0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+	0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7, 0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9,
+};
+PRIVATE uint32_t const codec_cp1250_encode[123] = {
+	0x00A0A0, 0x00A4A4, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00B0B0, 0x00B1B1,
+	0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00BBBB, 0x00C1C1, 0x00C2C2, 0x00C4C4, 0x00C7C7, 0x00C9C9, 0x00CBCB,
+	0x00CDCD, 0x00CECE, 0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00DADA, 0x00DCDC, 0x00DDDD, 0x00DFDF, 0x00E1E1, 0x00E2E2,
+	0x00E4E4, 0x00E7E7, 0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00FAFA, 0x00FCFC,
+	0x00FDFD, 0x0102C3, 0x0103E3, 0x0104A5, 0x0105B9, 0x0106C6, 0x0107E6, 0x010CC8, 0x010DE8, 0x010ECF, 0x010FEF, 0x0110D0,
+	0x0111F0, 0x0118CA, 0x0119EA, 0x011ACC, 0x011BEC, 0x0139C5, 0x013AE5, 0x013DBC, 0x013EBE, 0x0141A3, 0x0142B3, 0x0143D1,
+	0x0144F1, 0x0147D2, 0x0148F2, 0x0150D5, 0x0151F5, 0x0154C0, 0x0155E0, 0x0158D8, 0x0159F8, 0x015A8C, 0x015B9C, 0x015EAA,
+	0x015FBA, 0x01608A, 0x01619A, 0x0162DE, 0x0163FE, 0x01648D, 0x01659D, 0x016ED9, 0x016FF9, 0x0170DB, 0x0171FB, 0x01798F,
+	0x017A9F, 0x017BAF, 0x017CBF, 0x017D8E, 0x017E9E, 0x02C7A1, 0x02D8A2, 0x02D9FF, 0x02DBB2, 0x02DDBD, 0x201396, 0x201497,
+	0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+	0x203A9B, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1251_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021, 0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+	0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+	0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+	0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+};
+PRIVATE uint32_t const codec_cp1251_encode[127] = {
+	0x00A0A0, 0x00A4A4, 0x00A6A6, 0x00A7A7, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00B0B0, 0x00B1B1, 0x00B5B5,
+	0x00B6B6, 0x00B7B7, 0x00BBBB, 0x0401A8, 0x040280, 0x040381, 0x0404AA, 0x0405BD, 0x0406B2, 0x0407AF, 0x0408A3, 0x04098A,
+	0x040A8C, 0x040B8E, 0x040C8D, 0x040EA1, 0x040F8F, 0x0410C0, 0x0411C1, 0x0412C2, 0x0413C3, 0x0414C4, 0x0415C5, 0x0416C6,
+	0x0417C7, 0x0418C8, 0x0419C9, 0x041ACA, 0x041BCB, 0x041CCC, 0x041DCD, 0x041ECE, 0x041FCF, 0x0420D0, 0x0421D1, 0x0422D2,
+	0x0423D3, 0x0424D4, 0x0425D5, 0x0426D6, 0x0427D7, 0x0428D8, 0x0429D9, 0x042ADA, 0x042BDB, 0x042CDC, 0x042DDD, 0x042EDE,
+	0x042FDF, 0x0430E0, 0x0431E1, 0x0432E2, 0x0433E3, 0x0434E4, 0x0435E5, 0x0436E6, 0x0437E7, 0x0438E8, 0x0439E9, 0x043AEA,
+	0x043BEB, 0x043CEC, 0x043DED, 0x043EEE, 0x043FEF, 0x0440F0, 0x0441F1, 0x0442F2, 0x0443F3, 0x0444F4, 0x0445F5, 0x0446F6,
+	0x0447F7, 0x0448F8, 0x0449F9, 0x044AFA, 0x044BFB, 0x044CFC, 0x044DFD, 0x044EFE, 0x044FFF, 0x0451B8, 0x045290, 0x045383,
+	0x0454BA, 0x0455BE, 0x0456B3, 0x0457BF, 0x0458BC, 0x04599A, 0x045A9C, 0x045B9E, 0x045C9D, 0x045EA2, 0x045F9F, 0x0490A5,
+	0x0491B4, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295,
+	0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC88, 0x2116B9, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1252_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x0000, 0x017D, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x0000, 0x017E, 0x0178,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+};
+PRIVATE uint32_t const codec_cp1252_encode[123] = {
+	0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+	0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+	0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+	0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+	0x00D0D0, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB,
+	0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7,
+	0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F0F0, 0x00F1F1, 0x00F2F2, 0x00F3F3,
+	0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x00FFFF,
+	0x01528C, 0x01539C, 0x01608A, 0x01619A, 0x01789F, 0x017D8E, 0x017E9E, 0x019283, 0x02C688, 0x02DC98, 0x201396, 0x201497,
+	0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+	0x203A9B, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1253_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x0000, 0x2030, 0x0000, 0x2039, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x2122, 0x0000, 0x203A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00A0, 0x0385, 0x0386, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x0000, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x2015,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x00B5, 0x00B6, 0x00B7, 0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+	0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+	0x03A0, 0x03A1, 0x0000, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+	0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+	0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x0000,
+};
+PRIVATE uint32_t const codec_cp1253_encode[111] = {
+	0x00A0A0, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE,
+	0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00BBBB, 0x00BDBD, 0x019283, 0x0384B4, 0x0385A1,
+	0x0386A2, 0x0388B8, 0x0389B9, 0x038ABA, 0x038CBC, 0x038EBE, 0x038FBF, 0x0390C0, 0x0391C1, 0x0392C2, 0x0393C3, 0x0394C4,
+	0x0395C5, 0x0396C6, 0x0397C7, 0x0398C8, 0x0399C9, 0x039ACA, 0x039BCB, 0x039CCC, 0x039DCD, 0x039ECE, 0x039FCF, 0x03A0D0,
+	0x03A1D1, 0x03A3D3, 0x03A4D4, 0x03A5D5, 0x03A6D6, 0x03A7D7, 0x03A8D8, 0x03A9D9, 0x03AADA, 0x03ABDB, 0x03ACDC, 0x03ADDD,
+	0x03AEDE, 0x03AFDF, 0x03B0E0, 0x03B1E1, 0x03B2E2, 0x03B3E3, 0x03B4E4, 0x03B5E5, 0x03B6E6, 0x03B7E7, 0x03B8E8, 0x03B9E9,
+	0x03BAEA, 0x03BBEB, 0x03BCEC, 0x03BDED, 0x03BEEE, 0x03BFEF, 0x03C0F0, 0x03C1F1, 0x03C2F2, 0x03C3F3, 0x03C4F4, 0x03C5F5,
+	0x03C6F6, 0x03C7F7, 0x03C8F8, 0x03C9F9, 0x03CAFA, 0x03CBFB, 0x03CCFC, 0x03CDFD, 0x03CEFE, 0x201396, 0x201497, 0x2015AF,
+	0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B,
+	0x203A9B, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1254_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x0000, 0x0000, 0x0178,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF,
+};
+PRIVATE uint32_t const codec_cp1254_encode[121] = {
+	0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+	0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+	0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+	0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+	0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC,
+	0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA,
+	0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7,
+	0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF, 0x011ED0, 0x011FF0, 0x0130DD, 0x0131FD, 0x01528C, 0x01539C,
+	0x015EDE, 0x015FFE, 0x01608A, 0x01619A, 0x01789F, 0x019283, 0x02C688, 0x02DC98, 0x201396, 0x201497, 0x201891, 0x201992,
+	0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC80,
+	0x212299,
+};
+PRIVATE uint16_t const codec_cp1255_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0000, 0x2039, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0000, 0x203A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AA, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x0000, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF,
+	0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+	0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x0000, 0x0000, 0x200E, 0x200F, 0x0000,
+};
+PRIVATE uint32_t const codec_cp1255_encode[105] = {
+	0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD,
+	0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9,
+	0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00D7AA, 0x00F7BA, 0x019283, 0x02C688, 0x02DC98, 0x05B0C0, 0x05B1C1,
+	0x05B2C2, 0x05B3C3, 0x05B4C4, 0x05B5C5, 0x05B6C6, 0x05B7C7, 0x05B8C8, 0x05B9C9, 0x05BBCB, 0x05BCCC, 0x05BDCD, 0x05BECE,
+	0x05BFCF, 0x05C0D0, 0x05C1D1, 0x05C2D2, 0x05C3D3, 0x05D0E0, 0x05D1E1, 0x05D2E2, 0x05D3E3, 0x05D4E4, 0x05D5E5, 0x05D6E6,
+	0x05D7E7, 0x05D8E8, 0x05D9E9, 0x05DAEA, 0x05DBEB, 0x05DCEC, 0x05DDED, 0x05DEEE, 0x05DFEF, 0x05E0F0, 0x05E1F1, 0x05E2F2,
+	0x05E3F3, 0x05E4F4, 0x05E5F5, 0x05E6F6, 0x05E7F7, 0x05E8F8, 0x05E9F9, 0x05EAFA, 0x05F0D4, 0x05F1D5, 0x05F2D6, 0x05F3D7,
+	0x05F4D8, 0x200EFD, 0x200FFE, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+	0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AAA4, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1256_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x067E, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688,
+	0x06AF, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x06A9, 0x2122, 0x0691, 0x203A, 0x0153, 0x200C, 0x200D, 0x06BA,
+	0x00A0, 0x060C, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x06BE, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x061B, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x061F,
+	0x06C1, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+	0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x00D7, 0x0637, 0x0638, 0x0639, 0x063A, 0x0640, 0x0641, 0x0642, 0x0643,
+	0x00E0, 0x0644, 0x00E2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0649, 0x064A, 0x00EE, 0x00EF,
+	0x064B, 0x064C, 0x064D, 0x064E, 0x00F4, 0x064F, 0x0650, 0x00F7, 0x0651, 0x00F9, 0x0652, 0x00FB, 0x00FC, 0x200E, 0x200F, 0x06D2,
+};
+PRIVATE uint32_t const codec_cp1256_encode[128] = {
+	0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD,
+	0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9,
+	0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00D7D7, 0x00E0E0, 0x00E2E2, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB,
+	0x00EEEE, 0x00EFEF, 0x00F4F4, 0x00F7F7, 0x00F9F9, 0x00FBFB, 0x00FCFC, 0x01528C, 0x01539C, 0x019283, 0x02C688, 0x060CA1,
+	0x061BBA, 0x061FBF, 0x0621C1, 0x0622C2, 0x0623C3, 0x0624C4, 0x0625C5, 0x0626C6, 0x0627C7, 0x0628C8, 0x0629C9, 0x062ACA,
+	0x062BCB, 0x062CCC, 0x062DCD, 0x062ECE, 0x062FCF, 0x0630D0, 0x0631D1, 0x0632D2, 0x0633D3, 0x0634D4, 0x0635D5, 0x0636D6,
+	0x0637D8, 0x0638D9, 0x0639DA, 0x063ADB, 0x0640DC, 0x0641DD, 0x0642DE, 0x0643DF, 0x0644E1, 0x0645E3, 0x0646E4, 0x0647E5,
+	0x0648E6, 0x0649EC, 0x064AED, 0x064BF0, 0x064CF1, 0x064DF2, 0x064EF3, 0x064FF5, 0x0650F6, 0x0651F8, 0x0652FA, 0x06798A,
+	0x067E81, 0x06868D, 0x06888F, 0x06919A, 0x06988E, 0x06A998, 0x06AF90, 0x06BA9F, 0x06BEAA, 0x06C1C0, 0x06D2FF, 0x200C9D,
+	0x200D9E, 0x200EFD, 0x200FFE, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+	0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1257_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0000, 0x201E, 0x2026, 0x2020, 0x2021, 0x0000, 0x2030, 0x0000, 0x2039, 0x0000, 0x00A8, 0x02C7, 0x00B8,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x2122, 0x0000, 0x203A, 0x0000, 0x00AF, 0x02DB, 0x0000,
+	0x00A0, 0x0000, 0x00A2, 0x00A3, 0x00A4, 0x0000, 0x00A6, 0x00A7, 0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+	0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112, 0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+	0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7, 0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+	0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113, 0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+	0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7, 0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x02D9,
+};
+PRIVATE uint32_t const codec_cp1257_encode[116] = {
+	0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A6A6, 0x00A7A7, 0x00A88D, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE,
+	0x00AF9D, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B88F, 0x00B9B9, 0x00BBBB,
+	0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00C4C4, 0x00C5C5, 0x00C6AF, 0x00C9C9, 0x00D3D3, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8A8,
+	0x00DCDC, 0x00DFDF, 0x00E4E4, 0x00E5E5, 0x00E6BF, 0x00E9E9, 0x00F3F3, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8B8, 0x00FCFC,
+	0x0100C2, 0x0101E2, 0x0104C0, 0x0105E0, 0x0106C3, 0x0107E3, 0x010CC8, 0x010DE8, 0x0112C7, 0x0113E7, 0x0116CB, 0x0117EB,
+	0x0118C6, 0x0119E6, 0x0122CC, 0x0123EC, 0x012ACE, 0x012BEE, 0x012EC1, 0x012FE1, 0x0136CD, 0x0137ED, 0x013BCF, 0x013CEF,
+	0x0141D9, 0x0142F9, 0x0143D1, 0x0144F1, 0x0145D2, 0x0146F2, 0x014CD4, 0x014DF4, 0x0156AA, 0x0157BA, 0x015ADA, 0x015BFA,
+	0x0160D0, 0x0161F0, 0x016ADB, 0x016BFB, 0x0172D8, 0x0173F8, 0x0179CA, 0x017AEA, 0x017BDD, 0x017CFD, 0x017DDE, 0x017EFE,
+	0x02C78E, 0x02D9FF, 0x02DB9E, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94, 0x201E84, 0x202086,
+	0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp1258_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0000, 0x2039, 0x0152, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0000, 0x203A, 0x0153, 0x0000, 0x0000, 0x0178,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x0300, 0x00CD, 0x00CE, 0x00CF,
+	0x0110, 0x00D1, 0x0309, 0x00D3, 0x00D4, 0x01A0, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x01AF, 0x0303, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x0301, 0x00ED, 0x00EE, 0x00EF,
+	0x0111, 0x00F1, 0x0323, 0x00F3, 0x00F4, 0x01A1, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x01B0, 0x20AB, 0x00FF,
+};
+PRIVATE uint32_t const codec_cp1258_encode[119] = {
+	0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB,
+	0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7,
+	0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C4C4,
+	0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1, 0x00D3D3,
+	0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2,
+	0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1,
+	0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF, 0x0102C3, 0x0103E3,
+	0x0110D0, 0x0111F0, 0x01528C, 0x01539C, 0x01789F, 0x019283, 0x01A0D5, 0x01A1F5, 0x01AFDD, 0x01B0FD, 0x02C688, 0x02DC98,
+	0x0300CC, 0x0301EC, 0x0303DE, 0x0309D2, 0x0323F2, 0x201396, 0x201497, 0x201891, 0x201992, 0x201A82, 0x201C93, 0x201D94,
+	0x201E84, 0x202086, 0x202187, 0x202295, 0x202685, 0x203089, 0x20398B, 0x203A9B, 0x20ABFE, 0x20AC80, 0x212299,
+};
+PRIVATE uint16_t const codec_cp437_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp437_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A29B, 0x00A39C, 0x00A59D, 0x00AAA6, 0x00ABAE, 0x00ACAA, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B5E6,
+	0x00B7FA, 0x00BAA7, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BFA8, 0x00C48E, 0x00C58F, 0x00C692, 0x00C780, 0x00C990, 0x00D1A5,
+	0x00D699, 0x00DC9A, 0x00DFE1, 0x00E085, 0x00E1A0, 0x00E283, 0x00E484, 0x00E586, 0x00E691, 0x00E787, 0x00E88A, 0x00E982,
+	0x00EA88, 0x00EB89, 0x00EC8D, 0x00EDA1, 0x00EE8C, 0x00EF8B, 0x00F1A4, 0x00F295, 0x00F3A2, 0x00F493, 0x00F694, 0x00F7F6,
+	0x00F997, 0x00FAA3, 0x00FB96, 0x00FC81, 0x00FF98, 0x01929F, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA, 0x03B1E0,
+	0x03B4EB, 0x03B5EE, 0x03C0E3, 0x03C3E5, 0x03C4E7, 0x03C6ED, 0x207FFC, 0x20A79E, 0x2219F9, 0x221AFB, 0x221EEC, 0x2229EF,
+	0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2310A9, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp500_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+	0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+	0x0020, 0x00A0, 0x00E2, 0x00E4, 0x00E0, 0x00E1, 0x00E3, 0x00E5, 0x00E7, 0x00F1, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021,
+	0x0026, 0x00E9, 0x00EA, 0x00EB, 0x00E8, 0x00ED, 0x00EE, 0x00EF, 0x00EC, 0x00DF, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E,
+	0x002D, 0x002F, 0x00C2, 0x00C4, 0x00C0, 0x00C1, 0x00C3, 0x00C5, 0x00C7, 0x00D1, 0x00A6, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+	0x00F8, 0x00C9, 0x00CA, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+	0x00D8, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x00AB, 0x00BB, 0x00F0, 0x00FD, 0x00FE, 0x00B1,
+	0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x00AA, 0x00BA, 0x00E6, 0x00B8, 0x00C6, 0x00A4,
+	0x00B5, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x00A1, 0x00BF, 0x00D0, 0x00DD, 0x00DE, 0x00AE,
+	0x00A2, 0x00A3, 0x00A5, 0x00B7, 0x00A9, 0x00A7, 0x00B6, 0x00BC, 0x00BD, 0x00BE, 0x00AC, 0x007C, 0x00AF, 0x00A8, 0x00B4, 0x00D7,
+	0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x00F4, 0x00F6, 0x00F2, 0x00F3, 0x00F5,
+	0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B9, 0x00FB, 0x00FC, 0x00F9, 0x00FA, 0x00FF,
+	0x005C, 0x00F7, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00D4, 0x00D6, 0x00D2, 0x00D3, 0x00D5,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00DB, 0x00DC, 0x00D9, 0x00DA, 0x009F,
+};
+PRIVATE uint32_t const codec_cp500_encode[256] = {
+	0x000000, 0x000101, 0x000202, 0x000303, 0x000437, 0x00052D, 0x00062E, 0x00072F, 0x000816, 0x000905, 0x000A25, 0x000B0B,
+	0x000C0C, 0x000D0D, 0x000E0E, 0x000F0F, 0x001010, 0x001111, 0x001212, 0x001313, 0x00143C, 0x00153D, 0x001632, 0x001726,
+	0x001818, 0x001919, 0x001A3F, 0x001B27, 0x001C1C, 0x001D1D, 0x001E1E, 0x001F1F, 0x002040, 0x00214F, 0x00227F, 0x00237B,
+	0x00245B, 0x00256C, 0x002650, 0x00277D, 0x00284D, 0x00295D, 0x002A5C, 0x002B4E, 0x002C6B, 0x002D60, 0x002E4B, 0x002F61,
+	0x0030F0, 0x0031F1, 0x0032F2, 0x0033F3, 0x0034F4, 0x0035F5, 0x0036F6, 0x0037F7, 0x0038F8, 0x0039F9, 0x003A7A, 0x003B5E,
+	0x003C4C, 0x003D7E, 0x003E6E, 0x003F6F, 0x00407C, 0x0041C1, 0x0042C2, 0x0043C3, 0x0044C4, 0x0045C5, 0x0046C6, 0x0047C7,
+	0x0048C8, 0x0049C9, 0x004AD1, 0x004BD2, 0x004CD3, 0x004DD4, 0x004ED5, 0x004FD6, 0x0050D7, 0x0051D8, 0x0052D9, 0x0053E2,
+	0x0054E3, 0x0055E4, 0x0056E5, 0x0057E6, 0x0058E7, 0x0059E8, 0x005AE9, 0x005B4A, 0x005CE0, 0x005D5A, 0x005E5F, 0x005F6D,
+	0x006079, 0x006181, 0x006282, 0x006383, 0x006484, 0x006585, 0x006686, 0x006787, 0x006888, 0x006989, 0x006A91, 0x006B92,
+	0x006C93, 0x006D94, 0x006E95, 0x006F96, 0x007097, 0x007198, 0x007299, 0x0073A2, 0x0074A3, 0x0075A4, 0x0076A5, 0x0077A6,
+	0x0078A7, 0x0079A8, 0x007AA9, 0x007BC0, 0x007CBB, 0x007DD0, 0x007EA1, 0x007F07, 0x008020, 0x008121, 0x008222, 0x008323,
+	0x008424, 0x008515, 0x008606, 0x008717, 0x008828, 0x008929, 0x008A2A, 0x008B2B, 0x008C2C, 0x008D09, 0x008E0A, 0x008F1B,
+	0x009030, 0x009131, 0x00921A, 0x009333, 0x009434, 0x009535, 0x009636, 0x009708, 0x009838, 0x009939, 0x009A3A, 0x009B3B,
+	0x009C04, 0x009D14, 0x009E3E, 0x009FFF, 0x00A041, 0x00A1AA, 0x00A2B0, 0x00A3B1, 0x00A49F, 0x00A5B2, 0x00A66A, 0x00A7B5,
+	0x00A8BD, 0x00A9B4, 0x00AA9A, 0x00AB8A, 0x00ACBA, 0x00ADCA, 0x00AEAF, 0x00AFBC, 0x00B090, 0x00B18F, 0x00B2EA, 0x00B3FA,
+	0x00B4BE, 0x00B5A0, 0x00B6B6, 0x00B7B3, 0x00B89D, 0x00B9DA, 0x00BA9B, 0x00BB8B, 0x00BCB7, 0x00BDB8, 0x00BEB9, 0x00BFAB,
+	0x00C064, 0x00C165, 0x00C262, 0x00C366, 0x00C463, 0x00C567, 0x00C69E, 0x00C768, 0x00C874, 0x00C971, 0x00CA72, 0x00CB73,
+	0x00CC78, 0x00CD75, 0x00CE76, 0x00CF77, 0x00D0AC, 0x00D169, 0x00D2ED, 0x00D3EE, 0x00D4EB, 0x00D5EF, 0x00D6EC, 0x00D7BF,
+	0x00D880, 0x00D9FD, 0x00DAFE, 0x00DBFB, 0x00DCFC, 0x00DDAD, 0x00DEAE, 0x00DF59, 0x00E044, 0x00E145, 0x00E242, 0x00E346,
+	0x00E443, 0x00E547, 0x00E69C, 0x00E748, 0x00E854, 0x00E951, 0x00EA52, 0x00EB53, 0x00EC58, 0x00ED55, 0x00EE56, 0x00EF57,
+	0x00F08C, 0x00F149, 0x00F2CD, 0x00F3CE, 0x00F4CB, 0x00F5CF, 0x00F6CC, 0x00F7E1, 0x00F870, 0x00F9DD, 0x00FADE, 0x00FBDB,
+	0x00FCDC, 0x00FD8D, 0x00FE8E, 0x00FFDF,
+};
+PRIVATE uint16_t const codec_cp737_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0,
+	0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8,
+	0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03C9, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x0386, 0x0388, 0x0389, 0x038A, 0x038C, 0x038E,
+	0x038F, 0x00B1, 0x2265, 0x2264, 0x03AA, 0x03AB, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp737_encode[128] = {
+	0x00A0FF, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B7FA, 0x00F7F6, 0x0386EA, 0x0388EB, 0x0389EC, 0x038AED, 0x038CEE, 0x038EEF,
+	0x038FF0, 0x039180, 0x039281, 0x039382, 0x039483, 0x039584, 0x039685, 0x039786, 0x039887, 0x039988, 0x039A89, 0x039B8A,
+	0x039C8B, 0x039D8C, 0x039E8D, 0x039F8E, 0x03A08F, 0x03A190, 0x03A391, 0x03A492, 0x03A593, 0x03A694, 0x03A795, 0x03A896,
+	0x03A997, 0x03AAF4, 0x03ABF5, 0x03ACE1, 0x03ADE2, 0x03AEE3, 0x03AFE5, 0x03B198, 0x03B299, 0x03B39A, 0x03B49B, 0x03B59C,
+	0x03B69D, 0x03B79E, 0x03B89F, 0x03B9A0, 0x03BAA1, 0x03BBA2, 0x03BCA3, 0x03BDA4, 0x03BEA5, 0x03BFA6, 0x03C0A7, 0x03C1A8,
+	0x03C2AA, 0x03C3A9, 0x03C4AB, 0x03C5AC, 0x03C6AD, 0x03C7AE, 0x03C8AF, 0x03C9E0, 0x03CAE4, 0x03CBE8, 0x03CCE6, 0x03CDE7,
+	0x03CEE9, 0x207FFC, 0x2219F9, 0x221AFB, 0x2248F7, 0x2264F3, 0x2265F2, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp775_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0106, 0x00FC, 0x00E9, 0x0101, 0x00E4, 0x0123, 0x00E5, 0x0107, 0x0142, 0x0113, 0x0156, 0x0157, 0x012B, 0x0179, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x014D, 0x00F6, 0x0122, 0x00A2, 0x015A, 0x015B, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x00A4,
+	0x0100, 0x012A, 0x00F3, 0x017B, 0x017C, 0x017A, 0x201D, 0x00A6, 0x00A9, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x0141, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x0104, 0x010C, 0x0118, 0x0116, 0x2563, 0x2551, 0x2557, 0x255D, 0x012E, 0x0160, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x0172, 0x016A, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x017D,
+	0x0105, 0x010D, 0x0119, 0x0117, 0x012F, 0x0161, 0x0173, 0x016B, 0x017E, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x00D3, 0x00DF, 0x014C, 0x0143, 0x00F5, 0x00D5, 0x00B5, 0x0144, 0x0136, 0x0137, 0x013B, 0x013C, 0x0146, 0x0112, 0x0145, 0x2019,
+	0x00AD, 0x00B1, 0x201C, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x201E, 0x00B0, 0x2219, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp775_encode[128] = {
+	0x00A0FF, 0x00A296, 0x00A39C, 0x00A49F, 0x00A6A7, 0x00A7F5, 0x00A9A8, 0x00ABAE, 0x00ACAA, 0x00ADF0, 0x00AEA9, 0x00B0F8,
+	0x00B1F1, 0x00B2FD, 0x00B3FC, 0x00B5E6, 0x00B6F4, 0x00B7FA, 0x00B9FB, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BEF3, 0x00C48E,
+	0x00C58F, 0x00C692, 0x00C990, 0x00D3E0, 0x00D5E5, 0x00D699, 0x00D79E, 0x00D89D, 0x00DC9A, 0x00DFE1, 0x00E484, 0x00E586,
+	0x00E691, 0x00E982, 0x00F3A2, 0x00F5E4, 0x00F694, 0x00F7F6, 0x00F89B, 0x00FC81, 0x0100A0, 0x010183, 0x0104B5, 0x0105D0,
+	0x010680, 0x010787, 0x010CB6, 0x010DD1, 0x0112ED, 0x011389, 0x0116B8, 0x0117D3, 0x0118B7, 0x0119D2, 0x012295, 0x012385,
+	0x012AA1, 0x012B8C, 0x012EBD, 0x012FD4, 0x0136E8, 0x0137E9, 0x013BEA, 0x013CEB, 0x0141AD, 0x014288, 0x0143E3, 0x0144E7,
+	0x0145EE, 0x0146EC, 0x014CE2, 0x014D93, 0x01568A, 0x01578B, 0x015A97, 0x015B98, 0x0160BE, 0x0161D5, 0x016AC7, 0x016BD7,
+	0x0172C6, 0x0173D6, 0x01798D, 0x017AA5, 0x017BA3, 0x017CA4, 0x017DCF, 0x017ED8, 0x2019EF, 0x201CF2, 0x201DA6, 0x201EF7,
+	0x2219F9, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5,
+	0x2550CD, 0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC, 0x2563B9, 0x2566CB, 0x2569CA, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp850_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x00D7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+	0x00F0, 0x00D0, 0x00CA, 0x00CB, 0x00C8, 0x0131, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+	0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x00FE, 0x00DE, 0x00DA, 0x00DB, 0x00D9, 0x00FD, 0x00DD, 0x00AF, 0x00B4,
+	0x00AD, 0x00B1, 0x2017, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp850_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A2BD, 0x00A39C, 0x00A4CF, 0x00A5BE, 0x00A6DD, 0x00A7F5, 0x00A8F9, 0x00A9B8, 0x00AAA6, 0x00ABAE,
+	0x00ACAA, 0x00ADF0, 0x00AEA9, 0x00AFEE, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B3FC, 0x00B4EF, 0x00B5E6, 0x00B6F4, 0x00B7FA,
+	0x00B8F7, 0x00B9FB, 0x00BAA7, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BEF3, 0x00BFA8, 0x00C0B7, 0x00C1B5, 0x00C2B6, 0x00C3C7,
+	0x00C48E, 0x00C58F, 0x00C692, 0x00C780, 0x00C8D4, 0x00C990, 0x00CAD2, 0x00CBD3, 0x00CCDE, 0x00CDD6, 0x00CED7, 0x00CFD8,
+	0x00D0D1, 0x00D1A5, 0x00D2E3, 0x00D3E0, 0x00D4E2, 0x00D5E5, 0x00D699, 0x00D79E, 0x00D89D, 0x00D9EB, 0x00DAE9, 0x00DBEA,
+	0x00DC9A, 0x00DDED, 0x00DEE8, 0x00DFE1, 0x00E085, 0x00E1A0, 0x00E283, 0x00E3C6, 0x00E484, 0x00E586, 0x00E691, 0x00E787,
+	0x00E88A, 0x00E982, 0x00EA88, 0x00EB89, 0x00EC8D, 0x00EDA1, 0x00EE8C, 0x00EF8B, 0x00F0D0, 0x00F1A4, 0x00F295, 0x00F3A2,
+	0x00F493, 0x00F5E4, 0x00F694, 0x00F7F6, 0x00F89B, 0x00F997, 0x00FAA3, 0x00FB96, 0x00FC81, 0x00FDEC, 0x00FEE7, 0x00FF98,
+	0x0131D5, 0x01929F, 0x2017F2, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2,
+	0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC, 0x2563B9, 0x2566CB, 0x2569CA,
+	0x256CCE, 0x2580DF, 0x2584DC, 0x2588DB, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp852_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x016F, 0x0107, 0x00E7, 0x0142, 0x00EB, 0x0150, 0x0151, 0x00EE, 0x0179, 0x00C4, 0x0106,
+	0x00C9, 0x0139, 0x013A, 0x00F4, 0x00F6, 0x013D, 0x013E, 0x015A, 0x015B, 0x00D6, 0x00DC, 0x0164, 0x0165, 0x0141, 0x00D7, 0x010D,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x0104, 0x0105, 0x017D, 0x017E, 0x0118, 0x0119, 0x00AC, 0x017A, 0x010C, 0x015F, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x011A, 0x015E, 0x2563, 0x2551, 0x2557, 0x255D, 0x017B, 0x017C, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x0102, 0x0103, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+	0x0111, 0x0110, 0x010E, 0x00CB, 0x010F, 0x0147, 0x00CD, 0x00CE, 0x011B, 0x2518, 0x250C, 0x2588, 0x2584, 0x0162, 0x016E, 0x2580,
+	0x00D3, 0x00DF, 0x00D4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161, 0x0154, 0x00DA, 0x0155, 0x0170, 0x00FD, 0x00DD, 0x0163, 0x00B4,
+	0x00AD, 0x02DD, 0x02DB, 0x02C7, 0x02D8, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x02D9, 0x0171, 0x0158, 0x0159, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp852_encode[128] = {
+	0x00A0FF, 0x00A4CF, 0x00A7F5, 0x00A8F9, 0x00ABAE, 0x00ACAA, 0x00ADF0, 0x00B0F8, 0x00B4EF, 0x00B8F7, 0x00BBAF, 0x00C1B5,
+	0x00C2B6, 0x00C48E, 0x00C780, 0x00C990, 0x00CBD3, 0x00CDD6, 0x00CED7, 0x00D3E0, 0x00D4E2, 0x00D699, 0x00D79E, 0x00DAE9,
+	0x00DC9A, 0x00DDED, 0x00DFE1, 0x00E1A0, 0x00E283, 0x00E484, 0x00E787, 0x00E982, 0x00EB89, 0x00EDA1, 0x00EE8C, 0x00F3A2,
+	0x00F493, 0x00F694, 0x00F7F6, 0x00FAA3, 0x00FC81, 0x00FDEC, 0x0102C6, 0x0103C7, 0x0104A4, 0x0105A5, 0x01068F, 0x010786,
+	0x010CAC, 0x010D9F, 0x010ED2, 0x010FD4, 0x0110D1, 0x0111D0, 0x0118A8, 0x0119A9, 0x011AB7, 0x011BD8, 0x013991, 0x013A92,
+	0x013D95, 0x013E96, 0x01419D, 0x014288, 0x0143E3, 0x0144E4, 0x0147D5, 0x0148E5, 0x01508A, 0x01518B, 0x0154E8, 0x0155EA,
+	0x0158FC, 0x0159FD, 0x015A97, 0x015B98, 0x015EB8, 0x015FAD, 0x0160E6, 0x0161E7, 0x0162DD, 0x0163EE, 0x01649B, 0x01659C,
+	0x016EDE, 0x016F85, 0x0170EB, 0x0171FB, 0x01798D, 0x017AAB, 0x017BBD, 0x017CBE, 0x017DA6, 0x017EA7, 0x02C7F3, 0x02D8F4,
+	0x02D9FA, 0x02DBF2, 0x02DDF1, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2,
+	0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC, 0x2563B9, 0x2566CB, 0x2569CA,
+	0x256CCE, 0x2580DF, 0x2584DC, 0x2588DB, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp855_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0452, 0x0402, 0x0453, 0x0403, 0x0451, 0x0401, 0x0454, 0x0404, 0x0455, 0x0405, 0x0456, 0x0406, 0x0457, 0x0407, 0x0458, 0x0408,
+	0x0459, 0x0409, 0x045A, 0x040A, 0x045B, 0x040B, 0x045C, 0x040C, 0x045E, 0x040E, 0x045F, 0x040F, 0x044E, 0x042E, 0x044A, 0x042A,
+	0x0430, 0x0410, 0x0431, 0x0411, 0x0446, 0x0426, 0x0434, 0x0414, 0x0435, 0x0415, 0x0444, 0x0424, 0x0433, 0x0413, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x0445, 0x0425, 0x0438, 0x0418, 0x2563, 0x2551, 0x2557, 0x255D, 0x0439, 0x0419, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x043A, 0x041A, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+	0x043B, 0x041B, 0x043C, 0x041C, 0x043D, 0x041D, 0x043E, 0x041E, 0x043F, 0x2518, 0x250C, 0x2588, 0x2584, 0x041F, 0x044F, 0x2580,
+	0x042F, 0x0440, 0x0420, 0x0441, 0x0421, 0x0442, 0x0422, 0x0443, 0x0423, 0x0436, 0x0416, 0x0432, 0x0412, 0x044C, 0x042C, 0x2116,
+	0x00AD, 0x044B, 0x042B, 0x0437, 0x0417, 0x0448, 0x0428, 0x044D, 0x042D, 0x0449, 0x0429, 0x0447, 0x0427, 0x00A7, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp855_encode[128] = {
+	0x00A0FF, 0x00A4CF, 0x00A7FD, 0x00ABAE, 0x00ADF0, 0x00BBAF, 0x040185, 0x040281, 0x040383, 0x040487, 0x040589, 0x04068B,
+	0x04078D, 0x04088F, 0x040991, 0x040A93, 0x040B95, 0x040C97, 0x040E99, 0x040F9B, 0x0410A1, 0x0411A3, 0x0412EC, 0x0413AD,
+	0x0414A7, 0x0415A9, 0x0416EA, 0x0417F4, 0x0418B8, 0x0419BE, 0x041AC7, 0x041BD1, 0x041CD3, 0x041DD5, 0x041ED7, 0x041FDD,
+	0x0420E2, 0x0421E4, 0x0422E6, 0x0423E8, 0x0424AB, 0x0425B6, 0x0426A5, 0x0427FC, 0x0428F6, 0x0429FA, 0x042A9F, 0x042BF2,
+	0x042CEE, 0x042DF8, 0x042E9D, 0x042FE0, 0x0430A0, 0x0431A2, 0x0432EB, 0x0433AC, 0x0434A6, 0x0435A8, 0x0436E9, 0x0437F3,
+	0x0438B7, 0x0439BD, 0x043AC6, 0x043BD0, 0x043CD2, 0x043DD4, 0x043ED6, 0x043FD8, 0x0440E1, 0x0441E3, 0x0442E5, 0x0443E7,
+	0x0444AA, 0x0445B5, 0x0446A4, 0x0447FB, 0x0448F5, 0x0449F9, 0x044A9E, 0x044BF1, 0x044CED, 0x044DF7, 0x044E9C, 0x044FDE,
+	0x045184, 0x045280, 0x045382, 0x045486, 0x045588, 0x04568A, 0x04578C, 0x04588E, 0x045990, 0x045A92, 0x045B94, 0x045C96,
+	0x045E98, 0x045F9A, 0x2116EF, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2,
+	0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC, 0x2563B9, 0x2566CB, 0x2569CA,
+	0x256CCE, 0x2580DF, 0x2584DC, 0x2588DB, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp857_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x0131, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x0130, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x015E, 0x015F,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x011E, 0x011F, 0x00BF, 0x00AE, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00C1, 0x00C2, 0x00C0, 0x00A9, 0x2563, 0x2551, 0x2557, 0x255D, 0x00A2, 0x00A5, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x00E3, 0x00C3, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x00A4,
+	0x00BA, 0x00AA, 0x00CA, 0x00CB, 0x00C8, 0x0000, 0x00CD, 0x00CE, 0x00CF, 0x2518, 0x250C, 0x2588, 0x2584, 0x00A6, 0x00CC, 0x2580,
+	0x00D3, 0x00DF, 0x00D4, 0x00D2, 0x00F5, 0x00D5, 0x00B5, 0x0000, 0x00D7, 0x00DA, 0x00DB, 0x00D9, 0x00EC, 0x00FF, 0x00AF, 0x00B4,
+	0x00AD, 0x00B1, 0x0000, 0x00BE, 0x00B6, 0x00A7, 0x00F7, 0x00B8, 0x00B0, 0x00A8, 0x00B7, 0x00B9, 0x00B3, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp857_encode[125] = {
+	0x00A0FF, 0x00A1AD, 0x00A2BD, 0x00A39C, 0x00A4CF, 0x00A5BE, 0x00A6DD, 0x00A7F5, 0x00A8F9, 0x00A9B8, 0x00AAD1, 0x00ABAE,
+	0x00ACAA, 0x00ADF0, 0x00AEA9, 0x00AFEE, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B3FC, 0x00B4EF, 0x00B5E6, 0x00B6F4, 0x00B7FA,
+	0x00B8F7, 0x00B9FB, 0x00BAD0, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BEF3, 0x00BFA8, 0x00C0B7, 0x00C1B5, 0x00C2B6, 0x00C3C7,
+	0x00C48E, 0x00C58F, 0x00C692, 0x00C780, 0x00C8D4, 0x00C990, 0x00CAD2, 0x00CBD3, 0x00CCDE, 0x00CDD6, 0x00CED7, 0x00CFD8,
+	0x00D1A5, 0x00D2E3, 0x00D3E0, 0x00D4E2, 0x00D5E5, 0x00D699, 0x00D7E8, 0x00D89D, 0x00D9EB, 0x00DAE9, 0x00DBEA, 0x00DC9A,
+	0x00DFE1, 0x00E085, 0x00E1A0, 0x00E283, 0x00E3C6, 0x00E484, 0x00E586, 0x00E691, 0x00E787, 0x00E88A, 0x00E982, 0x00EA88,
+	0x00EB89, 0x00ECEC, 0x00EDA1, 0x00EE8C, 0x00EF8B, 0x00F1A4, 0x00F295, 0x00F3A2, 0x00F493, 0x00F5E4, 0x00F694, 0x00F7F6,
+	0x00F89B, 0x00F997, 0x00FAA3, 0x00FB96, 0x00FC81, 0x00FFED, 0x011EA6, 0x011FA7, 0x013098, 0x01318D, 0x015E9E, 0x015F9F,
+	0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD,
+	0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC, 0x2563B9, 0x2566CB, 0x2569CA, 0x256CCE, 0x2580DF, 0x2584DC,
+	0x2588DB, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp860_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E3, 0x00E0, 0x00C1, 0x00E7, 0x00EA, 0x00CA, 0x00E8, 0x00CD, 0x00D4, 0x00EC, 0x00C3, 0x00C2,
+	0x00C9, 0x00C0, 0x00C8, 0x00F4, 0x00F5, 0x00F2, 0x00DA, 0x00F9, 0x00CC, 0x00D5, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x20A7, 0x00D3,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x00D2, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp860_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A29B, 0x00A39C, 0x00AAA6, 0x00ABAE, 0x00ACAA, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B5E6, 0x00B7FA,
+	0x00BAA7, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BFA8, 0x00C091, 0x00C186, 0x00C28F, 0x00C38E, 0x00C780, 0x00C892, 0x00C990,
+	0x00CA89, 0x00CC98, 0x00CD8B, 0x00D1A5, 0x00D2A9, 0x00D39F, 0x00D48C, 0x00D599, 0x00D99D, 0x00DA96, 0x00DC9A, 0x00DFE1,
+	0x00E085, 0x00E1A0, 0x00E283, 0x00E384, 0x00E787, 0x00E88A, 0x00E982, 0x00EA88, 0x00EC8D, 0x00EDA1, 0x00F1A4, 0x00F295,
+	0x00F3A2, 0x00F493, 0x00F594, 0x00F7F6, 0x00F997, 0x00FAA3, 0x00FC81, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA,
+	0x03B1E0, 0x03B4EB, 0x03B5EE, 0x03C0E3, 0x03C3E5, 0x03C4E7, 0x03C6ED, 0x207FFC, 0x20A79E, 0x2219F9, 0x221AFB, 0x221EEC,
+	0x2229EF, 0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp861_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00D0, 0x00F0, 0x00DE, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00FE, 0x00FB, 0x00DD, 0x00FD, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00C1, 0x00CD, 0x00D3, 0x00DA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp861_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A39C, 0x00ABAE, 0x00ACAA, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B5E6, 0x00B7FA, 0x00BBAF, 0x00BCAC,
+	0x00BDAB, 0x00BFA8, 0x00C1A4, 0x00C48E, 0x00C58F, 0x00C692, 0x00C780, 0x00C990, 0x00CDA5, 0x00D08B, 0x00D3A6, 0x00D699,
+	0x00D89D, 0x00DAA7, 0x00DC9A, 0x00DD97, 0x00DE8D, 0x00DFE1, 0x00E085, 0x00E1A0, 0x00E283, 0x00E484, 0x00E586, 0x00E691,
+	0x00E787, 0x00E88A, 0x00E982, 0x00EA88, 0x00EB89, 0x00EDA1, 0x00F08C, 0x00F3A2, 0x00F493, 0x00F694, 0x00F7F6, 0x00F89B,
+	0x00FAA3, 0x00FB96, 0x00FC81, 0x00FD98, 0x00FE95, 0x01929F, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA, 0x03B1E0,
+	0x03B4EB, 0x03B5EE, 0x03C0E3, 0x03C3E5, 0x03C4E7, 0x03C6ED, 0x207FFC, 0x20A79E, 0x2219F9, 0x221AFB, 0x221EEC, 0x2229EF,
+	0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2310A9, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp862_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+	0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp862_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A29B, 0x00A39C, 0x00A59D, 0x00AAA6, 0x00ABAE, 0x00ACAA, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B5E6,
+	0x00B7FA, 0x00BAA7, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BFA8, 0x00D1A5, 0x00DFE1, 0x00E1A0, 0x00EDA1, 0x00F1A4, 0x00F3A2,
+	0x00F7F6, 0x00FAA3, 0x01929F, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA, 0x03B1E0, 0x03B4EB, 0x03B5EE, 0x03C0E3,
+	0x03C3E5, 0x03C4E7, 0x03C6ED, 0x05D080, 0x05D181, 0x05D282, 0x05D383, 0x05D484, 0x05D585, 0x05D686, 0x05D787, 0x05D888,
+	0x05D989, 0x05DA8A, 0x05DB8B, 0x05DC8C, 0x05DD8D, 0x05DE8E, 0x05DF8F, 0x05E090, 0x05E191, 0x05E292, 0x05E393, 0x05E494,
+	0x05E595, 0x05E696, 0x05E797, 0x05E898, 0x05E999, 0x05EA9A, 0x207FFC, 0x20A79E, 0x2219F9, 0x221AFB, 0x221EEC, 0x2229EF,
+	0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2310A9, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp863_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00C2, 0x00E0, 0x00B6, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x2017, 0x00C0, 0x00A7,
+	0x00C9, 0x00C8, 0x00CA, 0x00F4, 0x00CB, 0x00CF, 0x00FB, 0x00F9, 0x00A4, 0x00D4, 0x00DC, 0x00A2, 0x00A3, 0x00D9, 0x00DB, 0x0192,
+	0x00A6, 0x00B4, 0x00F3, 0x00FA, 0x00A8, 0x00B8, 0x00B3, 0x00AF, 0x00CE, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00BE, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp863_encode[128] = {
+	0x00A0FF, 0x00A29B, 0x00A39C, 0x00A498, 0x00A6A0, 0x00A78F, 0x00A8A4, 0x00ABAE, 0x00ACAA, 0x00AFA7, 0x00B0F8, 0x00B1F1,
+	0x00B2FD, 0x00B3A6, 0x00B4A1, 0x00B5E6, 0x00B686, 0x00B7FA, 0x00B8A5, 0x00BBAF, 0x00BCAC, 0x00BDAB, 0x00BEAD, 0x00C08E,
+	0x00C284, 0x00C780, 0x00C891, 0x00C990, 0x00CA92, 0x00CB94, 0x00CEA8, 0x00CF95, 0x00D499, 0x00D99D, 0x00DB9E, 0x00DC9A,
+	0x00DFE1, 0x00E085, 0x00E283, 0x00E787, 0x00E88A, 0x00E982, 0x00EA88, 0x00EB89, 0x00EE8C, 0x00EF8B, 0x00F3A2, 0x00F493,
+	0x00F7F6, 0x00F997, 0x00FAA3, 0x00FB96, 0x00FC81, 0x01929F, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA, 0x03B1E0,
+	0x03B4EB, 0x03B5EE, 0x03C0E3, 0x03C3E5, 0x03C4E7, 0x03C6ED, 0x20178D, 0x207FFC, 0x2219F9, 0x221AFB, 0x221EEC, 0x2229EF,
+	0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2310A9, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp864_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x066A, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00B0, 0x00B7, 0x2219, 0x221A, 0x2592, 0x2500, 0x2502, 0x253C, 0x2524, 0x252C, 0x251C, 0x2534, 0x2510, 0x250C, 0x2514, 0x2518,
+	0x03B2, 0x221E, 0x03C6, 0x00B1, 0x00BD, 0x00BC, 0x2248, 0x00AB, 0x00BB, 0xFEF7, 0xFEF8, 0x0000, 0x0000, 0xFEFB, 0xFEFC, 0x0000,
+	0x00A0, 0x00AD, 0xFE82, 0x00A3, 0x00A4, 0xFE84, 0x0000, 0x0000, 0xFE8E, 0xFE8F, 0xFE95, 0xFE99, 0x060C, 0xFE9D, 0xFEA1, 0xFEA5,
+	0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0xFED1, 0x061B, 0xFEB1, 0xFEB5, 0xFEB9, 0x061F,
+	0x00A2, 0xFE80, 0xFE81, 0xFE83, 0xFE85, 0xFECA, 0xFE8B, 0xFE8D, 0xFE91, 0xFE93, 0xFE97, 0xFE9B, 0xFE9F, 0xFEA3, 0xFEA7, 0xFEA9,
+	0xFEAB, 0xFEAD, 0xFEAF, 0xFEB3, 0xFEB7, 0xFEBB, 0xFEBF, 0xFEC1, 0xFEC5, 0xFECB, 0xFECF, 0x00A6, 0x00AC, 0x00F7, 0x00D7, 0xFEC9,
+	0x0640, 0xFED3, 0xFED7, 0xFEDB, 0xFEDF, 0xFEE3, 0xFEE7, 0xFEEB, 0xFEED, 0xFEEF, 0xFEF3, 0xFEBD, 0xFECC, 0xFECE, 0xFECD, 0xFEE1,
+	0xFE7D, 0x0651, 0xFEE5, 0xFEE9, 0xFEEC, 0xFEF0, 0xFEF2, 0xFED0, 0xFED5, 0xFEF5, 0xFEF6, 0xFEDD, 0xFED9, 0xFEF1, 0x25A0, 0x0000,
+};
+PRIVATE uint32_t const codec_cp864_encode[250] = {
+	0x000000, 0x000101, 0x000202, 0x000303, 0x000404, 0x000505, 0x000606, 0x000707, 0x000808, 0x000909, 0x000A0A, 0x000B0B,
+	0x000C0C, 0x000D0D, 0x000E0E, 0x000F0F, 0x001010, 0x001111, 0x001212, 0x001313, 0x001414, 0x001515, 0x001616, 0x001717,
+	0x001818, 0x001919, 0x001A1A, 0x001B1B, 0x001C1C, 0x001D1D, 0x001E1E, 0x001F1F, 0x002020, 0x002121, 0x002222, 0x002323,
+	0x002424, 0x002626, 0x002727, 0x002828, 0x002929, 0x002A2A, 0x002B2B, 0x002C2C, 0x002D2D, 0x002E2E, 0x002F2F, 0x003030,
+	0x003131, 0x003232, 0x003333, 0x003434, 0x003535, 0x003636, 0x003737, 0x003838, 0x003939, 0x003A3A, 0x003B3B, 0x003C3C,
+	0x003D3D, 0x003E3E, 0x003F3F, 0x004040, 0x004141, 0x004242, 0x004343, 0x004444, 0x004545, 0x004646, 0x004747, 0x004848,
+	0x004949, 0x004A4A, 0x004B4B, 0x004C4C, 0x004D4D, 0x004E4E, 0x004F4F, 0x005050, 0x005151, 0x005252, 0x005353, 0x005454,
+	0x005555, 0x005656, 0x005757, 0x005858, 0x005959, 0x005A5A, 0x005B5B, 0x005C5C, 0x005D5D, 0x005E5E, 0x005F5F, 0x006060,
+	0x006161, 0x006262, 0x006363, 0x006464, 0x006565, 0x006666, 0x006767, 0x006868, 0x006969, 0x006A6A, 0x006B6B, 0x006C6C,
+	0x006D6D, 0x006E6E, 0x006F6F, 0x007070, 0x007171, 0x007272, 0x007373, 0x007474, 0x007575, 0x007676, 0x007777, 0x007878,
+	0x007979, 0x007A7A, 0x007B7B, 0x007C7C, 0x007D7D, 0x007E7E, 0x007F7F, 0x00A0A0, 0x00A2C0, 0x00A3A3, 0x00A4A4, 0x00A6DB,
+	0x00AB97, 0x00ACDC, 0x00ADA1, 0x00B080, 0x00B193, 0x00B781, 0x00BB98, 0x00BC95, 0x00BD94, 0x00D7DE, 0x00F7DD, 0x03B290,
+	0x03C692, 0x060CAC, 0x061BBB, 0x061FBF, 0x0640E0, 0x0651F1, 0x0660B0, 0x0661B1, 0x0662B2, 0x0663B3, 0x0664B4, 0x0665B5,
+	0x0666B6, 0x0667B7, 0x0668B8, 0x0669B9, 0x066A25, 0x221982, 0x221A83, 0x221E91, 0x224896, 0x250085, 0x250286, 0x250C8D,
+	0x25108C, 0x25148E, 0x25188F, 0x251C8A, 0x252488, 0x252C89, 0x25348B, 0x253C87, 0x259284, 0x25A0FE, 0xFE7DF0, 0xFE80C1,
+	0xFE81C2, 0xFE82A2, 0xFE83C3, 0xFE84A5, 0xFE85C4, 0xFE8BC6, 0xFE8DC7, 0xFE8EA8, 0xFE8FA9, 0xFE91C8, 0xFE93C9, 0xFE95AA,
+	0xFE97CA, 0xFE99AB, 0xFE9BCB, 0xFE9DAD, 0xFE9FCC, 0xFEA1AE, 0xFEA3CD, 0xFEA5AF, 0xFEA7CE, 0xFEA9CF, 0xFEABD0, 0xFEADD1,
+	0xFEAFD2, 0xFEB1BC, 0xFEB3D3, 0xFEB5BD, 0xFEB7D4, 0xFEB9BE, 0xFEBBD5, 0xFEBDEB, 0xFEBFD6, 0xFEC1D7, 0xFEC5D8, 0xFEC9DF,
+	0xFECAC5, 0xFECBD9, 0xFECCEC, 0xFECDEE, 0xFECEED, 0xFECFDA, 0xFED0F7, 0xFED1BA, 0xFED3E1, 0xFED5F8, 0xFED7E2, 0xFED9FC,
+	0xFEDBE3, 0xFEDDFB, 0xFEDFE4, 0xFEE1EF, 0xFEE3E5, 0xFEE5F2, 0xFEE7E6, 0xFEE9F3, 0xFEEBE7, 0xFEECF4, 0xFEEDE8, 0xFEEFE9,
+	0xFEF0F5, 0xFEF1FD, 0xFEF2F6, 0xFEF3EA, 0xFEF5F9, 0xFEF6FA, 0xFEF799, 0xFEF89A, 0xFEFB9D, 0xFEFC9E,
+};
+PRIVATE uint16_t const codec_cp865_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7, 0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+	0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9, 0x00FF, 0x00D6, 0x00DC, 0x00F8, 0x00A3, 0x00D8, 0x20A7, 0x0192,
+	0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA, 0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00A4,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4, 0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+	0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp865_encode[128] = {
+	0x00A0FF, 0x00A1AD, 0x00A39C, 0x00A4AF, 0x00AAA6, 0x00ABAE, 0x00ACAA, 0x00B0F8, 0x00B1F1, 0x00B2FD, 0x00B5E6, 0x00B7FA,
+	0x00BAA7, 0x00BCAC, 0x00BDAB, 0x00BFA8, 0x00C48E, 0x00C58F, 0x00C692, 0x00C780, 0x00C990, 0x00D1A5, 0x00D699, 0x00D89D,
+	0x00DC9A, 0x00DFE1, 0x00E085, 0x00E1A0, 0x00E283, 0x00E484, 0x00E586, 0x00E691, 0x00E787, 0x00E88A, 0x00E982, 0x00EA88,
+	0x00EB89, 0x00EC8D, 0x00EDA1, 0x00EE8C, 0x00EF8B, 0x00F1A4, 0x00F295, 0x00F3A2, 0x00F493, 0x00F694, 0x00F7F6, 0x00F89B,
+	0x00F997, 0x00FAA3, 0x00FB96, 0x00FC81, 0x00FF98, 0x01929F, 0x0393E2, 0x0398E9, 0x03A3E4, 0x03A6E8, 0x03A9EA, 0x03B1E0,
+	0x03B4EB, 0x03B5EE, 0x03C0E3, 0x03C3E5, 0x03C4E7, 0x03C6ED, 0x207FFC, 0x20A79E, 0x2219F9, 0x221AFB, 0x221EEC, 0x2229EF,
+	0x2248F7, 0x2261F0, 0x2264F3, 0x2265F2, 0x2310A9, 0x2320F4, 0x2321F5, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp866_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+	0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B, 0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+	0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E, 0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp866_encode[128] = {
+	0x00A0FF, 0x00A4FD, 0x00B0F8, 0x00B7FA, 0x0401F0, 0x0404F2, 0x0407F4, 0x040EF6, 0x041080, 0x041181, 0x041282, 0x041383,
+	0x041484, 0x041585, 0x041686, 0x041787, 0x041888, 0x041989, 0x041A8A, 0x041B8B, 0x041C8C, 0x041D8D, 0x041E8E, 0x041F8F,
+	0x042090, 0x042191, 0x042292, 0x042393, 0x042494, 0x042595, 0x042696, 0x042797, 0x042898, 0x042999, 0x042A9A, 0x042B9B,
+	0x042C9C, 0x042D9D, 0x042E9E, 0x042F9F, 0x0430A0, 0x0431A1, 0x0432A2, 0x0433A3, 0x0434A4, 0x0435A5, 0x0436A6, 0x0437A7,
+	0x0438A8, 0x0439A9, 0x043AAA, 0x043BAB, 0x043CAC, 0x043DAD, 0x043EAE, 0x043FAF, 0x0440E0, 0x0441E1, 0x0442E2, 0x0443E3,
+	0x0444E4, 0x0445E5, 0x0446E6, 0x0447E7, 0x0448E8, 0x0449E9, 0x044AEA, 0x044BEB, 0x044CEC, 0x044DED, 0x044EEE, 0x044FEF,
+	0x0451F1, 0x0454F3, 0x0457F5, 0x045EF7, 0x2116FC, 0x2219F9, 0x221AFB, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0,
+	0x2518D9, 0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2552D5, 0x2553D6, 0x2554C9, 0x2555B8,
+	0x2556B7, 0x2557BB, 0x2558D4, 0x2559D3, 0x255AC8, 0x255BBE, 0x255CBD, 0x255DBC, 0x255EC6, 0x255FC7, 0x2560CC, 0x2561B5,
+	0x2562B6, 0x2563B9, 0x2564D1, 0x2565D2, 0x2566CB, 0x2567CF, 0x2568D0, 0x2569CA, 0x256AD8, 0x256BD7, 0x256CCE, 0x2580DF,
+	0x2584DC, 0x2588DB, 0x258CDD, 0x2590DE, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp869_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0386, 0x0000, 0x00B7, 0x00AC, 0x00A6, 0x2018, 0x2019, 0x0388, 0x2015, 0x0389,
+	0x038A, 0x03AA, 0x038C, 0x0000, 0x0000, 0x038E, 0x03AB, 0x00A9, 0x038F, 0x00B2, 0x00B3, 0x03AC, 0x00A3, 0x03AD, 0x03AE, 0x03AF,
+	0x03CA, 0x0390, 0x03CC, 0x03CD, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x00BD, 0x0398, 0x0399, 0x00AB, 0x00BB,
+	0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x039A, 0x039B, 0x039C, 0x039D, 0x2563, 0x2551, 0x2557, 0x255D, 0x039E, 0x039F, 0x2510,
+	0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x03A0, 0x03A1, 0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x03A3,
+	0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x2518, 0x250C, 0x2588, 0x2584, 0x03B4, 0x03B5, 0x2580,
+	0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x0384,
+	0x00AD, 0x00B1, 0x03C5, 0x03C6, 0x03C7, 0x00A7, 0x03C8, 0x0385, 0x00B0, 0x00A8, 0x03C9, 0x03CB, 0x03B0, 0x03CE, 0x25A0, 0x00A0,
+};
+PRIVATE uint32_t const codec_cp869_encode[119] = {
+	0x00A0FF, 0x00A39C, 0x00A68A, 0x00A7F5, 0x00A8F9, 0x00A997, 0x00ABAE, 0x00AC89, 0x00ADF0, 0x00B0F8, 0x00B1F1, 0x00B299,
+	0x00B39A, 0x00B788, 0x00BBAF, 0x00BDAB, 0x0384EF, 0x0385F7, 0x038686, 0x03888D, 0x03898F, 0x038A90, 0x038C92, 0x038E95,
+	0x038F98, 0x0390A1, 0x0391A4, 0x0392A5, 0x0393A6, 0x0394A7, 0x0395A8, 0x0396A9, 0x0397AA, 0x0398AC, 0x0399AD, 0x039AB5,
+	0x039BB6, 0x039CB7, 0x039DB8, 0x039EBD, 0x039FBE, 0x03A0C6, 0x03A1C7, 0x03A3CF, 0x03A4D0, 0x03A5D1, 0x03A6D2, 0x03A7D3,
+	0x03A8D4, 0x03A9D5, 0x03AA91, 0x03AB96, 0x03AC9B, 0x03AD9D, 0x03AE9E, 0x03AF9F, 0x03B0FC, 0x03B1D6, 0x03B2D7, 0x03B3D8,
+	0x03B4DD, 0x03B5DE, 0x03B6E0, 0x03B7E1, 0x03B8E2, 0x03B9E3, 0x03BAE4, 0x03BBE5, 0x03BCE6, 0x03BDE7, 0x03BEE8, 0x03BFE9,
+	0x03C0EA, 0x03C1EB, 0x03C2ED, 0x03C3EC, 0x03C4EE, 0x03C5F2, 0x03C6F3, 0x03C7F4, 0x03C8F6, 0x03C9FA, 0x03CAA0, 0x03CBFB,
+	0x03CCA2, 0x03CDA3, 0x03CEFD, 0x20158E, 0x20188B, 0x20198C, 0x2500C4, 0x2502B3, 0x250CDA, 0x2510BF, 0x2514C0, 0x2518D9,
+	0x251CC3, 0x2524B4, 0x252CC2, 0x2534C1, 0x253CC5, 0x2550CD, 0x2551BA, 0x2554C9, 0x2557BB, 0x255AC8, 0x255DBC, 0x2560CC,
+	0x2563B9, 0x2566CB, 0x2569CA, 0x256CCE, 0x2580DF, 0x2584DC, 0x2588DB, 0x2591B0, 0x2592B1, 0x2593B2, 0x25A0FE,
+};
+PRIVATE uint16_t const codec_cp874_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x20AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x2026, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+	0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+	0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+	0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E3F,
+	0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+	0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+PRIVATE uint32_t const codec_cp874_encode[97] = {
+	0x00A0A0, 0x0E01A1, 0x0E02A2, 0x0E03A3, 0x0E04A4, 0x0E05A5, 0x0E06A6, 0x0E07A7, 0x0E08A8, 0x0E09A9, 0x0E0AAA, 0x0E0BAB,
+	0x0E0CAC, 0x0E0DAD, 0x0E0EAE, 0x0E0FAF, 0x0E10B0, 0x0E11B1, 0x0E12B2, 0x0E13B3, 0x0E14B4, 0x0E15B5, 0x0E16B6, 0x0E17B7,
+	0x0E18B8, 0x0E19B9, 0x0E1ABA, 0x0E1BBB, 0x0E1CBC, 0x0E1DBD, 0x0E1EBE, 0x0E1FBF, 0x0E20C0, 0x0E21C1, 0x0E22C2, 0x0E23C3,
+	0x0E24C4, 0x0E25C5, 0x0E26C6, 0x0E27C7, 0x0E28C8, 0x0E29C9, 0x0E2ACA, 0x0E2BCB, 0x0E2CCC, 0x0E2DCD, 0x0E2ECE, 0x0E2FCF,
+	0x0E30D0, 0x0E31D1, 0x0E32D2, 0x0E33D3, 0x0E34D4, 0x0E35D5, 0x0E36D6, 0x0E37D7, 0x0E38D8, 0x0E39D9, 0x0E3ADA, 0x0E3FDF,
+	0x0E40E0, 0x0E41E1, 0x0E42E2, 0x0E43E3, 0x0E44E4, 0x0E45E5, 0x0E46E6, 0x0E47E7, 0x0E48E8, 0x0E49E9, 0x0E4AEA, 0x0E4BEB,
+	0x0E4CEC, 0x0E4DED, 0x0E4EEE, 0x0E4FEF, 0x0E50F0, 0x0E51F1, 0x0E52F2, 0x0E53F3, 0x0E54F4, 0x0E55F5, 0x0E56F6, 0x0E57F7,
+	0x0E58F8, 0x0E59F9, 0x0E5AFA, 0x0E5BFB, 0x201396, 0x201497, 0x201891, 0x201992, 0x201C93, 0x201D94, 0x202295, 0x202685,
+	0x20AC80,
+};
+PRIVATE uint16_t const codec_cp875_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+	0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+	0x0020, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x005B, 0x002E, 0x003C, 0x0028, 0x002B, 0x0021,
+	0x0026, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x005D, 0x0024, 0x002A, 0x0029, 0x003B, 0x005E,
+	0x002D, 0x002F, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x007C, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+	0x00A8, 0x0386, 0x0388, 0x0389, 0x00A0, 0x038A, 0x038C, 0x038E, 0x038F, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+	0x0385, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6,
+	0x00B0, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC,
+	0x00B4, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
+	0x00A3, 0x03AC, 0x03AD, 0x03AE, 0x03CA, 0x03AF, 0x03CC, 0x03CD, 0x03CB, 0x03CE, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8,
+	0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x00AD, 0x03C9, 0x0390, 0x03B0, 0x2018, 0x2015,
+	0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x00B1, 0x00BD, 0x001A, 0x0387, 0x2019, 0x00A6,
+	0x005C, 0x001A, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x00B2, 0x00A7, 0x001A, 0x001A, 0x00AB, 0x00AC,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x00B3, 0x00A9, 0x001A, 0x001A, 0x00BB, 0x009F,
+};
+PRIVATE uint32_t const codec_cp875_encode[250] = {
+	0x000000, 0x000101, 0x000202, 0x000303, 0x000437, 0x00052D, 0x00062E, 0x00072F, 0x000816, 0x000905, 0x000A25, 0x000B0B,
+	0x000C0C, 0x000D0D, 0x000E0E, 0x000F0F, 0x001010, 0x001111, 0x001212, 0x001313, 0x00143C, 0x00153D, 0x001632, 0x001726,
+	0x001818, 0x001919, 0x001A3F, 0x001B27, 0x001C1C, 0x001D1D, 0x001E1E, 0x001F1F, 0x002040, 0x00214F, 0x00227F, 0x00237B,
+	0x00245B, 0x00256C, 0x002650, 0x00277D, 0x00284D, 0x00295D, 0x002A5C, 0x002B4E, 0x002C6B, 0x002D60, 0x002E4B, 0x002F61,
+	0x0030F0, 0x0031F1, 0x0032F2, 0x0033F3, 0x0034F4, 0x0035F5, 0x0036F6, 0x0037F7, 0x0038F8, 0x0039F9, 0x003A7A, 0x003B5E,
+	0x003C4C, 0x003D7E, 0x003E6E, 0x003F6F, 0x00407C, 0x0041C1, 0x0042C2, 0x0043C3, 0x0044C4, 0x0045C5, 0x0046C6, 0x0047C7,
+	0x0048C8, 0x0049C9, 0x004AD1, 0x004BD2, 0x004CD3, 0x004DD4, 0x004ED5, 0x004FD6, 0x0050D7, 0x0051D8, 0x0052D9, 0x0053E2,
+	0x0054E3, 0x0055E4, 0x0056E5, 0x0057E6, 0x0058E7, 0x0059E8, 0x005AE9, 0x005B4A, 0x005CE0, 0x005D5A, 0x005E5F, 0x005F6D,
+	0x006079, 0x006181, 0x006282, 0x006383, 0x006484, 0x006585, 0x006686, 0x006787, 0x006888, 0x006989, 0x006A91, 0x006B92,
+	0x006C93, 0x006D94, 0x006E95, 0x006F96, 0x007097, 0x007198, 0x007299, 0x0073A2, 0x0074A3, 0x0075A4, 0x0076A5, 0x0077A6,
+	0x0078A7, 0x0079A8, 0x007AA9, 0x007BC0, 0x007C6A, 0x007DD0, 0x007EA1, 0x007F07, 0x008020, 0x008121, 0x008222, 0x008323,
+	0x008424, 0x008515, 0x008606, 0x008717, 0x008828, 0x008929, 0x008A2A, 0x008B2B, 0x008C2C, 0x008D09, 0x008E0A, 0x008F1B,
+	0x009030, 0x009131, 0x00921A, 0x009333, 0x009434, 0x009535, 0x009636, 0x009708, 0x009838, 0x009939, 0x009A3A, 0x009B3B,
+	0x009C04, 0x009D14, 0x009E3E, 0x009FFF, 0x00A074, 0x00A3B0, 0x00A6DF, 0x00A7EB, 0x00A870, 0x00A9FB, 0x00ABEE, 0x00ACEF,
+	0x00ADCA, 0x00B090, 0x00B1DA, 0x00B2EA, 0x00B3FA, 0x00B4A0, 0x00BBFE, 0x00BDDB, 0x038580, 0x038671, 0x0387DD, 0x038872,
+	0x038973, 0x038A75, 0x038C76, 0x038E77, 0x038F78, 0x0390CC, 0x039141, 0x039242, 0x039343, 0x039444, 0x039545, 0x039646,
+	0x039747, 0x039848, 0x039949, 0x039A51, 0x039B52, 0x039C53, 0x039D54, 0x039E55, 0x039F56, 0x03A057, 0x03A158, 0x03A359,
+	0x03A462, 0x03A563, 0x03A664, 0x03A765, 0x03A866, 0x03A967, 0x03AA68, 0x03AB69, 0x03ACB1, 0x03ADB2, 0x03AEB3, 0x03AFB5,
+	0x03B0CD, 0x03B18A, 0x03B28B, 0x03B38C, 0x03B48D, 0x03B58E, 0x03B68F, 0x03B79A, 0x03B89B, 0x03B99C, 0x03BA9D, 0x03BB9E,
+	0x03BC9F, 0x03BDAA, 0x03BEAB, 0x03BFAC, 0x03C0AD, 0x03C1AE, 0x03C2BA, 0x03C3AF, 0x03C4BB, 0x03C5BC, 0x03C6BD, 0x03C7BE,
+	0x03C8BF, 0x03C9CB, 0x03CAB4, 0x03CBB8, 0x03CCB6, 0x03CDB7, 0x03CEB9, 0x2015CF, 0x2018CE, 0x2019DE,
+};
+PRIVATE uint16_t const codec_iso8859_10_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0104, 0x0112, 0x0122, 0x012A, 0x0128, 0x0136, 0x00A7, 0x013B, 0x0110, 0x0160, 0x0166, 0x017D, 0x00AD, 0x016A, 0x014A,
+	0x00B0, 0x0105, 0x0113, 0x0123, 0x012B, 0x0129, 0x0137, 0x00B7, 0x013C, 0x0111, 0x0161, 0x0167, 0x017E, 0x2015, 0x016B, 0x014B,
+	0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x0145, 0x014C, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0168, 0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x00EF,
+	0x00F0, 0x0146, 0x014D, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0169, 0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0138,
+};
+PRIVATE uint32_t const codec_iso8859_10_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7A7, 0x00ADAD, 0x00B0B0,
+	0x00B7B7, 0x00C1C1, 0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C9C9, 0x00CBCB, 0x00CDCD, 0x00CECE, 0x00CFCF,
+	0x00D0D0, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D8D8, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF,
+	0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F0F0,
+	0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F8F8, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x0100C0, 0x0101E0,
+	0x0104A1, 0x0105B1, 0x010CC8, 0x010DE8, 0x0110A9, 0x0111B9, 0x0112A2, 0x0113B2, 0x0116CC, 0x0117EC, 0x0118CA, 0x0119EA,
+	0x0122A3, 0x0123B3, 0x0128A5, 0x0129B5, 0x012AA4, 0x012BB4, 0x012EC7, 0x012FE7, 0x0136A6, 0x0137B6, 0x0138FF, 0x013BA8,
+	0x013CB8, 0x0145D1, 0x0146F1, 0x014AAF, 0x014BBF, 0x014CD2, 0x014DF2, 0x0160AA, 0x0161BA, 0x0166AB, 0x0167BB, 0x0168D7,
+	0x0169F7, 0x016AAE, 0x016BBE, 0x0172D9, 0x0173F9, 0x017DAC, 0x017EBC, 0x2015BD,
+};
+PRIVATE uint16_t const codec_iso8859_11_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+	0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+	0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+	0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E3F,
+	0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+	0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+PRIVATE uint32_t const codec_iso8859_11_encode[120] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x0E01A1, 0x0E02A2, 0x0E03A3,
+	0x0E04A4, 0x0E05A5, 0x0E06A6, 0x0E07A7, 0x0E08A8, 0x0E09A9, 0x0E0AAA, 0x0E0BAB, 0x0E0CAC, 0x0E0DAD, 0x0E0EAE, 0x0E0FAF,
+	0x0E10B0, 0x0E11B1, 0x0E12B2, 0x0E13B3, 0x0E14B4, 0x0E15B5, 0x0E16B6, 0x0E17B7, 0x0E18B8, 0x0E19B9, 0x0E1ABA, 0x0E1BBB,
+	0x0E1CBC, 0x0E1DBD, 0x0E1EBE, 0x0E1FBF, 0x0E20C0, 0x0E21C1, 0x0E22C2, 0x0E23C3, 0x0E24C4, 0x0E25C5, 0x0E26C6, 0x0E27C7,
+	0x0E28C8, 0x0E29C9, 0x0E2ACA, 0x0E2BCB, 0x0E2CCC, 0x0E2DCD, 0x0E2ECE, 0x0E2FCF, 0x0E30D0, 0x0E31D1, 0x0E32D2, 0x0E33D3,
+	0x0E34D4, 0x0E35D5, 0x0E36D6, 0x0E37D7, 0x0E38D8, 0x0E39D9, 0x0E3ADA, 0x0E3FDF, 0x0E40E0, 0x0E41E1, 0x0E42E2, 0x0E43E3,
+	0x0E44E4, 0x0E45E5, 0x0E46E6, 0x0E47E7, 0x0E48E8, 0x0E49E9, 0x0E4AEA, 0x0E4BEB, 0x0E4CEC, 0x0E4DED, 0x0E4EEE, 0x0E4FEF,
+	0x0E50F0, 0x0E51F1, 0x0E52F2, 0x0E53F3, 0x0E54F4, 0x0E55F5, 0x0E56F6, 0x0E57F7, 0x0E58F8, 0x0E59F9, 0x0E5AFA, 0x0E5BFB,
+};
+PRIVATE uint16_t const codec_iso8859_13_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x201D, 0x00A2, 0x00A3, 0x00A4, 0x201E, 0x00A6, 0x00A7, 0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x201C, 0x00B5, 0x00B6, 0x00B7, 0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+	0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112, 0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+	0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7, 0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+	0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113, 0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+	0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7, 0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x2019,
+};
+PRIVATE uint32_t const codec_iso8859_13_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4,
+	0x00A6A6, 0x00A7A7, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B5B5,
+	0x00B6B6, 0x00B7B7, 0x00B9B9, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00C4C4, 0x00C5C5, 0x00C6AF, 0x00C9C9, 0x00D3D3,
+	0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8A8, 0x00DCDC, 0x00DFDF, 0x00E4E4, 0x00E5E5, 0x00E6BF, 0x00E9E9, 0x00F3F3, 0x00F5F5,
+	0x00F6F6, 0x00F7F7, 0x00F8B8, 0x00FCFC, 0x0100C2, 0x0101E2, 0x0104C0, 0x0105E0, 0x0106C3, 0x0107E3, 0x010CC8, 0x010DE8,
+	0x0112C7, 0x0113E7, 0x0116CB, 0x0117EB, 0x0118C6, 0x0119E6, 0x0122CC, 0x0123EC, 0x012ACE, 0x012BEE, 0x012EC1, 0x012FE1,
+	0x0136CD, 0x0137ED, 0x013BCF, 0x013CEF, 0x0141D9, 0x0142F9, 0x0143D1, 0x0144F1, 0x0145D2, 0x0146F2, 0x014CD4, 0x014DF4,
+	0x0156AA, 0x0157BA, 0x015ADA, 0x015BFA, 0x0160D0, 0x0161F0, 0x016ADB, 0x016BFB, 0x0172D8, 0x0173F8, 0x0179CA, 0x017AEA,
+	0x017BDD, 0x017CFD, 0x017DDE, 0x017EFE, 0x2019FF, 0x201CB4, 0x201DA1, 0x201EA5,
+};
+PRIVATE uint16_t const codec_iso8859_14_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x1E02, 0x1E03, 0x00A3, 0x010A, 0x010B, 0x1E0A, 0x00A7, 0x1E80, 0x00A9, 0x1E82, 0x1E0B, 0x1EF2, 0x00AD, 0x00AE, 0x0178,
+	0x1E1E, 0x1E1F, 0x0120, 0x0121, 0x1E40, 0x1E41, 0x00B6, 0x1E56, 0x1E81, 0x1E57, 0x1E83, 0x1E60, 0x1EF3, 0x1E84, 0x1E85, 0x1E61,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x0174, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x1E6A, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x0176, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x0175, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x1E6B, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x0177, 0x00FF,
+};
+PRIVATE uint32_t const codec_iso8859_14_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A7A7, 0x00A9A9,
+	0x00ADAD, 0x00AEAE, 0x00B6B6, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8,
+	0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5,
+	0x00D6D6, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DDDD, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3,
+	0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF,
+	0x00F1F1, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD,
+	0x00FFFF, 0x010AA4, 0x010BA5, 0x0120B2, 0x0121B3, 0x0174D0, 0x0175F0, 0x0176DE, 0x0177FE, 0x0178AF, 0x1E02A1, 0x1E03A2,
+	0x1E0AA6, 0x1E0BAB, 0x1E1EB0, 0x1E1FB1, 0x1E40B4, 0x1E41B5, 0x1E56B7, 0x1E57B9, 0x1E60BB, 0x1E61BF, 0x1E6AD7, 0x1E6BF7,
+	0x1E80A8, 0x1E81B8, 0x1E82AA, 0x1E83BA, 0x1E84BD, 0x1E85BE, 0x1EF2AC, 0x1EF3BC,
+};
+PRIVATE uint16_t const codec_iso8859_15_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AC, 0x00A5, 0x0160, 0x00A7, 0x0161, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x017D, 0x00B5, 0x00B6, 0x00B7, 0x017E, 0x00B9, 0x00BA, 0x00BB, 0x0152, 0x0153, 0x0178, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+};
+PRIVATE uint32_t const codec_iso8859_15_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3,
+	0x00A5A5, 0x00A7A7, 0x00A9A9, 0x00AAAA, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1, 0x00B2B2,
+	0x00B3B3, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B9B9, 0x00BABA, 0x00BBBB, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3,
+	0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF,
+	0x00D0D0, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB,
+	0x00DCDC, 0x00DDDD, 0x00DEDE, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7,
+	0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F0F0, 0x00F1F1, 0x00F2F2, 0x00F3F3,
+	0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FDFD, 0x00FEFE, 0x00FFFF,
+	0x0152BC, 0x0153BD, 0x0160A6, 0x0161A8, 0x0178BE, 0x017DB4, 0x017EB8, 0x20ACA4,
+};
+PRIVATE uint16_t const codec_iso8859_16_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0104, 0x0105, 0x0141, 0x20AC, 0x201E, 0x0160, 0x00A7, 0x0161, 0x00A9, 0x0218, 0x00AB, 0x0179, 0x00AD, 0x017A, 0x017B,
+	0x00B0, 0x00B1, 0x010C, 0x0142, 0x017D, 0x201D, 0x00B6, 0x00B7, 0x017E, 0x010D, 0x0219, 0x00BB, 0x0152, 0x0153, 0x0178, 0x017C,
+	0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0106, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x0110, 0x0143, 0x00D2, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x015A, 0x0170, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0118, 0x021A, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x0107, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x0111, 0x0144, 0x00F2, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x015B, 0x0171, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0119, 0x021B, 0x00FF,
+};
+PRIVATE uint32_t const codec_iso8859_16_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7A7, 0x00A9A9, 0x00ABAB,
+	0x00ADAD, 0x00B0B0, 0x00B1B1, 0x00B6B6, 0x00B7B7, 0x00BBBB, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C4C4, 0x00C6C6, 0x00C7C7,
+	0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D6D6,
+	0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2, 0x00E4E4, 0x00E6E6, 0x00E7E7, 0x00E8E8,
+	0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F9F9,
+	0x00FAFA, 0x00FBFB, 0x00FCFC, 0x00FFFF, 0x0102C3, 0x0103E3, 0x0104A1, 0x0105A2, 0x0106C5, 0x0107E5, 0x010CB2, 0x010DB9,
+	0x0110D0, 0x0111F0, 0x0118DD, 0x0119FD, 0x0141A3, 0x0142B3, 0x0143D1, 0x0144F1, 0x0150D5, 0x0151F5, 0x0152BC, 0x0153BD,
+	0x015AD7, 0x015BF7, 0x0160A6, 0x0161A8, 0x0170D8, 0x0171F8, 0x0178BE, 0x0179AC, 0x017AAE, 0x017BAF, 0x017CBF, 0x017DB4,
+	0x017EB8, 0x0218AA, 0x0219BA, 0x021ADE, 0x021BFE, 0x201DB5, 0x201EA5, 0x20ACA4,
+};
+PRIVATE uint16_t const codec_iso8859_2_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0104, 0x02D8, 0x0141, 0x00A4, 0x013D, 0x015A, 0x00A7, 0x00A8, 0x0160, 0x015E, 0x0164, 0x0179, 0x00AD, 0x017D, 0x017B,
+	0x00B0, 0x0105, 0x02DB, 0x0142, 0x00B4, 0x013E, 0x015B, 0x02C7, 0x00B8, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C,
+	0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+	0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7, 0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+	0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+	0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7, 0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9,
+};
+PRIVATE uint32_t const codec_iso8859_2_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00A7A7, 0x00A8A8,
+	0x00ADAD, 0x00B0B0, 0x00B4B4, 0x00B8B8, 0x00C1C1, 0x00C2C2, 0x00C4C4, 0x00C7C7, 0x00C9C9, 0x00CBCB, 0x00CDCD, 0x00CECE,
+	0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00DADA, 0x00DCDC, 0x00DDDD, 0x00DFDF, 0x00E1E1, 0x00E2E2, 0x00E4E4, 0x00E7E7,
+	0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00FAFA, 0x00FCFC, 0x00FDFD, 0x0102C3,
+	0x0103E3, 0x0104A1, 0x0105B1, 0x0106C6, 0x0107E6, 0x010CC8, 0x010DE8, 0x010ECF, 0x010FEF, 0x0110D0, 0x0111F0, 0x0118CA,
+	0x0119EA, 0x011ACC, 0x011BEC, 0x0139C5, 0x013AE5, 0x013DA5, 0x013EB5, 0x0141A3, 0x0142B3, 0x0143D1, 0x0144F1, 0x0147D2,
+	0x0148F2, 0x0150D5, 0x0151F5, 0x0154C0, 0x0155E0, 0x0158D8, 0x0159F8, 0x015AA6, 0x015BB6, 0x015EAA, 0x015FBA, 0x0160A9,
+	0x0161B9, 0x0162DE, 0x0163FE, 0x0164AB, 0x0165BB, 0x016ED9, 0x016FF9, 0x0170DB, 0x0171FB, 0x0179AC, 0x017ABC, 0x017BAF,
+	0x017CBF, 0x017DAE, 0x017EBE, 0x02C7B7, 0x02D8A2, 0x02D9FF, 0x02DBB2, 0x02DDBD,
+};
+PRIVATE uint16_t const codec_iso8859_3_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0126, 0x02D8, 0x00A3, 0x00A4, 0x0000, 0x0124, 0x00A7, 0x00A8, 0x0130, 0x015E, 0x011E, 0x0134, 0x00AD, 0x0000, 0x017B,
+	0x00B0, 0x0127, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0125, 0x00B7, 0x00B8, 0x0131, 0x015F, 0x011F, 0x0135, 0x00BD, 0x0000, 0x017C,
+	0x00C0, 0x00C1, 0x00C2, 0x0000, 0x00C4, 0x010A, 0x0108, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x0000, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x0120, 0x00D6, 0x00D7, 0x011C, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x016C, 0x015C, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x0000, 0x00E4, 0x010B, 0x0109, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x0000, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x0121, 0x00F6, 0x00F7, 0x011D, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x016D, 0x015D, 0x02D9,
+};
+PRIVATE uint32_t const codec_iso8859_3_encode[121] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A4A4, 0x00A7A7,
+	0x00A8A8, 0x00ADAD, 0x00B0B0, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B7B7, 0x00B8B8, 0x00BDBD, 0x00C0C0, 0x00C1C1,
+	0x00C2C2, 0x00C4C4, 0x00C7C7, 0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1,
+	0x00D2D2, 0x00D3D3, 0x00D4D4, 0x00D6D6, 0x00D7D7, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1,
+	0x00E2E2, 0x00E4E4, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE, 0x00EFEF, 0x00F1F1,
+	0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F6F6, 0x00F7F7, 0x00F9F9, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x0108C6, 0x0109E6, 0x010AC5,
+	0x010BE5, 0x011CD8, 0x011DF8, 0x011EAB, 0x011FBB, 0x0120D5, 0x0121F5, 0x0124A6, 0x0125B6, 0x0126A1, 0x0127B1, 0x0130A9,
+	0x0131B9, 0x0134AC, 0x0135BC, 0x015CDE, 0x015DFE, 0x015EAA, 0x015FBA, 0x016CDD, 0x016DFD, 0x017BAF, 0x017CBF, 0x02D8A2,
+	0x02D9FF,
+};
+PRIVATE uint16_t const codec_iso8859_4_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0104, 0x0138, 0x0156, 0x00A4, 0x0128, 0x013B, 0x00A7, 0x00A8, 0x0160, 0x0112, 0x0122, 0x0166, 0x00AD, 0x017D, 0x00AF,
+	0x00B0, 0x0105, 0x02DB, 0x0157, 0x00B4, 0x0129, 0x013C, 0x02C7, 0x00B8, 0x0161, 0x0113, 0x0123, 0x0167, 0x014A, 0x017E, 0x014B,
+	0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E, 0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x012A,
+	0x0110, 0x0145, 0x014C, 0x0136, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x0168, 0x016A, 0x00DF,
+	0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F, 0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x012B,
+	0x0111, 0x0146, 0x014D, 0x0137, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x0169, 0x016B, 0x02D9,
+};
+PRIVATE uint32_t const codec_iso8859_4_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00A7A7, 0x00A8A8,
+	0x00ADAD, 0x00AFAF, 0x00B0B0, 0x00B4B4, 0x00B8B8, 0x00C1C1, 0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C9C9,
+	0x00CBCB, 0x00CDCD, 0x00CECE, 0x00D4D4, 0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF,
+	0x00E1E1, 0x00E2E2, 0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E9E9, 0x00EBEB, 0x00EDED, 0x00EEEE, 0x00F4F4, 0x00F5F5,
+	0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00FAFA, 0x00FBFB, 0x00FCFC, 0x0100C0, 0x0101E0, 0x0104A1, 0x0105B1, 0x010CC8, 0x010DE8,
+	0x0110D0, 0x0111F0, 0x0112AA, 0x0113BA, 0x0116CC, 0x0117EC, 0x0118CA, 0x0119EA, 0x0122AB, 0x0123BB, 0x0128A5, 0x0129B5,
+	0x012ACF, 0x012BEF, 0x012EC7, 0x012FE7, 0x0136D3, 0x0137F3, 0x0138A2, 0x013BA6, 0x013CB6, 0x0145D1, 0x0146F1, 0x014ABD,
+	0x014BBF, 0x014CD2, 0x014DF2, 0x0156A3, 0x0157B3, 0x0160A9, 0x0161B9, 0x0166AC, 0x0167BC, 0x0168DD, 0x0169FD, 0x016ADE,
+	0x016BFE, 0x0172D9, 0x0173F9, 0x017DAE, 0x017EBE, 0x02C7B7, 0x02D9FF, 0x02DBB2,
+};
+PRIVATE uint16_t const codec_iso8859_5_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x00AD, 0x040E, 0x040F,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+	0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x00A7, 0x045E, 0x045F,
+};
+PRIVATE uint32_t const codec_iso8859_5_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A7FD, 0x00ADAD, 0x0401A1,
+	0x0402A2, 0x0403A3, 0x0404A4, 0x0405A5, 0x0406A6, 0x0407A7, 0x0408A8, 0x0409A9, 0x040AAA, 0x040BAB, 0x040CAC, 0x040EAE,
+	0x040FAF, 0x0410B0, 0x0411B1, 0x0412B2, 0x0413B3, 0x0414B4, 0x0415B5, 0x0416B6, 0x0417B7, 0x0418B8, 0x0419B9, 0x041ABA,
+	0x041BBB, 0x041CBC, 0x041DBD, 0x041EBE, 0x041FBF, 0x0420C0, 0x0421C1, 0x0422C2, 0x0423C3, 0x0424C4, 0x0425C5, 0x0426C6,
+	0x0427C7, 0x0428C8, 0x0429C9, 0x042ACA, 0x042BCB, 0x042CCC, 0x042DCD, 0x042ECE, 0x042FCF, 0x0430D0, 0x0431D1, 0x0432D2,
+	0x0433D3, 0x0434D4, 0x0435D5, 0x0436D6, 0x0437D7, 0x0438D8, 0x0439D9, 0x043ADA, 0x043BDB, 0x043CDC, 0x043DDD, 0x043EDE,
+	0x043FDF, 0x0440E0, 0x0441E1, 0x0442E2, 0x0443E3, 0x0444E4, 0x0445E5, 0x0446E6, 0x0447E7, 0x0448E8, 0x0449E9, 0x044AEA,
+	0x044BEB, 0x044CEC, 0x044DED, 0x044EEE, 0x044FEF, 0x0451F1, 0x0452F2, 0x0453F3, 0x0454F4, 0x0455F5, 0x0456F6, 0x0457F7,
+	0x0458F8, 0x0459F9, 0x045AFA, 0x045BFB, 0x045CFC, 0x045EFE, 0x045FFF, 0x2116F0,
+};
+PRIVATE uint16_t const codec_iso8859_6_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0000, 0x0000, 0x0000, 0x00A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x060C, 0x00AD, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x061B, 0x0000, 0x0000, 0x0000, 0x061F,
+	0x0000, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+	0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+	0x0650, 0x0651, 0x0652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+PRIVATE uint32_t const codec_iso8859_6_encode[83] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A4A4, 0x00ADAD, 0x060CAC,
+	0x061BBB, 0x061FBF, 0x0621C1, 0x0622C2, 0x0623C3, 0x0624C4, 0x0625C5, 0x0626C6, 0x0627C7, 0x0628C8, 0x0629C9, 0x062ACA,
+	0x062BCB, 0x062CCC, 0x062DCD, 0x062ECE, 0x062FCF, 0x0630D0, 0x0631D1, 0x0632D2, 0x0633D3, 0x0634D4, 0x0635D5, 0x0636D6,
+	0x0637D7, 0x0638D8, 0x0639D9, 0x063ADA, 0x0640E0, 0x0641E1, 0x0642E2, 0x0643E3, 0x0644E4, 0x0645E5, 0x0646E6, 0x0647E7,
+	0x0648E8, 0x0649E9, 0x064AEA, 0x064BEB, 0x064CEC, 0x064DED, 0x064EEE, 0x064FEF, 0x0650F0, 0x0651F1, 0x0652F2,
+};
+PRIVATE uint16_t const codec_iso8859_7_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x2018, 0x2019, 0x00A3, 0x20AC, 0x20AF, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x037A, 0x00AB, 0x00AC, 0x00AD, 0x0000, 0x2015,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x0385, 0x0386, 0x00B7, 0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+	0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+	0x03A0, 0x03A1, 0x0000, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+	0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+	0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x0000,
+};
+PRIVATE uint32_t const codec_iso8859_7_encode[125] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A3A3, 0x00A6A6, 0x00A7A7,
+	0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B7B7, 0x00BBBB, 0x00BDBD,
+	0x037AAA, 0x0384B4, 0x0385B5, 0x0386B6, 0x0388B8, 0x0389B9, 0x038ABA, 0x038CBC, 0x038EBE, 0x038FBF, 0x0390C0, 0x0391C1,
+	0x0392C2, 0x0393C3, 0x0394C4, 0x0395C5, 0x0396C6, 0x0397C7, 0x0398C8, 0x0399C9, 0x039ACA, 0x039BCB, 0x039CCC, 0x039DCD,
+	0x039ECE, 0x039FCF, 0x03A0D0, 0x03A1D1, 0x03A3D3, 0x03A4D4, 0x03A5D5, 0x03A6D6, 0x03A7D7, 0x03A8D8, 0x03A9D9, 0x03AADA,
+	0x03ABDB, 0x03ACDC, 0x03ADDD, 0x03AEDE, 0x03AFDF, 0x03B0E0, 0x03B1E1, 0x03B2E2, 0x03B3E3, 0x03B4E4, 0x03B5E5, 0x03B6E6,
+	0x03B7E7, 0x03B8E8, 0x03B9E9, 0x03BAEA, 0x03BBEB, 0x03BCEC, 0x03BDED, 0x03BEEE, 0x03BFEF, 0x03C0F0, 0x03C1F1, 0x03C2F2,
+	0x03C3F3, 0x03C4F4, 0x03C5F5, 0x03C6F6, 0x03C7F7, 0x03C8F8, 0x03C9F9, 0x03CAFA, 0x03CBFB, 0x03CCFC, 0x03CDFD, 0x03CEFE,
+	0x2015AF, 0x2018A1, 0x2019A2, 0x20ACA4, 0x20AFA5,
+};
+PRIVATE uint16_t const codec_iso8859_8_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x0000, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2017,
+	0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+	0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x0000, 0x0000, 0x200E, 0x200F, 0x0000,
+};
+PRIVATE uint32_t const codec_iso8859_8_encode[92] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A2A2, 0x00A3A3, 0x00A4A4,
+	0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF, 0x00B0B0, 0x00B1B1,
+	0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9, 0x00BBBB, 0x00BCBC, 0x00BDBD, 0x00BEBE,
+	0x00D7AA, 0x00F7BA, 0x05D0E0, 0x05D1E1, 0x05D2E2, 0x05D3E3, 0x05D4E4, 0x05D5E5, 0x05D6E6, 0x05D7E7, 0x05D8E8, 0x05D9E9,
+	0x05DAEA, 0x05DBEB, 0x05DCEC, 0x05DDED, 0x05DEEE, 0x05DFEF, 0x05E0F0, 0x05E1F1, 0x05E2F2, 0x05E3F3, 0x05E4F4, 0x05E5F5,
+	0x05E6F6, 0x05E7F7, 0x05E8F8, 0x05E9F9, 0x05EAFA, 0x200EFD, 0x200FFE, 0x2017DF,
+};
+PRIVATE uint16_t const codec_iso8859_9_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+	0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF,
+};
+PRIVATE uint32_t const codec_iso8859_9_encode[128] = {
+	0x008080, 0x008181, 0x008282, 0x008383, 0x008484, 0x008585, 0x008686, 0x008787, 0x008888, 0x008989, 0x008A8A, 0x008B8B,
+	0x008C8C, 0x008D8D, 0x008E8E, 0x008F8F, 0x009090, 0x009191, 0x009292, 0x009393, 0x009494, 0x009595, 0x009696, 0x009797,
+	0x009898, 0x009999, 0x009A9A, 0x009B9B, 0x009C9C, 0x009D9D, 0x009E9E, 0x009F9F, 0x00A0A0, 0x00A1A1, 0x00A2A2, 0x00A3A3,
+	0x00A4A4, 0x00A5A5, 0x00A6A6, 0x00A7A7, 0x00A8A8, 0x00A9A9, 0x00AAAA, 0x00ABAB, 0x00ACAC, 0x00ADAD, 0x00AEAE, 0x00AFAF,
+	0x00B0B0, 0x00B1B1, 0x00B2B2, 0x00B3B3, 0x00B4B4, 0x00B5B5, 0x00B6B6, 0x00B7B7, 0x00B8B8, 0x00B9B9, 0x00BABA, 0x00BBBB,
+	0x00BCBC, 0x00BDBD, 0x00BEBE, 0x00BFBF, 0x00C0C0, 0x00C1C1, 0x00C2C2, 0x00C3C3, 0x00C4C4, 0x00C5C5, 0x00C6C6, 0x00C7C7,
+	0x00C8C8, 0x00C9C9, 0x00CACA, 0x00CBCB, 0x00CCCC, 0x00CDCD, 0x00CECE, 0x00CFCF, 0x00D1D1, 0x00D2D2, 0x00D3D3, 0x00D4D4,
+	0x00D5D5, 0x00D6D6, 0x00D7D7, 0x00D8D8, 0x00D9D9, 0x00DADA, 0x00DBDB, 0x00DCDC, 0x00DFDF, 0x00E0E0, 0x00E1E1, 0x00E2E2,
+	0x00E3E3, 0x00E4E4, 0x00E5E5, 0x00E6E6, 0x00E7E7, 0x00E8E8, 0x00E9E9, 0x00EAEA, 0x00EBEB, 0x00ECEC, 0x00EDED, 0x00EEEE,
+	0x00EFEF, 0x00F1F1, 0x00F2F2, 0x00F3F3, 0x00F4F4, 0x00F5F5, 0x00F6F6, 0x00F7F7, 0x00F8F8, 0x00F9F9, 0x00FAFA, 0x00FBFB,
+	0x00FCFC, 0x00FFFF, 0x011ED0, 0x011FF0, 0x0130DD, 0x0131FD, 0x015EDE, 0x015FFE,
+};
+PRIVATE uint16_t const codec_nextstep_decode[256] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+	0x00A0, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00B5, 0x00D7, 0x00F7,
+	0x00A9, 0x00A1, 0x00A2, 0x00A3, 0x2044, 0x00A5, 0x0192, 0x00A7, 0x00A4, 0x2019, 0x201C, 0x00AB, 0x2039, 0x203A, 0xFB01, 0xFB02,
+	0x00AE, 0x2013, 0x2020, 0x2021, 0x00B7, 0x00A6, 0x00B6, 0x2022, 0x201A, 0x201E, 0x201D, 0x00BB, 0x2026, 0x2030, 0x00AC, 0x00BF,
+	0x00B9, 0x02CB, 0x00B4, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x00A8, 0x00B2, 0x02DA, 0x00B8, 0x00B3, 0x02DD, 0x02DB, 0x02C7,
+	0x2014, 0x00B1, 0x00BC, 0x00BD, 0x00BE, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB,
+	0x00EC, 0x00C6, 0x00ED, 0x00AA, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x0141, 0x00D8, 0x0152, 0x00BA, 0x00F2, 0x00F3, 0x00F4, 0x00F5,
+	0x00F6, 0x00E6, 0x00F9, 0x00FA, 0x00FB, 0x0131, 0x00FC, 0x00FD, 0x0142, 0x00F8, 0x0153, 0x00DF, 0x00FE, 0x00FF, 0xFFFD, 0xFFFD,
+};
+PRIVATE uint32_t const codec_nextstep_encode[127] = {
+	0x00A080, 0x00A1A1, 0x00A2A2, 0x00A3A3, 0x00A4A8, 0x00A5A5, 0x00A6B5, 0x00A7A7, 0x00A8C8, 0x00A9A0, 0x00AAE3, 0x00ABAB,
+	0x00ACBE, 0x00AEB0, 0x00AFC5, 0x00B1D1, 0x00B2C9, 0x00B3CC, 0x00B4C2, 0x00B59D, 0x00B6B6, 0x00B7B4, 0x00B8CB, 0x00B9C0,
+	0x00BAEB, 0x00BBBB, 0x00BCD2, 0x00BDD3, 0x00BED4, 0x00BFBF, 0x00C081, 0x00C182, 0x00C283, 0x00C384, 0x00C485, 0x00C586,
+	0x00C6E1, 0x00C787, 0x00C888, 0x00C989, 0x00CA8A, 0x00CB8B, 0x00CC8C, 0x00CD8D, 0x00CE8E, 0x00CF8F, 0x00D090, 0x00D191,
+	0x00D292, 0x00D393, 0x00D494, 0x00D595, 0x00D696, 0x00D79E, 0x00D8E9, 0x00D997, 0x00DA98, 0x00DB99, 0x00DC9A, 0x00DD9B,
+	0x00DE9C, 0x00DFFB, 0x00E0D5, 0x00E1D6, 0x00E2D7, 0x00E3D8, 0x00E4D9, 0x00E5DA, 0x00E6F1, 0x00E7DB, 0x00E8DC, 0x00E9DD,
+	0x00EADE, 0x00EBDF, 0x00ECE0, 0x00EDE2, 0x00EEE4, 0x00EFE5, 0x00F0E6, 0x00F1E7, 0x00F2EC, 0x00F3ED, 0x00F4EE, 0x00F5EF,
+	0x00F6F0, 0x00F79F, 0x00F8F9, 0x00F9F2, 0x00FAF3, 0x00FBF4, 0x00FCF6, 0x00FDF7, 0x00FEFC, 0x00FFFD, 0x0131F5, 0x0141E8,
+	0x0142F8, 0x0152EA, 0x0153FA, 0x0192A6, 0x02C6C3, 0x02C7CF, 0x02CBC1, 0x02D8C6, 0x02D9C7, 0x02DACA, 0x02DBCE, 0x02DCC4,
+	0x02DDCD, 0x2013B1, 0x2014D0, 0x2019A9, 0x201AB8, 0x201CAA, 0x201DBA, 0x201EB9, 0x2020B2, 0x2021B3, 0x2022B7, 0x2026BC,
+	0x2030BD, 0x2039AC, 0x203AAD, 0x2044A4, 0xFB01AE, 0xFB02AF, 0xFFFDFE,
+};
+PRIVATE struct codec_page const codec_pages[50] = {
+	{ "cp037",      CODEC_PAGE_FLATIN1, 0x6F, codec_cp037_decode, codec_cp037_encode, COMPILER_LENOF(codec_cp037_encode) },
+	{ "cp10000",    CODEC_PAGE_FASCII, 0x3F, codec_cp10000_decode, codec_cp10000_encode, COMPILER_LENOF(codec_cp10000_encode) },
+	{ "cp10006",    CODEC_PAGE_FASCII, 0x3F, codec_cp10006_decode, codec_cp10006_encode, COMPILER_LENOF(codec_cp10006_encode) },
+	{ "cp10007",    CODEC_PAGE_FASCII, 0x3F, codec_cp10007_decode, codec_cp10007_encode, COMPILER_LENOF(codec_cp10007_encode) },
+	{ "cp10029",    CODEC_PAGE_FASCII, 0x3F, codec_cp10029_decode, codec_cp10029_encode, COMPILER_LENOF(codec_cp10029_encode) },
+	{ "cp10079",    CODEC_PAGE_FASCII, 0x3F, codec_cp10079_decode, codec_cp10079_encode, COMPILER_LENOF(codec_cp10079_encode) },
+	{ "cp10081",    CODEC_PAGE_FASCII, 0x3F, codec_cp10081_decode, codec_cp10081_encode, COMPILER_LENOF(codec_cp10081_encode) },
+	{ "cp1026",     CODEC_PAGE_FNORMAL, 0x6F, codec_cp1026_decode, codec_cp1026_encode, COMPILER_LENOF(codec_cp1026_encode) },
+	{ "cp1250",     CODEC_PAGE_FASCII, 0x3F, codec_cp1250_decode, codec_cp1250_encode, COMPILER_LENOF(codec_cp1250_encode) },
+	{ "cp1251",     CODEC_PAGE_FASCII, 0x3F, codec_cp1251_decode, codec_cp1251_encode, COMPILER_LENOF(codec_cp1251_encode) },
+	{ "cp1252",     CODEC_PAGE_FASCII, 0x3F, codec_cp1252_decode, codec_cp1252_encode, COMPILER_LENOF(codec_cp1252_encode) },
+	{ "cp1253",     CODEC_PAGE_FASCII, 0x3F, codec_cp1253_decode, codec_cp1253_encode, COMPILER_LENOF(codec_cp1253_encode) },
+	{ "cp1254",     CODEC_PAGE_FASCII, 0x3F, codec_cp1254_decode, codec_cp1254_encode, COMPILER_LENOF(codec_cp1254_encode) },
+	{ "cp1255",     CODEC_PAGE_FASCII, 0x3F, codec_cp1255_decode, codec_cp1255_encode, COMPILER_LENOF(codec_cp1255_encode) },
+	{ "cp1256",     CODEC_PAGE_FASCII, 0x3F, codec_cp1256_decode, codec_cp1256_encode, COMPILER_LENOF(codec_cp1256_encode) },
+	{ "cp1257",     CODEC_PAGE_FASCII, 0x3F, codec_cp1257_decode, codec_cp1257_encode, COMPILER_LENOF(codec_cp1257_encode) },
+	{ "cp1258",     CODEC_PAGE_FASCII, 0x3F, codec_cp1258_decode, codec_cp1258_encode, COMPILER_LENOF(codec_cp1258_encode) },
+	{ "cp437",      CODEC_PAGE_FASCII, 0x3F, codec_cp437_decode, codec_cp437_encode, COMPILER_LENOF(codec_cp437_encode) },
+	{ "cp500",      CODEC_PAGE_FLATIN1, 0x6F, codec_cp500_decode, codec_cp500_encode, COMPILER_LENOF(codec_cp500_encode) },
+	{ "cp737",      CODEC_PAGE_FASCII, 0x3F, codec_cp737_decode, codec_cp737_encode, COMPILER_LENOF(codec_cp737_encode) },
+	{ "cp775",      CODEC_PAGE_FASCII, 0x3F, codec_cp775_decode, codec_cp775_encode, COMPILER_LENOF(codec_cp775_encode) },
+	{ "cp850",      CODEC_PAGE_FASCII, 0x3F, codec_cp850_decode, codec_cp850_encode, COMPILER_LENOF(codec_cp850_encode) },
+	{ "cp852",      CODEC_PAGE_FASCII, 0x3F, codec_cp852_decode, codec_cp852_encode, COMPILER_LENOF(codec_cp852_encode) },
+	{ "cp855",      CODEC_PAGE_FASCII, 0x3F, codec_cp855_decode, codec_cp855_encode, COMPILER_LENOF(codec_cp855_encode) },
+	{ "cp857",      CODEC_PAGE_FASCII, 0x3F, codec_cp857_decode, codec_cp857_encode, COMPILER_LENOF(codec_cp857_encode) },
+	{ "cp860",      CODEC_PAGE_FASCII, 0x3F, codec_cp860_decode, codec_cp860_encode, COMPILER_LENOF(codec_cp860_encode) },
+	{ "cp861",      CODEC_PAGE_FASCII, 0x3F, codec_cp861_decode, codec_cp861_encode, COMPILER_LENOF(codec_cp861_encode) },
+	{ "cp862",      CODEC_PAGE_FASCII, 0x3F, codec_cp862_decode, codec_cp862_encode, COMPILER_LENOF(codec_cp862_encode) },
+	{ "cp863",      CODEC_PAGE_FASCII, 0x3F, codec_cp863_decode, codec_cp863_encode, COMPILER_LENOF(codec_cp863_encode) },
+	{ "cp864",      CODEC_PAGE_FNORMAL, 0x3F, codec_cp864_decode, codec_cp864_encode, COMPILER_LENOF(codec_cp864_encode) },
+	{ "cp865",      CODEC_PAGE_FASCII, 0x3F, codec_cp865_decode, codec_cp865_encode, COMPILER_LENOF(codec_cp865_encode) },
+	{ "cp866",      CODEC_PAGE_FASCII, 0x3F, codec_cp866_decode, codec_cp866_encode, COMPILER_LENOF(codec_cp866_encode) },
+	{ "cp869",      CODEC_PAGE_FASCII, 0x3F, codec_cp869_decode, codec_cp869_encode, COMPILER_LENOF(codec_cp869_encode) },
+	{ "cp874",      CODEC_PAGE_FASCII, 0x3F, codec_cp874_decode, codec_cp874_encode, COMPILER_LENOF(codec_cp874_encode) },
+	{ "cp875",      CODEC_PAGE_FNORMAL, 0x6F, codec_cp875_decode, codec_cp875_encode, COMPILER_LENOF(codec_cp875_encode) },
+	{ "iso8859-10", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_10_decode, codec_iso8859_10_encode, COMPILER_LENOF(codec_iso8859_10_encode) },
+	{ "iso8859-11", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_11_decode, codec_iso8859_11_encode, COMPILER_LENOF(codec_iso8859_11_encode) },
+	{ "iso8859-13", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_13_decode, codec_iso8859_13_encode, COMPILER_LENOF(codec_iso8859_13_encode) },
+	{ "iso8859-14", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_14_decode, codec_iso8859_14_encode, COMPILER_LENOF(codec_iso8859_14_encode) },
+	{ "iso8859-15", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_15_decode, codec_iso8859_15_encode, COMPILER_LENOF(codec_iso8859_15_encode) },
+	{ "iso8859-16", CODEC_PAGE_FASCII, 0x3F, codec_iso8859_16_decode, codec_iso8859_16_encode, COMPILER_LENOF(codec_iso8859_16_encode) },
+	{ "iso8859-2",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_2_decode, codec_iso8859_2_encode, COMPILER_LENOF(codec_iso8859_2_encode) },
+	{ "iso8859-3",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_3_decode, codec_iso8859_3_encode, COMPILER_LENOF(codec_iso8859_3_encode) },
+	{ "iso8859-4",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_4_decode, codec_iso8859_4_encode, COMPILER_LENOF(codec_iso8859_4_encode) },
+	{ "iso8859-5",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_5_decode, codec_iso8859_5_encode, COMPILER_LENOF(codec_iso8859_5_encode) },
+	{ "iso8859-6",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_6_decode, codec_iso8859_6_encode, COMPILER_LENOF(codec_iso8859_6_encode) },
+	{ "iso8859-7",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_7_decode, codec_iso8859_7_encode, COMPILER_LENOF(codec_iso8859_7_encode) },
+	{ "iso8859-8",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_8_decode, codec_iso8859_8_encode, COMPILER_LENOF(codec_iso8859_8_encode) },
+	{ "iso8859-9",  CODEC_PAGE_FASCII, 0x3F, codec_iso8859_9_decode, codec_iso8859_9_encode, COMPILER_LENOF(codec_iso8859_9_encode) },
+	{ "nextstep",   CODEC_PAGE_FASCII, 0x3F, codec_nextstep_decode, codec_nextstep_encode, COMPILER_LENOF(codec_nextstep_encode) },
+};
+/*[[[end]]]*/
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_OBJECTS_UNICODE_CODEC_PAGES_C_INL */
@@ -37,6 +37,7 @@
 #include <hybrid/wordbits.h>
 
 #include "../../runtime/strings.h"
+#include "simd.h"
 
 DECL_BEGIN
 
@@ -701,6 +702,292 @@ err:
 }
 
 
+/************************************************************************/
+/* Single-byte code pages                                               */
+/************************************************************************/
+
+#include "codec-pages.c.inl"
+
+/* Lookup the native code page for a normalized codec `name'
+ * @return: NULL: `name' isn't the name of a native code page. */
+PRIVATE ATTR_PURE WUNUSED NONNULL((1)) struct codec_page const *DCALL
+codec_page_lookup(char const *__restrict name) {
+	size_t lo = 0, hi = COMPILER_LENOF(codec_pages);
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		int diff   = strcmp(name, codec_pages[mid].cp_name);
+		if (diff < 0) {
+			hi = mid;
+		} else if (diff > 0) {
+			lo = mid + 1;
+		} else {
+			return &codec_pages[mid];
+		}
+	}
+	return NULL;
+}
+
+/* Return the byte used by `self' to encode `ch'
+ * @return: -1: `ch' cannot be encoded by `self' */
+PRIVATE ATTR_PURE WUNUSED NONNULL((1)) int DCALL
+codec_page_encode_char(struct codec_page const *__restrict self, uint32_t ch) {
+	size_t lo, hi;
+	if (ch <= 0x7f && (self->cp_flags & CODEC_PAGE_FASCII))
+		return (int)ch;
+	lo = 0;
+	hi = self->cp_nencode;
+	while (lo < hi) {
+		size_t mid      = (lo + hi) / 2;
+		uint32_t mid_ch = self->cp_encode[mid] >> 8;
+		if (ch < mid_ch) {
+			hi = mid;
+		} else if (ch > mid_ch) {
+			lo = mid + 1;
+		} else {
+			return (int)(self->cp_encode[mid] & 0xff);
+		}
+	}
+	return -1;
+}
+
+PRIVATE ATTR_COLD NONNULL((1)) int DCALL
+err_page_decode(struct codec_page const *__restrict page, uint8_t byte) {
+	return DeeError_Throwf(&DeeError_UnicodeDecodeError,
+	                       "Cannot decode byte 0x%.2X using codec %q",
+	                       (unsigned int)byte, page->cp_name);
+}
+
+PRIVATE ATTR_COLD NONNULL((1)) int DCALL
+err_page_encode(struct codec_page const *__restrict page, uint32_t ch) {
+	return DeeError_Throwf(&DeeError_UnicodeEncodeError,
+	                       "Cannot encode character U+%.4I32X using codec %q",
+	                       ch, page->cp_name);
+}
+
+/* Check if decoding `data...+=size' using `page' produces any character > U+00FF */
+PRIVATE ATTR_PURE WUNUSED NONNULL((1)) bool DCALL
+codec_page_needs_2byte(struct codec_page const *__restrict page,
+                       uint8_t const *data, size_t size) {
+	size_t i = 0;
+	if (page->cp_flags & CODEC_PAGE_FLATIN1)
+		return false;
+	while (i < size) {
+		if (page->cp_flags & CODEC_PAGE_FASCII) {
+			i += dee_asciilen(data + i, size - i);
+			if (i >= size)
+				break;
+		}
+		if (page->cp_decode[data[i]] > 0xff)
+			return true;
+		++i;
+	}
+	return false;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+decode_page(DeeObject *__restrict self,
+            struct codec_page const *__restrict page,
+            unsigned int error_mode) {
+	uint8_t const *data;
+	size_t i, j, size;
+	if (DeeBytes_Check(self)) {
+		data = DeeBytes_DATA(self);
+		size = DeeBytes_SIZE(self);
+	} else if (DeeString_Check(self)) {
+		data = DeeString_AsBytes(self, error_mode != STRING_ERROR_FSTRICT);
+		if unlikely(!data)
+			goto err;
+		size = WSTR_LENGTH(data);
+	} else {
+		err_expected_string_or_bytes(self);
+		goto err;
+	}
+	if (!codec_page_needs_2byte(page, data, size)) {
+		uint8_t *dst = DeeString_New1ByteBuffer(size);
+		if unlikely(!dst)
+			goto err;
+		for (i = j = 0; i < size;) {
+			uint8_t byte;
+			uint16_t ch;
+			if (page->cp_flags & CODEC_PAGE_FASCII) {
+				/* ASCII fast-path */
+				size_t count = dee_asciilen(data + i, size - i);
+				memcpyc(dst + j, data + i, count, sizeof(uint8_t));
+				i += count;
+				j += count;
+				if (i >= size)
+					break;
+			}
+			byte = data[i++];
+			ch   = page->cp_decode[byte];
+			if unlikely(!ch && byte) {
+				if (error_mode == STRING_ERROR_FIGNORE)
+					continue;
+				if (error_mode == STRING_ERROR_FSTRICT) {
+					err_page_decode(page, byte);
+					DeeString_Free1ByteBuffer(dst);
+					goto err;
+				}
+				ch = '?';
+			}
+			dst[j++] = (uint8_t)ch;
+		}
+		if (j < size)
+			dst = DeeString_Truncate1ByteBuffer(dst, j);
+		return DeeString_Pack1ByteBuffer(dst);
+	} else {
+		uint16_t *dst = DeeString_New2ByteBuffer(size);
+		if unlikely(!dst)
+			goto err;
+		for (i = j = 0; i < size;) {
+			uint8_t byte;
+			uint16_t ch;
+			if (page->cp_flags & CODEC_PAGE_FASCII) {
+				/* ASCII fast-path */
+				size_t count = dee_asciilen(data + i, size - i);
+				size_t done  = dee_widen8to16(dst + j, data + i, count);
+				for (; done < count; ++done)
+					dst[j + done] = data[i + done];
+				i += count;
+				j += count;
+				if (i >= size)
+					break;
+			}
+			byte = data[i++];
+			ch   = page->cp_decode[byte];
+			if unlikely(!ch && byte) {
+				if (error_mode == STRING_ERROR_FIGNORE)
+					continue;
+				if (error_mode == STRING_ERROR_FSTRICT) {
+					err_page_decode(page, byte);
+					DeeString_Free2ByteBuffer(dst);
+					goto err;
+				}
+				ch = '?';
+			}
+			dst[j++] = ch;
+		}
+		if (j < size)
+			dst = DeeString_Truncate2ByteBuffer(dst, j);
+		return DeeString_Pack2ByteBuffer(dst);
+	}
+err:
+	return NULL;
+}
+
+/* Encode `size' characters from `src' (of type `T') into `dst'
+ * @return: * :         The # of bytes written to `dst'
+ * @return: (size_t)-1: An error was thrown */
+#define DEFINE_ENCODE_PAGE_CHARS(name, T)                                        \
+	PRIVATE WUNUSED NONNULL((1, 2, 3)) size_t DCALL                              \
+	name(struct codec_page const *__restrict page, uint8_t *__restrict dst,      \
+	     T const *__restrict src, size_t size, unsigned int error_mode) {        \
+		size_t i, j;                                                             \
+		for (i = j = 0; i < size; ++i) {                                         \
+			int byte = codec_page_encode_char(page, src[i]);                     \
+			if unlikely(byte < 0) {                                              \
+				if (error_mode == STRING_ERROR_FIGNORE)                          \
+					continue;                                                    \
+				if (error_mode == STRING_ERROR_FSTRICT) {                        \
+					err_page_encode(page, src[i]);                               \
+					return (size_t)-1;                                           \
+				}                                                                \
+				byte = page->cp_replace;                                         \
+			}                                                                    \
+			dst[j++] = (uint8_t)byte;                                            \
+		}                                                                        \
+		return j;                                                                \
+	}
+DEFINE_ENCODE_PAGE_CHARS(encode_page_chars16, uint16_t)
+DEFINE_ENCODE_PAGE_CHARS(encode_page_chars32, uint32_t)
+#undef DEFINE_ENCODE_PAGE_CHARS
+
+/* Same as `encode_page_chars16()', but for 1-byte characters (with an ASCII fast-path) */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) size_t DCALL
+encode_page_chars8(struct codec_page const *__restrict page, uint8_t *__restrict dst,
+                   uint8_t const *__restrict src, size_t size, unsigned int error_mode) {
+	size_t i, j;
+	for (i = j = 0; i < size;) {
+		int byte;
+		if (page->cp_flags & CODEC_PAGE_FASCII) {
+			size_t count = dee_asciilen(src + i, size - i);
+			memcpyc(dst + j, src + i, count, sizeof(uint8_t));
+			i += count;
+			j += count;
+			if (i >= size)
+				break;
+		}
+		byte = codec_page_encode_char(page, src[i]);
+		if unlikely(byte < 0) {
+			if (error_mode == STRING_ERROR_FIGNORE) {
+				++i;
+				continue;
+			}
+			if (error_mode == STRING_ERROR_FSTRICT) {
+				err_page_encode(page, src[i]);
+				return (size_t)-1;
+			}
+			byte = page->cp_replace;
+		}
+		dst[j++] = (uint8_t)byte;
+		++i;
+	}
+	return j;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+encode_page(DeeObject *__restrict self,
+            struct codec_page const *__restrict page,
+            unsigned int error_mode) {
+	DREF DeeObject *result;
+	size_t size, written;
+	if (DeeBytes_Check(self)) {
+		/* LATIN-1 to code page */
+		size   = DeeBytes_SIZE(self);
+		result = DeeBytes_NewBufferUninitialized(size);
+		if unlikely(!result)
+			goto err;
+		written = encode_page_chars8(page, DeeBytes_DATA(result),
+		                             DeeBytes_DATA(self), size, error_mode);
+	} else if (DeeString_Check(self)) {
+		void *str = DeeString_WSTR(self);
+		size      = WSTR_LENGTH(str);
+		result    = DeeBytes_NewBufferUninitialized(size);
+		if unlikely(!result)
+			goto err;
+		SWITCH_SIZEOF_WIDTH(DeeString_WIDTH(self)) {
+
+		CASE_WIDTH_1BYTE:
+			written = encode_page_chars8(page, DeeBytes_DATA(result),
+			                             (uint8_t const *)str, size, error_mode);
+			break;
+
+		CASE_WIDTH_2BYTE:
+			written = encode_page_chars16(page, DeeBytes_DATA(result),
+			                              (uint16_t const *)str, size, error_mode);
+			break;
+
+		CASE_WIDTH_4BYTE:
+			written = encode_page_chars32(page, DeeBytes_DATA(result),
+			                              (uint32_t const *)str, size, error_mode);
+			break;
+		}
+	} else {
+		err_expected_string_or_bytes(self);
+		goto err;
+	}
+	if unlikely(written == (size_t)-1)
+		goto err_r;
+	if (written < size)
+		result = DeeBytes_TruncateBuffer(result, written);
+	return result;
+err_r:
+	Dee_Decref(result);
+err:
+	return NULL;
+}
+
+
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 #define IS_LITTLE_ENDIAN true
 #define encode_utf16_le  encode_utf16
@@ -812,6 +1099,7 @@ INTERN WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
 DeeCodec_DecodeIntern(DeeObject *self, DeeObject *name,
                       unsigned int error_mode) {
 	char const *name_str;
+	struct codec_page const *page;
 	ASSERT(error_mode <= COMPILER_LENOF(error_module_names));
 	name_str = DeeString_STR(name);
 	SWITCH_BUILTIN_CODECS(name_str,
@@ -825,6 +1113,9 @@ DeeCodec_DecodeIntern(DeeObject *self, DeeObject *name,
 	                      return decode_utf32(self, error_mode, false),
 	                      return decode_utf32(self, error_mode, true),
 	                      return decode_utf8(self, error_mode));
+	page = codec_page_lookup(name_str);
+	if (page)
+		return decode_page(self, page, error_mode);
 	return ITER_DONE;
 }
 
@@ -832,6 +1123,7 @@ INTERN WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 DeeCodec_EncodeIntern(DeeObject *self, DeeObject *name,
                       unsigned int error_mode) {
 	char const *name_str;
+	struct codec_page const *page;
 	ASSERT(error_mode <= COMPILER_LENOF(error_module_names));
 	name_str = DeeString_STR(name);
 	SWITCH_BUILTIN_CODECS(name_str,
@@ -845,6 +1137,9 @@ DeeCodec_EncodeIntern(DeeObject *self, DeeObject *name,
 	                      return encode_utf32_be(self),
 	                      return encode_utf32_le(self),
 	                      return encode_utf8(self));
+	page = codec_page_lookup(name_str);
+	if (page)
+		return encode_page(self, page, error_mode);
 	return ITER_DONE;
 }
 
@@ -872,6 +1167,8 @@ DeeCodec_EncodeIntern(DeeObject *self, DeeObject *name,
  *  - "utf-32-le", "utf32-le", "u32-le", "utf-32le", "utf32le", "u32le"
  *  - "utf-32-be", "utf32-be", "u32-be", "utf-32be", "utf32be", "u32be"
  *  - "string-escape", "backslash-escape", "c-escape"
+ * Additionally, the single-byte code pages from `lib/_codecs' (e.g. "cp437",
+ * "cp1252", "iso8859-15", ...) are implemented natively using lookup tables.
  * @throw: ValueError: The given `name' is not a recognized codec name.
  * @param: error_mode: One of `STRING_ERROR_F*'
  * @return: * :   The encoded/decoded variant of `self'
@@ -929,6 +1226,7 @@ DeeCodec_Encode(DeeObject *self, DeeObject *name,
                 unsigned int error_mode) {
 	DREF DeeObject *result, *libcodecs;
 	char const *name_str;
+	struct codec_page const *page;
 	ASSERT(error_mode <= COMPILER_LENOF(error_module_names));
 	name = DeeCodec_NormalizeName(name);
 	if unlikely(!name)
@@ -946,6 +1244,11 @@ DeeCodec_Encode(DeeObject *self, DeeObject *name,
 	{ result = encode_utf32_be(self); goto done; },
 	{ result = encode_utf32_le(self); goto done; },
 	{ result = encode_utf8(self); goto done; });
+	page = codec_page_lookup(name_str);
+	if (page) {
+		result = encode_page(self, page, error_mode);
+		goto done;
+	}
 	libcodecs = libcodecs_get();
 	if unlikely(!libcodecs) {
 		if (DeeError_Catch(&DeeError_FileNotFound))
@@ -0,0 +1,1446 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_OBJECTS_UNICODE_REGEX_DFA_C_INL
+#define GUARD_DEEMON_OBJECTS_UNICODE_REGEX_DFA_C_INL 1
+
+#ifdef __INTELLISENSE__
+#include "regex.c"
+#endif /* !__INTELLISENSE__ */
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/regex.h>
+#include <deemon/system-features.h> /* memchr(), memcmp(), memcpy(), memmem(), memset() */
+#include <deemon/util/atomic.h>
+#include <deemon/util/lock.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "simd.h"
+
+/* Lazily-built DFA used to execute regex patterns when no groups are needed.
+ *
+ * libregex executes `rc_code' using a backtracking matcher, which can take
+ * exponential time for certain patterns (or give up once `re_max_failures'
+ * is reached). But most patterns are regular in the strict sense (no back-
+ * references, no anchors, ...), and most callers (`rematch()', `refind()',
+ * `recontains()', `rereplace()', ...) only need the bounds of the match,
+ * rather than the bounds of individual groups.
+ *
+ * For such patterns, `re_compile()' also parses the pattern into a byte-level
+ * NFA, whose DFA states are then constructed on-demand while matching, so
+ * matching at a given position takes linear time. Searches first try every
+ * candidate position in turn, but once that has looked at more bytes than
+ * there are in the input, they switch to a second DFA for the reversed pattern
+ * that finds the start of the leftmost (or rightmost) match in one backwards
+ * pass, so searching also takes linear time. DFA states are shared between all
+ * threads using the same regex and live until the regex itself is destroyed:
+ * new states are created while holding `rd_lock', but existing transitions are
+ * followed lock-free.
+ *
+ * Whenever the DFA can't produce a result (too many states, a non-ASCII
+ * character that would have to be looked up in the unicode database, or
+ * the caller wanting group matches), execution falls back to libregex.
+ * The parser is intentionally conservative: anything it doesn't understand
+ * simply means that the pattern will always be executed by libregex.
+ *
+ * Supported syntax:
+ * - Literals (including escaped special characters; UTF-8 sequences unless
+ *   `DEE_REGEX_COMPILE_NOUTF8' is given)
+ * - `.'
+ * - `[...]' and `[^...]' with ASCII members, ranges, and the character classes
+ *   `[:alnum:]', `[:alpha:]', `[:digit:]', `[:lower:]', `[:upper:]', `[:xdigit:]'
+ * - Groups `(...)' and alternation `|'
+ * - Quantifiers `*', `+', `?', `{n}', `{n,}', `{,m}' and `{n,m}'
+ * Patterns compiled with `DEE_REGEX_COMPILE_ICASE' are never handled by the DFA. */
+
+DECL_BEGIN
+
+#define RE_DFA_MAXNODES   1024 /* Max # of nodes in a parsed pattern */
+#define RE_DFA_MAXSETS    256  /* Max # of distinct byte sets in a pattern */
+#define RE_DFA_MAXREPEAT  255  /* Max bounds of `{n,m}' */
+#define RE_DFA_MAXPREFIX  64   /* Max length of a literal prefix */
+#define RE_NFA_MAXSTATES  4096 /* Max # of NFA states */
+#define RE_DFA_MAXSTATES  1024 /* Max # of DFA states (before giving up and using libregex) */
+#define RE_DFA_INVALID    0xffff
+
+/* Special return value for `re_dfa_*' exec functions: use libregex instead. */
+#define RE_DFA_STATUS_FALLBACK (-3)
+
+#define re_dfa_bitset_has(self, byte) ((self)[(byte) >> 3] & (uint8_t)(1 << ((byte) & 7)))
+#define re_dfa_bitset_add(self, byte) (void)((self)[(byte) >> 3] |= (uint8_t)(1 << ((byte) & 7)))
+#define re_dfa_bitset_sizeof          32
+
+struct re_dfa_byteset {
+	uint8_t rbs_match[re_dfa_bitset_sizeof]; /* Bytes accepted by this set */
+	uint8_t rbs_bail[re_dfa_bitset_sizeof];  /* Bytes for which the DFA can't tell if they are accepted (execution falls back to libregex) */
+};
+
+LOCAL NONNULL((1)) void DCALL
+re_dfa_bitset_addrange(uint8_t *__restrict self, unsigned int lo, unsigned int hi) {
+	for (; lo <= hi; ++lo)
+		re_dfa_bitset_add(self, lo);
+}
+
+
+
+/************************************************************************/
+/* Pattern parser                                                       */
+/************************************************************************/
+
+#define RE_DFA_NODE_EMPTY  0 /* Match epsilon */
+#define RE_DFA_NODE_SET    1 /* Match a single byte from `rdn_set' */
+#define RE_DFA_NODE_CAT    2 /* Match all children in order */
+#define RE_DFA_NODE_ALT    3 /* Match any of the children */
+#define RE_DFA_NODE_REPEAT 4 /* Match the (only) child `rdn_min...rdn_max' times */
+#define RE_DFA_NODE_STRAY  5 /* Like `RE_DFA_NODE_SET', but only for the bytes of invalid UTF-8 (never matched when reversed) */
+#define RE_DFA_REPEAT_INF  0xffff
+
+struct re_dfa_node {
+	uint16_t rdn_type;  /* Node type (one of `RE_DFA_NODE_*') */
+	uint16_t rdn_set;   /* [valid_if(RE_DFA_NODE_SET)] Index into `rdp_setv' */
+	uint16_t rdn_min;   /* [valid_if(RE_DFA_NODE_REPEAT)] Min # of repetitions */
+	uint16_t rdn_max;   /* [valid_if(RE_DFA_NODE_REPEAT)] Max # of repetitions (or `RE_DFA_REPEAT_INF') */
+	uint16_t rdn_child; /* First child (or `RE_DFA_INVALID') */
+	uint16_t rdn_last;  /* Last child (or `RE_DFA_INVALID') */
+	uint16_t rdn_next;  /* Next sibling (or `RE_DFA_INVALID') */
+};
+
+#define RE_NFA_SET   0 /* Consume a byte from `rns_set' and continue at `rns_out' */
+#define RE_NFA_SPLIT 1 /* Continue at both `rns_out' and `rns_out2' (without consuming anything) */
+#define RE_NFA_MATCH 2 /* Accept input */
+#define RE_NFA_FAIL  3 /* Never accept input */
+
+struct re_nfa_state {
+	uint16_t rns_type; /* State type (one of `RE_NFA_*') */
+	uint16_t rns_set;  /* [valid_if(RE_NFA_SET)] Index into `rd_setv' */
+	uint16_t rns_out;  /* [valid_if(!RE_NFA_MATCH)] Next state */
+	uint16_t rns_out2; /* [valid_if(RE_NFA_SPLIT)] Alternate next state */
+};
+
+struct re_dfa_parser {
+	unsigned char const  *rdp_iter;  /* Current position in pattern */
+	unsigned char const  *rdp_end;   /* End of pattern */
+	bool                  rdp_utf8;  /* Pattern and input are UTF-8 */
+	bool                  rdp_rev;   /* Compile the NFA for the reversed pattern */
+	uint16_t              rdp_nodec; /* # of used nodes */
+	uint16_t              rdp_setc;  /* # of used sets */
+	uint16_t              rdp_nfac;  /* # of used NFA states */
+	struct re_dfa_node    rdp_nodev[RE_DFA_MAXNODES];
+	struct re_dfa_byteset rdp_setv[RE_DFA_MAXSETS];
+	struct re_nfa_state   rdp_nfav[RE_NFA_MAXSTATES];
+};
+
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_newnode(struct re_dfa_parser *__restrict self, uint16_t type) {
+	struct re_dfa_node *node;
+	if unlikely(self->rdp_nodec >= RE_DFA_MAXNODES)
+		return RE_DFA_INVALID;
+	node = &self->rdp_nodev[self->rdp_nodec];
+	node->rdn_type  = type;
+	node->rdn_child = RE_DFA_INVALID;
+	node->rdn_last  = RE_DFA_INVALID;
+	node->rdn_next  = RE_DFA_INVALID;
+	return self->rdp_nodec++;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+re_dfa_addchild(struct re_dfa_parser *__restrict self,
+                uint16_t parent, uint16_t child) {
+	struct re_dfa_node *node = &self->rdp_nodev[parent];
+	if (node->rdn_last == RE_DFA_INVALID) {
+		node->rdn_child = child;
+	} else {
+		self->rdp_nodev[node->rdn_last].rdn_next = child;
+	}
+	node->rdn_last = child;
+}
+
+/* Create a new `RE_DFA_NODE_SET' node for `set' (sets are de-duplicated) */
+PRIVATE WUNUSED NONNULL((1, 2)) uint16_t DCALL
+re_dfa_newsetnode(struct re_dfa_parser *__restrict self,
+                  struct re_dfa_byteset const *__restrict set) {
+	uint16_t result, index;
+	for (index = 0; index < self->rdp_setc; ++index) {
+		if (memcmp(&self->rdp_setv[index], set, sizeof(struct re_dfa_byteset)) == 0)
+			goto gotset;
+	}
+	if unlikely(self->rdp_setc >= RE_DFA_MAXSETS)
+		return RE_DFA_INVALID;
+	memcpy(&self->rdp_setv[index], set, sizeof(struct re_dfa_byteset));
+	++self->rdp_setc;
+gotset:
+	result = re_dfa_newnode(self, RE_DFA_NODE_SET);
+	if likely(result != RE_DFA_INVALID)
+		self->rdp_nodev[result].rdn_set = index;
+	return result;
+}
+
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_newrangenode(struct re_dfa_parser *__restrict self,
+                    unsigned int lo, unsigned int hi) {
+	struct re_dfa_byteset set;
+	bzero(&set, sizeof(set));
+	re_dfa_bitset_addrange(set.rbs_match, lo, hi);
+	return re_dfa_newsetnode(self, &set);
+}
+
+/* Append a node matching any multi-byte UTF-8 character to `alt'
+ * Lead bytes of 5/6-byte sequences (and stray continuation bytes)
+ * cause the DFA to fall back to libregex. */
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+re_dfa_addutf8multibyte(struct re_dfa_parser *__restrict self, uint16_t alt) {
+	struct re_dfa_byteset bail;
+	unsigned int seqlen;
+	uint16_t node;
+	static uint8_t const leadbytes[3][2] = {
+		{ 0xc0, 0xdf }, { 0xe0, 0xef }, { 0xf0, 0xf7 }
+	};
+	for (seqlen = 2; seqlen <= 4; ++seqlen) {
+		uint16_t cat = re_dfa_newnode(self, RE_DFA_NODE_CAT);
+		unsigned int i;
+		if unlikely(cat == RE_DFA_INVALID)
+			goto err;
+		node = re_dfa_newrangenode(self, leadbytes[seqlen - 2][0], leadbytes[seqlen - 2][1]);
+		if unlikely(node == RE_DFA_INVALID)
+			goto err;
+		re_dfa_addchild(self, cat, node);
+		for (i = 1; i < seqlen; ++i) {
+			node = re_dfa_newrangenode(self, 0x80, 0xbf);
+			if unlikely(node == RE_DFA_INVALID)
+				goto err;
+			re_dfa_addchild(self, cat, node);
+		}
+		re_dfa_addchild(self, alt, cat);
+	}
+	bzero(&bail, sizeof(bail));
+	re_dfa_bitset_addrange(bail.rbs_bail, 0x80, 0xbf);
+	re_dfa_bitset_addrange(bail.rbs_bail, 0xf8, 0xff);
+	node = re_dfa_newsetnode(self, &bail);
+	if unlikely(node == RE_DFA_INVALID)
+		goto err;
+	self->rdp_nodev[node].rdn_type = RE_DFA_NODE_STRAY;
+	re_dfa_addchild(self, alt, node);
+	return true;
+err:
+	return false;
+}
+
+/* Create a node for a set of bytes `set', where `set->rbs_match' only contains
+ * ASCII characters, and `nonascii' specifies how non-ASCII characters behave:
+ * - RE_DFA_NONASCII_NO:      Non-ASCII characters are never accepted
+ * - RE_DFA_NONASCII_YES:     Non-ASCII characters are always accepted
+ * - RE_DFA_NONASCII_UNKNOWN: Fall back to libregex for non-ASCII characters */
+#define RE_DFA_NONASCII_NO      0
+#define RE_DFA_NONASCII_YES     1
+#define RE_DFA_NONASCII_UNKNOWN 2
+PRIVATE WUNUSED NONNULL((1, 2)) uint16_t DCALL
+re_dfa_newasciisetnode(struct re_dfa_parser *__restrict self,
+                       struct re_dfa_byteset *__restrict set,
+                       unsigned int nonascii) {
+	uint16_t result, node;
+	switch (nonascii) {
+
+	case RE_DFA_NONASCII_UNKNOWN:
+		re_dfa_bitset_addrange(set->rbs_bail, 0x80, 0xff);
+		break;
+
+	case RE_DFA_NONASCII_YES:
+		if (!self->rdp_utf8) {
+			re_dfa_bitset_addrange(set->rbs_match, 0x80, 0xff);
+			break;
+		}
+		result = re_dfa_newnode(self, RE_DFA_NODE_ALT);
+		if unlikely(result == RE_DFA_INVALID)
+			goto err;
+		node = re_dfa_newsetnode(self, set);
+		if unlikely(node == RE_DFA_INVALID)
+			goto err;
+		re_dfa_addchild(self, result, node);
+		if unlikely(!re_dfa_addutf8multibyte(self, result))
+			goto err;
+		return result;
+
+	default: break;
+	}
+	return re_dfa_newsetnode(self, set);
+err:
+	return RE_DFA_INVALID;
+}
+
+/* Add the ASCII members of the character class `name' to `set' */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+re_dfa_addclass(uint8_t *__restrict set, unsigned char const *name, size_t namelen) {
+	if (namelen == 5 && memcmp(name, "digit", 5) == 0) {
+		re_dfa_bitset_addrange(set, '0', '9');
+	} else if (namelen == 5 && memcmp(name, "lower", 5) == 0) {
+		re_dfa_bitset_addrange(set, 'a', 'z');
+	} else if (namelen == 5 && memcmp(name, "upper", 5) == 0) {
+		re_dfa_bitset_addrange(set, 'A', 'Z');
+	} else if (namelen == 5 && memcmp(name, "alpha", 5) == 0) {
+		re_dfa_bitset_addrange(set, 'a', 'z');
+		re_dfa_bitset_addrange(set, 'A', 'Z');
+	} else if (namelen == 5 && memcmp(name, "alnum", 5) == 0) {
+		re_dfa_bitset_addrange(set, '0', '9');
+		re_dfa_bitset_addrange(set, 'a', 'z');
+		re_dfa_bitset_addrange(set, 'A', 'Z');
+	} else if (namelen == 6 && memcmp(name, "xdigit", 6) == 0) {
+		re_dfa_bitset_addrange(set, '0', '9');
+		re_dfa_bitset_addrange(set, 'a', 'f');
+		re_dfa_bitset_addrange(set, 'A', 'F');
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/* Check if `ch' can appear (unescaped) as a literal within `[...]' */
+#define re_dfa_islistliteral(ch) \
+	((ch) >= 0x20 && (ch) <= 0x7e && (ch) != '[' && (ch) != '\\' && (ch) != ']' && (ch) != '-')
+
+/* Parse a `[...]' list (`rdp_iter' points after the `[') */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_parse_list(struct re_dfa_parser *__restrict self) {
+	struct re_dfa_byteset set;
+	unsigned char const *iter = self->rdp_iter;
+	unsigned char const *end  = self->rdp_end;
+	bool negate = false, has_class = false, is_first = true;
+	bzero(&set, sizeof(set));
+	if (iter < end && *iter == '^') {
+		negate = true;
+		++iter;
+	}
+	for (;;) {
+		unsigned char ch;
+		if unlikely(iter >= end)
+			goto err;
+		ch = *iter++;
+		if (ch == ']') {
+			if (is_first)
+				goto err; /* Leading `]' is a literal (just let libregex deal with it) */
+			break;
+		}
+		if (ch == '[') {
+			unsigned char const *name;
+			if (iter >= end || *iter != ':')
+				goto err; /* `[.x.]', `[=x=]', or a literal `[' */
+			name = ++iter;
+			while (iter < end && *iter != ':')
+				++iter;
+			if (end - iter < 2 || iter[1] != ']')
+				goto err;
+			if (!re_dfa_addclass(set.rbs_match, name, (size_t)(iter - name)))
+				goto err;
+			has_class = true;
+			iter += 2;
+		} else if (ch == '\\') {
+			if (iter >= end)
+				goto err;
+			ch = *iter++;
+			if (ch != ']' && ch != '\\' && ch != '[' && ch != '^' && ch != '-')
+				goto err;
+			if (iter < end && *iter == '-' && (end - iter < 2 || iter[1] != ']'))
+				goto err; /* Range starting with an escaped character */
+			re_dfa_bitset_add(set.rbs_match, ch);
+		} else if (ch == '-') {
+			if (!is_first && (iter >= end || *iter != ']'))
+				goto err;
+			re_dfa_bitset_add(set.rbs_match, '-');
+		} else if (re_dfa_islistliteral(ch)) {
+			if (iter < end && *iter == '-' && (end - iter < 2 || iter[1] != ']')) {
+				unsigned char hi;
+				if (end - iter < 2)
+					goto err;
+				hi = iter[1];
+				if (!re_dfa_islistliteral(hi) || hi < ch)
+					goto err;
+				re_dfa_bitset_addrange(set.rbs_match, ch, hi);
+				iter += 2;
+			} else {
+				re_dfa_bitset_add(set.rbs_match, ch);
+			}
+		} else {
+			goto err; /* Non-ASCII or control character */
+		}
+		is_first = false;
+	}
+	self->rdp_iter = iter;
+	if (negate) {
+		unsigned int i;
+		for (i = 0; i < 0x80 / 8; ++i)
+			set.rbs_match[i] = (uint8_t)~set.rbs_match[i];
+	}
+	return re_dfa_newasciisetnode(self, &set,
+	                              has_class ? RE_DFA_NONASCII_UNKNOWN
+	                              : negate ? RE_DFA_NONASCII_YES
+	                                       : RE_DFA_NONASCII_NO);
+err:
+	return RE_DFA_INVALID;
+}
+
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_parse_alt(struct re_dfa_parser *__restrict self);
+
+/* Parse a single atom (without trailing quantifiers) */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_parse_atom(struct re_dfa_parser *__restrict self) {
+	uint16_t result;
+	unsigned char ch = *self->rdp_iter++;
+	switch (ch) {
+
+	case '(':
+		if (self->rdp_iter < self->rdp_end && *self->rdp_iter == '?')
+			goto err; /* Extension group */
+		result = re_dfa_parse_alt(self);
+		if unlikely(result == RE_DFA_INVALID)
+			goto err;
+		if (self->rdp_iter >= self->rdp_end || *self->rdp_iter != ')')
+			goto err;
+		++self->rdp_iter;
+		return result;
+
+	case '[':
+		return re_dfa_parse_list(self);
+
+	case '.': {
+		struct re_dfa_byteset set;
+		bzero(&set, sizeof(set));
+		re_dfa_bitset_addrange(set.rbs_match, 0x00, 0x7f);
+		return re_dfa_newasciisetnode(self, &set, RE_DFA_NONASCII_YES);
+	}	break;
+
+	case '\\':
+		if (self->rdp_iter >= self->rdp_end)
+			goto err;
+		ch = *self->rdp_iter++;
+		/* Only escaped special characters are literals (everything
+		 * else is a back-reference, a GNU operator, or something else
+		 * that libregex should deal with). */
+		if (!ch || !strchr("\\.[]()|*+?{}^$/-", ch))
+			goto err;
+		return re_dfa_newrangenode(self, ch, ch);
+
+	case '^': /* Anchors */
+	case '$':
+	case '*': /* Nothing to repeat */
+	case '+':
+	case '?':
+	case '{':
+	case ']':
+	case '}':
+		goto err;
+
+	default:
+		if (ch < 0x20)
+			goto err;
+		if (ch >= 0x80) {
+			/* Multi-byte UTF-8 character */
+			unsigned int i, seqlen;
+			if (!self->rdp_utf8)
+				goto err;
+			if (ch >= 0xc0 && ch <= 0xdf) {
+				seqlen = 2;
+			} else if (ch >= 0xe0 && ch <= 0xef) {
+				seqlen = 3;
+			} else if (ch >= 0xf0 && ch <= 0xf7) {
+				seqlen = 4;
+			} else {
+				goto err;
+			}
+			if ((size_t)(self->rdp_end - self->rdp_iter) < seqlen - 1)
+				goto err;
+			result = re_dfa_newnode(self, RE_DFA_NODE_CAT);
+			if unlikely(result == RE_DFA_INVALID)
+				goto err;
+			for (i = 0; i < seqlen; ++i) {
+				uint16_t node;
+				if (i != 0) {
+					ch = *self->rdp_iter++;
+					if (ch < 0x80 || ch > 0xbf)
+						goto err;
+				}
+				node = re_dfa_newrangenode(self, ch, ch);
+				if unlikely(node == RE_DFA_INVALID)
+					goto err;
+				re_dfa_addchild(self, result, node);
+			}
+			return result;
+		}
+		return re_dfa_newrangenode(self, ch, ch);
+	}
+err:
+	return RE_DFA_INVALID;
+}
+
+/* Parse a decimal number for `{n,m}' */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+re_dfa_parse_bound(struct re_dfa_parser *__restrict self, uint16_t *__restrict p_value) {
+	unsigned int value = 0;
+	unsigned char const *start = self->rdp_iter;
+	while (self->rdp_iter < self->rdp_end &&
+	       *self->rdp_iter >= '0' && *self->rdp_iter <= '9') {
+		value = value * 10 + (*self->rdp_iter - '0');
+		if (value > RE_DFA_MAXREPEAT)
+			return false;
+		++self->rdp_iter;
+	}
+	*p_value = (uint16_t)value;
+	return self->rdp_iter != start;
+}
+
+/* Parse a sequence of atoms (each with optional quantifiers) */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_parse_cat(struct re_dfa_parser *__restrict self) {
+	uint16_t result = re_dfa_newnode(self, RE_DFA_NODE_CAT);
+	if unlikely(result == RE_DFA_INVALID)
+		goto err;
+	while (self->rdp_iter < self->rdp_end &&
+	       *self->rdp_iter != '|' && *self->rdp_iter != ')') {
+		uint16_t atom, repeat;
+		uint16_t min, max;
+		atom = re_dfa_parse_atom(self);
+		if unlikely(atom == RE_DFA_INVALID)
+			goto err;
+		if (self->rdp_iter < self->rdp_end) {
+			switch (*self->rdp_iter) {
+
+			case '*':
+				min = 0;
+				max = RE_DFA_REPEAT_INF;
+				++self->rdp_iter;
+				break;
+
+			case '+':
+				min = 1;
+				max = RE_DFA_REPEAT_INF;
+				++self->rdp_iter;
+				break;
+
+			case '?':
+				min = 0;
+				max = 1;
+				++self->rdp_iter;
+				break;
+
+			case '{':
+				++self->rdp_iter;
+				if (self->rdp_iter < self->rdp_end && *self->rdp_iter == ',') {
+					min = 0;
+				} else if (!re_dfa_parse_bound(self, &min)) {
+					goto err;
+				}
+				max = min;
+				if (self->rdp_iter < self->rdp_end && *self->rdp_iter == ',') {
+					++self->rdp_iter;
+					max = RE_DFA_REPEAT_INF;
+					if (self->rdp_iter < self->rdp_end && *self->rdp_iter != '}' &&
+					    !re_dfa_parse_bound(self, &max))
+						goto err;
+				}
+				if (self->rdp_iter >= self->rdp_end || *self->rdp_iter != '}' || min > max)
+					goto err;
+				++self->rdp_iter;
+				break;
+
+			default:
+				goto append_atom;
+			}
+
+			/* Lazy/possessive quantifiers, or repeated repeats */
+			if (self->rdp_iter < self->rdp_end && strchr("*+?{", *self->rdp_iter))
+				goto err;
+			repeat = re_dfa_newnode(self, RE_DFA_NODE_REPEAT);
+			if unlikely(repeat == RE_DFA_INVALID)
+				goto err;
+			self->rdp_nodev[repeat].rdn_min = min;
+			self->rdp_nodev[repeat].rdn_max = max;
+			re_dfa_addchild(self, repeat, atom);
+			atom = repeat;
+		}
+append_atom:
+		re_dfa_addchild(self, result, atom);
+	}
+	return result;
+err:
+	return RE_DFA_INVALID;
+}
+
+/* Parse `cat|cat|...' */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_parse_alt(struct re_dfa_parser *__restrict self) {
+	uint16_t result, cat;
+	cat = re_dfa_parse_cat(self);
+	if (cat == RE_DFA_INVALID || self->rdp_iter >= self->rdp_end || *self->rdp_iter != '|')
+		return cat;
+	result = re_dfa_newnode(self, RE_DFA_NODE_ALT);
+	if unlikely(result == RE_DFA_INVALID)
+		goto err;
+	re_dfa_addchild(self, result, cat);
+	while (self->rdp_iter < self->rdp_end && *self->rdp_iter == '|') {
+		++self->rdp_iter;
+		cat = re_dfa_parse_cat(self);
+		if unlikely(cat == RE_DFA_INVALID)
+			goto err;
+		re_dfa_addchild(self, result, cat);
+	}
+	return result;
+err:
+	return RE_DFA_INVALID;
+}
+
+/* Collect the literal prefix of `node' into `buf...+=*p_len'
+ * @return: true:  All of `node' is a literal (more may follow)
+ * @return: false: The prefix ends within `node' */
+PRIVATE NONNULL((1, 3, 4)) bool DCALL
+re_dfa_getprefix(struct re_dfa_parser *__restrict self, uint16_t node,
+                 uint8_t *__restrict buf, uint8_t *__restrict p_len) {
+	struct re_dfa_node *nd = &self->rdp_nodev[node];
+	switch (nd->rdn_type) {
+
+	case RE_DFA_NODE_SET: {
+		struct re_dfa_byteset const *set = &self->rdp_setv[nd->rdn_set];
+		unsigned int i, byte = 0, count = 0;
+		for (i = 0; i < re_dfa_bitset_sizeof; ++i) {
+			if (set->rbs_bail[i])
+				return false;
+			count += POPCOUNT(set->rbs_match[i]);
+		}
+		if (count != 1 || *p_len >= RE_DFA_MAXPREFIX)
+			return false;
+		while (!re_dfa_bitset_has(set->rbs_match, byte))
+			++byte;
+		buf[(*p_len)++] = (uint8_t)byte;
+		return true;
+	}	break;
+
+	case RE_DFA_NODE_CAT:
+		for (node = nd->rdn_child; node != RE_DFA_INVALID;
+		     node = self->rdp_nodev[node].rdn_next) {
+			if (!re_dfa_getprefix(self, node, buf, p_len))
+				return false;
+		}
+		return true;
+
+	case RE_DFA_NODE_EMPTY:
+		return true;
+
+	default: break;
+	}
+	return false;
+}
+
+
+
+/************************************************************************/
+/* NFA construction                                                     */
+/************************************************************************/
+
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_nfa_newstate(struct re_dfa_parser *__restrict self, uint16_t type,
+                uint16_t out, uint16_t out2) {
+	struct re_nfa_state *state;
+	if unlikely(self->rdp_nfac >= RE_NFA_MAXSTATES)
+		return RE_DFA_INVALID;
+	state = &self->rdp_nfav[self->rdp_nfac];
+	state->rns_type = type;
+	state->rns_set  = 0;
+	state->rns_out  = out;
+	state->rns_out2 = out2;
+	return self->rdp_nfac++;
+}
+
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_nfa_compile(struct re_dfa_parser *__restrict self,
+               uint16_t node, uint16_t next);
+
+/* Compile the sequence of nodes starting at `node' (in reverse if `rdp_rev') */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_nfa_compile_cat(struct re_dfa_parser *__restrict self,
+                   uint16_t node, uint16_t next) {
+	if (node == RE_DFA_INVALID)
+		return next;
+	if (self->rdp_rev) {
+		next = re_nfa_compile(self, node, next);
+		if unlikely(next == RE_DFA_INVALID)
+			return RE_DFA_INVALID;
+		return re_nfa_compile_cat(self, self->rdp_nodev[node].rdn_next, next);
+	}
+	next = re_nfa_compile_cat(self, self->rdp_nodev[node].rdn_next, next);
+	if unlikely(next == RE_DFA_INVALID)
+		return RE_DFA_INVALID;
+	return re_nfa_compile(self, node, next);
+}
+
+/* Compile the alternatives starting at `node' */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_nfa_compile_alt(struct re_dfa_parser *__restrict self,
+                   uint16_t node, uint16_t next) {
+	uint16_t first, rest;
+	first = re_nfa_compile(self, node, next);
+	if unlikely(first == RE_DFA_INVALID)
+		return RE_DFA_INVALID;
+	node = self->rdp_nodev[node].rdn_next;
+	if (node == RE_DFA_INVALID)
+		return first;
+	rest = re_nfa_compile_alt(self, node, next);
+	if unlikely(rest == RE_DFA_INVALID)
+		return RE_DFA_INVALID;
+	return re_nfa_newstate(self, RE_NFA_SPLIT, first, rest);
+}
+
+/* Compile `node' such that it continues at `next'
+ * @return: * : The starting state of `node'
+ * @return: RE_DFA_INVALID: Too many NFA states */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_nfa_compile(struct re_dfa_parser *__restrict self,
+               uint16_t node, uint16_t next) {
+	struct re_dfa_node *nd = &self->rdp_nodev[node];
+	switch (nd->rdn_type) {
+
+	case RE_DFA_NODE_STRAY:
+		/* When matching backwards, continuation bytes are seen before their lead
+		 * byte, so they mustn't make the DFA bail. (Strings are valid UTF-8, so
+		 * this can only ever hide a fallback that the forward DFA will trigger) */
+		if (self->rdp_rev)
+			return re_nfa_newstate(self, RE_NFA_FAIL, 0, 0);
+		ATTR_FALLTHROUGH
+	case RE_DFA_NODE_SET: {
+		uint16_t result;
+		result = re_nfa_newstate(self, RE_NFA_SET, next, 0);
+		if likely(result != RE_DFA_INVALID)
+			self->rdp_nfav[result].rns_set = nd->rdn_set;
+		return result;
+	}	break;
+
+	case RE_DFA_NODE_CAT:
+		return re_nfa_compile_cat(self, nd->rdn_child, next);
+
+	case RE_DFA_NODE_ALT:
+		return re_nfa_compile_alt(self, nd->rdn_child, next);
+
+	case RE_DFA_NODE_REPEAT: {
+		uint16_t i, tail, body;
+		tail = next;
+		if (nd->rdn_max == RE_DFA_REPEAT_INF) {
+			/* Loop back to a split that either repeats, or continues at `next' */
+			tail = re_nfa_newstate(self, RE_NFA_SPLIT, 0, next);
+			if unlikely(tail == RE_DFA_INVALID)
+				goto err;
+			body = re_nfa_compile(self, nd->rdn_child, tail);
+			if unlikely(body == RE_DFA_INVALID)
+				goto err;
+			self->rdp_nfav[tail].rns_out = body;
+		} else {
+			/* Optional repetitions: `(x(x)?)?' */
+			for (i = nd->rdn_min; i < nd->rdn_max; ++i) {
+				body = re_nfa_compile(self, nd->rdn_child, tail);
+				if unlikely(body == RE_DFA_INVALID)
+					goto err;
+				tail = re_nfa_newstate(self, RE_NFA_SPLIT, body, next);
+				if unlikely(tail == RE_DFA_INVALID)
+					goto err;
+			}
+		}
+		/* Mandatory repetitions */
+		for (i = 0; i < nd->rdn_min; ++i) {
+			tail = re_nfa_compile(self, nd->rdn_child, tail);
+			if unlikely(tail == RE_DFA_INVALID)
+				goto err;
+		}
+		return tail;
+	}	break;
+
+	default: break;
+	}
+	return next;
+err:
+	return RE_DFA_INVALID;
+}
+
+
+
+/************************************************************************/
+/* Lazy DFA                                                             */
+/************************************************************************/
+
+#define RE_DFA_UNKNOWN NULL                          /* Transition hasn't been computed yet */
+#define RE_DFA_DEAD    ((struct re_dfa_dstate *)-1) /* No match is possible anymore */
+#define RE_DFA_BAIL    ((struct re_dfa_dstate *)-2) /* Fall back to libregex */
+
+struct re_dfa_dstate {
+	uint32_t                                        ds_hash;   /* [const] Hash of `ds_nfav' */
+	uint16_t                                        ds_nfac;   /* [const] # of NFA states */
+	bool                                            ds_accept; /* [const] This state accepts input */
+	uint16_t                                       *ds_nfav;   /* [const][1..ds_nfac] Sorted NFA states (`RE_NFA_SET' and `RE_NFA_MATCH') */
+	COMPILER_FLEXIBLE_ARRAY(struct re_dfa_dstate *, ds_next);  /* [0..1][lock(WRITE_ONCE)][rd_nclasses]
+	                                                            * Transitions (or one of `RE_DFA_UNKNOWN', `RE_DFA_DEAD', `RE_DFA_BAIL') */
+};
+
+struct DeeRegexDFA {
+#ifndef CONFIG_NO_THREADS
+	Dee_atomic_lock_t      rd_lock;        /* Lock for constructing new DFA states */
+#endif /* !CONFIG_NO_THREADS */
+	struct re_dfa_dstate  *rd_start;       /* [0..1][lock(WRITE_ONCE)] Starting state */
+	struct DeeRegexDFA    *rd_reverse;     /* [0..1][const][owned] DFA for the reversed pattern (used to find where matches start) */
+	struct re_nfa_state   *rd_nfav;        /* [const][1..rd_nfac] NFA states (points into the same heap block) */
+	struct re_dfa_byteset *rd_setv;        /* [const][0..rd_setc] Byte sets (points into the same heap block) */
+	uint16_t               rd_nfac;        /* [const] # of NFA states */
+	uint16_t               rd_nfastart;    /* [const] Starting NFA state */
+	uint16_t               rd_nclasses;    /* [const] # of byte equivalence classes */
+	bool                   rd_utf8;        /* [const] Input is UTF-8 (matches can't start at continuation bytes) */
+	bool                   rd_epsilon;     /* [const] The pattern can match epsilon */
+	bool                   rd_unanchored;  /* [const] Every state also includes `rd_nfastart' (a new match can begin at any byte) */
+	uint8_t                rd_prefixlen;   /* [const] Length of `rd_prefix' */
+	uint8_t                rd_prefix[RE_DFA_MAXPREFIX]; /* [const] Literal prefix of every match */
+	uint8_t                rd_class[256];  /* [const] Byte -> equivalence class */
+	uint8_t                rd_classrep[256]; /* [const][rd_nclasses] Representative byte of each equivalence class */
+	uint8_t                rd_first[256];  /* [const] Non-zero for bytes that a non-empty match can start with */
+	int                    rd_firstbyte;   /* [const] The only byte in `rd_first' (or `-1') */
+	/* Everything below is [lock(rd_lock)] */
+	uint32_t               rd_gen;         /* Current generation for `rd_mark' */
+	uint32_t              *rd_mark;        /* [1..rd_nfac] Generation when an NFA state was last added to `rd_set' */
+	uint16_t              *rd_stack;       /* [1..rd_nfac] Work stack for computing epsilon closures */
+	uint16_t              *rd_set;         /* [1..rd_nfac] Buffer for the NFA states of a new DFA state */
+	size_t                 rd_statec;      /* # of DFA states */
+	size_t                 rd_statea;      /* Allocated # of DFA states */
+	struct re_dfa_dstate **rd_statev;      /* [1..1][owned][0..rd_statec][owned] All DFA states */
+	size_t                 rd_hashmask;    /* Hash-mask of `rd_hashv' */
+	struct re_dfa_dstate **rd_hashv;       /* [0..1][0..rd_hashmask+1][owned] Hash table of `rd_statev' */
+};
+
+#define re_dfa_lock_available(self)  Dee_atomic_lock_available(&(self)->rd_lock)
+#define re_dfa_lock_acquired(self)   Dee_atomic_lock_acquired(&(self)->rd_lock)
+#define re_dfa_lock_tryacquire(self) Dee_atomic_lock_tryacquire(&(self)->rd_lock)
+#define re_dfa_lock_acquire(self)    Dee_atomic_lock_acquire(&(self)->rd_lock)
+#define re_dfa_lock_waitfor(self)    Dee_atomic_lock_waitfor(&(self)->rd_lock)
+#define re_dfa_lock_release(self)    Dee_atomic_lock_release(&(self)->rd_lock)
+
+PRIVATE NONNULL((1)) void DCALL
+re_dfa_destroy(struct DeeRegexDFA *__restrict self) {
+	size_t i;
+	for (i = 0; i < self->rd_statec; ++i)
+		Dee_Free(self->rd_statev[i]);
+	Dee_Free(self->rd_statev);
+	Dee_Free(self->rd_hashv);
+	if (self->rd_reverse)
+		re_dfa_destroy(self->rd_reverse);
+	Dee_Free(self);
+}
+
+/* Begin a new epsilon closure */
+PRIVATE NONNULL((1)) void DCALL
+re_dfa_closure_begin(struct DeeRegexDFA *__restrict self) {
+	if unlikely(++self->rd_gen == 0) {
+		bzero(self->rd_mark, self->rd_nfac * sizeof(uint32_t));
+		self->rd_gen = 1;
+	}
+}
+
+/* Add `state' (and everything reachable from it by epsilon-transitions) to the current closure */
+PRIVATE NONNULL((1)) void DCALL
+re_dfa_closure_add(struct DeeRegexDFA *__restrict self, uint16_t state) {
+	size_t sp = 0;
+	if (self->rd_mark[state] == self->rd_gen)
+		return;
+	self->rd_mark[state] = self->rd_gen;
+	self->rd_stack[sp++] = state;
+	while (sp) {
+		struct re_nfa_state const *st;
+		st = &self->rd_nfav[self->rd_stack[--sp]];
+		if (st->rns_type != RE_NFA_SPLIT)
+			continue;
+		if (self->rd_mark[st->rns_out2] != self->rd_gen) {
+			self->rd_mark[st->rns_out2] = self->rd_gen;
+			self->rd_stack[sp++] = st->rns_out2;
+		}
+		if (self->rd_mark[st->rns_out] != self->rd_gen) {
+			self->rd_mark[st->rns_out] = self->rd_gen;
+			self->rd_stack[sp++] = st->rns_out;
+		}
+	}
+}
+
+/* Write the (sorted) non-epsilon states of the current closure to `rd_set'
+ * @return: * : The # of states written */
+PRIVATE WUNUSED NONNULL((1)) uint16_t DCALL
+re_dfa_closure_collect(struct DeeRegexDFA *__restrict self) {
+	uint16_t i, result = 0;
+	for (i = 0; i < self->rd_nfac; ++i) {
+		if (self->rd_mark[i] == self->rd_gen &&
+		    (self->rd_nfav[i].rns_type == RE_NFA_SET ||
+		     self->rd_nfav[i].rns_type == RE_NFA_MATCH))
+			self->rd_set[result++] = i;
+	}
+	return result;
+}
+
+PRIVATE ATTR_PURE WUNUSED ATTR_INS(1, 2) uint32_t DCALL
+re_dfa_hashset(uint16_t const *__restrict setv, uint16_t setc) {
+	uint32_t result = 2166136261u;
+	uint16_t i;
+	for (i = 0; i < setc; ++i)
+		result = (result ^ setv[i]) * 16777619u;
+	return result;
+}
+
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+re_dfa_rehash(struct DeeRegexDFA *__restrict self) {
+	size_t i, new_mask = self->rd_hashv ? (self->rd_hashmask << 1) | 1 : 31;
+	struct re_dfa_dstate **new_hashv;
+	new_hashv = (struct re_dfa_dstate **)Dee_TryCallocc(new_mask + 1, sizeof(struct re_dfa_dstate *));
+	if unlikely(!new_hashv)
+		return false;
+	for (i = 0; i < self->rd_statec; ++i) {
+		struct re_dfa_dstate *state = self->rd_statev[i];
+		size_t j = state->ds_hash & new_mask;
+		while (new_hashv[j])
+			j = (j + 1) & new_mask;
+		new_hashv[j] = state;
+	}
+	Dee_Free(self->rd_hashv);
+	self->rd_hashv     = new_hashv;
+	self->rd_hashmask  = new_mask;
+	return true;
+}
+
+/* Return the DFA state for the first `setc' NFA states from `rd_set'
+ * @return: * :           The DFA state
+ * @return: RE_DFA_DEAD:  `setc == 0'
+ * @return: RE_DFA_BAIL:  Too many DFA states
+ * @return: NULL:         Out of memory */
+PRIVATE WUNUSED NONNULL((1)) struct re_dfa_dstate *DCALL
+re_dfa_getstate(struct DeeRegexDFA *__restrict self, uint16_t setc) {
+	struct re_dfa_dstate *result;
+	uint32_t hash;
+	size_t i;
+	if (!setc)
+		return RE_DFA_DEAD;
+	hash = re_dfa_hashset(self->rd_set, setc);
+	if (self->rd_hashv) {
+		for (i = hash & self->rd_hashmask;; i = (i + 1) & self->rd_hashmask) {
+			result = self->rd_hashv[i];
+			if (!result)
+				break;
+			if (result->ds_hash == hash && result->ds_nfac == setc &&
+			    memcmp(result->ds_nfav, self->rd_set, setc * sizeof(uint16_t)) == 0)
+				return result;
+		}
+	}
+	if unlikely(self->rd_statec >= RE_DFA_MAXSTATES)
+		return RE_DFA_BAIL;
+
+	/* Make sure there is enough space for the new state. */
+	if (self->rd_statec >= self->rd_statea) {
+		struct re_dfa_dstate **new_statev;
+		size_t new_statea = self->rd_statea ? self->rd_statea * 2 : 16;
+		new_statev = (struct re_dfa_dstate **)Dee_TryReallocc(self->rd_statev, new_statea,
+		                                                       sizeof(struct re_dfa_dstate *));
+		if unlikely(!new_statev)
+			goto err;
+		self->rd_statev = new_statev;
+		self->rd_statea = new_statea;
+	}
+	if ((self->rd_statec + 1) * 2 > (self->rd_hashv ? self->rd_hashmask + 1 : 0)) {
+		if unlikely(!re_dfa_rehash(self))
+			goto err;
+	}
+	result = (struct re_dfa_dstate *)Dee_TryMalloc(offsetof(struct re_dfa_dstate, ds_next) +
+	                                                self->rd_nclasses * sizeof(struct re_dfa_dstate *) +
+	                                                setc * sizeof(uint16_t));
+	if unlikely(!result)
+		goto err;
+	result->ds_hash   = hash;
+	result->ds_nfac   = setc;
+	result->ds_accept = false;
+	result->ds_nfav   = (uint16_t *)(result->ds_next + self->rd_nclasses);
+	memcpy(result->ds_nfav, self->rd_set, setc * sizeof(uint16_t));
+	for (i = 0; i < self->rd_nclasses; ++i)
+		result->ds_next[i] = RE_DFA_UNKNOWN;
+	for (i = 0; i < setc; ++i) {
+		if (self->rd_nfav[self->rd_set[i]].rns_type == RE_NFA_MATCH) {
+			result->ds_accept = true;
+			break;
+		}
+	}
+	self->rd_statev[self->rd_statec++] = result;
+	for (i = hash & self->rd_hashmask; self->rd_hashv[i];
+	     i = (i + 1) & self->rd_hashmask)
+		;
+	self->rd_hashv[i] = result;
+	return result;
+err:
+	return NULL;
+}
+
+/* Compute (and cache) the transition from `from' for byte class `cls'
+ * @return: * :          The next state
+ * @return: RE_DFA_DEAD: No match is possible anymore
+ * @return: RE_DFA_BAIL: Fall back to libregex */
+PRIVATE WUNUSED NONNULL((1, 2)) struct re_dfa_dstate *DCALL
+re_dfa_transition(struct DeeRegexDFA *__restrict self,
+                  struct re_dfa_dstate *__restrict from,
+                  uint8_t cls) {
+	struct re_dfa_dstate *result;
+	uint8_t byte = self->rd_classrep[cls];
+	uint16_t i;
+	re_dfa_lock_acquire(self);
+	result = from->ds_next[cls];
+	if (result != RE_DFA_UNKNOWN)
+		goto done; /* Another thread was faster */
+	re_dfa_closure_begin(self);
+	for (i = 0; i < from->ds_nfac; ++i) {
+		struct re_nfa_state const *st = &self->rd_nfav[from->ds_nfav[i]];
+		struct re_dfa_byteset const *set;
+		if (st->rns_type != RE_NFA_SET)
+			continue;
+		set = &self->rd_setv[st->rns_set];
+		if (re_dfa_bitset_has(set->rbs_bail, byte)) {
+			result = RE_DFA_BAIL;
+			goto done_cache;
+		}
+		if (re_dfa_bitset_has(set->rbs_match, byte))
+			re_dfa_closure_add(self, st->rns_out);
+	}
+	if (self->rd_unanchored)
+		re_dfa_closure_add(self, self->rd_nfastart);
+	result = re_dfa_getstate(self, re_dfa_closure_collect(self));
+	if unlikely(!result) {
+		result = RE_DFA_BAIL; /* Out of memory (don't cache) */
+		goto done;
+	}
+done_cache:
+	atomic_write(&from->ds_next[cls], result);
+done:
+	re_dfa_lock_release(self);
+	return result;
+}
+
+/* Return the starting state of `self' (or `RE_DFA_BAIL') */
+PRIVATE WUNUSED NONNULL((1)) struct re_dfa_dstate *DCALL
+re_dfa_getstart(struct DeeRegexDFA *__restrict self) {
+	struct re_dfa_dstate *result;
+	re_dfa_lock_acquire(self);
+	result = self->rd_start;
+	if (result == NULL) {
+		re_dfa_closure_begin(self);
+		re_dfa_closure_add(self, self->rd_nfastart);
+		result = re_dfa_getstate(self, re_dfa_closure_collect(self));
+		if unlikely(!result) {
+			result = RE_DFA_BAIL;
+		} else if (result != RE_DFA_BAIL) {
+			ASSERT(result != RE_DFA_DEAD);
+			atomic_write(&self->rd_start, result);
+		}
+	}
+	re_dfa_lock_release(self);
+	return result;
+}
+
+/* Compile the pattern parsed into `parser' into a new DFA
+ * @param: reverse: Build a DFA for the reversed pattern, where a new match
+ *                  can begin at any byte (s.a. `rd_unanchored')
+ * @return: * :   The DFA
+ * @return: NULL: Too many NFA states (or out of memory) */
+PRIVATE WUNUSED NONNULL((1)) struct DeeRegexDFA *DCALL
+re_dfa_compile(struct re_dfa_parser *__restrict parser,
+               uint16_t root, bool reverse) {
+	struct DeeRegexDFA *result;
+	uint16_t start, setc, i;
+	unsigned int cls, nclasses;
+	size_t extsize;
+	uint8_t *ext;
+	parser->rdp_rev  = reverse;
+	parser->rdp_nfac = 0;
+	start = re_nfa_newstate(parser, RE_NFA_MATCH, 0, 0);
+	if unlikely(start == RE_DFA_INVALID)
+		goto err;
+	start = re_nfa_compile(parser, root, start);
+	if unlikely(start == RE_DFA_INVALID)
+		goto err;
+
+	/* Allocate the DFA (NFA states, sets and work buffers follow the struct) */
+	setc    = parser->rdp_setc;
+	extsize = parser->rdp_nfac * (sizeof(uint32_t) + sizeof(struct re_nfa_state) + 2 * sizeof(uint16_t)) +
+	          setc * sizeof(struct re_dfa_byteset);
+	result = (struct DeeRegexDFA *)Dee_TryCalloc(sizeof(struct DeeRegexDFA) + extsize);
+	if unlikely(!result)
+		goto err;
+	ext = (uint8_t *)(result + 1);
+	result->rd_mark  = (uint32_t *)ext;
+	ext += parser->rdp_nfac * sizeof(uint32_t);
+	result->rd_nfav  = (struct re_nfa_state *)ext;
+	ext += parser->rdp_nfac * sizeof(struct re_nfa_state);
+	result->rd_stack = (uint16_t *)ext;
+	ext += parser->rdp_nfac * sizeof(uint16_t);
+	result->rd_set   = (uint16_t *)ext;
+	ext += parser->rdp_nfac * sizeof(uint16_t);
+	result->rd_setv  = (struct re_dfa_byteset *)ext;
+	memcpy(result->rd_nfav, parser->rdp_nfav, parser->rdp_nfac * sizeof(struct re_nfa_state));
+	memcpy(result->rd_setv, parser->rdp_setv, setc * sizeof(struct re_dfa_byteset));
+	result->rd_nfac     = parser->rdp_nfac;
+	result->rd_nfastart = start;
+	result->rd_utf8       = parser->rdp_utf8;
+	result->rd_unanchored = reverse;
+	Dee_atomic_lock_init(&result->rd_lock);
+
+	/* Partition bytes into equivalence classes (bytes that are
+	 * treated identically by every set share a transition slot) */
+	nclasses = 1;
+	for (i = 0; i < setc * 2; ++i) {
+		uint8_t const *bits = i & 1 ? result->rd_setv[i / 2].rbs_bail
+		                            : result->rd_setv[i / 2].rbs_match;
+		uint16_t newclass[512];
+		unsigned int byte, new_nclasses = 0;
+		for (cls = 0; cls < nclasses * 2; ++cls)
+			newclass[cls] = RE_DFA_INVALID;
+		for (byte = 0; byte < 256; ++byte) {
+			unsigned int key = result->rd_class[byte] * 2 + (re_dfa_bitset_has(bits, byte) ? 1 : 0);
+			if (newclass[key] == RE_DFA_INVALID)
+				newclass[key] = (uint16_t)new_nclasses++;
+			result->rd_class[byte] = (uint8_t)newclass[key];
+		}
+		nclasses = new_nclasses;
+	}
+	result->rd_nclasses = (uint16_t)nclasses;
+	for (cls = 256; cls--;)
+		result->rd_classrep[result->rd_class[cls]] = (uint8_t)cls;
+
+	/* Figure out how matches can start */
+	re_dfa_closure_begin(result);
+	re_dfa_closure_add(result, start);
+	setc = re_dfa_closure_collect(result);
+	for (i = 0; i < setc; ++i) {
+		struct re_nfa_state const *st = &result->rd_nfav[result->rd_set[i]];
+		struct re_dfa_byteset const *set;
+		unsigned int byte;
+		if (st->rns_type == RE_NFA_MATCH) {
+			result->rd_epsilon = true;
+			continue;
+		}
+		set = &result->rd_setv[st->rns_set];
+		for (byte = 0; byte < 256; ++byte) {
+			if (re_dfa_bitset_has(set->rbs_match, byte) ||
+			    re_dfa_bitset_has(set->rbs_bail, byte))
+				result->rd_first[byte] = 1;
+		}
+	}
+	if (result->rd_utf8) /* Matches only ever start at character boundaries */
+		bzero(&result->rd_first[0x80], 0x40);
+	result->rd_firstbyte = -1;
+	for (cls = 0; cls < 256; ++cls) {
+		if (!result->rd_first[cls])
+			continue;
+		if (result->rd_firstbyte != -1) {
+			result->rd_firstbyte = -1;
+			break;
+		}
+		result->rd_firstbyte = (int)cls;
+	}
+	return result;
+err:
+	return NULL;
+}
+
+/* Build the DFA for a given regex pattern.
+ * @return: * :   The DFA
+ * @return: NULL: The pattern can't be executed by a DFA (or out of memory) */
+PRIVATE WUNUSED NONNULL((1, 2)) struct DeeRegexDFA *DCALL
+re_dfa_build(char const *pattern, char const *pattern_end,
+             unsigned int compile_flags) {
+	struct re_dfa_parser *parser;
+	struct DeeRegexDFA *result = NULL;
+	uint16_t root;
+	if (compile_flags & DEE_REGEX_COMPILE_ICASE)
+		goto done;
+	parser = (struct re_dfa_parser *)Dee_TryMalloc(sizeof(struct re_dfa_parser));
+	if unlikely(!parser)
+		goto done;
+	parser->rdp_iter  = (unsigned char const *)pattern;
+	parser->rdp_end   = (unsigned char const *)pattern_end;
+	parser->rdp_utf8  = !(compile_flags & DEE_REGEX_COMPILE_NOUTF8);
+	parser->rdp_nodec = 0;
+	parser->rdp_setc  = 0;
+
+	/* Parse the pattern and compile it into an NFA (forward, and reversed). */
+	root = re_dfa_parse_alt(parser);
+	if (root == RE_DFA_INVALID || parser->rdp_iter != parser->rdp_end)
+		goto done_parser;
+	result = re_dfa_compile(parser, root, false);
+	if unlikely(!result)
+		goto done_parser;
+	result->rd_reverse = re_dfa_compile(parser, root, true);
+	if unlikely(!result->rd_reverse) {
+		re_dfa_destroy(result);
+		result = NULL;
+		goto done_parser;
+	}
+	(void)re_dfa_getprefix(parser, root, result->rd_prefix, &result->rd_prefixlen);
+done_parser:
+	Dee_Free(parser);
+done:
+	return result;
+}
+
+
+
+/************************************************************************/
+/* DFA execution                                                        */
+/************************************************************************/
+
+/* Match `self' against `start...end', returning the length of the longest match
+ * @param: p_scanned: [0..1] Set to the # of bytes that had to be looked at
+ * @return: >= 0: The # of matched bytes
+ * @return: DEE_RE_STATUS_NOMATCH: Nothing was matched
+ * @return: RE_DFA_STATUS_FALLBACK: Use libregex instead */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) Dee_ssize_t DCALL
+re_dfa_matchat(struct DeeRegexDFA *__restrict self,
+               uint8_t const *start, uint8_t const *end,
+               size_t *p_scanned) {
+	struct re_dfa_dstate *state, *next;
+	uint8_t const *iter = start;
+	Dee_ssize_t result;
+	state = atomic_read(&self->rd_start);
+	if unlikely(!state) {
+		state = re_dfa_getstart(self);
+		if unlikely(state == RE_DFA_BAIL)
+			return RE_DFA_STATUS_FALLBACK;
+	}
+	result = state->ds_accept ? 0 : DEE_RE_STATUS_NOMATCH;
+	while (iter < end) {
+		uint8_t cls = self->rd_class[*iter];
+		next = atomic_read(&state->ds_next[cls]);
+		if unlikely(next == RE_DFA_UNKNOWN)
+			next = re_dfa_transition(self, state, cls);
+		if (next == RE_DFA_DEAD)
+			break;
+		if unlikely(next == RE_DFA_BAIL)
+			return RE_DFA_STATUS_FALLBACK;
+		state = next;
+		++iter;
+		if (state->ds_accept)
+			result = (Dee_ssize_t)(iter - start);
+	}
+	if (p_scanned)
+		*p_scanned = (size_t)(iter - start);
+	return result;
+}
+
+/* Run the reverse DFA of `self' backwards from `end' down to `lo', looking for
+ * positions in `[lo, hi)' where a (non-empty) match ending at or before `end'
+ * starts. This always takes linear time, no matter how many positions there are.
+ * @param: leftmost: Find the lowest such position (else: the greatest one)
+ * @return: 0 : The position was stored in `*p_start'
+ * @return: DEE_RE_STATUS_NOMATCH: There is no such position
+ * @return: RE_DFA_STATUS_FALLBACK: Use libregex instead */
+PRIVATE WUNUSED NONNULL((1, 2, 3, 4, 6)) Dee_ssize_t DCALL
+re_dfa_rscan(struct DeeRegexDFA *__restrict self, uint8_t const *lo,
+             uint8_t const *hi, uint8_t const *end, bool leftmost,
+             uint8_t const **__restrict p_start) {
+	struct DeeRegexDFA *rev = self->rd_reverse;
+	struct re_dfa_dstate *state, *next;
+	uint8_t const *iter = end;
+	Dee_ssize_t result = DEE_RE_STATUS_NOMATCH;
+	state = atomic_read(&rev->rd_start);
+	if unlikely(!state) {
+		state = re_dfa_getstart(rev);
+		if unlikely(state == RE_DFA_BAIL)
+			return RE_DFA_STATUS_FALLBACK;
+	}
+	while (iter > lo) {
+		uint8_t cls = rev->rd_class[*--iter];
+		next = atomic_read(&state->ds_next[cls]);
+		if unlikely(next == RE_DFA_UNKNOWN)
+			next = re_dfa_transition(rev, state, cls);
+		if (next == RE_DFA_DEAD)
+			break;
+		if unlikely(next == RE_DFA_BAIL)
+			return RE_DFA_STATUS_FALLBACK;
+		state = next;
+		if (state->ds_accept && iter < hi) {
+			/* Matches only ever start at character boundaries */
+			if (rev->rd_utf8 && (*iter & 0xc0) == 0x80)
+				continue;
+			*p_start = iter;
+			result   = 0;
+			if (!leftmost)
+				break;
+		}
+	}
+	return result;
+}
+
+/* Return the length of the longest match at `start', which `re_dfa_rscan()' found */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) Dee_ssize_t DCALL
+re_dfa_matchfound(struct DeeRegexDFA *__restrict self,
+                  uint8_t const *start, uint8_t const *end) {
+	Dee_ssize_t result = re_dfa_matchat(self, start, end, NULL);
+	/* Only the forward DFA bailing can make this fail */
+	if unlikely(result <= 0)
+		result = RE_DFA_STATUS_FALLBACK;
+	return result;
+}
+
+/* Return the next position in `[iter, stop)' where a match might start (or `NULL') */
+PRIVATE WUNUSED NONNULL((1, 2, 3, 4)) uint8_t const *DCALL
+re_dfa_nextcandidate(struct DeeRegexDFA const *__restrict self, uint8_t const *iter,
+                     uint8_t const *stop, uint8_t const *end) {
+	if (self->rd_prefixlen) {
+		/* Search for the literal prefix. */
+		uint8_t const *result;
+		size_t haystack_length = (size_t)(stop - iter) + self->rd_prefixlen - 1;
+		if (haystack_length > (size_t)(end - iter))
+			haystack_length = (size_t)(end - iter);
+#ifdef CONFIG_HAVE_STRING_SSE2
+		result = dee_sse2_memmemb(iter, haystack_length, self->rd_prefix, self->rd_prefixlen);
+#else /* CONFIG_HAVE_STRING_SSE2 */
+		result = (uint8_t const *)memmem(iter, haystack_length, self->rd_prefix, self->rd_prefixlen);
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
+		return result;
+	}
+	if (self->rd_firstbyte >= 0)
+		return (uint8_t const *)memchr(iter, self->rd_firstbyte, (size_t)(stop - iter));
+	for (; iter < stop; ++iter) {
+		if (self->rd_first[*iter])
+			return iter;
+	}
+	return NULL;
+}
+
+/* DFA implementations of `DeeRegex_Match()', `DeeRegex_Search()',
+ * `DeeRegex_SearchNoEpsilon()' and `DeeRegex_RSearch()'
+ * @return: RE_DFA_STATUS_FALLBACK: Use libregex instead */
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+re_dfa_exec_match(struct DeeRegexDFA *__restrict self,
+                  struct DeeRegexExec const *__restrict exec) {
+	uint8_t const *base = (uint8_t const *)exec->rx_inbase;
+	if unlikely(exec->rx_startoff > exec->rx_endoff)
+		return RE_DFA_STATUS_FALLBACK;
+	return re_dfa_matchat(self, base + exec->rx_startoff, base + exec->rx_endoff, NULL);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+re_dfa_exec_search_noepsilon(struct DeeRegexDFA *__restrict self,
+                             struct DeeRegexExec const *__restrict exec,
+                             size_t search_range, size_t *p_match_size) {
+	uint8_t const *base = (uint8_t const *)exec->rx_inbase;
+	uint8_t const *iter, *stop, *end;
+	Dee_ssize_t length;
+	size_t budget;
+	if (exec->rx_startoff >= exec->rx_endoff)
+		return DEE_RE_STATUS_NOMATCH;
+	iter = base + exec->rx_startoff;
+	end  = base + exec->rx_endoff;
+	stop = search_range >= (size_t)(end - iter) ? end : iter + search_range;
+
+	/* Try the candidates one after the other. That's fastest when there is a match
+	 * near the start, but every failed attempt can look at everything up to `end'.
+	 * So once we've looked at as many bytes as there are, use the reverse DFA. */
+	budget = (size_t)(end - iter);
+	while ((iter = re_dfa_nextcandidate(self, iter, stop, end)) != NULL) {
+		size_t scanned;
+		length = re_dfa_matchat(self, iter, end, &scanned);
+		if (length > 0)
+			goto found;
+		if unlikely(length == RE_DFA_STATUS_FALLBACK)
+			return RE_DFA_STATUS_FALLBACK;
+		if (++iter >= stop)
+			break;
+		if (scanned >= budget) {
+			length = re_dfa_rscan(self, iter, stop, end, true, &iter);
+			if (length != 0)
+				return length;
+			length = re_dfa_matchfound(self, iter, end);
+			if unlikely(length < 0)
+				return length;
+			goto found;
+		}
+		budget -= scanned;
+	}
+	return DEE_RE_STATUS_NOMATCH;
+found:
+	if (p_match_size)
+		*p_match_size = (size_t)length;
+	return (Dee_ssize_t)(iter - base);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+re_dfa_exec_search(struct DeeRegexDFA *__restrict self,
+                   struct DeeRegexExec const *__restrict exec,
+                   size_t search_range, size_t *p_match_size) {
+	/* Where exactly epsilon-matches are found is up to libregex.
+	 * Otherwise, the only difference to `re_dfa_exec_search_noepsilon()'
+	 * would be epsilon-matches, which can't happen. */
+	if (self->rd_epsilon)
+		return RE_DFA_STATUS_FALLBACK;
+	return re_dfa_exec_search_noepsilon(self, exec, search_range, p_match_size);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) Dee_ssize_t DCALL
+re_dfa_exec_rsearch(struct DeeRegexDFA *__restrict self,
+                    struct DeeRegexExec const *__restrict exec,
+                    size_t search_range, size_t *p_match_size) {
+	uint8_t const *base = (uint8_t const *)exec->rx_inbase;
+	uint8_t const *iter, *lo, *end;
+	Dee_ssize_t length;
+	size_t budget;
+	if (self->rd_epsilon)
+		return RE_DFA_STATUS_FALLBACK;
+	if (exec->rx_startoff >= exec->rx_endoff)
+		return DEE_RE_STATUS_NOMATCH;
+	end  = base + exec->rx_endoff;
+	lo   = base + exec->rx_startoff;
+	if (search_range < (size_t)(end - lo))
+		lo = end - search_range;
+
+	/* Same as `re_dfa_exec_search_noepsilon()': once trying candidates
+	 * gets too expensive, let the reverse DFA find the rightmost one. */
+	budget = (size_t)(end - lo);
+	for (iter = end; iter > lo;) {
+		size_t scanned;
+		if (!self->rd_first[*--iter])
+			continue;
+		length = re_dfa_matchat(self, iter, end, &scanned);
+		if (length > 0)
+			goto found;
+		if unlikely(length == RE_DFA_STATUS_FALLBACK)
+			return RE_DFA_STATUS_FALLBACK;
+		if (scanned >= budget) {
+			length = re_dfa_rscan(self, lo, iter, end, false, &iter);
+			if (length != 0)
+				return length;
+			length = re_dfa_matchfound(self, iter, end);
+			if unlikely(length < 0)
+				return length;
+			goto found;
+		}
+		budget -= scanned;
+	}
+	return DEE_RE_STATUS_NOMATCH;
+found:
+	if (p_match_size)
+		*p_match_size = (size_t)length;
+	return (Dee_ssize_t)(iter - base);
+}
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_OBJECTS_UNICODE_REGEX_DFA_C_INL */
@@ -22,12 +22,16 @@
 
 #include <deemon/alloc.h>
 #include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
 #include <deemon/error.h>
 #include <deemon/format.h>
+#include <deemon/int.h>
 #include <deemon/regex.h>
 #include <deemon/string.h>
 #include <deemon/stringutils.h>
 #include <deemon/system-features.h>
+#include <deemon/tuple.h>
 #include <deemon/util/atomic.h>
 #include <deemon/util/lock.h>
 
@@ -39,6 +43,9 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+
+#include "../../runtime/runtime_error.h"
+#include "../../runtime/strings.h"
 /**/
 
 #include <__stdinc.h>
@@ -223,6 +230,18 @@ PRIVATE int DCALL re_handle_error(re_errno_t error) {
 	return DeeError_Throwf(error_type, "Regex error: %s", message);
 }
 
+DECL_END
+
+/* DFA execution of patterns without group output */
+#include "regex-dfa.c.inl"
+
+DECL_BEGIN
+
+/* Check if `exec' can be executed by `exec->rx_code->rc_dfa' */
+#define re_dfa_usable(exec)                \
+	((exec)->rx_code->rc_dfa != NULL &&    \
+	 ((exec)->rx_nmatch == 0 || (exec)->rx_code->rc_ngrps == 0))
+
 
 
 /************************************************************************/
@@ -236,6 +255,11 @@ PRIVATE int DCALL re_handle_error(re_errno_t error) {
 PUBLIC WUNUSED NONNULL((1)) Dee_ssize_t DCALL
 DeeRegex_Match(struct DeeRegexExec const *__restrict exec) {
 	Dee_ssize_t result;
+	if (re_dfa_usable(exec)) {
+		result = re_dfa_exec_match(exec->rx_code->rc_dfa, exec);
+		if likely(result != RE_DFA_STATUS_FALLBACK)
+			return result;
+	}
 again:
 	result = libre_exec_match(exec);
 	if likely(result >= DEE_RE_STATUS_NOMATCH)
@@ -259,6 +283,11 @@ PUBLIC WUNUSED NONNULL((1)) Dee_ssize_t DCALL
 DeeRegex_Search(struct DeeRegexExec const *__restrict exec,
                 size_t search_range, size_t *p_match_size) {
 	Dee_ssize_t result;
+	if (re_dfa_usable(exec)) {
+		result = re_dfa_exec_search(exec->rx_code->rc_dfa, exec, search_range, p_match_size);
+		if likely(result != RE_DFA_STATUS_FALLBACK)
+			return result;
+	}
 again:
 	result = libre_exec_search(exec, search_range, p_match_size);
 	if likely(result >= DEE_RE_STATUS_NOMATCH)
@@ -274,6 +303,11 @@ PUBLIC WUNUSED NONNULL((1)) Dee_ssize_t DCALL
 DeeRegex_SearchNoEpsilon(struct DeeRegexExec const *__restrict exec,
                          size_t search_range, size_t *p_match_size) {
 	Dee_ssize_t result;
+	if (re_dfa_usable(exec)) {
+		result = re_dfa_exec_search_noepsilon(exec->rx_code->rc_dfa, exec, search_range, p_match_size);
+		if likely(result != RE_DFA_STATUS_FALLBACK)
+			return result;
+	}
 again:
 	result = libre_exec_search_noepsilon(exec, search_range, p_match_size);
 	if likely(result >= DEE_RE_STATUS_NOMATCH)
@@ -293,6 +327,11 @@ PUBLIC WUNUSED NONNULL((1)) Dee_ssize_t
 DeeRegex_RSearch(struct DeeRegexExec const *__restrict exec,
                  size_t search_range, size_t *p_match_size) {
 	Dee_ssize_t result;
+	if (re_dfa_usable(exec)) {
+		result = re_dfa_exec_rsearch(exec->rx_code->rc_dfa, exec, search_range, p_match_size);
+		if likely(result != RE_DFA_STATUS_FALLBACK)
+			return result;
+	}
 again:
 	result = libre_exec_rsearch(exec, search_range, p_match_size);
 	if likely(result >= DEE_RE_STATUS_NOMATCH)
@@ -309,22 +348,15 @@ again:
 /* Regex compile                                                        */
 /************************************************************************/
 
-/* Compile the regex pattern of a given string `self' */
+/* Compile the regex pattern `utf8...+=size' */
 PRIVATE WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
-re_compile(DeeObject *__restrict self, unsigned int compile_flags) {
+re_compile(char const *utf8, size_t size, unsigned int compile_flags) {
+	struct DeeRegexCode *result;
 	re_errno_t comp_error;
 	struct re_compiler comp;
-	char *utf8;
 again:
-	utf8 = DeeString_AsUtf8(self);
-	if unlikely(!utf8)
-		goto err;
-
 	/* Put together the regex compiler. */
-	re_compiler_init(&comp,
-	                 utf8,
-	                 utf8 + WSTR_LENGTH(utf8),
-	                 compile_flags);
+	re_compiler_init(&comp, utf8, utf8 + size, compile_flags);
 
 	/* Initiate the compile. */
 	comp_error = libre_compiler_compile(&comp);
@@ -332,73 +364,365 @@ again:
 		goto err_comp;
 
 	/* Pack together the generated code. */
-	return re_compiler_pack(&comp);
+	result = re_compiler_pack(&comp);
+	if likely(result)
+		result->rc_dfa = re_dfa_build(utf8, utf8 + size, compile_flags);
+	return result;
 err_comp:
 	re_compiler_fini(&comp);
 	if (re_handle_error(comp_error) == 0)
 		goto again;
+	return NULL;
+}
+
+
+/* Destroy a regex previously returned by `re_compile()' */
+PRIVATE NONNULL((1)) void DCALL
+re_destroy(struct DeeRegexCode *__restrict self) {
+	if (self->rc_dfa)
+		re_dfa_destroy(self->rc_dfa);
+	Dee_Free(self);
+}
+
+
+/* Parse a regex "rules" string (if non-NULL), and or its flags into `*p_compile_flags'.
+ * For this purpose, each character from `rules' is parsed as a flag:
+ * - "i": DEE_REGEX_COMPILE_ICASE
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((2)) int DCALL
+re_parse_rules(DeeObject *rules, unsigned int *__restrict p_compile_flags) {
+	char const *iter;
+	if (rules == NULL)
+		return 0;
+	if (DeeObject_AssertTypeExact(rules, &DeeString_Type))
+		goto err;
+	iter = DeeString_STR(rules);
+	for (;;) {
+		switch (*iter++) {
+
+		case 'i':
+			*p_compile_flags |= DEE_REGEX_COMPILE_ICASE;
+			break;
+
+		case '\0':
+			return 0;
+
+		default:
+			DeeError_Throwf(&DeeError_ValueError,
+			                "Invalid regex rules string flag %:1q",
+			                iter - 1);
+			goto err;
+		}
+	}
+err:
+	return -1;
+}
+
+
+
+
+/************************************************************************/
+/* Regex object                                                         */
+/************************************************************************/
+
+#define Regex_Malloc(size)                                                       \
+	((DREF DeeRegexObject *)DeeObject_Malloc(offsetof(DeeRegexObject, re_pattern) + \
+	                                         ((size) + 1) * sizeof(char)))
+#define Regex_SizeOf(self) \
+	(offsetof(DeeRegexObject, re_pattern) + ((self)->re_size + 1) * sizeof(char))
+
+/* Create a new regex object for `utf8...+=size', and compile its code for `compile_flags'
+ * @param: flags: Flags to store in `return->re_flags' */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeRegexObject *DCALL
+regex_new(char const *utf8, size_t size, Dee_hash_t hash,
+          unsigned int flags, unsigned int compile_flags) {
+	DREF DeeRegexObject *result;
+	ASSERT(!(compile_flags & ~DEE_REGEX_COMPILE_ALL));
+	result = Regex_Malloc(size);
+	if unlikely(!result)
+		goto err;
+	bzero(result->re_codes, sizeof(result->re_codes));
+	result->re_codes[compile_flags] = re_compile(utf8, size, compile_flags);
+	if unlikely(!result->re_codes[compile_flags])
+		goto err_r;
+	result->re_hash  = hash;
+	result->re_size  = size;
+	result->re_flags = flags;
+	memcpyc(result->re_pattern, utf8, size, sizeof(char));
+	result->re_pattern[size] = '\0';
+	DeeObject_Init(result, &DeeRegex_Type);
+	return result;
+err_r:
+	DeeObject_Free(result);
 err:
 	return NULL;
 }
 
+/* Return the code of `self', compiled for `compile_flags' (set of `DEE_REGEX_COMPILE_*').
+ * The returned code remains valid until `self' is destroyed.
+ * @return: * :   The compiled regex pattern.
+ * @return: NULL: An error occurred. */
+PUBLIC WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
+DeeRegex_GetCode(DeeRegexObject *__restrict self, unsigned int compile_flags) {
+	struct DeeRegexCode *result, *existing;
+	ASSERT_OBJECT_TYPE_EXACT(self, &DeeRegex_Type);
+	ASSERT(!(compile_flags & ~DEE_REGEX_COMPILE_ALL));
+	result = atomic_read(&self->re_codes[compile_flags]);
+	if likely(result)
+		return result;
+	result = re_compile(self->re_pattern, self->re_size, compile_flags);
+	if unlikely(!result)
+		goto err;
 
-struct regex_cache_entry {
-#define REGEX_CACHE_DUMMY_STR ((DeeStringObject *)-1)
-	DeeStringObject     *rce_str;    /* [0..1] Linked string (the string that owns the regex). */
-	struct DeeRegexCode *rce_regex;  /* [valid_if(rce_str)] Compiled regex objects. */
-	unsigned int         rce_syntax; /* [valid_if(rce_str)] Regex syntax */
+	/* Publish the new code (unless another thread was faster) */
+	existing = atomic_cmpxch_val(&self->re_codes[compile_flags], NULL, result);
+	if unlikely(existing != NULL) {
+		re_destroy(result);
+		result = existing;
+	}
+	return result;
+err:
+	return NULL;
+}
+
+
+
+/************************************************************************/
+/* Regex cache                                                          */
+/************************************************************************/
+
+/* Compiled patterns are cached in 2 tiers:
+ * - `regex_cache_shards': Links strings (by address) with the `Regex' object
+ *   used to compile them. Entries are only removed when the string dies, so
+ *   code returned by `DeeString_GetRegex()' stays valid for as long as the
+ *   caller holds a reference to the pattern string.
+ * - `regex_lru': A bounded cache of recently used `Regex' objects, keyed by
+ *   pattern text. Used to find already-compiled code for patterns that are
+ *   re-created from other objects every time they are used (such patterns
+ *   would otherwise have to be re-compiled every time).
+ * Both are split into shards (each with their own lock), such that threads
+ * using different patterns don't contend for the same lock. */
+
+/* # of shards in `regex_lru' (must be a power of 2) */
+#ifndef CONFIG_REGEX_LRU_NSHARDS
+#define CONFIG_REGEX_LRU_NSHARDS 16
+#endif /* !CONFIG_REGEX_LRU_NSHARDS */
+
+/* Max # of patterns in each shard of `regex_lru' */
+#ifndef CONFIG_REGEX_LRU_SHARDSIZE
+#define CONFIG_REGEX_LRU_SHARDSIZE 16
+#endif /* !CONFIG_REGEX_LRU_SHARDSIZE */
+
+/* Regex cache statistics (s.a. `Regex.cachestats') */
+PRIVATE size_t regex_cache_hits      = 0; /* [lock(atomic)] # of lookups that could re-use already-compiled code */
+PRIVATE size_t regex_cache_misses    = 0; /* [lock(atomic)] # of lookups that had to compile their pattern */
+PRIVATE size_t regex_cache_evictions = 0; /* [lock(atomic)] # of patterns evicted from `regex_lru' */
+
+struct regex_lru_shard {
+	size_t               rls_count; /* [lock(rls_lock)][<= CONFIG_REGEX_LRU_SHARDSIZE] # of cached patterns */
+	DREF DeeRegexObject *rls_list[CONFIG_REGEX_LRU_SHARDSIZE];
+	                                /* [1..1][rls_count][lock(rls_lock)] Cached patterns (most recently used first) */
+#ifndef CONFIG_NO_THREADS
+	Dee_atomic_lock_t    rls_lock;  /* Lock for this shard */
+#endif /* !CONFIG_NO_THREADS */
 };
 
-#define regex_cache_entry_hashstr(str) Dee_HashPointer(str)
+#define regex_lru_shard_tryacquire(self) Dee_atomic_lock_tryacquire(&(self)->rls_lock)
+#define regex_lru_shard_acquire(self)    Dee_atomic_lock_acquire(&(self)->rls_lock)
+#define regex_lru_shard_release(self)    Dee_atomic_lock_release(&(self)->rls_lock)
+
+PRIVATE struct regex_lru_shard regex_lru[CONFIG_REGEX_LRU_NSHARDS];
+#define regex_lru_shardof(hash) (&regex_lru[(hash) & (CONFIG_REGEX_LRU_NSHARDS - 1)])
+
+#define regex_lru_matches(self, utf8, size, hash) \
+	((self)->re_hash == (hash) && (self)->re_size == (size) && bcmpc((self)->re_pattern, utf8, size, sizeof(char)) == 0)
+
+/* Lookup the pattern `utf8...+=size' in `regex_lru', and mark it as most recently used.
+ * @return: * :   A reference to the cached regex object.
+ * @return: NULL: The pattern isn't cached (no error was thrown). */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeRegexObject *DCALL
+regex_lru_lookup(char const *utf8, size_t size, Dee_hash_t hash) {
+	size_t i;
+	struct regex_lru_shard *shard = regex_lru_shardof(hash);
+	regex_lru_shard_acquire(shard);
+	for (i = 0; i < shard->rls_count; ++i) {
+		DREF DeeRegexObject *result = shard->rls_list[i];
+		if (regex_lru_matches(result, utf8, size, hash)) {
+			memmoveupc(&shard->rls_list[1], &shard->rls_list[0],
+			           i, sizeof(DREF DeeRegexObject *));
+			shard->rls_list[0] = result;
+			Dee_Incref(result);
+			regex_lru_shard_release(shard);
+			return result;
+		}
+	}
+	regex_lru_shard_release(shard);
+	return NULL;
+}
 
-PRIVATE struct regex_cache_entry const regex_cache_empty[] = { { NULL, NULL, 0 } };
+/* Insert `self' into `regex_lru' (as most recently used), evicting the least recently
+ * used pattern of its shard if it is full. If another thread already inserted the same
+ * pattern, any code already compiled by `self' is moved into that object instead, and
+ * the object that was already cached is returned.
+ * @return: * : A reference to the regex object that should be used in place of `self'. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeRegexObject *DCALL
+regex_lru_insert(/*inherit(always)*/ DREF DeeRegexObject *__restrict self) {
+	size_t i;
+	DREF DeeRegexObject *evicted = NULL;
+	struct regex_lru_shard *shard = regex_lru_shardof(self->re_hash);
+	regex_lru_shard_acquire(shard);
+	for (i = 0; i < shard->rls_count; ++i) {
+		DREF DeeRegexObject *existing = shard->rls_list[i];
+		if (regex_lru_matches(existing, self->re_pattern, self->re_size, self->re_hash)) {
+			Dee_Incref(existing);
+			regex_lru_shard_release(shard);
+			for (i = 0; i < COMPILER_LENOF(self->re_codes); ++i) {
+				if (self->re_codes[i] &&
+				    atomic_cmpxch(&existing->re_codes[i], NULL, self->re_codes[i]))
+					self->re_codes[i] = NULL;
+			}
+			Dee_Decref_likely(self);
+			return existing;
+		}
+	}
+	if (shard->rls_count >= CONFIG_REGEX_LRU_SHARDSIZE) {
+		evicted = shard->rls_list[CONFIG_REGEX_LRU_SHARDSIZE - 1];
+		--shard->rls_count;
+	}
+	memmoveupc(&shard->rls_list[1], &shard->rls_list[0],
+	           shard->rls_count, sizeof(DREF DeeRegexObject *));
+	shard->rls_list[0] = self;
+	++shard->rls_count;
+	Dee_Incref(self); /* Reference stored in `shard->rls_list[0]' */
+	regex_lru_shard_release(shard);
+	if (evicted) {
+		atomic_inc(&regex_cache_evictions);
+		Dee_Decref(evicted);
+	}
+	return self;
+}
 
-/* Regex cache */
-PRIVATE struct regex_cache_entry *regex_cache_base = (struct regex_cache_entry *)regex_cache_empty;
-PRIVATE size_t /*              */ regex_cache_mask = 0;
-PRIVATE size_t /*              */ regex_cache_size = 0;
-PRIVATE size_t /*              */ regex_cache_used = 0;
+/* Drop patterns from `regex_lru'
+ * @param: p_count: When non-NULL, incremented by the # of dropped patterns
+ * @return: * : The # of bytes that were freed (approximation) */
+PRIVATE size_t DCALL
+regex_lru_clear(size_t max_clear, size_t *p_count) {
+	size_t i, result = 0;
+	for (i = 0; i < COMPILER_LENOF(regex_lru); ++i) {
+		DREF DeeRegexObject *list[CONFIG_REGEX_LRU_SHARDSIZE];
+		size_t count;
+		struct regex_lru_shard *shard = &regex_lru[i];
+		if (!atomic_read(&shard->rls_count))
+			continue;
 #ifndef CONFIG_NO_THREADS
-PRIVATE Dee_atomic_rwlock_t regex_cache_lock = DEE_ATOMIC_RWLOCK_INIT;
+		if (!regex_lru_shard_tryacquire(shard))
+			continue; /* Shard is in use (don't wait for it) */
 #endif /* !CONFIG_NO_THREADS */
+		count = shard->rls_count;
+		memcpyc(list, shard->rls_list, count, sizeof(DREF DeeRegexObject *));
+		shard->rls_count = 0;
+		regex_lru_shard_release(shard);
+		if (p_count)
+			*p_count += count;
+		while (count) {
+			DREF DeeRegexObject *regex = list[--count];
+			size_t regex_size = Regex_SizeOf(regex);
+			if (Dee_DecrefIfOne(regex)) {
+				result += regex_size;
+			} else {
+				Dee_Decref(regex); /* Still referenced elsewhere (e.g. by user-code) */
+			}
+		}
+		if (result >= max_clear)
+			break;
+	}
+	return result;
+}
+
+/* Called from `DeeMem_ClearCaches()' */
+INTERN size_t DCALL
+Dee_regexcache_clearall(size_t max_clear) {
+	return regex_lru_clear(max_clear, NULL);
+}
 
-#define regex_cache_hashst(hash)        ((hash) & regex_cache_mask)
+
+struct regex_cache_entry {
+#define REGEX_CACHE_DUMMY_STR ((DeeStringObject *)-1)
+	DeeStringObject     *rce_str;   /* [0..1] Linked string (the string that owns the regex). */
+	DREF DeeRegexObject *rce_regex; /* [1..1][valid_if(rce_str && rce_str != REGEX_CACHE_DUMMY_STR)] Regex object of `rce_str' */
+};
+
+struct regex_cache_shard {
+	struct regex_cache_entry *rcs_base; /* [1..rcs_mask+1][owned_if(!= regex_cache_empty)][lock(rcs_lock)] Hash-vector */
+	size_t                    rcs_mask; /* [lock(rcs_lock)] Hash-mask */
+	size_t                    rcs_size; /* [lock(rcs_lock)] # of used + dummy entries */
+	size_t                    rcs_used; /* [lock(rcs_lock)] # of used entries */
+#ifndef CONFIG_NO_THREADS
+	Dee_atomic_rwlock_t       rcs_lock; /* Lock for this shard */
+#endif /* !CONFIG_NO_THREADS */
+};
+
+#define regex_cache_shard_read(self)     Dee_atomic_rwlock_read(&(self)->rcs_lock)
+#define regex_cache_shard_write(self)    Dee_atomic_rwlock_write(&(self)->rcs_lock)
+#define regex_cache_shard_endread(self)  Dee_atomic_rwlock_endread(&(self)->rcs_lock)
+#define regex_cache_shard_endwrite(self) Dee_atomic_rwlock_endwrite(&(self)->rcs_lock)
+
+PRIVATE struct regex_cache_entry const regex_cache_empty[] = { { NULL, NULL } };
+
+/* Regex cache (the shard of a string is selected by the low bits of its address-hash,
+ * and the remaining bits are used as hash within the shard's hash-vector) */
+#define REGEX_CACHE_SHARDBITS 4
+#define REGEX_CACHE_NSHARDS   (1 << REGEX_CACHE_SHARDBITS)
+#define REGEX_CACHE_SHARD_INIT { (struct regex_cache_entry *)regex_cache_empty, 0, 0, 0 }
+PRIVATE struct regex_cache_shard regex_cache_shards[REGEX_CACHE_NSHARDS] = {
+	REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT,
+	REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT,
+	REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT,
+	REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT, REGEX_CACHE_SHARD_INIT,
+};
+static_assert(REGEX_CACHE_NSHARDS == 16);
+
+#define regex_cache_shardof(str)        (&regex_cache_shards[Dee_HashPointer(str) & (REGEX_CACHE_NSHARDS - 1)])
+#define regex_cache_entry_hashstr(str)  (Dee_HashPointer(str) >> REGEX_CACHE_SHARDBITS)
+#define regex_cache_hashst(self, hash)  ((hash) & (self)->rcs_mask)
 #define regex_cache_hashnx(hs, perturb) (void)((hs) = ((hs) << 2) + (hs) + (perturb) + 1, (perturb) >>= 5) /* This `5' is tunable. */
-#define regex_cache_hashit(i)           (regex_cache_base + ((i) & regex_cache_mask))
+#define regex_cache_hashit(self, i)     ((self)->rcs_base + ((i) & (self)->rcs_mask))
 
-PRIVATE bool DCALL regex_cache_rehash(int sizedir) {
+PRIVATE NONNULL((1)) bool DCALL
+regex_cache_rehash(struct regex_cache_shard *__restrict self, int sizedir) {
 	struct regex_cache_entry *new_vector, *iter, *end;
-	size_t new_mask = regex_cache_mask;
+	size_t new_mask = self->rcs_mask;
 	if (sizedir > 0) {
 		new_mask = (new_mask << 1) | 1;
 		if unlikely(new_mask == 1)
 			new_mask = 16 - 1; /* Start out bigger than 2. */
 	} else if (sizedir < 0) {
-		if unlikely(!regex_cache_used) {
-			ASSERT(!regex_cache_used);
+		if unlikely(!self->rcs_used) {
+			ASSERT(!self->rcs_used);
 			/* Special case: delete the vector. */
-			if (regex_cache_base != regex_cache_empty)
-				Dee_Free(regex_cache_base);
-			regex_cache_base = (struct regex_cache_entry *)regex_cache_empty;
-			regex_cache_mask = 0;
-			regex_cache_size = 0;
+			if (self->rcs_base != regex_cache_empty)
+				Dee_Free(self->rcs_base);
+			self->rcs_base = (struct regex_cache_entry *)regex_cache_empty;
+			self->rcs_mask = 0;
+			self->rcs_size = 0;
 			return true;
 		}
 		new_mask = (new_mask >> 1);
-		if (regex_cache_used >= new_mask)
+		if (self->rcs_used >= new_mask)
 			return true;
 	}
-	ASSERT(regex_cache_used < new_mask);
-	ASSERT(regex_cache_used <= regex_cache_size);
+	ASSERT(self->rcs_used < new_mask);
+	ASSERT(self->rcs_used <= self->rcs_size);
 	new_vector = (struct regex_cache_entry *)Dee_TryCallocc(new_mask + 1,
 	                                                        sizeof(struct regex_cache_entry));
 	if unlikely(!new_vector)
 		return false;
-	ASSERT((regex_cache_base == regex_cache_empty) == (regex_cache_mask == 0));
-	ASSERT((regex_cache_base == regex_cache_empty) == (regex_cache_size == 0));
-	if (regex_cache_base != regex_cache_empty) {
-		/* Re-insert all existing items into the new Dict vector. */
-		end = (iter = regex_cache_base) + (regex_cache_mask + 1);
+	ASSERT((self->rcs_base == regex_cache_empty) == (self->rcs_mask == 0));
+	ASSERT((self->rcs_base == regex_cache_empty) == (self->rcs_size == 0));
+	if (self->rcs_base != regex_cache_empty) {
+		/* Re-insert all existing items into the new vector. */
+		end = (iter = self->rcs_base) + (self->rcs_mask + 1);
 		for (; iter < end; ++iter) {
 			struct regex_cache_entry *item;
 			dhash_t i, perturb;
@@ -414,13 +738,13 @@ PRIVATE bool DCALL regex_cache_rehash(int sizedir) {
 			/* Transfer this object. */
 			memcpy(item, iter, sizeof(struct regex_cache_entry));
 		}
-		Dee_Free(regex_cache_base);
+		Dee_Free(self->rcs_base);
 		/* With all dummy items gone, the size now equals what is actually used. */
-		regex_cache_size = regex_cache_used;
+		self->rcs_size = self->rcs_used;
 	}
-	ASSERT(regex_cache_size == regex_cache_used);
-	regex_cache_mask = new_mask;
-	regex_cache_base = new_vector;
+	ASSERT(self->rcs_size == self->rcs_used);
+	self->rcs_mask = new_mask;
+	self->rcs_base = new_vector;
 	return true;
 }
 
@@ -429,28 +753,44 @@ PRIVATE bool DCALL regex_cache_rehash(int sizedir) {
  * Called from `DeeString_Type.tp_fini' when `STRING_UTF_FREGEX' was set. */
 INTERN NONNULL((1)) void DCALL
 DeeString_DestroyRegex(DeeStringObject *__restrict self) {
-	struct regex_cache_entry *item, old_item;
+	DREF DeeRegexObject *regex = NULL;
 	dhash_t i, perturb, hash;
+	struct regex_cache_shard *shard = regex_cache_shardof(self);
 	hash = regex_cache_entry_hashstr(self);
-	Dee_atomic_rwlock_write(&regex_cache_lock);
-	perturb = i = regex_cache_hashst(hash);
+	regex_cache_shard_write(shard);
+	perturb = i = regex_cache_hashst(shard, hash);
 	for (;; regex_cache_hashnx(i, perturb)) {
-		item = regex_cache_hashit(i);
+		struct regex_cache_entry *item;
+		item = regex_cache_hashit(shard, i);
 		if (item->rce_str == NULL)
 			break;
 		if (item->rce_str == self) {
 			item->rce_str = REGEX_CACHE_DUMMY_STR;
-			Dee_Free(item->rce_regex);
-			DBG_memset(&item->rce_syntax, 0xcc, sizeof(item->rce_syntax));
+			regex         = item->rce_regex;
 			DBG_memset(&item->rce_regex, 0xcc, sizeof(item->rce_regex));
-			ASSERT(regex_cache_used);
-			--regex_cache_used;
+			ASSERT(shard->rcs_used);
+			--shard->rcs_used;
+			break; /* Strings only ever appear once. */
 		}
 	}
-	memcpy(&old_item, item, sizeof(struct regex_cache_entry));
-	if (regex_cache_used <= regex_cache_size / 3)
-		regex_cache_rehash(-1);
-	Dee_atomic_rwlock_endwrite(&regex_cache_lock);
+	if (shard->rcs_used <= shard->rcs_size / 3)
+		regex_cache_rehash(shard, -1);
+	regex_cache_shard_endwrite(shard);
+	Dee_XDecref(regex);
+}
+
+
+/* Same as `DeeRegex_GetCode()', but account for the lookup in cache statistics. */
+PRIVATE WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
+regex_cache_getcode(DeeRegexObject *__restrict self, unsigned int compile_flags) {
+	struct DeeRegexCode *result;
+	result = atomic_read(&self->re_codes[compile_flags]);
+	if likely(result) {
+		atomic_inc(&regex_cache_hits);
+		return result;
+	}
+	atomic_inc(&regex_cache_misses);
+	return DeeRegex_GetCode(self, compile_flags);
 }
 
 
@@ -469,65 +809,65 @@ DeeString_GetRegex(/*String*/ DeeObject *__restrict self,
                    unsigned int compile_flags,
                    DeeObject *rules) {
 	struct DeeRegexCode *result;
+	DREF DeeRegexObject *regex;
 	struct regex_cache_entry *first_dummy;
+	struct regex_cache_shard *shard;
 	dhash_t i, perturb, hash;
+	char const *utf8;
 	ASSERT_OBJECT_TYPE_EXACT(self, &DeeString_Type);
+	ASSERT(!(compile_flags & ~DEE_REGEX_COMPILE_ALL));
 
 	/* Parse `rules' (if given) */
-	if (rules != NULL) {
-		char const *iter;
-		DeeObject_AssertTypeExact(rules, &DeeString_Type);
-		iter = DeeString_STR(rules);
-again_rules_iter:
-		switch (*iter++) {
-
-		case 'i':
-			compile_flags |= DEE_REGEX_COMPILE_ICASE;
-			goto again_rules_iter;
-
-		case '\0':
-			break;
-
-		default:
-			DeeError_Throwf(&DeeError_ValueError,
-			                "Invalid regex rules string flag %:1q",
-			                iter - 1);
-		}
-	}
+	if unlikely(re_parse_rules(rules, &compile_flags))
+		goto err;
 
-	/* Lookup regex in cache */
-	hash = regex_cache_entry_hashstr(self);
-	Dee_atomic_rwlock_read(&regex_cache_lock);
-	perturb = i = regex_cache_hashst(hash);
+	/* Lookup the regex object linked with `self' */
+	shard = regex_cache_shardof(self);
+	hash  = regex_cache_entry_hashstr(self);
+	regex_cache_shard_read(shard);
+	perturb = i = regex_cache_hashst(shard, hash);
 	for (;; regex_cache_hashnx(i, perturb)) {
 		struct regex_cache_entry *item;
-		item = regex_cache_hashit(i);
+		item = regex_cache_hashit(shard, i);
 		if (!item->rce_str)
 			break; /* End-of-hash-chain */
-		if (item->rce_str == (DeeStringObject *)self &&
-		    item->rce_syntax == compile_flags) {
-			result = item->rce_regex;
-			Dee_atomic_rwlock_endread(&regex_cache_lock);
-			return result;
+		if (item->rce_str == (DeeStringObject *)self) {
+			/* The linked regex object stays alive until `self' is destroyed. */
+			regex = item->rce_regex;
+			regex_cache_shard_endread(shard);
+			return regex_cache_getcode(regex, compile_flags);
 		}
 	}
-	Dee_atomic_rwlock_endread(&regex_cache_lock);
+	regex_cache_shard_endread(shard);
 
-	/* Not found int cache -> create a new regex object. */
-	result = re_compile(self, compile_flags);
+	/* Not linked with `self' -> lookup by pattern text, or compile a new regex object. */
+	utf8 = DeeString_AsUtf8(self);
+	if unlikely(!utf8)
+		goto err;
+	regex = regex_lru_lookup(utf8, WSTR_LENGTH(utf8), DeeString_Hash(self));
+	if (regex) {
+		result = regex_cache_getcode(regex, compile_flags);
+	} else {
+		atomic_inc(&regex_cache_misses);
+		regex = regex_new(utf8, WSTR_LENGTH(utf8), DeeString_Hash(self),
+		                  DEE_REGEX_COMPILE_NORMAL, compile_flags);
+		if unlikely(!regex)
+			goto err;
+		regex  = regex_lru_insert(regex);
+		result = DeeRegex_GetCode(regex, compile_flags);
+	}
 	if unlikely(!result)
-		goto err; /* Error */
+		goto err_regex;
 
-	/* Store produced regex object in cache. */
+	/* Link `regex' with `self' */
 again_lock_and_insert_result:
-	Dee_atomic_rwlock_write(&regex_cache_lock);
+	regex_cache_shard_write(shard);
 again_insert_result:
-	hash = regex_cache_entry_hashstr(self);
 	first_dummy = NULL;
-	perturb = i = regex_cache_hashst(hash);
+	perturb = i = regex_cache_hashst(shard, hash);
 	for (;; regex_cache_hashnx(i, perturb)) {
 		struct regex_cache_entry *item;
-		item = regex_cache_hashit(i);
+		item = regex_cache_hashit(shard, i);
 		if (item->rce_str == NULL) {
 			if (first_dummy == NULL)
 				first_dummy = item;
@@ -537,9 +877,8 @@ again_insert_result:
 			first_dummy = item;
 			continue;
 		}
-		if (item->rce_str == (DeeStringObject *)self &&
-		    item->rce_syntax == compile_flags) {
-			struct DeeRegexCode *existing_regex;
+		if (item->rce_str == (DeeStringObject *)self) {
+			DeeRegexObject *existing_regex;
 
 			/* Race condition: another thread was faster (but use their result) */
 			ASSERTF(((DeeStringObject *)self)->s_data != NULL,
@@ -547,15 +886,15 @@ again_insert_result:
 			ASSERTF(((DeeStringObject *)self)->s_data->u_flags & STRING_UTF_FREGEX,
 			        "String is in regex cache, but doesn't have regex-flag set?");
 			existing_regex = item->rce_regex;
-			Dee_atomic_rwlock_endwrite(&regex_cache_lock);
-			Dee_Free(result);
-			return existing_regex;
+			regex_cache_shard_endwrite(shard);
+			Dee_Decref(regex);
+			return DeeRegex_GetCode(existing_regex, compile_flags);
 		}
 	}
 
 	/* String doesn't appear in regex cache, yet. */
 	if ((first_dummy != NULL) &&
-	    (regex_cache_size + 1 < regex_cache_mask ||
+	    (shard->rcs_size + 1 < shard->rcs_mask ||
 	     first_dummy->rce_str != NULL)) {
 		/* Make sure that the string's regex flag is set. */
 		bool wasdummy;
@@ -565,8 +904,10 @@ again_insert_result:
 			bool haslock = true;
 			utf = Dee_string_utf_tryalloc();
 			if unlikely(!utf) {
-				Dee_atomic_rwlock_endwrite(&regex_cache_lock);
+				regex_cache_shard_endwrite(shard);
 				utf = Dee_string_utf_alloc();
+				if unlikely(!utf)
+					goto err_regex;
 				haslock = false;
 			}
 			if unlikely(!atomic_cmpxch(&((DeeStringObject *)self)->s_data, NULL, utf)) {
@@ -585,29 +926,367 @@ again_insert_result:
 		ASSERT(first_dummy->rce_str == NULL ||
 		       first_dummy->rce_str == REGEX_CACHE_DUMMY_STR);
 		wasdummy = first_dummy->rce_str != NULL;
-		first_dummy->rce_str    = (DeeStringObject *)self;
-		first_dummy->rce_regex  = result;
-		first_dummy->rce_syntax = compile_flags;
-		++regex_cache_used;
+		first_dummy->rce_str   = (DeeStringObject *)self;
+		first_dummy->rce_regex = regex; /* Inherit reference */
+		++shard->rcs_used;
 		if (!wasdummy) {
-			++regex_cache_size;
-			if (regex_cache_size * 2 > regex_cache_mask)
-				regex_cache_rehash(1);
+			++shard->rcs_size;
+			if (shard->rcs_size * 2 > shard->rcs_mask)
+				regex_cache_rehash(shard, 1);
 		}
-		Dee_atomic_rwlock_endwrite(&regex_cache_lock);
+		regex_cache_shard_endwrite(shard);
 		return result;
 	}
 
 	/* Rehash and try again. */
-	if (regex_cache_rehash(1))
+	if (regex_cache_rehash(shard, 1))
 		goto again_insert_result;
-	Dee_atomic_rwlock_endwrite(&regex_cache_lock);
+	regex_cache_shard_endwrite(shard);
 	if (Dee_CollectMemory(1))
 		goto again_lock_and_insert_result;
+err_regex:
+	Dee_Decref(regex);
+err:
+	return NULL;
+}
+
+
+/* Same as `DeeString_GetRegex()', but `self' may also be a `Regex' object,
+ * in which case the returned code remains valid for as long as a reference
+ * to `self' is held (`rules' are or'd with those of the `Regex' object).
+ * @return: * :   The compiled regex pattern.
+ * @return: NULL: An error occurred (including `self' not being a string or `Regex'). */
+PUBLIC WUNUSED NONNULL((1)) struct DeeRegexCode *DCALL
+DeeObject_GetRegex(/*String|Regex*/ DeeObject *__restrict self,
+                   unsigned int compile_flags,
+                   DeeObject *rules) {
+	if (DeeRegex_Check(self)) {
+		DeeRegexObject *me = (DeeRegexObject *)self;
+		if unlikely(re_parse_rules(rules, &compile_flags))
+			goto err;
+		return DeeRegex_GetCode(me, compile_flags | me->re_flags);
+	}
+	if (DeeObject_AssertTypeExact(self, &DeeString_Type))
+		goto err;
+	return DeeString_GetRegex(self, compile_flags, rules);
+err:
+	return NULL;
+}
+
+
+
+
+/************************************************************************/
+/* Regex type                                                           */
+/************************************************************************/
+
+PRIVATE WUNUSED DREF DeeRegexObject *DCALL
+regex_init_kw(size_t argc, DeeObject *const *argv, DeeObject *kw) {
+	DREF DeeRegexObject *result;
+	DeeObject *pattern, *rules = NULL;
+	unsigned int flags = DEE_REGEX_COMPILE_NORMAL;
+	char const *utf8;
+	Dee_hash_t hash;
+	PRIVATE DEFINE_KWLIST(kwlist, { K(pattern), K(rules), KEND });
+	if (DeeArg_UnpackKw(argc, argv, kw, kwlist, "o|o:Regex", &pattern, &rules))
+		goto err;
+	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
+		goto err;
+	if unlikely(re_parse_rules(rules, &flags))
+		goto err;
+	utf8 = DeeString_AsUtf8(pattern);
+	if unlikely(!utf8)
+		goto err;
+	hash = DeeString_Hash(pattern);
+
+	/* Regex objects without rules are shared with the regex cache. */
+	if (flags == DEE_REGEX_COMPILE_NORMAL) {
+		result = regex_lru_lookup(utf8, WSTR_LENGTH(utf8), hash);
+		if (result) {
+			if unlikely(!regex_cache_getcode(result, flags))
+				goto err_r;
+			return result;
+		}
+	}
+	atomic_inc(&regex_cache_misses);
+	result = regex_new(utf8, WSTR_LENGTH(utf8), hash, flags, flags);
+	if (result && flags == DEE_REGEX_COMPILE_NORMAL)
+		result = regex_lru_insert(result);
+	return result;
+err_r:
+	Dee_Decref(result);
 err:
 	return NULL;
 }
 
+PRIVATE NONNULL((1)) void DCALL
+regex_fini(DeeRegexObject *__restrict self) {
+	size_t i;
+	for (i = 0; i < COMPILER_LENOF(self->re_codes); ++i) {
+		if (self->re_codes[i])
+			re_destroy(self->re_codes[i]);
+	}
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+regex_print(DeeRegexObject *__restrict self,
+            dformatprinter printer, void *arg) {
+	return (*printer)(arg, self->re_pattern, self->re_size);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+regex_printrepr(DeeRegexObject *__restrict self,
+                dformatprinter printer, void *arg) {
+	if (self->re_flags & DEE_REGEX_COMPILE_ICASE) {
+		return DeeFormat_Printf(printer, arg, "Regex(%$q, \"i\")",
+		                        self->re_size, self->re_pattern);
+	}
+	return DeeFormat_Printf(printer, arg, "Regex(%$q)",
+	                        self->re_size, self->re_pattern);
+}
+
+PRIVATE WUNUSED NONNULL((1)) Dee_hash_t DCALL
+regex_hash(DeeRegexObject *__restrict self) {
+	return self->re_hash ^ self->re_flags;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+regex_equals(DeeRegexObject *self, DeeRegexObject *other) {
+	if (DeeObject_AssertTypeExact(other, &DeeRegex_Type))
+		goto err;
+	return self == other ||
+	       (self->re_flags == other->re_flags &&
+	        regex_lru_matches(self, other->re_pattern, other->re_size, other->re_hash));
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+regex_eq(DeeRegexObject *self, DeeRegexObject *other) {
+	int result = regex_equals(self, other);
+	if unlikely(result < 0)
+		goto err;
+	return_bool_(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+regex_ne(DeeRegexObject *self, DeeRegexObject *other) {
+	int result = regex_equals(self, other);
+	if unlikely(result < 0)
+		goto err;
+	return_bool_(!result);
+err:
+	return NULL;
+}
+
+PRIVATE struct type_cmp regex_cmp = {
+	/* .tp_hash = */ (Dee_hash_t (DCALL *)(DeeObject *__restrict))&regex_hash,
+	/* .tp_eq   = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&regex_eq,
+	/* .tp_ne   = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&regex_ne
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+regex_getpattern(DeeRegexObject *__restrict self) {
+	return DeeString_NewUtf8(self->re_pattern, self->re_size,
+	                         STRING_ERROR_FIGNORE);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+regex_getrules(DeeRegexObject *__restrict self) {
+	if (self->re_flags & DEE_REGEX_COMPILE_ICASE)
+		return DeeString_New("i");
+	return_reference_(Dee_EmptyString);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+regex_getngroups(DeeRegexObject *__restrict self) {
+	struct DeeRegexCode *code;
+	code = DeeRegex_GetCode(self, self->re_flags);
+	if unlikely(!code)
+		goto err;
+	return DeeInt_NewUInt16(code->rc_ngrps);
+err:
+	return NULL;
+}
+
+PRIVATE struct type_getset tpconst regex_getsets[] = {
+	TYPE_GETTER("pattern", &regex_getpattern,
+	            "->?Dstring\n"
+	            "The pattern string of @this regex"),
+	TYPE_GETTER("rules", &regex_getrules,
+	            "->?Dstring\n"
+	            "The rules string that was given when @this regex was constructed"),
+	TYPE_GETTER("ngroups", &regex_getngroups,
+	            "->?Dint\n"
+	            "The number of groups defined by @this regex's pattern"),
+	TYPE_GETSET_END
+};
+
+/* Invoke `data.<attr>(self, argv[1:]...)' */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) DREF DeeObject *DCALL
+regex_forward(DeeRegexObject *self, char const *attr, char const *name,
+              size_t argc, DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *args[5];
+	if unlikely(argc < 1 || argc > COMPILER_LENOF(args))
+		goto err_argc;
+	args[0] = (DeeObject *)self;
+	memcpyc(args + 1, argv + 1, argc - 1, sizeof(DeeObject *));
+	return DeeObject_CallAttrStringKw(argv[0], attr, argc, args, kw);
+err_argc:
+	err_invalid_argc(name, argc, 1, COMPILER_LENOF(args));
+	return NULL;
+}
+
+#define DEFINE_REGEX_FORWARD(func, attr, name)                              \
+	PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL                      \
+	func(DeeRegexObject *self, size_t argc,                                 \
+	     DeeObject *const *argv, DeeObject *kw) {                           \
+		return regex_forward(self, attr, name, argc, argv, kw);             \
+	}
+DEFINE_REGEX_FORWARD(regex_match, "rematch", "match")
+DEFINE_REGEX_FORWARD(regex_find, "refind", "find")
+DEFINE_REGEX_FORWARD(regex_rfind, "rerfind", "rfind")
+DEFINE_REGEX_FORWARD(regex_findall, "refindall", "findall")
+DEFINE_REGEX_FORWARD(regex_locateall, "relocateall", "locateall")
+DEFINE_REGEX_FORWARD(regex_split, "resplit", "split")
+DEFINE_REGEX_FORWARD(regex_replace, "rereplace", "replace")
+DEFINE_REGEX_FORWARD(regex_count, "recount", "count")
+#undef DEFINE_REGEX_FORWARD
+
+PRIVATE struct type_method tpconst regex_methods[] = {
+	TYPE_KWMETHOD("match", &regex_match,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,rules=!P{})->?X2?Dint?N\n"
+	              "Same as ${data.rematch(this, start, end, rules)}"),
+	TYPE_KWMETHOD("find", &regex_find,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "Same as ${data.refind(this, start, end, range, rules)}"),
+	TYPE_KWMETHOD("rfind", &regex_rfind,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "Same as ${data.rerfind(this, start, end, range, rules)}"),
+	TYPE_KWMETHOD("findall", &regex_findall,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,rules=!P{})->?S?T2?Dint?Dint\n"
+	              "Same as ${data.refindall(this, start, end, rules)}"),
+	TYPE_KWMETHOD("locateall", &regex_locateall,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,rules=!P{})->?S?X2?Dstring?DBytes\n"
+	              "Same as ${data.relocateall(this, start, end, rules)}"),
+	TYPE_KWMETHOD("split", &regex_split,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,rules=!P{})->?S?X2?Dstring?DBytes\n"
+	              "Same as ${data.resplit(this, start, end, rules)}"),
+	TYPE_KWMETHOD("replace", &regex_replace,
+	              "(data:?X2?Dstring?DBytes,replace:?X2?Dstring?DBytes,max:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?Dstring?DBytes\n"
+	              "Same as ${data.rereplace(this, replace, max, rules)}"),
+	TYPE_KWMETHOD("count", &regex_count,
+	              "(data:?X2?Dstring?DBytes,start=!0,end=!-1,rules=!P{})->?Dint\n"
+	              "Same as ${data.recount(this, start, end, rules)}"),
+	TYPE_METHOD_END
+};
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+regex_class_getcachestats(DeeObject *__restrict UNUSED(self)) {
+	size_t i, count = 0;
+	for (i = 0; i < COMPILER_LENOF(regex_lru); ++i)
+		count += atomic_read(&regex_lru[i].rls_count);
+	return DeeTuple_Newf(PCKuSIZ PCKuSIZ PCKuSIZ PCKuSIZ,
+	                     atomic_read(&regex_cache_hits),
+	                     atomic_read(&regex_cache_misses),
+	                     atomic_read(&regex_cache_evictions),
+	                     count);
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+regex_class_clearcache(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	size_t count = 0;
+	if (DeeArg_Unpack(argc, argv, ":clearcache"))
+		goto err;
+	regex_lru_clear((size_t)-1, &count);
+	return DeeInt_NewSize(count);
+err:
+	return NULL;
+}
+
+PRIVATE struct type_getset tpconst regex_class_getsets[] = {
+	TYPE_GETTER("cachestats", &regex_class_getcachestats,
+	            "->?T4?Dint?Dint?Dint?Dint\n"
+	            "Returns a tuple (hits, misses, evictions, size) describing the regex cache:\n"
+	            "#T{Field|Description~"
+	            /**/ "hits|# of times an already-compiled pattern was re-used&"
+	            /**/ "misses|# of times a pattern had to be compiled&"
+	            /**/ "evictions|# of patterns evicted from the cache to make space for others&"
+	            /**/ "size|# of patterns currently held by the cache"
+	            "}"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_method tpconst regex_class_methods[] = {
+	TYPE_METHOD("clearcache", &regex_class_clearcache,
+	            "->?Dint\n"
+	            "Drop all patterns held by the regex cache, and return how many there were\n"
+	            "Patterns that are still in use (either as ?. objects, or as pattern strings "
+	            /**/ "that were already used for matching) remain compiled"),
+	TYPE_METHOD_END
+};
+
+PUBLIC DeeTypeObject DeeRegex_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ DeeString_STR(&str_Regex),
+	/* .tp_doc      = */ DOC("A pre-compiled regular expression pattern\n"
+	                         "Regex objects can be used in place of pattern strings in all "
+	                         /**/ "regex functions of ?Dstring and ?DBytes (e.g. ?Arematch?Dstring), "
+	                         /**/ "where they guaranty that the pattern is only compiled once, "
+	                         /**/ "no matter how the pattern string was created.\n"
+	                         "\n"
+	                         "(pattern:?Dstring,rules=!P{})\n"
+	                         "#tValueError{The given @rules contain an unrecognized flag}"
+	                         "#tSyntaxError{The given @pattern is malformed}"
+	                         "Compile @pattern as a regular expression. For a list of supported "
+	                         /**/ "@rules, see ?Arematch?Dstring"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL | TP_FVARIABLE | TP_FNAMEOBJECT,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_var = */ {
+				/* .tp_ctor        = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor   = */ (dfunptr_t)&DeeObject_NewRef,
+				/* .tp_deep_ctor   = */ (dfunptr_t)&DeeObject_NewRef,
+				/* .tp_any_ctor    = */ (dfunptr_t)NULL,
+				/* .tp_free        = */ (dfunptr_t)NULL,
+				/* .tp_pad         = */ { (dfunptr_t)NULL },
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&regex_init_kw,
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&regex_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL,
+		/* .tp_print     = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&regex_print,
+		/* .tp_printrepr = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&regex_printrepr
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ &regex_cmp,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ regex_methods,
+	/* .tp_getsets       = */ regex_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ regex_class_methods,
+	/* .tp_class_getsets = */ regex_class_getsets,
+	/* .tp_class_members = */ NULL
+};
+
 
 
 DECL_END
@@ -127,7 +127,7 @@ refaiter_ctor(ReSequenceIterator *__restrict self) {
 	if unlikely(!self->rsi_exec.rx_code)
 		return -1;
 	self->rsi_data            = Dee_EmptyString;
-	self->rsi_exec.rx_pattern = (DREF String *)Dee_EmptyString;
+	self->rsi_exec.rx_pattern = Dee_EmptyString;
 	Dee_Incref_n(Dee_EmptyString, 2);
 	Dee_atomic_rwlock_init(&self->rsi_lock);
 	return 0;
@@ -140,7 +140,7 @@ rebfaiter_ctor(ReSequenceIterator *__restrict self) {
 	if unlikely(!self->rsi_exec.rx_code)
 		return -1;
 	self->rsi_data            = Dee_EmptyBytes;
-	self->rsi_exec.rx_pattern = (DREF String *)Dee_EmptyString;
+	self->rsi_exec.rx_pattern = Dee_EmptyString;
 	Dee_Incref(Dee_EmptyBytes);
 	Dee_Incref(Dee_EmptyString);
 	Dee_atomic_rwlock_init(&self->rsi_lock);
@@ -355,7 +355,7 @@ PRIVATE struct type_getset tpconst rebfaiter_getsets[] = {
 #define rebfaiter_members refaiter_members
 PRIVATE struct type_member tpconst refaiter_members[] = {
 	TYPE_MEMBER_FIELD_DOC("__input__", STRUCT_OBJECT, offsetof(ReSequenceIterator, rsi_data), "->?X2?Dstring?DBytes"),
-	TYPE_MEMBER_FIELD_DOC("__pattern__", STRUCT_OBJECT, offsetof(ReSequenceIterator, rsi_exec.rx_pattern), "->?Dstring"),
+	TYPE_MEMBER_FIELD_DOC("__pattern__", STRUCT_OBJECT, offsetof(ReSequenceIterator, rsi_exec.rx_pattern), "->?X2?Dstring?DRegex"),
 	TYPE_MEMBER_FIELD("__start__", STRUCT_SIZE_T | STRUCT_CONST, offsetof(ReSequenceIterator, rsi_exec.rx_startoff)),
 	TYPE_MEMBER_FIELD("__end__", STRUCT_SIZE_T | STRUCT_CONST, offsetof(ReSequenceIterator, rsi_exec.rx_endoff)),
 	TYPE_MEMBER_BITFIELD("__notbol__", STRUCT_CONST, ReSequenceIterator, rsi_exec.rx_eflags, DEE_RE_EXEC_NOTBOL),
@@ -1160,7 +1160,7 @@ refa_ctor(ReSequence *__restrict self) {
 	if unlikely(!self->rs_exec.rx_code)
 		return -1;
 	self->rs_data            = Dee_EmptyString;
-	self->rs_exec.rx_pattern = (DREF String *)Dee_EmptyString;
+	self->rs_exec.rx_pattern = Dee_EmptyString;
 	Dee_Incref_n(Dee_EmptyString, 2);
 	return 0;
 }
@@ -1172,7 +1172,7 @@ rebfa_ctor(ReSequence *__restrict self) {
 	if unlikely(!self->rs_exec.rx_code)
 		return -1;
 	self->rs_data            = Dee_EmptyBytes;
-	self->rs_exec.rx_pattern = (DREF String *)Dee_EmptyString;
+	self->rs_exec.rx_pattern = Dee_EmptyString;
 	Dee_Incref(Dee_EmptyBytes);
 	Dee_Incref(Dee_EmptyString);
 	return 0;
@@ -1330,7 +1330,7 @@ PRIVATE struct type_seq rebfa_seq = {
 #define rebfa_members refa_members
 PRIVATE struct type_member tpconst refa_members[] = {
 	TYPE_MEMBER_FIELD_DOC("__input__", STRUCT_OBJECT, offsetof(ReSequence, rs_data), "->?X2?Dstring?DBytes"),
-	TYPE_MEMBER_FIELD_DOC("__pattern__", STRUCT_OBJECT, offsetof(ReSequence, rs_exec.rx_pattern), "->?Dstring"),
+	TYPE_MEMBER_FIELD_DOC("__pattern__", STRUCT_OBJECT, offsetof(ReSequence, rs_exec.rx_pattern), "->?X2?Dstring?DRegex"),
 	TYPE_MEMBER_FIELD("__start__", STRUCT_SIZE_T | STRUCT_CONST, offsetof(ReSequence, rs_exec.rx_startoff)),
 	TYPE_MEMBER_FIELD("__end__", STRUCT_SIZE_T | STRUCT_CONST, offsetof(ReSequence, rs_exec.rx_endoff)),
 	TYPE_MEMBER_BITFIELD("__notbol__", STRUCT_CONST, ReSequence, rs_exec.rx_eflags, DEE_RE_EXEC_NOTBOL),
@@ -0,0 +1,471 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_OBJECTS_UNICODE_SIMD_H
+#define GUARD_DEEMON_OBJECTS_UNICODE_SIMD_H 1
+
+#include <deemon/api.h>
+#include <deemon/system-features.h> /* memchr(), memcmp() */
+
+#include <hybrid/bit.h>       /* CTZ(), POPCOUNT() */
+#include <hybrid/unaligned.h> /* UNALIGNED_GET32() */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* SSE2 kernels for string searching, ASCII processing and width conversion.
+ *
+ * SSE2 is part of the x86_64 baseline (and is available on any i686
+ * target compiled for it), so no runtime CPU detection is necessary:
+ * when the compiler targets SSE2, these kernels are used unconditionally.
+ * All kernels only ever use unaligned loads that lie entirely within
+ * the given buffers, and fall back to scalar loops for trailing data. */
+#ifdef CONFIG_NO_STRING_SSE2
+#undef CONFIG_HAVE_STRING_SSE2
+#elif !defined(CONFIG_HAVE_STRING_SSE2) && \
+      (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+       (defined(_M_IX86_FP) && (_M_IX86_FP + 0) >= 2))
+#define CONFIG_HAVE_STRING_SSE2
+#endif /* ... */
+
+#ifdef CONFIG_HAVE_STRING_SSE2
+#include <emmintrin.h>
+
+DECL_BEGIN
+
+#define DEE_SSE2_LOADU(p) _mm_loadu_si128((__m128i const *)(void const *)(p))
+
+/* Same as `memchrw()' / `memchrl()' */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 3) uint16_t *
+dee_sse2_memchrw(void const *__restrict p, uint16_t c, size_t n) {
+	uint16_t const *iter = (uint16_t const *)p;
+	__m128i vc = _mm_set1_epi16((short)c);
+	for (; n >= 8; n -= 8, iter += 8) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi16(DEE_SSE2_LOADU(iter), vc));
+		if (mask)
+			return (uint16_t *)iter + (CTZ(mask) >> 1);
+	}
+	for (; n; --n, ++iter) {
+		if (*iter == c)
+			return (uint16_t *)iter;
+	}
+	return NULL;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 3) uint32_t *
+dee_sse2_memchrl(void const *__restrict p, uint32_t c, size_t n) {
+	uint32_t const *iter = (uint32_t const *)p;
+	__m128i vc = _mm_set1_epi32((int)c);
+	for (; n >= 4; n -= 4, iter += 4) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi32(DEE_SSE2_LOADU(iter), vc));
+		if (mask)
+			return (uint32_t *)iter + (CTZ(mask) >> 2);
+	}
+	for (; n; --n, ++iter) {
+		if (*iter == c)
+			return (uint32_t *)iter;
+	}
+	return NULL;
+}
+
+/* Same as `memmem()' / `memmemw()' / `memmeml()'
+ *
+ * Candidate positions are found by comparing the first and last character
+ * of the needle against 16 bytes of the haystack at once (such that false
+ * positives are rare, even for natural-language text), and only then are
+ * the remaining characters compared. */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) ATTR_INS(3, 4) uint8_t *
+dee_sse2_memmemb(void const *__restrict haystack, size_t haystack_length,
+                 void const *__restrict needle, size_t needle_length) {
+	uint8_t const *iter = (uint8_t const *)haystack;
+	uint8_t const *ndl  = (uint8_t const *)needle;
+	uint8_t const *end;
+	__m128i vfirst, vlast;
+	if unlikely(!needle_length || needle_length > haystack_length)
+		return NULL;
+	if (needle_length == 1)
+		return (uint8_t *)memchr(haystack, ndl[0], haystack_length);
+	end    = iter + (haystack_length - needle_length) + 1;
+	vfirst = _mm_set1_epi8((char)ndl[0]);
+	vlast  = _mm_set1_epi8((char)ndl[needle_length - 1]);
+	for (; (size_t)(end - iter) >= 16; iter += 16) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(DEE_SSE2_LOADU(iter), vfirst),
+		                                                     _mm_cmpeq_epi8(DEE_SSE2_LOADU(iter + needle_length - 1), vlast)));
+		for (; mask; mask &= mask - 1) {
+			uint8_t const *candidate = iter + CTZ(mask);
+			if (memcmp(candidate + 1, ndl + 1, needle_length - 2) == 0)
+				return (uint8_t *)candidate;
+		}
+	}
+	for (; iter < end; ++iter) {
+		if (iter[0] == ndl[0] &&
+		    memcmp(iter + 1, ndl + 1, needle_length - 1) == 0)
+			return (uint8_t *)iter;
+	}
+	return NULL;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) ATTR_INS(3, 4) uint16_t *
+dee_sse2_memmemw(void const *__restrict haystack, size_t haystack_length,
+                 void const *__restrict needle, size_t needle_length) {
+	uint16_t const *iter = (uint16_t const *)haystack;
+	uint16_t const *ndl  = (uint16_t const *)needle;
+	uint16_t const *end;
+	__m128i vfirst, vlast;
+	if unlikely(!needle_length || needle_length > haystack_length)
+		return NULL;
+	if (needle_length == 1)
+		return dee_sse2_memchrw(haystack, ndl[0], haystack_length);
+	end    = iter + (haystack_length - needle_length) + 1;
+	vfirst = _mm_set1_epi16((short)ndl[0]);
+	vlast  = _mm_set1_epi16((short)ndl[needle_length - 1]);
+	for (; (size_t)(end - iter) >= 8; iter += 8) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(DEE_SSE2_LOADU(iter), vfirst),
+		                                                     _mm_cmpeq_epi16(DEE_SSE2_LOADU(iter + needle_length - 1), vlast)));
+		for (mask &= 0x5555; mask; mask &= mask - 1) {
+			uint16_t const *candidate = iter + (CTZ(mask) >> 1);
+			if (memcmp(candidate + 1, ndl + 1, (needle_length - 2) * 2) == 0)
+				return (uint16_t *)candidate;
+		}
+	}
+	for (; iter < end; ++iter) {
+		if (iter[0] == ndl[0] &&
+		    memcmp(iter + 1, ndl + 1, (needle_length - 1) * 2) == 0)
+			return (uint16_t *)iter;
+	}
+	return NULL;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) ATTR_INS(3, 4) uint32_t *
+dee_sse2_memmeml(void const *__restrict haystack, size_t haystack_length,
+                 void const *__restrict needle, size_t needle_length) {
+	uint32_t const *iter = (uint32_t const *)haystack;
+	uint32_t const *ndl  = (uint32_t const *)needle;
+	uint32_t const *end;
+	__m128i vfirst, vlast;
+	if unlikely(!needle_length || needle_length > haystack_length)
+		return NULL;
+	if (needle_length == 1)
+		return dee_sse2_memchrl(haystack, ndl[0], haystack_length);
+	end    = iter + (haystack_length - needle_length) + 1;
+	vfirst = _mm_set1_epi32((int)ndl[0]);
+	vlast  = _mm_set1_epi32((int)ndl[needle_length - 1]);
+	for (; (size_t)(end - iter) >= 4; iter += 4) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi32(DEE_SSE2_LOADU(iter), vfirst),
+		                                                     _mm_cmpeq_epi32(DEE_SSE2_LOADU(iter + needle_length - 1), vlast)));
+		for (mask &= 0x1111; mask; mask &= mask - 1) {
+			uint32_t const *candidate = iter + (CTZ(mask) >> 2);
+			if (memcmp(candidate + 1, ndl + 1, (needle_length - 2) * 4) == 0)
+				return (uint32_t *)candidate;
+		}
+	}
+	for (; iter < end; ++iter) {
+		if (iter[0] == ndl[0] &&
+		    memcmp(iter + 1, ndl + 1, (needle_length - 1) * 4) == 0)
+			return (uint32_t *)iter;
+	}
+	return NULL;
+}
+
+/* Return the number of leading ASCII characters (<= 0x7f) in `p...+=n' */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_sse2_asciilen(void const *__restrict p, size_t n) {
+	uint8_t const *iter = (uint8_t const *)p;
+	uint8_t const *end  = iter + n;
+	for (; (size_t)(end - iter) >= 16; iter += 16) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(DEE_SSE2_LOADU(iter));
+		if (mask)
+			return (size_t)(iter - (uint8_t const *)p) + CTZ(mask);
+	}
+	for (; iter < end; ++iter) {
+		if (*iter > 0x7f)
+			break;
+	}
+	return (size_t)(iter - (uint8_t const *)p);
+}
+
+/* Copy characters from `src' to `dst', toggling the case of every character
+ * in [lo,hi] (which must be `A-Z' or `a-z'), for as long as every character
+ * within a 16-byte block is ASCII. Returns the # of characters processed
+ * (always a multiple of 16), after which the caller must handle the next
+ * block using the full unicode database. */
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_asciicase(uint8_t *__restrict dst, uint8_t const *__restrict src,
+                   size_t n, uint8_t lo, uint8_t hi) {
+	size_t result = 0;
+	/* Bias characters such that [lo,hi] becomes [-128,-128+hi-lo] (signed compare) */
+	__m128i vbias  = _mm_set1_epi8((char)(0x80 - lo));
+	__m128i vlimit = _mm_set1_epi8((char)(-128 + (hi - lo) + 1));
+	__m128i vflip  = _mm_set1_epi8(0x20);
+	for (; n - result >= 16; result += 16) {
+		__m128i chars = DEE_SSE2_LOADU(src + result);
+		__m128i inrange;
+		if (_mm_movemask_epi8(chars) != 0)
+			break; /* Non-ASCII characters */
+		inrange = _mm_cmplt_epi8(_mm_add_epi8(chars, vbias), vlimit);
+		chars   = _mm_xor_si128(chars, _mm_and_si128(inrange, vflip));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result), chars);
+	}
+	return result;
+}
+
+/* Return the number of leading ASCII characters (<= 0x7f) in `p...+=n' */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_sse2_asciilen16(uint16_t const *__restrict p, size_t n) {
+	uint16_t const *iter = p;
+	uint16_t const *end  = p + n;
+	__m128i vmask = _mm_set1_epi16((short)0xff80);
+	__m128i vzero = _mm_setzero_si128();
+	for (; (size_t)(end - iter) >= 8; iter += 8) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(DEE_SSE2_LOADU(iter), vmask), vzero));
+		if (mask != 0xffff)
+			return (size_t)(iter - p) + (CTZ(mask ^ 0xffff) >> 1);
+	}
+	for (; iter < end; ++iter) {
+		if (*iter > 0x7f)
+			break;
+	}
+	return (size_t)(iter - p);
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_sse2_asciilen32(uint32_t const *__restrict p, size_t n) {
+	uint32_t const *iter = p;
+	uint32_t const *end  = p + n;
+	__m128i vmask = _mm_set1_epi32((int)0xffffff80);
+	__m128i vzero = _mm_setzero_si128();
+	for (; (size_t)(end - iter) >= 4; iter += 4) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(DEE_SSE2_LOADU(iter), vmask), vzero));
+		if (mask != 0xffff)
+			return (size_t)(iter - p) + (CTZ(mask ^ 0xffff) >> 2);
+	}
+	for (; iter < end; ++iter) {
+		if (*iter > 0x7f)
+			break;
+	}
+	return (size_t)(iter - p);
+}
+
+/* Return the number of non-ASCII bytes (>= 0x80) in `p...+=n' */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_sse2_countnonascii(void const *__restrict p, size_t n) {
+	uint8_t const *iter = (uint8_t const *)p;
+	uint8_t const *end  = iter + n;
+	size_t result = 0;
+	for (; (size_t)(end - iter) >= 16; iter += 16)
+		result += POPCOUNT((unsigned int)_mm_movemask_epi8(DEE_SSE2_LOADU(iter)));
+	for (; iter < end; ++iter)
+		result += *iter >> 7;
+	return result;
+}
+
+/* Return the number of leading characters in `p...+=n' that aren't UTF-16 surrogates */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_sse2_nosurrogatelen(uint16_t const *__restrict p, size_t n) {
+	uint16_t const *iter = p;
+	uint16_t const *end  = p + n;
+	__m128i vmask = _mm_set1_epi16((short)0xf800);
+	__m128i vsurr = _mm_set1_epi16((short)0xd800);
+	for (; (size_t)(end - iter) >= 8; iter += 8) {
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(DEE_SSE2_LOADU(iter), vmask), vsurr));
+		if (mask)
+			return (size_t)(iter - p) + (CTZ(mask) >> 1);
+	}
+	for (; iter < end; ++iter) {
+		if ((*iter & 0xf800) == 0xd800)
+			break;
+	}
+	return (size_t)(iter - p);
+}
+
+/* Widen characters from `src' into `dst' in blocks of 16 (or 8 for `dee_sse2_widen16to32()').
+ * Returns the # of characters processed, after which the caller must
+ * convert the remaining (less than a block of) characters itself. */
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_widen8to16(uint16_t *__restrict dst, uint8_t const *__restrict src, size_t n) {
+	size_t result = 0;
+	__m128i vzero = _mm_setzero_si128();
+	for (; n - result >= 16; result += 16) {
+		__m128i chars = DEE_SSE2_LOADU(src + result);
+		_mm_storeu_si128((__m128i *)(void *)(dst + result), _mm_unpacklo_epi8(chars, vzero));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result + 8), _mm_unpackhi_epi8(chars, vzero));
+	}
+	return result;
+}
+
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_widen8to32(uint32_t *__restrict dst, uint8_t const *__restrict src, size_t n) {
+	size_t result = 0;
+	__m128i vzero = _mm_setzero_si128();
+	for (; n - result >= 16; result += 16) {
+		__m128i chars = DEE_SSE2_LOADU(src + result);
+		__m128i lo    = _mm_unpacklo_epi8(chars, vzero);
+		__m128i hi    = _mm_unpackhi_epi8(chars, vzero);
+		_mm_storeu_si128((__m128i *)(void *)(dst + result), _mm_unpacklo_epi16(lo, vzero));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result + 4), _mm_unpackhi_epi16(lo, vzero));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result + 8), _mm_unpacklo_epi16(hi, vzero));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result + 12), _mm_unpackhi_epi16(hi, vzero));
+	}
+	return result;
+}
+
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_widen16to32(uint32_t *__restrict dst, uint16_t const *__restrict src, size_t n) {
+	size_t result = 0;
+	__m128i vzero = _mm_setzero_si128();
+	for (; n - result >= 8; result += 8) {
+		__m128i chars = DEE_SSE2_LOADU(src + result);
+		_mm_storeu_si128((__m128i *)(void *)(dst + result), _mm_unpacklo_epi16(chars, vzero));
+		_mm_storeu_si128((__m128i *)(void *)(dst + result + 4), _mm_unpackhi_epi16(chars, vzero));
+	}
+	return result;
+}
+
+/* Narrow characters from `src' into `dst' in blocks of 16, for as long as
+ * none of the characters of a block have any of the bits from `mask' set
+ * (`0xff00' / `0xffffff00' to narrow LATIN-1, or `0xff80' / `0xffffff80'
+ * to narrow ASCII). Returns the # of characters processed, after which
+ * the caller must convert the next block (and any remaining ones) itself. */
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_narrow16to8(uint8_t *__restrict dst, uint16_t const *__restrict src,
+                     size_t n, uint16_t mask) {
+	size_t result = 0;
+	__m128i vmask = _mm_set1_epi16((short)mask);
+	__m128i vzero = _mm_setzero_si128();
+	for (; n - result >= 16; result += 16) {
+		__m128i lo = DEE_SSE2_LOADU(src + result);
+		__m128i hi = DEE_SSE2_LOADU(src + result + 8);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(lo, hi), vmask), vzero)) != 0xffff)
+			break;
+		_mm_storeu_si128((__m128i *)(void *)(dst + result), _mm_packus_epi16(lo, hi));
+	}
+	return result;
+}
+
+LOCAL ATTR_INS(2, 3) ATTR_OUTS(1, 3) size_t
+dee_sse2_narrow32to8(uint8_t *__restrict dst, uint32_t const *__restrict src,
+                     size_t n, uint32_t mask) {
+	size_t result = 0;
+	__m128i vmask = _mm_set1_epi32((int)mask);
+	__m128i vzero = _mm_setzero_si128();
+	for (; n - result >= 16; result += 16) {
+		__m128i a = DEE_SSE2_LOADU(src + result);
+		__m128i b = DEE_SSE2_LOADU(src + result + 4);
+		__m128i c = DEE_SSE2_LOADU(src + result + 8);
+		__m128i d = DEE_SSE2_LOADU(src + result + 12);
+		__m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, vmask), vzero)) != 0xffff)
+			break;
+		/* All characters are <= 0xff, so the signed saturation of `packs' never kicks in */
+		_mm_storeu_si128((__m128i *)(void *)(dst + result),
+		                 _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+	}
+	return result;
+}
+
+#undef DEE_SSE2_LOADU
+
+DECL_END
+#endif /* CONFIG_HAVE_STRING_SSE2 */
+
+
+/* Portable front-ends for the kernels above:
+ *  - Functions that return a length/count fall back to scalar loops.
+ *  - Block kernels (widen/narrow) process nothing, such that the caller's
+ *    scalar loop (which must always exist) ends up converting everything. */
+DECL_BEGIN
+
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define dee_asciilen         dee_sse2_asciilen
+#define dee_asciilen16       dee_sse2_asciilen16
+#define dee_asciilen32       dee_sse2_asciilen32
+#define dee_countnonascii    dee_sse2_countnonascii
+#define dee_nosurrogatelen   dee_sse2_nosurrogatelen
+#define dee_widen8to16       dee_sse2_widen8to16
+#define dee_widen8to32       dee_sse2_widen8to32
+#define dee_widen16to32      dee_sse2_widen16to32
+#define dee_narrow16to8      dee_sse2_narrow16to8
+#define dee_narrow32to8      dee_sse2_narrow32to8
+#else /* CONFIG_HAVE_STRING_SSE2 */
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_asciilen(void const *__restrict p, size_t n) {
+	uint8_t const *data = (uint8_t const *)p;
+	size_t result = 0;
+	/* Check 4 bytes at a time */
+	for (; n - result >= 4; result += 4) {
+		if (UNALIGNED_GET32(data + result) & UINT32_C(0x80808080))
+			break;
+	}
+	while (result < n && data[result] <= 0x7f)
+		++result;
+	return result;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_asciilen16(uint16_t const *__restrict p, size_t n) {
+	size_t result = 0;
+	while (result < n && p[result] <= 0x7f)
+		++result;
+	return result;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_asciilen32(uint32_t const *__restrict p, size_t n) {
+	size_t result = 0;
+	while (result < n && p[result] <= 0x7f)
+		++result;
+	return result;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_countnonascii(void const *__restrict p, size_t n) {
+	uint8_t const *data = (uint8_t const *)p;
+	size_t i, result = 0;
+	for (i = 0; i < n; ++i)
+		result += data[i] >> 7;
+	return result;
+}
+
+LOCAL ATTR_PURE WUNUSED ATTR_INS(1, 2) size_t
+dee_nosurrogatelen(uint16_t const *__restrict p, size_t n) {
+	size_t result = 0;
+	while (result < n && (p[result] & 0xf800) != 0xd800)
+		++result;
+	return result;
+}
+
+#define dee_widen8to16(dst, src, n)        0
+#define dee_widen8to32(dst, src, n)        0
+#define dee_widen16to32(dst, src, n)       0
+#define dee_narrow16to8(dst, src, n, mask) 0
+#define dee_narrow32to8(dst, src, n, mask) 0
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_OBJECTS_UNICODE_SIMD_H */
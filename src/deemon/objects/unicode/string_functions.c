@@ -41,6 +41,7 @@
 #include <hybrid/overflow.h>
 
 #include "regroups.h"
+#include "simd.h"
 
 #ifndef SIZE_MAX
 #include <hybrid/limitcore.h>
@@ -521,55 +522,39 @@ err:
 	return NULL;
 }
 
+struct string_join_data {
+	String                 *sjd_sep;     /* [1..1] The separator string. */
+	struct unicode_printer *sjd_printer; /* [1..1] The printer used to construct the result. */
+	bool                    sjd_first;   /* True if no element has been printed, yet. */
+};
+
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+string_join_foreach_cb(void *arg, DeeObject *elem) {
+	struct string_join_data *data = (struct string_join_data *)arg;
+
+	/* Print `self' prior to every object, starting with the 2nd one. */
+	if (!data->sjd_first) {
+		if unlikely(unicode_printer_printstring(data->sjd_printer, (DeeObject *)data->sjd_sep) < 0)
+			goto err;
+	}
+	if unlikely(unicode_printer_printobject(data->sjd_printer, elem) < 0)
+		goto err;
+	data->sjd_first = false;
+	return 0;
+err:
+	return -1;
+}
+
 PRIVATE WUNUSED NONNULL((1, 2)) DREF String *DCALL
 DeeString_Join(String *self, DeeObject *seq) {
-	DREF DeeObject *iter, *elem;
-	bool is_first = true;
-	size_t fast_size;
+	struct string_join_data data;
 	struct unicode_printer printer = UNICODE_PRINTER_INIT;
-	fast_size = DeeFastSeq_GetSize(seq);
-	if (fast_size != DEE_FASTSEQ_NOTFAST) {
-		/* Fast-sequence optimizations. */
-		size_t i;
-		for (i = 0; i < fast_size; ++i) {
-			/* Print `self' prior to every object, starting with the 2nd one. */
-			if unlikely(!is_first && unicode_printer_printstring(&printer, (DeeObject *)self) < 0)
-				goto err;
-			elem = DeeFastSeq_GetItem(seq, i);
-			if unlikely(!elem)
-				goto err;
-			if unlikely(unicode_printer_printobject(&printer, elem) < 0)
-				goto err_elem_noiter;
-			Dee_Decref(elem);
-			is_first = false;
-		}
-	} else {
-		iter = DeeObject_IterSelf(seq);
-		if unlikely(!iter)
-			goto err;
-		while (ITER_ISOK(elem = DeeObject_IterNext(iter))) {
-			/* Print `self' prior to every object, starting with the 2nd one. */
-			if unlikely(!is_first && unicode_printer_printstring(&printer, (DeeObject *)self) < 0)
-				goto err_elem;
-			if unlikely(unicode_printer_printobject(&printer, elem) < 0)
-				goto err_elem;
-			Dee_Decref(elem);
-			is_first = false;
-			if (DeeThread_CheckInterrupt())
-				goto err_iter;
-		}
-		if unlikely(!elem)
-			goto err_iter;
-		Dee_Decref(iter);
-	}
+	data.sjd_sep     = self;
+	data.sjd_printer = &printer;
+	data.sjd_first   = true;
+	if unlikely(DeeObject_Foreach(seq, &string_join_foreach_cb, &data) < 0)
+		goto err;
 	return (DREF String *)unicode_printer_pack(&printer);
-err_elem_noiter:
-	Dee_Decref(elem);
-	goto err;
-err_elem:
-	Dee_Decref(elem);
-err_iter:
-	Dee_Decref(iter);
 err:
 	unicode_printer_fini(&printer);
 	return NULL;
@@ -649,10 +634,22 @@ DeeString_IsAscii(String *__restrict self,
 	struct string_utf *utf = self->s_data;
 	if (utf && utf->u_flags & STRING_UTF_FASCII)
 		return true;
-	DeeString_Foreach(self, start_index, end_index, iter, end, {
-		if (*iter > 0x7f)
+#ifdef CONFIG_HAVE_STRING_SSE2
+	if (!utf || utf->u_width == STRING_WIDTH_1BYTE) {
+		uint8_t *str = DeeString_Get1Byte((DeeObject *)self);
+		if (end_index > WSTR_LENGTH(str))
+			end_index = WSTR_LENGTH(str);
+		if (start_index < end_index &&
+		    dee_sse2_asciilen(str + start_index, end_index - start_index) < end_index - start_index)
 			return false;
-	});
+	} else
+#endif /* CONFIG_HAVE_STRING_SSE2 */
+	{
+		DeeString_Foreach(self, start_index, end_index, iter, end, {
+			if (*iter > 0x7f)
+				return false;
+		});
+	}
 	/* Remember if the whole string is ASCII. */
 	if (utf && start_index == 0 &&
 	    end_index >= DeeString_WLEN(self))
@@ -9419,9 +9416,7 @@ generic_regex_getargs(String *self, size_t argc, DeeObject *const *argv,
 	                    &pattern, &result->rx_startoff, &result->rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
-	result->rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
+	result->rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
 	if unlikely(!result->rx_code)
 		goto err;
 	result->rx_nmatch = 0;
@@ -9464,9 +9459,7 @@ search_regex_getargs(String *self, size_t argc, DeeObject *const *argv,
 	                    &result->rewr_exec.rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
-	result->rewr_exec.rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
+	result->rewr_exec.rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
 	if unlikely(!result->rewr_exec.rx_code)
 		goto err;
 	result->rewr_exec.rx_nmatch = 0;
@@ -10004,8 +9997,6 @@ string_rereplace(String *self, size_t argc, DeeObject *const *argv, DeeObject *k
 	                    "oo|" UNPuSIZ "o:rereplace",
 	                    &pattern, &replace, &maxreplace, &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(pattern, &DeeString_Type))
-		goto err;
 	if (DeeObject_AssertTypeExact(replace, &DeeString_Type))
 		goto err;
 	replace_start = DeeString_AsUtf8(replace);
@@ -10013,7 +10004,7 @@ string_rereplace(String *self, size_t argc, DeeObject *const *argv, DeeObject *k
 		goto err;
 	replace_end = replace_start + WSTR_LENGTH(replace_start);
 	exec.rx_eflags = 0; /* TODO: NOTBOL/NOTEOL */
-	exec.rx_code = DeeString_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
+	exec.rx_code = DeeObject_GetRegex(pattern, DEE_REGEX_COMPILE_NORMAL, rules);
 	if unlikely(!exec.rx_code)
 		goto err;
 	exec.rx_nmatch = COMPILER_LENOF(groups);
@@ -10122,7 +10113,7 @@ err:
 }
 
 struct DeeRegexBaseExec {
-	DREF String               *rx_pattern;  /* [1..1] Pattern string (only a reference within objects in "./reproxy.c.inl") */
+	DREF DeeObject            *rx_pattern;  /* [1..1] Pattern string or `Regex' (only a reference within objects in "./reproxy.c.inl") */
 	struct DeeRegexCode const *rx_code;     /* [1..1] Regex code */
 	void const                *rx_inbase;   /* [0..rx_insize][valid_if(rx_startoff < rx_endoff)] Input data to scan
 	                                         * When `rx_code' was compiled with `DEE_REGEX_COMPILE_NOUTF8', this data
@@ -10167,9 +10158,7 @@ base_regex_getargs(String *self, size_t argc, DeeObject *const *argv,
 	                    &result->rx_endoff,
 	                    &rules))
 		goto err;
-	if (DeeObject_AssertTypeExact(result->rx_pattern, &DeeString_Type))
-		goto err;
-	result->rx_code = DeeString_GetRegex((DeeObject *)result->rx_pattern,
+	result->rx_code = DeeObject_GetRegex(result->rx_pattern,
 	                                     DEE_REGEX_COMPILE_NORMAL, rules);
 	if unlikely(!result->rx_code)
 		goto err;
@@ -11361,7 +11350,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 
 	/* Regex functions. */
 	TYPE_KWMETHOD("rematch", &string_rematch,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?X2?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?X2?Dint?N\n"
 	              "#tValueError{The given @pattern is malformed}"
 	              "#r{The number of leading characters in ${this.substr(start, end)} "
 	              /*    */ "matched by @pattern, or ?N if @pattern doesn't match}"
@@ -11378,12 +11367,13 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "}\n"
 	              "Note that in deemon, regex patterns are compiled lazily and stored alongside the given @pattern string "
 	              /**/ "itself. As such, regular code that simply hard-codes the regular expressions it uses will execute "
-	              /**/ "slowly only the first time around. However, be careful not to write code where the used patterns "
-	              /**/ "are derived from other objects every time they are used (e.g. sub-strings), or decoded from bytes. "
-	              /**/ "To prevent regex patterns from constantly needing to be re-compiled, make sure to store the pattern "
-	              /**/ "strings with duration that spans across all use instances (constant string literals share their "
-	              /**/ "storage duration with that of the surrounding module and are thus the perfect candidate, meaning "
-	              /**/ "that hard-coded regex pattern strings are always optimal).\n"
+	              /**/ "slowly only the first time around. Patterns that are derived from other objects every time they are "
+	              /**/ "used (e.g. sub-strings), or decoded from bytes are looked up in a bounded cache of recently used "
+	              /**/ "patterns (keyed by their text), meaning that they usually don't need to be re-compiled either. "
+	              /**/ "However, that cache may evict patterns when many different ones are used, so if you want to be sure "
+	              /**/ "that a pattern is only compiled once, construct a ?DRegex object and pass that as @pattern instead "
+	              /**/ "(constant string literals share their storage duration with that of the surrounding module, meaning "
+	              /**/ "that hard-coded regex pattern strings are always optimal as well).\n"
 	              "Supported Match expressions:"
 	              "#T{Expression|Description~"
 	              /**/ "#C{XY}|Match #CX followed by #CY&"
@@ -11486,14 +11476,14 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              /**/ "#C{\\_>}|At a end-of-symbol (alias for #C{\\>})"
 	              "}"),
 	TYPE_KWMETHOD("rematches", &string_rematches,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Check if @pattern matches the entirety of the specified range of @this ?.\n"
 	              "This function behaves identical to ${this.rematch(...) == ?#this}"),
 	TYPE_KWMETHOD("refind", &string_refind,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11501,7 +11491,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "Find the first sub-string matched by @pattern, and return its start/end indices, or ?N if no match exists\n"
 	              "Note that using ?N in an expand expression will expand to the all ?N-values"),
 	TYPE_KWMETHOD("rerfind", &string_rerfind,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11509,7 +11499,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "Find the last sub-string matched by @pattern, and return its start/end indices, "
 	              /**/ "or ?N if no match exists (s.a. #refind)"),
 	TYPE_KWMETHOD("reindex", &string_reindex,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11517,7 +11507,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#refind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("rerindex", &string_rerindex,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11525,7 +11515,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#rerfind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("relocate", &string_relocate,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11535,7 +11525,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              /**/ "given regular expression, or ?N if not found\n"
 	              "This function has nothing to do with relocations! - it's pronounced R.E. locate"),
 	TYPE_KWMETHOD("rerlocate", &string_rerlocate,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?X2?.?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11544,7 +11534,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "In other words: return the last sub-string matched by the "
 	              /**/ "given regular expression, or ?N if not found"),
 	TYPE_KWMETHOD("repartition", &string_repartition,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11561,7 +11551,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "	);\n"
 	              "}}"),
 	TYPE_KWMETHOD("rerpartition", &string_rerpartition,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?T3?.?.?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11578,7 +11568,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "	);\n"
 	              "}}"),
 	TYPE_KWMETHOD("rereplace", &string_rereplace,
-	              "(pattern:?.,replace:?.,max:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?.\n"
+	              "(pattern:?X2?.?DRegex,replace:?.,max:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11594,7 +11584,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              /**/ "#C{\\#&}|Outputs a literal $r\"#&\" into the returned ?."
 	              "}"),
 	TYPE_KWMETHOD("refindall", &string_refindall,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?T2?Dint?Dint\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?T2?Dint?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11602,7 +11592,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "Locations where @pattern matches epsilon are not included in the returned sequence\n"
 	              "Note that the matches returned are ordered ascendingly"),
 	TYPE_KWMETHOD("relocateall", &string_relocateall,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11612,7 +11602,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "Locations where @pattern matches epsilon are not included in the returned sequence\n"
 	              "This function has nothing to do with relocations! - it's pronounced R.E. locate all"),
 	TYPE_KWMETHOD("resplit", &string_resplit,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11630,7 +11620,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "strings between matches, use ?#relocateall instead, which also behaves "
 	              "as a sequence"),
 	TYPE_KWMETHOD("restartswith", &string_restartswith,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11641,7 +11631,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              /**/ "}"
 	              "}"),
 	TYPE_KWMETHOD("reendswith", &string_reendswith,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11653,25 +11643,25 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              /**/ "}"
 	              "}"),
 	TYPE_KWMETHOD("restrip", &string_restrip,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all leading and trailing matches for @pattern from @this ?. and return the result (s.a. ?#strip)"),
 	TYPE_KWMETHOD("relstrip", &string_relstrip,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all leading matches for @pattern from @this ?. and return the result (s.a. ?#lstrip)"),
 	TYPE_KWMETHOD("rerstrip", &string_rerstrip,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?.\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?.\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Strip all trailing matches for @pattern from @this ?. and return the result (s.a. ?#lstrip)"),
 	TYPE_KWMETHOD("recount", &string_recount,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?Dint\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?Dint\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
@@ -11679,14 +11669,14 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "Hint: This is the same as ${##this.refindall(pattern)} or ${##this.relocateall(pattern)}\n"
 	              "Instances where @pattern matches epsilon are not counted"),
 	TYPE_KWMETHOD("recontains", &string_recontains,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?Dbool\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?Dbool\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
 	              "#tValueError{The given @pattern is malformed}"
 	              "Check if @this contains a match for the given regular expression @pattern (s.a. ?#contains)\n"
 	              "Hint: This is the same as ${!!this.refindall(pattern)} or ${!!this.relocateall(pattern)}"),
 	TYPE_KWMETHOD("rescanf", &string_rescanf,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?X2?.?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?.?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11697,7 +11687,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 
 	/* Regex functions that return the start-/end-offsets of all groups (rather than only the whole match) */
 	TYPE_KWMETHOD("regmatch", &string_regmatch,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#rematch, but rather than only return the number of characters that were "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
@@ -11720,28 +11710,28 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "start of @this ?.. If you want to search for @pattern and get the offsets of "
 	              "all of the matched groups, you should use ?#regfind instead."),
 	TYPE_KWMETHOD("regfind", &string_regfind,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#refind, but rather than only return the character-range "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regrfind", &string_regrfind,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#rerfind, but rather than only return the character-range "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regfindall", &string_regfindall,
-	              "(pattern:?.,start=!0,end=!-1,rules=!P{})->?S?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,rules=!P{})->?S?S?X2?T2?Dint?Dint?N\n"
 	              "Similar to ?#refindall, but rather than only return the character-ranges "
 	              /**/ "matched by the regular expression as a whole, return a sequence of start-/end-"
 	              /**/ "offsets for both the whole match itself (in ${return[0]}), as well as the "
 	              /**/ "start-/end-offsets of each individual group referenced by @pattern.\n"
 	              "When nothing was matched, an empty sequence is returned (s.a. ?#regmatch)."),
 	TYPE_KWMETHOD("regindex", &string_regindex,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -11749,7 +11739,7 @@ INTERN_TPCONST struct type_method tpconst string_methods[] = {
 	              "#tIndexError{No substring matching the given @pattern could be found}"
 	              "Same as ?#regfind, but throw an :IndexError when no match can be found"),
 	TYPE_KWMETHOD("regrindex", &string_regrindex,
-	              "(pattern:?.,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
+	              "(pattern:?X2?.?DRegex,start=!0,end=!-1,range:?Dint=!A!Dint!PSIZE_MAX,rules=!P{})->?S?X2?T2?Dint?Dint?N\n"
 	              "#ppattern{The regular expression pattern (s.a. ?#rematch)}"
 	              "#prange{The max number of search attempts to perform}"
 	              "#prules{The regular expression rules (s.a. ?#rematch)}"
@@ -12056,25 +12046,207 @@ err:
 	return NULL;
 }
 
+/* Make sure that the heap block `*p_block' has space for at least `n_bytes' bytes.
+ * When the block needs to grow, it is over-allocated by 50%, such that appending
+ * to the same string over and over only has to re-allocate every once in a while
+ * (the block's capacity is whatever `Dee_MallocUsableSize()' says it is).
+ * @return: true:  Success.
+ * @return: false: Allocation failed (`*p_block' was left unchanged) */
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+string_inplace_reserve(void **__restrict p_block, size_t n_bytes) {
+	void *block = *p_block;
+#ifdef Dee_MallocUsableSize
+	size_t new_bytes;
+	if (Dee_MallocUsableSize(block) >= n_bytes)
+		return true;
+	if (OVERFLOW_UADD(n_bytes, n_bytes / 2, &new_bytes))
+		new_bytes = n_bytes;
+	block = Dee_TryRealloc(block, new_bytes);
+	if unlikely(!block)
+#endif /* Dee_MallocUsableSize */
+	{
+		block = Dee_TryRealloc(*p_block, n_bytes);
+		if unlikely(!block)
+			return false;
+	}
+	*p_block = block;
+	return true;
+}
+
+/* Free all lazily allocated representations of a string (except for its `s_str',
+ * and the representation of its own width), before the string is modified.
+ * @param: str: The string's `s_str' */
+PRIVATE NONNULL((1, 2)) void DCALL
+string_utf_dropcaches(struct string_utf *__restrict utf, char const *str) {
+	unsigned int i;
+	if (utf->u_utf8 && utf->u_utf8 != str &&
+	    utf->u_utf8 != (char *)utf->u_data[STRING_WIDTH_1BYTE])
+		Dee_Free((size_t *)utf->u_utf8 - 1);
+	utf->u_utf8 = NULL;
+	if (utf->u_utf16 && (uint16_t *)utf->u_utf16 != (uint16_t *)utf->u_data[STRING_WIDTH_2BYTE])
+		Dee_Free((size_t *)utf->u_utf16 - 1);
+	utf->u_utf16 = NULL;
+	for (i = 0; i < STRING_WIDTH_COUNT; ++i) {
+		if (i == utf->u_width)
+			continue;
+		if (utf->u_data[i] && (char *)utf->u_data[i] != str)
+			Dee_Free(utf->u_data[i] - 1);
+		utf->u_data[i] = NULL;
+	}
+	utf->u_flags &= ~(STRING_UTF_FASCII | STRING_UTF_FINVBYT);
+}
+
+/* Implementation of `s += other'.
+ * When `s' isn't shared (as is the case when a local variable is used to
+ * build a string within a loop), `other' is appended to `s' in-place, with
+ * the buffers of `s' being over-allocated geometrically. This way, `s += other'
+ * in a loop doesn't have to re-copy everything that was already appended every
+ * time around (which would be O(n^2)).
+ * When `other' is wider than `s', `s' is widened by creating a new string once,
+ * after which further appends (of strings that aren't wider) are in-place. */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+string_inplace_cat(DREF String **__restrict p_self, DeeObject *other) {
+	DREF String *result, *self = *p_self;
+	struct string_utf *utf;
+	unsigned int width, other_width;
+	size_t old_len, add_len;
+	char *old_str;
+	if (DeeObject_IsShared(self) || !DeeString_Check(other) ||
+	    other == (DeeObject *)self)
+		goto fallback;
+	utf         = self->s_data;
+	width       = utf ? utf->u_width : STRING_WIDTH_1BYTE;
+	other_width = DeeString_WIDTH(other);
+	if (other_width > width)
+		goto fallback;
+	if (utf && (utf->u_flags & STRING_UTF_FREGEX))
+		goto fallback; /* The regex cache references the string's text */
+	old_len = self->s_len;
+	old_str = self->s_str;
+	if (width == STRING_WIDTH_1BYTE) {
+		/* LATIN-1 + LATIN-1 */
+		add_len = DeeString_SIZE(other);
+		if (utf)
+			string_utf_dropcaches(utf, old_str);
+		result = self;
+		if unlikely(!string_inplace_reserve((void **)&result, offsetof(String, s_str) +
+		                                                      (old_len + add_len + 1) * sizeof(char)))
+			goto fallback;
+		memcpyc(result->s_str + old_len, DeeString_STR(other),
+		        add_len, sizeof(char));
+		if (utf)
+			utf->u_data[STRING_WIDTH_1BYTE] = (size_t *)result->s_str;
+	} else {
+		/* Multi-byte strings: append to both the UTF-8 (`s_str'),
+		 * and the wide representation (`u_data[width]') */
+		void *wblock;
+		size_t old_wlen, add_wlen;
+		ASSERT(utf);
+		add_wlen = DeeString_WLEN(other);
+		if (other_width == STRING_WIDTH_1BYTE) {
+			add_len = add_wlen + dee_countnonascii(DeeString_STR(other), add_wlen);
+		} else {
+			add_len = DeeString_SIZE(other);
+		}
+		string_utf_dropcaches(utf, old_str);
+		wblock   = utf->u_data[width] - 1;
+		old_wlen = WSTR_LENGTH(utf->u_data[width]);
+		if unlikely(!string_inplace_reserve(&wblock, sizeof(size_t) +
+		                                             STRING_MUL_SIZEOF_WIDTH(old_wlen + add_wlen + 1, width)))
+			goto fallback;
+		utf->u_data[width] = (size_t *)wblock + 1;
+		result = self;
+		if unlikely(!string_inplace_reserve((void **)&result, offsetof(String, s_str) +
+		                                                      (old_len + add_len + 1) * sizeof(char)))
+			goto fallback;
+
+		/* Append to the wide representation. */
+		if (width == STRING_WIDTH_2BYTE) {
+			uint16_t *dst = (uint16_t *)utf->u_data[width] + old_wlen;
+			if (other_width == STRING_WIDTH_1BYTE) {
+				uint8_t const *src = (uint8_t const *)DeeString_STR(other);
+				size_t i;
+				for (i = 0; i < add_wlen; ++i)
+					dst[i] = src[i];
+			} else {
+				memcpyw(dst, DeeString_Get2Byte(other), add_wlen);
+			}
+			dst[add_wlen] = 0;
+		} else {
+			uint32_t *dst = (uint32_t *)utf->u_data[width] + old_wlen;
+			size_t i;
+			if (other_width == STRING_WIDTH_1BYTE) {
+				uint8_t const *src = (uint8_t const *)DeeString_STR(other);
+				for (i = 0; i < add_wlen; ++i)
+					dst[i] = src[i];
+			} else if (other_width == STRING_WIDTH_2BYTE) {
+				uint16_t const *src = DeeString_Get2Byte(other);
+				for (i = 0; i < add_wlen; ++i)
+					dst[i] = src[i];
+			} else {
+				memcpyl(dst, DeeString_Get4Byte(other), add_wlen);
+			}
+			dst[add_wlen] = 0;
+		}
+		((size_t *)utf->u_data[width])[-1] = old_wlen + add_wlen;
+
+		/* Append to the UTF-8 representation. */
+		if (other_width == STRING_WIDTH_1BYTE) {
+			uint8_t const *src = (uint8_t const *)DeeString_STR(other);
+			uint8_t *dst = (uint8_t *)result->s_str + old_len;
+			size_t i;
+			for (i = 0; i < add_wlen; ++i) {
+				uint8_t ch = src[i];
+				if (ch <= 0x7f) {
+					*dst++ = ch;
+				} else {
+					*dst++ = 0xc0 | (ch >> 6);
+					*dst++ = 0x80 | (ch & 0x3f);
+				}
+			}
+		} else {
+			memcpyc(result->s_str + old_len, DeeString_STR(other),
+			        add_len, sizeof(char));
+		}
+	}
+	result->s_len                = old_len + add_len;
+	result->s_str[result->s_len] = '\0';
+	result->s_hash               = DEE_STRING_HASH_UNSET;
+	*p_self = result;
+	return 0;
+fallback:
+	result = string_cat(self, other);
+	if unlikely(!result)
+		goto err;
+	Dee_Decref(self);
+	*p_self = result;
+	return 0;
+err:
+	return -1;
+}
+
 INTERN struct type_math string_math = {
-	/* .tp_int32  = */ NULL,
-	/* .tp_int64  = */ NULL,
-	/* .tp_double = */ NULL,
-	/* .tp_int    = */ NULL,
-	/* .tp_inv    = */ NULL,
-	/* .tp_pos    = */ NULL,
-	/* .tp_neg    = */ NULL,
-	/* .tp_add    = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_cat,
-	/* .tp_sub    = */ NULL,
-	/* .tp_mul    = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_mul,
-	/* .tp_div    = */ NULL,
-	/* .tp_mod    = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_mod,
-	/* .tp_shl    = */ NULL,
-	/* .tp_shr    = */ NULL,
-	/* .tp_and    = */ NULL,
-	/* .tp_or     = */ NULL,
-	/* .tp_xor    = */ NULL,
-	/* .tp_pow    = */ NULL
+	/* .tp_int32       = */ NULL,
+	/* .tp_int64       = */ NULL,
+	/* .tp_double      = */ NULL,
+	/* .tp_int         = */ NULL,
+	/* .tp_inv         = */ NULL,
+	/* .tp_pos         = */ NULL,
+	/* .tp_neg         = */ NULL,
+	/* .tp_add         = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_cat,
+	/* .tp_sub         = */ NULL,
+	/* .tp_mul         = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_mul,
+	/* .tp_div         = */ NULL,
+	/* .tp_mod         = */ (DREF DeeObject *(DCALL *)(DeeObject *, DeeObject *))&string_mod,
+	/* .tp_shl         = */ NULL,
+	/* .tp_shr         = */ NULL,
+	/* .tp_and         = */ NULL,
+	/* .tp_or          = */ NULL,
+	/* .tp_xor         = */ NULL,
+	/* .tp_pow         = */ NULL,
+	/* .tp_inc         = */ NULL,
+	/* .tp_dec         = */ NULL,
+	/* .tp_inplace_add = */ (int (DCALL *)(DeeObject **__restrict, DeeObject *))&string_inplace_cat,
 };
 
 
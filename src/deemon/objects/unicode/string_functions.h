@@ -33,6 +33,7 @@
 
 #include "../../runtime/runtime_error.h"
 #include "../../runtime/strings.h"
+#include "simd.h"
 
 #undef SSIZE_MAX
 #include <hybrid/limitcore.h>
@@ -77,8 +78,12 @@ DeeSystem_DEFINE_memrchr(dee_memrchr)
 #ifndef CONFIG_HAVE_memmem
 #define CONFIG_HAVE_memmem
 #undef memmem
-#define memmem  dee_memmem
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define memmem dee_sse2_memmemb
+#else /* CONFIG_HAVE_STRING_SSE2 */
+#define memmem dee_memmem
 DeeSystem_DEFINE_memmem(dee_memmem)
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
 #endif /* !CONFIG_HAVE_memmem */
 
 #ifndef CONFIG_HAVE_memrmem
@@ -133,15 +138,23 @@ DeeSystem_DEFINE_memcmpl(dee_memcmpl)
 #ifndef CONFIG_HAVE_memchrw
 #define CONFIG_HAVE_memchrw
 #undef memchrw
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define memchrw dee_sse2_memchrw
+#else /* CONFIG_HAVE_STRING_SSE2 */
 #define memchrw dee_memchrw
 DeeSystem_DEFINE_memchrw(dee_memchrw)
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
 #endif /* !CONFIG_HAVE_memchrw */
 
 #ifndef CONFIG_HAVE_memchrl
 #define CONFIG_HAVE_memchrl
 #undef memchrl
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define memchrl dee_sse2_memchrl
+#else /* CONFIG_HAVE_STRING_SSE2 */
 #define memchrl dee_memchrl
 DeeSystem_DEFINE_memchrl(dee_memchrl)
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
 #endif /* !CONFIG_HAVE_memchrl */
 
 #ifndef CONFIG_HAVE_memrchrw
@@ -161,15 +174,23 @@ DeeSystem_DEFINE_memrchrl(dee_memrchrl)
 #ifndef CONFIG_HAVE_memmemw
 #define CONFIG_HAVE_memmemw
 #undef memmemw
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define memmemw dee_sse2_memmemw
+#else /* CONFIG_HAVE_STRING_SSE2 */
 #define memmemw dee_memmemw
 DeeSystem_DEFINE_memmemw(dee_memmemw, memchrw, MEMEQW)
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
 #endif /* !CONFIG_HAVE_memmemw */
 
 #ifndef CONFIG_HAVE_memmeml
 #define CONFIG_HAVE_memmeml
 #undef memmeml
+#ifdef CONFIG_HAVE_STRING_SSE2
+#define memmeml dee_sse2_memmeml
+#else /* CONFIG_HAVE_STRING_SSE2 */
 #define memmeml dee_memmeml
 DeeSystem_DEFINE_memmeml(dee_memmeml, memchrl, MEMEQL)
+#endif /* !CONFIG_HAVE_STRING_SSE2 */
 #endif /* !CONFIG_HAVE_memmeml */
 
 #ifndef CONFIG_HAVE_memrmemw
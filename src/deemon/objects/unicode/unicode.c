@@ -38,6 +38,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "simd.h"
+
 DECL_BEGIN
 
 #ifndef NDEBUG
@@ -550,7 +552,7 @@ again:
 		result = DeeString_New2ByteBuffer(length);
 		if unlikely(!result)
 			goto err;
-		for (i = 0; i < length; ++i)
+		for (i = dee_widen8to16(result, data, length); i < length; ++i)
 			result[i] = data[i];
 		result[length] = 0;
 		if likely(atomic_cmpxch(&utf->u_data[STRING_WIDTH_2BYTE], NULL, (size_t *)result)) {
@@ -596,7 +598,7 @@ again:
 			result = DeeString_New4ByteBuffer(length);
 			if unlikely(!result)
 				goto err;
-			for (i = 0; i < length; ++i)
+			for (i = dee_widen8to32(result, data, length); i < length; ++i)
 				result[i] = data[i];
 		} else {
 			uint16_t *data;
@@ -607,7 +609,7 @@ again:
 			result = DeeString_New4ByteBuffer(length);
 			if unlikely(!result)
 				goto err;
-			for (i = 0; i < length; ++i)
+			for (i = dee_widen16to32(result, data, length); i < length; ++i)
 				result[i] = data[i];
 		}
 		result[length] = 0;
@@ -658,19 +660,13 @@ set_utf8_and_return_1byte:
 	}
 	iter = (uint8_t *)DeeString_STR(self);
 	end  = iter + DeeString_SIZE(self);
-	for (; iter < end; ++iter) {
-		uint8_t ch = *iter;
+	iter += dee_asciilen(iter, (size_t)(end - iter));
+	if (iter < end) {
 		size_t result_length;
-		uint8_t *iter2, *result, *dst;
-		if (ch <= 0x7f)
-			continue; /* ASCII character. */
+		uint8_t *result, *dst;
 		/* Well... This string _does_ contain some latin1 characters. */
-		result_length = DeeString_SIZE(self) + 1;
-		iter2         = iter + 1;
-		for (; iter2 < end; ++iter2) {
-			if (*iter2 >= 0x80)
-				++result_length;
-		}
+		result_length = DeeString_SIZE(self) +
+		                dee_countnonascii(iter, (size_t)(end - iter));
 		result = (uint8_t *)Dee_Malloc(sizeof(size_t) +
 		                               (result_length + 1) *
 		                               sizeof(uint8_t));
@@ -682,15 +678,16 @@ set_utf8_and_return_1byte:
 		dst = (uint8_t *)mempcpyc(result, DeeString_STR(self),
 		                          (size_t)(iter - (uint8_t *)DeeString_STR(self)),
 		                          sizeof(uint8_t));
-		for (; iter < end; ++iter) {
-			ch = *iter;
-			if (ch <= 0x7f) {
-				*dst++ = ch;
-			} else {
-				/* Encode the LATIN-1 character in UTF-8 */
-				*dst++ = 0xc0 | ((ch & 0xc0) >> 6);
-				*dst++ = 0x80 | (ch & 0x3f);
-			}
+		while (iter < end) {
+			uint8_t ch = *iter++;
+			size_t ascii_length;
+			/* Encode the LATIN-1 character in UTF-8 */
+			*dst++ = 0xc0 | ((ch & 0xc0) >> 6);
+			*dst++ = 0x80 | (ch & 0x3f);
+			/* Copy the run of ASCII characters that follows. */
+			ascii_length = dee_asciilen(iter, (size_t)(end - iter));
+			dst          = (uint8_t *)mempcpyc(dst, iter, ascii_length, sizeof(uint8_t));
+			iter += ascii_length;
 		}
 		ASSERT(WSTR_LENGTH(result) == result_length);
 		ASSERT(dst == result + result_length);
@@ -745,19 +742,13 @@ set_utf8_and_return_1byte:
 	}
 	iter = (uint8_t *)DeeString_STR(self);
 	end  = iter + DeeString_SIZE(self);
-	for (; iter < end; ++iter) {
-		uint8_t ch = *iter;
+	iter += dee_asciilen(iter, (size_t)(end - iter));
+	if (iter < end) {
 		size_t result_length;
-		uint8_t *iter2, *result, *dst;
-		if (ch <= 0x7f)
-			continue; /* ASCII character. */
+		uint8_t *result, *dst;
 		/* Well... This string _does_ contain some latin1 characters. */
-		result_length = DeeString_SIZE(self) + 1;
-		iter2         = iter + 1;
-		for (; iter2 < end; ++iter2) {
-			if (*iter2 >= 0x80)
-				++result_length;
-		}
+		result_length = DeeString_SIZE(self) +
+		                dee_countnonascii(iter, (size_t)(end - iter));
 		result = (uint8_t *)Dee_TryMalloc(sizeof(size_t) +
 		                                  (result_length + 1) *
 		                                  sizeof(uint8_t));
@@ -769,15 +760,16 @@ set_utf8_and_return_1byte:
 		dst = (uint8_t *)mempcpyc(result, DeeString_STR(self),
 		                          (size_t)(iter - (uint8_t *)DeeString_STR(self)),
 		                          sizeof(uint8_t));
-		for (; iter < end; ++iter) {
-			ch = *iter;
-			if (ch <= 0x7f) {
-				*dst++ = ch;
-			} else {
-				/* Encode the LATIN-1 character in UTF-8 */
-				*dst++ = 0xc0 | ((ch & 0xc0) >> 6);
-				*dst++ = 0x80 | (ch & 0x3f);
-			}
+		while (iter < end) {
+			uint8_t ch = *iter++;
+			size_t ascii_length;
+			/* Encode the LATIN-1 character in UTF-8 */
+			*dst++ = 0xc0 | ((ch & 0xc0) >> 6);
+			*dst++ = 0x80 | (ch & 0x3f);
+			/* Copy the run of ASCII characters that follows. */
+			ascii_length = dee_asciilen(iter, (size_t)(end - iter));
+			dst          = (uint8_t *)mempcpyc(dst, iter, ascii_length, sizeof(uint8_t));
+			iter += ascii_length;
 		}
 		ASSERT(WSTR_LENGTH(result) == result_length);
 		ASSERT(dst == result + result_length);
@@ -859,28 +851,38 @@ DeeString_AsBytes(DeeObject *__restrict self, bool allow_invalid) {
 	switch (utf->u_width) {
 
 	case STRING_WIDTH_2BYTE:
-		for (i = 0; i < length; ++i) {
-			uint16_t ch = ((uint16_t *)str)[i];
+		i = 0;
+		for (;;) {
+			uint16_t ch;
+			i += dee_narrow16to8(result + i, (uint16_t *)str + i, length - i, 0xff00);
+			if (i >= length)
+				break;
+			ch = ((uint16_t *)str)[i];
 			if (ch > 0xff) {
 				if (!allow_invalid)
 					goto err_result;
 				contains_invalid = true;
 				ch               = '?';
 			}
-			result[i] = (uint8_t)ch;
+			result[i++] = (uint8_t)ch;
 		}
 		break;
 
 	case STRING_WIDTH_4BYTE:
-		for (i = 0; i < length; ++i) {
-			uint32_t ch = ((uint32_t *)str)[i];
+		i = 0;
+		for (;;) {
+			uint32_t ch;
+			i += dee_narrow32to8(result + i, (uint32_t *)str + i, length - i, 0xffffff00);
+			if (i >= length)
+				break;
+			ch = ((uint32_t *)str)[i];
 			if (ch > 0xff) {
 				if (!allow_invalid)
 					goto err_result;
 				contains_invalid = true;
 				ch               = '?';
 			}
-			result[i] = (uint8_t)ch;
+			result[i++] = (uint8_t)ch;
 		}
 		break;
 
@@ -950,11 +952,9 @@ load_2byte_width:
 		str    = (uint16_t *)utf->u_data[STRING_WIDTH_2BYTE];
 		length = WSTR_LENGTH(str);
 		/* Search if the string contains surrogate-characters. */
-		for (i = 0; i < length; ++i) {
+		i = dee_nosurrogatelen(str, length);
+		if (i < length) {
 			uint16_t ch = str[i];
-			if ((ch < UTF16_HIGH_SURROGATE_MIN || ch > UTF16_HIGH_SURROGATE_MAX) &&
-			    (ch < UTF16_LOW_SURROGATE_MIN || ch > UTF16_LOW_SURROGATE_MAX))
-				continue;
 			if (!(error_mode & (STRING_ERROR_FREPLAC | STRING_ERROR_FIGNORE))) {
 				DeeError_Throwf(&DeeError_UnicodeEncodeError,
 				                "Invalid UTF-16 character U+%.4I16X", ch);
@@ -965,7 +965,7 @@ load_2byte_width:
 			if unlikely(!result)
 				goto err;
 			memcpyw(result, str, i);
-			dst = result + 1;
+			dst = result + i;
 			if (!(error_mode & STRING_ERROR_FIGNORE))
 				*dst++ = '?';
 			while (++i < length) {
@@ -1047,6 +1047,7 @@ err_invalid_unicode:
 				*dst++ = '?';
 			} else {
 				/* Must encode as a high/low surrogate pair. */
+				ch -= UTF16_SURROGATE_SHIFT;
 				*dst++ = UTF16_HIGH_SURROGATE_MIN + (uint16_t)(ch >> 10);
 				*dst++ = UTF16_LOW_SURROGATE_MIN + (uint16_t)(ch & 0x3ff);
 			}
@@ -1249,7 +1250,9 @@ LOCAL NONNULL((1, 3)) void DCALL
 char16_to_utf8(uint16_t const *__restrict src, size_t src_len,
                uint8_t *__restrict dst_utf8) {
 	size_t i;
-	for (i = 0; i < src_len; ++i) {
+	i = dee_narrow16to8(dst_utf8, src, src_len, 0xff80);
+	dst_utf8 += i;
+	for (; i < src_len; ++i) {
 		uint16_t ch = src[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			*dst_utf8++ = (uint8_t)ch;
@@ -1268,10 +1271,10 @@ LOCAL NONNULL((1, 3)) void DCALL
 char16_to_utf8_fast(uint16_t const *__restrict src, size_t src_len,
                     uint8_t *__restrict dst_c8) {
 	size_t i;
-	for (i = 0; i < src_len; ++i) {
+	for (i = dee_narrow16to8(dst_c8, src, src_len, 0xff80); i < src_len; ++i) {
 		uint16_t ch = src[i];
 		ASSERT(ch <= UTF8_1BYTE_MAX);
-		*dst_c8++ = (uint8_t)ch;
+		dst_c8[i] = (uint8_t)ch;
 	}
 }
 
@@ -1383,7 +1386,9 @@ LOCAL NONNULL((1, 3)) void DCALL
 utf32_to_utf8(uint32_t const *__restrict src, size_t src_len,
               uint8_t *__restrict dst) {
 	size_t i;
-	for (i = 0; i < src_len; ++i) {
+	i = dee_narrow32to8(dst, src, src_len, 0xffffff80);
+	dst += i;
+	for (; i < src_len; ++i) {
 		uint32_t ch = src[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			*dst++ = (uint8_t)ch;
@@ -1436,8 +1441,8 @@ DeeString_Pack2ByteBuffer(/*inherit(always)*/ uint16_t *__restrict text) {
 		return_empty_string;
 	}
 	text[length] = 0;
-	utf8_length  = 0;
-	for (i = 0; i < length; ++i) {
+	utf8_length  = dee_asciilen16(text, length);
+	for (i = utf8_length; i < length; ++i) {
 		uint16_t ch = text[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			utf8_length += 1;
@@ -1460,10 +1465,11 @@ DeeString_Pack2ByteBuffer(/*inherit(always)*/ uint16_t *__restrict text) {
 	if (utf8_length == length) {
 		utf->u_width                    = STRING_WIDTH_1BYTE;
 		utf->u_data[STRING_WIDTH_1BYTE] = (size_t *)result->s_str;
+		char16_to_utf8_fast(text, length, (uint8_t *)result->s_str);
 	} else {
 		utf->u_width = STRING_WIDTH_2BYTE;
+		char16_to_utf8(text, length, (uint8_t *)result->s_str);
 	}
-	char16_to_utf8(text, length, (uint8_t *)result->s_str);
 	utf->u_data[STRING_WIDTH_2BYTE] = (size_t *)text; /* Inherit data */
 	result->s_hash                  = DEE_STRING_HASH_UNSET;
 	result->s_data                  = utf;
@@ -1490,8 +1496,8 @@ DeeString_TryPack2ByteBuffer(/*inherit(on_success)*/ uint16_t *__restrict text)
 		return_empty_string;
 	}
 	text[length] = 0;
-	utf8_length  = 0;
-	for (i = 0; i < length; ++i) {
+	utf8_length  = dee_asciilen16(text, length);
+	for (i = utf8_length; i < length; ++i) {
 		uint16_t ch = text[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			utf8_length += 1;
@@ -1550,9 +1556,9 @@ DeeString_PackUtf16Buffer(/*inherit(always)*/ uint16_t *__restrict text,
 		return_empty_string;
 	}
 	text[length]    = 0;
-	utf8_length     = 0;
-	i               = 0;
-	character_count = 0;
+	i               = dee_asciilen16(text, length);
+	utf8_length     = i;
+	character_count = i;
 continue_at_i:
 	for (; i < length; ++i) {
 		uint32_t ch;
@@ -1642,7 +1648,6 @@ read_text_i:
 	bzero(utf, sizeof(struct string_utf));
 	*(uint16_t **)&utf->u_utf16 = (uint16_t *)text; /* Inherit data */
 	if (utf8_length == length) {
-		size_t j;
 		/* Pure UTF-16 in ASCII range. */
 		utf->u_data[STRING_WIDTH_1BYTE] = (size_t *)result->s_str;
 		utf->u_data[STRING_WIDTH_2BYTE] = (size_t *)text;
@@ -1651,8 +1656,7 @@ read_text_i:
 		ASSERT(character_count == utf8_length);
 		ASSERT(character_count == length);
 		ASSERT(character_count == WSTR_LENGTH(text));
-		for (j = 0; j < length; ++j)
-			result->s_str[j] = (char)(uint8_t)text[j];
+		char16_to_utf8_fast(text, length, (uint8_t *)result->s_str);
 	} else {
 		switch (kind) {
 
@@ -1732,9 +1736,9 @@ DeeString_TryPackUtf16Buffer(/*inherit(on_success)*/ uint16_t *__restrict text)
 		return_empty_string;
 	}
 	text[length]    = 0;
-	utf8_length     = 0;
-	i               = 0;
-	character_count = 0;
+	i               = dee_asciilen16(text, length);
+	utf8_length     = i;
+	character_count = i;
 continue_at_i:
 	for (; i < length; ++i) {
 		uint32_t ch;
@@ -1798,7 +1802,6 @@ continue_at_i:
 	bzero(utf, sizeof(struct string_utf));
 	*(uint16_t **)&utf->u_utf16 = (uint16_t *)text; /* Inherit data */
 	if (utf8_length == length) {
-		size_t j;
 		/* Pure UTF-16 in ASCII range. */
 		utf->u_data[STRING_WIDTH_1BYTE] = (size_t *)result->s_str;
 		utf->u_data[STRING_WIDTH_2BYTE] = (size_t *)text;
@@ -1807,8 +1810,7 @@ continue_at_i:
 		ASSERT(character_count == utf8_length);
 		ASSERT(character_count == length);
 		ASSERT(character_count == WSTR_LENGTH(text));
-		for (j = 0; j < length; ++j)
-			result->s_str[j] = (char)(uint8_t)text[j];
+		char16_to_utf8_fast(text, length, (uint8_t *)result->s_str);
 	} else {
 		switch (kind) {
 
@@ -1884,8 +1886,8 @@ DeeString_PackUtf32Buffer(/*inherit(always)*/ uint32_t *__restrict text,
 		return_empty_string;
 	}
 	text[length] = 0;
-	utf8_length  = 0;
-	for (i = 0; i < length; ++i) {
+	utf8_length  = dee_asciilen32(text, length);
+	for (i = utf8_length; i < length; ++i) {
 		uint32_t ch = text[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			utf8_length += 1;
@@ -1962,8 +1964,8 @@ DeeString_TryPackUtf32Buffer(/*inherit(on_success)*/ uint32_t *__restrict text)
 		return_empty_string;
 	}
 	text[length] = 0;
-	utf8_length  = 0;
-	for (i = 0; i < length; ++i) {
+	utf8_length  = dee_asciilen32(text, length);
+	for (i = utf8_length; i < length; ++i) {
 		uint32_t ch = text[i];
 		if (ch <= UTF8_1BYTE_MAX) {
 			utf8_length += 1;
@@ -2117,6 +2119,26 @@ utf8_getchar16(uint8_t const *__restrict base, uint8_t seqlen) {
 	return result;
 }
 
+/* Widen the run of ASCII characters at the start of `src...+=src_len'
+ * into `dst', and return the length of that run. */
+LOCAL NONNULL((1, 2)) size_t DCALL
+ascii_widen16(uint16_t *__restrict dst,
+              uint8_t const *__restrict src, size_t src_len) {
+	size_t i, result = dee_asciilen(src, src_len);
+	for (i = dee_widen8to16(dst, src, result); i < result; ++i)
+		dst[i] = src[i];
+	return result;
+}
+
+LOCAL NONNULL((1, 2)) size_t DCALL
+ascii_widen32(uint32_t *__restrict dst,
+              uint8_t const *__restrict src, size_t src_len) {
+	size_t i, result = dee_asciilen(src, src_len);
+	for (i = dee_widen8to32(dst, src, result); i < result; ++i)
+		dst[i] = src[i];
+	return result;
+}
+
 /* Construct a string from a UTF-8 character sequence. */
 PUBLIC WUNUSED DREF DeeObject *DCALL
 DeeString_NewUtf8(char const *__restrict str, size_t length,
@@ -2137,7 +2159,7 @@ DeeString_NewUtf8(char const *__restrict str, size_t length,
 		uint8_t seqlen, ch = *iter;
 		uint32_t ch32;
 		if (ch <= 0x7f) {
-			++iter;
+			iter += dee_asciilen(iter, (size_t)(end - iter));
 			continue;
 		}
 		seqlen = unicode_utf8seqlen[ch];
@@ -2179,16 +2201,20 @@ DeeString_NewUtf8(char const *__restrict str, size_t length,
 				goto err_r;
 			dst32         = buffer32;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst32++ = (uint32_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to32(dst32, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst32[i] = (uint32_t)(uint8_t)result->s_str[i];
+			dst32 += simple_length;
 			*dst32++ = ch32;
 			iter += seqlen;
 use_buffer32:
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst32++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen32(dst32, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst32 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2242,15 +2268,19 @@ err_buffer32:
 				goto err_r;
 			dst16         = buffer16;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst16++ = (uint16_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to16(dst16, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst16[i] = (uint16_t)(uint8_t)result->s_str[i];
+			dst16 += simple_length;
 			*dst16++ = (uint16_t)ch32;
 			iter += seqlen;
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst16++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen16(dst16, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst16 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2284,7 +2314,8 @@ err_buffer16:
 					if unlikely(!buffer32)
 						goto err_buffer16;
 					simple_length = (size_t)(dst16 - buffer16);
-					for (i = 0; i < simple_length; ++i)
+					i = dee_widen16to32(buffer32, buffer16, simple_length);
+					for (; i < simple_length; ++i)
 						buffer32[i] = buffer16[i];
 					DeeString_Free2ByteBuffer(buffer16);
 					dst32    = buffer32 + simple_length;
@@ -2351,7 +2382,7 @@ DeeString_SetUtf8(/*inherit(always)*/ DREF DeeObject *__restrict self,
 		uint8_t seqlen, ch = *iter;
 		uint32_t ch32;
 		if (ch <= 0x7f) {
-			++iter;
+			iter += dee_asciilen(iter, (size_t)(end - iter));
 			continue;
 		}
 		seqlen = unicode_utf8seqlen[ch];
@@ -2392,16 +2423,20 @@ DeeString_SetUtf8(/*inherit(always)*/ DREF DeeObject *__restrict self,
 				goto err_r;
 			dst32         = buffer32;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst32++ = (uint32_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to32(dst32, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst32[i] = (uint32_t)(uint8_t)result->s_str[i];
+			dst32 += simple_length;
 			*dst32++ = ch32;
 			iter += seqlen;
 use_buffer32:
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst32++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen32(dst32, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst32 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2455,15 +2490,19 @@ err_buffer32:
 				goto err_r;
 			dst16         = buffer16;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst16++ = (uint16_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to16(dst16, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst16[i] = (uint16_t)(uint8_t)result->s_str[i];
+			dst16 += simple_length;
 			*dst16++ = (uint16_t)ch32;
 			iter += seqlen;
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst16++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen16(dst16, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst16 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2497,7 +2536,8 @@ err_buffer16:
 					if unlikely(!buffer32)
 						goto err_buffer16;
 					simple_length = (size_t)(dst16 - buffer16);
-					for (i = 0; i < simple_length; ++i)
+					i = dee_widen16to32(buffer32, buffer16, simple_length);
+					for (; i < simple_length; ++i)
 						buffer32[i] = buffer16[i];
 					DeeString_Free2ByteBuffer(buffer16);
 					dst32    = buffer32 + simple_length;
@@ -2556,7 +2596,7 @@ DeeString_TrySetUtf8(/*inherit(on_success)*/ DREF DeeObject *__restrict self) {
 		uint8_t seqlen, ch = *iter;
 		uint32_t ch32;
 		if (ch <= 0x7f) {
-			++iter;
+			iter += dee_asciilen(iter, (size_t)(end - iter));
 			continue;
 		}
 		seqlen = unicode_utf8seqlen[ch];
@@ -2586,16 +2626,20 @@ DeeString_TrySetUtf8(/*inherit(on_success)*/ DREF DeeObject *__restrict self) {
 				goto err_r;
 			dst32         = buffer32;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst32++ = (uint32_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to32(dst32, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst32[i] = (uint32_t)(uint8_t)result->s_str[i];
+			dst32 += simple_length;
 			*dst32++ = ch32;
 			iter += seqlen;
 use_buffer32:
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst32++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen32(dst32, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst32 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2638,15 +2682,19 @@ use_buffer32:
 				goto err_r;
 			dst16         = buffer16;
 			simple_length = iter - (uint8_t *)result->s_str;
-			for (i = 0; i < simple_length; ++i)
-				*dst16++ = (uint16_t)(uint8_t)result->s_str[i];
+			i = dee_widen8to16(dst16, (uint8_t *)result->s_str, simple_length);
+			for (; i < simple_length; ++i)
+				dst16[i] = (uint16_t)(uint8_t)result->s_str[i];
+			dst16 += simple_length;
 			*dst16++ = (uint16_t)ch32;
 			iter += seqlen;
 			while (iter < end) {
 				ch = *iter;
 				if (ch <= 0x7f) {
-					++iter;
-					*dst16++ = ch;
+					size_t ascii_length;
+					ascii_length = ascii_widen16(dst16, iter, (size_t)(end - iter));
+					iter += ascii_length;
+					dst16 += ascii_length;
 					continue;
 				}
 				seqlen = unicode_utf8seqlen[ch];
@@ -2670,7 +2718,8 @@ err_buffer16:
 						goto err_r;
 					}
 					simple_length = (size_t)(dst16 - buffer16);
-					for (i = 0; i < simple_length; ++i)
+					i = dee_widen16to32(buffer32, buffer16, simple_length);
+					for (; i < simple_length; ++i)
 						buffer32[i] = buffer16[i];
 					DeeString_Free2ByteBuffer(buffer16);
 					dst32    = buffer32 + simple_length;
@@ -2775,6 +2824,24 @@ DeeString_Convert(String *__restrict self,
 	SWITCH_SIZEOF_WIDTH(width) {
 
 	CASE_WIDTH_1BYTE:
+#ifdef CONFIG_HAVE_STRING_SSE2
+		if (kind == UNICODE_CONVERT_LOWER || kind == UNICODE_CONVERT_UPPER) {
+			uint8_t lo = kind == UNICODE_CONVERT_LOWER ? 'A' : 'a';
+			for (i = 0; i < end;) {
+				size_t block_end;
+				/* Convert blocks of ASCII characters using SSE2 */
+				i += dee_sse2_asciicase((uint8_t *)result + i, (uint8_t *)str + start + i,
+				                        end - i, lo, (uint8_t)(lo + 25));
+				/* Convert the next block using the unicode database. */
+				block_end = i + 16;
+				if (block_end > end)
+					block_end = end;
+				for (; i < block_end; ++i)
+					((uint8_t *)result)[i] = (uint8_t)DeeUni_Convert(((uint8_t *)str)[start + i], kind);
+			}
+			break;
+		}
+#endif /* CONFIG_HAVE_STRING_SSE2 */
 		for (i = 0; i < end; ++i)
 			((uint8_t *)result)[i] = (uint8_t)DeeUni_Convert(((uint8_t *)str)[start + i], kind);
 		break;
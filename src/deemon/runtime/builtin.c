@@ -144,10 +144,10 @@ print("#error \"Unsupported hash configuration\"");
 print("#endif /" "* !... *" "/");
 print("};");
 ]]]*/
-#define NUM_BUILTINS_SYM  53
-#define NUM_BUILTINS_SPC  70
+#define NUM_BUILTINS_SYM  54
+#define NUM_BUILTINS_SPC  72
 #define BUILTINS_HASHMASK 0x7f
-STATIC_ASSERT_MSG(_NUM_BUILTINS_SYM == 53, "You need to re-run `deemon -F src/deemon/runtime/builtin.c'");
+STATIC_ASSERT_MSG(_NUM_BUILTINS_SYM == 54, "You need to re-run `deemon -F src/deemon/runtime/builtin.c'");
 PRIVATE struct module_symbol deemon_symbols[128] = {
 #if _Dee_HashSelect(32, 64) == 32
 	{ DeeString_STR(&str_none), NULL, UINT32_C(0xde6dda00), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_none } },
@@ -227,7 +227,7 @@ PRIVATE struct module_symbol deemon_symbols[128] = {
 	{ DeeString_STR(&str_bool), NULL, UINT32_C(0x8fd0d24a), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_bool } },
 	{ NULL, NULL, 0, 0, { 0 } },
 	{ DeeString_STR(&str_gc), DOCOF_gc, UINT32_C(0x73e7fc4c), MODSYM_FREADONLY | MODSYM_FNAMEOBJ, { id_gc } },
-	{ NULL, NULL, 0, 0, { 0 } },
+	{ DeeString_STR(&str_Regex), NULL, UINT32_C(0x6a24a0cd), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_Regex } },
 	{ NULL, NULL, 0, 0, { 0 } },
 	{ NULL, NULL, 0, 0, { 0 } },
 	{ DeeString_STR(&str_Set), NULL, UINT32_C(0xf18ec750), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_Set } },
@@ -337,7 +337,7 @@ PRIVATE struct module_symbol deemon_symbols[128] = {
 	{ DeeString_STR(&str_enumattr), NULL, UINT64_C(0x6b627a9d4ba17e37), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_enumattr } },
 	{ NULL, NULL, 0, 0, { 0 } },
 	{ NULL, NULL, 0, 0, { 0 } },
-	{ NULL, NULL, 0, 0, { 0 } },
+	{ DeeString_STR(&str_Regex), NULL, UINT64_C(0xfcd04bdbf6a64fba), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_Regex } },
 	{ NULL, NULL, 0, 0, { 0 } },
 	{ DeeString_STR(&str_Set), NULL, UINT64_C(0xe64a97dec556c73c), MODSYM_FREADONLY | MODSYM_FCONSTEXPR | MODSYM_FNAMEOBJ, { id_Set } },
 	{ NULL, NULL, 0, 0, { 0 } },
@@ -1795,6 +1795,7 @@ INTDEF size_t DCALL Dee_tuplecache_clearall(size_t max_clear);
 INTDEF size_t DCALL Dee_latincache_clearall(size_t max_clear);
 #endif /* CONFIG_STRING_LATIN1_CACHED */
 INTDEF size_t DCALL Dee_membercache_clearall(size_t max_clear);
+INTDEF size_t DCALL Dee_regexcache_clearall(size_t max_clear);
 
 PRIVATE pcacheclr caches[] = {
 #define Cs(x) &x##_clear,
@@ -1809,6 +1810,7 @@ PRIVATE pcacheclr caches[] = {
 	&Dee_latincache_clearall,
 #endif /* CONFIG_STRING_LATIN1_CACHED */
 	&Dee_membercache_clearall,
+	&Dee_regexcache_clearall,
 #ifndef CONFIG_NO_DEC
 	&DecTime_ClearCache,
 #endif /* !CONFIG_NO_DEC */
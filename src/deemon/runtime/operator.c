@@ -3712,6 +3712,18 @@ again:
 #endif /* !DEFINE_TYPED_OPERATORS */
 
 #ifndef DEFINE_TYPED_OPERATORS
+/* Make `self' share the `tp_seq' of `base', alongside the `TF_SEQFOREACH'
+ * flag that describes the layout of that structure. */
+PRIVATE NONNULL((1, 2)) void DCALL
+type_share_seq(DeeTypeObject *self, DeeTypeObject *base) {
+	if (base->tp_features & TF_SEQFOREACH) {
+		self->tp_features |= TF_SEQFOREACH;
+	} else {
+		self->tp_features &= ~TF_SEQFOREACH;
+	}
+	self->tp_seq = base->tp_seq;
+}
+
 #define DEFINE_TYPE_INHERIT_FUNCTION(name, opname, field)                \
 	INTERN NONNULL((1)) bool DCALL                                       \
 	name(DeeTypeObject *__restrict self) {                               \
@@ -3729,7 +3741,7 @@ again:
 			if (self->tp_seq) {                                          \
 				self->tp_seq->field = base_seq->field;                   \
 			} else {                                                     \
-				self->tp_seq = base_seq;                                 \
+				type_share_seq(self, base);                              \
 			}                                                            \
 			return true;                                                 \
 		}                                                                \
@@ -3751,7 +3763,42 @@ type_inherit_iternext(DeeTypeObject *__restrict self) {
 	}
 	return false;
 }
-DEFINE_TYPE_INHERIT_FUNCTION(type_inherit_iterself, "operator iterself", tp_iter_self)
+
+/* Same as the other inherit functions, but also inherit `tp_foreach' and
+ * `tp_foreach_pair', since those are tied to `tp_iter_self'. Those fields
+ * are only accessed when both `self' and `base' have `TF_SEQFOREACH' set. */
+INTERN NONNULL((1)) bool DCALL
+type_inherit_iterself(DeeTypeObject *__restrict self) {
+	struct type_seq *base_seq;
+	DeeTypeMRO mro;
+	DeeTypeObject *base = DeeTypeMRO_Init(&mro, self);
+	while ((base = DeeTypeMRO_NextDirectBase(&mro, base)) != NULL) {
+		base_seq = base->tp_seq;
+		if (base_seq == NULL || !base_seq->tp_iter_self) {
+			if (!type_inherit_iterself(base))
+				continue;
+		}
+		base_seq = base->tp_seq;
+		LOG_INHERIT(base, self, "operator iterself");
+		if (self->tp_seq) {
+			self->tp_seq->tp_iter_self = base_seq->tp_iter_self;
+			if (self->tp_features & TF_SEQFOREACH) {
+				if (base->tp_features & TF_SEQFOREACH) {
+					self->tp_seq->tp_foreach      = base_seq->tp_foreach;
+					self->tp_seq->tp_foreach_pair = base_seq->tp_foreach_pair;
+				} else {
+					self->tp_seq->tp_foreach      = NULL;
+					self->tp_seq->tp_foreach_pair = NULL;
+				}
+			}
+		} else {
+			type_share_seq(self, base);
+		}
+		return true;
+	}
+	return false;
+}
+
 DEFINE_TYPE_INHERIT_FUNCTION(type_inherit_size, "operator size", tp_size)
 DEFINE_TYPE_INHERIT_FUNCTION(type_inherit_contains, "operator contains", tp_contains)
 DEFINE_TYPE_INHERIT_FUNCTION(type_inherit_getitem, "operator getitem", tp_get)
@@ -5085,11 +5132,47 @@ DEFINE_OPERATOR(void, PutBuf,
 
 
 #ifndef DEFINE_TYPED_OPERATORS
+/* Return the `struct type_seq' that implements `tp_iter_self' for `tp_self'
+ * (or `NULL' if the type isn't iterable, or if that structure doesn't include
+ * the `tp_foreach' / `tp_foreach_pair' fields, as indicated by `TF_SEQFOREACH').
+ * Its `tp_foreach' / `tp_foreach_pair' operators may be used in place of
+ * iterators when non-NULL. */
+PRIVATE WUNUSED NONNULL((1)) struct type_seq *DCALL
+type_get_iterself_seq(DeeTypeObject *__restrict tp_self) {
+	do {
+		struct type_seq *seq = tp_self->tp_seq;
+		if (seq && seq->tp_iter_self) {
+			if (!(tp_self->tp_features & TF_SEQFOREACH))
+				break;
+			return seq;
+		}
+	} while (type_inherit_iterself(tp_self));
+	return NULL;
+}
+
+struct unpack_data {
+	size_t           ud_objc;  /* # of expected objects. */
+	size_t           ud_count; /* # of objects already written. */
+	DREF DeeObject **ud_objv;  /* [1..1][0..ud_count] Output vector. */
+};
+
+#define UNPACK_FOREACH_TOOMANY (-2)
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+unpack_foreach_cb(void *arg, DeeObject *elem) {
+	struct unpack_data *data = (struct unpack_data *)arg;
+	if unlikely(data->ud_count >= data->ud_objc)
+		return UNPACK_FOREACH_TOOMANY;
+	Dee_Incref(elem);
+	data->ud_objv[data->ud_count++] = elem;
+	return 0;
+}
+
 PUBLIC WUNUSED NONNULL((1, 3)) int
 (DCALL DeeObject_Unpack)(DeeObject *__restrict self, size_t objc,
                          /*out*/ DREF DeeObject **__restrict objv) {
 	DREF DeeObject *iterator, *elem;
 	size_t fast_size, i;
+	struct type_seq *seq;
 
 	/* Try to make use of the fast-sequence API. */
 	fast_size = DeeFastSeq_GetSize(self);
@@ -5111,6 +5194,28 @@ PUBLIC WUNUSED NONNULL((1, 3)) int
 		return 0;
 	}
 
+	/* Try to make use of the internal iteration protocol. */
+	seq = type_get_iterself_seq(Dee_TYPE(self));
+	if (seq && seq->tp_foreach) {
+		dssize_t status;
+		struct unpack_data data;
+		data.ud_objc  = objc;
+		data.ud_count = 0;
+		data.ud_objv  = objv;
+		status = (*seq->tp_foreach)(self, &unpack_foreach_cb, &data);
+		i      = data.ud_count;
+		if unlikely(status < 0) {
+			if (status == UNPACK_FOREACH_TOOMANY)
+				err_invalid_unpack_iter_size(self, self, objc);
+			goto err_objv;
+		}
+		if unlikely(i != objc) {
+			err_invalid_unpack_size(self, objc, i);
+			goto err_objv;
+		}
+		return 0;
+	}
+
 	/* Fallback: Use an iterator. */
 	if ((iterator = DeeObject_IterSelf(self)) == NULL)
 		goto err;
@@ -5140,6 +5245,7 @@ err_objv:
 err:
 	return -1;
 }
+#undef UNPACK_FOREACH_TOOMANY
 
 
 PUBLIC WUNUSED NONNULL((1, 2)) dssize_t DCALL
@@ -5148,6 +5254,12 @@ DeeObject_Foreach(DeeObject *__restrict self,
 	dssize_t temp, result = 0;
 	DREF DeeObject *elem;
 	size_t fast_size;
+	struct type_seq *seq;
+
+	/* Use the type's native iteration protocol (if available) */
+	seq = type_get_iterself_seq(Dee_TYPE(self));
+	if (seq && seq->tp_foreach)
+		return (*seq->tp_foreach)(self, proc, arg);
 	fast_size = DeeFastSeq_GetSize(self);
 	if (fast_size != DEE_FASTSEQ_NOTFAST) {
 		size_t i;
@@ -5191,6 +5303,26 @@ err:
 	return -1;
 }
 
+struct foreach_pair_data {
+	Dee_foreach_pair_t fpd_proc; /* [1..1] Pair callback. */
+	void              *fpd_arg;  /* [?..?] Cookie for `fpd_proc' */
+};
+
+PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
+foreach_pair_unpack_cb(void *arg, DeeObject *elem) {
+	dssize_t result;
+	DREF DeeObject *key_and_value[2];
+	struct foreach_pair_data *data = (struct foreach_pair_data *)arg;
+	if unlikely(DeeObject_Unpack(elem, 2, key_and_value))
+		goto err;
+	result = (*data->fpd_proc)(data->fpd_arg, key_and_value[0], key_and_value[1]);
+	Dee_Decref(key_and_value[1]);
+	Dee_Decref(key_and_value[0]);
+	return result;
+err:
+	return -1;
+}
+
 PUBLIC WUNUSED NONNULL((1, 2)) dssize_t DCALL
 DeeObject_ForeachPair(DeeObject *__restrict self,
                       Dee_foreach_pair_t proc, void *arg) {
@@ -5198,73 +5330,19 @@ DeeObject_ForeachPair(DeeObject *__restrict self,
 	dssize_t temp, result = 0;
 	DREF DeeObject *elem;
 	size_t fast_size;
-	DeeTypeObject *self_type;
-
-	/* Special optimizations for some well-known mapping types */
-	self_type = Dee_TYPE(self);
-	if (self_type == &DeeDict_Type) {
-		DeeDictObject *me = (DeeDictObject *)self;
-		dhash_t i;
-		DeeDict_LockRead(me);
-		for (i = 0; i <= me->d_mask; ++i) {
-			DREF DeeObject *key, *value;
-			key = me->d_elem[i].di_key;
-			if (key == NULL || key == &DeeDict_Dummy)
-				continue;
-			value = me->d_elem[i].di_value;
-			Dee_Incref(key);
-			Dee_Incref(value);
-			DeeDict_LockEndRead(me);
-			temp = (*proc)(arg, key, value);
-			Dee_Decref_unlikely(value);
-			Dee_Decref_unlikely(key);
-			if unlikely(temp < 0)
-				return temp;
-			result += temp;
-			DeeDict_LockRead(me);
-		}
-		DeeDict_LockEndRead(me);
-		return result;
-	}
-	if (self_type == &DeeRoDict_Type) {
-		DeeRoDictObject *me = (DeeRoDictObject *)self;
-		dhash_t i;
-		for (i = 0; i <= me->rd_mask; ++i) {
-			if (me->rd_elem[i].rdi_key == NULL)
-				continue;
-			temp = (*proc)(arg,
-			               me->rd_elem[i].rdi_key,
-			               me->rd_elem[i].rdi_value);
-			if unlikely(temp < 0)
-				return temp;
-			result += temp;
+	struct type_seq *seq;
+
+	/* Use the type's native iteration protocol (if available) */
+	seq = type_get_iterself_seq(Dee_TYPE(self));
+	if (seq) {
+		if (seq->tp_foreach_pair)
+			return (*seq->tp_foreach_pair)(self, proc, arg);
+		if (seq->tp_foreach) {
+			struct foreach_pair_data data;
+			data.fpd_proc = proc;
+			data.fpd_arg  = arg;
+			return (*seq->tp_foreach)(self, &foreach_pair_unpack_cb, &data);
 		}
-		return result;
-	}
-	if (self_type == &DeeKwdsMapping_Type) {
-		DeeKwdsMappingObject *me = (DeeKwdsMappingObject *)self;
-		DeeKwdsObject *kwds      = me->kmo_kwds;
-		dhash_t i;
-		for (i = 0; i <= kwds->kw_mask; ++i) {
-			DREF DeeObject *value;
-			struct kwds_entry *kwd = &kwds->kw_map[i];
-			if (kwd->ke_name == NULL)
-				continue;
-			DeeKwdsMapping_LockRead(me);
-			if unlikely(!me->kmo_argv) {
-				DeeKwdsMapping_LockEndRead(me);
-				break;
-			}
-			value = me->kmo_argv[kwd->ke_index];
-			Dee_Incref(value);
-			DeeKwdsMapping_LockEndRead(me);
-			temp = (*proc)(arg, (DeeObject *)kwds->kw_map[i].ke_name, value);
-			Dee_Decref_unlikely(value);
-			if unlikely(temp < 0)
-				return temp;
-			result += temp;
-		}
-		return result;
 	}
 
 	/* TODO: BlackListVarkwds_Type */
@@ -5389,7 +5467,7 @@ type_inherit_nsi(DeeTypeObject *__restrict self) {
 		if (self->tp_seq != NULL) /* Some other sequence interface has already been implemented! */
 			return false;
 		LOG_INHERIT(base, self, "<NSI>");
-		self->tp_seq = base->tp_seq;
+		type_share_seq(self, base);
 		return true;
 	}
 	return false;
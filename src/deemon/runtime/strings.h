@@ -68,6 +68,7 @@ local STRINGS = {
 	"Numeric",
 	"Object",
 	"Property",
+	"Regex",
 	"Sequence",
 	"Set",
 	"Super",
@@ -288,6 +289,8 @@ DEF_STRING(str_Object, "Object", 0xfa8141c1, 0x6769a374488a3c81)
 #define STR_Object DeeString_STR(&str_Object)
 DEF_STRING(str_Property, "Property", 0xd4f3688b, 0x1cf12720947fcc55)
 #define STR_Property DeeString_STR(&str_Property)
+DEF_STRING(str_Regex, "Regex", 0x6a24a0cd, 0xfcd04bdbf6a64fba)
+#define STR_Regex DeeString_STR(&str_Regex)
 DEF_STRING(str_Sequence, "Sequence", 0xe5937b14, 0xd04bba0a4444f063)
 #define STR_Sequence DeeString_STR(&str_Sequence)
 DEF_STRING(str_Set, "Set", 0xf18ec750, 0xe64a97dec556c73c)
@@ -0,0 +1,412 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEEMON_RUNTIME_WORKERPOOL_C
+#define GUARD_DEEMON_RUNTIME_WORKERPOOL_C 1
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/error.h>
+#include <deemon/int.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/objmethod.h>
+#include <deemon/string.h>
+#include <deemon/system.h>
+#include <deemon/thread.h>
+#include <deemon/tuple.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/futex.h>
+#include <deemon/util/lock.h>
+#include <deemon/util/workerpool.h>
+
+DECL_BEGIN
+
+/************************************************************************/
+/* Generic worker pool                                                  */
+/************************************************************************/
+
+/* Finalize the worker pool fields of an object (drop references to worker threads) */
+PUBLIC NONNULL((1)) void DCALL
+Dee_workerpool_fini(DeeWorkerPoolObject *__restrict self) {
+	Dee_Decrefv(self->wp_workerv, self->wp_workerc);
+	Dee_Free(self->wp_workerv);
+}
+
+/* Wake up one, or all idle workers after new work was posted. */
+PUBLIC NONNULL((1)) void DCALL
+Dee_workerpool_notify(DeeWorkerPoolObject *__restrict self) {
+	atomic_inc(&self->wp_version);
+	DeeFutex_WakeOne(&self->wp_version);
+}
+
+PUBLIC NONNULL((1)) void DCALL
+Dee_workerpool_broadcast(DeeWorkerPoolObject *__restrict self) {
+	atomic_inc(&self->wp_version);
+	DeeFutex_WakeAll(&self->wp_version);
+}
+
+/* Return the index of the calling thread's worker, or `(size_t)-1' if
+ * the calling thread isn't one of the worker threads of `self' */
+PUBLIC WUNUSED NONNULL((1)) size_t DCALL
+Dee_workerpool_selfindex(DeeWorkerPoolObject *__restrict self) {
+	size_t i, count = atomic_read(&self->wp_workerc);
+	DeeThreadObject *caller = DeeThread_Self();
+	for (i = 0; i < count; ++i) {
+		if (self->wp_workerv[i] == caller)
+			return i;
+	}
+	return (size_t)-1;
+}
+
+#ifndef CONFIG_NO_THREADS
+PRIVATE WUNUSED DREF DeeObject *DCALL
+workerpool_main_f(size_t argc, DeeObject *const *argv) {
+	DeeWorkerPoolObject *self;
+	size_t index;
+	ASSERT(argc == 2);
+	(void)argc;
+	self = (DeeWorkerPoolObject *)argv[0];
+	if (DeeObject_AsSize(argv[1], &index))
+		goto done;
+	for (;;) {
+		uint32_t version = atomic_read(&self->wp_version);
+		if ((*self->wp_work)(self, index))
+			continue;
+		if (atomic_read(&self->wp_shutdown) &&
+		    atomic_read(&self->wp_pending) == 0)
+			break;
+		if (DeeFutex_Wait32(&self->wp_version, version))
+			goto done;
+	}
+done:
+	atomic_dec(&self->wp_running);
+	DeeFutex_WakeAll(&self->wp_running);
+	if (DeeError_Current() != NULL) {
+		/* The worker was interrupted (e.g. because deemon is shutting down) */
+		DeeError_Handled(ERROR_HANDLED_INTERRUPT);
+	}
+	return_none;
+}
+
+PRIVATE DEFINE_CMETHOD(workerpool_main, &workerpool_main_f);
+
+/* Start a new worker thread with the given `index'
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+workerpool_spawn(DeeWorkerPoolObject *__restrict self, size_t index) {
+	DREF DeeObject *thread, *args, *index_ob;
+	DeeObject *argv[3];
+	index_ob = DeeInt_NewSize(index);
+	if unlikely(!index_ob)
+		goto err;
+	args = DeeTuple_Pack(2, self, index_ob);
+	Dee_Decref(index_ob);
+	if unlikely(!args)
+		goto err;
+	argv[0] = self->wp_name;
+	argv[1] = (DeeObject *)&workerpool_main;
+	argv[2] = args;
+	thread = DeeObject_New(&DeeThread_Type, 3, argv);
+	Dee_Decref(args);
+	if unlikely(!thread)
+		goto err;
+	self->wp_workerv[index] = (DeeThreadObject *)thread; /* Inherit reference (once started) */
+	atomic_inc(&self->wp_running);
+	if unlikely(DeeThread_Start(thread) < 0) {
+		atomic_dec(&self->wp_running);
+		goto err_thread;
+	}
+	atomic_write(&self->wp_workerc, index + 1);
+
+	/* The worker is running at this point, so it must not be spawned again.
+	 * Failing to detach it only means that its OS resources stick around
+	 * until the thread object is destroyed. */
+	if unlikely(DeeThread_Detach(thread) < 0)
+		DeeError_Handled(ERROR_HANDLED_RESTORE);
+	return 0;
+err_thread:
+	Dee_Decref(thread);
+err:
+	return -1;
+}
+#endif /* !CONFIG_NO_THREADS */
+
+/* Make sure that worker threads have been spawned (no-op after the first call).
+ * If only some workers could be spawned, the pool makes do with those.
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown (no worker could be spawned; try again later). */
+PUBLIC WUNUSED NONNULL((1)) int DCALL
+Dee_workerpool_start(DeeWorkerPoolObject *__restrict self) {
+	size_t i;
+	if likely(atomic_read(&self->wp_started))
+		return 0;
+	if (!atomic_cmpxch(&self->wp_started, 0, 1))
+		return 0; /* Someone else is starting workers. */
+#ifndef CONFIG_NO_THREADS
+	if (self->wp_workermax != 0 && self->wp_workerv == NULL) {
+		self->wp_workerv = (DeeThreadObject **)Dee_Mallocc(self->wp_workermax,
+		                                                   sizeof(DeeThreadObject *));
+		if unlikely(!self->wp_workerv)
+			goto err_restart;
+	}
+	for (i = 0; i < self->wp_workermax; ++i) {
+		if unlikely(workerpool_spawn(self, i)) {
+			if (i == 0)
+				goto err_restart;
+
+			/* Make do with the workers we already have. */
+			DeeError_Handled(ERROR_HANDLED_RESTORE);
+			break;
+		}
+	}
+
+	/* In case work was posted while we were starting workers. */
+	Dee_workerpool_broadcast(self);
+	return 0;
+err_restart:
+	/* Try again the next time around. */
+	atomic_write(&self->wp_started, 0);
+	return -1;
+#else /* !CONFIG_NO_THREADS */
+	/* Without threads, the pool's owner has to do all of the work itself. */
+	(void)i;
+	return 0;
+#endif /* CONFIG_NO_THREADS */
+}
+
+/* Stop the pool, such that workers exit once all pending work has been taken.
+ * When `wait' is true, also wait for all workers to exit (unless the calling
+ * thread is one of the pool's workers)
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown. */
+PUBLIC WUNUSED NONNULL((1)) int DCALL
+Dee_workerpool_shutdown(DeeWorkerPoolObject *__restrict self, bool wait) {
+	atomic_write(&self->wp_shutdown, 1);
+	Dee_workerpool_broadcast(self);
+	if (!wait)
+		return 0;
+
+	/* Workers can't wait for themselves. */
+	if (Dee_workerpool_selfindex(self) != (size_t)-1)
+		return 0;
+	for (;;) {
+		uint32_t running = atomic_read(&self->wp_running);
+		if (running == 0)
+			break;
+		if (DeeFutex_Wait32(&self->wp_running, running))
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+
+
+
+/************************************************************************/
+/* Parallel jobs                                                        */
+/************************************************************************/
+
+/* Discard the currently thrown error, and remember it as the job's error. */
+PRIVATE NONNULL((1)) void DCALL
+parallel_job_seterror(struct Dee_parallel_job *__restrict self) {
+	DeeObject *error = DeeError_Current();
+	ASSERT(error != NULL);
+	Dee_Incref(error);
+	if (!atomic_cmpxch(&self->pj_error, NULL, error))
+		Dee_Decref(error);
+	/* Interrupts are re-scheduled, such that worker threads can still be
+	 * stopped while processing user-code (e.g. during shutdown). */
+	DeeError_Handled(ERROR_HANDLED_RESTORE);
+}
+
+/* Process chunk number `index' of `self' */
+PRIVATE NONNULL((1)) void DCALL
+parallel_job_run(struct Dee_parallel_job *__restrict self, size_t index) {
+	size_t start, end, chunks;
+	start = index * self->pj_chunk;
+	end   = start + self->pj_chunk;
+	if (end > self->pj_size)
+		end = self->pj_size;
+	/* Once a chunk fails, there's no point in processing the rest. */
+	if (atomic_read(&self->pj_error) == NULL) {
+		if unlikely((*self->pj_func)(self, index, start, end))
+			parallel_job_seterror(self);
+	}
+	/* NOTE: `self' may no longer be accessed once the last chunk is done! */
+	chunks = self->pj_chunks;
+	if (atomic_incfetch(&self->pj_done) >= chunks)
+		DeeFutex_WakeAll(&self->pj_done);
+}
+
+#ifndef CONFIG_NO_THREADS
+PRIVATE Dee_atomic_lock_t parallel_pool_lock = DEE_ATOMIC_LOCK_INIT;
+#define parallel_pool_lock_acquire() Dee_atomic_lock_acquire(&parallel_pool_lock)
+#define parallel_pool_lock_release() Dee_atomic_lock_release(&parallel_pool_lock)
+
+/* [0..n][lock(parallel_pool_lock)] Stack of jobs with chunks that haven't been claimed. */
+PRIVATE struct Dee_parallel_job *parallel_pool_jobs = NULL;
+
+/* Remove `job' from the stack of pending jobs. */
+PRIVATE NONNULL((1)) void DCALL
+parallel_pool_unlink(struct Dee_parallel_job *__restrict job) {
+	struct Dee_parallel_job **p_iter;
+	ASSERT(Dee_atomic_lock_acquired(&parallel_pool_lock));
+	for (p_iter = &parallel_pool_jobs; *p_iter; p_iter = &(*p_iter)->pj_link) {
+		if (*p_iter == job) {
+			*p_iter = job->pj_link;
+			break;
+		}
+	}
+}
+
+/* Claim the next chunk of `*p_job' (or of any pending job when `*p_job' is `NULL')
+ * @return: true:  Successfully claimed chunk `*p_index' of `*p_job'
+ * @return: false: No unclaimed chunks are left. */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+parallel_pool_claim(struct Dee_parallel_job **__restrict p_job,
+                    size_t *__restrict p_index) {
+	struct Dee_parallel_job *job;
+	parallel_pool_lock_acquire();
+	job = *p_job;
+	if (job == NULL)
+		job = parallel_pool_jobs;
+	if (job == NULL || job->pj_next >= job->pj_chunks) {
+		parallel_pool_lock_release();
+		return false;
+	}
+	*p_index = job->pj_next++;
+	if (job->pj_next >= job->pj_chunks)
+		parallel_pool_unlink(job);
+	parallel_pool_lock_release();
+	*p_job = job;
+	return true;
+}
+
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+parallel_pool_work(DeeWorkerPoolObject *__restrict UNUSED(self),
+                   size_t UNUSED(index)) {
+	struct Dee_parallel_job *job = NULL;
+	size_t chunk;
+	if (!parallel_pool_claim(&job, &chunk))
+		return false;
+	parallel_job_run(job, chunk);
+	return true;
+}
+
+PRIVATE DEFINE_STRING(parallel_pool_name, "Sequence.parallel");
+
+/* The process-wide pool used for parallel jobs (never shut down; its
+ * workers only exit once they get interrupted during deemon shutdown).
+ * `wp_workermax' is `(size_t)-1' until first used. */
+PRIVATE DeeWorkerPoolObject parallel_pool = {
+	OBJECT_HEAD_INIT(&DeeObject_Type),
+	/* .wp_work      = */ &parallel_pool_work,
+	/* .wp_name      = */ (DeeObject *)&parallel_pool_name,
+	/* .wp_workermax = */ (size_t)-1,
+	/* .wp_workerc   = */ 0,
+	/* .wp_workerv   = */ NULL,
+	/* .wp_pending   = */ 0,
+	/* .wp_version   = */ 0,
+	/* .wp_running   = */ 0,
+	/* .wp_started   = */ 0,
+	/* .wp_shutdown  = */ 0
+};
+
+/* Return the # of worker threads used for parallel jobs (not counting the calling thread) */
+INTERN WUNUSED size_t DCALL Dee_parallel_getworkers(void) {
+	size_t result = atomic_read(&parallel_pool.wp_workermax);
+	if (result == (size_t)-1) {
+		result = DeeSystem_GetCpuCount() - 1;
+		atomic_cmpxch(&parallel_pool.wp_workermax, (size_t)-1, result);
+		result = atomic_read(&parallel_pool.wp_workermax);
+	}
+	return result;
+}
+
+/* Make sure that worker threads are running.
+ * @return: true:  At least one worker thread is available.
+ * @return: false: No worker threads are available (process jobs in the calling thread) */
+PRIVATE WUNUSED bool DCALL parallel_pool_start(void) {
+	if (Dee_parallel_getworkers() == 0)
+		return false;
+	if unlikely(Dee_workerpool_start(&parallel_pool)) {
+		/* Failed to start threads -> just process jobs in the calling thread. */
+		DeeError_Handled(ERROR_HANDLED_RESTORE);
+		return false;
+	}
+	return atomic_read(&parallel_pool.wp_running) != 0;
+}
+#else /* !CONFIG_NO_THREADS */
+INTERN WUNUSED size_t DCALL Dee_parallel_getworkers(void) {
+	return 0;
+}
+#define parallel_pool_start() false
+#endif /* CONFIG_NO_THREADS */
+
+/* Process all chunks of `self' (using the worker pool if possible)
+ * Once a chunk fails, chunks that haven't been started yet are skipped.
+ * @return: 0:  Success.
+ * @return: -1: An error was thrown (the first error thrown by any chunk). */
+INTERN WUNUSED NONNULL((1)) int DCALL
+Dee_parallel_job_exec(struct Dee_parallel_job *__restrict self) {
+	size_t index;
+	if (self->pj_chunks <= 1 || !parallel_pool_start()) {
+		for (index = 0; index < self->pj_chunks; ++index)
+			parallel_job_run(self, index);
+	}
+#ifndef CONFIG_NO_THREADS
+	else {
+		struct Dee_parallel_job *job = self;
+
+		/* Post the job and wake up workers. */
+		parallel_pool_lock_acquire();
+		self->pj_link      = parallel_pool_jobs;
+		parallel_pool_jobs = self;
+		parallel_pool_lock_release();
+		Dee_workerpool_broadcast(&parallel_pool);
+
+		/* Help out with our own job. */
+		while (parallel_pool_claim(&job, &index))
+			parallel_job_run(self, index);
+
+		/* Wait for chunks still being processed by workers. (Not interruptible,
+		 * since those workers are accessing the job on our stack) */
+		for (;;) {
+			size_t done = atomic_read(&self->pj_done);
+			if (done >= self->pj_chunks)
+				break;
+			DeeFutex_WaitPtrNoInt(&self->pj_done, done);
+		}
+	}
+#endif /* !CONFIG_NO_THREADS */
+	if unlikely(self->pj_error) {
+		DeeError_Throw(self->pj_error);
+		Dee_Decref(self->pj_error);
+		return -1;
+	}
+	return 0;
+}
+
+DECL_END
+
+#endif /* !GUARD_DEEMON_RUNTIME_WORKERPOOL_C */
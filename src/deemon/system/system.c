@@ -22,6 +22,7 @@
 
 #include <deemon/alloc.h>
 #include <deemon/api.h>
+#include <deemon/bytes.h>
 #include <deemon/error.h>
 #include <deemon/file.h>
 #include <deemon/int.h>
@@ -1156,6 +1157,166 @@ PUBLIC WUNUSED uint64_t DCALL DeeSystem_GetWalltime(void) {
 
 
 
+/* Figure out how to implement `DeeSystem_GetCpuCount()' */
+#undef DeeSystem_GetCpuCount_USE_GetSystemInfo
+#undef DeeSystem_GetCpuCount_USE_sysconf__SC_NPROCESSORS_ONLN
+#undef DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU__HW_NCPU
+#undef DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU
+#undef DeeSystem_GetCpuCount_USE_sysctl__HW_NCPU
+#undef DeeSystem_GetCpuCount_USE_mpctl__MPC_GETNUMSPUS
+#undef DeeSystem_GetCpuCount_USE_sysconf__SC_NPROC_ONLN
+#undef DeeSystem_GetCpuCount_USE_open_AND_proc_cpuinfo
+#undef DeeSystem_GetCpuCount_USE_STUB
+#if defined(CONFIG_HOST_WINDOWS)
+#define DeeSystem_GetCpuCount_USE_GetSystemInfo
+#elif defined(CONFIG_HAVE_sysconf) && defined(CONFIG_HAVE__SC_NPROCESSORS_ONLN)
+#define DeeSystem_GetCpuCount_USE_sysconf__SC_NPROCESSORS_ONLN
+#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_AVAILCPU) && defined(CONFIG_HAVE_HW_NCPU)
+#define DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU__HW_NCPU
+#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_AVAILCPU)
+#define DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU
+#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_NCPU)
+#define DeeSystem_GetCpuCount_USE_sysctl__HW_NCPU
+#elif defined(CONFIG_HAVE_mpctl) && defined(CONFIG_HAVE_MPC_GETNUMSPUS)
+#define DeeSystem_GetCpuCount_USE_mpctl__MPC_GETNUMSPUS
+#elif defined(CONFIG_HAVE_sysconf) && defined(CONFIG_HAVE__SC_NPROC_ONLN)
+#define DeeSystem_GetCpuCount_USE_sysconf__SC_NPROC_ONLN
+#elif defined(CONFIG_HAVE_PROCFS)
+#define DeeSystem_GetCpuCount_USE_open_AND_proc_cpuinfo
+#else /* ... */
+#define DeeSystem_GetCpuCount_USE_STUB
+#endif /* !... */
+
+/* Return the # of CPUs available on the host system (always >= 1) */
+PUBLIC WUNUSED size_t DCALL DeeSystem_GetCpuCount(void) {
+	/* Implementation variants taken from here:
+	 * https://stackoverflow.com/questions/150355/programmatically-find-the-number-of-cores-on-a-machine */
+
+#ifdef DeeSystem_GetCpuCount_USE_GetSystemInfo
+	SYSTEM_INFO sysinfo;
+	DBG_ALIGNMENT_DISABLE();
+	GetSystemInfo(&sysinfo);
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(sysinfo.dwNumberOfProcessors == 0)
+		return 1; /* Shouldn't happen... */
+	return (size_t)sysinfo.dwNumberOfProcessors;
+#endif /* DeeSystem_GetCpuCount_USE_GetSystemInfo */
+
+#ifdef DeeSystem_GetCpuCount_USE_sysconf__SC_NPROCESSORS_ONLN
+	long result;
+	DBG_ALIGNMENT_DISABLE();
+	result = sysconf(_SC_NPROCESSORS_ONLN);
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(result <= 0)
+		result = 1; /* Shouldn't happen... */
+	return (size_t)result;
+#endif /* DeeSystem_GetCpuCount_USE_sysconf__SC_NPROCESSORS_ONLN */
+
+#ifdef DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU__HW_NCPU
+	int mib[4], result = 0;
+	size_t len = sizeof(result);
+	mib[0] = CTL_HW;
+	mib[1] = HW_AVAILCPU;
+	DBG_ALIGNMENT_DISABLE();
+	sysctl(mib, 2, &result, &len, NULL, 0);
+	if (result <= 0) {
+		mib[1] = HW_NCPU;
+		sysctl(mib, 2, &result, &len, NULL, 0);
+		if (result <= 0)
+			result = 1;
+	}
+	DBG_ALIGNMENT_ENABLE();
+	return (size_t)(unsigned int)result;
+#endif /* DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU__HW_NCPU */
+
+#ifdef DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU
+	int mib[4], result = 0;
+	size_t len = sizeof(result);
+	mib[0] = CTL_HW;
+	mib[1] = HW_AVAILCPU;
+	DBG_ALIGNMENT_DISABLE();
+	sysctl(mib, 2, &result, &len, NULL, 0);
+	DBG_ALIGNMENT_ENABLE();
+	if (result <= 0)
+		result = 1;
+	return (size_t)(unsigned int)result;
+#endif /* DeeSystem_GetCpuCount_USE_sysctl__HW_AVAILCPU */
+
+#ifdef DeeSystem_GetCpuCount_USE_sysctl__HW_NCPU
+	int mib[4], result = 0;
+	size_t len = sizeof(result);
+	mib[0] = CTL_HW;
+	mib[1] = HW_NCPU;
+	DBG_ALIGNMENT_DISABLE();
+	sysctl(mib, 2, &result, &len, NULL, 0);
+	DBG_ALIGNMENT_ENABLE();
+	if (result <= 0)
+		result = 1;
+	return (size_t)(unsigned int)result;
+#endif /* DeeSystem_GetCpuCount_USE_sysctl__HW_NCPU */
+
+#ifdef DeeSystem_GetCpuCount_USE_mpctl__MPC_GETNUMSPUS
+	int result;
+	DBG_ALIGNMENT_DISABLE();
+	result = mpctl(MPC_GETNUMSPUS, NULL, NULL);
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(result <= 0)
+		result = 1; /* Shouldn't happen... */
+	return (size_t)(unsigned int)result;
+#endif /* DeeSystem_GetCpuCount_USE_mpctl__MPC_GETNUMSPUS */
+
+#ifdef DeeSystem_GetCpuCount_USE_sysconf__SC_NPROC_ONLN
+	long result;
+	DBG_ALIGNMENT_DISABLE();
+	result = sysconf(_SC_NPROC_ONLN);
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(result <= 0)
+		result = 1; /* Shouldn't happen... */
+	return (size_t)result;
+#endif /* DeeSystem_GetCpuCount_USE_sysconf__SC_NPROC_ONLN */
+
+#ifdef DeeSystem_GetCpuCount_USE_open_AND_proc_cpuinfo
+	size_t result = 0;
+	DREF DeeObject *file;
+	file = DeeFile_OpenString("/proc/cpuinfo", OPEN_FRDONLY, 0);
+	if unlikely(!file)
+		goto fallback;
+	/* Count the # of lines that begin with `processor'
+	 * The cpuinfo file contains one such line for every configured processor on the system. */
+	for (;;) {
+		PRIVATE char const str_processor[] = "processor";
+		DREF DeeBytesObject *line;
+		line = (DREF DeeBytesObject *)DeeFile_ReadLine(file, (size_t)-1, false);
+		if (!ITER_ISOK(line)) {
+			if unlikely(!line)
+				goto fallback_fp;
+			break;
+		}
+		ASSERT(DeeBytes_Check(line));
+		if (DeeBytes_SIZE(line) >= COMPILER_STRLEN(str_processor) &&
+		    bcmpc(DeeBytes_DATA(line), str_processor,
+		          COMPILER_STRLEN(str_processor), sizeof(char)) == 0)
+			++result; /* Found one! */
+		Dee_Decref(line);
+	}
+	Dee_Decref_likely(file);
+	if unlikely(!result)
+		result = 1; /* Shouldn't happen... */
+	return result;
+fallback_fp:
+	Dee_Decref_likely(file);
+fallback:
+	DeeError_Handled(Dee_ERROR_HANDLED_RESTORE);
+	return 1;
+#endif /* DeeSystem_GetCpuCount_USE_open_AND_proc_cpuinfo */
+
+#ifdef DeeSystem_GetCpuCount_USE_STUB
+	return 1;
+#endif /* DeeSystem_GetCpuCount_USE_STUB */
+}
+
+
+
 
 /* Figure out how to implement `DeeSystem_Unlink()' */
 #undef DeeSystem_Unlink_USE_DeleteFileW
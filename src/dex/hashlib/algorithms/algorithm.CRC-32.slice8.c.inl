@@ -0,0 +1,240 @@
+{
+	{
+		UINT32_C(0x00000000), UINT32_C(0x191b3141), UINT32_C(0x32366282), UINT32_C(0x2b2d53c3), UINT32_C(0x646cc504), UINT32_C(0x7d77f445), UINT32_C(0x565aa786), UINT32_C(0x4f4196c7),
+		UINT32_C(0xc8d98a08), UINT32_C(0xd1c2bb49), UINT32_C(0xfaefe88a), UINT32_C(0xe3f4d9cb), UINT32_C(0xacb54f0c), UINT32_C(0xb5ae7e4d), UINT32_C(0x9e832d8e), UINT32_C(0x87981ccf),
+		UINT32_C(0x4ac21251), UINT32_C(0x53d92310), UINT32_C(0x78f470d3), UINT32_C(0x61ef4192), UINT32_C(0x2eaed755), UINT32_C(0x37b5e614), UINT32_C(0x1c98b5d7), UINT32_C(0x05838496),
+		UINT32_C(0x821b9859), UINT32_C(0x9b00a918), UINT32_C(0xb02dfadb), UINT32_C(0xa936cb9a), UINT32_C(0xe6775d5d), UINT32_C(0xff6c6c1c), UINT32_C(0xd4413fdf), UINT32_C(0xcd5a0e9e),
+		UINT32_C(0x958424a2), UINT32_C(0x8c9f15e3), UINT32_C(0xa7b24620), UINT32_C(0xbea97761), UINT32_C(0xf1e8e1a6), UINT32_C(0xe8f3d0e7), UINT32_C(0xc3de8324), UINT32_C(0xdac5b265),
+		UINT32_C(0x5d5daeaa), UINT32_C(0x44469feb), UINT32_C(0x6f6bcc28), UINT32_C(0x7670fd69), UINT32_C(0x39316bae), UINT32_C(0x202a5aef), UINT32_C(0x0b07092c), UINT32_C(0x121c386d),
+		UINT32_C(0xdf4636f3), UINT32_C(0xc65d07b2), UINT32_C(0xed705471), UINT32_C(0xf46b6530), UINT32_C(0xbb2af3f7), UINT32_C(0xa231c2b6), UINT32_C(0x891c9175), UINT32_C(0x9007a034),
+		UINT32_C(0x179fbcfb), UINT32_C(0x0e848dba), UINT32_C(0x25a9de79), UINT32_C(0x3cb2ef38), UINT32_C(0x73f379ff), UINT32_C(0x6ae848be), UINT32_C(0x41c51b7d), UINT32_C(0x58de2a3c),
+		UINT32_C(0xf0794f05), UINT32_C(0xe9627e44), UINT32_C(0xc24f2d87), UINT32_C(0xdb541cc6), UINT32_C(0x94158a01), UINT32_C(0x8d0ebb40), UINT32_C(0xa623e883), UINT32_C(0xbf38d9c2),
+		UINT32_C(0x38a0c50d), UINT32_C(0x21bbf44c), UINT32_C(0x0a96a78f), UINT32_C(0x138d96ce), UINT32_C(0x5ccc0009), UINT32_C(0x45d73148), UINT32_C(0x6efa628b), UINT32_C(0x77e153ca),
+		UINT32_C(0xbabb5d54), UINT32_C(0xa3a06c15), UINT32_C(0x888d3fd6), UINT32_C(0x91960e97), UINT32_C(0xded79850), UINT32_C(0xc7cca911), UINT32_C(0xece1fad2), UINT32_C(0xf5facb93),
+		UINT32_C(0x7262d75c), UINT32_C(0x6b79e61d), UINT32_C(0x4054b5de), UINT32_C(0x594f849f), UINT32_C(0x160e1258), UINT32_C(0x0f152319), UINT32_C(0x243870da), UINT32_C(0x3d23419b),
+		UINT32_C(0x65fd6ba7), UINT32_C(0x7ce65ae6), UINT32_C(0x57cb0925), UINT32_C(0x4ed03864), UINT32_C(0x0191aea3), UINT32_C(0x188a9fe2), UINT32_C(0x33a7cc21), UINT32_C(0x2abcfd60),
+		UINT32_C(0xad24e1af), UINT32_C(0xb43fd0ee), UINT32_C(0x9f12832d), UINT32_C(0x8609b26c), UINT32_C(0xc94824ab), UINT32_C(0xd05315ea), UINT32_C(0xfb7e4629), UINT32_C(0xe2657768),
+		UINT32_C(0x2f3f79f6), UINT32_C(0x362448b7), UINT32_C(0x1d091b74), UINT32_C(0x04122a35), UINT32_C(0x4b53bcf2), UINT32_C(0x52488db3), UINT32_C(0x7965de70), UINT32_C(0x607eef31),
+		UINT32_C(0xe7e6f3fe), UINT32_C(0xfefdc2bf), UINT32_C(0xd5d0917c), UINT32_C(0xcccba03d), UINT32_C(0x838a36fa), UINT32_C(0x9a9107bb), UINT32_C(0xb1bc5478), UINT32_C(0xa8a76539),
+		UINT32_C(0x3b83984b), UINT32_C(0x2298a90a), UINT32_C(0x09b5fac9), UINT32_C(0x10aecb88), UINT32_C(0x5fef5d4f), UINT32_C(0x46f46c0e), UINT32_C(0x6dd93fcd), UINT32_C(0x74c20e8c),
+		UINT32_C(0xf35a1243), UINT32_C(0xea412302), UINT32_C(0xc16c70c1), UINT32_C(0xd8774180), UINT32_C(0x9736d747), UINT32_C(0x8e2de606), UINT32_C(0xa500b5c5), UINT32_C(0xbc1b8484),
+		UINT32_C(0x71418a1a), UINT32_C(0x685abb5b), UINT32_C(0x4377e898), UINT32_C(0x5a6cd9d9), UINT32_C(0x152d4f1e), UINT32_C(0x0c367e5f), UINT32_C(0x271b2d9c), UINT32_C(0x3e001cdd),
+		UINT32_C(0xb9980012), UINT32_C(0xa0833153), UINT32_C(0x8bae6290), UINT32_C(0x92b553d1), UINT32_C(0xddf4c516), UINT32_C(0xc4eff457), UINT32_C(0xefc2a794), UINT32_C(0xf6d996d5),
+		UINT32_C(0xae07bce9), UINT32_C(0xb71c8da8), UINT32_C(0x9c31de6b), UINT32_C(0x852aef2a), UINT32_C(0xca6b79ed), UINT32_C(0xd37048ac), UINT32_C(0xf85d1b6f), UINT32_C(0xe1462a2e),
+		UINT32_C(0x66de36e1), UINT32_C(0x7fc507a0), UINT32_C(0x54e85463), UINT32_C(0x4df36522), UINT32_C(0x02b2f3e5), UINT32_C(0x1ba9c2a4), UINT32_C(0x30849167), UINT32_C(0x299fa026),
+		UINT32_C(0xe4c5aeb8), UINT32_C(0xfdde9ff9), UINT32_C(0xd6f3cc3a), UINT32_C(0xcfe8fd7b), UINT32_C(0x80a96bbc), UINT32_C(0x99b25afd), UINT32_C(0xb29f093e), UINT32_C(0xab84387f),
+		UINT32_C(0x2c1c24b0), UINT32_C(0x350715f1), UINT32_C(0x1e2a4632), UINT32_C(0x07317773), UINT32_C(0x4870e1b4), UINT32_C(0x516bd0f5), UINT32_C(0x7a468336), UINT32_C(0x635db277),
+		UINT32_C(0xcbfad74e), UINT32_C(0xd2e1e60f), UINT32_C(0xf9ccb5cc), UINT32_C(0xe0d7848d), UINT32_C(0xaf96124a), UINT32_C(0xb68d230b), UINT32_C(0x9da070c8), UINT32_C(0x84bb4189),
+		UINT32_C(0x03235d46), UINT32_C(0x1a386c07), UINT32_C(0x31153fc4), UINT32_C(0x280e0e85), UINT32_C(0x674f9842), UINT32_C(0x7e54a903), UINT32_C(0x5579fac0), UINT32_C(0x4c62cb81),
+		UINT32_C(0x8138c51f), UINT32_C(0x9823f45e), UINT32_C(0xb30ea79d), UINT32_C(0xaa1596dc), UINT32_C(0xe554001b), UINT32_C(0xfc4f315a), UINT32_C(0xd7626299), UINT32_C(0xce7953d8),
+		UINT32_C(0x49e14f17), UINT32_C(0x50fa7e56), UINT32_C(0x7bd72d95), UINT32_C(0x62cc1cd4), UINT32_C(0x2d8d8a13), UINT32_C(0x3496bb52), UINT32_C(0x1fbbe891), UINT32_C(0x06a0d9d0),
+		UINT32_C(0x5e7ef3ec), UINT32_C(0x4765c2ad), UINT32_C(0x6c48916e), UINT32_C(0x7553a02f), UINT32_C(0x3a1236e8), UINT32_C(0x230907a9), UINT32_C(0x0824546a), UINT32_C(0x113f652b),
+		UINT32_C(0x96a779e4), UINT32_C(0x8fbc48a5), UINT32_C(0xa4911b66), UINT32_C(0xbd8a2a27), UINT32_C(0xf2cbbce0), UINT32_C(0xebd08da1), UINT32_C(0xc0fdde62), UINT32_C(0xd9e6ef23),
+		UINT32_C(0x14bce1bd), UINT32_C(0x0da7d0fc), UINT32_C(0x268a833f), UINT32_C(0x3f91b27e), UINT32_C(0x70d024b9), UINT32_C(0x69cb15f8), UINT32_C(0x42e6463b), UINT32_C(0x5bfd777a),
+		UINT32_C(0xdc656bb5), UINT32_C(0xc57e5af4), UINT32_C(0xee530937), UINT32_C(0xf7483876), UINT32_C(0xb809aeb1), UINT32_C(0xa1129ff0), UINT32_C(0x8a3fcc33), UINT32_C(0x9324fd72),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0x01c26a37), UINT32_C(0x0384d46e), UINT32_C(0x0246be59), UINT32_C(0x0709a8dc), UINT32_C(0x06cbc2eb), UINT32_C(0x048d7cb2), UINT32_C(0x054f1685),
+		UINT32_C(0x0e1351b8), UINT32_C(0x0fd13b8f), UINT32_C(0x0d9785d6), UINT32_C(0x0c55efe1), UINT32_C(0x091af964), UINT32_C(0x08d89353), UINT32_C(0x0a9e2d0a), UINT32_C(0x0b5c473d),
+		UINT32_C(0x1c26a370), UINT32_C(0x1de4c947), UINT32_C(0x1fa2771e), UINT32_C(0x1e601d29), UINT32_C(0x1b2f0bac), UINT32_C(0x1aed619b), UINT32_C(0x18abdfc2), UINT32_C(0x1969b5f5),
+		UINT32_C(0x1235f2c8), UINT32_C(0x13f798ff), UINT32_C(0x11b126a6), UINT32_C(0x10734c91), UINT32_C(0x153c5a14), UINT32_C(0x14fe3023), UINT32_C(0x16b88e7a), UINT32_C(0x177ae44d),
+		UINT32_C(0x384d46e0), UINT32_C(0x398f2cd7), UINT32_C(0x3bc9928e), UINT32_C(0x3a0bf8b9), UINT32_C(0x3f44ee3c), UINT32_C(0x3e86840b), UINT32_C(0x3cc03a52), UINT32_C(0x3d025065),
+		UINT32_C(0x365e1758), UINT32_C(0x379c7d6f), UINT32_C(0x35dac336), UINT32_C(0x3418a901), UINT32_C(0x3157bf84), UINT32_C(0x3095d5b3), UINT32_C(0x32d36bea), UINT32_C(0x331101dd),
+		UINT32_C(0x246be590), UINT32_C(0x25a98fa7), UINT32_C(0x27ef31fe), UINT32_C(0x262d5bc9), UINT32_C(0x23624d4c), UINT32_C(0x22a0277b), UINT32_C(0x20e69922), UINT32_C(0x2124f315),
+		UINT32_C(0x2a78b428), UINT32_C(0x2bbade1f), UINT32_C(0x29fc6046), UINT32_C(0x283e0a71), UINT32_C(0x2d711cf4), UINT32_C(0x2cb376c3), UINT32_C(0x2ef5c89a), UINT32_C(0x2f37a2ad),
+		UINT32_C(0x709a8dc0), UINT32_C(0x7158e7f7), UINT32_C(0x731e59ae), UINT32_C(0x72dc3399), UINT32_C(0x7793251c), UINT32_C(0x76514f2b), UINT32_C(0x7417f172), UINT32_C(0x75d59b45),
+		UINT32_C(0x7e89dc78), UINT32_C(0x7f4bb64f), UINT32_C(0x7d0d0816), UINT32_C(0x7ccf6221), UINT32_C(0x798074a4), UINT32_C(0x78421e93), UINT32_C(0x7a04a0ca), UINT32_C(0x7bc6cafd),
+		UINT32_C(0x6cbc2eb0), UINT32_C(0x6d7e4487), UINT32_C(0x6f38fade), UINT32_C(0x6efa90e9), UINT32_C(0x6bb5866c), UINT32_C(0x6a77ec5b), UINT32_C(0x68315202), UINT32_C(0x69f33835),
+		UINT32_C(0x62af7f08), UINT32_C(0x636d153f), UINT32_C(0x612bab66), UINT32_C(0x60e9c151), UINT32_C(0x65a6d7d4), UINT32_C(0x6464bde3), UINT32_C(0x662203ba), UINT32_C(0x67e0698d),
+		UINT32_C(0x48d7cb20), UINT32_C(0x4915a117), UINT32_C(0x4b531f4e), UINT32_C(0x4a917579), UINT32_C(0x4fde63fc), UINT32_C(0x4e1c09cb), UINT32_C(0x4c5ab792), UINT32_C(0x4d98dda5),
+		UINT32_C(0x46c49a98), UINT32_C(0x4706f0af), UINT32_C(0x45404ef6), UINT32_C(0x448224c1), UINT32_C(0x41cd3244), UINT32_C(0x400f5873), UINT32_C(0x4249e62a), UINT32_C(0x438b8c1d),
+		UINT32_C(0x54f16850), UINT32_C(0x55330267), UINT32_C(0x5775bc3e), UINT32_C(0x56b7d609), UINT32_C(0x53f8c08c), UINT32_C(0x523aaabb), UINT32_C(0x507c14e2), UINT32_C(0x51be7ed5),
+		UINT32_C(0x5ae239e8), UINT32_C(0x5b2053df), UINT32_C(0x5966ed86), UINT32_C(0x58a487b1), UINT32_C(0x5deb9134), UINT32_C(0x5c29fb03), UINT32_C(0x5e6f455a), UINT32_C(0x5fad2f6d),
+		UINT32_C(0xe1351b80), UINT32_C(0xe0f771b7), UINT32_C(0xe2b1cfee), UINT32_C(0xe373a5d9), UINT32_C(0xe63cb35c), UINT32_C(0xe7fed96b), UINT32_C(0xe5b86732), UINT32_C(0xe47a0d05),
+		UINT32_C(0xef264a38), UINT32_C(0xeee4200f), UINT32_C(0xeca29e56), UINT32_C(0xed60f461), UINT32_C(0xe82fe2e4), UINT32_C(0xe9ed88d3), UINT32_C(0xebab368a), UINT32_C(0xea695cbd),
+		UINT32_C(0xfd13b8f0), UINT32_C(0xfcd1d2c7), UINT32_C(0xfe976c9e), UINT32_C(0xff5506a9), UINT32_C(0xfa1a102c), UINT32_C(0xfbd87a1b), UINT32_C(0xf99ec442), UINT32_C(0xf85cae75),
+		UINT32_C(0xf300e948), UINT32_C(0xf2c2837f), UINT32_C(0xf0843d26), UINT32_C(0xf1465711), UINT32_C(0xf4094194), UINT32_C(0xf5cb2ba3), UINT32_C(0xf78d95fa), UINT32_C(0xf64fffcd),
+		UINT32_C(0xd9785d60), UINT32_C(0xd8ba3757), UINT32_C(0xdafc890e), UINT32_C(0xdb3ee339), UINT32_C(0xde71f5bc), UINT32_C(0xdfb39f8b), UINT32_C(0xddf521d2), UINT32_C(0xdc374be5),
+		UINT32_C(0xd76b0cd8), UINT32_C(0xd6a966ef), UINT32_C(0xd4efd8b6), UINT32_C(0xd52db281), UINT32_C(0xd062a404), UINT32_C(0xd1a0ce33), UINT32_C(0xd3e6706a), UINT32_C(0xd2241a5d),
+		UINT32_C(0xc55efe10), UINT32_C(0xc49c9427), UINT32_C(0xc6da2a7e), UINT32_C(0xc7184049), UINT32_C(0xc25756cc), UINT32_C(0xc3953cfb), UINT32_C(0xc1d382a2), UINT32_C(0xc011e895),
+		UINT32_C(0xcb4dafa8), UINT32_C(0xca8fc59f), UINT32_C(0xc8c97bc6), UINT32_C(0xc90b11f1), UINT32_C(0xcc440774), UINT32_C(0xcd866d43), UINT32_C(0xcfc0d31a), UINT32_C(0xce02b92d),
+		UINT32_C(0x91af9640), UINT32_C(0x906dfc77), UINT32_C(0x922b422e), UINT32_C(0x93e92819), UINT32_C(0x96a63e9c), UINT32_C(0x976454ab), UINT32_C(0x9522eaf2), UINT32_C(0x94e080c5),
+		UINT32_C(0x9fbcc7f8), UINT32_C(0x9e7eadcf), UINT32_C(0x9c381396), UINT32_C(0x9dfa79a1), UINT32_C(0x98b56f24), UINT32_C(0x99770513), UINT32_C(0x9b31bb4a), UINT32_C(0x9af3d17d),
+		UINT32_C(0x8d893530), UINT32_C(0x8c4b5f07), UINT32_C(0x8e0de15e), UINT32_C(0x8fcf8b69), UINT32_C(0x8a809dec), UINT32_C(0x8b42f7db), UINT32_C(0x89044982), UINT32_C(0x88c623b5),
+		UINT32_C(0x839a6488), UINT32_C(0x82580ebf), UINT32_C(0x801eb0e6), UINT32_C(0x81dcdad1), UINT32_C(0x8493cc54), UINT32_C(0x8551a663), UINT32_C(0x8717183a), UINT32_C(0x86d5720d),
+		UINT32_C(0xa9e2d0a0), UINT32_C(0xa820ba97), UINT32_C(0xaa6604ce), UINT32_C(0xaba46ef9), UINT32_C(0xaeeb787c), UINT32_C(0xaf29124b), UINT32_C(0xad6fac12), UINT32_C(0xacadc625),
+		UINT32_C(0xa7f18118), UINT32_C(0xa633eb2f), UINT32_C(0xa4755576), UINT32_C(0xa5b73f41), UINT32_C(0xa0f829c4), UINT32_C(0xa13a43f3), UINT32_C(0xa37cfdaa), UINT32_C(0xa2be979d),
+		UINT32_C(0xb5c473d0), UINT32_C(0xb40619e7), UINT32_C(0xb640a7be), UINT32_C(0xb782cd89), UINT32_C(0xb2cddb0c), UINT32_C(0xb30fb13b), UINT32_C(0xb1490f62), UINT32_C(0xb08b6555),
+		UINT32_C(0xbbd72268), UINT32_C(0xba15485f), UINT32_C(0xb853f606), UINT32_C(0xb9919c31), UINT32_C(0xbcde8ab4), UINT32_C(0xbd1ce083), UINT32_C(0xbf5a5eda), UINT32_C(0xbe9834ed),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xb8bc6765), UINT32_C(0xaa09c88b), UINT32_C(0x12b5afee), UINT32_C(0x8f629757), UINT32_C(0x37def032), UINT32_C(0x256b5fdc), UINT32_C(0x9dd738b9),
+		UINT32_C(0xc5b428ef), UINT32_C(0x7d084f8a), UINT32_C(0x6fbde064), UINT32_C(0xd7018701), UINT32_C(0x4ad6bfb8), UINT32_C(0xf26ad8dd), UINT32_C(0xe0df7733), UINT32_C(0x58631056),
+		UINT32_C(0x5019579f), UINT32_C(0xe8a530fa), UINT32_C(0xfa109f14), UINT32_C(0x42acf871), UINT32_C(0xdf7bc0c8), UINT32_C(0x67c7a7ad), UINT32_C(0x75720843), UINT32_C(0xcdce6f26),
+		UINT32_C(0x95ad7f70), UINT32_C(0x2d111815), UINT32_C(0x3fa4b7fb), UINT32_C(0x8718d09e), UINT32_C(0x1acfe827), UINT32_C(0xa2738f42), UINT32_C(0xb0c620ac), UINT32_C(0x087a47c9),
+		UINT32_C(0xa032af3e), UINT32_C(0x188ec85b), UINT32_C(0x0a3b67b5), UINT32_C(0xb28700d0), UINT32_C(0x2f503869), UINT32_C(0x97ec5f0c), UINT32_C(0x8559f0e2), UINT32_C(0x3de59787),
+		UINT32_C(0x658687d1), UINT32_C(0xdd3ae0b4), UINT32_C(0xcf8f4f5a), UINT32_C(0x7733283f), UINT32_C(0xeae41086), UINT32_C(0x525877e3), UINT32_C(0x40edd80d), UINT32_C(0xf851bf68),
+		UINT32_C(0xf02bf8a1), UINT32_C(0x48979fc4), UINT32_C(0x5a22302a), UINT32_C(0xe29e574f), UINT32_C(0x7f496ff6), UINT32_C(0xc7f50893), UINT32_C(0xd540a77d), UINT32_C(0x6dfcc018),
+		UINT32_C(0x359fd04e), UINT32_C(0x8d23b72b), UINT32_C(0x9f9618c5), UINT32_C(0x272a7fa0), UINT32_C(0xbafd4719), UINT32_C(0x0241207c), UINT32_C(0x10f48f92), UINT32_C(0xa848e8f7),
+		UINT32_C(0x9b14583d), UINT32_C(0x23a83f58), UINT32_C(0x311d90b6), UINT32_C(0x89a1f7d3), UINT32_C(0x1476cf6a), UINT32_C(0xaccaa80f), UINT32_C(0xbe7f07e1), UINT32_C(0x06c36084),
+		UINT32_C(0x5ea070d2), UINT32_C(0xe61c17b7), UINT32_C(0xf4a9b859), UINT32_C(0x4c15df3c), UINT32_C(0xd1c2e785), UINT32_C(0x697e80e0), UINT32_C(0x7bcb2f0e), UINT32_C(0xc377486b),
+		UINT32_C(0xcb0d0fa2), UINT32_C(0x73b168c7), UINT32_C(0x6104c729), UINT32_C(0xd9b8a04c), UINT32_C(0x446f98f5), UINT32_C(0xfcd3ff90), UINT32_C(0xee66507e), UINT32_C(0x56da371b),
+		UINT32_C(0x0eb9274d), UINT32_C(0xb6054028), UINT32_C(0xa4b0efc6), UINT32_C(0x1c0c88a3), UINT32_C(0x81dbb01a), UINT32_C(0x3967d77f), UINT32_C(0x2bd27891), UINT32_C(0x936e1ff4),
+		UINT32_C(0x3b26f703), UINT32_C(0x839a9066), UINT32_C(0x912f3f88), UINT32_C(0x299358ed), UINT32_C(0xb4446054), UINT32_C(0x0cf80731), UINT32_C(0x1e4da8df), UINT32_C(0xa6f1cfba),
+		UINT32_C(0xfe92dfec), UINT32_C(0x462eb889), UINT32_C(0x549b1767), UINT32_C(0xec277002), UINT32_C(0x71f048bb), UINT32_C(0xc94c2fde), UINT32_C(0xdbf98030), UINT32_C(0x6345e755),
+		UINT32_C(0x6b3fa09c), UINT32_C(0xd383c7f9), UINT32_C(0xc1366817), UINT32_C(0x798a0f72), UINT32_C(0xe45d37cb), UINT32_C(0x5ce150ae), UINT32_C(0x4e54ff40), UINT32_C(0xf6e89825),
+		UINT32_C(0xae8b8873), UINT32_C(0x1637ef16), UINT32_C(0x048240f8), UINT32_C(0xbc3e279d), UINT32_C(0x21e91f24), UINT32_C(0x99557841), UINT32_C(0x8be0d7af), UINT32_C(0x335cb0ca),
+		UINT32_C(0xed59b63b), UINT32_C(0x55e5d15e), UINT32_C(0x47507eb0), UINT32_C(0xffec19d5), UINT32_C(0x623b216c), UINT32_C(0xda874609), UINT32_C(0xc832e9e7), UINT32_C(0x708e8e82),
+		UINT32_C(0x28ed9ed4), UINT32_C(0x9051f9b1), UINT32_C(0x82e4565f), UINT32_C(0x3a58313a), UINT32_C(0xa78f0983), UINT32_C(0x1f336ee6), UINT32_C(0x0d86c108), UINT32_C(0xb53aa66d),
+		UINT32_C(0xbd40e1a4), UINT32_C(0x05fc86c1), UINT32_C(0x1749292f), UINT32_C(0xaff54e4a), UINT32_C(0x322276f3), UINT32_C(0x8a9e1196), UINT32_C(0x982bbe78), UINT32_C(0x2097d91d),
+		UINT32_C(0x78f4c94b), UINT32_C(0xc048ae2e), UINT32_C(0xd2fd01c0), UINT32_C(0x6a4166a5), UINT32_C(0xf7965e1c), UINT32_C(0x4f2a3979), UINT32_C(0x5d9f9697), UINT32_C(0xe523f1f2),
+		UINT32_C(0x4d6b1905), UINT32_C(0xf5d77e60), UINT32_C(0xe762d18e), UINT32_C(0x5fdeb6eb), UINT32_C(0xc2098e52), UINT32_C(0x7ab5e937), UINT32_C(0x680046d9), UINT32_C(0xd0bc21bc),
+		UINT32_C(0x88df31ea), UINT32_C(0x3063568f), UINT32_C(0x22d6f961), UINT32_C(0x9a6a9e04), UINT32_C(0x07bda6bd), UINT32_C(0xbf01c1d8), UINT32_C(0xadb46e36), UINT32_C(0x15080953),
+		UINT32_C(0x1d724e9a), UINT32_C(0xa5ce29ff), UINT32_C(0xb77b8611), UINT32_C(0x0fc7e174), UINT32_C(0x9210d9cd), UINT32_C(0x2aacbea8), UINT32_C(0x38191146), UINT32_C(0x80a57623),
+		UINT32_C(0xd8c66675), UINT32_C(0x607a0110), UINT32_C(0x72cfaefe), UINT32_C(0xca73c99b), UINT32_C(0x57a4f122), UINT32_C(0xef189647), UINT32_C(0xfdad39a9), UINT32_C(0x45115ecc),
+		UINT32_C(0x764dee06), UINT32_C(0xcef18963), UINT32_C(0xdc44268d), UINT32_C(0x64f841e8), UINT32_C(0xf92f7951), UINT32_C(0x41931e34), UINT32_C(0x5326b1da), UINT32_C(0xeb9ad6bf),
+		UINT32_C(0xb3f9c6e9), UINT32_C(0x0b45a18c), UINT32_C(0x19f00e62), UINT32_C(0xa14c6907), UINT32_C(0x3c9b51be), UINT32_C(0x842736db), UINT32_C(0x96929935), UINT32_C(0x2e2efe50),
+		UINT32_C(0x2654b999), UINT32_C(0x9ee8defc), UINT32_C(0x8c5d7112), UINT32_C(0x34e11677), UINT32_C(0xa9362ece), UINT32_C(0x118a49ab), UINT32_C(0x033fe645), UINT32_C(0xbb838120),
+		UINT32_C(0xe3e09176), UINT32_C(0x5b5cf613), UINT32_C(0x49e959fd), UINT32_C(0xf1553e98), UINT32_C(0x6c820621), UINT32_C(0xd43e6144), UINT32_C(0xc68bceaa), UINT32_C(0x7e37a9cf),
+		UINT32_C(0xd67f4138), UINT32_C(0x6ec3265d), UINT32_C(0x7c7689b3), UINT32_C(0xc4caeed6), UINT32_C(0x591dd66f), UINT32_C(0xe1a1b10a), UINT32_C(0xf3141ee4), UINT32_C(0x4ba87981),
+		UINT32_C(0x13cb69d7), UINT32_C(0xab770eb2), UINT32_C(0xb9c2a15c), UINT32_C(0x017ec639), UINT32_C(0x9ca9fe80), UINT32_C(0x241599e5), UINT32_C(0x36a0360b), UINT32_C(0x8e1c516e),
+		UINT32_C(0x866616a7), UINT32_C(0x3eda71c2), UINT32_C(0x2c6fde2c), UINT32_C(0x94d3b949), UINT32_C(0x090481f0), UINT32_C(0xb1b8e695), UINT32_C(0xa30d497b), UINT32_C(0x1bb12e1e),
+		UINT32_C(0x43d23e48), UINT32_C(0xfb6e592d), UINT32_C(0xe9dbf6c3), UINT32_C(0x516791a6), UINT32_C(0xccb0a91f), UINT32_C(0x740cce7a), UINT32_C(0x66b96194), UINT32_C(0xde0506f1),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0x3d6029b0), UINT32_C(0x7ac05360), UINT32_C(0x47a07ad0), UINT32_C(0xf580a6c0), UINT32_C(0xc8e08f70), UINT32_C(0x8f40f5a0), UINT32_C(0xb220dc10),
+		UINT32_C(0x30704bc1), UINT32_C(0x0d106271), UINT32_C(0x4ab018a1), UINT32_C(0x77d03111), UINT32_C(0xc5f0ed01), UINT32_C(0xf890c4b1), UINT32_C(0xbf30be61), UINT32_C(0x825097d1),
+		UINT32_C(0x60e09782), UINT32_C(0x5d80be32), UINT32_C(0x1a20c4e2), UINT32_C(0x2740ed52), UINT32_C(0x95603142), UINT32_C(0xa80018f2), UINT32_C(0xefa06222), UINT32_C(0xd2c04b92),
+		UINT32_C(0x5090dc43), UINT32_C(0x6df0f5f3), UINT32_C(0x2a508f23), UINT32_C(0x1730a693), UINT32_C(0xa5107a83), UINT32_C(0x98705333), UINT32_C(0xdfd029e3), UINT32_C(0xe2b00053),
+		UINT32_C(0xc1c12f04), UINT32_C(0xfca106b4), UINT32_C(0xbb017c64), UINT32_C(0x866155d4), UINT32_C(0x344189c4), UINT32_C(0x0921a074), UINT32_C(0x4e81daa4), UINT32_C(0x73e1f314),
+		UINT32_C(0xf1b164c5), UINT32_C(0xccd14d75), UINT32_C(0x8b7137a5), UINT32_C(0xb6111e15), UINT32_C(0x0431c205), UINT32_C(0x3951ebb5), UINT32_C(0x7ef19165), UINT32_C(0x4391b8d5),
+		UINT32_C(0xa121b886), UINT32_C(0x9c419136), UINT32_C(0xdbe1ebe6), UINT32_C(0xe681c256), UINT32_C(0x54a11e46), UINT32_C(0x69c137f6), UINT32_C(0x2e614d26), UINT32_C(0x13016496),
+		UINT32_C(0x9151f347), UINT32_C(0xac31daf7), UINT32_C(0xeb91a027), UINT32_C(0xd6f18997), UINT32_C(0x64d15587), UINT32_C(0x59b17c37), UINT32_C(0x1e1106e7), UINT32_C(0x23712f57),
+		UINT32_C(0x58f35849), UINT32_C(0x659371f9), UINT32_C(0x22330b29), UINT32_C(0x1f532299), UINT32_C(0xad73fe89), UINT32_C(0x9013d739), UINT32_C(0xd7b3ade9), UINT32_C(0xead38459),
+		UINT32_C(0x68831388), UINT32_C(0x55e33a38), UINT32_C(0x124340e8), UINT32_C(0x2f236958), UINT32_C(0x9d03b548), UINT32_C(0xa0639cf8), UINT32_C(0xe7c3e628), UINT32_C(0xdaa3cf98),
+		UINT32_C(0x3813cfcb), UINT32_C(0x0573e67b), UINT32_C(0x42d39cab), UINT32_C(0x7fb3b51b), UINT32_C(0xcd93690b), UINT32_C(0xf0f340bb), UINT32_C(0xb7533a6b), UINT32_C(0x8a3313db),
+		UINT32_C(0x0863840a), UINT32_C(0x3503adba), UINT32_C(0x72a3d76a), UINT32_C(0x4fc3feda), UINT32_C(0xfde322ca), UINT32_C(0xc0830b7a), UINT32_C(0x872371aa), UINT32_C(0xba43581a),
+		UINT32_C(0x9932774d), UINT32_C(0xa4525efd), UINT32_C(0xe3f2242d), UINT32_C(0xde920d9d), UINT32_C(0x6cb2d18d), UINT32_C(0x51d2f83d), UINT32_C(0x167282ed), UINT32_C(0x2b12ab5d),
+		UINT32_C(0xa9423c8c), UINT32_C(0x9422153c), UINT32_C(0xd3826fec), UINT32_C(0xeee2465c), UINT32_C(0x5cc29a4c), UINT32_C(0x61a2b3fc), UINT32_C(0x2602c92c), UINT32_C(0x1b62e09c),
+		UINT32_C(0xf9d2e0cf), UINT32_C(0xc4b2c97f), UINT32_C(0x8312b3af), UINT32_C(0xbe729a1f), UINT32_C(0x0c52460f), UINT32_C(0x31326fbf), UINT32_C(0x7692156f), UINT32_C(0x4bf23cdf),
+		UINT32_C(0xc9a2ab0e), UINT32_C(0xf4c282be), UINT32_C(0xb362f86e), UINT32_C(0x8e02d1de), UINT32_C(0x3c220dce), UINT32_C(0x0142247e), UINT32_C(0x46e25eae), UINT32_C(0x7b82771e),
+		UINT32_C(0xb1e6b092), UINT32_C(0x8c869922), UINT32_C(0xcb26e3f2), UINT32_C(0xf646ca42), UINT32_C(0x44661652), UINT32_C(0x79063fe2), UINT32_C(0x3ea64532), UINT32_C(0x03c66c82),
+		UINT32_C(0x8196fb53), UINT32_C(0xbcf6d2e3), UINT32_C(0xfb56a833), UINT32_C(0xc6368183), UINT32_C(0x74165d93), UINT32_C(0x49767423), UINT32_C(0x0ed60ef3), UINT32_C(0x33b62743),
+		UINT32_C(0xd1062710), UINT32_C(0xec660ea0), UINT32_C(0xabc67470), UINT32_C(0x96a65dc0), UINT32_C(0x248681d0), UINT32_C(0x19e6a860), UINT32_C(0x5e46d2b0), UINT32_C(0x6326fb00),
+		UINT32_C(0xe1766cd1), UINT32_C(0xdc164561), UINT32_C(0x9bb63fb1), UINT32_C(0xa6d61601), UINT32_C(0x14f6ca11), UINT32_C(0x2996e3a1), UINT32_C(0x6e369971), UINT32_C(0x5356b0c1),
+		UINT32_C(0x70279f96), UINT32_C(0x4d47b626), UINT32_C(0x0ae7ccf6), UINT32_C(0x3787e546), UINT32_C(0x85a73956), UINT32_C(0xb8c710e6), UINT32_C(0xff676a36), UINT32_C(0xc2074386),
+		UINT32_C(0x4057d457), UINT32_C(0x7d37fde7), UINT32_C(0x3a978737), UINT32_C(0x07f7ae87), UINT32_C(0xb5d77297), UINT32_C(0x88b75b27), UINT32_C(0xcf1721f7), UINT32_C(0xf2770847),
+		UINT32_C(0x10c70814), UINT32_C(0x2da721a4), UINT32_C(0x6a075b74), UINT32_C(0x576772c4), UINT32_C(0xe547aed4), UINT32_C(0xd8278764), UINT32_C(0x9f87fdb4), UINT32_C(0xa2e7d404),
+		UINT32_C(0x20b743d5), UINT32_C(0x1dd76a65), UINT32_C(0x5a7710b5), UINT32_C(0x67173905), UINT32_C(0xd537e515), UINT32_C(0xe857cca5), UINT32_C(0xaff7b675), UINT32_C(0x92979fc5),
+		UINT32_C(0xe915e8db), UINT32_C(0xd475c16b), UINT32_C(0x93d5bbbb), UINT32_C(0xaeb5920b), UINT32_C(0x1c954e1b), UINT32_C(0x21f567ab), UINT32_C(0x66551d7b), UINT32_C(0x5b3534cb),
+		UINT32_C(0xd965a31a), UINT32_C(0xe4058aaa), UINT32_C(0xa3a5f07a), UINT32_C(0x9ec5d9ca), UINT32_C(0x2ce505da), UINT32_C(0x11852c6a), UINT32_C(0x562556ba), UINT32_C(0x6b457f0a),
+		UINT32_C(0x89f57f59), UINT32_C(0xb49556e9), UINT32_C(0xf3352c39), UINT32_C(0xce550589), UINT32_C(0x7c75d999), UINT32_C(0x4115f029), UINT32_C(0x06b58af9), UINT32_C(0x3bd5a349),
+		UINT32_C(0xb9853498), UINT32_C(0x84e51d28), UINT32_C(0xc34567f8), UINT32_C(0xfe254e48), UINT32_C(0x4c059258), UINT32_C(0x7165bbe8), UINT32_C(0x36c5c138), UINT32_C(0x0ba5e888),
+		UINT32_C(0x28d4c7df), UINT32_C(0x15b4ee6f), UINT32_C(0x521494bf), UINT32_C(0x6f74bd0f), UINT32_C(0xdd54611f), UINT32_C(0xe03448af), UINT32_C(0xa794327f), UINT32_C(0x9af41bcf),
+		UINT32_C(0x18a48c1e), UINT32_C(0x25c4a5ae), UINT32_C(0x6264df7e), UINT32_C(0x5f04f6ce), UINT32_C(0xed242ade), UINT32_C(0xd044036e), UINT32_C(0x97e479be), UINT32_C(0xaa84500e),
+		UINT32_C(0x4834505d), UINT32_C(0x755479ed), UINT32_C(0x32f4033d), UINT32_C(0x0f942a8d), UINT32_C(0xbdb4f69d), UINT32_C(0x80d4df2d), UINT32_C(0xc774a5fd), UINT32_C(0xfa148c4d),
+		UINT32_C(0x78441b9c), UINT32_C(0x4524322c), UINT32_C(0x028448fc), UINT32_C(0x3fe4614c), UINT32_C(0x8dc4bd5c), UINT32_C(0xb0a494ec), UINT32_C(0xf704ee3c), UINT32_C(0xca64c78c),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xcb5cd3a5), UINT32_C(0x4dc8a10b), UINT32_C(0x869472ae), UINT32_C(0x9b914216), UINT32_C(0x50cd91b3), UINT32_C(0xd659e31d), UINT32_C(0x1d0530b8),
+		UINT32_C(0xec53826d), UINT32_C(0x270f51c8), UINT32_C(0xa19b2366), UINT32_C(0x6ac7f0c3), UINT32_C(0x77c2c07b), UINT32_C(0xbc9e13de), UINT32_C(0x3a0a6170), UINT32_C(0xf156b2d5),
+		UINT32_C(0x03d6029b), UINT32_C(0xc88ad13e), UINT32_C(0x4e1ea390), UINT32_C(0x85427035), UINT32_C(0x9847408d), UINT32_C(0x531b9328), UINT32_C(0xd58fe186), UINT32_C(0x1ed33223),
+		UINT32_C(0xef8580f6), UINT32_C(0x24d95353), UINT32_C(0xa24d21fd), UINT32_C(0x6911f258), UINT32_C(0x7414c2e0), UINT32_C(0xbf481145), UINT32_C(0x39dc63eb), UINT32_C(0xf280b04e),
+		UINT32_C(0x07ac0536), UINT32_C(0xccf0d693), UINT32_C(0x4a64a43d), UINT32_C(0x81387798), UINT32_C(0x9c3d4720), UINT32_C(0x57619485), UINT32_C(0xd1f5e62b), UINT32_C(0x1aa9358e),
+		UINT32_C(0xebff875b), UINT32_C(0x20a354fe), UINT32_C(0xa6372650), UINT32_C(0x6d6bf5f5), UINT32_C(0x706ec54d), UINT32_C(0xbb3216e8), UINT32_C(0x3da66446), UINT32_C(0xf6fab7e3),
+		UINT32_C(0x047a07ad), UINT32_C(0xcf26d408), UINT32_C(0x49b2a6a6), UINT32_C(0x82ee7503), UINT32_C(0x9feb45bb), UINT32_C(0x54b7961e), UINT32_C(0xd223e4b0), UINT32_C(0x197f3715),
+		UINT32_C(0xe82985c0), UINT32_C(0x23755665), UINT32_C(0xa5e124cb), UINT32_C(0x6ebdf76e), UINT32_C(0x73b8c7d6), UINT32_C(0xb8e41473), UINT32_C(0x3e7066dd), UINT32_C(0xf52cb578),
+		UINT32_C(0x0f580a6c), UINT32_C(0xc404d9c9), UINT32_C(0x4290ab67), UINT32_C(0x89cc78c2), UINT32_C(0x94c9487a), UINT32_C(0x5f959bdf), UINT32_C(0xd901e971), UINT32_C(0x125d3ad4),
+		UINT32_C(0xe30b8801), UINT32_C(0x28575ba4), UINT32_C(0xaec3290a), UINT32_C(0x659ffaaf), UINT32_C(0x789aca17), UINT32_C(0xb3c619b2), UINT32_C(0x35526b1c), UINT32_C(0xfe0eb8b9),
+		UINT32_C(0x0c8e08f7), UINT32_C(0xc7d2db52), UINT32_C(0x4146a9fc), UINT32_C(0x8a1a7a59), UINT32_C(0x971f4ae1), UINT32_C(0x5c439944), UINT32_C(0xdad7ebea), UINT32_C(0x118b384f),
+		UINT32_C(0xe0dd8a9a), UINT32_C(0x2b81593f), UINT32_C(0xad152b91), UINT32_C(0x6649f834), UINT32_C(0x7b4cc88c), UINT32_C(0xb0101b29), UINT32_C(0x36846987), UINT32_C(0xfdd8ba22),
+		UINT32_C(0x08f40f5a), UINT32_C(0xc3a8dcff), UINT32_C(0x453cae51), UINT32_C(0x8e607df4), UINT32_C(0x93654d4c), UINT32_C(0x58399ee9), UINT32_C(0xdeadec47), UINT32_C(0x15f13fe2),
+		UINT32_C(0xe4a78d37), UINT32_C(0x2ffb5e92), UINT32_C(0xa96f2c3c), UINT32_C(0x6233ff99), UINT32_C(0x7f36cf21), UINT32_C(0xb46a1c84), UINT32_C(0x32fe6e2a), UINT32_C(0xf9a2bd8f),
+		UINT32_C(0x0b220dc1), UINT32_C(0xc07ede64), UINT32_C(0x46eaacca), UINT32_C(0x8db67f6f), UINT32_C(0x90b34fd7), UINT32_C(0x5bef9c72), UINT32_C(0xdd7beedc), UINT32_C(0x16273d79),
+		UINT32_C(0xe7718fac), UINT32_C(0x2c2d5c09), UINT32_C(0xaab92ea7), UINT32_C(0x61e5fd02), UINT32_C(0x7ce0cdba), UINT32_C(0xb7bc1e1f), UINT32_C(0x31286cb1), UINT32_C(0xfa74bf14),
+		UINT32_C(0x1eb014d8), UINT32_C(0xd5ecc77d), UINT32_C(0x5378b5d3), UINT32_C(0x98246676), UINT32_C(0x852156ce), UINT32_C(0x4e7d856b), UINT32_C(0xc8e9f7c5), UINT32_C(0x03b52460),
+		UINT32_C(0xf2e396b5), UINT32_C(0x39bf4510), UINT32_C(0xbf2b37be), UINT32_C(0x7477e41b), UINT32_C(0x6972d4a3), UINT32_C(0xa22e0706), UINT32_C(0x24ba75a8), UINT32_C(0xefe6a60d),
+		UINT32_C(0x1d661643), UINT32_C(0xd63ac5e6), UINT32_C(0x50aeb748), UINT32_C(0x9bf264ed), UINT32_C(0x86f75455), UINT32_C(0x4dab87f0), UINT32_C(0xcb3ff55e), UINT32_C(0x006326fb),
+		UINT32_C(0xf135942e), UINT32_C(0x3a69478b), UINT32_C(0xbcfd3525), UINT32_C(0x77a1e680), UINT32_C(0x6aa4d638), UINT32_C(0xa1f8059d), UINT32_C(0x276c7733), UINT32_C(0xec30a496),
+		UINT32_C(0x191c11ee), UINT32_C(0xd240c24b), UINT32_C(0x54d4b0e5), UINT32_C(0x9f886340), UINT32_C(0x828d53f8), UINT32_C(0x49d1805d), UINT32_C(0xcf45f2f3), UINT32_C(0x04192156),
+		UINT32_C(0xf54f9383), UINT32_C(0x3e134026), UINT32_C(0xb8873288), UINT32_C(0x73dbe12d), UINT32_C(0x6eded195), UINT32_C(0xa5820230), UINT32_C(0x2316709e), UINT32_C(0xe84aa33b),
+		UINT32_C(0x1aca1375), UINT32_C(0xd196c0d0), UINT32_C(0x5702b27e), UINT32_C(0x9c5e61db), UINT32_C(0x815b5163), UINT32_C(0x4a0782c6), UINT32_C(0xcc93f068), UINT32_C(0x07cf23cd),
+		UINT32_C(0xf6999118), UINT32_C(0x3dc542bd), UINT32_C(0xbb513013), UINT32_C(0x700de3b6), UINT32_C(0x6d08d30e), UINT32_C(0xa65400ab), UINT32_C(0x20c07205), UINT32_C(0xeb9ca1a0),
+		UINT32_C(0x11e81eb4), UINT32_C(0xdab4cd11), UINT32_C(0x5c20bfbf), UINT32_C(0x977c6c1a), UINT32_C(0x8a795ca2), UINT32_C(0x41258f07), UINT32_C(0xc7b1fda9), UINT32_C(0x0ced2e0c),
+		UINT32_C(0xfdbb9cd9), UINT32_C(0x36e74f7c), UINT32_C(0xb0733dd2), UINT32_C(0x7b2fee77), UINT32_C(0x662adecf), UINT32_C(0xad760d6a), UINT32_C(0x2be27fc4), UINT32_C(0xe0beac61),
+		UINT32_C(0x123e1c2f), UINT32_C(0xd962cf8a), UINT32_C(0x5ff6bd24), UINT32_C(0x94aa6e81), UINT32_C(0x89af5e39), UINT32_C(0x42f38d9c), UINT32_C(0xc467ff32), UINT32_C(0x0f3b2c97),
+		UINT32_C(0xfe6d9e42), UINT32_C(0x35314de7), UINT32_C(0xb3a53f49), UINT32_C(0x78f9ecec), UINT32_C(0x65fcdc54), UINT32_C(0xaea00ff1), UINT32_C(0x28347d5f), UINT32_C(0xe368aefa),
+		UINT32_C(0x16441b82), UINT32_C(0xdd18c827), UINT32_C(0x5b8cba89), UINT32_C(0x90d0692c), UINT32_C(0x8dd55994), UINT32_C(0x46898a31), UINT32_C(0xc01df89f), UINT32_C(0x0b412b3a),
+		UINT32_C(0xfa1799ef), UINT32_C(0x314b4a4a), UINT32_C(0xb7df38e4), UINT32_C(0x7c83eb41), UINT32_C(0x6186dbf9), UINT32_C(0xaada085c), UINT32_C(0x2c4e7af2), UINT32_C(0xe712a957),
+		UINT32_C(0x15921919), UINT32_C(0xdececabc), UINT32_C(0x585ab812), UINT32_C(0x93066bb7), UINT32_C(0x8e035b0f), UINT32_C(0x455f88aa), UINT32_C(0xc3cbfa04), UINT32_C(0x089729a1),
+		UINT32_C(0xf9c19b74), UINT32_C(0x329d48d1), UINT32_C(0xb4093a7f), UINT32_C(0x7f55e9da), UINT32_C(0x6250d962), UINT32_C(0xa90c0ac7), UINT32_C(0x2f987869), UINT32_C(0xe4c4abcc),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xa6770bb4), UINT32_C(0x979f1129), UINT32_C(0x31e81a9d), UINT32_C(0xf44f2413), UINT32_C(0x52382fa7), UINT32_C(0x63d0353a), UINT32_C(0xc5a73e8e),
+		UINT32_C(0x33ef4e67), UINT32_C(0x959845d3), UINT32_C(0xa4705f4e), UINT32_C(0x020754fa), UINT32_C(0xc7a06a74), UINT32_C(0x61d761c0), UINT32_C(0x503f7b5d), UINT32_C(0xf64870e9),
+		UINT32_C(0x67de9cce), UINT32_C(0xc1a9977a), UINT32_C(0xf0418de7), UINT32_C(0x56368653), UINT32_C(0x9391b8dd), UINT32_C(0x35e6b369), UINT32_C(0x040ea9f4), UINT32_C(0xa279a240),
+		UINT32_C(0x5431d2a9), UINT32_C(0xf246d91d), UINT32_C(0xc3aec380), UINT32_C(0x65d9c834), UINT32_C(0xa07ef6ba), UINT32_C(0x0609fd0e), UINT32_C(0x37e1e793), UINT32_C(0x9196ec27),
+		UINT32_C(0xcfbd399c), UINT32_C(0x69ca3228), UINT32_C(0x582228b5), UINT32_C(0xfe552301), UINT32_C(0x3bf21d8f), UINT32_C(0x9d85163b), UINT32_C(0xac6d0ca6), UINT32_C(0x0a1a0712),
+		UINT32_C(0xfc5277fb), UINT32_C(0x5a257c4f), UINT32_C(0x6bcd66d2), UINT32_C(0xcdba6d66), UINT32_C(0x081d53e8), UINT32_C(0xae6a585c), UINT32_C(0x9f8242c1), UINT32_C(0x39f54975),
+		UINT32_C(0xa863a552), UINT32_C(0x0e14aee6), UINT32_C(0x3ffcb47b), UINT32_C(0x998bbfcf), UINT32_C(0x5c2c8141), UINT32_C(0xfa5b8af5), UINT32_C(0xcbb39068), UINT32_C(0x6dc49bdc),
+		UINT32_C(0x9b8ceb35), UINT32_C(0x3dfbe081), UINT32_C(0x0c13fa1c), UINT32_C(0xaa64f1a8), UINT32_C(0x6fc3cf26), UINT32_C(0xc9b4c492), UINT32_C(0xf85cde0f), UINT32_C(0x5e2bd5bb),
+		UINT32_C(0x440b7579), UINT32_C(0xe27c7ecd), UINT32_C(0xd3946450), UINT32_C(0x75e36fe4), UINT32_C(0xb044516a), UINT32_C(0x16335ade), UINT32_C(0x27db4043), UINT32_C(0x81ac4bf7),
+		UINT32_C(0x77e43b1e), UINT32_C(0xd19330aa), UINT32_C(0xe07b2a37), UINT32_C(0x460c2183), UINT32_C(0x83ab1f0d), UINT32_C(0x25dc14b9), UINT32_C(0x14340e24), UINT32_C(0xb2430590),
+		UINT32_C(0x23d5e9b7), UINT32_C(0x85a2e203), UINT32_C(0xb44af89e), UINT32_C(0x123df32a), UINT32_C(0xd79acda4), UINT32_C(0x71edc610), UINT32_C(0x4005dc8d), UINT32_C(0xe672d739),
+		UINT32_C(0x103aa7d0), UINT32_C(0xb64dac64), UINT32_C(0x87a5b6f9), UINT32_C(0x21d2bd4d), UINT32_C(0xe47583c3), UINT32_C(0x42028877), UINT32_C(0x73ea92ea), UINT32_C(0xd59d995e),
+		UINT32_C(0x8bb64ce5), UINT32_C(0x2dc14751), UINT32_C(0x1c295dcc), UINT32_C(0xba5e5678), UINT32_C(0x7ff968f6), UINT32_C(0xd98e6342), UINT32_C(0xe86679df), UINT32_C(0x4e11726b),
+		UINT32_C(0xb8590282), UINT32_C(0x1e2e0936), UINT32_C(0x2fc613ab), UINT32_C(0x89b1181f), UINT32_C(0x4c162691), UINT32_C(0xea612d25), UINT32_C(0xdb8937b8), UINT32_C(0x7dfe3c0c),
+		UINT32_C(0xec68d02b), UINT32_C(0x4a1fdb9f), UINT32_C(0x7bf7c102), UINT32_C(0xdd80cab6), UINT32_C(0x1827f438), UINT32_C(0xbe50ff8c), UINT32_C(0x8fb8e511), UINT32_C(0x29cfeea5),
+		UINT32_C(0xdf879e4c), UINT32_C(0x79f095f8), UINT32_C(0x48188f65), UINT32_C(0xee6f84d1), UINT32_C(0x2bc8ba5f), UINT32_C(0x8dbfb1eb), UINT32_C(0xbc57ab76), UINT32_C(0x1a20a0c2),
+		UINT32_C(0x8816eaf2), UINT32_C(0x2e61e146), UINT32_C(0x1f89fbdb), UINT32_C(0xb9fef06f), UINT32_C(0x7c59cee1), UINT32_C(0xda2ec555), UINT32_C(0xebc6dfc8), UINT32_C(0x4db1d47c),
+		UINT32_C(0xbbf9a495), UINT32_C(0x1d8eaf21), UINT32_C(0x2c66b5bc), UINT32_C(0x8a11be08), UINT32_C(0x4fb68086), UINT32_C(0xe9c18b32), UINT32_C(0xd82991af), UINT32_C(0x7e5e9a1b),
+		UINT32_C(0xefc8763c), UINT32_C(0x49bf7d88), UINT32_C(0x78576715), UINT32_C(0xde206ca1), UINT32_C(0x1b87522f), UINT32_C(0xbdf0599b), UINT32_C(0x8c184306), UINT32_C(0x2a6f48b2),
+		UINT32_C(0xdc27385b), UINT32_C(0x7a5033ef), UINT32_C(0x4bb82972), UINT32_C(0xedcf22c6), UINT32_C(0x28681c48), UINT32_C(0x8e1f17fc), UINT32_C(0xbff70d61), UINT32_C(0x198006d5),
+		UINT32_C(0x47abd36e), UINT32_C(0xe1dcd8da), UINT32_C(0xd034c247), UINT32_C(0x7643c9f3), UINT32_C(0xb3e4f77d), UINT32_C(0x1593fcc9), UINT32_C(0x247be654), UINT32_C(0x820cede0),
+		UINT32_C(0x74449d09), UINT32_C(0xd23396bd), UINT32_C(0xe3db8c20), UINT32_C(0x45ac8794), UINT32_C(0x800bb91a), UINT32_C(0x267cb2ae), UINT32_C(0x1794a833), UINT32_C(0xb1e3a387),
+		UINT32_C(0x20754fa0), UINT32_C(0x86024414), UINT32_C(0xb7ea5e89), UINT32_C(0x119d553d), UINT32_C(0xd43a6bb3), UINT32_C(0x724d6007), UINT32_C(0x43a57a9a), UINT32_C(0xe5d2712e),
+		UINT32_C(0x139a01c7), UINT32_C(0xb5ed0a73), UINT32_C(0x840510ee), UINT32_C(0x22721b5a), UINT32_C(0xe7d525d4), UINT32_C(0x41a22e60), UINT32_C(0x704a34fd), UINT32_C(0xd63d3f49),
+		UINT32_C(0xcc1d9f8b), UINT32_C(0x6a6a943f), UINT32_C(0x5b828ea2), UINT32_C(0xfdf58516), UINT32_C(0x3852bb98), UINT32_C(0x9e25b02c), UINT32_C(0xafcdaab1), UINT32_C(0x09baa105),
+		UINT32_C(0xfff2d1ec), UINT32_C(0x5985da58), UINT32_C(0x686dc0c5), UINT32_C(0xce1acb71), UINT32_C(0x0bbdf5ff), UINT32_C(0xadcafe4b), UINT32_C(0x9c22e4d6), UINT32_C(0x3a55ef62),
+		UINT32_C(0xabc30345), UINT32_C(0x0db408f1), UINT32_C(0x3c5c126c), UINT32_C(0x9a2b19d8), UINT32_C(0x5f8c2756), UINT32_C(0xf9fb2ce2), UINT32_C(0xc813367f), UINT32_C(0x6e643dcb),
+		UINT32_C(0x982c4d22), UINT32_C(0x3e5b4696), UINT32_C(0x0fb35c0b), UINT32_C(0xa9c457bf), UINT32_C(0x6c636931), UINT32_C(0xca146285), UINT32_C(0xfbfc7818), UINT32_C(0x5d8b73ac),
+		UINT32_C(0x03a0a617), UINT32_C(0xa5d7ada3), UINT32_C(0x943fb73e), UINT32_C(0x3248bc8a), UINT32_C(0xf7ef8204), UINT32_C(0x519889b0), UINT32_C(0x6070932d), UINT32_C(0xc6079899),
+		UINT32_C(0x304fe870), UINT32_C(0x9638e3c4), UINT32_C(0xa7d0f959), UINT32_C(0x01a7f2ed), UINT32_C(0xc400cc63), UINT32_C(0x6277c7d7), UINT32_C(0x539fdd4a), UINT32_C(0xf5e8d6fe),
+		UINT32_C(0x647e3ad9), UINT32_C(0xc209316d), UINT32_C(0xf3e12bf0), UINT32_C(0x55962044), UINT32_C(0x90311eca), UINT32_C(0x3646157e), UINT32_C(0x07ae0fe3), UINT32_C(0xa1d90457),
+		UINT32_C(0x579174be), UINT32_C(0xf1e67f0a), UINT32_C(0xc00e6597), UINT32_C(0x66796e23), UINT32_C(0xa3de50ad), UINT32_C(0x05a95b19), UINT32_C(0x34414184), UINT32_C(0x92364a30),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xccaa009e), UINT32_C(0x4225077d), UINT32_C(0x8e8f07e3), UINT32_C(0x844a0efa), UINT32_C(0x48e00e64), UINT32_C(0xc66f0987), UINT32_C(0x0ac50919),
+		UINT32_C(0xd3e51bb5), UINT32_C(0x1f4f1b2b), UINT32_C(0x91c01cc8), UINT32_C(0x5d6a1c56), UINT32_C(0x57af154f), UINT32_C(0x9b0515d1), UINT32_C(0x158a1232), UINT32_C(0xd92012ac),
+		UINT32_C(0x7cbb312b), UINT32_C(0xb01131b5), UINT32_C(0x3e9e3656), UINT32_C(0xf23436c8), UINT32_C(0xf8f13fd1), UINT32_C(0x345b3f4f), UINT32_C(0xbad438ac), UINT32_C(0x767e3832),
+		UINT32_C(0xaf5e2a9e), UINT32_C(0x63f42a00), UINT32_C(0xed7b2de3), UINT32_C(0x21d12d7d), UINT32_C(0x2b142464), UINT32_C(0xe7be24fa), UINT32_C(0x69312319), UINT32_C(0xa59b2387),
+		UINT32_C(0xf9766256), UINT32_C(0x35dc62c8), UINT32_C(0xbb53652b), UINT32_C(0x77f965b5), UINT32_C(0x7d3c6cac), UINT32_C(0xb1966c32), UINT32_C(0x3f196bd1), UINT32_C(0xf3b36b4f),
+		UINT32_C(0x2a9379e3), UINT32_C(0xe639797d), UINT32_C(0x68b67e9e), UINT32_C(0xa41c7e00), UINT32_C(0xaed97719), UINT32_C(0x62737787), UINT32_C(0xecfc7064), UINT32_C(0x205670fa),
+		UINT32_C(0x85cd537d), UINT32_C(0x496753e3), UINT32_C(0xc7e85400), UINT32_C(0x0b42549e), UINT32_C(0x01875d87), UINT32_C(0xcd2d5d19), UINT32_C(0x43a25afa), UINT32_C(0x8f085a64),
+		UINT32_C(0x562848c8), UINT32_C(0x9a824856), UINT32_C(0x140d4fb5), UINT32_C(0xd8a74f2b), UINT32_C(0xd2624632), UINT32_C(0x1ec846ac), UINT32_C(0x9047414f), UINT32_C(0x5ced41d1),
+		UINT32_C(0x299dc2ed), UINT32_C(0xe537c273), UINT32_C(0x6bb8c590), UINT32_C(0xa712c50e), UINT32_C(0xadd7cc17), UINT32_C(0x617dcc89), UINT32_C(0xeff2cb6a), UINT32_C(0x2358cbf4),
+		UINT32_C(0xfa78d958), UINT32_C(0x36d2d9c6), UINT32_C(0xb85dde25), UINT32_C(0x74f7debb), UINT32_C(0x7e32d7a2), UINT32_C(0xb298d73c), UINT32_C(0x3c17d0df), UINT32_C(0xf0bdd041),
+		UINT32_C(0x5526f3c6), UINT32_C(0x998cf358), UINT32_C(0x1703f4bb), UINT32_C(0xdba9f425), UINT32_C(0xd16cfd3c), UINT32_C(0x1dc6fda2), UINT32_C(0x9349fa41), UINT32_C(0x5fe3fadf),
+		UINT32_C(0x86c3e873), UINT32_C(0x4a69e8ed), UINT32_C(0xc4e6ef0e), UINT32_C(0x084cef90), UINT32_C(0x0289e689), UINT32_C(0xce23e617), UINT32_C(0x40ace1f4), UINT32_C(0x8c06e16a),
+		UINT32_C(0xd0eba0bb), UINT32_C(0x1c41a025), UINT32_C(0x92cea7c6), UINT32_C(0x5e64a758), UINT32_C(0x54a1ae41), UINT32_C(0x980baedf), UINT32_C(0x1684a93c), UINT32_C(0xda2ea9a2),
+		UINT32_C(0x030ebb0e), UINT32_C(0xcfa4bb90), UINT32_C(0x412bbc73), UINT32_C(0x8d81bced), UINT32_C(0x8744b5f4), UINT32_C(0x4beeb56a), UINT32_C(0xc561b289), UINT32_C(0x09cbb217),
+		UINT32_C(0xac509190), UINT32_C(0x60fa910e), UINT32_C(0xee7596ed), UINT32_C(0x22df9673), UINT32_C(0x281a9f6a), UINT32_C(0xe4b09ff4), UINT32_C(0x6a3f9817), UINT32_C(0xa6959889),
+		UINT32_C(0x7fb58a25), UINT32_C(0xb31f8abb), UINT32_C(0x3d908d58), UINT32_C(0xf13a8dc6), UINT32_C(0xfbff84df), UINT32_C(0x37558441), UINT32_C(0xb9da83a2), UINT32_C(0x7570833c),
+		UINT32_C(0x533b85da), UINT32_C(0x9f918544), UINT32_C(0x111e82a7), UINT32_C(0xddb48239), UINT32_C(0xd7718b20), UINT32_C(0x1bdb8bbe), UINT32_C(0x95548c5d), UINT32_C(0x59fe8cc3),
+		UINT32_C(0x80de9e6f), UINT32_C(0x4c749ef1), UINT32_C(0xc2fb9912), UINT32_C(0x0e51998c), UINT32_C(0x04949095), UINT32_C(0xc83e900b), UINT32_C(0x46b197e8), UINT32_C(0x8a1b9776),
+		UINT32_C(0x2f80b4f1), UINT32_C(0xe32ab46f), UINT32_C(0x6da5b38c), UINT32_C(0xa10fb312), UINT32_C(0xabcaba0b), UINT32_C(0x6760ba95), UINT32_C(0xe9efbd76), UINT32_C(0x2545bde8),
+		UINT32_C(0xfc65af44), UINT32_C(0x30cfafda), UINT32_C(0xbe40a839), UINT32_C(0x72eaa8a7), UINT32_C(0x782fa1be), UINT32_C(0xb485a120), UINT32_C(0x3a0aa6c3), UINT32_C(0xf6a0a65d),
+		UINT32_C(0xaa4de78c), UINT32_C(0x66e7e712), UINT32_C(0xe868e0f1), UINT32_C(0x24c2e06f), UINT32_C(0x2e07e976), UINT32_C(0xe2ade9e8), UINT32_C(0x6c22ee0b), UINT32_C(0xa088ee95),
+		UINT32_C(0x79a8fc39), UINT32_C(0xb502fca7), UINT32_C(0x3b8dfb44), UINT32_C(0xf727fbda), UINT32_C(0xfde2f2c3), UINT32_C(0x3148f25d), UINT32_C(0xbfc7f5be), UINT32_C(0x736df520),
+		UINT32_C(0xd6f6d6a7), UINT32_C(0x1a5cd639), UINT32_C(0x94d3d1da), UINT32_C(0x5879d144), UINT32_C(0x52bcd85d), UINT32_C(0x9e16d8c3), UINT32_C(0x1099df20), UINT32_C(0xdc33dfbe),
+		UINT32_C(0x0513cd12), UINT32_C(0xc9b9cd8c), UINT32_C(0x4736ca6f), UINT32_C(0x8b9ccaf1), UINT32_C(0x8159c3e8), UINT32_C(0x4df3c376), UINT32_C(0xc37cc495), UINT32_C(0x0fd6c40b),
+		UINT32_C(0x7aa64737), UINT32_C(0xb60c47a9), UINT32_C(0x3883404a), UINT32_C(0xf42940d4), UINT32_C(0xfeec49cd), UINT32_C(0x32464953), UINT32_C(0xbcc94eb0), UINT32_C(0x70634e2e),
+		UINT32_C(0xa9435c82), UINT32_C(0x65e95c1c), UINT32_C(0xeb665bff), UINT32_C(0x27cc5b61), UINT32_C(0x2d095278), UINT32_C(0xe1a352e6), UINT32_C(0x6f2c5505), UINT32_C(0xa386559b),
+		UINT32_C(0x061d761c), UINT32_C(0xcab77682), UINT32_C(0x44387161), UINT32_C(0x889271ff), UINT32_C(0x825778e6), UINT32_C(0x4efd7878), UINT32_C(0xc0727f9b), UINT32_C(0x0cd87f05),
+		UINT32_C(0xd5f86da9), UINT32_C(0x19526d37), UINT32_C(0x97dd6ad4), UINT32_C(0x5b776a4a), UINT32_C(0x51b26353), UINT32_C(0x9d1863cd), UINT32_C(0x1397642e), UINT32_C(0xdf3d64b0),
+		UINT32_C(0x83d02561), UINT32_C(0x4f7a25ff), UINT32_C(0xc1f5221c), UINT32_C(0x0d5f2282), UINT32_C(0x079a2b9b), UINT32_C(0xcb302b05), UINT32_C(0x45bf2ce6), UINT32_C(0x89152c78),
+		UINT32_C(0x50353ed4), UINT32_C(0x9c9f3e4a), UINT32_C(0x121039a9), UINT32_C(0xdeba3937), UINT32_C(0xd47f302e), UINT32_C(0x18d530b0), UINT32_C(0x965a3753), UINT32_C(0x5af037cd),
+		UINT32_C(0xff6b144a), UINT32_C(0x33c114d4), UINT32_C(0xbd4e1337), UINT32_C(0x71e413a9), UINT32_C(0x7b211ab0), UINT32_C(0xb78b1a2e), UINT32_C(0x39041dcd), UINT32_C(0xf5ae1d53),
+		UINT32_C(0x2c8e0fff), UINT32_C(0xe0240f61), UINT32_C(0x6eab0882), UINT32_C(0xa201081c), UINT32_C(0xa8c40105), UINT32_C(0x646e019b), UINT32_C(0xeae10678), UINT32_C(0x264b06e6),
+	},
+}
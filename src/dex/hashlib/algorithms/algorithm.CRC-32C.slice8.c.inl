@@ -0,0 +1,240 @@
+{
+	{
+		UINT32_C(0x00000000), UINT32_C(0x13a29877), UINT32_C(0x274530ee), UINT32_C(0x34e7a899), UINT32_C(0x4e8a61dc), UINT32_C(0x5d28f9ab), UINT32_C(0x69cf5132), UINT32_C(0x7a6dc945),
+		UINT32_C(0x9d14c3b8), UINT32_C(0x8eb65bcf), UINT32_C(0xba51f356), UINT32_C(0xa9f36b21), UINT32_C(0xd39ea264), UINT32_C(0xc03c3a13), UINT32_C(0xf4db928a), UINT32_C(0xe7790afd),
+		UINT32_C(0x3fc5f181), UINT32_C(0x2c6769f6), UINT32_C(0x1880c16f), UINT32_C(0x0b225918), UINT32_C(0x714f905d), UINT32_C(0x62ed082a), UINT32_C(0x560aa0b3), UINT32_C(0x45a838c4),
+		UINT32_C(0xa2d13239), UINT32_C(0xb173aa4e), UINT32_C(0x859402d7), UINT32_C(0x96369aa0), UINT32_C(0xec5b53e5), UINT32_C(0xfff9cb92), UINT32_C(0xcb1e630b), UINT32_C(0xd8bcfb7c),
+		UINT32_C(0x7f8be302), UINT32_C(0x6c297b75), UINT32_C(0x58ced3ec), UINT32_C(0x4b6c4b9b), UINT32_C(0x310182de), UINT32_C(0x22a31aa9), UINT32_C(0x1644b230), UINT32_C(0x05e62a47),
+		UINT32_C(0xe29f20ba), UINT32_C(0xf13db8cd), UINT32_C(0xc5da1054), UINT32_C(0xd6788823), UINT32_C(0xac154166), UINT32_C(0xbfb7d911), UINT32_C(0x8b507188), UINT32_C(0x98f2e9ff),
+		UINT32_C(0x404e1283), UINT32_C(0x53ec8af4), UINT32_C(0x670b226d), UINT32_C(0x74a9ba1a), UINT32_C(0x0ec4735f), UINT32_C(0x1d66eb28), UINT32_C(0x298143b1), UINT32_C(0x3a23dbc6),
+		UINT32_C(0xdd5ad13b), UINT32_C(0xcef8494c), UINT32_C(0xfa1fe1d5), UINT32_C(0xe9bd79a2), UINT32_C(0x93d0b0e7), UINT32_C(0x80722890), UINT32_C(0xb4958009), UINT32_C(0xa737187e),
+		UINT32_C(0xff17c604), UINT32_C(0xecb55e73), UINT32_C(0xd852f6ea), UINT32_C(0xcbf06e9d), UINT32_C(0xb19da7d8), UINT32_C(0xa23f3faf), UINT32_C(0x96d89736), UINT32_C(0x857a0f41),
+		UINT32_C(0x620305bc), UINT32_C(0x71a19dcb), UINT32_C(0x45463552), UINT32_C(0x56e4ad25), UINT32_C(0x2c896460), UINT32_C(0x3f2bfc17), UINT32_C(0x0bcc548e), UINT32_C(0x186eccf9),
+		UINT32_C(0xc0d23785), UINT32_C(0xd370aff2), UINT32_C(0xe797076b), UINT32_C(0xf4359f1c), UINT32_C(0x8e585659), UINT32_C(0x9dface2e), UINT32_C(0xa91d66b7), UINT32_C(0xbabffec0),
+		UINT32_C(0x5dc6f43d), UINT32_C(0x4e646c4a), UINT32_C(0x7a83c4d3), UINT32_C(0x69215ca4), UINT32_C(0x134c95e1), UINT32_C(0x00ee0d96), UINT32_C(0x3409a50f), UINT32_C(0x27ab3d78),
+		UINT32_C(0x809c2506), UINT32_C(0x933ebd71), UINT32_C(0xa7d915e8), UINT32_C(0xb47b8d9f), UINT32_C(0xce1644da), UINT32_C(0xddb4dcad), UINT32_C(0xe9537434), UINT32_C(0xfaf1ec43),
+		UINT32_C(0x1d88e6be), UINT32_C(0x0e2a7ec9), UINT32_C(0x3acdd650), UINT32_C(0x296f4e27), UINT32_C(0x53028762), UINT32_C(0x40a01f15), UINT32_C(0x7447b78c), UINT32_C(0x67e52ffb),
+		UINT32_C(0xbf59d487), UINT32_C(0xacfb4cf0), UINT32_C(0x981ce469), UINT32_C(0x8bbe7c1e), UINT32_C(0xf1d3b55b), UINT32_C(0xe2712d2c), UINT32_C(0xd69685b5), UINT32_C(0xc5341dc2),
+		UINT32_C(0x224d173f), UINT32_C(0x31ef8f48), UINT32_C(0x050827d1), UINT32_C(0x16aabfa6), UINT32_C(0x6cc776e3), UINT32_C(0x7f65ee94), UINT32_C(0x4b82460d), UINT32_C(0x5820de7a),
+		UINT32_C(0xfbc3faf9), UINT32_C(0xe861628e), UINT32_C(0xdc86ca17), UINT32_C(0xcf245260), UINT32_C(0xb5499b25), UINT32_C(0xa6eb0352), UINT32_C(0x920cabcb), UINT32_C(0x81ae33bc),
+		UINT32_C(0x66d73941), UINT32_C(0x7575a136), UINT32_C(0x419209af), UINT32_C(0x523091d8), UINT32_C(0x285d589d), UINT32_C(0x3bffc0ea), UINT32_C(0x0f186873), UINT32_C(0x1cbaf004),
+		UINT32_C(0xc4060b78), UINT32_C(0xd7a4930f), UINT32_C(0xe3433b96), UINT32_C(0xf0e1a3e1), UINT32_C(0x8a8c6aa4), UINT32_C(0x992ef2d3), UINT32_C(0xadc95a4a), UINT32_C(0xbe6bc23d),
+		UINT32_C(0x5912c8c0), UINT32_C(0x4ab050b7), UINT32_C(0x7e57f82e), UINT32_C(0x6df56059), UINT32_C(0x1798a91c), UINT32_C(0x043a316b), UINT32_C(0x30dd99f2), UINT32_C(0x237f0185),
+		UINT32_C(0x844819fb), UINT32_C(0x97ea818c), UINT32_C(0xa30d2915), UINT32_C(0xb0afb162), UINT32_C(0xcac27827), UINT32_C(0xd960e050), UINT32_C(0xed8748c9), UINT32_C(0xfe25d0be),
+		UINT32_C(0x195cda43), UINT32_C(0x0afe4234), UINT32_C(0x3e19eaad), UINT32_C(0x2dbb72da), UINT32_C(0x57d6bb9f), UINT32_C(0x447423e8), UINT32_C(0x70938b71), UINT32_C(0x63311306),
+		UINT32_C(0xbb8de87a), UINT32_C(0xa82f700d), UINT32_C(0x9cc8d894), UINT32_C(0x8f6a40e3), UINT32_C(0xf50789a6), UINT32_C(0xe6a511d1), UINT32_C(0xd242b948), UINT32_C(0xc1e0213f),
+		UINT32_C(0x26992bc2), UINT32_C(0x353bb3b5), UINT32_C(0x01dc1b2c), UINT32_C(0x127e835b), UINT32_C(0x68134a1e), UINT32_C(0x7bb1d269), UINT32_C(0x4f567af0), UINT32_C(0x5cf4e287),
+		UINT32_C(0x04d43cfd), UINT32_C(0x1776a48a), UINT32_C(0x23910c13), UINT32_C(0x30339464), UINT32_C(0x4a5e5d21), UINT32_C(0x59fcc556), UINT32_C(0x6d1b6dcf), UINT32_C(0x7eb9f5b8),
+		UINT32_C(0x99c0ff45), UINT32_C(0x8a626732), UINT32_C(0xbe85cfab), UINT32_C(0xad2757dc), UINT32_C(0xd74a9e99), UINT32_C(0xc4e806ee), UINT32_C(0xf00fae77), UINT32_C(0xe3ad3600),
+		UINT32_C(0x3b11cd7c), UINT32_C(0x28b3550b), UINT32_C(0x1c54fd92), UINT32_C(0x0ff665e5), UINT32_C(0x759baca0), UINT32_C(0x663934d7), UINT32_C(0x52de9c4e), UINT32_C(0x417c0439),
+		UINT32_C(0xa6050ec4), UINT32_C(0xb5a796b3), UINT32_C(0x81403e2a), UINT32_C(0x92e2a65d), UINT32_C(0xe88f6f18), UINT32_C(0xfb2df76f), UINT32_C(0xcfca5ff6), UINT32_C(0xdc68c781),
+		UINT32_C(0x7b5fdfff), UINT32_C(0x68fd4788), UINT32_C(0x5c1aef11), UINT32_C(0x4fb87766), UINT32_C(0x35d5be23), UINT32_C(0x26772654), UINT32_C(0x12908ecd), UINT32_C(0x013216ba),
+		UINT32_C(0xe64b1c47), UINT32_C(0xf5e98430), UINT32_C(0xc10e2ca9), UINT32_C(0xd2acb4de), UINT32_C(0xa8c17d9b), UINT32_C(0xbb63e5ec), UINT32_C(0x8f844d75), UINT32_C(0x9c26d502),
+		UINT32_C(0x449a2e7e), UINT32_C(0x5738b609), UINT32_C(0x63df1e90), UINT32_C(0x707d86e7), UINT32_C(0x0a104fa2), UINT32_C(0x19b2d7d5), UINT32_C(0x2d557f4c), UINT32_C(0x3ef7e73b),
+		UINT32_C(0xd98eedc6), UINT32_C(0xca2c75b1), UINT32_C(0xfecbdd28), UINT32_C(0xed69455f), UINT32_C(0x97048c1a), UINT32_C(0x84a6146d), UINT32_C(0xb041bcf4), UINT32_C(0xa3e32483),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xa541927e), UINT32_C(0x4f6f520d), UINT32_C(0xea2ec073), UINT32_C(0x9edea41a), UINT32_C(0x3b9f3664), UINT32_C(0xd1b1f617), UINT32_C(0x74f06469),
+		UINT32_C(0x38513ec5), UINT32_C(0x9d10acbb), UINT32_C(0x773e6cc8), UINT32_C(0xd27ffeb6), UINT32_C(0xa68f9adf), UINT32_C(0x03ce08a1), UINT32_C(0xe9e0c8d2), UINT32_C(0x4ca15aac),
+		UINT32_C(0x70a27d8a), UINT32_C(0xd5e3eff4), UINT32_C(0x3fcd2f87), UINT32_C(0x9a8cbdf9), UINT32_C(0xee7cd990), UINT32_C(0x4b3d4bee), UINT32_C(0xa1138b9d), UINT32_C(0x045219e3),
+		UINT32_C(0x48f3434f), UINT32_C(0xedb2d131), UINT32_C(0x079c1142), UINT32_C(0xa2dd833c), UINT32_C(0xd62de755), UINT32_C(0x736c752b), UINT32_C(0x9942b558), UINT32_C(0x3c032726),
+		UINT32_C(0xe144fb14), UINT32_C(0x4405696a), UINT32_C(0xae2ba919), UINT32_C(0x0b6a3b67), UINT32_C(0x7f9a5f0e), UINT32_C(0xdadbcd70), UINT32_C(0x30f50d03), UINT32_C(0x95b49f7d),
+		UINT32_C(0xd915c5d1), UINT32_C(0x7c5457af), UINT32_C(0x967a97dc), UINT32_C(0x333b05a2), UINT32_C(0x47cb61cb), UINT32_C(0xe28af3b5), UINT32_C(0x08a433c6), UINT32_C(0xade5a1b8),
+		UINT32_C(0x91e6869e), UINT32_C(0x34a714e0), UINT32_C(0xde89d493), UINT32_C(0x7bc846ed), UINT32_C(0x0f382284), UINT32_C(0xaa79b0fa), UINT32_C(0x40577089), UINT32_C(0xe516e2f7),
+		UINT32_C(0xa9b7b85b), UINT32_C(0x0cf62a25), UINT32_C(0xe6d8ea56), UINT32_C(0x43997828), UINT32_C(0x37691c41), UINT32_C(0x92288e3f), UINT32_C(0x78064e4c), UINT32_C(0xdd47dc32),
+		UINT32_C(0xc76580d9), UINT32_C(0x622412a7), UINT32_C(0x880ad2d4), UINT32_C(0x2d4b40aa), UINT32_C(0x59bb24c3), UINT32_C(0xfcfab6bd), UINT32_C(0x16d476ce), UINT32_C(0xb395e4b0),
+		UINT32_C(0xff34be1c), UINT32_C(0x5a752c62), UINT32_C(0xb05bec11), UINT32_C(0x151a7e6f), UINT32_C(0x61ea1a06), UINT32_C(0xc4ab8878), UINT32_C(0x2e85480b), UINT32_C(0x8bc4da75),
+		UINT32_C(0xb7c7fd53), UINT32_C(0x12866f2d), UINT32_C(0xf8a8af5e), UINT32_C(0x5de93d20), UINT32_C(0x29195949), UINT32_C(0x8c58cb37), UINT32_C(0x66760b44), UINT32_C(0xc337993a),
+		UINT32_C(0x8f96c396), UINT32_C(0x2ad751e8), UINT32_C(0xc0f9919b), UINT32_C(0x65b803e5), UINT32_C(0x1148678c), UINT32_C(0xb409f5f2), UINT32_C(0x5e273581), UINT32_C(0xfb66a7ff),
+		UINT32_C(0x26217bcd), UINT32_C(0x8360e9b3), UINT32_C(0x694e29c0), UINT32_C(0xcc0fbbbe), UINT32_C(0xb8ffdfd7), UINT32_C(0x1dbe4da9), UINT32_C(0xf7908dda), UINT32_C(0x52d11fa4),
+		UINT32_C(0x1e704508), UINT32_C(0xbb31d776), UINT32_C(0x511f1705), UINT32_C(0xf45e857b), UINT32_C(0x80aee112), UINT32_C(0x25ef736c), UINT32_C(0xcfc1b31f), UINT32_C(0x6a802161),
+		UINT32_C(0x56830647), UINT32_C(0xf3c29439), UINT32_C(0x19ec544a), UINT32_C(0xbcadc634), UINT32_C(0xc85da25d), UINT32_C(0x6d1c3023), UINT32_C(0x8732f050), UINT32_C(0x2273622e),
+		UINT32_C(0x6ed23882), UINT32_C(0xcb93aafc), UINT32_C(0x21bd6a8f), UINT32_C(0x84fcf8f1), UINT32_C(0xf00c9c98), UINT32_C(0x554d0ee6), UINT32_C(0xbf63ce95), UINT32_C(0x1a225ceb),
+		UINT32_C(0x8b277743), UINT32_C(0x2e66e53d), UINT32_C(0xc448254e), UINT32_C(0x6109b730), UINT32_C(0x15f9d359), UINT32_C(0xb0b84127), UINT32_C(0x5a968154), UINT32_C(0xffd7132a),
+		UINT32_C(0xb3764986), UINT32_C(0x1637dbf8), UINT32_C(0xfc191b8b), UINT32_C(0x595889f5), UINT32_C(0x2da8ed9c), UINT32_C(0x88e97fe2), UINT32_C(0x62c7bf91), UINT32_C(0xc7862def),
+		UINT32_C(0xfb850ac9), UINT32_C(0x5ec498b7), UINT32_C(0xb4ea58c4), UINT32_C(0x11abcaba), UINT32_C(0x655baed3), UINT32_C(0xc01a3cad), UINT32_C(0x2a34fcde), UINT32_C(0x8f756ea0),
+		UINT32_C(0xc3d4340c), UINT32_C(0x6695a672), UINT32_C(0x8cbb6601), UINT32_C(0x29faf47f), UINT32_C(0x5d0a9016), UINT32_C(0xf84b0268), UINT32_C(0x1265c21b), UINT32_C(0xb7245065),
+		UINT32_C(0x6a638c57), UINT32_C(0xcf221e29), UINT32_C(0x250cde5a), UINT32_C(0x804d4c24), UINT32_C(0xf4bd284d), UINT32_C(0x51fcba33), UINT32_C(0xbbd27a40), UINT32_C(0x1e93e83e),
+		UINT32_C(0x5232b292), UINT32_C(0xf77320ec), UINT32_C(0x1d5de09f), UINT32_C(0xb81c72e1), UINT32_C(0xccec1688), UINT32_C(0x69ad84f6), UINT32_C(0x83834485), UINT32_C(0x26c2d6fb),
+		UINT32_C(0x1ac1f1dd), UINT32_C(0xbf8063a3), UINT32_C(0x55aea3d0), UINT32_C(0xf0ef31ae), UINT32_C(0x841f55c7), UINT32_C(0x215ec7b9), UINT32_C(0xcb7007ca), UINT32_C(0x6e3195b4),
+		UINT32_C(0x2290cf18), UINT32_C(0x87d15d66), UINT32_C(0x6dff9d15), UINT32_C(0xc8be0f6b), UINT32_C(0xbc4e6b02), UINT32_C(0x190ff97c), UINT32_C(0xf321390f), UINT32_C(0x5660ab71),
+		UINT32_C(0x4c42f79a), UINT32_C(0xe90365e4), UINT32_C(0x032da597), UINT32_C(0xa66c37e9), UINT32_C(0xd29c5380), UINT32_C(0x77ddc1fe), UINT32_C(0x9df3018d), UINT32_C(0x38b293f3),
+		UINT32_C(0x7413c95f), UINT32_C(0xd1525b21), UINT32_C(0x3b7c9b52), UINT32_C(0x9e3d092c), UINT32_C(0xeacd6d45), UINT32_C(0x4f8cff3b), UINT32_C(0xa5a23f48), UINT32_C(0x00e3ad36),
+		UINT32_C(0x3ce08a10), UINT32_C(0x99a1186e), UINT32_C(0x738fd81d), UINT32_C(0xd6ce4a63), UINT32_C(0xa23e2e0a), UINT32_C(0x077fbc74), UINT32_C(0xed517c07), UINT32_C(0x4810ee79),
+		UINT32_C(0x04b1b4d5), UINT32_C(0xa1f026ab), UINT32_C(0x4bdee6d8), UINT32_C(0xee9f74a6), UINT32_C(0x9a6f10cf), UINT32_C(0x3f2e82b1), UINT32_C(0xd50042c2), UINT32_C(0x7041d0bc),
+		UINT32_C(0xad060c8e), UINT32_C(0x08479ef0), UINT32_C(0xe2695e83), UINT32_C(0x4728ccfd), UINT32_C(0x33d8a894), UINT32_C(0x96993aea), UINT32_C(0x7cb7fa99), UINT32_C(0xd9f668e7),
+		UINT32_C(0x9557324b), UINT32_C(0x3016a035), UINT32_C(0xda386046), UINT32_C(0x7f79f238), UINT32_C(0x0b899651), UINT32_C(0xaec8042f), UINT32_C(0x44e6c45c), UINT32_C(0xe1a75622),
+		UINT32_C(0xdda47104), UINT32_C(0x78e5e37a), UINT32_C(0x92cb2309), UINT32_C(0x378ab177), UINT32_C(0x437ad51e), UINT32_C(0xe63b4760), UINT32_C(0x0c158713), UINT32_C(0xa954156d),
+		UINT32_C(0xe5f54fc1), UINT32_C(0x40b4ddbf), UINT32_C(0xaa9a1dcc), UINT32_C(0x0fdb8fb2), UINT32_C(0x7b2bebdb), UINT32_C(0xde6a79a5), UINT32_C(0x3444b9d6), UINT32_C(0x91052ba8),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xdd45aab8), UINT32_C(0xbf672381), UINT32_C(0x62228939), UINT32_C(0x7b2231f3), UINT32_C(0xa6679b4b), UINT32_C(0xc4451272), UINT32_C(0x1900b8ca),
+		UINT32_C(0xf64463e6), UINT32_C(0x2b01c95e), UINT32_C(0x49234067), UINT32_C(0x9466eadf), UINT32_C(0x8d665215), UINT32_C(0x5023f8ad), UINT32_C(0x32017194), UINT32_C(0xef44db2c),
+		UINT32_C(0xe964b13d), UINT32_C(0x34211b85), UINT32_C(0x560392bc), UINT32_C(0x8b463804), UINT32_C(0x924680ce), UINT32_C(0x4f032a76), UINT32_C(0x2d21a34f), UINT32_C(0xf06409f7),
+		UINT32_C(0x1f20d2db), UINT32_C(0xc2657863), UINT32_C(0xa047f15a), UINT32_C(0x7d025be2), UINT32_C(0x6402e328), UINT32_C(0xb9474990), UINT32_C(0xdb65c0a9), UINT32_C(0x06206a11),
+		UINT32_C(0xd725148b), UINT32_C(0x0a60be33), UINT32_C(0x6842370a), UINT32_C(0xb5079db2), UINT32_C(0xac072578), UINT32_C(0x71428fc0), UINT32_C(0x136006f9), UINT32_C(0xce25ac41),
+		UINT32_C(0x2161776d), UINT32_C(0xfc24ddd5), UINT32_C(0x9e0654ec), UINT32_C(0x4343fe54), UINT32_C(0x5a43469e), UINT32_C(0x8706ec26), UINT32_C(0xe524651f), UINT32_C(0x3861cfa7),
+		UINT32_C(0x3e41a5b6), UINT32_C(0xe3040f0e), UINT32_C(0x81268637), UINT32_C(0x5c632c8f), UINT32_C(0x45639445), UINT32_C(0x98263efd), UINT32_C(0xfa04b7c4), UINT32_C(0x27411d7c),
+		UINT32_C(0xc805c650), UINT32_C(0x15406ce8), UINT32_C(0x7762e5d1), UINT32_C(0xaa274f69), UINT32_C(0xb327f7a3), UINT32_C(0x6e625d1b), UINT32_C(0x0c40d422), UINT32_C(0xd1057e9a),
+		UINT32_C(0xaba65fe7), UINT32_C(0x76e3f55f), UINT32_C(0x14c17c66), UINT32_C(0xc984d6de), UINT32_C(0xd0846e14), UINT32_C(0x0dc1c4ac), UINT32_C(0x6fe34d95), UINT32_C(0xb2a6e72d),
+		UINT32_C(0x5de23c01), UINT32_C(0x80a796b9), UINT32_C(0xe2851f80), UINT32_C(0x3fc0b538), UINT32_C(0x26c00df2), UINT32_C(0xfb85a74a), UINT32_C(0x99a72e73), UINT32_C(0x44e284cb),
+		UINT32_C(0x42c2eeda), UINT32_C(0x9f874462), UINT32_C(0xfda5cd5b), UINT32_C(0x20e067e3), UINT32_C(0x39e0df29), UINT32_C(0xe4a57591), UINT32_C(0x8687fca8), UINT32_C(0x5bc25610),
+		UINT32_C(0xb4868d3c), UINT32_C(0x69c32784), UINT32_C(0x0be1aebd), UINT32_C(0xd6a40405), UINT32_C(0xcfa4bccf), UINT32_C(0x12e11677), UINT32_C(0x70c39f4e), UINT32_C(0xad8635f6),
+		UINT32_C(0x7c834b6c), UINT32_C(0xa1c6e1d4), UINT32_C(0xc3e468ed), UINT32_C(0x1ea1c255), UINT32_C(0x07a17a9f), UINT32_C(0xdae4d027), UINT32_C(0xb8c6591e), UINT32_C(0x6583f3a6),
+		UINT32_C(0x8ac7288a), UINT32_C(0x57828232), UINT32_C(0x35a00b0b), UINT32_C(0xe8e5a1b3), UINT32_C(0xf1e51979), UINT32_C(0x2ca0b3c1), UINT32_C(0x4e823af8), UINT32_C(0x93c79040),
+		UINT32_C(0x95e7fa51), UINT32_C(0x48a250e9), UINT32_C(0x2a80d9d0), UINT32_C(0xf7c57368), UINT32_C(0xeec5cba2), UINT32_C(0x3380611a), UINT32_C(0x51a2e823), UINT32_C(0x8ce7429b),
+		UINT32_C(0x63a399b7), UINT32_C(0xbee6330f), UINT32_C(0xdcc4ba36), UINT32_C(0x0181108e), UINT32_C(0x1881a844), UINT32_C(0xc5c402fc), UINT32_C(0xa7e68bc5), UINT32_C(0x7aa3217d),
+		UINT32_C(0x52a0c93f), UINT32_C(0x8fe56387), UINT32_C(0xedc7eabe), UINT32_C(0x30824006), UINT32_C(0x2982f8cc), UINT32_C(0xf4c75274), UINT32_C(0x96e5db4d), UINT32_C(0x4ba071f5),
+		UINT32_C(0xa4e4aad9), UINT32_C(0x79a10061), UINT32_C(0x1b838958), UINT32_C(0xc6c623e0), UINT32_C(0xdfc69b2a), UINT32_C(0x02833192), UINT32_C(0x60a1b8ab), UINT32_C(0xbde41213),
+		UINT32_C(0xbbc47802), UINT32_C(0x6681d2ba), UINT32_C(0x04a35b83), UINT32_C(0xd9e6f13b), UINT32_C(0xc0e649f1), UINT32_C(0x1da3e349), UINT32_C(0x7f816a70), UINT32_C(0xa2c4c0c8),
+		UINT32_C(0x4d801be4), UINT32_C(0x90c5b15c), UINT32_C(0xf2e73865), UINT32_C(0x2fa292dd), UINT32_C(0x36a22a17), UINT32_C(0xebe780af), UINT32_C(0x89c50996), UINT32_C(0x5480a32e),
+		UINT32_C(0x8585ddb4), UINT32_C(0x58c0770c), UINT32_C(0x3ae2fe35), UINT32_C(0xe7a7548d), UINT32_C(0xfea7ec47), UINT32_C(0x23e246ff), UINT32_C(0x41c0cfc6), UINT32_C(0x9c85657e),
+		UINT32_C(0x73c1be52), UINT32_C(0xae8414ea), UINT32_C(0xcca69dd3), UINT32_C(0x11e3376b), UINT32_C(0x08e38fa1), UINT32_C(0xd5a62519), UINT32_C(0xb784ac20), UINT32_C(0x6ac10698),
+		UINT32_C(0x6ce16c89), UINT32_C(0xb1a4c631), UINT32_C(0xd3864f08), UINT32_C(0x0ec3e5b0), UINT32_C(0x17c35d7a), UINT32_C(0xca86f7c2), UINT32_C(0xa8a47efb), UINT32_C(0x75e1d443),
+		UINT32_C(0x9aa50f6f), UINT32_C(0x47e0a5d7), UINT32_C(0x25c22cee), UINT32_C(0xf8878656), UINT32_C(0xe1873e9c), UINT32_C(0x3cc29424), UINT32_C(0x5ee01d1d), UINT32_C(0x83a5b7a5),
+		UINT32_C(0xf90696d8), UINT32_C(0x24433c60), UINT32_C(0x4661b559), UINT32_C(0x9b241fe1), UINT32_C(0x8224a72b), UINT32_C(0x5f610d93), UINT32_C(0x3d4384aa), UINT32_C(0xe0062e12),
+		UINT32_C(0x0f42f53e), UINT32_C(0xd2075f86), UINT32_C(0xb025d6bf), UINT32_C(0x6d607c07), UINT32_C(0x7460c4cd), UINT32_C(0xa9256e75), UINT32_C(0xcb07e74c), UINT32_C(0x16424df4),
+		UINT32_C(0x106227e5), UINT32_C(0xcd278d5d), UINT32_C(0xaf050464), UINT32_C(0x7240aedc), UINT32_C(0x6b401616), UINT32_C(0xb605bcae), UINT32_C(0xd4273597), UINT32_C(0x09629f2f),
+		UINT32_C(0xe6264403), UINT32_C(0x3b63eebb), UINT32_C(0x59416782), UINT32_C(0x8404cd3a), UINT32_C(0x9d0475f0), UINT32_C(0x4041df48), UINT32_C(0x22635671), UINT32_C(0xff26fcc9),
+		UINT32_C(0x2e238253), UINT32_C(0xf36628eb), UINT32_C(0x9144a1d2), UINT32_C(0x4c010b6a), UINT32_C(0x5501b3a0), UINT32_C(0x88441918), UINT32_C(0xea669021), UINT32_C(0x37233a99),
+		UINT32_C(0xd867e1b5), UINT32_C(0x05224b0d), UINT32_C(0x6700c234), UINT32_C(0xba45688c), UINT32_C(0xa345d046), UINT32_C(0x7e007afe), UINT32_C(0x1c22f3c7), UINT32_C(0xc167597f),
+		UINT32_C(0xc747336e), UINT32_C(0x1a0299d6), UINT32_C(0x782010ef), UINT32_C(0xa565ba57), UINT32_C(0xbc65029d), UINT32_C(0x6120a825), UINT32_C(0x0302211c), UINT32_C(0xde478ba4),
+		UINT32_C(0x31035088), UINT32_C(0xec46fa30), UINT32_C(0x8e647309), UINT32_C(0x5321d9b1), UINT32_C(0x4a21617b), UINT32_C(0x9764cbc3), UINT32_C(0xf54642fa), UINT32_C(0x2803e842),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0x38116fac), UINT32_C(0x7022df58), UINT32_C(0x4833b0f4), UINT32_C(0xe045beb0), UINT32_C(0xd854d11c), UINT32_C(0x906761e8), UINT32_C(0xa8760e44),
+		UINT32_C(0xc5670b91), UINT32_C(0xfd76643d), UINT32_C(0xb545d4c9), UINT32_C(0x8d54bb65), UINT32_C(0x2522b521), UINT32_C(0x1d33da8d), UINT32_C(0x55006a79), UINT32_C(0x6d1105d5),
+		UINT32_C(0x8f2261d3), UINT32_C(0xb7330e7f), UINT32_C(0xff00be8b), UINT32_C(0xc711d127), UINT32_C(0x6f67df63), UINT32_C(0x5776b0cf), UINT32_C(0x1f45003b), UINT32_C(0x27546f97),
+		UINT32_C(0x4a456a42), UINT32_C(0x725405ee), UINT32_C(0x3a67b51a), UINT32_C(0x0276dab6), UINT32_C(0xaa00d4f2), UINT32_C(0x9211bb5e), UINT32_C(0xda220baa), UINT32_C(0xe2336406),
+		UINT32_C(0x1ba8b557), UINT32_C(0x23b9dafb), UINT32_C(0x6b8a6a0f), UINT32_C(0x539b05a3), UINT32_C(0xfbed0be7), UINT32_C(0xc3fc644b), UINT32_C(0x8bcfd4bf), UINT32_C(0xb3debb13),
+		UINT32_C(0xdecfbec6), UINT32_C(0xe6ded16a), UINT32_C(0xaeed619e), UINT32_C(0x96fc0e32), UINT32_C(0x3e8a0076), UINT32_C(0x069b6fda), UINT32_C(0x4ea8df2e), UINT32_C(0x76b9b082),
+		UINT32_C(0x948ad484), UINT32_C(0xac9bbb28), UINT32_C(0xe4a80bdc), UINT32_C(0xdcb96470), UINT32_C(0x74cf6a34), UINT32_C(0x4cde0598), UINT32_C(0x04edb56c), UINT32_C(0x3cfcdac0),
+		UINT32_C(0x51eddf15), UINT32_C(0x69fcb0b9), UINT32_C(0x21cf004d), UINT32_C(0x19de6fe1), UINT32_C(0xb1a861a5), UINT32_C(0x89b90e09), UINT32_C(0xc18abefd), UINT32_C(0xf99bd151),
+		UINT32_C(0x37516aae), UINT32_C(0x0f400502), UINT32_C(0x4773b5f6), UINT32_C(0x7f62da5a), UINT32_C(0xd714d41e), UINT32_C(0xef05bbb2), UINT32_C(0xa7360b46), UINT32_C(0x9f2764ea),
+		UINT32_C(0xf236613f), UINT32_C(0xca270e93), UINT32_C(0x8214be67), UINT32_C(0xba05d1cb), UINT32_C(0x1273df8f), UINT32_C(0x2a62b023), UINT32_C(0x625100d7), UINT32_C(0x5a406f7b),
+		UINT32_C(0xb8730b7d), UINT32_C(0x806264d1), UINT32_C(0xc851d425), UINT32_C(0xf040bb89), UINT32_C(0x5836b5cd), UINT32_C(0x6027da61), UINT32_C(0x28146a95), UINT32_C(0x10050539),
+		UINT32_C(0x7d1400ec), UINT32_C(0x45056f40), UINT32_C(0x0d36dfb4), UINT32_C(0x3527b018), UINT32_C(0x9d51be5c), UINT32_C(0xa540d1f0), UINT32_C(0xed736104), UINT32_C(0xd5620ea8),
+		UINT32_C(0x2cf9dff9), UINT32_C(0x14e8b055), UINT32_C(0x5cdb00a1), UINT32_C(0x64ca6f0d), UINT32_C(0xccbc6149), UINT32_C(0xf4ad0ee5), UINT32_C(0xbc9ebe11), UINT32_C(0x848fd1bd),
+		UINT32_C(0xe99ed468), UINT32_C(0xd18fbbc4), UINT32_C(0x99bc0b30), UINT32_C(0xa1ad649c), UINT32_C(0x09db6ad8), UINT32_C(0x31ca0574), UINT32_C(0x79f9b580), UINT32_C(0x41e8da2c),
+		UINT32_C(0xa3dbbe2a), UINT32_C(0x9bcad186), UINT32_C(0xd3f96172), UINT32_C(0xebe80ede), UINT32_C(0x439e009a), UINT32_C(0x7b8f6f36), UINT32_C(0x33bcdfc2), UINT32_C(0x0badb06e),
+		UINT32_C(0x66bcb5bb), UINT32_C(0x5eadda17), UINT32_C(0x169e6ae3), UINT32_C(0x2e8f054f), UINT32_C(0x86f90b0b), UINT32_C(0xbee864a7), UINT32_C(0xf6dbd453), UINT32_C(0xcecabbff),
+		UINT32_C(0x6ea2d55c), UINT32_C(0x56b3baf0), UINT32_C(0x1e800a04), UINT32_C(0x269165a8), UINT32_C(0x8ee76bec), UINT32_C(0xb6f60440), UINT32_C(0xfec5b4b4), UINT32_C(0xc6d4db18),
+		UINT32_C(0xabc5decd), UINT32_C(0x93d4b161), UINT32_C(0xdbe70195), UINT32_C(0xe3f66e39), UINT32_C(0x4b80607d), UINT32_C(0x73910fd1), UINT32_C(0x3ba2bf25), UINT32_C(0x03b3d089),
+		UINT32_C(0xe180b48f), UINT32_C(0xd991db23), UINT32_C(0x91a26bd7), UINT32_C(0xa9b3047b), UINT32_C(0x01c50a3f), UINT32_C(0x39d46593), UINT32_C(0x71e7d567), UINT32_C(0x49f6bacb),
+		UINT32_C(0x24e7bf1e), UINT32_C(0x1cf6d0b2), UINT32_C(0x54c56046), UINT32_C(0x6cd40fea), UINT32_C(0xc4a201ae), UINT32_C(0xfcb36e02), UINT32_C(0xb480def6), UINT32_C(0x8c91b15a),
+		UINT32_C(0x750a600b), UINT32_C(0x4d1b0fa7), UINT32_C(0x0528bf53), UINT32_C(0x3d39d0ff), UINT32_C(0x954fdebb), UINT32_C(0xad5eb117), UINT32_C(0xe56d01e3), UINT32_C(0xdd7c6e4f),
+		UINT32_C(0xb06d6b9a), UINT32_C(0x887c0436), UINT32_C(0xc04fb4c2), UINT32_C(0xf85edb6e), UINT32_C(0x5028d52a), UINT32_C(0x6839ba86), UINT32_C(0x200a0a72), UINT32_C(0x181b65de),
+		UINT32_C(0xfa2801d8), UINT32_C(0xc2396e74), UINT32_C(0x8a0ade80), UINT32_C(0xb21bb12c), UINT32_C(0x1a6dbf68), UINT32_C(0x227cd0c4), UINT32_C(0x6a4f6030), UINT32_C(0x525e0f9c),
+		UINT32_C(0x3f4f0a49), UINT32_C(0x075e65e5), UINT32_C(0x4f6dd511), UINT32_C(0x777cbabd), UINT32_C(0xdf0ab4f9), UINT32_C(0xe71bdb55), UINT32_C(0xaf286ba1), UINT32_C(0x9739040d),
+		UINT32_C(0x59f3bff2), UINT32_C(0x61e2d05e), UINT32_C(0x29d160aa), UINT32_C(0x11c00f06), UINT32_C(0xb9b60142), UINT32_C(0x81a76eee), UINT32_C(0xc994de1a), UINT32_C(0xf185b1b6),
+		UINT32_C(0x9c94b463), UINT32_C(0xa485dbcf), UINT32_C(0xecb66b3b), UINT32_C(0xd4a70497), UINT32_C(0x7cd10ad3), UINT32_C(0x44c0657f), UINT32_C(0x0cf3d58b), UINT32_C(0x34e2ba27),
+		UINT32_C(0xd6d1de21), UINT32_C(0xeec0b18d), UINT32_C(0xa6f30179), UINT32_C(0x9ee26ed5), UINT32_C(0x36946091), UINT32_C(0x0e850f3d), UINT32_C(0x46b6bfc9), UINT32_C(0x7ea7d065),
+		UINT32_C(0x13b6d5b0), UINT32_C(0x2ba7ba1c), UINT32_C(0x63940ae8), UINT32_C(0x5b856544), UINT32_C(0xf3f36b00), UINT32_C(0xcbe204ac), UINT32_C(0x83d1b458), UINT32_C(0xbbc0dbf4),
+		UINT32_C(0x425b0aa5), UINT32_C(0x7a4a6509), UINT32_C(0x3279d5fd), UINT32_C(0x0a68ba51), UINT32_C(0xa21eb415), UINT32_C(0x9a0fdbb9), UINT32_C(0xd23c6b4d), UINT32_C(0xea2d04e1),
+		UINT32_C(0x873c0134), UINT32_C(0xbf2d6e98), UINT32_C(0xf71ede6c), UINT32_C(0xcf0fb1c0), UINT32_C(0x6779bf84), UINT32_C(0x5f68d028), UINT32_C(0x175b60dc), UINT32_C(0x2f4a0f70),
+		UINT32_C(0xcd796b76), UINT32_C(0xf56804da), UINT32_C(0xbd5bb42e), UINT32_C(0x854adb82), UINT32_C(0x2d3cd5c6), UINT32_C(0x152dba6a), UINT32_C(0x5d1e0a9e), UINT32_C(0x650f6532),
+		UINT32_C(0x081e60e7), UINT32_C(0x300f0f4b), UINT32_C(0x783cbfbf), UINT32_C(0x402dd013), UINT32_C(0xe85bde57), UINT32_C(0xd04ab1fb), UINT32_C(0x9879010f), UINT32_C(0xa0686ea3),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0xef306b19), UINT32_C(0xdb8ca0c3), UINT32_C(0x34bccbda), UINT32_C(0xb2f53777), UINT32_C(0x5dc55c6e), UINT32_C(0x697997b4), UINT32_C(0x8649fcad),
+		UINT32_C(0x6006181f), UINT32_C(0x8f367306), UINT32_C(0xbb8ab8dc), UINT32_C(0x54bad3c5), UINT32_C(0xd2f32f68), UINT32_C(0x3dc34471), UINT32_C(0x097f8fab), UINT32_C(0xe64fe4b2),
+		UINT32_C(0xc00c303e), UINT32_C(0x2f3c5b27), UINT32_C(0x1b8090fd), UINT32_C(0xf4b0fbe4), UINT32_C(0x72f90749), UINT32_C(0x9dc96c50), UINT32_C(0xa975a78a), UINT32_C(0x4645cc93),
+		UINT32_C(0xa00a2821), UINT32_C(0x4f3a4338), UINT32_C(0x7b8688e2), UINT32_C(0x94b6e3fb), UINT32_C(0x12ff1f56), UINT32_C(0xfdcf744f), UINT32_C(0xc973bf95), UINT32_C(0x2643d48c),
+		UINT32_C(0x85f4168d), UINT32_C(0x6ac47d94), UINT32_C(0x5e78b64e), UINT32_C(0xb148dd57), UINT32_C(0x370121fa), UINT32_C(0xd8314ae3), UINT32_C(0xec8d8139), UINT32_C(0x03bdea20),
+		UINT32_C(0xe5f20e92), UINT32_C(0x0ac2658b), UINT32_C(0x3e7eae51), UINT32_C(0xd14ec548), UINT32_C(0x570739e5), UINT32_C(0xb83752fc), UINT32_C(0x8c8b9926), UINT32_C(0x63bbf23f),
+		UINT32_C(0x45f826b3), UINT32_C(0xaac84daa), UINT32_C(0x9e748670), UINT32_C(0x7144ed69), UINT32_C(0xf70d11c4), UINT32_C(0x183d7add), UINT32_C(0x2c81b107), UINT32_C(0xc3b1da1e),
+		UINT32_C(0x25fe3eac), UINT32_C(0xcace55b5), UINT32_C(0xfe729e6f), UINT32_C(0x1142f576), UINT32_C(0x970b09db), UINT32_C(0x783b62c2), UINT32_C(0x4c87a918), UINT32_C(0xa3b7c201),
+		UINT32_C(0x0e045beb), UINT32_C(0xe13430f2), UINT32_C(0xd588fb28), UINT32_C(0x3ab89031), UINT32_C(0xbcf16c9c), UINT32_C(0x53c10785), UINT32_C(0x677dcc5f), UINT32_C(0x884da746),
+		UINT32_C(0x6e0243f4), UINT32_C(0x813228ed), UINT32_C(0xb58ee337), UINT32_C(0x5abe882e), UINT32_C(0xdcf77483), UINT32_C(0x33c71f9a), UINT32_C(0x077bd440), UINT32_C(0xe84bbf59),
+		UINT32_C(0xce086bd5), UINT32_C(0x213800cc), UINT32_C(0x1584cb16), UINT32_C(0xfab4a00f), UINT32_C(0x7cfd5ca2), UINT32_C(0x93cd37bb), UINT32_C(0xa771fc61), UINT32_C(0x48419778),
+		UINT32_C(0xae0e73ca), UINT32_C(0x413e18d3), UINT32_C(0x7582d309), UINT32_C(0x9ab2b810), UINT32_C(0x1cfb44bd), UINT32_C(0xf3cb2fa4), UINT32_C(0xc777e47e), UINT32_C(0x28478f67),
+		UINT32_C(0x8bf04d66), UINT32_C(0x64c0267f), UINT32_C(0x507ceda5), UINT32_C(0xbf4c86bc), UINT32_C(0x39057a11), UINT32_C(0xd6351108), UINT32_C(0xe289dad2), UINT32_C(0x0db9b1cb),
+		UINT32_C(0xebf65579), UINT32_C(0x04c63e60), UINT32_C(0x307af5ba), UINT32_C(0xdf4a9ea3), UINT32_C(0x5903620e), UINT32_C(0xb6330917), UINT32_C(0x828fc2cd), UINT32_C(0x6dbfa9d4),
+		UINT32_C(0x4bfc7d58), UINT32_C(0xa4cc1641), UINT32_C(0x9070dd9b), UINT32_C(0x7f40b682), UINT32_C(0xf9094a2f), UINT32_C(0x16392136), UINT32_C(0x2285eaec), UINT32_C(0xcdb581f5),
+		UINT32_C(0x2bfa6547), UINT32_C(0xc4ca0e5e), UINT32_C(0xf076c584), UINT32_C(0x1f46ae9d), UINT32_C(0x990f5230), UINT32_C(0x763f3929), UINT32_C(0x4283f2f3), UINT32_C(0xadb399ea),
+		UINT32_C(0x1c08b7d6), UINT32_C(0xf338dccf), UINT32_C(0xc7841715), UINT32_C(0x28b47c0c), UINT32_C(0xaefd80a1), UINT32_C(0x41cdebb8), UINT32_C(0x75712062), UINT32_C(0x9a414b7b),
+		UINT32_C(0x7c0eafc9), UINT32_C(0x933ec4d0), UINT32_C(0xa7820f0a), UINT32_C(0x48b26413), UINT32_C(0xcefb98be), UINT32_C(0x21cbf3a7), UINT32_C(0x1577387d), UINT32_C(0xfa475364),
+		UINT32_C(0xdc0487e8), UINT32_C(0x3334ecf1), UINT32_C(0x0788272b), UINT32_C(0xe8b84c32), UINT32_C(0x6ef1b09f), UINT32_C(0x81c1db86), UINT32_C(0xb57d105c), UINT32_C(0x5a4d7b45),
+		UINT32_C(0xbc029ff7), UINT32_C(0x5332f4ee), UINT32_C(0x678e3f34), UINT32_C(0x88be542d), UINT32_C(0x0ef7a880), UINT32_C(0xe1c7c399), UINT32_C(0xd57b0843), UINT32_C(0x3a4b635a),
+		UINT32_C(0x99fca15b), UINT32_C(0x76ccca42), UINT32_C(0x42700198), UINT32_C(0xad406a81), UINT32_C(0x2b09962c), UINT32_C(0xc439fd35), UINT32_C(0xf08536ef), UINT32_C(0x1fb55df6),
+		UINT32_C(0xf9fab944), UINT32_C(0x16cad25d), UINT32_C(0x22761987), UINT32_C(0xcd46729e), UINT32_C(0x4b0f8e33), UINT32_C(0xa43fe52a), UINT32_C(0x90832ef0), UINT32_C(0x7fb345e9),
+		UINT32_C(0x59f09165), UINT32_C(0xb6c0fa7c), UINT32_C(0x827c31a6), UINT32_C(0x6d4c5abf), UINT32_C(0xeb05a612), UINT32_C(0x0435cd0b), UINT32_C(0x308906d1), UINT32_C(0xdfb96dc8),
+		UINT32_C(0x39f6897a), UINT32_C(0xd6c6e263), UINT32_C(0xe27a29b9), UINT32_C(0x0d4a42a0), UINT32_C(0x8b03be0d), UINT32_C(0x6433d514), UINT32_C(0x508f1ece), UINT32_C(0xbfbf75d7),
+		UINT32_C(0x120cec3d), UINT32_C(0xfd3c8724), UINT32_C(0xc9804cfe), UINT32_C(0x26b027e7), UINT32_C(0xa0f9db4a), UINT32_C(0x4fc9b053), UINT32_C(0x7b757b89), UINT32_C(0x94451090),
+		UINT32_C(0x720af422), UINT32_C(0x9d3a9f3b), UINT32_C(0xa98654e1), UINT32_C(0x46b63ff8), UINT32_C(0xc0ffc355), UINT32_C(0x2fcfa84c), UINT32_C(0x1b736396), UINT32_C(0xf443088f),
+		UINT32_C(0xd200dc03), UINT32_C(0x3d30b71a), UINT32_C(0x098c7cc0), UINT32_C(0xe6bc17d9), UINT32_C(0x60f5eb74), UINT32_C(0x8fc5806d), UINT32_C(0xbb794bb7), UINT32_C(0x544920ae),
+		UINT32_C(0xb206c41c), UINT32_C(0x5d36af05), UINT32_C(0x698a64df), UINT32_C(0x86ba0fc6), UINT32_C(0x00f3f36b), UINT32_C(0xefc39872), UINT32_C(0xdb7f53a8), UINT32_C(0x344f38b1),
+		UINT32_C(0x97f8fab0), UINT32_C(0x78c891a9), UINT32_C(0x4c745a73), UINT32_C(0xa344316a), UINT32_C(0x250dcdc7), UINT32_C(0xca3da6de), UINT32_C(0xfe816d04), UINT32_C(0x11b1061d),
+		UINT32_C(0xf7fee2af), UINT32_C(0x18ce89b6), UINT32_C(0x2c72426c), UINT32_C(0xc3422975), UINT32_C(0x450bd5d8), UINT32_C(0xaa3bbec1), UINT32_C(0x9e87751b), UINT32_C(0x71b71e02),
+		UINT32_C(0x57f4ca8e), UINT32_C(0xb8c4a197), UINT32_C(0x8c786a4d), UINT32_C(0x63480154), UINT32_C(0xe501fdf9), UINT32_C(0x0a3196e0), UINT32_C(0x3e8d5d3a), UINT32_C(0xd1bd3623),
+		UINT32_C(0x37f2d291), UINT32_C(0xd8c2b988), UINT32_C(0xec7e7252), UINT32_C(0x034e194b), UINT32_C(0x8507e5e6), UINT32_C(0x6a378eff), UINT32_C(0x5e8b4525), UINT32_C(0xb1bb2e3c),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0x68032cc8), UINT32_C(0xd0065990), UINT32_C(0xb8057558), UINT32_C(0xa5e0c5d1), UINT32_C(0xcde3e919), UINT32_C(0x75e69c41), UINT32_C(0x1de5b089),
+		UINT32_C(0x4e2dfd53), UINT32_C(0x262ed19b), UINT32_C(0x9e2ba4c3), UINT32_C(0xf628880b), UINT32_C(0xebcd3882), UINT32_C(0x83ce144a), UINT32_C(0x3bcb6112), UINT32_C(0x53c84dda),
+		UINT32_C(0x9c5bfaa6), UINT32_C(0xf458d66e), UINT32_C(0x4c5da336), UINT32_C(0x245e8ffe), UINT32_C(0x39bb3f77), UINT32_C(0x51b813bf), UINT32_C(0xe9bd66e7), UINT32_C(0x81be4a2f),
+		UINT32_C(0xd27607f5), UINT32_C(0xba752b3d), UINT32_C(0x02705e65), UINT32_C(0x6a7372ad), UINT32_C(0x7796c224), UINT32_C(0x1f95eeec), UINT32_C(0xa7909bb4), UINT32_C(0xcf93b77c),
+		UINT32_C(0x3d5b83bd), UINT32_C(0x5558af75), UINT32_C(0xed5dda2d), UINT32_C(0x855ef6e5), UINT32_C(0x98bb466c), UINT32_C(0xf0b86aa4), UINT32_C(0x48bd1ffc), UINT32_C(0x20be3334),
+		UINT32_C(0x73767eee), UINT32_C(0x1b755226), UINT32_C(0xa370277e), UINT32_C(0xcb730bb6), UINT32_C(0xd696bb3f), UINT32_C(0xbe9597f7), UINT32_C(0x0690e2af), UINT32_C(0x6e93ce67),
+		UINT32_C(0xa100791b), UINT32_C(0xc90355d3), UINT32_C(0x7106208b), UINT32_C(0x19050c43), UINT32_C(0x04e0bcca), UINT32_C(0x6ce39002), UINT32_C(0xd4e6e55a), UINT32_C(0xbce5c992),
+		UINT32_C(0xef2d8448), UINT32_C(0x872ea880), UINT32_C(0x3f2bddd8), UINT32_C(0x5728f110), UINT32_C(0x4acd4199), UINT32_C(0x22ce6d51), UINT32_C(0x9acb1809), UINT32_C(0xf2c834c1),
+		UINT32_C(0x7ab7077a), UINT32_C(0x12b42bb2), UINT32_C(0xaab15eea), UINT32_C(0xc2b27222), UINT32_C(0xdf57c2ab), UINT32_C(0xb754ee63), UINT32_C(0x0f519b3b), UINT32_C(0x6752b7f3),
+		UINT32_C(0x349afa29), UINT32_C(0x5c99d6e1), UINT32_C(0xe49ca3b9), UINT32_C(0x8c9f8f71), UINT32_C(0x917a3ff8), UINT32_C(0xf9791330), UINT32_C(0x417c6668), UINT32_C(0x297f4aa0),
+		UINT32_C(0xe6ecfddc), UINT32_C(0x8eefd114), UINT32_C(0x36eaa44c), UINT32_C(0x5ee98884), UINT32_C(0x430c380d), UINT32_C(0x2b0f14c5), UINT32_C(0x930a619d), UINT32_C(0xfb094d55),
+		UINT32_C(0xa8c1008f), UINT32_C(0xc0c22c47), UINT32_C(0x78c7591f), UINT32_C(0x10c475d7), UINT32_C(0x0d21c55e), UINT32_C(0x6522e996), UINT32_C(0xdd279cce), UINT32_C(0xb524b006),
+		UINT32_C(0x47ec84c7), UINT32_C(0x2fefa80f), UINT32_C(0x97eadd57), UINT32_C(0xffe9f19f), UINT32_C(0xe20c4116), UINT32_C(0x8a0f6dde), UINT32_C(0x320a1886), UINT32_C(0x5a09344e),
+		UINT32_C(0x09c17994), UINT32_C(0x61c2555c), UINT32_C(0xd9c72004), UINT32_C(0xb1c40ccc), UINT32_C(0xac21bc45), UINT32_C(0xc422908d), UINT32_C(0x7c27e5d5), UINT32_C(0x1424c91d),
+		UINT32_C(0xdbb77e61), UINT32_C(0xb3b452a9), UINT32_C(0x0bb127f1), UINT32_C(0x63b20b39), UINT32_C(0x7e57bbb0), UINT32_C(0x16549778), UINT32_C(0xae51e220), UINT32_C(0xc652cee8),
+		UINT32_C(0x959a8332), UINT32_C(0xfd99affa), UINT32_C(0x459cdaa2), UINT32_C(0x2d9ff66a), UINT32_C(0x307a46e3), UINT32_C(0x58796a2b), UINT32_C(0xe07c1f73), UINT32_C(0x887f33bb),
+		UINT32_C(0xf56e0ef4), UINT32_C(0x9d6d223c), UINT32_C(0x25685764), UINT32_C(0x4d6b7bac), UINT32_C(0x508ecb25), UINT32_C(0x388de7ed), UINT32_C(0x808892b5), UINT32_C(0xe88bbe7d),
+		UINT32_C(0xbb43f3a7), UINT32_C(0xd340df6f), UINT32_C(0x6b45aa37), UINT32_C(0x034686ff), UINT32_C(0x1ea33676), UINT32_C(0x76a01abe), UINT32_C(0xcea56fe6), UINT32_C(0xa6a6432e),
+		UINT32_C(0x6935f452), UINT32_C(0x0136d89a), UINT32_C(0xb933adc2), UINT32_C(0xd130810a), UINT32_C(0xccd53183), UINT32_C(0xa4d61d4b), UINT32_C(0x1cd36813), UINT32_C(0x74d044db),
+		UINT32_C(0x27180901), UINT32_C(0x4f1b25c9), UINT32_C(0xf71e5091), UINT32_C(0x9f1d7c59), UINT32_C(0x82f8ccd0), UINT32_C(0xeafbe018), UINT32_C(0x52fe9540), UINT32_C(0x3afdb988),
+		UINT32_C(0xc8358d49), UINT32_C(0xa036a181), UINT32_C(0x1833d4d9), UINT32_C(0x7030f811), UINT32_C(0x6dd54898), UINT32_C(0x05d66450), UINT32_C(0xbdd31108), UINT32_C(0xd5d03dc0),
+		UINT32_C(0x8618701a), UINT32_C(0xee1b5cd2), UINT32_C(0x561e298a), UINT32_C(0x3e1d0542), UINT32_C(0x23f8b5cb), UINT32_C(0x4bfb9903), UINT32_C(0xf3feec5b), UINT32_C(0x9bfdc093),
+		UINT32_C(0x546e77ef), UINT32_C(0x3c6d5b27), UINT32_C(0x84682e7f), UINT32_C(0xec6b02b7), UINT32_C(0xf18eb23e), UINT32_C(0x998d9ef6), UINT32_C(0x2188ebae), UINT32_C(0x498bc766),
+		UINT32_C(0x1a438abc), UINT32_C(0x7240a674), UINT32_C(0xca45d32c), UINT32_C(0xa246ffe4), UINT32_C(0xbfa34f6d), UINT32_C(0xd7a063a5), UINT32_C(0x6fa516fd), UINT32_C(0x07a63a35),
+		UINT32_C(0x8fd9098e), UINT32_C(0xe7da2546), UINT32_C(0x5fdf501e), UINT32_C(0x37dc7cd6), UINT32_C(0x2a39cc5f), UINT32_C(0x423ae097), UINT32_C(0xfa3f95cf), UINT32_C(0x923cb907),
+		UINT32_C(0xc1f4f4dd), UINT32_C(0xa9f7d815), UINT32_C(0x11f2ad4d), UINT32_C(0x79f18185), UINT32_C(0x6414310c), UINT32_C(0x0c171dc4), UINT32_C(0xb412689c), UINT32_C(0xdc114454),
+		UINT32_C(0x1382f328), UINT32_C(0x7b81dfe0), UINT32_C(0xc384aab8), UINT32_C(0xab878670), UINT32_C(0xb66236f9), UINT32_C(0xde611a31), UINT32_C(0x66646f69), UINT32_C(0x0e6743a1),
+		UINT32_C(0x5daf0e7b), UINT32_C(0x35ac22b3), UINT32_C(0x8da957eb), UINT32_C(0xe5aa7b23), UINT32_C(0xf84fcbaa), UINT32_C(0x904ce762), UINT32_C(0x2849923a), UINT32_C(0x404abef2),
+		UINT32_C(0xb2828a33), UINT32_C(0xda81a6fb), UINT32_C(0x6284d3a3), UINT32_C(0x0a87ff6b), UINT32_C(0x17624fe2), UINT32_C(0x7f61632a), UINT32_C(0xc7641672), UINT32_C(0xaf673aba),
+		UINT32_C(0xfcaf7760), UINT32_C(0x94ac5ba8), UINT32_C(0x2ca92ef0), UINT32_C(0x44aa0238), UINT32_C(0x594fb2b1), UINT32_C(0x314c9e79), UINT32_C(0x8949eb21), UINT32_C(0xe14ac7e9),
+		UINT32_C(0x2ed97095), UINT32_C(0x46da5c5d), UINT32_C(0xfedf2905), UINT32_C(0x96dc05cd), UINT32_C(0x8b39b544), UINT32_C(0xe33a998c), UINT32_C(0x5b3fecd4), UINT32_C(0x333cc01c),
+		UINT32_C(0x60f48dc6), UINT32_C(0x08f7a10e), UINT32_C(0xb0f2d456), UINT32_C(0xd8f1f89e), UINT32_C(0xc5144817), UINT32_C(0xad1764df), UINT32_C(0x15121187), UINT32_C(0x7d113d4f),
+	},
+	{
+		UINT32_C(0x00000000), UINT32_C(0x493c7d27), UINT32_C(0x9278fa4e), UINT32_C(0xdb448769), UINT32_C(0x211d826d), UINT32_C(0x6821ff4a), UINT32_C(0xb3657823), UINT32_C(0xfa590504),
+		UINT32_C(0x423b04da), UINT32_C(0x0b0779fd), UINT32_C(0xd043fe94), UINT32_C(0x997f83b3), UINT32_C(0x632686b7), UINT32_C(0x2a1afb90), UINT32_C(0xf15e7cf9), UINT32_C(0xb86201de),
+		UINT32_C(0x847609b4), UINT32_C(0xcd4a7493), UINT32_C(0x160ef3fa), UINT32_C(0x5f328edd), UINT32_C(0xa56b8bd9), UINT32_C(0xec57f6fe), UINT32_C(0x37137197), UINT32_C(0x7e2f0cb0),
+		UINT32_C(0xc64d0d6e), UINT32_C(0x8f717049), UINT32_C(0x5435f720), UINT32_C(0x1d098a07), UINT32_C(0xe7508f03), UINT32_C(0xae6cf224), UINT32_C(0x7528754d), UINT32_C(0x3c14086a),
+		UINT32_C(0x0d006599), UINT32_C(0x443c18be), UINT32_C(0x9f789fd7), UINT32_C(0xd644e2f0), UINT32_C(0x2c1de7f4), UINT32_C(0x65219ad3), UINT32_C(0xbe651dba), UINT32_C(0xf759609d),
+		UINT32_C(0x4f3b6143), UINT32_C(0x06071c64), UINT32_C(0xdd439b0d), UINT32_C(0x947fe62a), UINT32_C(0x6e26e32e), UINT32_C(0x271a9e09), UINT32_C(0xfc5e1960), UINT32_C(0xb5626447),
+		UINT32_C(0x89766c2d), UINT32_C(0xc04a110a), UINT32_C(0x1b0e9663), UINT32_C(0x5232eb44), UINT32_C(0xa86bee40), UINT32_C(0xe1579367), UINT32_C(0x3a13140e), UINT32_C(0x732f6929),
+		UINT32_C(0xcb4d68f7), UINT32_C(0x827115d0), UINT32_C(0x593592b9), UINT32_C(0x1009ef9e), UINT32_C(0xea50ea9a), UINT32_C(0xa36c97bd), UINT32_C(0x782810d4), UINT32_C(0x31146df3),
+		UINT32_C(0x1a00cb32), UINT32_C(0x533cb615), UINT32_C(0x8878317c), UINT32_C(0xc1444c5b), UINT32_C(0x3b1d495f), UINT32_C(0x72213478), UINT32_C(0xa965b311), UINT32_C(0xe059ce36),
+		UINT32_C(0x583bcfe8), UINT32_C(0x1107b2cf), UINT32_C(0xca4335a6), UINT32_C(0x837f4881), UINT32_C(0x79264d85), UINT32_C(0x301a30a2), UINT32_C(0xeb5eb7cb), UINT32_C(0xa262caec),
+		UINT32_C(0x9e76c286), UINT32_C(0xd74abfa1), UINT32_C(0x0c0e38c8), UINT32_C(0x453245ef), UINT32_C(0xbf6b40eb), UINT32_C(0xf6573dcc), UINT32_C(0x2d13baa5), UINT32_C(0x642fc782),
+		UINT32_C(0xdc4dc65c), UINT32_C(0x9571bb7b), UINT32_C(0x4e353c12), UINT32_C(0x07094135), UINT32_C(0xfd504431), UINT32_C(0xb46c3916), UINT32_C(0x6f28be7f), UINT32_C(0x2614c358),
+		UINT32_C(0x1700aeab), UINT32_C(0x5e3cd38c), UINT32_C(0x857854e5), UINT32_C(0xcc4429c2), UINT32_C(0x361d2cc6), UINT32_C(0x7f2151e1), UINT32_C(0xa465d688), UINT32_C(0xed59abaf),
+		UINT32_C(0x553baa71), UINT32_C(0x1c07d756), UINT32_C(0xc743503f), UINT32_C(0x8e7f2d18), UINT32_C(0x7426281c), UINT32_C(0x3d1a553b), UINT32_C(0xe65ed252), UINT32_C(0xaf62af75),
+		UINT32_C(0x9376a71f), UINT32_C(0xda4ada38), UINT32_C(0x010e5d51), UINT32_C(0x48322076), UINT32_C(0xb26b2572), UINT32_C(0xfb575855), UINT32_C(0x2013df3c), UINT32_C(0x692fa21b),
+		UINT32_C(0xd14da3c5), UINT32_C(0x9871dee2), UINT32_C(0x4335598b), UINT32_C(0x0a0924ac), UINT32_C(0xf05021a8), UINT32_C(0xb96c5c8f), UINT32_C(0x6228dbe6), UINT32_C(0x2b14a6c1),
+		UINT32_C(0x34019664), UINT32_C(0x7d3deb43), UINT32_C(0xa6796c2a), UINT32_C(0xef45110d), UINT32_C(0x151c1409), UINT32_C(0x5c20692e), UINT32_C(0x8764ee47), UINT32_C(0xce589360),
+		UINT32_C(0x763a92be), UINT32_C(0x3f06ef99), UINT32_C(0xe44268f0), UINT32_C(0xad7e15d7), UINT32_C(0x572710d3), UINT32_C(0x1e1b6df4), UINT32_C(0xc55fea9d), UINT32_C(0x8c6397ba),
+		UINT32_C(0xb0779fd0), UINT32_C(0xf94be2f7), UINT32_C(0x220f659e), UINT32_C(0x6b3318b9), UINT32_C(0x916a1dbd), UINT32_C(0xd856609a), UINT32_C(0x0312e7f3), UINT32_C(0x4a2e9ad4),
+		UINT32_C(0xf24c9b0a), UINT32_C(0xbb70e62d), UINT32_C(0x60346144), UINT32_C(0x29081c63), UINT32_C(0xd3511967), UINT32_C(0x9a6d6440), UINT32_C(0x4129e329), UINT32_C(0x08159e0e),
+		UINT32_C(0x3901f3fd), UINT32_C(0x703d8eda), UINT32_C(0xab7909b3), UINT32_C(0xe2457494), UINT32_C(0x181c7190), UINT32_C(0x51200cb7), UINT32_C(0x8a648bde), UINT32_C(0xc358f6f9),
+		UINT32_C(0x7b3af727), UINT32_C(0x32068a00), UINT32_C(0xe9420d69), UINT32_C(0xa07e704e), UINT32_C(0x5a27754a), UINT32_C(0x131b086d), UINT32_C(0xc85f8f04), UINT32_C(0x8163f223),
+		UINT32_C(0xbd77fa49), UINT32_C(0xf44b876e), UINT32_C(0x2f0f0007), UINT32_C(0x66337d20), UINT32_C(0x9c6a7824), UINT32_C(0xd5560503), UINT32_C(0x0e12826a), UINT32_C(0x472eff4d),
+		UINT32_C(0xff4cfe93), UINT32_C(0xb67083b4), UINT32_C(0x6d3404dd), UINT32_C(0x240879fa), UINT32_C(0xde517cfe), UINT32_C(0x976d01d9), UINT32_C(0x4c2986b0), UINT32_C(0x0515fb97),
+		UINT32_C(0x2e015d56), UINT32_C(0x673d2071), UINT32_C(0xbc79a718), UINT32_C(0xf545da3f), UINT32_C(0x0f1cdf3b), UINT32_C(0x4620a21c), UINT32_C(0x9d642575), UINT32_C(0xd4585852),
+		UINT32_C(0x6c3a598c), UINT32_C(0x250624ab), UINT32_C(0xfe42a3c2), UINT32_C(0xb77edee5), UINT32_C(0x4d27dbe1), UINT32_C(0x041ba6c6), UINT32_C(0xdf5f21af), UINT32_C(0x96635c88),
+		UINT32_C(0xaa7754e2), UINT32_C(0xe34b29c5), UINT32_C(0x380faeac), UINT32_C(0x7133d38b), UINT32_C(0x8b6ad68f), UINT32_C(0xc256aba8), UINT32_C(0x19122cc1), UINT32_C(0x502e51e6),
+		UINT32_C(0xe84c5038), UINT32_C(0xa1702d1f), UINT32_C(0x7a34aa76), UINT32_C(0x3308d751), UINT32_C(0xc951d255), UINT32_C(0x806daf72), UINT32_C(0x5b29281b), UINT32_C(0x1215553c),
+		UINT32_C(0x230138cf), UINT32_C(0x6a3d45e8), UINT32_C(0xb179c281), UINT32_C(0xf845bfa6), UINT32_C(0x021cbaa2), UINT32_C(0x4b20c785), UINT32_C(0x906440ec), UINT32_C(0xd9583dcb),
+		UINT32_C(0x613a3c15), UINT32_C(0x28064132), UINT32_C(0xf342c65b), UINT32_C(0xba7ebb7c), UINT32_C(0x4027be78), UINT32_C(0x091bc35f), UINT32_C(0xd25f4436), UINT32_C(0x9b633911),
+		UINT32_C(0xa777317b), UINT32_C(0xee4b4c5c), UINT32_C(0x350fcb35), UINT32_C(0x7c33b612), UINT32_C(0x866ab316), UINT32_C(0xcf56ce31), UINT32_C(0x14124958), UINT32_C(0x5d2e347f),
+		UINT32_C(0xe54c35a1), UINT32_C(0xac704886), UINT32_C(0x7734cfef), UINT32_C(0x3e08b2c8), UINT32_C(0xc451b7cc), UINT32_C(0x8d6dcaeb), UINT32_C(0x56294d82), UINT32_C(0x1f1530a5),
+	},
+}
@@ -0,0 +1,240 @@
+{
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x54e979925cd0f10d), UINT64_C(0xa9d2f324b9a1e21a), UINT64_C(0xfd3b8ab6e5711317), UINT64_C(0xc17d4962dc4ddab1), UINT64_C(0x959430f0809d2bbc), UINT64_C(0x68afba4665ec38ab), UINT64_C(0x3c46c3d4393cc9a6),
+		UINT64_C(0x10223dee1795abe7), UINT64_C(0x44cb447c4b455aea), UINT64_C(0xb9f0cecaae3449fd), UINT64_C(0xed19b758f2e4b8f0), UINT64_C(0xd15f748ccbd87156), UINT64_C(0x85b60d1e9708805b), UINT64_C(0x788d87a87279934c), UINT64_C(0x2c64fe3a2ea96241),
+		UINT64_C(0x20447bdc2f2b57ce), UINT64_C(0x74ad024e73fba6c3), UINT64_C(0x899688f8968ab5d4), UINT64_C(0xdd7ff16aca5a44d9), UINT64_C(0xe13932bef3668d7f), UINT64_C(0xb5d04b2cafb67c72), UINT64_C(0x48ebc19a4ac76f65), UINT64_C(0x1c02b80816179e68),
+		UINT64_C(0x3066463238befc29), UINT64_C(0x648f3fa0646e0d24), UINT64_C(0x99b4b516811f1e33), UINT64_C(0xcd5dcc84ddcfef3e), UINT64_C(0xf11b0f50e4f32698), UINT64_C(0xa5f276c2b823d795), UINT64_C(0x58c9fc745d52c482), UINT64_C(0x0c2085e60182358f),
+		UINT64_C(0x4088f7b85e56af9c), UINT64_C(0x14618e2a02865e91), UINT64_C(0xe95a049ce7f74d86), UINT64_C(0xbdb37d0ebb27bc8b), UINT64_C(0x81f5beda821b752d), UINT64_C(0xd51cc748decb8420), UINT64_C(0x28274dfe3bba9737), UINT64_C(0x7cce346c676a663a),
+		UINT64_C(0x50aaca5649c3047b), UINT64_C(0x0443b3c41513f576), UINT64_C(0xf9783972f062e661), UINT64_C(0xad9140e0acb2176c), UINT64_C(0x91d78334958edeca), UINT64_C(0xc53efaa6c95e2fc7), UINT64_C(0x380570102c2f3cd0), UINT64_C(0x6cec098270ffcddd),
+		UINT64_C(0x60cc8c64717df852), UINT64_C(0x3425f5f62dad095f), UINT64_C(0xc91e7f40c8dc1a48), UINT64_C(0x9df706d2940ceb45), UINT64_C(0xa1b1c506ad3022e3), UINT64_C(0xf558bc94f1e0d3ee), UINT64_C(0x086336221491c0f9), UINT64_C(0x5c8a4fb0484131f4),
+		UINT64_C(0x70eeb18a66e853b5), UINT64_C(0x2407c8183a38a2b8), UINT64_C(0xd93c42aedf49b1af), UINT64_C(0x8dd53b3c839940a2), UINT64_C(0xb193f8e8baa58904), UINT64_C(0xe57a817ae6757809), UINT64_C(0x18410bcc03046b1e), UINT64_C(0x4ca8725e5fd49a13),
+		UINT64_C(0x8111ef70bcad5f38), UINT64_C(0xd5f896e2e07dae35), UINT64_C(0x28c31c54050cbd22), UINT64_C(0x7c2a65c659dc4c2f), UINT64_C(0x406ca61260e08589), UINT64_C(0x1485df803c307484), UINT64_C(0xe9be5536d9416793), UINT64_C(0xbd572ca48591969e),
+		UINT64_C(0x9133d29eab38f4df), UINT64_C(0xc5daab0cf7e805d2), UINT64_C(0x38e121ba129916c5), UINT64_C(0x6c0858284e49e7c8), UINT64_C(0x504e9bfc77752e6e), UINT64_C(0x04a7e26e2ba5df63), UINT64_C(0xf99c68d8ced4cc74), UINT64_C(0xad75114a92043d79),
+		UINT64_C(0xa15594ac938608f6), UINT64_C(0xf5bced3ecf56f9fb), UINT64_C(0x088767882a27eaec), UINT64_C(0x5c6e1e1a76f71be1), UINT64_C(0x6028ddce4fcbd247), UINT64_C(0x34c1a45c131b234a), UINT64_C(0xc9fa2eeaf66a305d), UINT64_C(0x9d135778aabac150),
+		UINT64_C(0xb177a9428413a311), UINT64_C(0xe59ed0d0d8c3521c), UINT64_C(0x18a55a663db2410b), UINT64_C(0x4c4c23f46162b006), UINT64_C(0x700ae020585e79a0), UINT64_C(0x24e399b2048e88ad), UINT64_C(0xd9d81304e1ff9bba), UINT64_C(0x8d316a96bd2f6ab7),
+		UINT64_C(0xc19918c8e2fbf0a4), UINT64_C(0x9570615abe2b01a9), UINT64_C(0x684bebec5b5a12be), UINT64_C(0x3ca2927e078ae3b3), UINT64_C(0x00e451aa3eb62a15), UINT64_C(0x540d28386266db18), UINT64_C(0xa936a28e8717c80f), UINT64_C(0xfddfdb1cdbc73902),
+		UINT64_C(0xd1bb2526f56e5b43), UINT64_C(0x85525cb4a9beaa4e), UINT64_C(0x7869d6024ccfb959), UINT64_C(0x2c80af90101f4854), UINT64_C(0x10c66c44292381f2), UINT64_C(0x442f15d675f370ff), UINT64_C(0xb9149f60908263e8), UINT64_C(0xedfde6f2cc5292e5),
+		UINT64_C(0xe1dd6314cdd0a76a), UINT64_C(0xb5341a8691005667), UINT64_C(0x480f903074714570), UINT64_C(0x1ce6e9a228a1b47d), UINT64_C(0x20a02a76119d7ddb), UINT64_C(0x744953e44d4d8cd6), UINT64_C(0x8972d952a83c9fc1), UINT64_C(0xdd9ba0c0f4ec6ecc),
+		UINT64_C(0xf1ff5efada450c8d), UINT64_C(0xa51627688695fd80), UINT64_C(0x582dadde63e4ee97), UINT64_C(0x0cc4d44c3f341f9a), UINT64_C(0x308217980608d63c), UINT64_C(0x646b6e0a5ad82731), UINT64_C(0x9950e4bcbfa93426), UINT64_C(0xcdb99d2ee379c52b),
+		UINT64_C(0x90fb71cad654a0f5), UINT64_C(0xc41208588a8451f8), UINT64_C(0x392982ee6ff542ef), UINT64_C(0x6dc0fb7c3325b3e2), UINT64_C(0x518638a80a197a44), UINT64_C(0x056f413a56c98b49), UINT64_C(0xf854cb8cb3b8985e), UINT64_C(0xacbdb21eef686953),
+		UINT64_C(0x80d94c24c1c10b12), UINT64_C(0xd43035b69d11fa1f), UINT64_C(0x290bbf007860e908), UINT64_C(0x7de2c69224b01805), UINT64_C(0x41a405461d8cd1a3), UINT64_C(0x154d7cd4415c20ae), UINT64_C(0xe876f662a42d33b9), UINT64_C(0xbc9f8ff0f8fdc2b4),
+		UINT64_C(0xb0bf0a16f97ff73b), UINT64_C(0xe4567384a5af0636), UINT64_C(0x196df93240de1521), UINT64_C(0x4d8480a01c0ee42c), UINT64_C(0x71c2437425322d8a), UINT64_C(0x252b3ae679e2dc87), UINT64_C(0xd810b0509c93cf90), UINT64_C(0x8cf9c9c2c0433e9d),
+		UINT64_C(0xa09d37f8eeea5cdc), UINT64_C(0xf4744e6ab23aadd1), UINT64_C(0x094fc4dc574bbec6), UINT64_C(0x5da6bd4e0b9b4fcb), UINT64_C(0x61e07e9a32a7866d), UINT64_C(0x350907086e777760), UINT64_C(0xc8328dbe8b066477), UINT64_C(0x9cdbf42cd7d6957a),
+		UINT64_C(0xd073867288020f69), UINT64_C(0x849affe0d4d2fe64), UINT64_C(0x79a1755631a3ed73), UINT64_C(0x2d480cc46d731c7e), UINT64_C(0x110ecf10544fd5d8), UINT64_C(0x45e7b682089f24d5), UINT64_C(0xb8dc3c34edee37c2), UINT64_C(0xec3545a6b13ec6cf),
+		UINT64_C(0xc051bb9c9f97a48e), UINT64_C(0x94b8c20ec3475583), UINT64_C(0x698348b826364694), UINT64_C(0x3d6a312a7ae6b799), UINT64_C(0x012cf2fe43da7e3f), UINT64_C(0x55c58b6c1f0a8f32), UINT64_C(0xa8fe01dafa7b9c25), UINT64_C(0xfc177848a6ab6d28),
+		UINT64_C(0xf037fdaea72958a7), UINT64_C(0xa4de843cfbf9a9aa), UINT64_C(0x59e50e8a1e88babd), UINT64_C(0x0d0c771842584bb0), UINT64_C(0x314ab4cc7b648216), UINT64_C(0x65a3cd5e27b4731b), UINT64_C(0x989847e8c2c5600c), UINT64_C(0xcc713e7a9e159101),
+		UINT64_C(0xe015c040b0bcf340), UINT64_C(0xb4fcb9d2ec6c024d), UINT64_C(0x49c73364091d115a), UINT64_C(0x1d2e4af655cde057), UINT64_C(0x216889226cf129f1), UINT64_C(0x7581f0b03021d8fc), UINT64_C(0x88ba7a06d550cbeb), UINT64_C(0xdc53039489803ae6),
+		UINT64_C(0x11ea9eba6af9ffcd), UINT64_C(0x4503e72836290ec0), UINT64_C(0xb8386d9ed3581dd7), UINT64_C(0xecd1140c8f88ecda), UINT64_C(0xd097d7d8b6b4257c), UINT64_C(0x847eae4aea64d471), UINT64_C(0x794524fc0f15c766), UINT64_C(0x2dac5d6e53c5366b),
+		UINT64_C(0x01c8a3547d6c542a), UINT64_C(0x5521dac621bca527), UINT64_C(0xa81a5070c4cdb630), UINT64_C(0xfcf329e2981d473d), UINT64_C(0xc0b5ea36a1218e9b), UINT64_C(0x945c93a4fdf17f96), UINT64_C(0x6967191218806c81), UINT64_C(0x3d8e608044509d8c),
+		UINT64_C(0x31aee56645d2a803), UINT64_C(0x65479cf41902590e), UINT64_C(0x987c1642fc734a19), UINT64_C(0xcc956fd0a0a3bb14), UINT64_C(0xf0d3ac04999f72b2), UINT64_C(0xa43ad596c54f83bf), UINT64_C(0x59015f20203e90a8), UINT64_C(0x0de826b27cee61a5),
+		UINT64_C(0x218cd888524703e4), UINT64_C(0x7565a11a0e97f2e9), UINT64_C(0x885e2bacebe6e1fe), UINT64_C(0xdcb7523eb73610f3), UINT64_C(0xe0f191ea8e0ad955), UINT64_C(0xb418e878d2da2858), UINT64_C(0x492362ce37ab3b4f), UINT64_C(0x1dca1b5c6b7bca42),
+		UINT64_C(0x5162690234af5051), UINT64_C(0x058b1090687fa15c), UINT64_C(0xf8b09a268d0eb24b), UINT64_C(0xac59e3b4d1de4346), UINT64_C(0x901f2060e8e28ae0), UINT64_C(0xc4f659f2b4327bed), UINT64_C(0x39cdd344514368fa), UINT64_C(0x6d24aad60d9399f7),
+		UINT64_C(0x414054ec233afbb6), UINT64_C(0x15a92d7e7fea0abb), UINT64_C(0xe892a7c89a9b19ac), UINT64_C(0xbc7bde5ac64be8a1), UINT64_C(0x803d1d8eff772107), UINT64_C(0xd4d4641ca3a7d00a), UINT64_C(0x29efeeaa46d6c31d), UINT64_C(0x7d0697381a063210),
+		UINT64_C(0x712612de1b84079f), UINT64_C(0x25cf6b4c4754f692), UINT64_C(0xd8f4e1faa225e585), UINT64_C(0x8c1d9868fef51488), UINT64_C(0xb05b5bbcc7c9dd2e), UINT64_C(0xe4b2222e9b192c23), UINT64_C(0x1989a8987e683f34), UINT64_C(0x4d60d10a22b8ce39),
+		UINT64_C(0x61042f300c11ac78), UINT64_C(0x35ed56a250c15d75), UINT64_C(0xc8d6dc14b5b04e62), UINT64_C(0x9c3fa586e960bf6f), UINT64_C(0xa0796652d05c76c9), UINT64_C(0xf4901fc08c8c87c4), UINT64_C(0x09ab957669fd94d3), UINT64_C(0x5d42ece4352d65de),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x3f0be14a916a6dcb), UINT64_C(0x7e17c29522d4db96), UINT64_C(0x411c23dfb3beb65d), UINT64_C(0xfc2f852a45a9b72c), UINT64_C(0xc3246460d4c3dae7), UINT64_C(0x823847bf677d6cba), UINT64_C(0xbd33a6f5f6170171),
+		UINT64_C(0x6a87a57f245d70dd), UINT64_C(0x558c4435b5371d16), UINT64_C(0x149067ea0689ab4b), UINT64_C(0x2b9b86a097e3c680), UINT64_C(0x96a8205561f4c7f1), UINT64_C(0xa9a3c11ff09eaa3a), UINT64_C(0xe8bfe2c043201c67), UINT64_C(0xd7b4038ad24a71ac),
+		UINT64_C(0xd50f4afe48bae1ba), UINT64_C(0xea04abb4d9d08c71), UINT64_C(0xab18886b6a6e3a2c), UINT64_C(0x94136921fb0457e7), UINT64_C(0x2920cfd40d135696), UINT64_C(0x162b2e9e9c793b5d), UINT64_C(0x57370d412fc78d00), UINT64_C(0x683cec0bbeade0cb),
+		UINT64_C(0xbf88ef816ce79167), UINT64_C(0x80830ecbfd8dfcac), UINT64_C(0xc19f2d144e334af1), UINT64_C(0xfe94cc5edf59273a), UINT64_C(0x43a76aab294e264b), UINT64_C(0x7cac8be1b8244b80), UINT64_C(0x3db0a83e0b9afddd), UINT64_C(0x02bb49749af09016),
+		UINT64_C(0x38c63ad73e7bddf1), UINT64_C(0x07cddb9daf11b03a), UINT64_C(0x46d1f8421caf0667), UINT64_C(0x79da19088dc56bac), UINT64_C(0xc4e9bffd7bd26add), UINT64_C(0xfbe25eb7eab80716), UINT64_C(0xbafe7d685906b14b), UINT64_C(0x85f59c22c86cdc80),
+		UINT64_C(0x52419fa81a26ad2c), UINT64_C(0x6d4a7ee28b4cc0e7), UINT64_C(0x2c565d3d38f276ba), UINT64_C(0x135dbc77a9981b71), UINT64_C(0xae6e1a825f8f1a00), UINT64_C(0x9165fbc8cee577cb), UINT64_C(0xd079d8177d5bc196), UINT64_C(0xef72395dec31ac5d),
+		UINT64_C(0xedc9702976c13c4b), UINT64_C(0xd2c29163e7ab5180), UINT64_C(0x93deb2bc5415e7dd), UINT64_C(0xacd553f6c57f8a16), UINT64_C(0x11e6f50333688b67), UINT64_C(0x2eed1449a202e6ac), UINT64_C(0x6ff1379611bc50f1), UINT64_C(0x50fad6dc80d63d3a),
+		UINT64_C(0x874ed556529c4c96), UINT64_C(0xb845341cc3f6215d), UINT64_C(0xf95917c370489700), UINT64_C(0xc652f689e122facb), UINT64_C(0x7b61507c1735fbba), UINT64_C(0x446ab136865f9671), UINT64_C(0x057692e935e1202c), UINT64_C(0x3a7d73a3a48b4de7),
+		UINT64_C(0x718c75ae7cf7bbe2), UINT64_C(0x4e8794e4ed9dd629), UINT64_C(0x0f9bb73b5e236074), UINT64_C(0x30905671cf490dbf), UINT64_C(0x8da3f084395e0cce), UINT64_C(0xb2a811cea8346105), UINT64_C(0xf3b432111b8ad758), UINT64_C(0xccbfd35b8ae0ba93),
+		UINT64_C(0x1b0bd0d158aacb3f), UINT64_C(0x2400319bc9c0a6f4), UINT64_C(0x651c12447a7e10a9), UINT64_C(0x5a17f30eeb147d62), UINT64_C(0xe72455fb1d037c13), UINT64_C(0xd82fb4b18c6911d8), UINT64_C(0x9933976e3fd7a785), UINT64_C(0xa6387624aebdca4e),
+		UINT64_C(0xa4833f50344d5a58), UINT64_C(0x9b88de1aa5273793), UINT64_C(0xda94fdc5169981ce), UINT64_C(0xe59f1c8f87f3ec05), UINT64_C(0x58acba7a71e4ed74), UINT64_C(0x67a75b30e08e80bf), UINT64_C(0x26bb78ef533036e2), UINT64_C(0x19b099a5c25a5b29),
+		UINT64_C(0xce049a2f10102a85), UINT64_C(0xf10f7b65817a474e), UINT64_C(0xb01358ba32c4f113), UINT64_C(0x8f18b9f0a3ae9cd8), UINT64_C(0x322b1f0555b99da9), UINT64_C(0x0d20fe4fc4d3f062), UINT64_C(0x4c3cdd90776d463f), UINT64_C(0x73373cdae6072bf4),
+		UINT64_C(0x494a4f79428c6613), UINT64_C(0x7641ae33d3e60bd8), UINT64_C(0x375d8dec6058bd85), UINT64_C(0x08566ca6f132d04e), UINT64_C(0xb565ca530725d13f), UINT64_C(0x8a6e2b19964fbcf4), UINT64_C(0xcb7208c625f10aa9), UINT64_C(0xf479e98cb49b6762),
+		UINT64_C(0x23cdea0666d116ce), UINT64_C(0x1cc60b4cf7bb7b05), UINT64_C(0x5dda28934405cd58), UINT64_C(0x62d1c9d9d56fa093), UINT64_C(0xdfe26f2c2378a1e2), UINT64_C(0xe0e98e66b212cc29), UINT64_C(0xa1f5adb901ac7a74), UINT64_C(0x9efe4cf390c617bf),
+		UINT64_C(0x9c4505870a3687a9), UINT64_C(0xa34ee4cd9b5cea62), UINT64_C(0xe252c71228e25c3f), UINT64_C(0xdd592658b98831f4), UINT64_C(0x606a80ad4f9f3085), UINT64_C(0x5f6161e7def55d4e), UINT64_C(0x1e7d42386d4beb13), UINT64_C(0x2176a372fc2186d8),
+		UINT64_C(0xf6c2a0f82e6bf774), UINT64_C(0xc9c941b2bf019abf), UINT64_C(0x88d5626d0cbf2ce2), UINT64_C(0xb7de83279dd54129), UINT64_C(0x0aed25d26bc24058), UINT64_C(0x35e6c498faa82d93), UINT64_C(0x74fae74749169bce), UINT64_C(0x4bf1060dd87cf605),
+		UINT64_C(0xe318eb5cf9ef77c4), UINT64_C(0xdc130a1668851a0f), UINT64_C(0x9d0f29c9db3bac52), UINT64_C(0xa204c8834a51c199), UINT64_C(0x1f376e76bc46c0e8), UINT64_C(0x203c8f3c2d2cad23), UINT64_C(0x6120ace39e921b7e), UINT64_C(0x5e2b4da90ff876b5),
+		UINT64_C(0x899f4e23ddb20719), UINT64_C(0xb694af694cd86ad2), UINT64_C(0xf7888cb6ff66dc8f), UINT64_C(0xc8836dfc6e0cb144), UINT64_C(0x75b0cb09981bb035), UINT64_C(0x4abb2a430971ddfe), UINT64_C(0x0ba7099cbacf6ba3), UINT64_C(0x34ace8d62ba50668),
+		UINT64_C(0x3617a1a2b155967e), UINT64_C(0x091c40e8203ffbb5), UINT64_C(0x4800633793814de8), UINT64_C(0x770b827d02eb2023), UINT64_C(0xca382488f4fc2152), UINT64_C(0xf533c5c265964c99), UINT64_C(0xb42fe61dd628fac4), UINT64_C(0x8b2407574742970f),
+		UINT64_C(0x5c9004dd9508e6a3), UINT64_C(0x639be59704628b68), UINT64_C(0x2287c648b7dc3d35), UINT64_C(0x1d8c270226b650fe), UINT64_C(0xa0bf81f7d0a1518f), UINT64_C(0x9fb460bd41cb3c44), UINT64_C(0xdea84362f2758a19), UINT64_C(0xe1a3a228631fe7d2),
+		UINT64_C(0xdbded18bc794aa35), UINT64_C(0xe4d530c156fec7fe), UINT64_C(0xa5c9131ee54071a3), UINT64_C(0x9ac2f254742a1c68), UINT64_C(0x27f154a1823d1d19), UINT64_C(0x18fab5eb135770d2), UINT64_C(0x59e69634a0e9c68f), UINT64_C(0x66ed777e3183ab44),
+		UINT64_C(0xb15974f4e3c9dae8), UINT64_C(0x8e5295be72a3b723), UINT64_C(0xcf4eb661c11d017e), UINT64_C(0xf045572b50776cb5), UINT64_C(0x4d76f1dea6606dc4), UINT64_C(0x727d1094370a000f), UINT64_C(0x3361334b84b4b652), UINT64_C(0x0c6ad20115dedb99),
+		UINT64_C(0x0ed19b758f2e4b8f), UINT64_C(0x31da7a3f1e442644), UINT64_C(0x70c659e0adfa9019), UINT64_C(0x4fcdb8aa3c90fdd2), UINT64_C(0xf2fe1e5fca87fca3), UINT64_C(0xcdf5ff155bed9168), UINT64_C(0x8ce9dccae8532735), UINT64_C(0xb3e23d8079394afe),
+		UINT64_C(0x64563e0aab733b52), UINT64_C(0x5b5ddf403a195699), UINT64_C(0x1a41fc9f89a7e0c4), UINT64_C(0x254a1dd518cd8d0f), UINT64_C(0x9879bb20eeda8c7e), UINT64_C(0xa7725a6a7fb0e1b5), UINT64_C(0xe66e79b5cc0e57e8), UINT64_C(0xd96598ff5d643a23),
+		UINT64_C(0x92949ef28518cc26), UINT64_C(0xad9f7fb81472a1ed), UINT64_C(0xec835c67a7cc17b0), UINT64_C(0xd388bd2d36a67a7b), UINT64_C(0x6ebb1bd8c0b17b0a), UINT64_C(0x51b0fa9251db16c1), UINT64_C(0x10acd94de265a09c), UINT64_C(0x2fa73807730fcd57),
+		UINT64_C(0xf8133b8da145bcfb), UINT64_C(0xc718dac7302fd130), UINT64_C(0x8604f9188391676d), UINT64_C(0xb90f185212fb0aa6), UINT64_C(0x043cbea7e4ec0bd7), UINT64_C(0x3b375fed7586661c), UINT64_C(0x7a2b7c32c638d041), UINT64_C(0x45209d785752bd8a),
+		UINT64_C(0x479bd40ccda22d9c), UINT64_C(0x789035465cc84057), UINT64_C(0x398c1699ef76f60a), UINT64_C(0x0687f7d37e1c9bc1), UINT64_C(0xbbb45126880b9ab0), UINT64_C(0x84bfb06c1961f77b), UINT64_C(0xc5a393b3aadf4126), UINT64_C(0xfaa872f93bb52ced),
+		UINT64_C(0x2d1c7173e9ff5d41), UINT64_C(0x121790397895308a), UINT64_C(0x530bb3e6cb2b86d7), UINT64_C(0x6c0052ac5a41eb1c), UINT64_C(0xd133f459ac56ea6d), UINT64_C(0xee3815133d3c87a6), UINT64_C(0xaf2436cc8e8231fb), UINT64_C(0x902fd7861fe85c30),
+		UINT64_C(0xaa52a425bb6311d7), UINT64_C(0x9559456f2a097c1c), UINT64_C(0xd44566b099b7ca41), UINT64_C(0xeb4e87fa08dda78a), UINT64_C(0x567d210ffecaa6fb), UINT64_C(0x6976c0456fa0cb30), UINT64_C(0x286ae39adc1e7d6d), UINT64_C(0x176102d04d7410a6),
+		UINT64_C(0xc0d5015a9f3e610a), UINT64_C(0xffdee0100e540cc1), UINT64_C(0xbec2c3cfbdeaba9c), UINT64_C(0x81c922852c80d757), UINT64_C(0x3cfa8470da97d626), UINT64_C(0x03f1653a4bfdbbed), UINT64_C(0x42ed46e5f8430db0), UINT64_C(0x7de6a7af6929607b),
+		UINT64_C(0x7f5deedbf3d9f06d), UINT64_C(0x40560f9162b39da6), UINT64_C(0x014a2c4ed10d2bfb), UINT64_C(0x3e41cd0440674630), UINT64_C(0x83726bf1b6704741), UINT64_C(0xbc798abb271a2a8a), UINT64_C(0xfd65a96494a49cd7), UINT64_C(0xc26e482e05cef11c),
+		UINT64_C(0x15da4ba4d78480b0), UINT64_C(0x2ad1aaee46eeed7b), UINT64_C(0x6bcd8931f5505b26), UINT64_C(0x54c6687b643a36ed), UINT64_C(0xe9f5ce8e922d379c), UINT64_C(0xd6fe2fc403475a57), UINT64_C(0x97e20c1bb0f9ec0a), UINT64_C(0xa8e9ed51219381c1),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x1dee8a5e222ca1dc), UINT64_C(0x3bdd14bc445943b8), UINT64_C(0x26339ee26675e264), UINT64_C(0x77ba297888b28770), UINT64_C(0x6a54a326aa9e26ac), UINT64_C(0x4c673dc4ccebc4c8), UINT64_C(0x5189b79aeec76514),
+		UINT64_C(0xef7452f111650ee0), UINT64_C(0xf29ad8af3349af3c), UINT64_C(0xd4a9464d553c4d58), UINT64_C(0xc947cc137710ec84), UINT64_C(0x98ce7b8999d78990), UINT64_C(0x8520f1d7bbfb284c), UINT64_C(0xa3136f35dd8eca28), UINT64_C(0xbefde56bffa26bf4),
+		UINT64_C(0x4c300ac98dc40345), UINT64_C(0x51de8097afe8a299), UINT64_C(0x77ed1e75c99d40fd), UINT64_C(0x6a03942bebb1e121), UINT64_C(0x3b8a23b105768435), UINT64_C(0x2664a9ef275a25e9), UINT64_C(0x0057370d412fc78d), UINT64_C(0x1db9bd5363036651),
+		UINT64_C(0xa34458389ca10da5), UINT64_C(0xbeaad266be8dac79), UINT64_C(0x98994c84d8f84e1d), UINT64_C(0x8577c6dafad4efc1), UINT64_C(0xd4fe714014138ad5), UINT64_C(0xc910fb1e363f2b09), UINT64_C(0xef2365fc504ac96d), UINT64_C(0xf2cdefa2726668b1),
+		UINT64_C(0x986015931b88068a), UINT64_C(0x858e9fcd39a4a756), UINT64_C(0xa3bd012f5fd14532), UINT64_C(0xbe538b717dfde4ee), UINT64_C(0xefda3ceb933a81fa), UINT64_C(0xf234b6b5b1162026), UINT64_C(0xd4072857d763c242), UINT64_C(0xc9e9a209f54f639e),
+		UINT64_C(0x771447620aed086a), UINT64_C(0x6afacd3c28c1a9b6), UINT64_C(0x4cc953de4eb44bd2), UINT64_C(0x5127d9806c98ea0e), UINT64_C(0x00ae6e1a825f8f1a), UINT64_C(0x1d40e444a0732ec6), UINT64_C(0x3b737aa6c606cca2), UINT64_C(0x269df0f8e42a6d7e),
+		UINT64_C(0xd4501f5a964c05cf), UINT64_C(0xc9be9504b460a413), UINT64_C(0xef8d0be6d2154677), UINT64_C(0xf26381b8f039e7ab), UINT64_C(0xa3ea36221efe82bf), UINT64_C(0xbe04bc7c3cd22363), UINT64_C(0x9837229e5aa7c107), UINT64_C(0x85d9a8c0788b60db),
+		UINT64_C(0x3b244dab87290b2f), UINT64_C(0x26cac7f5a505aaf3), UINT64_C(0x00f95917c3704897), UINT64_C(0x1d17d349e15ce94b), UINT64_C(0x4c9e64d30f9b8c5f), UINT64_C(0x5170ee8d2db72d83), UINT64_C(0x7743706f4bc2cfe7), UINT64_C(0x6aadfa3169ee6e3b),
+		UINT64_C(0xa218840d981e1391), UINT64_C(0xbff60e53ba32b24d), UINT64_C(0x99c590b1dc475029), UINT64_C(0x842b1aeffe6bf1f5), UINT64_C(0xd5a2ad7510ac94e1), UINT64_C(0xc84c272b3280353d), UINT64_C(0xee7fb9c954f5d759), UINT64_C(0xf391339776d97685),
+		UINT64_C(0x4d6cd6fc897b1d71), UINT64_C(0x50825ca2ab57bcad), UINT64_C(0x76b1c240cd225ec9), UINT64_C(0x6b5f481eef0eff15), UINT64_C(0x3ad6ff8401c99a01), UINT64_C(0x273875da23e53bdd), UINT64_C(0x010beb384590d9b9), UINT64_C(0x1ce5616667bc7865),
+		UINT64_C(0xee288ec415da10d4), UINT64_C(0xf3c6049a37f6b108), UINT64_C(0xd5f59a785183536c), UINT64_C(0xc81b102673aff2b0), UINT64_C(0x9992a7bc9d6897a4), UINT64_C(0x847c2de2bf443678), UINT64_C(0xa24fb300d931d41c), UINT64_C(0xbfa1395efb1d75c0),
+		UINT64_C(0x015cdc3504bf1e34), UINT64_C(0x1cb2566b2693bfe8), UINT64_C(0x3a81c88940e65d8c), UINT64_C(0x276f42d762cafc50), UINT64_C(0x76e6f54d8c0d9944), UINT64_C(0x6b087f13ae213898), UINT64_C(0x4d3be1f1c854dafc), UINT64_C(0x50d56bafea787b20),
+		UINT64_C(0x3a78919e8396151b), UINT64_C(0x27961bc0a1bab4c7), UINT64_C(0x01a58522c7cf56a3), UINT64_C(0x1c4b0f7ce5e3f77f), UINT64_C(0x4dc2b8e60b24926b), UINT64_C(0x502c32b8290833b7), UINT64_C(0x761fac5a4f7dd1d3), UINT64_C(0x6bf126046d51700f),
+		UINT64_C(0xd50cc36f92f31bfb), UINT64_C(0xc8e24931b0dfba27), UINT64_C(0xeed1d7d3d6aa5843), UINT64_C(0xf33f5d8df486f99f), UINT64_C(0xa2b6ea171a419c8b), UINT64_C(0xbf586049386d3d57), UINT64_C(0x996bfeab5e18df33), UINT64_C(0x848574f57c347eef),
+		UINT64_C(0x76489b570e52165e), UINT64_C(0x6ba611092c7eb782), UINT64_C(0x4d958feb4a0b55e6), UINT64_C(0x507b05b56827f43a), UINT64_C(0x01f2b22f86e0912e), UINT64_C(0x1c1c3871a4cc30f2), UINT64_C(0x3a2fa693c2b9d296), UINT64_C(0x27c12ccde095734a),
+		UINT64_C(0x993cc9a61f3718be), UINT64_C(0x84d243f83d1bb962), UINT64_C(0xa2e1dd1a5b6e5b06), UINT64_C(0xbf0f57447942fada), UINT64_C(0xee86e0de97859fce), UINT64_C(0xf3686a80b5a93e12), UINT64_C(0xd55bf462d3dcdc76), UINT64_C(0xc8b57e3cf1f07daa),
+		UINT64_C(0xd6e9a7309f3239a7), UINT64_C(0xcb072d6ebd1e987b), UINT64_C(0xed34b38cdb6b7a1f), UINT64_C(0xf0da39d2f947dbc3), UINT64_C(0xa1538e481780bed7), UINT64_C(0xbcbd041635ac1f0b), UINT64_C(0x9a8e9af453d9fd6f), UINT64_C(0x876010aa71f55cb3),
+		UINT64_C(0x399df5c18e573747), UINT64_C(0x24737f9fac7b969b), UINT64_C(0x0240e17dca0e74ff), UINT64_C(0x1fae6b23e822d523), UINT64_C(0x4e27dcb906e5b037), UINT64_C(0x53c956e724c911eb), UINT64_C(0x75fac80542bcf38f), UINT64_C(0x6814425b60905253),
+		UINT64_C(0x9ad9adf912f63ae2), UINT64_C(0x873727a730da9b3e), UINT64_C(0xa104b94556af795a), UINT64_C(0xbcea331b7483d886), UINT64_C(0xed6384819a44bd92), UINT64_C(0xf08d0edfb8681c4e), UINT64_C(0xd6be903dde1dfe2a), UINT64_C(0xcb501a63fc315ff6),
+		UINT64_C(0x75adff0803933402), UINT64_C(0x6843755621bf95de), UINT64_C(0x4e70ebb447ca77ba), UINT64_C(0x539e61ea65e6d666), UINT64_C(0x0217d6708b21b372), UINT64_C(0x1ff95c2ea90d12ae), UINT64_C(0x39cac2cccf78f0ca), UINT64_C(0x24244892ed545116),
+		UINT64_C(0x4e89b2a384ba3f2d), UINT64_C(0x536738fda6969ef1), UINT64_C(0x7554a61fc0e37c95), UINT64_C(0x68ba2c41e2cfdd49), UINT64_C(0x39339bdb0c08b85d), UINT64_C(0x24dd11852e241981), UINT64_C(0x02ee8f674851fbe5), UINT64_C(0x1f0005396a7d5a39),
+		UINT64_C(0xa1fde05295df31cd), UINT64_C(0xbc136a0cb7f39011), UINT64_C(0x9a20f4eed1867275), UINT64_C(0x87ce7eb0f3aad3a9), UINT64_C(0xd647c92a1d6db6bd), UINT64_C(0xcba943743f411761), UINT64_C(0xed9add965934f505), UINT64_C(0xf07457c87b1854d9),
+		UINT64_C(0x02b9b86a097e3c68), UINT64_C(0x1f5732342b529db4), UINT64_C(0x3964acd64d277fd0), UINT64_C(0x248a26886f0bde0c), UINT64_C(0x7503911281ccbb18), UINT64_C(0x68ed1b4ca3e01ac4), UINT64_C(0x4ede85aec595f8a0), UINT64_C(0x53300ff0e7b9597c),
+		UINT64_C(0xedcdea9b181b3288), UINT64_C(0xf02360c53a379354), UINT64_C(0xd610fe275c427130), UINT64_C(0xcbfe74797e6ed0ec), UINT64_C(0x9a77c3e390a9b5f8), UINT64_C(0x879949bdb2851424), UINT64_C(0xa1aad75fd4f0f640), UINT64_C(0xbc445d01f6dc579c),
+		UINT64_C(0x74f1233d072c2a36), UINT64_C(0x691fa96325008bea), UINT64_C(0x4f2c37814375698e), UINT64_C(0x52c2bddf6159c852), UINT64_C(0x034b0a458f9ead46), UINT64_C(0x1ea5801badb20c9a), UINT64_C(0x38961ef9cbc7eefe), UINT64_C(0x257894a7e9eb4f22),
+		UINT64_C(0x9b8571cc164924d6), UINT64_C(0x866bfb923465850a), UINT64_C(0xa05865705210676e), UINT64_C(0xbdb6ef2e703cc6b2), UINT64_C(0xec3f58b49efba3a6), UINT64_C(0xf1d1d2eabcd7027a), UINT64_C(0xd7e24c08daa2e01e), UINT64_C(0xca0cc656f88e41c2),
+		UINT64_C(0x38c129f48ae82973), UINT64_C(0x252fa3aaa8c488af), UINT64_C(0x031c3d48ceb16acb), UINT64_C(0x1ef2b716ec9dcb17), UINT64_C(0x4f7b008c025aae03), UINT64_C(0x52958ad220760fdf), UINT64_C(0x74a614304603edbb), UINT64_C(0x69489e6e642f4c67),
+		UINT64_C(0xd7b57b059b8d2793), UINT64_C(0xca5bf15bb9a1864f), UINT64_C(0xec686fb9dfd4642b), UINT64_C(0xf186e5e7fdf8c5f7), UINT64_C(0xa00f527d133fa0e3), UINT64_C(0xbde1d8233113013f), UINT64_C(0x9bd246c15766e35b), UINT64_C(0x863ccc9f754a4287),
+		UINT64_C(0xec9136ae1ca42cbc), UINT64_C(0xf17fbcf03e888d60), UINT64_C(0xd74c221258fd6f04), UINT64_C(0xcaa2a84c7ad1ced8), UINT64_C(0x9b2b1fd69416abcc), UINT64_C(0x86c59588b63a0a10), UINT64_C(0xa0f60b6ad04fe874), UINT64_C(0xbd188134f26349a8),
+		UINT64_C(0x03e5645f0dc1225c), UINT64_C(0x1e0bee012fed8380), UINT64_C(0x383870e3499861e4), UINT64_C(0x25d6fabd6bb4c038), UINT64_C(0x745f4d278573a52c), UINT64_C(0x69b1c779a75f04f0), UINT64_C(0x4f82599bc12ae694), UINT64_C(0x526cd3c5e3064748),
+		UINT64_C(0xa0a13c6791602ff9), UINT64_C(0xbd4fb639b34c8e25), UINT64_C(0x9b7c28dbd5396c41), UINT64_C(0x8692a285f715cd9d), UINT64_C(0xd71b151f19d2a889), UINT64_C(0xcaf59f413bfe0955), UINT64_C(0xecc601a35d8beb31), UINT64_C(0xf1288bfd7fa74aed),
+		UINT64_C(0x4fd56e9680052119), UINT64_C(0x523be4c8a22980c5), UINT64_C(0x74087a2ac45c62a1), UINT64_C(0x69e6f074e670c37d), UINT64_C(0x386f47ee08b7a669), UINT64_C(0x2581cdb02a9b07b5), UINT64_C(0x03b253524ceee5d1), UINT64_C(0x1e5cd90c6ec2440d),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x5c2d776033c4205e), UINT64_C(0xb85aeec0678840bc), UINT64_C(0xe47799a0544c60e2), UINT64_C(0xe26d72ab601e9ffd), UINT64_C(0xbe4005cb53dabfa3), UINT64_C(0x5a379c6b0796df41), UINT64_C(0x061aeb0b3452ff1f),
+		UINT64_C(0x56024a7d6f33217f), UINT64_C(0x0a2f3d1d5cf70121), UINT64_C(0xee58a4bd08bb61c3), UINT64_C(0xb275d3dd3b7f419d), UINT64_C(0xb46f38d60f2dbe82), UINT64_C(0xe8424fb63ce99edc), UINT64_C(0x0c35d61668a5fe3e), UINT64_C(0x5018a1765b61de60),
+		UINT64_C(0xac0494fade6642fe), UINT64_C(0xf029e39aeda262a0), UINT64_C(0x145e7a3ab9ee0242), UINT64_C(0x48730d5a8a2a221c), UINT64_C(0x4e69e651be78dd03), UINT64_C(0x124491318dbcfd5d), UINT64_C(0xf6330891d9f09dbf), UINT64_C(0xaa1e7ff1ea34bde1),
+		UINT64_C(0xfa06de87b1556381), UINT64_C(0xa62ba9e7829143df), UINT64_C(0x425c3047d6dd233d), UINT64_C(0x1e714727e5190363), UINT64_C(0x186bac2cd14bfc7c), UINT64_C(0x4446db4ce28fdc22), UINT64_C(0xa03142ecb6c3bcc0), UINT64_C(0xfc1c358c85079c9e),
+		UINT64_C(0xcad186de13c29b79), UINT64_C(0x96fcf1be2006bb27), UINT64_C(0x728b681e744adbc5), UINT64_C(0x2ea61f7e478efb9b), UINT64_C(0x28bcf47573dc0484), UINT64_C(0x74918315401824da), UINT64_C(0x90e61ab514544438), UINT64_C(0xcccb6dd527906466),
+		UINT64_C(0x9cd3cca37cf1ba06), UINT64_C(0xc0febbc34f359a58), UINT64_C(0x248922631b79faba), UINT64_C(0x78a4550328bddae4), UINT64_C(0x7ebebe081cef25fb), UINT64_C(0x2293c9682f2b05a5), UINT64_C(0xc6e450c87b676547), UINT64_C(0x9ac927a848a34519),
+		UINT64_C(0x66d51224cda4d987), UINT64_C(0x3af86544fe60f9d9), UINT64_C(0xde8ffce4aa2c993b), UINT64_C(0x82a28b8499e8b965), UINT64_C(0x84b8608fadba467a), UINT64_C(0xd89517ef9e7e6624), UINT64_C(0x3ce28e4fca3206c6), UINT64_C(0x60cff92ff9f62698),
+		UINT64_C(0x30d75859a297f8f8), UINT64_C(0x6cfa2f399153d8a6), UINT64_C(0x888db699c51fb844), UINT64_C(0xd4a0c1f9f6db981a), UINT64_C(0xd2ba2af2c2896705), UINT64_C(0x8e975d92f14d475b), UINT64_C(0x6ae0c432a50127b9), UINT64_C(0x36cdb35296c507e7),
+		UINT64_C(0x077ba297888b2877), UINT64_C(0x5b56d5f7bb4f0829), UINT64_C(0xbf214c57ef0368cb), UINT64_C(0xe30c3b37dcc74895), UINT64_C(0xe516d03ce895b78a), UINT64_C(0xb93ba75cdb5197d4), UINT64_C(0x5d4c3efc8f1df736), UINT64_C(0x0161499cbcd9d768),
+		UINT64_C(0x5179e8eae7b80908), UINT64_C(0x0d549f8ad47c2956), UINT64_C(0xe923062a803049b4), UINT64_C(0xb50e714ab3f469ea), UINT64_C(0xb3149a4187a696f5), UINT64_C(0xef39ed21b462b6ab), UINT64_C(0x0b4e7481e02ed649), UINT64_C(0x576303e1d3eaf617),
+		UINT64_C(0xab7f366d56ed6a89), UINT64_C(0xf752410d65294ad7), UINT64_C(0x1325d8ad31652a35), UINT64_C(0x4f08afcd02a10a6b), UINT64_C(0x491244c636f3f574), UINT64_C(0x153f33a60537d52a), UINT64_C(0xf148aa06517bb5c8), UINT64_C(0xad65dd6662bf9596),
+		UINT64_C(0xfd7d7c1039de4bf6), UINT64_C(0xa1500b700a1a6ba8), UINT64_C(0x452792d05e560b4a), UINT64_C(0x190ae5b06d922b14), UINT64_C(0x1f100ebb59c0d40b), UINT64_C(0x433d79db6a04f455), UINT64_C(0xa74ae07b3e4894b7), UINT64_C(0xfb67971b0d8cb4e9),
+		UINT64_C(0xcdaa24499b49b30e), UINT64_C(0x91875329a88d9350), UINT64_C(0x75f0ca89fcc1f3b2), UINT64_C(0x29ddbde9cf05d3ec), UINT64_C(0x2fc756e2fb572cf3), UINT64_C(0x73ea2182c8930cad), UINT64_C(0x979db8229cdf6c4f), UINT64_C(0xcbb0cf42af1b4c11),
+		UINT64_C(0x9ba86e34f47a9271), UINT64_C(0xc7851954c7beb22f), UINT64_C(0x23f280f493f2d2cd), UINT64_C(0x7fdff794a036f293), UINT64_C(0x79c51c9f94640d8c), UINT64_C(0x25e86bffa7a02dd2), UINT64_C(0xc19ff25ff3ec4d30), UINT64_C(0x9db2853fc0286d6e),
+		UINT64_C(0x61aeb0b3452ff1f0), UINT64_C(0x3d83c7d376ebd1ae), UINT64_C(0xd9f45e7322a7b14c), UINT64_C(0x85d9291311639112), UINT64_C(0x83c3c21825316e0d), UINT64_C(0xdfeeb57816f54e53), UINT64_C(0x3b992cd842b92eb1), UINT64_C(0x67b45bb8717d0eef),
+		UINT64_C(0x37acface2a1cd08f), UINT64_C(0x6b818dae19d8f0d1), UINT64_C(0x8ff6140e4d949033), UINT64_C(0xd3db636e7e50b06d), UINT64_C(0xd5c188654a024f72), UINT64_C(0x89ecff0579c66f2c), UINT64_C(0x6d9b66a52d8a0fce), UINT64_C(0x31b611c51e4e2f90),
+		UINT64_C(0x0ef7452f111650ee), UINT64_C(0x52da324f22d270b0), UINT64_C(0xb6adabef769e1052), UINT64_C(0xea80dc8f455a300c), UINT64_C(0xec9a37847108cf13), UINT64_C(0xb0b740e442ccef4d), UINT64_C(0x54c0d94416808faf), UINT64_C(0x08edae242544aff1),
+		UINT64_C(0x58f50f527e257191), UINT64_C(0x04d878324de151cf), UINT64_C(0xe0afe19219ad312d), UINT64_C(0xbc8296f22a691173), UINT64_C(0xba987df91e3bee6c), UINT64_C(0xe6b50a992dffce32), UINT64_C(0x02c2933979b3aed0), UINT64_C(0x5eefe4594a778e8e),
+		UINT64_C(0xa2f3d1d5cf701210), UINT64_C(0xfedea6b5fcb4324e), UINT64_C(0x1aa93f15a8f852ac), UINT64_C(0x468448759b3c72f2), UINT64_C(0x409ea37eaf6e8ded), UINT64_C(0x1cb3d41e9caaadb3), UINT64_C(0xf8c44dbec8e6cd51), UINT64_C(0xa4e93adefb22ed0f),
+		UINT64_C(0xf4f19ba8a043336f), UINT64_C(0xa8dcecc893871331), UINT64_C(0x4cab7568c7cb73d3), UINT64_C(0x10860208f40f538d), UINT64_C(0x169ce903c05dac92), UINT64_C(0x4ab19e63f3998ccc), UINT64_C(0xaec607c3a7d5ec2e), UINT64_C(0xf2eb70a39411cc70),
+		UINT64_C(0xc426c3f102d4cb97), UINT64_C(0x980bb4913110ebc9), UINT64_C(0x7c7c2d31655c8b2b), UINT64_C(0x20515a515698ab75), UINT64_C(0x264bb15a62ca546a), UINT64_C(0x7a66c63a510e7434), UINT64_C(0x9e115f9a054214d6), UINT64_C(0xc23c28fa36863488),
+		UINT64_C(0x9224898c6de7eae8), UINT64_C(0xce09feec5e23cab6), UINT64_C(0x2a7e674c0a6faa54), UINT64_C(0x7653102c39ab8a0a), UINT64_C(0x7049fb270df97515), UINT64_C(0x2c648c473e3d554b), UINT64_C(0xc81315e76a7135a9), UINT64_C(0x943e628759b515f7),
+		UINT64_C(0x6822570bdcb28969), UINT64_C(0x340f206bef76a937), UINT64_C(0xd078b9cbbb3ac9d5), UINT64_C(0x8c55ceab88fee98b), UINT64_C(0x8a4f25a0bcac1694), UINT64_C(0xd66252c08f6836ca), UINT64_C(0x3215cb60db245628), UINT64_C(0x6e38bc00e8e07676),
+		UINT64_C(0x3e201d76b381a816), UINT64_C(0x620d6a1680458848), UINT64_C(0x867af3b6d409e8aa), UINT64_C(0xda5784d6e7cdc8f4), UINT64_C(0xdc4d6fddd39f37eb), UINT64_C(0x806018bde05b17b5), UINT64_C(0x6417811db4177757), UINT64_C(0x383af67d87d35709),
+		UINT64_C(0x098ce7b8999d7899), UINT64_C(0x55a190d8aa5958c7), UINT64_C(0xb1d60978fe153825), UINT64_C(0xedfb7e18cdd1187b), UINT64_C(0xebe19513f983e764), UINT64_C(0xb7cce273ca47c73a), UINT64_C(0x53bb7bd39e0ba7d8), UINT64_C(0x0f960cb3adcf8786),
+		UINT64_C(0x5f8eadc5f6ae59e6), UINT64_C(0x03a3daa5c56a79b8), UINT64_C(0xe7d443059126195a), UINT64_C(0xbbf93465a2e23904), UINT64_C(0xbde3df6e96b0c61b), UINT64_C(0xe1cea80ea574e645), UINT64_C(0x05b931aef13886a7), UINT64_C(0x599446cec2fca6f9),
+		UINT64_C(0xa588734247fb3a67), UINT64_C(0xf9a50422743f1a39), UINT64_C(0x1dd29d8220737adb), UINT64_C(0x41ffeae213b75a85), UINT64_C(0x47e501e927e5a59a), UINT64_C(0x1bc87689142185c4), UINT64_C(0xffbfef29406de526), UINT64_C(0xa392984973a9c578),
+		UINT64_C(0xf38a393f28c81b18), UINT64_C(0xafa74e5f1b0c3b46), UINT64_C(0x4bd0d7ff4f405ba4), UINT64_C(0x17fda09f7c847bfa), UINT64_C(0x11e74b9448d684e5), UINT64_C(0x4dca3cf47b12a4bb), UINT64_C(0xa9bda5542f5ec459), UINT64_C(0xf590d2341c9ae407),
+		UINT64_C(0xc35d61668a5fe3e0), UINT64_C(0x9f701606b99bc3be), UINT64_C(0x7b078fa6edd7a35c), UINT64_C(0x272af8c6de138302), UINT64_C(0x213013cdea417c1d), UINT64_C(0x7d1d64add9855c43), UINT64_C(0x996afd0d8dc93ca1), UINT64_C(0xc5478a6dbe0d1cff),
+		UINT64_C(0x955f2b1be56cc29f), UINT64_C(0xc9725c7bd6a8e2c1), UINT64_C(0x2d05c5db82e48223), UINT64_C(0x7128b2bbb120a27d), UINT64_C(0x773259b085725d62), UINT64_C(0x2b1f2ed0b6b67d3c), UINT64_C(0xcf68b770e2fa1dde), UINT64_C(0x9345c010d13e3d80),
+		UINT64_C(0x6f59f59c5439a11e), UINT64_C(0x337482fc67fd8140), UINT64_C(0xd7031b5c33b1e1a2), UINT64_C(0x8b2e6c3c0075c1fc), UINT64_C(0x8d34873734273ee3), UINT64_C(0xd119f05707e31ebd), UINT64_C(0x356e69f753af7e5f), UINT64_C(0x69431e97606b5e01),
+		UINT64_C(0x395bbfe13b0a8061), UINT64_C(0x6576c88108cea03f), UINT64_C(0x810151215c82c0dd), UINT64_C(0xdd2c26416f46e083), UINT64_C(0xdb36cd4a5b141f9c), UINT64_C(0x871bba2a68d03fc2), UINT64_C(0x636c238a3c9c5f20), UINT64_C(0x3f4154ea0f587f7e),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x6184d55f721267c6), UINT64_C(0xc309aabee424cf8c), UINT64_C(0xa28d7fe19636a84a), UINT64_C(0x14cbfa566747819d), UINT64_C(0x754f2f091555e65b), UINT64_C(0xd7c250e883634e11), UINT64_C(0xb64685b7f17129d7),
+		UINT64_C(0x2997f4acce8f033a), UINT64_C(0x481321f3bc9d64fc), UINT64_C(0xea9e5e122aabccb6), UINT64_C(0x8b1a8b4d58b9ab70), UINT64_C(0x3d5c0efaa9c882a7), UINT64_C(0x5cd8dba5dbdae561), UINT64_C(0xfe55a4444dec4d2b), UINT64_C(0x9fd1711b3ffe2aed),
+		UINT64_C(0x532fe9599d1e0674), UINT64_C(0x32ab3c06ef0c61b2), UINT64_C(0x902643e7793ac9f8), UINT64_C(0xf1a296b80b28ae3e), UINT64_C(0x47e4130ffa5987e9), UINT64_C(0x2660c650884be02f), UINT64_C(0x84edb9b11e7d4865), UINT64_C(0xe5696cee6c6f2fa3),
+		UINT64_C(0x7ab81df55391054e), UINT64_C(0x1b3cc8aa21836288), UINT64_C(0xb9b1b74bb7b5cac2), UINT64_C(0xd8356214c5a7ad04), UINT64_C(0x6e73e7a334d684d3), UINT64_C(0x0ff732fc46c4e315), UINT64_C(0xad7a4d1dd0f24b5f), UINT64_C(0xccfe9842a2e02c99),
+		UINT64_C(0xa65fd2b33a3c0ce8), UINT64_C(0xc7db07ec482e6b2e), UINT64_C(0x6556780dde18c364), UINT64_C(0x04d2ad52ac0aa4a2), UINT64_C(0xb29428e55d7b8d75), UINT64_C(0xd310fdba2f69eab3), UINT64_C(0x719d825bb95f42f9), UINT64_C(0x10195704cb4d253f),
+		UINT64_C(0x8fc8261ff4b30fd2), UINT64_C(0xee4cf34086a16814), UINT64_C(0x4cc18ca11097c05e), UINT64_C(0x2d4559fe6285a798), UINT64_C(0x9b03dc4993f48e4f), UINT64_C(0xfa870916e1e6e989), UINT64_C(0x580a76f777d041c3), UINT64_C(0x398ea3a805c22605),
+		UINT64_C(0xf5703beaa7220a9c), UINT64_C(0x94f4eeb5d5306d5a), UINT64_C(0x367991544306c510), UINT64_C(0x57fd440b3114a2d6), UINT64_C(0xe1bbc1bcc0658b01), UINT64_C(0x803f14e3b277ecc7), UINT64_C(0x22b26b022441448d), UINT64_C(0x4336be5d5653234b),
+		UINT64_C(0xdce7cf4669ad09a6), UINT64_C(0xbd631a191bbf6e60), UINT64_C(0x1fee65f88d89c62a), UINT64_C(0x7e6ab0a7ff9ba1ec), UINT64_C(0xc82c35100eea883b), UINT64_C(0xa9a8e04f7cf8effd), UINT64_C(0x0b259faeeace47b7), UINT64_C(0x6aa14af198dc2071),
+		UINT64_C(0xde670a4ddb760755), UINT64_C(0xbfe3df12a9646093), UINT64_C(0x1d6ea0f33f52c8d9), UINT64_C(0x7cea75ac4d40af1f), UINT64_C(0xcaacf01bbc3186c8), UINT64_C(0xab282544ce23e10e), UINT64_C(0x09a55aa558154944), UINT64_C(0x68218ffa2a072e82),
+		UINT64_C(0xf7f0fee115f9046f), UINT64_C(0x96742bbe67eb63a9), UINT64_C(0x34f9545ff1ddcbe3), UINT64_C(0x557d810083cfac25), UINT64_C(0xe33b04b772be85f2), UINT64_C(0x82bfd1e800ace234), UINT64_C(0x2032ae09969a4a7e), UINT64_C(0x41b67b56e4882db8),
+		UINT64_C(0x8d48e31446680121), UINT64_C(0xeccc364b347a66e7), UINT64_C(0x4e4149aaa24ccead), UINT64_C(0x2fc59cf5d05ea96b), UINT64_C(0x99831942212f80bc), UINT64_C(0xf807cc1d533de77a), UINT64_C(0x5a8ab3fcc50b4f30), UINT64_C(0x3b0e66a3b71928f6),
+		UINT64_C(0xa4df17b888e7021b), UINT64_C(0xc55bc2e7faf565dd), UINT64_C(0x67d6bd066cc3cd97), UINT64_C(0x065268591ed1aa51), UINT64_C(0xb014edeeefa08386), UINT64_C(0xd19038b19db2e440), UINT64_C(0x731d47500b844c0a), UINT64_C(0x1299920f79962bcc),
+		UINT64_C(0x7838d8fee14a0bbd), UINT64_C(0x19bc0da193586c7b), UINT64_C(0xbb317240056ec431), UINT64_C(0xdab5a71f777ca3f7), UINT64_C(0x6cf322a8860d8a20), UINT64_C(0x0d77f7f7f41fede6), UINT64_C(0xaffa8816622945ac), UINT64_C(0xce7e5d49103b226a),
+		UINT64_C(0x51af2c522fc50887), UINT64_C(0x302bf90d5dd76f41), UINT64_C(0x92a686eccbe1c70b), UINT64_C(0xf32253b3b9f3a0cd), UINT64_C(0x4564d6044882891a), UINT64_C(0x24e0035b3a90eedc), UINT64_C(0x866d7cbaaca64696), UINT64_C(0xe7e9a9e5deb42150),
+		UINT64_C(0x2b1731a77c540dc9), UINT64_C(0x4a93e4f80e466a0f), UINT64_C(0xe81e9b199870c245), UINT64_C(0x899a4e46ea62a583), UINT64_C(0x3fdccbf11b138c54), UINT64_C(0x5e581eae6901eb92), UINT64_C(0xfcd5614fff3743d8), UINT64_C(0x9d51b4108d25241e),
+		UINT64_C(0x0280c50bb2db0ef3), UINT64_C(0x63041054c0c96935), UINT64_C(0xc1896fb556ffc17f), UINT64_C(0xa00dbaea24eda6b9), UINT64_C(0x164b3f5dd59c8f6e), UINT64_C(0x77cfea02a78ee8a8), UINT64_C(0xd54295e331b840e2), UINT64_C(0xb4c640bc43aa2724),
+		UINT64_C(0x2e16bbb019e2102f), UINT64_C(0x4f926eef6bf077e9), UINT64_C(0xed1f110efdc6dfa3), UINT64_C(0x8c9bc4518fd4b865), UINT64_C(0x3add41e67ea591b2), UINT64_C(0x5b5994b90cb7f674), UINT64_C(0xf9d4eb589a815e3e), UINT64_C(0x98503e07e89339f8),
+		UINT64_C(0x07814f1cd76d1315), UINT64_C(0x66059a43a57f74d3), UINT64_C(0xc488e5a23349dc99), UINT64_C(0xa50c30fd415bbb5f), UINT64_C(0x134ab54ab02a9288), UINT64_C(0x72ce6015c238f54e), UINT64_C(0xd0431ff4540e5d04), UINT64_C(0xb1c7caab261c3ac2),
+		UINT64_C(0x7d3952e984fc165b), UINT64_C(0x1cbd87b6f6ee719d), UINT64_C(0xbe30f85760d8d9d7), UINT64_C(0xdfb42d0812cabe11), UINT64_C(0x69f2a8bfe3bb97c6), UINT64_C(0x08767de091a9f000), UINT64_C(0xaafb0201079f584a), UINT64_C(0xcb7fd75e758d3f8c),
+		UINT64_C(0x54aea6454a731561), UINT64_C(0x352a731a386172a7), UINT64_C(0x97a70cfbae57daed), UINT64_C(0xf623d9a4dc45bd2b), UINT64_C(0x40655c132d3494fc), UINT64_C(0x21e1894c5f26f33a), UINT64_C(0x836cf6adc9105b70), UINT64_C(0xe2e823f2bb023cb6),
+		UINT64_C(0x8849690323de1cc7), UINT64_C(0xe9cdbc5c51cc7b01), UINT64_C(0x4b40c3bdc7fad34b), UINT64_C(0x2ac416e2b5e8b48d), UINT64_C(0x9c82935544999d5a), UINT64_C(0xfd06460a368bfa9c), UINT64_C(0x5f8b39eba0bd52d6), UINT64_C(0x3e0fecb4d2af3510),
+		UINT64_C(0xa1de9dafed511ffd), UINT64_C(0xc05a48f09f43783b), UINT64_C(0x62d737110975d071), UINT64_C(0x0353e24e7b67b7b7), UINT64_C(0xb51567f98a169e60), UINT64_C(0xd491b2a6f804f9a6), UINT64_C(0x761ccd476e3251ec), UINT64_C(0x179818181c20362a),
+		UINT64_C(0xdb66805abec01ab3), UINT64_C(0xbae25505ccd27d75), UINT64_C(0x186f2ae45ae4d53f), UINT64_C(0x79ebffbb28f6b2f9), UINT64_C(0xcfad7a0cd9879b2e), UINT64_C(0xae29af53ab95fce8), UINT64_C(0x0ca4d0b23da354a2), UINT64_C(0x6d2005ed4fb13364),
+		UINT64_C(0xf2f174f6704f1989), UINT64_C(0x9375a1a9025d7e4f), UINT64_C(0x31f8de48946bd605), UINT64_C(0x507c0b17e679b1c3), UINT64_C(0xe63a8ea017089814), UINT64_C(0x87be5bff651affd2), UINT64_C(0x2533241ef32c5798), UINT64_C(0x44b7f141813e305e),
+		UINT64_C(0xf071b1fdc294177a), UINT64_C(0x91f564a2b08670bc), UINT64_C(0x33781b4326b0d8f6), UINT64_C(0x52fcce1c54a2bf30), UINT64_C(0xe4ba4baba5d396e7), UINT64_C(0x853e9ef4d7c1f121), UINT64_C(0x27b3e11541f7596b), UINT64_C(0x4637344a33e53ead),
+		UINT64_C(0xd9e645510c1b1440), UINT64_C(0xb862900e7e097386), UINT64_C(0x1aefefefe83fdbcc), UINT64_C(0x7b6b3ab09a2dbc0a), UINT64_C(0xcd2dbf076b5c95dd), UINT64_C(0xaca96a58194ef21b), UINT64_C(0x0e2415b98f785a51), UINT64_C(0x6fa0c0e6fd6a3d97),
+		UINT64_C(0xa35e58a45f8a110e), UINT64_C(0xc2da8dfb2d9876c8), UINT64_C(0x6057f21abbaede82), UINT64_C(0x01d32745c9bcb944), UINT64_C(0xb795a2f238cd9093), UINT64_C(0xd61177ad4adff755), UINT64_C(0x749c084cdce95f1f), UINT64_C(0x1518dd13aefb38d9),
+		UINT64_C(0x8ac9ac0891051234), UINT64_C(0xeb4d7957e31775f2), UINT64_C(0x49c006b67521ddb8), UINT64_C(0x2844d3e90733ba7e), UINT64_C(0x9e02565ef64293a9), UINT64_C(0xff8683018450f46f), UINT64_C(0x5d0bfce012665c25), UINT64_C(0x3c8f29bf60743be3),
+		UINT64_C(0x562e634ef8a81b92), UINT64_C(0x37aab6118aba7c54), UINT64_C(0x9527c9f01c8cd41e), UINT64_C(0xf4a31caf6e9eb3d8), UINT64_C(0x42e599189fef9a0f), UINT64_C(0x23614c47edfdfdc9), UINT64_C(0x81ec33a67bcb5583), UINT64_C(0xe068e6f909d93245),
+		UINT64_C(0x7fb997e2362718a8), UINT64_C(0x1e3d42bd44357f6e), UINT64_C(0xbcb03d5cd203d724), UINT64_C(0xdd34e803a011b0e2), UINT64_C(0x6b726db451609935), UINT64_C(0x0af6b8eb2372fef3), UINT64_C(0xa87bc70ab54456b9), UINT64_C(0xc9ff1255c756317f),
+		UINT64_C(0x05018a1765b61de6), UINT64_C(0x64855f4817a47a20), UINT64_C(0xc60820a98192d26a), UINT64_C(0xa78cf5f6f380b5ac), UINT64_C(0x11ca704102f19c7b), UINT64_C(0x704ea51e70e3fbbd), UINT64_C(0xd2c3daffe6d553f7), UINT64_C(0xb3470fa094c73431),
+		UINT64_C(0x2c967ebbab391edc), UINT64_C(0x4d12abe4d92b791a), UINT64_C(0xef9fd4054f1dd150), UINT64_C(0x8e1b015a3d0fb696), UINT64_C(0x385d84edcc7e9f41), UINT64_C(0x59d951b2be6cf887), UINT64_C(0xfb542e53285a50cd), UINT64_C(0x9ad0fb0c5a48370b),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0x22ef0d5934f964ec), UINT64_C(0x45de1ab269f2c9d8), UINT64_C(0x673117eb5d0bad34), UINT64_C(0x8bbc3564d3e593b0), UINT64_C(0xa953383de71cf75c), UINT64_C(0xce622fd6ba175a68), UINT64_C(0xec8d228f8eee3e84),
+		UINT64_C(0x85a0c5e208c539e5), UINT64_C(0xa74fc8bb3c3c5d09), UINT64_C(0xc07edf506137f03d), UINT64_C(0xe291d20955ce94d1), UINT64_C(0x0e1cf086db20aa55), UINT64_C(0x2cf3fddfefd9ceb9), UINT64_C(0x4bc2ea34b2d2638d), UINT64_C(0x692de76d862b0761),
+		UINT64_C(0x999924efbe846d4f), UINT64_C(0xbb7629b68a7d09a3), UINT64_C(0xdc473e5dd776a497), UINT64_C(0xfea83304e38fc07b), UINT64_C(0x1225118b6d61feff), UINT64_C(0x30ca1cd259989a13), UINT64_C(0x57fb0b3904933727), UINT64_C(0x75140660306a53cb),
+		UINT64_C(0x1c39e10db64154aa), UINT64_C(0x3ed6ec5482b83046), UINT64_C(0x59e7fbbfdfb39d72), UINT64_C(0x7b08f6e6eb4af99e), UINT64_C(0x9785d46965a4c71a), UINT64_C(0xb56ad930515da3f6), UINT64_C(0xd25bcedb0c560ec2), UINT64_C(0xf0b4c38238af6a2e),
+		UINT64_C(0xa1eae6f4d206c41b), UINT64_C(0x8305ebade6ffa0f7), UINT64_C(0xe434fc46bbf40dc3), UINT64_C(0xc6dbf11f8f0d692f), UINT64_C(0x2a56d39001e357ab), UINT64_C(0x08b9dec9351a3347), UINT64_C(0x6f88c92268119e73), UINT64_C(0x4d67c47b5ce8fa9f),
+		UINT64_C(0x244a2316dac3fdfe), UINT64_C(0x06a52e4fee3a9912), UINT64_C(0x619439a4b3313426), UINT64_C(0x437b34fd87c850ca), UINT64_C(0xaff6167209266e4e), UINT64_C(0x8d191b2b3ddf0aa2), UINT64_C(0xea280cc060d4a796), UINT64_C(0xc8c70199542dc37a),
+		UINT64_C(0x3873c21b6c82a954), UINT64_C(0x1a9ccf42587bcdb8), UINT64_C(0x7dadd8a90570608c), UINT64_C(0x5f42d5f031890460), UINT64_C(0xb3cff77fbf673ae4), UINT64_C(0x9120fa268b9e5e08), UINT64_C(0xf611edcdd695f33c), UINT64_C(0xd4fee094e26c97d0),
+		UINT64_C(0xbdd307f9644790b1), UINT64_C(0x9f3c0aa050bef45d), UINT64_C(0xf80d1d4b0db55969), UINT64_C(0xdae21012394c3d85), UINT64_C(0x366f329db7a20301), UINT64_C(0x14803fc4835b67ed), UINT64_C(0x73b1282fde50cad9), UINT64_C(0x515e2576eaa9ae35),
+		UINT64_C(0xd10d62c20b0396b3), UINT64_C(0xf3e26f9b3ffaf25f), UINT64_C(0x94d3787062f15f6b), UINT64_C(0xb63c752956083b87), UINT64_C(0x5ab157a6d8e60503), UINT64_C(0x785e5affec1f61ef), UINT64_C(0x1f6f4d14b114ccdb), UINT64_C(0x3d80404d85eda837),
+		UINT64_C(0x54ada72003c6af56), UINT64_C(0x7642aa79373fcbba), UINT64_C(0x1173bd926a34668e), UINT64_C(0x339cb0cb5ecd0262), UINT64_C(0xdf119244d0233ce6), UINT64_C(0xfdfe9f1de4da580a), UINT64_C(0x9acf88f6b9d1f53e), UINT64_C(0xb82085af8d2891d2),
+		UINT64_C(0x4894462db587fbfc), UINT64_C(0x6a7b4b74817e9f10), UINT64_C(0x0d4a5c9fdc753224), UINT64_C(0x2fa551c6e88c56c8), UINT64_C(0xc32873496662684c), UINT64_C(0xe1c77e10529b0ca0), UINT64_C(0x86f669fb0f90a194), UINT64_C(0xa41964a23b69c578),
+		UINT64_C(0xcd3483cfbd42c219), UINT64_C(0xefdb8e9689bba6f5), UINT64_C(0x88ea997dd4b00bc1), UINT64_C(0xaa059424e0496f2d), UINT64_C(0x4688b6ab6ea751a9), UINT64_C(0x6467bbf25a5e3545), UINT64_C(0x0356ac1907559871), UINT64_C(0x21b9a14033acfc9d),
+		UINT64_C(0x70e78436d90552a8), UINT64_C(0x5208896fedfc3644), UINT64_C(0x35399e84b0f79b70), UINT64_C(0x17d693dd840eff9c), UINT64_C(0xfb5bb1520ae0c118), UINT64_C(0xd9b4bc0b3e19a5f4), UINT64_C(0xbe85abe0631208c0), UINT64_C(0x9c6aa6b957eb6c2c),
+		UINT64_C(0xf54741d4d1c06b4d), UINT64_C(0xd7a84c8de5390fa1), UINT64_C(0xb0995b66b832a295), UINT64_C(0x9276563f8ccbc679), UINT64_C(0x7efb74b00225f8fd), UINT64_C(0x5c1479e936dc9c11), UINT64_C(0x3b256e026bd73125), UINT64_C(0x19ca635b5f2e55c9),
+		UINT64_C(0xe97ea0d967813fe7), UINT64_C(0xcb91ad8053785b0b), UINT64_C(0xaca0ba6b0e73f63f), UINT64_C(0x8e4fb7323a8a92d3), UINT64_C(0x62c295bdb464ac57), UINT64_C(0x402d98e4809dc8bb), UINT64_C(0x271c8f0fdd96658f), UINT64_C(0x05f38256e96f0163),
+		UINT64_C(0x6cde653b6f440602), UINT64_C(0x4e3168625bbd62ee), UINT64_C(0x29007f8906b6cfda), UINT64_C(0x0bef72d0324fab36), UINT64_C(0xe762505fbca195b2), UINT64_C(0xc58d5d068858f15e), UINT64_C(0xa2bc4aedd5535c6a), UINT64_C(0x805347b4e1aa3886),
+		UINT64_C(0x30c26aafb90933e3), UINT64_C(0x122d67f68df0570f), UINT64_C(0x751c701dd0fbfa3b), UINT64_C(0x57f37d44e4029ed7), UINT64_C(0xbb7e5fcb6aeca053), UINT64_C(0x999152925e15c4bf), UINT64_C(0xfea04579031e698b), UINT64_C(0xdc4f482037e70d67),
+		UINT64_C(0xb562af4db1cc0a06), UINT64_C(0x978da21485356eea), UINT64_C(0xf0bcb5ffd83ec3de), UINT64_C(0xd253b8a6ecc7a732), UINT64_C(0x3ede9a29622999b6), UINT64_C(0x1c31977056d0fd5a), UINT64_C(0x7b00809b0bdb506e), UINT64_C(0x59ef8dc23f223482),
+		UINT64_C(0xa95b4e40078d5eac), UINT64_C(0x8bb4431933743a40), UINT64_C(0xec8554f26e7f9774), UINT64_C(0xce6a59ab5a86f398), UINT64_C(0x22e77b24d468cd1c), UINT64_C(0x0008767de091a9f0), UINT64_C(0x67396196bd9a04c4), UINT64_C(0x45d66ccf89636028),
+		UINT64_C(0x2cfb8ba20f486749), UINT64_C(0x0e1486fb3bb103a5), UINT64_C(0x6925911066baae91), UINT64_C(0x4bca9c495243ca7d), UINT64_C(0xa747bec6dcadf4f9), UINT64_C(0x85a8b39fe8549015), UINT64_C(0xe299a474b55f3d21), UINT64_C(0xc076a92d81a659cd),
+		UINT64_C(0x91288c5b6b0ff7f8), UINT64_C(0xb3c781025ff69314), UINT64_C(0xd4f696e902fd3e20), UINT64_C(0xf6199bb036045acc), UINT64_C(0x1a94b93fb8ea6448), UINT64_C(0x387bb4668c1300a4), UINT64_C(0x5f4aa38dd118ad90), UINT64_C(0x7da5aed4e5e1c97c),
+		UINT64_C(0x148849b963cace1d), UINT64_C(0x366744e05733aaf1), UINT64_C(0x5156530b0a3807c5), UINT64_C(0x73b95e523ec16329), UINT64_C(0x9f347cddb02f5dad), UINT64_C(0xbddb718484d63941), UINT64_C(0xdaea666fd9dd9475), UINT64_C(0xf8056b36ed24f099),
+		UINT64_C(0x08b1a8b4d58b9ab7), UINT64_C(0x2a5ea5ede172fe5b), UINT64_C(0x4d6fb206bc79536f), UINT64_C(0x6f80bf5f88803783), UINT64_C(0x830d9dd0066e0907), UINT64_C(0xa1e2908932976deb), UINT64_C(0xc6d387626f9cc0df), UINT64_C(0xe43c8a3b5b65a433),
+		UINT64_C(0x8d116d56dd4ea352), UINT64_C(0xaffe600fe9b7c7be), UINT64_C(0xc8cf77e4b4bc6a8a), UINT64_C(0xea207abd80450e66), UINT64_C(0x06ad58320eab30e2), UINT64_C(0x2442556b3a52540e), UINT64_C(0x437342806759f93a), UINT64_C(0x619c4fd953a09dd6),
+		UINT64_C(0xe1cf086db20aa550), UINT64_C(0xc320053486f3c1bc), UINT64_C(0xa41112dfdbf86c88), UINT64_C(0x86fe1f86ef010864), UINT64_C(0x6a733d0961ef36e0), UINT64_C(0x489c30505516520c), UINT64_C(0x2fad27bb081dff38), UINT64_C(0x0d422ae23ce49bd4),
+		UINT64_C(0x646fcd8fbacf9cb5), UINT64_C(0x4680c0d68e36f859), UINT64_C(0x21b1d73dd33d556d), UINT64_C(0x035eda64e7c43181), UINT64_C(0xefd3f8eb692a0f05), UINT64_C(0xcd3cf5b25dd36be9), UINT64_C(0xaa0de25900d8c6dd), UINT64_C(0x88e2ef003421a231),
+		UINT64_C(0x78562c820c8ec81f), UINT64_C(0x5ab921db3877acf3), UINT64_C(0x3d883630657c01c7), UINT64_C(0x1f673b695185652b), UINT64_C(0xf3ea19e6df6b5baf), UINT64_C(0xd10514bfeb923f43), UINT64_C(0xb6340354b6999277), UINT64_C(0x94db0e0d8260f69b),
+		UINT64_C(0xfdf6e960044bf1fa), UINT64_C(0xdf19e43930b29516), UINT64_C(0xb828f3d26db93822), UINT64_C(0x9ac7fe8b59405cce), UINT64_C(0x764adc04d7ae624a), UINT64_C(0x54a5d15de35706a6), UINT64_C(0x3394c6b6be5cab92), UINT64_C(0x117bcbef8aa5cf7e),
+		UINT64_C(0x4025ee99600c614b), UINT64_C(0x62cae3c054f505a7), UINT64_C(0x05fbf42b09fea893), UINT64_C(0x2714f9723d07cc7f), UINT64_C(0xcb99dbfdb3e9f2fb), UINT64_C(0xe976d6a487109617), UINT64_C(0x8e47c14fda1b3b23), UINT64_C(0xaca8cc16eee25fcf),
+		UINT64_C(0xc5852b7b68c958ae), UINT64_C(0xe76a26225c303c42), UINT64_C(0x805b31c9013b9176), UINT64_C(0xa2b43c9035c2f59a), UINT64_C(0x4e391e1fbb2ccb1e), UINT64_C(0x6cd613468fd5aff2), UINT64_C(0x0be704add2de02c6), UINT64_C(0x290809f4e627662a),
+		UINT64_C(0xd9bcca76de880c04), UINT64_C(0xfb53c72fea7168e8), UINT64_C(0x9c62d0c4b77ac5dc), UINT64_C(0xbe8ddd9d8383a130), UINT64_C(0x5200ff120d6d9fb4), UINT64_C(0x70eff24b3994fb58), UINT64_C(0x17dee5a0649f566c), UINT64_C(0x3531e8f950663280),
+		UINT64_C(0x5c1c0f94d64d35e1), UINT64_C(0x7ef302cde2b4510d), UINT64_C(0x19c21526bfbffc39), UINT64_C(0x3b2d187f8b4698d5), UINT64_C(0xd7a03af005a8a651), UINT64_C(0xf54f37a93151c2bd), UINT64_C(0x927e20426c5a6f89), UINT64_C(0xb0912d1b58a30b65),
+	},
+	{
+		UINT64_C(0x0000000000000000), UINT64_C(0xdabe95afc7875f40), UINT64_C(0x27a584742000a005), UINT64_C(0xfd1b11dbe787ff45), UINT64_C(0x4f4b08e84001400a), UINT64_C(0x95f59d4787861f4a), UINT64_C(0x68ee8c9c6001e00f), UINT64_C(0xb2501933a786bf4f),
+		UINT64_C(0x9e9611d080028014), UINT64_C(0x4428847f4785df54), UINT64_C(0xb93395a4a0022011), UINT64_C(0x638d000b67857f51), UINT64_C(0xd1dd1938c003c01e), UINT64_C(0x0b638c9707849f5e), UINT64_C(0xf6789d4ce003601b), UINT64_C(0x2cc608e327843f5b),
+		UINT64_C(0xaff48c8aaf0b1ead), UINT64_C(0x754a1925688c41ed), UINT64_C(0x885108fe8f0bbea8), UINT64_C(0x52ef9d51488ce1e8), UINT64_C(0xe0bf8462ef0a5ea7), UINT64_C(0x3a0111cd288d01e7), UINT64_C(0xc71a0016cf0afea2), UINT64_C(0x1da495b9088da1e2),
+		UINT64_C(0x31629d5a2f099eb9), UINT64_C(0xebdc08f5e88ec1f9), UINT64_C(0x16c7192e0f093ebc), UINT64_C(0xcc798c81c88e61fc), UINT64_C(0x7e2995b26f08deb3), UINT64_C(0xa497001da88f81f3), UINT64_C(0x598c11c64f087eb6), UINT64_C(0x83328469888f21f6),
+		UINT64_C(0xcd31b63ef11823df), UINT64_C(0x178f2391369f7c9f), UINT64_C(0xea94324ad11883da), UINT64_C(0x302aa7e5169fdc9a), UINT64_C(0x827abed6b11963d5), UINT64_C(0x58c42b79769e3c95), UINT64_C(0xa5df3aa29119c3d0), UINT64_C(0x7f61af0d569e9c90),
+		UINT64_C(0x53a7a7ee711aa3cb), UINT64_C(0x89193241b69dfc8b), UINT64_C(0x7402239a511a03ce), UINT64_C(0xaebcb635969d5c8e), UINT64_C(0x1cecaf06311be3c1), UINT64_C(0xc6523aa9f69cbc81), UINT64_C(0x3b492b72111b43c4), UINT64_C(0xe1f7beddd69c1c84),
+		UINT64_C(0x62c53ab45e133d72), UINT64_C(0xb87baf1b99946232), UINT64_C(0x4560bec07e139d77), UINT64_C(0x9fde2b6fb994c237), UINT64_C(0x2d8e325c1e127d78), UINT64_C(0xf730a7f3d9952238), UINT64_C(0x0a2bb6283e12dd7d), UINT64_C(0xd0952387f995823d),
+		UINT64_C(0xfc532b64de11bd66), UINT64_C(0x26edbecb1996e226), UINT64_C(0xdbf6af10fe111d63), UINT64_C(0x01483abf39964223), UINT64_C(0xb318238c9e10fd6c), UINT64_C(0x69a6b6235997a22c), UINT64_C(0x94bda7f8be105d69), UINT64_C(0x4e03325779970229),
+		UINT64_C(0x08bbc3564d3e593b), UINT64_C(0xd20556f98ab9067b), UINT64_C(0x2f1e47226d3ef93e), UINT64_C(0xf5a0d28daab9a67e), UINT64_C(0x47f0cbbe0d3f1931), UINT64_C(0x9d4e5e11cab84671), UINT64_C(0x60554fca2d3fb934), UINT64_C(0xbaebda65eab8e674),
+		UINT64_C(0x962dd286cd3cd92f), UINT64_C(0x4c9347290abb866f), UINT64_C(0xb18856f2ed3c792a), UINT64_C(0x6b36c35d2abb266a), UINT64_C(0xd966da6e8d3d9925), UINT64_C(0x03d84fc14abac665), UINT64_C(0xfec35e1aad3d3920), UINT64_C(0x247dcbb56aba6660),
+		UINT64_C(0xa74f4fdce2354796), UINT64_C(0x7df1da7325b218d6), UINT64_C(0x80eacba8c235e793), UINT64_C(0x5a545e0705b2b8d3), UINT64_C(0xe8044734a234079c), UINT64_C(0x32bad29b65b358dc), UINT64_C(0xcfa1c3408234a799), UINT64_C(0x151f56ef45b3f8d9),
+		UINT64_C(0x39d95e0c6237c782), UINT64_C(0xe367cba3a5b098c2), UINT64_C(0x1e7cda7842376787), UINT64_C(0xc4c24fd785b038c7), UINT64_C(0x769256e422368788), UINT64_C(0xac2cc34be5b1d8c8), UINT64_C(0x5137d2900236278d), UINT64_C(0x8b89473fc5b178cd),
+		UINT64_C(0xc58a7568bc267ae4), UINT64_C(0x1f34e0c77ba125a4), UINT64_C(0xe22ff11c9c26dae1), UINT64_C(0x389164b35ba185a1), UINT64_C(0x8ac17d80fc273aee), UINT64_C(0x507fe82f3ba065ae), UINT64_C(0xad64f9f4dc279aeb), UINT64_C(0x77da6c5b1ba0c5ab),
+		UINT64_C(0x5b1c64b83c24faf0), UINT64_C(0x81a2f117fba3a5b0), UINT64_C(0x7cb9e0cc1c245af5), UINT64_C(0xa6077563dba305b5), UINT64_C(0x14576c507c25bafa), UINT64_C(0xcee9f9ffbba2e5ba), UINT64_C(0x33f2e8245c251aff), UINT64_C(0xe94c7d8b9ba245bf),
+		UINT64_C(0x6a7ef9e2132d6449), UINT64_C(0xb0c06c4dd4aa3b09), UINT64_C(0x4ddb7d96332dc44c), UINT64_C(0x9765e839f4aa9b0c), UINT64_C(0x2535f10a532c2443), UINT64_C(0xff8b64a594ab7b03), UINT64_C(0x0290757e732c8446), UINT64_C(0xd82ee0d1b4abdb06),
+		UINT64_C(0xf4e8e832932fe45d), UINT64_C(0x2e567d9d54a8bb1d), UINT64_C(0xd34d6c46b32f4458), UINT64_C(0x09f3f9e974a81b18), UINT64_C(0xbba3e0dad32ea457), UINT64_C(0x611d757514a9fb17), UINT64_C(0x9c0664aef32e0452), UINT64_C(0x46b8f10134a95b12),
+		UINT64_C(0x117786ac9a7cb276), UINT64_C(0xcbc913035dfbed36), UINT64_C(0x36d202d8ba7c1273), UINT64_C(0xec6c97777dfb4d33), UINT64_C(0x5e3c8e44da7df27c), UINT64_C(0x84821beb1dfaad3c), UINT64_C(0x79990a30fa7d5279), UINT64_C(0xa3279f9f3dfa0d39),
+		UINT64_C(0x8fe1977c1a7e3262), UINT64_C(0x555f02d3ddf96d22), UINT64_C(0xa84413083a7e9267), UINT64_C(0x72fa86a7fdf9cd27), UINT64_C(0xc0aa9f945a7f7268), UINT64_C(0x1a140a3b9df82d28), UINT64_C(0xe70f1be07a7fd26d), UINT64_C(0x3db18e4fbdf88d2d),
+		UINT64_C(0xbe830a263577acdb), UINT64_C(0x643d9f89f2f0f39b), UINT64_C(0x99268e5215770cde), UINT64_C(0x43981bfdd2f0539e), UINT64_C(0xf1c802ce7576ecd1), UINT64_C(0x2b769761b2f1b391), UINT64_C(0xd66d86ba55764cd4), UINT64_C(0x0cd3131592f11394),
+		UINT64_C(0x20151bf6b5752ccf), UINT64_C(0xfaab8e5972f2738f), UINT64_C(0x07b09f8295758cca), UINT64_C(0xdd0e0a2d52f2d38a), UINT64_C(0x6f5e131ef5746cc5), UINT64_C(0xb5e086b132f33385), UINT64_C(0x48fb976ad574ccc0), UINT64_C(0x924502c512f39380),
+		UINT64_C(0xdc4630926b6491a9), UINT64_C(0x06f8a53dace3cee9), UINT64_C(0xfbe3b4e64b6431ac), UINT64_C(0x215d21498ce36eec), UINT64_C(0x930d387a2b65d1a3), UINT64_C(0x49b3add5ece28ee3), UINT64_C(0xb4a8bc0e0b6571a6), UINT64_C(0x6e1629a1cce22ee6),
+		UINT64_C(0x42d02142eb6611bd), UINT64_C(0x986eb4ed2ce14efd), UINT64_C(0x6575a536cb66b1b8), UINT64_C(0xbfcb30990ce1eef8), UINT64_C(0x0d9b29aaab6751b7), UINT64_C(0xd725bc056ce00ef7), UINT64_C(0x2a3eadde8b67f1b2), UINT64_C(0xf08038714ce0aef2),
+		UINT64_C(0x73b2bc18c46f8f04), UINT64_C(0xa90c29b703e8d044), UINT64_C(0x5417386ce46f2f01), UINT64_C(0x8ea9adc323e87041), UINT64_C(0x3cf9b4f0846ecf0e), UINT64_C(0xe647215f43e9904e), UINT64_C(0x1b5c3084a46e6f0b), UINT64_C(0xc1e2a52b63e9304b),
+		UINT64_C(0xed24adc8446d0f10), UINT64_C(0x379a386783ea5050), UINT64_C(0xca8129bc646daf15), UINT64_C(0x103fbc13a3eaf055), UINT64_C(0xa26fa520046c4f1a), UINT64_C(0x78d1308fc3eb105a), UINT64_C(0x85ca2154246cef1f), UINT64_C(0x5f74b4fbe3ebb05f),
+		UINT64_C(0x19cc45fad742eb4d), UINT64_C(0xc372d05510c5b40d), UINT64_C(0x3e69c18ef7424b48), UINT64_C(0xe4d7542130c51408), UINT64_C(0x56874d129743ab47), UINT64_C(0x8c39d8bd50c4f407), UINT64_C(0x7122c966b7430b42), UINT64_C(0xab9c5cc970c45402),
+		UINT64_C(0x875a542a57406b59), UINT64_C(0x5de4c18590c73419), UINT64_C(0xa0ffd05e7740cb5c), UINT64_C(0x7a4145f1b0c7941c), UINT64_C(0xc8115cc217412b53), UINT64_C(0x12afc96dd0c67413), UINT64_C(0xefb4d8b637418b56), UINT64_C(0x350a4d19f0c6d416),
+		UINT64_C(0xb638c9707849f5e0), UINT64_C(0x6c865cdfbfceaaa0), UINT64_C(0x919d4d04584955e5), UINT64_C(0x4b23d8ab9fce0aa5), UINT64_C(0xf973c1983848b5ea), UINT64_C(0x23cd5437ffcfeaaa), UINT64_C(0xded645ec184815ef), UINT64_C(0x0468d043dfcf4aaf),
+		UINT64_C(0x28aed8a0f84b75f4), UINT64_C(0xf2104d0f3fcc2ab4), UINT64_C(0x0f0b5cd4d84bd5f1), UINT64_C(0xd5b5c97b1fcc8ab1), UINT64_C(0x67e5d048b84a35fe), UINT64_C(0xbd5b45e77fcd6abe), UINT64_C(0x4040543c984a95fb), UINT64_C(0x9afec1935fcdcabb),
+		UINT64_C(0xd4fdf3c4265ac892), UINT64_C(0x0e43666be1dd97d2), UINT64_C(0xf35877b0065a6897), UINT64_C(0x29e6e21fc1dd37d7), UINT64_C(0x9bb6fb2c665b8898), UINT64_C(0x41086e83a1dcd7d8), UINT64_C(0xbc137f58465b289d), UINT64_C(0x66adeaf781dc77dd),
+		UINT64_C(0x4a6be214a6584886), UINT64_C(0x90d577bb61df17c6), UINT64_C(0x6dce66608658e883), UINT64_C(0xb770f3cf41dfb7c3), UINT64_C(0x0520eafce659088c), UINT64_C(0xdf9e7f5321de57cc), UINT64_C(0x22856e88c659a889), UINT64_C(0xf83bfb2701def7c9),
+		UINT64_C(0x7b097f4e8951d63f), UINT64_C(0xa1b7eae14ed6897f), UINT64_C(0x5cacfb3aa951763a), UINT64_C(0x86126e956ed6297a), UINT64_C(0x344277a6c9509635), UINT64_C(0xeefce2090ed7c975), UINT64_C(0x13e7f3d2e9503630), UINT64_C(0xc959667d2ed76970),
+		UINT64_C(0xe59f6e9e0953562b), UINT64_C(0x3f21fb31ced4096b), UINT64_C(0xc23aeaea2953f62e), UINT64_C(0x18847f45eed4a96e), UINT64_C(0xaad4667649521621), UINT64_C(0x706af3d98ed54961), UINT64_C(0x8d71e2026952b624), UINT64_C(0x57cf77adaed5e964),
+	},
+}
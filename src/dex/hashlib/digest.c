@@ -0,0 +1,493 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_HASHLIB_DIGEST_C
+#define GUARD_DEX_HASHLIB_DIGEST_C 1
+#define CONFIG_BUILDING_LIBHASH
+#define DEE_SOURCE
+
+#include "libhash.h"
+/**/
+
+#include <deemon/api.h>
+#include <deemon/system-features.h> /* memcpy() */
+
+#include <hybrid/__rotate.h>
+#include <hybrid/byteswap.h>
+#include <hybrid/typecore.h>
+#include <hybrid/unaligned.h>
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#define HAVE_SHA256_SHANI
+#endif /* __SHA__ && __SSE4_1__ */
+
+DECL_BEGIN
+
+/* Non-CRC hash algorithms. All of these implement `struct dhashalgos', meaning
+ * their state is kept in a `union dhashstate', which (unlike with CRCs) cannot
+ * be recovered from a previously calculated hash value. */
+
+#define ROL32(x, n) __hybrid_rol32(x, n)
+#define ROR32(x, n) __hybrid_ror32(x, n)
+#define ROL64(x, n) __hybrid_rol64(x, n)
+
+
+
+/************************************************************************/
+/* xxHash64                                                             */
+/************************************************************************/
+#define XXH_PRIME64_1 UINT64_C(0x9e3779b185ebca87)
+#define XXH_PRIME64_2 UINT64_C(0xc2b2ae3d27d4eb4f)
+#define XXH_PRIME64_3 UINT64_C(0x165667b19e3779f9)
+#define XXH_PRIME64_4 UINT64_C(0x85ebca77c2b2ae63)
+#define XXH_PRIME64_5 UINT64_C(0x27d4eb2f165667c5)
+
+struct xxh64_state {
+	uint64_t xs_acc[4];  /* Lane accumulators */
+	uint64_t xs_seed;    /* Seed (needed for inputs of less than 32 bytes) */
+	uint64_t xs_total;   /* Total # of bytes fed */
+	uint8_t  xs_buf[32]; /* Incomplete stripe (`xs_total % 32' bytes) */
+};
+
+LOCAL ATTR_CONST uint64_t DCALL
+xxh64_round(uint64_t acc, uint64_t input) {
+	acc += input * XXH_PRIME64_2;
+	acc = ROL64(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+LOCAL ATTR_CONST uint64_t DCALL
+xxh64_merge(uint64_t acc, uint64_t val) {
+	acc ^= xxh64_round(0, val);
+	return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/* Consume `nstripes' 32-byte stripes from `data' */
+PRIVATE NONNULL((1, 2)) void DCALL
+xxh64_stripes(uint64_t acc[4], uint8_t const *data, size_t nstripes) {
+	uint64_t v1 = acc[0], v2 = acc[1], v3 = acc[2], v4 = acc[3];
+	for (; nstripes; --nstripes, data += 32) {
+		v1 = xxh64_round(v1, UNALIGNED_GETLE64(data + 0));
+		v2 = xxh64_round(v2, UNALIGNED_GETLE64(data + 8));
+		v3 = xxh64_round(v3, UNALIGNED_GETLE64(data + 16));
+		v4 = xxh64_round(v4, UNALIGNED_GETLE64(data + 24));
+	}
+	acc[0] = v1;
+	acc[1] = v2;
+	acc[2] = v3;
+	acc[3] = v4;
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+xxh64_init(void *__restrict state, void const *__restrict key) {
+	struct xxh64_state *me = (struct xxh64_state *)state;
+	uint64_t seed = UNALIGNED_GETLE64(key);
+	me->xs_acc[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+	me->xs_acc[1] = seed + XXH_PRIME64_2;
+	me->xs_acc[2] = seed;
+	me->xs_acc[3] = seed - XXH_PRIME64_1;
+	me->xs_seed   = seed;
+	me->xs_total  = 0;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+xxh64_update(void *__restrict state, void const *data, size_t datasize) {
+	struct xxh64_state *me = (struct xxh64_state *)state;
+	uint8_t const *p = (uint8_t const *)data;
+	size_t used = (size_t)(me->xs_total % 32);
+	me->xs_total += datasize;
+	if (used) {
+		size_t missing = 32 - used;
+		if (datasize < missing) {
+			memcpy(me->xs_buf + used, p, datasize);
+			return;
+		}
+		memcpy(me->xs_buf + used, p, missing);
+		xxh64_stripes(me->xs_acc, me->xs_buf, 1);
+		p += missing;
+		datasize -= missing;
+	}
+	xxh64_stripes(me->xs_acc, p, datasize / 32);
+	p += datasize & ~31;
+	memcpy(me->xs_buf, p, datasize % 32);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+xxh64_final(void *__restrict state, void *__restrict result) {
+	struct xxh64_state *me = (struct xxh64_state *)state;
+	uint8_t const *p = me->xs_buf;
+	size_t tail = (size_t)(me->xs_total % 32);
+	uint64_t h;
+	if (me->xs_total >= 32) {
+		h = ROL64(me->xs_acc[0], 1) + ROL64(me->xs_acc[1], 7) +
+		    ROL64(me->xs_acc[2], 12) + ROL64(me->xs_acc[3], 18);
+		h = xxh64_merge(h, me->xs_acc[0]);
+		h = xxh64_merge(h, me->xs_acc[1]);
+		h = xxh64_merge(h, me->xs_acc[2]);
+		h = xxh64_merge(h, me->xs_acc[3]);
+	} else {
+		h = me->xs_seed + XXH_PRIME64_5;
+	}
+	h += me->xs_total;
+	for (; tail >= 8; tail -= 8, p += 8) {
+		h ^= xxh64_round(0, UNALIGNED_GETLE64(p));
+		h = ROL64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+	}
+	if (tail >= 4) {
+		h ^= (uint64_t)UNALIGNED_GETLE32(p) * XXH_PRIME64_1;
+		h = ROL64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		tail -= 4;
+		p += 4;
+	}
+	for (; tail; --tail, ++p) {
+		h ^= (*p) * XXH_PRIME64_5;
+		h = ROL64(h, 11) * XXH_PRIME64_1;
+	}
+	h ^= h >> 33;
+	h *= XXH_PRIME64_2;
+	h ^= h >> 29;
+	h *= XXH_PRIME64_3;
+	h ^= h >> 32;
+	UNALIGNED_SETBE64(result, h);
+}
+
+PRIVATE char const *const dhash_xxh64_alias_names[] = { "XXHASH64", "XXHASH-64", NULL };
+INTERN struct dhashalgos const dhash_xxh64 = {
+	{
+		"XXH64",
+		dhash_xxh64_alias_names,
+		64,
+		8,
+		HASHALGO_FSTREAM,
+		{
+			NULL
+		}
+	},
+	8,
+	&xxh64_init,
+	&xxh64_update,
+	&xxh64_final
+};
+
+
+
+/************************************************************************/
+/* SipHash-2-4                                                          */
+/************************************************************************/
+struct siphash_state {
+	uint64_t ss_v[4];   /* Internal state */
+	uint64_t ss_total;  /* Total # of bytes fed */
+	uint8_t  ss_buf[8]; /* Incomplete word (`ss_total % 8' bytes) */
+};
+
+#define SIPROUND(v0, v1, v2, v3) \
+	(v0 += v1, v1 = ROL64(v1, 13), v1 ^= v0, v0 = ROL64(v0, 32), \
+	 v2 += v3, v3 = ROL64(v3, 16), v3 ^= v2,                     \
+	 v0 += v3, v3 = ROL64(v3, 21), v3 ^= v0,                     \
+	 v2 += v1, v1 = ROL64(v1, 17), v1 ^= v2, v2 = ROL64(v2, 32))
+
+PRIVATE NONNULL((1, 2)) void DCALL
+siphash_words(uint64_t v[4], uint8_t const *data, size_t nwords) {
+	uint64_t v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];
+	for (; nwords; --nwords, data += 8) {
+		uint64_t m = UNALIGNED_GETLE64(data);
+		v3 ^= m;
+		SIPROUND(v0, v1, v2, v3);
+		SIPROUND(v0, v1, v2, v3);
+		v0 ^= m;
+	}
+	v[0] = v0;
+	v[1] = v1;
+	v[2] = v2;
+	v[3] = v3;
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+siphash_init(void *__restrict state, void const *__restrict key) {
+	struct siphash_state *me = (struct siphash_state *)state;
+	uint64_t k0 = UNALIGNED_GETLE64((uint8_t const *)key + 0);
+	uint64_t k1 = UNALIGNED_GETLE64((uint8_t const *)key + 8);
+	me->ss_v[0]  = k0 ^ UINT64_C(0x736f6d6570736575);
+	me->ss_v[1]  = k1 ^ UINT64_C(0x646f72616e646f6d);
+	me->ss_v[2]  = k0 ^ UINT64_C(0x6c7967656e657261);
+	me->ss_v[3]  = k1 ^ UINT64_C(0x7465646279746573);
+	me->ss_total = 0;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+siphash_update(void *__restrict state, void const *data, size_t datasize) {
+	struct siphash_state *me = (struct siphash_state *)state;
+	uint8_t const *p = (uint8_t const *)data;
+	size_t used = (size_t)(me->ss_total % 8);
+	me->ss_total += datasize;
+	if (used) {
+		size_t missing = 8 - used;
+		if (datasize < missing) {
+			memcpy(me->ss_buf + used, p, datasize);
+			return;
+		}
+		memcpy(me->ss_buf + used, p, missing);
+		siphash_words(me->ss_v, me->ss_buf, 1);
+		p += missing;
+		datasize -= missing;
+	}
+	siphash_words(me->ss_v, p, datasize / 8);
+	p += datasize & ~7;
+	memcpy(me->ss_buf, p, datasize % 8);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+siphash_final(void *__restrict state, void *__restrict result) {
+	struct siphash_state *me = (struct siphash_state *)state;
+	uint64_t v0 = me->ss_v[0], v1 = me->ss_v[1];
+	uint64_t v2 = me->ss_v[2], v3 = me->ss_v[3];
+	uint64_t b = me->ss_total << 56;
+	size_t i, tail = (size_t)(me->ss_total % 8);
+	for (i = 0; i < tail; ++i)
+		b |= (uint64_t)me->ss_buf[i] << (i * 8);
+	v3 ^= b;
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	v0 ^= b;
+	v2 ^= 0xff;
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	SIPROUND(v0, v1, v2, v3);
+	UNALIGNED_SETBE64(result, v0 ^ v1 ^ v2 ^ v3);
+}
+
+PRIVATE char const *const dhash_siphash_2_4_alias_names[] = { "SIPHASH", NULL };
+INTERN struct dhashalgos const dhash_siphash_2_4 = {
+	{
+		"SIPHASH-2-4",
+		dhash_siphash_2_4_alias_names,
+		64,
+		8,
+		HASHALGO_FSTREAM,
+		{
+			NULL
+		}
+	},
+	16,
+	&siphash_init,
+	&siphash_update,
+	&siphash_final
+};
+
+
+
+/************************************************************************/
+/* SHA-256                                                              */
+/************************************************************************/
+struct sha256_state {
+	uint32_t ss_h[8];    /* Intermediate hash value */
+	uint64_t ss_total;   /* Total # of bytes fed */
+	uint8_t  ss_buf[64]; /* Incomplete block (`ss_total % 64' bytes) */
+};
+
+PRIVATE uint32_t const sha256_k[64] = {
+	UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5),
+	UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+	UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3),
+	UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+	UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc),
+	UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+	UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7),
+	UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+	UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13),
+	UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+	UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3),
+	UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+	UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5),
+	UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+	UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208),
+	UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2),
+};
+
+#ifdef HAVE_SHA256_SHANI
+/* Process `nblocks' 64-byte blocks using the SHA extensions. These keep the
+ * state as 2 vectors (ABEF and CDGH), perform 2 rounds per `sha256rnds2', and
+ * let `sha256msg1' / `sha256msg2' compute the message schedule 4 words at a time. */
+PRIVATE NONNULL((1, 2)) void DCALL
+sha256_blocks(uint32_t h[8], uint8_t const *data, size_t nblocks) {
+	__m128i const bswap = _mm_set_epi64x(INT64_C(0x0c0d0e0f08090a0b), INT64_C(0x0405060700010203));
+	__m128i abef, cdgh, tmp;
+	tmp  = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const *)&h[0]), 0xb1); /* CDAB */
+	cdgh = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const *)&h[4]), 0x1b); /* EFGH */
+	abef = _mm_alignr_epi8(tmp, cdgh, 8);
+	cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+	for (; nblocks; --nblocks, data += 64) {
+		__m128i w[4], msg;
+		__m128i abef_save = abef;
+		__m128i cdgh_save = cdgh;
+		unsigned int g;
+		for (g = 0; g < 16; ++g) {
+			if (g < 4)
+				w[g] = _mm_shuffle_epi8(_mm_loadu_si128((__m128i const *)(data + g * 16)), bswap);
+			msg  = _mm_add_epi32(w[g & 3], _mm_loadu_si128((__m128i const *)&sha256_k[g * 4]));
+			cdgh = _mm_sha256rnds2_epu32(cdgh, abef, msg);
+			if (g >= 3 && g < 15) {
+				tmp = _mm_alignr_epi8(w[g & 3], w[(g - 1) & 3], 4);
+				w[(g + 1) & 3] = _mm_add_epi32(w[(g + 1) & 3], tmp);
+				w[(g + 1) & 3] = _mm_sha256msg2_epu32(w[(g + 1) & 3], w[g & 3]);
+			}
+			msg  = _mm_shuffle_epi32(msg, 0x0e);
+			abef = _mm_sha256rnds2_epu32(abef, cdgh, msg);
+			if (g >= 1 && g < 13)
+				w[(g - 1) & 3] = _mm_sha256msg1_epu32(w[(g - 1) & 3], w[g & 3]);
+		}
+		abef = _mm_add_epi32(abef, abef_save);
+		cdgh = _mm_add_epi32(cdgh, cdgh_save);
+	}
+	tmp  = _mm_shuffle_epi32(abef, 0x1b); /* FEBA */
+	cdgh = _mm_shuffle_epi32(cdgh, 0xb1); /* DCHG */
+	_mm_storeu_si128((__m128i *)&h[0], _mm_blend_epi16(tmp, cdgh, 0xf0)); /* DCBA */
+	_mm_storeu_si128((__m128i *)&h[4], _mm_alignr_epi8(cdgh, tmp, 8));   /* HGFE */
+}
+#else /* HAVE_SHA256_SHANI */
+#define SHA256_CH(x, y, z)  (((x) & (y)) ^ (~(x) & (z)))
+#define SHA256_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SHA256_EP0(x)       (ROR32(x, 2) ^ ROR32(x, 13) ^ ROR32(x, 22))
+#define SHA256_EP1(x)       (ROR32(x, 6) ^ ROR32(x, 11) ^ ROR32(x, 25))
+#define SHA256_SIG0(x)      (ROR32(x, 7) ^ ROR32(x, 18) ^ ((x) >> 3))
+#define SHA256_SIG1(x)      (ROR32(x, 17) ^ ROR32(x, 19) ^ ((x) >> 10))
+
+/* Process `nblocks' 64-byte blocks */
+PRIVATE NONNULL((1, 2)) void DCALL
+sha256_blocks(uint32_t h[8], uint8_t const *data, size_t nblocks) {
+	for (; nblocks; --nblocks, data += 64) {
+		uint32_t w[64], a, b, c, d, e, f, g, hh;
+		unsigned int i;
+		for (i = 0; i < 16; ++i)
+			w[i] = UNALIGNED_GETBE32(data + i * 4);
+		for (; i < 64; ++i)
+			w[i] = SHA256_SIG1(w[i - 2]) + w[i - 7] + SHA256_SIG0(w[i - 15]) + w[i - 16];
+		a  = h[0];
+		b  = h[1];
+		c  = h[2];
+		d  = h[3];
+		e  = h[4];
+		f  = h[5];
+		g  = h[6];
+		hh = h[7];
+		for (i = 0; i < 64; ++i) {
+			uint32_t t1 = hh + SHA256_EP1(e) + SHA256_CH(e, f, g) + sha256_k[i] + w[i];
+			uint32_t t2 = SHA256_EP0(a) + SHA256_MAJ(a, b, c);
+			hh = g;
+			g  = f;
+			f  = e;
+			e  = d + t1;
+			d  = c;
+			c  = b;
+			b  = a;
+			a  = t1 + t2;
+		}
+		h[0] += a;
+		h[1] += b;
+		h[2] += c;
+		h[3] += d;
+		h[4] += e;
+		h[5] += f;
+		h[6] += g;
+		h[7] += hh;
+	}
+}
+#endif /* !HAVE_SHA256_SHANI */
+
+PRIVATE NONNULL((1, 2)) void DCALL
+sha256_init(void *__restrict state, void const *__restrict UNUSED(key)) {
+	struct sha256_state *me = (struct sha256_state *)state;
+	me->ss_h[0]  = UINT32_C(0x6a09e667);
+	me->ss_h[1]  = UINT32_C(0xbb67ae85);
+	me->ss_h[2]  = UINT32_C(0x3c6ef372);
+	me->ss_h[3]  = UINT32_C(0xa54ff53a);
+	me->ss_h[4]  = UINT32_C(0x510e527f);
+	me->ss_h[5]  = UINT32_C(0x9b05688c);
+	me->ss_h[6]  = UINT32_C(0x1f83d9ab);
+	me->ss_h[7]  = UINT32_C(0x5be0cd19);
+	me->ss_total = 0;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+sha256_update(void *__restrict state, void const *data, size_t datasize) {
+	struct sha256_state *me = (struct sha256_state *)state;
+	uint8_t const *p = (uint8_t const *)data;
+	size_t used = (size_t)(me->ss_total % 64);
+	me->ss_total += datasize;
+	if (used) {
+		size_t missing = 64 - used;
+		if (datasize < missing) {
+			memcpy(me->ss_buf + used, p, datasize);
+			return;
+		}
+		memcpy(me->ss_buf + used, p, missing);
+		sha256_blocks(me->ss_h, me->ss_buf, 1);
+		p += missing;
+		datasize -= missing;
+	}
+	sha256_blocks(me->ss_h, p, datasize / 64);
+	p += datasize & ~63;
+	memcpy(me->ss_buf, p, datasize % 64);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+sha256_final(void *__restrict state, void *__restrict result) {
+	struct sha256_state *me = (struct sha256_state *)state;
+	uint64_t nbits = me->ss_total * 8;
+	size_t i, used = (size_t)(me->ss_total % 64);
+	me->ss_buf[used++] = 0x80;
+	if (used > 56) {
+		bzero(me->ss_buf + used, 64 - used);
+		sha256_blocks(me->ss_h, me->ss_buf, 1);
+		used = 0;
+	}
+	bzero(me->ss_buf + used, 56 - used);
+	UNALIGNED_SETBE64(me->ss_buf + 56, nbits);
+	sha256_blocks(me->ss_h, me->ss_buf, 1);
+	for (i = 0; i < 8; ++i)
+		UNALIGNED_SETBE32((uint8_t *)result + i * 4, me->ss_h[i]);
+}
+
+PRIVATE char const *const dhash_sha_256_alias_names[] = { "SHA256", "SHA-2-256", NULL };
+INTERN struct dhashalgos const dhash_sha_256 = {
+	{
+		"SHA-256",
+		dhash_sha_256_alias_names,
+		256,
+		32,
+		HASHALGO_FSTREAM,
+		{
+			NULL
+		}
+	},
+	0,
+	&sha256_init,
+	&sha256_update,
+	&sha256_final
+};
+
+STATIC_ASSERT(sizeof(struct xxh64_state) <= DHASHSTREAM_STATE_MAX);
+STATIC_ASSERT(sizeof(struct siphash_state) <= DHASHSTREAM_STATE_MAX);
+STATIC_ASSERT(sizeof(struct sha256_state) <= DHASHSTREAM_STATE_MAX);
+
+DECL_END
+
+#endif /* !GUARD_DEX_HASHLIB_DIGEST_C */
@@ -0,0 +1,230 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_HASHLIB_HASHER_C
+#define GUARD_DEX_HASHLIB_HASHER_C 1
+#define CONFIG_BUILDING_LIBHASH
+#define DEE_SOURCE
+
+#include "libhash.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/error.h>
+#include <deemon/format.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* memcpy() */
+
+DECL_BEGIN
+
+PRIVATE DEFINE_KWLIST(hasher_kwlist, { K(name), K(start), KEND });
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+hasher_init_kw(DeeHasherObject *__restrict self, size_t argc,
+               DeeObject *const *argv, DeeObject *kw) {
+	char const *name;
+	DeeObject *start = NULL;
+	if (DeeArg_UnpackKw(argc, argv, kw, hasher_kwlist, "s|o:Hasher", &name, &start))
+		goto err;
+	self->h_algo = dhashalgo_find(name);
+	if unlikely(!self->h_algo)
+		goto err;
+	if unlikely(dhashstate_init(&self->h_state, self->h_algo, start))
+		goto err;
+	Dee_shared_lock_init(&self->h_lock);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+hasher_copy(DeeHasherObject *__restrict self,
+            DeeHasherObject *__restrict other) {
+	if (DeeHasher_LockAcquire(other))
+		goto err;
+	self->h_algo = other->h_algo;
+	dhashstate_initcopy(&self->h_state, &other->h_state, other->h_algo);
+	DeeHasher_LockRelease(other);
+	Dee_shared_lock_init(&self->h_lock);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+hasher_fini(DeeHasherObject *__restrict self) {
+	dhashstate_fini(&self->h_state, self->h_algo);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+hasher_printrepr(DeeHasherObject *__restrict self,
+                 dformatprinter printer, void *arg) {
+	return DeeFormat_Printf(printer, arg, "Hasher(%q)", self->h_algo->ha_name);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+hasher_update(DeeHasherObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *data;
+	if (DeeArg_Unpack(argc, argv, "o:update", &data))
+		goto err;
+	/* Only lock `h_state' while it's being updated: reading
+	 * from a File may run user-code that uses `self', too. */
+	if unlikely(dhashstate_feed(&self->h_state, self->h_algo, &self->h_lock, data))
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+hasher_reset(DeeHasherObject *self, size_t argc,
+             DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *start = NULL;
+	union dhashstate state, old_state;
+	PRIVATE DEFINE_KWLIST(kwlist, { K(start), KEND });
+	if (DeeArg_UnpackKw(argc, argv, kw, kwlist, "|o:reset", &start))
+		goto err;
+	if unlikely(dhashstate_init(&state, self->h_algo, start))
+		goto err;
+	if (DeeHasher_LockAcquire(self))
+		goto err_state;
+	memcpy(&old_state, &self->h_state, sizeof(union dhashstate));
+	memcpy(&self->h_state, &state, sizeof(union dhashstate)); /* Inherit reference */
+	DeeHasher_LockRelease(self);
+	dhashstate_fini(&old_state, self->h_algo);
+	return_none;
+err_state:
+	dhashstate_fini(&state, self->h_algo);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+hasher_getresult(DeeHasherObject *__restrict self) {
+	DREF DeeObject *result;
+	if (DeeHasher_LockAcquire(self))
+		goto err;
+	result = dhashstate_result(&self->h_state, self->h_algo);
+	DeeHasher_LockRelease(self);
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+hasher_getname(DeeHasherObject *__restrict self) {
+	return DeeString_New(self->h_algo->ha_name);
+}
+
+PRIVATE struct type_method tpconst hasher_methods[] = {
+	TYPE_METHOD("update", &hasher_update,
+	            "(data:?X3?Dstring?DBytes?DFile)\n"
+	            "Feed @data into the hash. Strings are hashed as UTF-8, and files "
+	            /**/ "are read (in chunks) until their end"),
+	TYPE_KWMETHOD("reset", &hasher_reset,
+	              "(start?:?Dint)\n"
+	              "Discard all data fed thus far and start over (s.a. ?#{op:constructor})"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst hasher_getsets[] = {
+	TYPE_GETTER("result", &hasher_getresult,
+	            "->?Dint\n"
+	            "The hash of all data fed thus far. Reading this doesn't "
+	            /**/ "prevent more data from being fed afterwards"),
+	TYPE_GETTER("name", &hasher_getname,
+	            "->?Dstring\n"
+	            "The (canonical) name of the hash algorithm being used"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeHasher_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Hasher",
+	/* .tp_doc      = */ DOC("Incrementally calculate a hash, such that data can be fed in "
+	                         /**/ "multiple parts. Works with every algorithm supported by "
+	                         /**/ "?Ghash, including those that can't be resumed from a "
+	                         /**/ "previously calculated hash value (like $\"SHA-256\")\n"
+	                         "${"
+	                         /**/ "import Hasher from hashlib;\n"
+	                         /**/ "local h = Hasher(\"SHA-256\");\n"
+	                         /**/ "with (local fp = File.open(\"data.bin\"))\n"
+	                         /**/ "	h.update(fp);\n"
+	                         /**/ "print h.result.hex();"
+	                         "}\n"
+	                         "\n"
+	                         "(name:?Dstring,start?:?Dint)\n"
+	                         "#tValueError{Unknown hash algorithm @name, or @start "
+	                         /*             */ "isn't supported by the algorithm}"
+	                         "Begin hashing using algorithm @name (s.a. ?Ghash for @start)\n"
+	                         "\n"
+	                         "copy->\n"
+	                         "Duplicate the current state, e.g. to hash multiple "
+	                         /**/ "inputs that share a common prefix"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)&hasher_copy,
+				/* .tp_deep_ctor = */ (dfunptr_t)&hasher_copy,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeHasherObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&hasher_init_kw
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&hasher_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL,
+		/* .tp_print     = */ NULL,
+		/* .tp_printrepr = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&hasher_printrepr
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ hasher_methods,
+	/* .tp_getsets       = */ hasher_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_HASHLIB_HASHER_C */
@@ -0,0 +1,94 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+
+/* Slicing-by-8 implementation of reflected 32- and 64-bit CRCs.
+ *
+ * Rather than feeding 1 byte at a time through `ha_table', 8 bytes are read
+ * at once, and each of them is looked up in a different table that already
+ * accounts for the number of zero-bytes that would follow it. The 8 partial
+ * results are then combined with a single XOR-tree, which cuts the length
+ * of the dependency chain per input byte by a factor of 8.
+ *
+ * Only used for algorithms where input and output are reflected, and the
+ * CRC width matches the hash size (iow: no shifting is needed). */
+
+#ifndef WIDTH
+#error "Must '#define WIDTH' before #including this file"
+#endif
+#if WIDTH != 32 && WIDTH != 64
+#error "'WIDTH' must be defined as 32|64"
+#endif
+
+#define HASH_T PP_CAT3(uint, WIDTH, _t)
+#define NAME   PP_CAT3(_hashimpl_, WIDTH, _ioref_slice8)
+#define ALGO   PP_CAT3(dhashalgo, WIDTH, x8)
+
+/* Table `n' is used for a byte that is followed by `n' more bytes. */
+#define SLICE(n) ((n) ? self->ha_slice[(n) - 1] : self->ha_table)
+
+PRIVATE HASH_T DCALL
+NAME(struct ALGO const *self, HASH_T start, void const *data, size_t datasize) {
+	__BYTE_TYPE__ const *p = (__BYTE_TYPE__ const *)data;
+	ASSERT(self);
+	ASSERT(self->ha_base.ha_width == WIDTH);
+	ASSERT(self->ha_base.ha_size == WIDTH / 8);
+	ASSERT(!datasize || p);
+
+	/* Align the input pointer, so the 8-byte loads below are naturally aligned. */
+	while (datasize && ((uintptr_t)p & 7)) {
+		start = (HASH_T)(self->ha_table[(uint8_t)(start ^ *p++)] ^ (start >> 8));
+		--datasize;
+	}
+	while (datasize >= 8) {
+#if WIDTH == 32
+		uint32_t lo = UNALIGNED_GETLE32(p + 0) ^ start;
+		uint32_t hi = UNALIGNED_GETLE32(p + 4);
+		start = SLICE(7)[(uint8_t)(lo)] ^
+		        SLICE(6)[(uint8_t)(lo >> 8)] ^
+		        SLICE(5)[(uint8_t)(lo >> 16)] ^
+		        SLICE(4)[(uint8_t)(lo >> 24)] ^
+		        SLICE(3)[(uint8_t)(hi)] ^
+		        SLICE(2)[(uint8_t)(hi >> 8)] ^
+		        SLICE(1)[(uint8_t)(hi >> 16)] ^
+		        SLICE(0)[(uint8_t)(hi >> 24)];
+#else /* WIDTH == 32 */
+		uint64_t word = UNALIGNED_GETLE64(p) ^ start;
+		start = SLICE(7)[(uint8_t)(word)] ^
+		        SLICE(6)[(uint8_t)(word >> 8)] ^
+		        SLICE(5)[(uint8_t)(word >> 16)] ^
+		        SLICE(4)[(uint8_t)(word >> 24)] ^
+		        SLICE(3)[(uint8_t)(word >> 32)] ^
+		        SLICE(2)[(uint8_t)(word >> 40)] ^
+		        SLICE(1)[(uint8_t)(word >> 48)] ^
+		        SLICE(0)[(uint8_t)(word >> 56)];
+#endif /* WIDTH != 32 */
+		p += 8;
+		datasize -= 8;
+	}
+	while (datasize--)
+		start = (HASH_T)(self->ha_table[(uint8_t)(start ^ *p++)] ^ (start >> 8));
+	return start;
+}
+
+#undef SLICE
+#undef ALGO
+#undef NAME
+#undef HASH_T
+#undef WIDTH
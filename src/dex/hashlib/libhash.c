@@ -23,13 +23,138 @@
 #define DEE_SOURCE
 
 #include "libhash.h"
+#include <deemon/alloc.h>
 #include <deemon/arg.h>
 #include <deemon/int.h>
 #include <deemon/error.h>
+#include <deemon/file.h>
 #include <deemon/objmethod.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* bzero(), memcpy() */
+
+#include <hybrid/byteswap.h>
+#include <hybrid/unaligned.h>
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#define HAVE_HASHIMPL_CRC32C_SSE42
+#endif /* __SSE4_2__ */
+#ifdef __PCLMUL__
+#include <wmmintrin.h>
+#define HAVE_HASHIMPL_CRC32_PCLMUL
+#endif /* __PCLMUL__ */
+
+/* The 32-bit slicing-by-8 implementation is only used by CRCs without hardware support */
+#if !defined(HAVE_HASHIMPL_CRC32C_SSE42) || !defined(HAVE_HASHIMPL_CRC32_PCLMUL)
+#define HAVE_HASHIMPL_32_IOREF_SLICE8
+#endif /* !HAVE_HASHIMPL_CRC32C_SSE42 || !HAVE_HASHIMPL_CRC32_PCLMUL */
 
 DECL_BEGIN
 
+/* Hardware-accelerated CRC implementations. Like everything else that uses
+ * SIMD in deemon, these are selected at compile-time (i.e. they're only used
+ * if the compiler is allowed to emit the relevant instructions), and the
+ * portable fallback for these algorithms is slicing-by-8. */
+
+#ifdef HAVE_HASHIMPL_CRC32C_SSE42
+/* CRC-32C (Castagnoli) is exactly what the SSE4.2 `crc32' instruction calculates. */
+PRIVATE uint32_t DCALL
+_hashimpl_crc32c_sse42(struct dhashalgo32x8 const *self, uint32_t start,
+                       void const *data, size_t datasize) {
+	__BYTE_TYPE__ const *p = (__BYTE_TYPE__ const *)data;
+	(void)self;
+	while (datasize && ((uintptr_t)p & 7)) {
+		start = _mm_crc32_u8(start, *p++);
+		--datasize;
+	}
+#ifdef __x86_64__
+	{
+		uint64_t state = start;
+		for (; datasize >= 8; p += 8, datasize -= 8)
+			state = _mm_crc32_u64(state, *(uint64_t const *)p);
+		start = (uint32_t)state;
+	}
+#else /* __x86_64__ */
+	for (; datasize >= 4; p += 4, datasize -= 4)
+		start = _mm_crc32_u32(start, *(uint32_t const *)p);
+#endif /* !__x86_64__ */
+	while (datasize--)
+		start = _mm_crc32_u8(start, *p++);
+	return start;
+}
+#endif /* HAVE_HASHIMPL_CRC32C_SSE42 */
+
+#ifdef HAVE_HASHIMPL_CRC32_PCLMUL
+/* CRC-32 (IEEE-802.3) using carry-less multiplication to fold 64 bytes at a
+ * time (s.a. Intel's "Fast CRC Computation for Generic Polynomials Using
+ * PCLMULQDQ Instruction"). The constants are `x^n mod P(x)' (bit-reflected)
+ * for the fold distances used below, followed by the Barrett constants. */
+PRIVATE uint32_t DCALL
+_hashimpl_crc32_pclmul(struct dhashalgo32x8 const *self, uint32_t start,
+                       void const *data, size_t datasize) {
+	__BYTE_TYPE__ const *p = (__BYTE_TYPE__ const *)data;
+	if (datasize >= 64) {
+		__m128i x0, x1, x2, x3, y0, y1, y2, y3, k, mask;
+		k  = _mm_set_epi64x(INT64_C(0x01c6e41596), INT64_C(0x0154442bd4)); /* x^(512+32), x^(512-32) */
+		x0 = _mm_xor_si128(_mm_loadu_si128((__m128i const *)(p + 0x00)), _mm_cvtsi32_si128((int)start));
+		x1 = _mm_loadu_si128((__m128i const *)(p + 0x10));
+		x2 = _mm_loadu_si128((__m128i const *)(p + 0x20));
+		x3 = _mm_loadu_si128((__m128i const *)(p + 0x30));
+		p += 64;
+		datasize -= 64;
+		while (datasize >= 64) {
+			y0 = _mm_clmulepi64_si128(x0, k, 0x00);
+			y1 = _mm_clmulepi64_si128(x1, k, 0x00);
+			y2 = _mm_clmulepi64_si128(x2, k, 0x00);
+			y3 = _mm_clmulepi64_si128(x3, k, 0x00);
+			x0 = _mm_clmulepi64_si128(x0, k, 0x11);
+			x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+			x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+			x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+			x0 = _mm_xor_si128(_mm_xor_si128(x0, y0), _mm_loadu_si128((__m128i const *)(p + 0x00)));
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, y1), _mm_loadu_si128((__m128i const *)(p + 0x10)));
+			x2 = _mm_xor_si128(_mm_xor_si128(x2, y2), _mm_loadu_si128((__m128i const *)(p + 0x20)));
+			x3 = _mm_xor_si128(_mm_xor_si128(x3, y3), _mm_loadu_si128((__m128i const *)(p + 0x30)));
+			p += 64;
+			datasize -= 64;
+		}
+
+		/* Fold the 4 lanes into 1, then consume remaining 16-byte blocks. */
+		k = _mm_set_epi64x(INT64_C(0x00ccaa009e), INT64_C(0x01751997d0)); /* x^(128+32), x^(128-32) */
+#define FOLD16(next)                                \
+		(y0 = _mm_clmulepi64_si128(x0, k, 0x00),    \
+		 x0 = _mm_clmulepi64_si128(x0, k, 0x11),    \
+		 x0 = _mm_xor_si128(_mm_xor_si128(x0, y0), next))
+		FOLD16(x1);
+		FOLD16(x2);
+		FOLD16(x3);
+		for (; datasize >= 16; p += 16, datasize -= 16)
+			FOLD16(_mm_loadu_si128((__m128i const *)p));
+#undef FOLD16
+
+		/* Fold 128 bits into 64, then apply a Barrett reduction to get 32. */
+		mask = _mm_setr_epi32(-1, 0, -1, 0);
+		y0 = _mm_clmulepi64_si128(x0, k, 0x10);
+		x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), y0);
+		k  = _mm_set_epi64x(0, INT64_C(0x0163cd6124)); /* x^64 */
+		y0 = _mm_srli_si128(x0, 4);
+		x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask), k, 0x00);
+		x0 = _mm_xor_si128(x0, y0);
+		k  = _mm_set_epi64x(INT64_C(0x01f7011641), INT64_C(0x01db710641)); /* mu, P(x) */
+		y0 = _mm_and_si128(x0, mask);
+		y0 = _mm_clmulepi64_si128(y0, k, 0x10);
+		y0 = _mm_and_si128(y0, mask);
+		y0 = _mm_clmulepi64_si128(y0, k, 0x00);
+		x0 = _mm_xor_si128(x0, y0);
+		start = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x0, 4));
+	}
+	while (datasize--)
+		start = self->ha_table[(uint8_t)(start ^ *p++)] ^ (start >> 8);
+	return start;
+}
+#endif /* HAVE_HASHIMPL_CRC32_PCLMUL */
+
+
 
 /*[[[deemon
 import * from deemon;
@@ -92,6 +217,17 @@ function DEEMON_GENERATE_CRC(width, polynom, reflect_input) {
 	}
 }
 
+// function DEEMON_GENERATE_SLICE8(Sequence table, int width) -> {list...}
+//    Yields the 7 additional tables used for slicing-by-8 (s.a. "hashslice8.c.inl")
+function DEEMON_GENERATE_SLICE8(table, width) {
+	local mask = (1 << width) - 1;
+	local prev = table;
+	for (local n = 1; n < 8; ++n) {
+		prev = List(for (local x: prev) ((x >> 8) ^ table[x & 0xff]) & mask);
+		yield prev;
+	}
+}
+
 try {
 	mkdir(algo_folder);
 } catch (...) {
@@ -99,6 +235,24 @@ try {
 
 crc_algos = [];
 
+// Algorithms that get slicing-by-8 tables (must be reflected, with a width of 32 or 64)
+slice8_algos = { "CRC-32", "CRC-32C", "CRC-64/XZ" };
+
+// Hardware-accelerated implementations: { name: (feature-macro, hashfunc) }
+hw_hashfuncs = Dict {
+	"CRC-32"  : ("HAVE_HASHIMPL_CRC32_PCLMUL", "_hashimpl_crc32_pclmul"),
+	"CRC-32C" : ("HAVE_HASHIMPL_CRC32C_SSE42", "_hashimpl_crc32c_sse42"),
+};
+
+// Feature macros for slicing-by-8 implementations that are only
+// used as fallbacks for `hw_hashfuncs': { width: feature-macro }
+slice8_guards = Dict {
+	32 : "HAVE_HASHIMPL_32_IOREF_SLICE8",
+};
+
+// Streaming algorithms (s.a. "digest.c")
+stream_algos = ["dhash_xxh64", "dhash_siphash_2_4", "dhash_sha_256"];
+
 known_hashfuncs = Dict {};
 function get_hashfunc(width, revin, revout) {
 	local key = pack(width, revin, revout);
@@ -144,13 +298,29 @@ function def_crc(names, width, poly, args...) {
 	local algo_name = "dhash_" + main_name.lower().replace("-", "_").replace("/", "__");
 	crc_algos.append(algo_name);
 	local hashfunc = get_hashfunc(width, refin, refout);
+	local slice8 = main_name in slice8_algos;
+	if (slice8) {
+		assert refin && refout && (width == 32 || width == 64);
+		hashfunc = "_hashimpl_" + width + "_ioref_slice8";
+		if (hashfunc !in known_hashfuncs) {
+			local guard = slice8_guards.get(width);
+			if (guard !is none)
+				print "#ifdef", guard;
+			print "#define WIDTH", width;
+			print "#include", repr "hashslice8.c.inl";
+			if (guard !is none)
+				print "#endif /" "*", guard, "*" "/";
+			print;
+			known_hashfuncs[hashfunc] = hashfunc;
+		}
+	}
 	local alias_names = "NULL";
 	if (names) {
 		alias_names = algo_name+"_alias_names";
 		print "PRIVATE char const *const", alias_names,;
 		print "[] = {", ", ".join(for(local name: names) repr name.upper()) + ", NULL };";
 	}
-	print "PRIVATE struct dhashalgo" + (size * 8) + " const", algo_name, "= {";
+	print "PRIVATE struct dhashalgo" + (size * 8) + (slice8 ? "x8" : "") + " const", algo_name, "= {";
 #define CODEINT(x) (("UINT" + (size * 8) + "_C(%#." + (size*2) + "I" + (size * 8) + "x)") % (x))
 //	local width_mask = 1;
 //	for (local i = 1; i < width; ++i) {
@@ -164,15 +334,25 @@ function def_crc(names, width, poly, args...) {
 	print("\t\t", size, ",");
 	print("\t\t", "HASHALGO_FNORMAL", ",");
 	print("\t\t{");
-	print("\t\t\t(dhashfuncn_t)&", hashfunc);
+	local hw = hw_hashfuncs.get(main_name);
+	if (hw !is none) {
+		print "#ifdef", hw[0];
+		print("\t\t\t(dhashfuncn_t)&", hw[1]);
+		print "#else /" "*", hw[0], "*" "/";
+		print("\t\t\t(dhashfuncn_t)&", hashfunc);
+		print "#endif /" "* !" + hw[0], "*" "/";
+	} else {
+		print("\t\t\t(dhashfuncn_t)&", hashfunc);
+	}
 	print("\t\t}");
 	print("\t},");
 	print("\t", CODEINT(init), ",");
 	print("\t", CODEINT(xorout), ",");
 	local algo_filename = joinpath(algo_folder, "algorithm." + main_name.replace("\\", "_").replace("/", "_") + ".c.inl");
+	local table = List(DEEMON_GENERATE_CRC(width, poly, refin));
 	with (local algo_file = File.open(algo_filename, "w")) {
 		print algo_file: "{";
-		for (local i, x: util.enumerate(DEEMON_GENERATE_CRC(width, poly, refin))) {
+		for (local i, x: util.enumerate(table)) {
 			if ((i % 8) == 0)
 				print algo_file: "\t",;
 			print algo_file: CODEINT(x),;
@@ -186,6 +366,30 @@ function def_crc(names, width, poly, args...) {
 		print algo_file: "}";
 	}
 	print "#include", repr(algo_filename.replace("\\", "/"));
+	if (slice8) {
+		local slice_filename = algo_filename[:-#".c.inl"] + ".slice8.c.inl";
+		with (local slice_file = File.open(slice_filename, "w")) {
+			print slice_file: "{";
+			for (local slice: DEEMON_GENERATE_SLICE8(table, width)) {
+				print slice_file: "\t{";
+				for (local i, x: util.enumerate(slice)) {
+					if ((i % 8) == 0)
+						print slice_file: "\t\t",;
+					print slice_file: CODEINT(x),;
+					print slice_file: ",",;
+					if ((i % 8) == 7) {
+						print slice_file:;
+					} else {
+						print slice_file: " ",;
+					}
+				}
+				print slice_file: "\t},";
+			}
+			print slice_file: "}";
+		}
+		print "\t,";
+		print "#include", repr(slice_filename.replace("\\", "/"));
+	}
 	print "};";
 	print;
 }
@@ -370,7 +574,7 @@ def_crc(["CRC-64/ISO", "FP-64"],        64, 0x000000000000001b, 0x00000000000000
 print;
 print "/" "* NULL-terminated list of known hash algorithms *" "/";
 print "PRIVATE struct dhashalgo const *const dhash_algorithms[] = {";
-for (local algo: crc_algos) {
+for (local algo: crc_algos + stream_algos) {
 	print "\t&",;
 	print algo,;
 	print ".ha_base",;
@@ -1742,8 +1946,13 @@ PRIVATE struct dhashalgo32 const dhash_crc_31__philips = {
 #define OUT_REFLECTED 1
 #include "hashfunc.c.inl"
 
+#ifdef HAVE_HASHIMPL_32_IOREF_SLICE8
+#define WIDTH 32
+#include "hashslice8.c.inl"
+#endif /* HAVE_HASHIMPL_32_IOREF_SLICE8 */
+
 PRIVATE char const *const dhash_crc_32_alias_names[] = { "CRC-32/ADCCP", "PKZIP", "CRC-32/IEEE-802.3", "IEEE-802.3", NULL };
-PRIVATE struct dhashalgo32 const dhash_crc_32 = {
+PRIVATE struct dhashalgo32x8 const dhash_crc_32 = {
 	{
 		"CRC-32",
 		dhash_crc_32_alias_names,
@@ -1751,12 +1960,18 @@ PRIVATE struct dhashalgo32 const dhash_crc_32 = {
 		4,
 		HASHALGO_FNORMAL,
 		{
-			(dhashfuncn_t)&_hashimpl_32_ioref
+#ifdef HAVE_HASHIMPL_CRC32_PCLMUL
+			(dhashfuncn_t)&_hashimpl_crc32_pclmul
+#else /* HAVE_HASHIMPL_CRC32_PCLMUL */
+			(dhashfuncn_t)&_hashimpl_32_ioref_slice8
+#endif /* !HAVE_HASHIMPL_CRC32_PCLMUL */
 		}
 	},
 	UINT32_C(0xffffffff),
 	UINT32_C(0xffffffff),
 #include "algorithms/algorithm.CRC-32.c.inl"
+	,
+#include "algorithms/algorithm.CRC-32.slice8.c.inl"
 };
 
 PRIVATE struct dhashalgo32 const dhash_crc_32__autosar = {
@@ -1797,7 +2012,7 @@ PRIVATE struct dhashalgo32 const dhash_crc_32__bzip2 = {
 #include "algorithms/algorithm.CRC-32_BZIP2.c.inl"
 };
 
-PRIVATE struct dhashalgo32 const dhash_crc_32c = {
+PRIVATE struct dhashalgo32x8 const dhash_crc_32c = {
 	{
 		"CRC-32C",
 		NULL,
@@ -1805,12 +2020,18 @@ PRIVATE struct dhashalgo32 const dhash_crc_32c = {
 		4,
 		HASHALGO_FNORMAL,
 		{
-			(dhashfuncn_t)&_hashimpl_32_ioref
+#ifdef HAVE_HASHIMPL_CRC32C_SSE42
+			(dhashfuncn_t)&_hashimpl_crc32c_sse42
+#else /* HAVE_HASHIMPL_CRC32C_SSE42 */
+			(dhashfuncn_t)&_hashimpl_32_ioref_slice8
+#endif /* !HAVE_HASHIMPL_CRC32C_SSE42 */
 		}
 	},
 	UINT32_C(0xffffffff),
 	UINT32_C(0xffffffff),
 #include "algorithms/algorithm.CRC-32C.c.inl"
+	,
+#include "algorithms/algorithm.CRC-32C.slice8.c.inl"
 };
 
 PRIVATE struct dhashalgo32 const dhash_crc_32d = {
@@ -1973,7 +2194,10 @@ PRIVATE struct dhashalgo64 const dhash_crc_64__we = {
 #define OUT_REFLECTED 1
 #include "hashfunc.c.inl"
 
-PRIVATE struct dhashalgo64 const dhash_crc_64__xz = {
+#define WIDTH 64
+#include "hashslice8.c.inl"
+
+PRIVATE struct dhashalgo64x8 const dhash_crc_64__xz = {
 	{
 		"CRC-64/XZ",
 		NULL,
@@ -1981,12 +2205,14 @@ PRIVATE struct dhashalgo64 const dhash_crc_64__xz = {
 		8,
 		HASHALGO_FNORMAL,
 		{
-			(dhashfuncn_t)&_hashimpl_64_ioref
+			(dhashfuncn_t)&_hashimpl_64_ioref_slice8
 		}
 	},
 	UINT64_C(0xffffffffffffffff),
 	UINT64_C(0xffffffffffffffff),
 #include "algorithms/algorithm.CRC-64_XZ.c.inl"
+	,
+#include "algorithms/algorithm.CRC-64_XZ.slice8.c.inl"
 };
 
 PRIVATE struct dhashalgo64 const dhash_crc_64__jones = {
@@ -2135,26 +2361,54 @@ PRIVATE struct dhashalgo const *const dhash_algorithms[] = {
 	&dhash_crc_64__jones.ha_base,
 	&dhash_crc_64__ecma.ha_base,
 	&dhash_crc_64__iso.ha_base,
+	&dhash_xxh64.ha_base,
+	&dhash_siphash_2_4.ha_base,
+	&dhash_sha_256.ha_base,
 	NULL
 };
 /*[[[end]]]*/
 
-/* Execute the given hash algorithm to hash `data...+=datasize'
- * When given, `start' is used as the initial hash value (which
- * may be the hash result of a previous call), but when set to
- * NULL, the algorythm's default start-value is used instead. */
-INTERN WUNUSED NONNULL((1, 3)) DREF /*Int*/ DeeObject *DCALL
-dhashalgo_exec(struct dhashalgo const *__restrict self,
-               /*Int*/ DeeObject *start,
-               void const *__restrict data,
-               size_t datasize) {
-	DREF /*Int*/ DeeObject *result;
-	switch (self->ha_size) {
+PRIVATE ATTR_COLD NONNULL((1)) int DCALL
+err_start_not_supported(struct dhashalgo const *__restrict algo) {
+	return DeeError_Throwf(&DeeError_ValueError,
+	                       "Hash algorithm %s does not accept a start value",
+	                       algo->ha_name);
+}
+
+/* Begin a new hash operation, using `start' (if non-NULL) as initial hash/seed.
+ * @return: 0 : Success (must call `dhashstate_fini()' later)
+ * @return: -1: Error */
+INTERN WUNUSED NONNULL((1, 2)) int DCALL
+dhashstate_init(union dhashstate *__restrict self,
+                struct dhashalgo const *__restrict algo,
+                /*Int*/ DeeObject *start) {
+	if (algo->ha_flags & HASHALGO_FSTREAM) {
+		struct dhashalgos const *me;
+		uint8_t key[DHASHSTREAM_KEY_MAX];
+		me = (struct dhashalgos const *)algo;
+		ASSERT(me->ha_keysize <= DHASHSTREAM_KEY_MAX);
+		bzero(key, sizeof(key));
+		if (start) {
+			int error;
+			if unlikely(!me->ha_keysize)
+				goto err_start;
+			start = DeeObject_Int(start);
+			if unlikely(!start)
+				goto err;
+			error = DeeInt_AsBytes(start, key, me->ha_keysize, true, false);
+			Dee_Decref(start);
+			if unlikely(error)
+				goto err;
+		}
+		(*me->ha_init)(self->hs_stream, key);
+		return 0;
+	}
+	switch (algo->ha_size) {
 
 	case 1: {
 		uint8_t state;
 		struct dhashalgo8 const *me;
-		me = (struct dhashalgo8 const *)self;
+		me = (struct dhashalgo8 const *)algo;
 		if (start) {
 			if (DeeObject_AsUInt8(start, &state))
 				goto err;
@@ -2162,15 +2416,13 @@ dhashalgo_exec(struct dhashalgo const *__restrict self,
 		} else {
 			state = me->ha_start;
 		}
-		state  = (*me->ha_base.ha_hash8)(me, state, data, datasize);
-		state ^= me->ha_outmod;
-		result = DeeInt_NewUInt8(state);
+		self->hs_crc = state;
 	}	break;
 
 	case 2: {
 		uint16_t state;
 		struct dhashalgo16 const *me;
-		me = (struct dhashalgo16 const *)self;
+		me = (struct dhashalgo16 const *)algo;
 		if (start) {
 			if (DeeObject_AsUInt16(start, &state))
 				goto err;
@@ -2178,15 +2430,13 @@ dhashalgo_exec(struct dhashalgo const *__restrict self,
 		} else {
 			state = me->ha_start;
 		}
-		state  = (*me->ha_base.ha_hash16)(me, state, data, datasize);
-		state ^= me->ha_outmod;
-		result = DeeInt_NewUInt16(state);
+		self->hs_crc = state;
 	}	break;
 
 	case 4: {
 		uint32_t state;
 		struct dhashalgo32 const *me;
-		me = (struct dhashalgo32 const *)self;
+		me = (struct dhashalgo32 const *)algo;
 		if (start) {
 			if (DeeObject_AsUInt32(start, &state))
 				goto err;
@@ -2194,15 +2444,13 @@ dhashalgo_exec(struct dhashalgo const *__restrict self,
 		} else {
 			state = me->ha_start;
 		}
-		state  = (*me->ha_base.ha_hash32)(me, state, data, datasize);
-		state ^= me->ha_outmod;
-		result = DeeInt_NewUInt32(state);
+		self->hs_crc = state;
 	}	break;
 
 	case 8: {
 		uint64_t state;
 		struct dhashalgo64 const *me;
-		me = (struct dhashalgo64 const *)self;
+		me = (struct dhashalgo64 const *)algo;
 		if (start) {
 			if (DeeObject_AsUInt64(start, &state))
 				goto err;
@@ -2210,21 +2458,210 @@ dhashalgo_exec(struct dhashalgo const *__restrict self,
 		} else {
 			state = me->ha_start;
 		}
-		state  = (*me->ha_base.ha_hash64)(me, state, data, datasize);
-		state ^= me->ha_outmod;
-		result = DeeInt_NewUInt64(state);
+		self->hs_crc = state;
 	}	break;
 
 	default: {
 		struct dhashalgon const *me;
-		me = (struct dhashalgon const *)self;
+		me = (struct dhashalgon const *)algo;
 		if (!start)
 			start = me->ha_start;
-		result = (*me->ha_base.ha_hashn)(me, start, data, datasize);
+		self->hs_crcn = start;
+		Dee_Incref(start);
 	}	break;
 
 	}
+	return 0;
+err_start:
+	err_start_not_supported(algo);
+err:
+	return -1;
+}
+
+/* Feed `data...+=datasize' into `self'
+ * @return: 0 : Success
+ * @return: -1: Error (`self' remains unchanged) */
+INTERN WUNUSED NONNULL((1, 2)) int DCALL
+dhashstate_update(union dhashstate *__restrict self,
+                  struct dhashalgo const *__restrict algo,
+                  void const *data, size_t datasize) {
+	if (algo->ha_flags & HASHALGO_FSTREAM) {
+		struct dhashalgos const *me;
+		me = (struct dhashalgos const *)algo;
+		(*me->ha_update)(self->hs_stream, data, datasize);
+		return 0;
+	}
+	switch (algo->ha_size) {
+
+	case 1:
+		self->hs_crc = (*algo->ha_hash8)((struct dhashalgo8 const *)algo,
+		                                 (uint8_t)self->hs_crc, data, datasize);
+		break;
+
+	case 2:
+		self->hs_crc = (*algo->ha_hash16)((struct dhashalgo16 const *)algo,
+		                                  (uint16_t)self->hs_crc, data, datasize);
+		break;
+
+	case 4:
+		self->hs_crc = (*algo->ha_hash32)((struct dhashalgo32 const *)algo,
+		                                  (uint32_t)self->hs_crc, data, datasize);
+		break;
+
+	case 8:
+		self->hs_crc = (*algo->ha_hash64)((struct dhashalgo64 const *)algo,
+		                                  self->hs_crc, data, datasize);
+		break;
+
+	default: {
+		DREF DeeObject *state;
+		state = (*algo->ha_hashn)((struct dhashalgon const *)algo,
+		                          self->hs_crcn, data, datasize);
+		if unlikely(!state)
+			goto err;
+		Dee_Decref(self->hs_crcn);
+		self->hs_crcn = state;
+	}	break;
+
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Same as `dhashstate_update()', but do so while holding `lock' (if non-NULL) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+dhashstate_update_locked(union dhashstate *__restrict self,
+                         struct dhashalgo const *__restrict algo,
+                         Dee_shared_lock_t *lock,
+                         void const *data, size_t datasize) {
+	int result;
+	if (!lock)
+		return dhashstate_update(self, algo, data, datasize);
+	if (Dee_shared_lock_acquire(lock))
+		return -1;
+	result = dhashstate_update(self, algo, data, datasize);
+	Dee_shared_lock_release(lock);
+	return result;
+}
+
+/* Read (and hash) `file' in chunks until EOF, so its size doesn't matter. */
+PRIVATE WUNUSED NONNULL((1, 2, 4)) int DCALL
+dhashstate_feed_file(union dhashstate *__restrict self,
+                     struct dhashalgo const *__restrict algo,
+                     Dee_shared_lock_t *lock,
+                     DeeObject *__restrict file) {
+	void *buf = Dee_Malloc(DHASH_FILE_BUFSIZE);
+	if unlikely(!buf)
+		goto err;
+	for (;;) {
+		size_t count = DeeFile_Read(file, buf, DHASH_FILE_BUFSIZE);
+		if unlikely(count == (size_t)-1)
+			goto err_buf;
+		if (!count)
+			break;
+		if unlikely(dhashstate_update_locked(self, algo, lock, buf, count))
+			goto err_buf;
+	}
+	Dee_Free(buf);
+	return 0;
+err_buf:
+	Dee_Free(buf);
+err:
+	return -1;
+}
+
+/* Same as `dhashstate_update()', but read data from `data', which may be a
+ * string (hashed as UTF-8), a File (read until EOF), or a buffer object.
+ * @param: lock: [0..1] Lock for `self', which is only held while `self' is being
+ *               updated (but not while `data' is read, which may run user-code)
+ * NOTE: When reading from a File fails, `self' contains what was read thus far. */
+INTERN WUNUSED NONNULL((1, 2, 4)) int DCALL
+dhashstate_feed(union dhashstate *__restrict self,
+                struct dhashalgo const *__restrict algo,
+                Dee_shared_lock_t *lock,
+                DeeObject *__restrict data) {
+	int result;
+	if (DeeString_Check(data)) {
+		char const *utf8 = DeeString_AsUtf8(data);
+		if unlikely(!utf8)
+			goto err;
+		result = dhashstate_update_locked(self, algo, lock, utf8, WSTR_LENGTH(utf8));
+	} else if (DeeFile_Check(data)) {
+		result = dhashstate_feed_file(self, algo, lock, data);
+	} else {
+		DeeBuffer buf;
+		if (DeeObject_GetBuf(data, &buf, Dee_BUFFER_FREADONLY))
+			goto err;
+		result = dhashstate_update_locked(self, algo, lock, buf.bb_base, buf.bb_size);
+		DeeObject_PutBuf(data, &buf, Dee_BUFFER_FREADONLY);
+	}
+	return result;
+err:
+	return -1;
+}
+
+/* Return the hash value of all data that has been fed into `self' thus far.
+ * `self' isn't modified and can continue to be used for more data. */
+INTERN WUNUSED NONNULL((1, 2)) DREF /*Int*/ DeeObject *DCALL
+dhashstate_result(union dhashstate const *__restrict self,
+                  struct dhashalgo const *__restrict algo) {
+	if (algo->ha_flags & HASHALGO_FSTREAM) {
+		struct dhashalgos const *me;
+		uint64_t state[DHASHSTREAM_STATE_MAX / 8];
+		uint8_t digest[DHASHSTREAM_DIGEST_MAX];
+		me = (struct dhashalgos const *)algo;
+		ASSERT(me->ha_base.ha_size <= DHASHSTREAM_DIGEST_MAX);
+
+		/* Finalization is destructive, so operate on a copy. */
+		memcpy(state, self->hs_stream, sizeof(state));
+		(*me->ha_final)(state, digest);
+		return DeeInt_FromBytes(digest, me->ha_base.ha_size, false, false);
+	}
+	switch (algo->ha_size) {
+
+	case 1:
+		return DeeInt_NewUInt8((uint8_t)self->hs_crc ^
+		                       ((struct dhashalgo8 const *)algo)->ha_outmod);
+
+	case 2:
+		return DeeInt_NewUInt16((uint16_t)self->hs_crc ^
+		                        ((struct dhashalgo16 const *)algo)->ha_outmod);
+
+	case 4:
+		return DeeInt_NewUInt32((uint32_t)self->hs_crc ^
+		                        ((struct dhashalgo32 const *)algo)->ha_outmod);
+
+	case 8:
+		return DeeInt_NewUInt64(self->hs_crc ^
+		                        ((struct dhashalgo64 const *)algo)->ha_outmod);
+
+	default:
+		break;
+	}
+	return_reference_(self->hs_crcn);
+}
+
+/* Execute the given hash algorithm to hash `data...+=datasize'
+ * When given, `start' is used as the initial hash value (which
+ * may be the hash result of a previous call), but when set to
+ * NULL, the algorythm's default start-value is used instead. */
+INTERN WUNUSED NONNULL((1, 3)) DREF /*Int*/ DeeObject *DCALL
+dhashalgo_exec(struct dhashalgo const *__restrict self,
+               /*Int*/ DeeObject *start,
+               void const *__restrict data,
+               size_t datasize) {
+	DREF /*Int*/ DeeObject *result;
+	union dhashstate state;
+	if unlikely(dhashstate_init(&state, self, start))
+		goto err;
+	if unlikely(dhashstate_update(&state, self, data, datasize))
+		goto err_state;
+	result = dhashstate_result(&state, self);
+	dhashstate_fini(&state, self);
 	return result;
+err_state:
+	dhashstate_fini(&state, self);
 err:
 	return NULL;
 }
@@ -2304,6 +2741,7 @@ dhashmain_f(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 	char const *name;
 	DeeObject *data, *start = NULL;
 	struct dhashalgo const *algo;
+	union dhashstate state;
 	DREF DeeObject *result;
 	PRIVATE DEFINE_KWLIST(kwlist, { K(name), K(data), K(start), KEND });
 	if (DeeArg_UnpackKw(argc, argv, kw, kwlist, "so|o:hash", &name, &data, &start))
@@ -2311,21 +2749,15 @@ dhashmain_f(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 	algo = dhashalgo_find(name);
 	if unlikely(!algo)
 		goto err;
-	if (DeeString_Check(data)) {
-		char const *utf8 = DeeString_AsUtf8(data);
-		if unlikely(!utf8)
-			goto err;
-		result = dhashalgo_exec(algo, start, utf8, WSTR_LENGTH(utf8));
-	} else {
-		DeeBuffer buf;
-		if (DeeObject_GetBuf(data, &buf, Dee_BUFFER_FREADONLY))
-			goto err;
-		result = dhashalgo_exec(algo, start,
-		                        buf.bb_base,
-		                        buf.bb_size);
-		DeeObject_PutBuf(data, &buf, Dee_BUFFER_FREADONLY);
-	}
+	if unlikely(dhashstate_init(&state, algo, start))
+		goto err;
+	if unlikely(dhashstate_feed(&state, algo, NULL, data))
+		goto err_state;
+	result = dhashstate_result(&state, algo);
+	dhashstate_fini(&state, algo);
 	return result;
+err_state:
+	dhashstate_fini(&state, algo);
 err:
 	return NULL;
 }
@@ -2336,8 +2768,13 @@ PRIVATE DEFINE_KWCMETHOD(dhashmain, &dhashmain_f);
 
 PRIVATE struct dex_symbol symbols[] = {
 	{ "hash", (DeeObject *)&dhashmain, MODSYM_FNORMAL,
-	  DOC("(name:?Dstring,data:?X2?Dstring?DBytes,start?:?Dint)->?Dint\n"
-	      "Calculate the hash of @data using the given hash function @name") },
+	  DOC("(name:?Dstring,data:?X3?Dstring?DBytes?DFile,start?:?Dint)->?Dint\n"
+	      "Calculate the hash of @data using the given hash function @name\n"
+	      "For CRCs, @start may be the hash of preceding data (to continue hashing). "
+	      /**/ "For $\"XXH64\" and $\"SIPHASH-2-4\", it is the seed or key, and "
+	      /**/ "$\"SHA-256\" doesn't accept it at all (use ?GHasher to hash data "
+	      /**/ "that is split into multiple parts)") },
+	{ "Hasher", (DeeObject *)&DeeHasher_Type, MODSYM_FNORMAL },
 	{ NULL }
 };
 
@@ -23,6 +23,7 @@
 #include <deemon/api.h>
 #include <deemon/dex.h>
 #include <deemon/object.h>
+#include <deemon/util/lock.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -34,6 +35,7 @@ struct dhashalgo16;
 struct dhashalgo32;
 struct dhashalgo64;
 struct dhashalgon;
+struct dhashalgos;
 
 /* Prototypes for 1, 2, 4 and 8-byte hash functions. */
 typedef WUNUSED_T NONNULL_T((1, 3)) uint8_t (DCALL *dhashfunc8_t)(struct dhashalgo8 const *__restrict self, uint8_t  start, void const *__restrict data, size_t datasize);
@@ -53,6 +55,7 @@ struct dhashalgo {
 	uint16_t           ha_width; /* Crc bit-width (<= ha_size * 8). */
 	uint8_t            ha_size;  /* Size of a hash value in bytes (1|2|4|8|n). */
 #define HASHALGO_FNORMAL 0x0000  /* Normal flags. */
+#define HASHALGO_FSTREAM 0x0001  /* This is a `struct dhashalgos' (`ha_hash*' is unused and `NULL') */
 	uint8_t            ha_flags; /* Additional flags (set of `HASHALGO_F*') */
 	union {
 		/* Internal hash algorithms (these don't perform input/output modulation) */
@@ -95,9 +98,95 @@ struct dhashalgon {
 	struct dhashalgo ha_base;  /* The underlying algorithm descriptor. */
 	DREF DeeObject  *ha_start; /* Initial hash value */
 };
+
+/* Reflected CRCs that use slicing-by-8 (s.a. "hashslice8.c.inl") */
+struct dhashalgo32x8 {
+	DHASHALGO_MEMBERS(uint32_t)
+	uint32_t ha_slice[7][256]; /* `ha_slice[n]' is `ha_table' advanced by `n + 1' zero-bytes */
+};
+struct dhashalgo64x8 {
+	DHASHALGO_MEMBERS(uint64_t)
+	uint64_t ha_slice[7][256]; /* `ha_slice[n]' is `ha_table' advanced by `n + 1' zero-bytes */
+};
 #undef DHASHALGO_MEMBERS
 
 
+/* Size of the buffer used to read from files that are being hashed. */
+#define DHASH_FILE_BUFSIZE 65536
+
+/* Max size of the state, key and digest of a streaming hash algorithm (in bytes). */
+#define DHASHSTREAM_STATE_MAX  128
+#define DHASHSTREAM_KEY_MAX    16
+#define DHASHSTREAM_DIGEST_MAX 32
+
+/* Streaming hash algorithms (anything that isn't a CRC). These can't be
+ * resumed from a previous hash value, and instead need some extra state. */
+struct dhashalgos {
+	struct dhashalgo ha_base;    /* The underlying algorithm descriptor (with `HASHALGO_FSTREAM'). */
+	size_t           ha_keysize; /* Size of the seed/key (in bytes) that can be passed as `start' (or 0 if not supported). */
+	/* [1..1] Initialize `state'. `key' is `ha_keysize' bytes in little endian (all zero if no `start' was given). */
+	NONNULL_T((1, 2)) void (DCALL *ha_init)(void *__restrict state, void const *__restrict key);
+	/* [1..1] Feed more data into `state'. */
+	NONNULL_T((1)) void (DCALL *ha_update)(void *__restrict state, void const *data, size_t datasize);
+	/* [1..1] Finalize `state' (which mustn't be used afterwards) and write `ha_base.ha_size'
+	 *        bytes of digest to `result' (in big endian, so it reads as the canonical hex-string). */
+	NONNULL_T((1, 2)) void (DCALL *ha_final)(void *__restrict state, void *__restrict result);
+};
+
+/* Streaming hash algorithms (s.a. "digest.c") */
+INTDEF struct dhashalgos const dhash_xxh64;
+INTDEF struct dhashalgos const dhash_siphash_2_4;
+INTDEF struct dhashalgos const dhash_sha_256;
+
+
+/* State of a hash operation that is in progress. */
+union dhashstate {
+	uint64_t        hs_crc;  /* CRC state (before `ha_outmod' is applied) for `ha_size <= 8' */
+	DREF DeeObject *hs_crcn; /* [1..1] Current hash value for `struct dhashalgon' */
+	uint64_t        hs_stream[DHASHSTREAM_STATE_MAX / 8]; /* State for `HASHALGO_FSTREAM' */
+};
+
+/* Begin a new hash operation, using `start' (if non-NULL) as initial hash/seed.
+ * @return: 0 : Success (must call `dhashstate_fini()' later)
+ * @return: -1: Error */
+INTDEF WUNUSED NONNULL((1, 2)) int DCALL
+dhashstate_init(union dhashstate *__restrict self,
+                struct dhashalgo const *__restrict algo,
+                /*Int*/ DeeObject *start);
+#define dhashstate_isobject(algo) \
+	((algo)->ha_size > 8 && !((algo)->ha_flags & HASHALGO_FSTREAM))
+#define dhashstate_fini(self, algo) \
+	(dhashstate_isobject(algo) ? Dee_Decref((self)->hs_crcn) : (void)0)
+#define dhashstate_initcopy(self, other, algo) \
+	(memcpy(self, other, sizeof(union dhashstate)), \
+	 dhashstate_isobject(algo) ? Dee_Incref((self)->hs_crcn) : (void)0)
+
+/* Feed `data...+=datasize' into `self'
+ * @return: 0 : Success
+ * @return: -1: Error (`self' remains unchanged) */
+INTDEF WUNUSED NONNULL((1, 2)) int DCALL
+dhashstate_update(union dhashstate *__restrict self,
+                  struct dhashalgo const *__restrict algo,
+                  void const *data, size_t datasize);
+
+/* Same as `dhashstate_update()', but read data from `data', which may be a
+ * string (hashed as UTF-8), a File (read until EOF), or a buffer object.
+ * @param: lock: [0..1] Lock for `self', which is only held while `self' is being
+ *               updated (but not while `data' is read, which may run user-code)
+ * NOTE: When reading from a File fails, `self' contains what was read thus far. */
+INTDEF WUNUSED NONNULL((1, 2, 4)) int DCALL
+dhashstate_feed(union dhashstate *__restrict self,
+                struct dhashalgo const *__restrict algo,
+                Dee_shared_lock_t *lock,
+                DeeObject *__restrict data);
+
+/* Return the hash value of all data that has been fed into `self' thus far.
+ * `self' isn't modified and can continue to be used for more data. */
+INTDEF WUNUSED NONNULL((1, 2)) DREF /*Int*/ DeeObject *DCALL
+dhashstate_result(union dhashstate const *__restrict self,
+                  struct dhashalgo const *__restrict algo);
+
+
 /* Execute the given hash algorithm to hash `data...+=datasize'
  * When given, `start' is used as the initial hash value (which
  * may be the hash result of a previous call), but when set to
@@ -117,6 +206,19 @@ INTDEF WUNUSED NONNULL((1)) struct dhashalgo const *DCALL
 dhashalgo_find(char const *__restrict name);
 
 
+typedef struct {
+	OBJECT_HEAD
+	struct dhashalgo const *h_algo;  /* [1..1][const] The hash algorithm being used. */
+	Dee_shared_lock_t       h_lock;  /* Lock for `h_state' */
+	union dhashstate        h_state; /* [lock(h_lock)] State of the hash operation. */
+} DeeHasherObject;
+
+#define DeeHasher_LockAcquire(self) Dee_shared_lock_acquire(&(self)->h_lock)
+#define DeeHasher_LockRelease(self) Dee_shared_lock_release(&(self)->h_lock)
+
+INTDEF DeeTypeObject DeeHasher_Type;
+
+
 
 DECL_END
 
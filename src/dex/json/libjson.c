@@ -426,6 +426,7 @@ jmapiter_getseq(DeeJsonIteratorObject *__restrict self) {
 	DeeJsonIterator_GetParser(self, &result->jm_parser);
 	if unlikely(libjson_parser_rewind(&result->jm_parser) != JSON_PARSER_OBJECT)
 		goto err_r_syntax;
+	result->jm_index = NULL;
 	Dee_atomic_rwlock_init(&result->jm_lock);
 	DeeObject_Init(result, &DeeJsonMapping_Type);
 done:
@@ -659,6 +660,7 @@ jmap_ctor(DeeJsonMappingObject *__restrict self) {
 	self->jm_parser.jp_start    = empty_json_object;
 	self->jm_parser.jp_pos      = empty_json_object + 1;
 	self->jm_parser.jp_end      = empty_json_object + 2;
+	self->jm_index              = NULL;
 	Dee_atomic_rwlock_init(&self->jm_lock);
 	return 0;
 }
@@ -671,6 +673,7 @@ jmap_copy(DeeJsonMappingObject *__restrict self,
 	self->jm_parser = other->jm_parser;
 	Dee_Incref(self->jm_owner);
 	DeeJsonMapping_LockEndRead(other);
+	self->jm_index = NULL;
 	Dee_atomic_rwlock_init(&self->jm_lock);
 	return 0;
 }
@@ -773,6 +776,7 @@ jmap_init(DeeJsonMappingObject *__restrict self,
 	/* Parse the leading '{'-token */
 	if (libjson_parser_yield(&self->jm_parser) != JSON_PARSER_ARRAY)
 		goto err_syntax_parser_data;
+	self->jm_index = NULL;
 	Dee_atomic_rwlock_init(&self->jm_lock);
 	return 0;
 err_syntax_parser_data:
@@ -1000,6 +1004,130 @@ err_syntax:
 	return (size_t)err_json_syntax();
 }
 
+PRIVATE NONNULL((1)) void DCALL
+json_keyindex_destroy(struct json_keyindex *__restrict self) {
+	size_t i;
+	for (i = 0; i <= self->jki_mask; ++i)
+		Dee_XDecref(self->jki_elem[i].jke_keyob);
+	Dee_Free(self);
+}
+
+/* Build the key index of `self'
+ * @return: * :   The new index (not yet stored in `self')
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) struct json_keyindex *DCALL
+json_keyindex_build(DeeJsonMappingObject *__restrict self) {
+	int tok;
+	size_t count, mask;
+	struct json_parser parser;
+	struct json_keyindex *result;
+	DREF DeeObject *keyob;
+	count = jmap_nsi_getsize(self);
+	if unlikely(count == (size_t)-1)
+		goto err;
+	for (mask = 7; mask / 2 < count; mask = (mask << 1) | 1)
+		;
+	result = (struct json_keyindex *)Dee_Calloc(offsetof(struct json_keyindex, jki_elem) +
+	                                            (mask + 1) * sizeof(struct json_keyindex_entry));
+	if unlikely(!result)
+		goto err;
+	result->jki_mask = mask;
+	DeeJsonMapping_LockRead(self);
+	parser = self->jm_parser;
+	DeeJsonMapping_LockEndRead(self);
+	if unlikely(libjson_parser_rewind(&parser) != JSON_PARSER_OBJECT)
+		goto err_r_syntax;
+	while ((tok = libjson_parser_peeknext(&parser)) != JSON_PARSER_ENDOBJECT) {
+		char const *key, *key_end;
+		size_t keylen;
+		Dee_hash_t i, perturb, hash;
+		if unlikely(tok != JSON_PARSER_STRING)
+			goto err_r_syntax;
+
+		/* Keys without escape sequences are referenced in-place */
+		key = parser.jp_pos;
+		while (*key == ' ' || *key == '\t' || *key == '\n' || *key == '\r')
+			++key;
+		ASSERT(*key == '"');
+		++key;
+		key_end = (char const *)memchr(key, '"', (size_t)((char const *)parser.jp_end - key));
+		keyob = NULL;
+		if (key_end && !memchr(key, '\\', (size_t)(key_end - key))) {
+			keylen        = (size_t)(key_end - key);
+			parser.jp_pos = key_end + 1;
+		} else {
+			keyob = DeeJson_ParseString(&parser);
+			if unlikely(!keyob)
+				goto err_r;
+			key = DeeString_AsUtf8(keyob);
+			if unlikely(!key)
+				goto err_r_keyob;
+			keylen = WSTR_LENGTH(key);
+		}
+		if unlikely(libjson_parser_yield(&parser) != JSON_PARSER_COLON)
+			goto err_r_keyob_syntax;
+
+		/* Insert the key (if the same key appears more than once, the first one wins) */
+		hash    = Dee_HashUtf8(key, keylen);
+		perturb = i = hash & mask;
+		for (;; i = (i << 2) + i + perturb + 1, perturb >>= 5) {
+			struct json_keyindex_entry *ent = &result->jki_elem[i & mask];
+			if (!ent->jke_key) {
+				ent->jke_key    = key;
+				ent->jke_keylen = keylen;
+				ent->jke_hash   = hash;
+				ent->jke_value  = parser.jp_pos;
+				ent->jke_keyob  = keyob; /* Inherit reference */
+				break;
+			}
+			if (ent->jke_hash == hash && ent->jke_keylen == keylen &&
+			    bcmp(ent->jke_key, key, keylen) == 0) {
+				Dee_XDecref(keyob);
+				break;
+			}
+		}
+
+		/* Skip the value (and the trailing `,') */
+		tok = libjson_parser_next(&parser);
+		if unlikely(tok == JSON_ERROR_SYNTAX)
+			goto err_r_syntax;
+		if (tok != JSON_ERROR_OK)
+			break;
+	}
+	return result;
+err_r_keyob_syntax:
+	Dee_XDecref(keyob);
+err_r_syntax:
+	err_json_syntax();
+	goto err_r;
+err_r_keyob:
+	Dee_Decref(keyob);
+err_r:
+	json_keyindex_destroy(result);
+err:
+	return NULL;
+}
+
+/* Return the key index of `self' (building it if necessary)
+ * @return: * :   The index
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) struct json_keyindex *DCALL
+jmap_getindex(DeeJsonMappingObject *__restrict self) {
+	struct json_keyindex *result = atomic_read(&self->jm_index);
+	if (result == NULL) {
+		result = json_keyindex_build(self);
+		if unlikely(!result)
+			goto err;
+		if unlikely(!atomic_cmpxch(&self->jm_index, NULL, result)) {
+			json_keyindex_destroy(result);
+			result = atomic_read(&self->jm_index);
+		}
+	}
+	return result;
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1, 2, 3)) DREF DeeObject *DCALL
 jmap_nsi_getdefault(DeeJsonMappingObject *self,
                     DeeObject *key, DeeObject *defl) {
@@ -1010,6 +1138,33 @@ jmap_nsi_getdefault(DeeJsonMappingObject *self,
 	if (DeeObject_AssertTypeExact(key, &DeeString_Type))
 		goto err;
 	keystr = DeeString_AsUtf8(key);
+	if unlikely(!keystr)
+		goto err;
+	if (self->jm_parser.jp_encoding == JSON_ENCODING_UTF8) {
+		/* Lookup the key using the index */
+		Dee_hash_t i, perturb, hash;
+		size_t keylen = WSTR_LENGTH(keystr);
+		struct json_keyindex *index = jmap_getindex(self);
+		if unlikely(!index)
+			goto err;
+		hash    = Dee_HashUtf8(keystr, keylen);
+		perturb = i = hash & index->jki_mask;
+		for (;; i = (i << 2) + i + perturb + 1, perturb >>= 5) {
+			struct json_keyindex_entry *ent = &index->jki_elem[i & index->jki_mask];
+			if (!ent->jke_key) {
+				if (defl != ITER_DONE)
+					Dee_Incref(defl);
+				return defl;
+			}
+			if (ent->jke_hash == hash && ent->jke_keylen == keylen &&
+			    bcmp(ent->jke_key, keystr, keylen) == 0) {
+				parser.djp_parser        = self->jm_parser;
+				parser.djp_parser.jp_pos = ent->jke_value;
+				parser.djp_owner         = self->jm_owner;
+				return DeeJson_ParseObject(&parser, false);
+			}
+		}
+	}
 	DeeJsonMapping_LockRead(self);
 	parser.djp_parser = self->jm_parser;
 	DeeJsonMapping_LockEndRead(self);
@@ -1161,9 +1316,15 @@ PRIVATE struct type_member tpconst jseq_members[] = {
 
 static_assert(offsetof(DeeJsonSequenceObject, js_owner) == offsetof(DeeJsonMappingObject, jm_owner));
 static_assert(offsetof(DeeJsonSequenceObject, js_owner) == offsetof(DeeJsonIteratorObject, ji_owner));
+PRIVATE NONNULL((1)) void DCALL
+jmap_fini(DeeJsonMappingObject *__restrict self) {
+	if (self->jm_index)
+		json_keyindex_destroy(self->jm_index);
+	Dee_Decref(self->jm_owner);
+}
+
 #define jseqiter_fini    jseq_fini
 #define jmapiter_fini    jseq_fini
-#define jmap_fini        jseq_fini
 #define jseqiter_visit   jseq_visit
 #define jmapiter_visit   jseq_visit
 #define jmap_visit       jseq_visit
@@ -1382,6 +1543,7 @@ DeeJsonMapping_New(DeeJsonParser *__restrict self, bool must_advance_parser) {
 		if (libjson_parser_next(&self->djp_parser) == JSON_ERROR_SYNTAX)
 			goto err_syntax_object_retval;
 	}
+	result->jm_index = NULL;
 	Dee_atomic_rwlock_init(&result->jm_lock);
 	result->jm_owner = self->djp_owner;
 	Dee_Incref(self->djp_owner);
@@ -3099,6 +3261,8 @@ DeeObject_PopulateFromMapping(DeeObject *self, DeeObject *mapping) {
 	return DeeError_NOTIMPLEMENTED();
 }
 
+/* Fast paths for `json.write()' (plain strings, class writers and buffered File output) */
+#include "writer.c.inl"
 
 PRIVATE WUNUSED NONNULL((2)) dssize_t DCALL
 json_foreach_write_item(void *arg, DeeObject *elem) {
@@ -3204,7 +3368,11 @@ DeeJson_WriteObject(DeeJsonWriter *__restrict self,
                     DeeObject *__restrict obj) {
 	DeeTypeObject *type = Dee_TYPE(obj);
 	if (type == &DeeString_Type) {
-		char const *utf8 = DeeString_AsUtf8(obj);
+		char const *utf8;
+		int status = json_writer_putplainstring(self, obj);
+		if (status <= 0)
+			return status;
+		utf8 = DeeString_AsUtf8(obj);
 		if unlikely(!utf8)
 			goto err;
 		if unlikely(libjson_writer_putstring(&self->djw_writer, utf8, WSTR_LENGTH(utf8)))
@@ -3294,15 +3462,24 @@ DeeJson_WriteObject(DeeJsonWriter *__restrict self,
 			if unlikely(libjson_writer_endarray(&self->djw_writer))
 				goto err;
 		} else {
-			DeeObject *old_obj;
+			int status = 1;
 			/* Generic object (write attributes as an object) */
 			if unlikely(libjson_writer_beginobject(&self->djw_writer))
 				goto err;
-			old_obj = self->djw_obj;
-			self->djw_obj = obj;
-			if unlikely(DeeObject_EnumAttr(Dee_TYPE(obj), obj, &json_foreach_write_attribute, self) < 0)
-				goto err;
-			self->djw_obj = old_obj;
+			if (DeeType_IsClass(type)) {
+				/* Use the compiled writer of the object's class. */
+				status = json_writer_putclassfields(self, obj);
+				if unlikely(status < 0)
+					goto err;
+			}
+			if (status > 0) {
+				DeeObject *old_obj;
+				old_obj = self->djw_obj;
+				self->djw_obj = obj;
+				if unlikely(DeeObject_EnumAttr(type, obj, &json_foreach_write_attribute, self) < 0)
+					goto err;
+				self->djw_obj = old_obj;
+			}
 			if unlikely(libjson_writer_endobject(&self->djw_writer))
 				goto err;
 		}
@@ -3334,14 +3511,23 @@ err:
 	return NULL;
 }
 
-PRIVATE struct keyword parse_kwlist[] = { K(data), K(into), KEND };
+/* Streaming JSON parser (`json.Reader', `json.select()' and `json.ndjson()') */
+#include "stream.c.inl"
+
+PRIVATE struct keyword parse_kwlist[] = { K(data), K(into), K(lazy), KEND };
 PRIVATE WUNUSED DREF DeeObject *DCALL
 f_libjson_parse(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 	DREF DeeObject *result;
 	DeeJsonParser parser;
 	DeeObject *data, *into = NULL;
-	if (DeeArg_UnpackKw(argc, argv, kw, parse_kwlist, "o|o:parse", &data, &into))
+	bool lazy = true;
+	if (DeeArg_UnpackKw(argc, argv, kw, parse_kwlist, "o|ob:parse", &data, &into, &lazy))
 		goto err;
+	if (!lazy && !into &&
+	    (DeeBytes_Check(data) || DeeString_Check(data) || DeeFile_Check(data))) {
+		/* Eagerly parse everything into native objects. */
+		return json_stream_parseone(data);
+	}
 	if (DeeBytes_Check(data)) {
 		/* Parse raw bytes as JSON. */
 		void *start = DeeBytes_DATA(data);
@@ -3422,7 +3608,7 @@ err:
 	return NULL;
 }
 
-PRIVATE struct keyword write_kwlist[] = { K(data), K(into), K(pretty), K(recursion), KEND };
+PRIVATE struct keyword write_kwlist[] = { K(data), K(into), K(pretty), K(recursion), K(bufsize), KEND };
 PRIVATE WUNUSED DREF DeeObject *DCALL
 f_libjson_write(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 	int error;
@@ -3430,9 +3616,10 @@ f_libjson_write(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 	bool pretty = false;
 	unsigned int format;
 	DeeObject *data, *into = NULL;
+	size_t bufsize = JSON_WRITER_DEFAULT_BUFSIZE;
 	writer.djw_recursion = Dee_None;
-	if (DeeArg_UnpackKw(argc, argv, kw, write_kwlist, "o|obo:write",
-	                    &data, &into, &pretty, &writer.djw_recursion))
+	if (DeeArg_UnpackKw(argc, argv, kw, write_kwlist, "o|obo" UNPuSIZ ":write",
+	                    &data, &into, &pretty, &writer.djw_recursion, &bufsize))
 		goto err;
 #if JSON_WRITER_FORMAT_COMPACT == 0 && JSON_WRITER_FORMAT_PRETTY == 1
 	format = (unsigned int)pretty;
@@ -3444,13 +3631,32 @@ f_libjson_write(size_t argc, DeeObject *const *argv, DeeObject *kw) {
 
 	/* Produce JSON data, either writing it to a file, or to a string. */
 	if (into) {
-		if (DeeJsonWriter_Init(&writer, (dformatprinter)&DeeFile_WriteAll, into, format))
+		struct json_fileprinter printer;
+		if (bufsize == 0) {
+			/* Unbuffered: write every token directly to `into' */
+			if (DeeJsonWriter_Init(&writer, (dformatprinter)&DeeFile_WriteAll, into, format))
+				goto err;
+			error = DeeJson_WriteObject(&writer, data);
+			DeeJsonWriter_Fini(&writer);
+			if unlikely(error != 0)
+				goto err;
+			return_reference_(into);
+		}
+		if unlikely(json_fileprinter_init(&printer, into, bufsize))
 			goto err;
+		if (DeeJsonWriter_Init(&writer, &json_fileprinter_print, &printer, format))
+			goto err_fileprinter;
 		error = DeeJson_WriteObject(&writer, data);
 		DeeJsonWriter_Fini(&writer);
+		if likely(error == 0)
+			error = json_fileprinter_flush(&printer);
 		if unlikely(error != 0)
-			goto err;
+			goto err_fileprinter;
+		json_fileprinter_fini(&printer);
 		return_reference_(into);
+err_fileprinter:
+		json_fileprinter_fini(&printer);
+		goto err;
 	} else {
 		struct ascii_printer printer = ASCII_PRINTER_INIT;
 		if (DeeJsonWriter_Init(&writer, &ascii_printer_print, &printer, format))
@@ -3478,9 +3684,15 @@ PRIVATE struct dex_symbol symbols[] = {
 	   *       components of a larger JSON-blob. For this, it's probably best to implement
 	   *       a sub-set of JsonPath: https://github.com/json-path/JsonPath
 	   */
-	  DOC("(data:?X4?DFile?DBytes?Dstring?DMapping)->?X7?Dfloat?Dint?Dstring?Dbool?N?GSequence?GMapping\n"
+	  DOC("(data:?X4?DFile?DBytes?Dstring?DMapping,lazy=!t)->?X9?Dfloat?Dint?Dstring?Dbool?N?GSequence?GMapping?DList?DDict\n"
 	      "(data:?X4?DFile?DBytes?Dstring?DMapping,into)->\n"
 	      "(data:?X4?DFile?DBytes?Dstring?DMapping,into:?DType)->\n"
+	      "#plazy{When ?t (the default), JSON objects and arrays are returned as views (?GMapping "
+	      /*   */ "and ?GSequence) of the original JSON blob, which only parse the parts that are "
+	      /*   */ "actually accessed. The members of a ?GMapping are indexed upon its first lookup, "
+	      /*   */ "such that further lookups don't have to re-scan the JSON blob. When ?f, the "
+	      /*   */ "entire JSON blob is parsed immediately, and objects and arrays are returned "
+	      /*   */ "as ?DDict and ?DList}"
 	      "Parse JSON @data and convert it either into its native deemon representation, or "
 	      /**/ "use it to populate the fields of an object @into, or by creating a new instance "
 	      /**/ "of a ?DType @into (by calling its construct without any arguments), filling its "
@@ -3494,21 +3706,59 @@ PRIVATE struct dex_symbol symbols[] = {
 	      /**/ "effect.") },
 	{ "write", (DeeObject *)&libjson_write, MODSYM_FNORMAL,
 	  DOC("(data:?X8?O?Dfloat?Dint?Dstring?Dbool?N?DSequence?DMapping,pretty=!f,recursion:?X2?DCallable?N=!N)->?Dstring\n"
-	      "(data:?X8?O?Dfloat?Dint?Dstring?Dbool?N?DSequence?DMapping,into:?DFile,pretty=!f,recursion:?X2?DCallable?N=!N)->?DFile\n"
+	      "(data:?X8?O?Dfloat?Dint?Dstring?Dbool?N?DSequence?DMapping,into:?DFile,pretty=!f,recursion:?X2?DCallable?N=!N,bufsize=!8192)->?DFile\n"
 	      "#precursion{An optional callback that is invoked to replace inner instances of objects referencing "
 	      /*       */ "themselves via some attribute. When set to ?N, or if the object returned by the callback, "
 	      /*       */ "is also currently being written, a :ValueError is thrown instead.}"
+	      "#pbufsize{The size of the buffer used to write to @into in chunks, such that @into only "
+	      /*     */ "sees a few large writes. Pass $0 to write every token directly to @into}"
 	      "Convert a native deemon object @data into JSON and write said JSON to @into, or pack it "
 	      /**/ "into a string which is then returned. In either case, you can use @pretty to specify "
 	      /**/ "if a pretty representation (using newlines, and indentation), or a compact one should "
 	      /**/ "be used in generated JSON. The default is to generate compact JSON.") },
+	{ "Reader", (DeeObject *)&DeeJsonReader_Type, MODSYM_FNORMAL },
+	{ "select", (DeeObject *)&libjson_select, MODSYM_FNORMAL,
+	  DOC("(data:?X3?DFile?DBytes?Dstring,path:?Dstring,bufsize=!65536)->?S?X7?Dfloat?Dint?Dstring?Dbool?N?DList?DDict\n"
+	      "#tValueError{@path isn't a valid path}"
+	      "Incrementally parse @data (which may contain any number of JSON values) and "
+	      /**/ "return an iterator that yields every value matching @path\n"
+	      "Only values that match are constructed (using ?DDict and ?DList for objects and arrays); "
+	      /**/ "everything else is skipped as it is read, such that @data may be larger than memory\n"
+	      "@path is a sub-set of JSONPath, consisting of an optional leading $\"$\", followed by "
+	      /**/ "any number of $\".name\", $\"['name']\", $\"[N]\", $\".*\" or $\"[*]\"\n"
+	      "${"
+	      /**/ "import json;\n"
+	      /**/ "with (local fp = File.open(\"orders.json\")) {\n"
+	      /**/ "	for (local total: json.select(fp, \"$.orders[*].total\"))\n"
+	      /**/ "		print total;\n"
+	      /**/ "}"
+	      "}") },
+	{ "ndjson", (DeeObject *)&libjson_ndjson, MODSYM_FNORMAL,
+	  DOC("(data:?X3?DFile?DBytes?Dstring,bufsize=!65536)->?S?X7?Dfloat?Dint?Dstring?Dbool?N?DList?DDict\n"
+	      "Incrementally parse newline-delimited JSON (or any other sequence of JSON values "
+	      /**/ "separated by whitespace) and return an iterator that yields each value in turn\n"
+	      "Same as ${select(data, \"$\")}") },
 	{ "Sequence", (DeeObject *)&DeeJsonSequence_Type },
 	{ "Mapping", (DeeObject *)&DeeJsonMapping_Type },
 	{ NULL }
 };
 
+PRIVATE void DCALL
+libjson_fini(DeeDexObject *__restrict UNUSED(self)) {
+	json_classwriter_cache_clear();
+}
+
+PRIVATE bool DCALL
+libjson_clear(DeeDexObject *__restrict UNUSED(self)) {
+	return json_classwriter_cache_clear();
+}
+
 PUBLIC struct dex DEX = {
-	/* .d_symbols = */ symbols
+	/* .d_symbols = */ symbols,
+	/* .d_init    = */ NULL,
+	/* .d_fini    = */ &libjson_fini,
+	/* .d_imports = */ { NULL },
+	/* .d_clear   = */ &libjson_clear
 };
 
 DECL_END
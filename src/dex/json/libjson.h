@@ -42,11 +42,14 @@
  *
  * The JSON dex provides the following functions:
  * >> #define JSONObject (float | int | string | bool | none | Sequence | Mapping)
- * >> function parse(data: File | Bytes | string | Mapping): JSONObject;
+ * >> function parse(data: File | Bytes | string | Mapping, lazy: bool = true): JSONObject;
  * >> function parse(data: File | Bytes | string | Mapping, into: Object): Object;
  * >> function parse(data: File | Bytes | string | Mapping, into: Type): Object;
  * >> function write(data: Object | JSONObject, pretty: bool = false): string;
  * >> function write(data: Object | JSONObject, into: File, pretty: bool = false): File;
+ * >> class Reader: Iterator with (event: string, value: JSONObject) { ... };
+ * >> function select(data: File | Bytes | string, path: string): {JSONObject...};
+ * >> function ndjson(data: File | Bytes | string): {JSONObject...};
  *
  * Notes:
  * - When `parse(data)' returns a Sequence of Mapping, JSON input data may not be
@@ -54,7 +57,10 @@
  *   types that only parse JSON input as it is requested via sequence operations.
  *   In order to force evaluation of JSON input, you can cast the result to another
  *   type of sequence which will then force evaluation (just like with all other
- *   sequence proxy types)
+ *   sequence proxy types). Alternatively, pass `lazy: false' to have `parse'
+ *   evaluate everything immediately (returning `Dict' and `List' objects).
+ * - Lazy Mappings index their members upon the first key lookup, such that
+ *   subsequent lookups no longer have to re-scan the underlying JSON blob.
  * - When given a `Mapping', `parse' behaves the same as though `json.write(data)'
  *   was given instead (iow: it will treat the contents of the mapping as a parsed
  *   JSON object and either re-return the mapping, or write its elements to `into')
@@ -86,11 +92,23 @@
  * - `parse(File)' is the same as `parse(File.readall())', as in: there is no
  *   way to only parse a single JSON object from a file and leave the file's
  *   pointer such that it points directly after the JSON object.
+ *   Use `Reader', `select' or `ndjson' to process files incrementally instead.
+ *   Those read their input in chunks (so memory usage is bounded by the largest
+ *   token and the nesting depth, rather than the size of the document), allow
+ *   any number of top-level values, and only construct objects for values that
+ *   are actually requested.
+ * - `select' accepts a sub-set of JSONPath: `$', `.name', `['name']', `[N]',
+ *   `.*' and `[*]'. It yields every match (within each top-level value) as a
+ *   native JSON object (using `Dict' and `List' for objects and arrays).
  * - `parse(data, Type)' is the same as `parse(data, Type())',
  * - Only `public' members of DTOs will be initialized by `parse'
  * - `write' will encode JSONObject-types as would be expected, and all other
  *   objects are treated as DTOs and have their attributes enumerated and then
  *   written to the output file.
+ * - For instances of user-defined classes, the list of attributes that `write'
+ *   has to write is only determined once per class, after which fields are read
+ *   directly from instances. `write(data, into)' writes to `into' in chunks of
+ *   `bufsize' bytes (rather than one token at a time).
  * - Under the hood, the JSON dex uses a port of KOS's libjson system library
  * - Fun fact: with the exception of needing to write `none' instead of `null',
  *   deemon is actually syntactically compatible with JSON, and if you were to
@@ -180,15 +198,34 @@ typedef struct {
 #define DeeJsonSequence_LockEndRead(self)    Dee_atomic_rwlock_endread(&(self)->js_lock)
 #define DeeJsonSequence_LockEnd(self)        Dee_atomic_rwlock_end(&(self)->js_lock)
 
+/* Index of the members of a JSON object, which is built upon the first
+ * key lookup of a `DeeJsonMappingObject', such that further lookups are
+ * O(1) (rather than having to re-scan the object's JSON every time).
+ * Only values are located by the index; they are still parsed on access. */
+struct json_keyindex_entry {
+	char const     *jke_key;    /* [0..jke_keylen][const] UTF-8 key (NULL for unused entries); points into
+	                             * the JSON blob itself, or (if it contains escape sequences) `jke_keyob' */
+	size_t          jke_keylen; /* [const] Length of `jke_key' (in bytes) */
+	Dee_hash_t      jke_hash;   /* [const] `Dee_HashUtf8(jke_key, jke_keylen)' */
+	char const     *jke_value;  /* [1..1][const] Parser position of the member's value (after the `:') */
+	DREF DeeObject *jke_keyob;  /* [0..1][const] Decoded key (only for keys with escape sequences) */
+};
+
+struct json_keyindex {
+	size_t                                                jki_mask; /* [const] Hash-mask */
+	COMPILER_FLEXIBLE_ARRAY(struct json_keyindex_entry, jki_elem);  /* [jki_mask + 1] Hash-vector */
+};
+
 typedef struct {
 	OBJECT_HEAD
-	DREF DeeObject     *jm_owner;  /* [1..1][const] Object that owns the memory that underlies `jm_parser'. */
-	struct json_parser  jm_parser; /* [lock(jm_lock)] Parser that points to the name-token of a random object.
-	                                * member, or the closing `}'. Which of these, and what member exactly (if
-	                                * any) is undefined and depends on the field that was last accessed.
-	                                * Note that all fields but `jp_pos' are [const] here! */
+	DREF DeeObject       *jm_owner;  /* [1..1][const] Object that owns the memory that underlies `jm_parser'. */
+	struct json_parser    jm_parser; /* [lock(jm_lock)] Parser that points to the name-token of a random object.
+	                                  * member, or the closing `}'. Which of these, and what member exactly (if
+	                                  * any) is undefined and depends on the field that was last accessed.
+	                                  * Note that all fields but `jp_pos' are [const] here! */
+	struct json_keyindex *jm_index;  /* [0..1][owned][lock(WRITE_ONCE)] Index of object members (built upon first lookup) */
 #ifndef CONFIG_NO_THREADS
-	Dee_atomic_rwlock_t jm_lock;   /* Lock for this JSON-mapping. */
+	Dee_atomic_rwlock_t   jm_lock;   /* Lock for this JSON-mapping. */
 #endif /* !CONFIG_NO_THREADS */
 } DeeJsonMappingObject;
 
@@ -236,6 +273,8 @@ INTDEF DeeTypeObject DeeJsonSequence_Type;
 INTDEF DeeTypeObject DeeJsonSequenceIterator_Type;
 INTDEF DeeTypeObject DeeJsonMapping_Type;
 INTDEF DeeTypeObject DeeJsonMappingIterator_Type;
+INTDEF DeeTypeObject DeeJsonReader_Type;
+INTDEF DeeTypeObject DeeJsonSelection_Type;
 
 
 typedef struct {
@@ -0,0 +1,149 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_JSON_SIMD_H
+#define GUARD_DEX_JSON_SIMD_H 1
+
+#include <deemon/api.h>
+
+#include <hybrid/bit.h> /* CTZ() */
+
+#include <stddef.h> /* size_t */
+
+/* SSE2 is part of the x86_64 baseline, so no runtime CPU detection is
+ * necessary: when the compiler targets SSE2, it is used unconditionally. */
+#ifdef CONFIG_NO_JSON_SSE2
+#undef CONFIG_HAVE_JSON_SSE2
+#elif !defined(CONFIG_HAVE_JSON_SSE2) && \
+      (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+       (defined(_M_IX86_FP) && (_M_IX86_FP + 0) >= 2))
+#define CONFIG_HAVE_JSON_SSE2
+#endif /* ... */
+
+#ifdef CONFIG_HAVE_JSON_SSE2
+#include <emmintrin.h>
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+
+DECL_BEGIN
+
+/* SSE2 kernels for scanning JSON text 16 bytes at a time
+ * (s.a. `CONFIG_HAVE_JSON_SSE2'). Only unaligned loads that lie entirely
+ * within the given buffer are used, and trailing data is handled by scalar
+ * loops. */
+#ifdef CONFIG_HAVE_JSON_SSE2
+#define JSON_SSE2_LOADU(p) _mm_loadu_si128((__m128i const *)(void const *)(p))
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+
+/* Return a pointer to the first `"', `\' or control character
+ * in `iter...end' (or `end' if there is no such character). */
+LOCAL ATTR_PURE WUNUSED unsigned char *
+json_findspecial(unsigned char const *iter,
+                 unsigned char const *end) {
+#ifdef CONFIG_HAVE_JSON_SSE2
+	__m128i vquote = _mm_set1_epi8('\"');
+	__m128i vslash = _mm_set1_epi8('\\');
+	__m128i vctrl  = _mm_set1_epi8(0x1f);
+	for (; (size_t)(end - iter) >= 16; iter += 16) {
+		__m128i chars = JSON_SSE2_LOADU(iter);
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, vquote),
+		                                                                 _mm_cmpeq_epi8(chars, vslash)),
+		                                                    _mm_cmpeq_epi8(_mm_min_epu8(chars, vctrl), chars)));
+		if (mask)
+			return (unsigned char *)iter + CTZ(mask);
+	}
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+	for (; iter < end; ++iter) {
+		unsigned char ch = *iter;
+		if (ch == '\"' || ch == '\\' || ch < 0x20)
+			break;
+	}
+	return (unsigned char *)iter;
+}
+
+/* Return a pointer to the first `{', `}', `[', `]' or `"'
+ * in `iter...end' (or `end' if there is no such character).
+ * Note that `ch | 0x20' maps `[' to `{' and `]' to `}' (and
+ * no other character to either), which halves the compares. */
+LOCAL ATTR_PURE WUNUSED unsigned char *
+json_findstructural(unsigned char const *iter,
+                    unsigned char const *end) {
+#ifdef CONFIG_HAVE_JSON_SSE2
+	__m128i vquote = _mm_set1_epi8('\"');
+	__m128i vcase  = _mm_set1_epi8(0x20);
+	__m128i vopen  = _mm_set1_epi8('{');
+	__m128i vclose = _mm_set1_epi8('}');
+	for (; (size_t)(end - iter) >= 16; iter += 16) {
+		__m128i chars = JSON_SSE2_LOADU(iter);
+		__m128i folded = _mm_or_si128(chars, vcase);
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, vopen),
+		                                                                 _mm_cmpeq_epi8(folded, vclose)),
+		                                                    _mm_cmpeq_epi8(chars, vquote)));
+		if (mask)
+			return (unsigned char *)iter + CTZ(mask);
+	}
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+	for (; iter < end; ++iter) {
+		unsigned char ch = *iter | 0x20;
+		if (ch == '{' || ch == '}' || *iter == '\"')
+			break;
+	}
+	return (unsigned char *)iter;
+}
+
+/* Return a pointer to the first character in `iter...end' that can't be
+ * written as-is into a JSON string, that is: `"', `\', a control character,
+ * or any character that isn't ASCII (or `end' if there is no such character).
+ * Note that a signed compare against 0x20 catches both control characters
+ * and bytes >= 0x80. */
+LOCAL ATTR_PURE WUNUSED unsigned char *
+json_findescape(unsigned char const *iter,
+                unsigned char const *end) {
+#ifdef CONFIG_HAVE_JSON_SSE2
+	__m128i vquote = _mm_set1_epi8('\"');
+	__m128i vslash = _mm_set1_epi8('\\');
+	__m128i vdel   = _mm_set1_epi8(0x7f);
+	__m128i vspace = _mm_set1_epi8(0x20);
+	for (; (size_t)(end - iter) >= 16; iter += 16) {
+		__m128i chars = JSON_SSE2_LOADU(iter);
+		unsigned int mask;
+		mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, vquote),
+		                                                                 _mm_cmpeq_epi8(chars, vslash)),
+		                                                    _mm_or_si128(_mm_cmpeq_epi8(chars, vdel),
+		                                                                 _mm_cmplt_epi8(chars, vspace))));
+		if (mask)
+			return (unsigned char *)iter + CTZ(mask);
+	}
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+	for (; iter < end; ++iter) {
+		unsigned char ch = *iter;
+		if (ch == '\"' || ch == '\\' || ch < 0x20 || ch >= 0x7f)
+			break;
+	}
+	return (unsigned char *)iter;
+}
+
+#ifdef CONFIG_HAVE_JSON_SSE2
+#undef JSON_SSE2_LOADU
+#endif /* CONFIG_HAVE_JSON_SSE2 */
+
+DECL_END
+
+#endif /* !GUARD_DEX_JSON_SIMD_H */
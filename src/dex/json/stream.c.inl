@@ -0,0 +1,1461 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_JSON_STREAM_C_INL
+#define GUARD_DEX_JSON_STREAM_C_INL 1
+#ifdef __INTELLISENSE__
+#include "libjson.c"
+#endif /* __INTELLISENSE__ */
+
+#include "simd.h"
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/bytes.h>
+#include <deemon/dict.h>
+#include <deemon/error.h>
+#include <deemon/file.h>
+#include <deemon/float.h>
+#include <deemon/int.h>
+#include <deemon/list.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/seq.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* memmove(), memcmp() */
+#include <deemon/tuple.h>
+#include <deemon/util/lock.h>
+
+#include <stdint.h> /* uint64_t, int64_t */
+
+DECL_BEGIN
+
+/* Streaming JSON parser.
+ *
+ * Unlike `json.parse()', which needs the whole document in memory, this
+ * parser reads its input in chunks from a `File' (or walks a Bytes/string
+ * object), such that memory usage is bounded by the buffer size, the size
+ * of the largest token (a buffer is grown to hold a whole token when it
+ * needs to), and the nesting depth of the document.
+ *
+ * Values that are skipped (e.g. because they don't match a path given to
+ * `json.select()') are only scanned for their extent and are never turned
+ * into objects. Any number of JSON values may follow each other in the
+ * input (separated by whitespace), which is how NDJSON is read.
+ *
+ * Streamed input must be UTF-8 (an optional BOM is skipped). */
+
+PRIVATE double const json_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15
+};
+
+/* Fast path for the most common forms of numbers: integers with at most
+ * 18 digits, and decimals without exponent with at most 15 digits (such
+ * that the digits are exactly representable as a double, and a single,
+ * correctly rounded division by an exact power of 10 gives the correctly
+ * rounded result).
+ * @return: * :         The parsed number
+ * @return: NULL:       An error was thrown
+ * @return: ITER_DONE:  Not a simple number (must be parsed by libjson) */
+PRIVATE WUNUSED DREF DeeObject *DCALL
+json_parse_fastnumber(unsigned char const *iter,
+                      unsigned char const *end) {
+	unsigned char const *digits;
+	uint64_t mantissa = 0;
+	size_t ndigits, nfrac;
+	bool negative = false;
+	if (iter < end && *iter == '-') {
+		negative = true;
+		++iter;
+	}
+	digits = iter;
+	while (iter < end && *iter >= '0' && *iter <= '9') {
+		mantissa = mantissa * 10 + (*iter - '0');
+		++iter;
+	}
+	ndigits = (size_t)(iter - digits);
+	if (!ndigits || ndigits > 18)
+		goto slow;
+	if (ndigits > 1 && *digits == '0')
+		goto slow; /* libjson parses these as octal */
+	if (iter >= end) {
+		int64_t value = (int64_t)mantissa;
+		if (negative)
+			value = -value;
+		return DeeInt_NewInt64(value);
+	}
+	if (*iter != '.')
+		goto slow;
+	digits = ++iter;
+	while (iter < end && *iter >= '0' && *iter <= '9') {
+		mantissa = mantissa * 10 + (*iter - '0');
+		++iter;
+	}
+	nfrac = (size_t)(iter - digits);
+	if (!nfrac || iter < end || ndigits + nfrac > 15)
+		goto slow;
+	{
+		double value = (double)mantissa / json_pow10[nfrac];
+		if (negative)
+			value = -value;
+		return DeeFloat_New(value);
+	}
+slow:
+	return ITER_DONE;
+}
+
+
+#define JSON_STREAM_DEFAULT_BUFSIZE (64 * 1024)
+
+/* Result values of `json_stream_peekc()' */
+#define JSON_STREAM_EOF (-2) /* End of input */
+#define JSON_STREAM_ERR (-1) /* An error was thrown */
+
+/* Tokens returned by `json_stream_advance()' */
+#define JSON_STREAM_TOK_NONE  0 /* Nothing was peeked, yet */
+#define JSON_STREAM_TOK_VALUE 1 /* A value is next (consume with `json_stream_read()',
+                                 * `json_stream_skip()' or `json_stream_enter()') */
+#define JSON_STREAM_TOK_KEY   2 /* The key of an object member is next (s.a. `js_key') */
+#define JSON_STREAM_TOK_END   3 /* The current object/array ends (consume with `json_stream_leave()') */
+#define JSON_STREAM_TOK_EOF   4 /* End of input */
+
+struct json_stream_frame {
+#define JSON_STREAM_FRAME_FARRAY  0x00 /* Frame is an array */
+#define JSON_STREAM_FRAME_FOBJECT 0x01 /* Frame is an object */
+#define JSON_STREAM_FRAME_FFIRST  0x02 /* No element was encountered, yet */
+	unsigned int jsf_flags; /* Set of `JSON_STREAM_FRAME_F*' */
+	size_t       jsf_count; /* # of elements encountered so far */
+};
+
+struct json_stream {
+	DREF DeeObject           *js_file;    /* [0..1][const] File from which data is read (NULL if all data is in `js_buf') */
+	DREF DeeObject           *js_owner;   /* [0..1][const] Owner of `js_buf' when `js_file' is NULL */
+	unsigned char            *js_buf;     /* [0..js_bufsize][owned_if(js_file)] Data buffer */
+	size_t                    js_bufsize; /* Allocated buffer size */
+	unsigned char            *js_pos;     /* [1..1][in(js_buf)] Current read position */
+	unsigned char            *js_end;     /* [1..1][in(js_buf)] End of data in `js_buf' */
+	struct json_stream_frame *js_stackv;  /* [0..js_stackc][owned] Stack of objects/arrays that were entered */
+	size_t                    js_stackc;  /* # of objects/arrays that were entered */
+	size_t                    js_stacka;  /* Allocated stack size */
+	size_t                    js_index;   /* [valid_if(js_tok == JSON_STREAM_TOK_VALUE || js_tok == JSON_STREAM_TOK_KEY)]
+	                                       * Index of the next element within the inner-most object/array. */
+	DREF DeeObject           *js_key;     /* [0..1][valid_if(js_tok == JSON_STREAM_TOK_KEY)] Key of the next object member */
+	int                       js_tok;     /* The next token (one of `JSON_STREAM_TOK_*') */
+	bool                      js_eof;     /* Set once `js_file' reached its end (always set if there is no file) */
+	bool                      js_bom;     /* Set once a leading BOM was checked for */
+};
+
+PRIVATE ATTR_COLD int DCALL err_json_unexpected_eof(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "Unexpected end of JSON input");
+}
+
+/* Initialize a JSON stream for `data' (a File, Bytes or string)
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_stream_init(struct json_stream *__restrict self,
+                 DeeObject *__restrict data, size_t bufsize) {
+	self->js_file  = NULL;
+	self->js_owner = NULL;
+	if (DeeFile_Check(data)) {
+		if (bufsize < 16)
+			bufsize = 16;
+		self->js_buf = (unsigned char *)Dee_Malloc(bufsize);
+		if unlikely(!self->js_buf)
+			goto err;
+		self->js_bufsize = bufsize;
+		self->js_end     = self->js_buf;
+		self->js_eof     = false;
+		self->js_file    = data;
+	} else if (DeeBytes_Check(data)) {
+		self->js_buf     = (unsigned char *)DeeBytes_DATA(data);
+		self->js_end     = (unsigned char *)DeeBytes_TERM(data);
+		self->js_bufsize = DeeBytes_SIZE(data);
+		self->js_eof     = true;
+		self->js_owner   = data;
+	} else if (DeeString_Check(data)) {
+		char const *utf8 = DeeString_AsUtf8(data);
+		if unlikely(!utf8)
+			goto err;
+		self->js_buf     = (unsigned char *)utf8;
+		self->js_bufsize = WSTR_LENGTH(utf8);
+		self->js_end     = self->js_buf + self->js_bufsize;
+		self->js_eof     = true;
+		self->js_owner   = data;
+	} else {
+		DeeError_Throwf(&DeeError_TypeError,
+		                "Expected a File, Bytes or string, but got an instance of %k",
+		                Dee_TYPE(data));
+		goto err;
+	}
+	Dee_Incref(data);
+	self->js_pos    = self->js_buf;
+	self->js_stackv = NULL;
+	self->js_stackc = 0;
+	self->js_stacka = 0;
+	self->js_key    = NULL;
+	self->js_tok    = JSON_STREAM_TOK_NONE;
+	self->js_bom    = false;
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+json_stream_fini(struct json_stream *__restrict self) {
+	if (self->js_file) {
+		Dee_Free(self->js_buf);
+		Dee_Decref(self->js_file);
+	} else {
+		Dee_Decref(self->js_owner);
+	}
+	Dee_Free(self->js_stackv);
+	if (self->js_tok == JSON_STREAM_TOK_KEY)
+		Dee_Decref(self->js_key);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+json_stream_visit(struct json_stream *__restrict self, dvisit_t proc, void *arg) {
+	Dee_XVisit(self->js_file);
+	Dee_XVisit(self->js_owner);
+}
+
+/* Read more data from the underlying file, moving `*p_keep...js_end' to
+ * the start of the buffer (and updating `*p_keep' and `js_pos' accordingly).
+ * When the buffer is full of data that must be kept, it is enlarged.
+ * @return: 1 : More data was read
+ * @return: 0 : End of input
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_stream_fill(struct json_stream *__restrict self,
+                 unsigned char **__restrict p_keep) {
+	size_t keep, posoff, count;
+	if (self->js_eof)
+		return 0;
+	keep   = (size_t)(self->js_end - *p_keep);
+	posoff = (size_t)(self->js_pos - *p_keep);
+	if (*p_keep != self->js_buf)
+		memmove(self->js_buf, *p_keep, keep);
+	if (keep >= self->js_bufsize) {
+		/* The current token doesn't fit into the buffer. */
+		size_t new_size = self->js_bufsize * 2;
+		unsigned char *new_buf = (unsigned char *)Dee_Realloc(self->js_buf, new_size);
+		if unlikely(!new_buf)
+			goto err;
+		self->js_buf     = new_buf;
+		self->js_bufsize = new_size;
+	}
+	*p_keep      = self->js_buf;
+	self->js_pos = self->js_buf + posoff;
+	self->js_end = self->js_buf + keep;
+	count = DeeFile_Read(self->js_file, self->js_end, self->js_bufsize - keep);
+	if unlikely(count == (size_t)-1)
+		goto err;
+	if (!count) {
+		self->js_eof = true;
+		return 0;
+	}
+	self->js_end += count;
+	return 1;
+err:
+	return -1;
+}
+
+/* Skip whitespace and return the next character (without consuming it)
+ * @return: * :               The next character
+ * @return: JSON_STREAM_EOF : End of input
+ * @return: JSON_STREAM_ERR : An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_stream_peekc(struct json_stream *__restrict self) {
+	for (;;) {
+		unsigned char *keep;
+		int status;
+		while (self->js_pos < self->js_end) {
+			unsigned char ch = *self->js_pos;
+			if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r') {
+				if unlikely(!self->js_bom) {
+					self->js_bom = true;
+					if (ch == 0xef) {
+						/* Skip a UTF-8 BOM */
+						while ((size_t)(self->js_end - self->js_pos) < 3) {
+							keep   = self->js_pos;
+							status = json_stream_fill(self, &keep);
+							if (status <= 0) {
+								if (status < 0)
+									return JSON_STREAM_ERR;
+								break;
+							}
+						}
+						if ((size_t)(self->js_end - self->js_pos) >= 3 &&
+						    self->js_pos[1] == 0xbb && self->js_pos[2] == 0xbf) {
+							self->js_pos += 3;
+							continue;
+						}
+					}
+				}
+				return ch;
+			}
+			++self->js_pos;
+		}
+		keep   = self->js_pos;
+		status = json_stream_fill(self, &keep);
+		if (status <= 0)
+			return status == 0 ? JSON_STREAM_EOF : JSON_STREAM_ERR;
+	}
+}
+
+/* Make sure that the string token at `js_pos' is fully loaded into the buffer.
+ * @param: p_simple: Set to true if the string contains no escape sequences
+ *                   or control characters (such that its contents can be
+ *                   used as-is)
+ * @return: * :   Pointer to the end of the token (after the closing `"')
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) unsigned char *DCALL
+json_stream_scanstring(struct json_stream *__restrict self,
+                       bool *__restrict p_simple) {
+	size_t i = 1;
+	bool simple = true;
+	ASSERT(*self->js_pos == '"');
+	for (;;) {
+		unsigned char *start = self->js_pos;
+		int status;
+		for (;;) {
+			unsigned char *iter;
+			iter = json_findspecial(start + i, self->js_end);
+			i    = (size_t)(iter - start);
+			if (iter >= self->js_end)
+				break;
+			++i;
+			if (*iter == '"') {
+				*p_simple = simple;
+				return start + i;
+			}
+			simple = false;
+			if (*iter == '\\') {
+				if (start + i >= self->js_end) {
+					--i; /* Re-scan the escape once more data is available */
+					break;
+				}
+				++i;
+			}
+		}
+		status = json_stream_fill(self, &start);
+		if (status <= 0) {
+			if (status == 0)
+				err_json_unexpected_eof();
+			break;
+		}
+	}
+	return NULL;
+}
+
+/* Make sure that the word token (number, `true', `false' or `null') at
+ * `js_pos' is fully loaded into the buffer, and return its end.
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) unsigned char *DCALL
+json_stream_scanword(struct json_stream *__restrict self) {
+	size_t i = 0;
+	for (;;) {
+		unsigned char *start = self->js_pos;
+		int status;
+		for (; start + i < self->js_end; ++i) {
+			unsigned char ch = start[i];
+			if (!((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') ||
+			      (ch >= 'A' && ch <= 'Z') || ch == '-' || ch == '+' || ch == '.'))
+				return start + i;
+		}
+		status = json_stream_fill(self, &start);
+		if (status <= 0) {
+			if (status == 0)
+				return self->js_pos + i;
+			break;
+		}
+	}
+	return NULL;
+}
+
+/* Parse a string or number token `js_pos...end' using libjson */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+json_stream_parsetoken(struct json_stream *__restrict self,
+                       unsigned char *end, bool is_string) {
+	DREF DeeObject *result;
+	struct json_parser parser;
+	libjson_parser_init(&parser, self->js_pos, end);
+	result = is_string ? DeeJson_ParseString(&parser)
+	                   : DeeJson_ParseNumber(&parser);
+	json_parser_fini(&parser);
+	if likely(result)
+		self->js_pos = end;
+	return result;
+}
+
+/* Parse the scalar value (string, number, bool or null) at `js_pos',
+ * where `ch' is the character returned by `json_stream_peekc()' */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+json_stream_readscalar(struct json_stream *__restrict self, int ch) {
+	DREF DeeObject *result;
+	unsigned char *end;
+	size_t len;
+	if (ch == '"') {
+		bool simple;
+		end = json_stream_scanstring(self, &simple);
+		if unlikely(!end)
+			goto err;
+		if (!simple)
+			return json_stream_parsetoken(self, end, true);
+		result = DeeString_NewUtf8((char const *)self->js_pos + 1,
+		                           (size_t)(end - self->js_pos) - 2,
+		                           STRING_ERROR_FSTRICT);
+		if likely(result)
+			self->js_pos = end;
+		return result;
+	}
+	end = json_stream_scanword(self);
+	if unlikely(!end)
+		goto err;
+	len = (size_t)(end - self->js_pos);
+	if (len == 4 && memcmp(self->js_pos, "true", 4) == 0) {
+		self->js_pos = end;
+		return_true;
+	}
+	if (len == 5 && memcmp(self->js_pos, "false", 5) == 0) {
+		self->js_pos = end;
+		return_false;
+	}
+	if (len == 4 && memcmp(self->js_pos, "null", 4) == 0) {
+		self->js_pos = end;
+		return_none;
+	}
+	if (len && (ch == '-' || (ch >= '0' && ch <= '9'))) {
+		result = json_parse_fastnumber(self->js_pos, end);
+		if (result == ITER_DONE)
+			return json_stream_parsetoken(self, end, false);
+		if likely(result)
+			self->js_pos = end;
+		return result;
+	}
+	err_json_syntax();
+err:
+	return NULL;
+}
+
+/* Parse the value at `js_pos', constructing Dict/List objects for objects/arrays. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+json_stream_readvalue(struct json_stream *__restrict self) {
+	DREF DeeObject *result, *key, *value;
+	int ch = json_stream_peekc(self);
+	switch (ch) {
+
+	case JSON_STREAM_ERR:
+		goto err;
+
+	case JSON_STREAM_EOF:
+		goto err_eof;
+
+	case '{':
+		++self->js_pos;
+		result = DeeDict_New();
+		if unlikely(!result)
+			goto err;
+		ch = json_stream_peekc(self);
+		if (ch == '}') {
+			++self->js_pos;
+			break;
+		}
+		for (;;) {
+			if (ch != '"')
+				goto err_syntax_r;
+			key = json_stream_readscalar(self, ch);
+			if unlikely(!key)
+				goto err_r;
+			ch = json_stream_peekc(self);
+			if unlikely(ch != ':') {
+				Dee_Decref(key);
+				goto err_syntax_r;
+			}
+			++self->js_pos;
+			value = json_stream_readvalue(self);
+			if unlikely(!value) {
+				Dee_Decref(key);
+				goto err_r;
+			}
+			if unlikely(DeeDict_SetItem(result, key, value)) {
+				Dee_Decref(value);
+				Dee_Decref(key);
+				goto err_r;
+			}
+			Dee_Decref(value);
+			Dee_Decref(key);
+			ch = json_stream_peekc(self);
+			if (ch == '}') {
+				++self->js_pos;
+				break;
+			}
+			if (ch != ',')
+				goto err_syntax_r;
+			++self->js_pos;
+			ch = json_stream_peekc(self);
+		}
+		break;
+
+	case '[':
+		++self->js_pos;
+		result = DeeList_New();
+		if unlikely(!result)
+			goto err;
+		ch = json_stream_peekc(self);
+		if (ch == ']') {
+			++self->js_pos;
+			break;
+		}
+		for (;;) {
+			if (ch < 0)
+				goto err_syntax_r;
+			value = json_stream_readvalue(self);
+			if unlikely(!value)
+				goto err_r;
+			if unlikely(DeeList_Append(result, value)) {
+				Dee_Decref(value);
+				goto err_r;
+			}
+			Dee_Decref(value);
+			ch = json_stream_peekc(self);
+			if (ch == ']') {
+				++self->js_pos;
+				break;
+			}
+			if (ch != ',')
+				goto err_syntax_r;
+			++self->js_pos;
+			ch = json_stream_peekc(self);
+		}
+		break;
+
+	default:
+		result = json_stream_readscalar(self, ch);
+		break;
+	}
+	return result;
+err_syntax_r:
+	if (ch == JSON_STREAM_EOF) {
+		err_json_unexpected_eof();
+	} else if (ch != JSON_STREAM_ERR) {
+		err_json_syntax();
+	}
+err_r:
+	Dee_Decref(result);
+	goto err;
+err_eof:
+	err_json_unexpected_eof();
+err:
+	return NULL;
+}
+
+/* Discard all data before `js_pos' and read more data.
+ * @return: 1 : More data was read
+ * @return: 0 : End of input
+ * @return: -1: An error was thrown */
+LOCAL WUNUSED NONNULL((1)) int DCALL
+json_stream_refill(struct json_stream *__restrict self) {
+	unsigned char *keep = self->js_pos;
+	return json_stream_fill(self, &keep);
+}
+
+/* Skip the value at `js_pos' without constructing any objects.
+ * Objects and arrays are skipped by only looking at brackets and
+ * strings (which are located 16 bytes at a time when possible),
+ * and the buffer is discarded as it is scanned, such that values
+ * of any size can be skipped without enlarging the buffer.
+ * NOTE: Skipped values are only checked for balanced brackets.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_stream_skipvalue(struct json_stream *__restrict self) {
+	size_t depth;
+	unsigned char *iter;
+	int status;
+	int ch = json_stream_peekc(self);
+	switch (ch) {
+
+	case JSON_STREAM_ERR:
+		goto err;
+
+	case JSON_STREAM_EOF:
+		goto err_eof;
+
+	case '{':
+	case '[':
+		break;
+
+	case '"': {
+		bool simple;
+		iter = json_stream_scanstring(self, &simple);
+		if unlikely(!iter)
+			goto err;
+		self->js_pos = iter;
+		return 0;
+	}
+
+	default:
+		iter = json_stream_scanword(self);
+		if unlikely(!iter)
+			goto err;
+		if unlikely(iter == self->js_pos)
+			goto err_syntax;
+		self->js_pos = iter;
+		return 0;
+	}
+	++self->js_pos;
+	depth = 1;
+	for (;;) {
+		iter = json_findstructural(self->js_pos, self->js_end);
+		self->js_pos = iter;
+		if (iter >= self->js_end)
+			goto refill;
+		++self->js_pos;
+		switch (*iter) {
+
+		case '{':
+		case '[':
+			++depth;
+			break;
+
+		case '}':
+		case ']':
+			if (--depth == 0)
+				return 0;
+			break;
+
+		default:
+			/* Skip a string. */
+			for (;;) {
+				iter = json_findspecial(self->js_pos, self->js_end);
+				self->js_pos = iter;
+				if (iter >= self->js_end) {
+					status = json_stream_refill(self);
+					if (status <= 0)
+						goto err_status;
+					continue;
+				}
+				++self->js_pos;
+				if (*iter == '"')
+					break;
+				if (*iter == '\\') {
+					if (self->js_pos >= self->js_end) {
+						status = json_stream_refill(self);
+						if (status <= 0)
+							goto err_status;
+					}
+					++self->js_pos; /* Escaped character */
+				}
+			}
+			break;
+		}
+		continue;
+refill:
+		status = json_stream_refill(self);
+		if (status <= 0)
+			goto err_status;
+	}
+err_status:
+	if (status < 0)
+		goto err;
+err_eof:
+	err_json_unexpected_eof();
+	goto err;
+err_syntax:
+	err_json_syntax();
+err:
+	return -1;
+}
+
+/* Determine the next token (without consuming it)
+ * @return: * : One of `JSON_STREAM_TOK_*'
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_stream_advance(struct json_stream *__restrict self) {
+	struct json_stream_frame *frame;
+	int ch;
+	if (self->js_tok != JSON_STREAM_TOK_NONE)
+		return self->js_tok;
+	ch = json_stream_peekc(self);
+	if unlikely(ch == JSON_STREAM_ERR)
+		goto err;
+	if (!self->js_stackc) {
+		/* Top-level: any number of values may follow each other. */
+		self->js_tok = ch == JSON_STREAM_EOF ? JSON_STREAM_TOK_EOF
+		                                     : JSON_STREAM_TOK_VALUE;
+		self->js_index = 0;
+		return self->js_tok;
+	}
+	frame = &self->js_stackv[self->js_stackc - 1];
+	if (ch == ((frame->jsf_flags & JSON_STREAM_FRAME_FOBJECT) ? '}' : ']')) {
+		self->js_tok = JSON_STREAM_TOK_END;
+		return self->js_tok;
+	}
+	if (!(frame->jsf_flags & JSON_STREAM_FRAME_FFIRST)) {
+		if (ch != ',')
+			goto err_syntax;
+		++self->js_pos;
+		ch = json_stream_peekc(self);
+		if unlikely(ch == JSON_STREAM_ERR)
+			goto err;
+	}
+	if unlikely(ch == JSON_STREAM_EOF)
+		goto err_syntax;
+	frame->jsf_flags &= ~JSON_STREAM_FRAME_FFIRST;
+	self->js_index = frame->jsf_count++;
+	if (frame->jsf_flags & JSON_STREAM_FRAME_FOBJECT) {
+		DREF DeeObject *key;
+		if (ch != '"')
+			goto err_syntax;
+		key = json_stream_readscalar(self, ch);
+		if unlikely(!key)
+			goto err;
+		ch = json_stream_peekc(self);
+		if unlikely(ch != ':') {
+			Dee_Decref(key);
+			goto err_syntax;
+		}
+		++self->js_pos;
+		self->js_key = key;
+		self->js_tok = JSON_STREAM_TOK_KEY;
+	} else {
+		self->js_tok = JSON_STREAM_TOK_VALUE;
+	}
+	return self->js_tok;
+err_syntax:
+	if (ch == JSON_STREAM_EOF) {
+		err_json_unexpected_eof();
+	} else if (ch != JSON_STREAM_ERR) {
+		err_json_syntax();
+	}
+err:
+	return -1;
+}
+
+/* Consume a `JSON_STREAM_TOK_KEY' token and return the key. */
+PRIVATE ATTR_RETNONNULL WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+json_stream_takekey(struct json_stream *__restrict self) {
+	DREF DeeObject *result;
+	ASSERT(self->js_tok == JSON_STREAM_TOK_KEY);
+	result = self->js_key;
+	self->js_key = NULL;
+	self->js_tok = JSON_STREAM_TOK_VALUE; /* The member's value is next */
+	return result;
+}
+
+/* Consume a `JSON_STREAM_TOK_VALUE' token by parsing it. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+json_stream_read(struct json_stream *__restrict self) {
+	DREF DeeObject *result;
+	ASSERT(self->js_tok == JSON_STREAM_TOK_VALUE);
+	result = json_stream_readvalue(self);
+	if likely(result)
+		self->js_tok = JSON_STREAM_TOK_NONE;
+	return result;
+}
+
+/* Consume a `JSON_STREAM_TOK_VALUE' token by skipping it. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_stream_skip(struct json_stream *__restrict self) {
+	int result;
+	ASSERT(self->js_tok == JSON_STREAM_TOK_VALUE);
+	result = json_stream_skipvalue(self);
+	if likely(result == 0)
+		self->js_tok = JSON_STREAM_TOK_NONE;
+	return result;
+}
+
+/* Consume a `JSON_STREAM_TOK_VALUE' token that is an object or array
+ * by entering it (so that its elements are enumerated next).
+ * @return: 1 : The value isn't an object or array (nothing was consumed)
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_stream_enter(struct json_stream *__restrict self) {
+	struct json_stream_frame *frame;
+	int ch;
+	ASSERT(self->js_tok == JSON_STREAM_TOK_VALUE);
+	ch = json_stream_peekc(self);
+	if (ch != '{' && ch != '[')
+		return ch == JSON_STREAM_ERR ? -1 : 1;
+	if (self->js_stackc >= self->js_stacka) {
+		size_t new_alloc = self->js_stacka * 2;
+		if (!new_alloc)
+			new_alloc = 8;
+		frame = (struct json_stream_frame *)Dee_Reallocc(self->js_stackv, new_alloc,
+		                                                 sizeof(struct json_stream_frame));
+		if unlikely(!frame)
+			goto err;
+		self->js_stackv = frame;
+		self->js_stacka = new_alloc;
+	}
+	frame = &self->js_stackv[self->js_stackc++];
+	frame->jsf_flags = JSON_STREAM_FRAME_FFIRST;
+	if (ch == '{')
+		frame->jsf_flags |= JSON_STREAM_FRAME_FOBJECT;
+	frame->jsf_count = 0;
+	++self->js_pos;
+	self->js_tok = JSON_STREAM_TOK_NONE;
+	return 0;
+err:
+	return -1;
+}
+
+/* Consume a `JSON_STREAM_TOK_END' token.
+ * @return: true: The object/array that was left was an object. */
+PRIVATE NONNULL((1)) bool DCALL
+json_stream_leave(struct json_stream *__restrict self) {
+	struct json_stream_frame *frame;
+	ASSERT(self->js_tok == JSON_STREAM_TOK_END);
+	ASSERT(self->js_stackc);
+	frame = &self->js_stackv[--self->js_stackc];
+	++self->js_pos;
+	self->js_tok = JSON_STREAM_TOK_NONE;
+	return (frame->jsf_flags & JSON_STREAM_FRAME_FOBJECT) != 0;
+}
+
+
+/* Eagerly parse the first JSON value from `data' (a File, Bytes or string) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+json_stream_parseone(DeeObject *__restrict data) {
+	DREF DeeObject *result;
+	struct json_stream stream;
+	if unlikely(json_stream_init(&stream, data, JSON_STREAM_DEFAULT_BUFSIZE))
+		goto err;
+	result = json_stream_readvalue(&stream);
+	json_stream_fini(&stream);
+	return result;
+err:
+	return NULL;
+}
+
+
+/************************************************************************/
+/* json.Reader                                                          */
+/************************************************************************/
+typedef struct {
+	OBJECT_HEAD
+#ifndef CONFIG_NO_THREADS
+	Dee_shared_lock_t  jr_lock;   /* Lock for `jr_stream' */
+#endif /* !CONFIG_NO_THREADS */
+	struct json_stream jr_stream; /* [lock(jr_lock)] Underlying stream */
+} DeeJsonReaderObject;
+
+#define DeeJsonReader_LockAcquire(self) Dee_shared_lock_acquire(&(self)->jr_lock)
+#define DeeJsonReader_LockRelease(self) Dee_shared_lock_release(&(self)->jr_lock)
+
+PRIVATE DEFINE_STRING(str_start_map, "start_map");
+PRIVATE DEFINE_STRING(str_end_map, "end_map");
+PRIVATE DEFINE_STRING(str_start_array, "start_array");
+PRIVATE DEFINE_STRING(str_end_array, "end_array");
+PRIVATE DEFINE_STRING(str_key, "key");
+PRIVATE DEFINE_STRING(str_value, "value");
+
+PRIVATE struct keyword reader_kwlist[] = { K(data), K(bufsize), KEND };
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+jreader_init_kw(DeeJsonReaderObject *__restrict self, size_t argc,
+                DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *data;
+	size_t bufsize = JSON_STREAM_DEFAULT_BUFSIZE;
+	if (DeeArg_UnpackKw(argc, argv, kw, reader_kwlist, "o|" UNPuSIZ ":Reader",
+	                    &data, &bufsize))
+		goto err;
+	if unlikely(json_stream_init(&self->jr_stream, data, bufsize))
+		goto err;
+	Dee_shared_lock_init(&self->jr_lock);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+jreader_fini(DeeJsonReaderObject *__restrict self) {
+	json_stream_fini(&self->jr_stream);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+jreader_visit(DeeJsonReaderObject *__restrict self, dvisit_t proc, void *arg) {
+	json_stream_visit(&self->jr_stream, proc, arg);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jreader_iter_self(DeeJsonReaderObject *__restrict self) {
+	return_reference_((DeeObject *)self);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jreader_next(DeeJsonReaderObject *__restrict self) {
+	DREF DeeObject *result;
+	DeeObject *event;
+	DREF DeeObject *value;
+	int tok;
+	if (DeeJsonReader_LockAcquire(self))
+		goto err;
+	tok = json_stream_advance(&self->jr_stream);
+	switch (tok) {
+
+	case JSON_STREAM_TOK_EOF:
+		DeeJsonReader_LockRelease(self);
+		return ITER_DONE;
+
+	case JSON_STREAM_TOK_END:
+		event = json_stream_leave(&self->jr_stream)
+		        ? (DeeObject *)&str_end_map
+		        : (DeeObject *)&str_end_array;
+		value = DeeNone_NewRef();
+		break;
+
+	case JSON_STREAM_TOK_KEY:
+		event = (DeeObject *)&str_key;
+		value = json_stream_takekey(&self->jr_stream);
+		break;
+
+	case JSON_STREAM_TOK_VALUE: {
+		int ch = json_stream_peekc(&self->jr_stream);
+		if (ch == '{' || ch == '[') {
+			if unlikely(json_stream_enter(&self->jr_stream))
+				goto err_unlock;
+			event = ch == '{' ? (DeeObject *)&str_start_map
+			                  : (DeeObject *)&str_start_array;
+			value = DeeNone_NewRef();
+		} else {
+			event = (DeeObject *)&str_value;
+			value = json_stream_read(&self->jr_stream);
+			if unlikely(!value)
+				goto err_unlock;
+		}
+	}	break;
+
+	default:
+		goto err_unlock;
+	}
+	DeeJsonReader_LockRelease(self);
+	result = DeeTuple_Pack(2, event, value);
+	Dee_Decref(value);
+	return result;
+err_unlock:
+	DeeJsonReader_LockRelease(self);
+err:
+	return NULL;
+}
+
+/* Advance to the next value, consuming the key of an object member.
+ * @return: 0 : Success (the next token is `JSON_STREAM_TOK_VALUE')
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+jreader_advance_value(DeeJsonReaderObject *__restrict self) {
+	int tok = json_stream_advance(&self->jr_stream);
+	if (tok == JSON_STREAM_TOK_KEY) {
+		Dee_Decref(json_stream_takekey(&self->jr_stream));
+		tok = JSON_STREAM_TOK_VALUE;
+	}
+	if likely(tok == JSON_STREAM_TOK_VALUE)
+		return 0;
+	if (tok == JSON_STREAM_TOK_EOF) {
+		err_json_unexpected_eof();
+	} else if (tok == JSON_STREAM_TOK_END) {
+		DeeError_Throwf(&DeeError_ValueError,
+		                "No value before the end of the current %s",
+		                (self->jr_stream.js_stackv[self->jr_stream.js_stackc - 1].jsf_flags &
+		                 JSON_STREAM_FRAME_FOBJECT)
+		                ? "object"
+		                : "array");
+	}
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jreader_read(DeeJsonReaderObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *result;
+	if (DeeArg_Unpack(argc, argv, ":read"))
+		goto err;
+	if (DeeJsonReader_LockAcquire(self))
+		goto err;
+	if unlikely(jreader_advance_value(self))
+		goto err_unlock;
+	result = json_stream_read(&self->jr_stream);
+	DeeJsonReader_LockRelease(self);
+	return result;
+err_unlock:
+	DeeJsonReader_LockRelease(self);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jreader_skip(DeeJsonReaderObject *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":skip"))
+		goto err;
+	if (DeeJsonReader_LockAcquire(self))
+		goto err;
+	if unlikely(jreader_advance_value(self))
+		goto err_unlock;
+	if unlikely(json_stream_skip(&self->jr_stream))
+		goto err_unlock;
+	DeeJsonReader_LockRelease(self);
+	return_none;
+err_unlock:
+	DeeJsonReader_LockRelease(self);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jreader_getdepth(DeeJsonReaderObject *__restrict self) {
+	return DeeInt_NewSize(atomic_read(&self->jr_stream.js_stackc));
+}
+
+PRIVATE struct type_method tpconst jreader_methods[] = {
+	TYPE_METHOD("read", &jreader_read,
+	            "->?X7?Dfloat?Dint?Dstring?Dbool?N?DList?DDict\n"
+	            "#tValueError{Syntax error, or there is no value before the end of "
+	            /*         */ "the current object or array, or the end of input}"
+	            "Read the next value in its entirety, consuming it. If the next event "
+	            /**/ "would be $\"key\", the key is consumed first (such that the member's "
+	            /**/ "value is read). Objects and arrays are returned as ?DDict and ?DList"),
+	TYPE_METHOD("skip", &jreader_skip,
+	            "()\n"
+	            "#tValueError{Syntax error, or there is no value before the end of "
+	            /*         */ "the current object or array, or the end of input}"
+	            "Same as ?#read, but discard the value without constructing any objects"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst jreader_getsets[] = {
+	TYPE_GETTER("depth", &jreader_getdepth,
+	            "->?Dint\n"
+	            "The number of objects and arrays that were entered, but not yet left"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_seq jreader_seq = {
+	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&jreader_iter_self
+};
+
+INTERN DeeTypeObject DeeJsonReader_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Reader",
+	/* .tp_doc      = */ DOC("Incremental (pull-style) JSON parser that reads its input in chunks, "
+	                         /**/ "such that memory usage does not depend on the size of the document, "
+	                         /**/ "but only on the size of its largest token and on its nesting depth\n"
+	                         "Any number of JSON values may follow each other in the input\n"
+	                         "\n"
+	                         "(data:?X3?DFile?DBytes?Dstring,bufsize=!65536)\n"
+	                         "Construct a new reader for @data. When @data is a ?DFile, it is read "
+	                         /**/ "in chunks of @bufsize bytes, and must be UTF-8 encoded\n"
+	                         "\n"
+	                         "next->?T2?Dstring?O\n"
+	                         "#tValueError{Syntax error}"
+	                         "Returns the next event as a pair $(event, value), where $event is one of "
+	                         /**/ "$\"start_map\", $\"key\", $\"end_map\", $\"start_array\", $\"end_array\" "
+	                         /**/ "or $\"value\". $value is the key for $\"key\", the (scalar) value for "
+	                         /**/ "$\"value\", and ?N otherwise"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeIterator_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeJsonReaderObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&jreader_init_kw
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&jreader_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&jreader_visit,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ &jreader_seq,
+	/* .tp_iter_next     = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&jreader_next,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ jreader_methods,
+	/* .tp_getsets       = */ jreader_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+
+
+/************************************************************************/
+/* json.select() / json.ndjson()                                        */
+/************************************************************************/
+
+/* Supported sub-set of JSONPath:
+ * >> $           Root (optional; implied when omitted)
+ * >> .name       Object member `name'
+ * >> ['name']    Object member `name' (also: ["name"])
+ * >> [N]         Array element `N'
+ * >> .* / [*]    Any member/element */
+struct json_path_step {
+#define JSON_PATH_STEP_ANY   0 /* Any member/element */
+#define JSON_PATH_STEP_KEY   1 /* Object member `jps_key' */
+#define JSON_PATH_STEP_INDEX 2 /* Array element `jps_index' */
+	unsigned int jps_kind;   /* One of `JSON_PATH_STEP_*' */
+	char const  *jps_key;    /* [valid_if(jps_kind == JSON_PATH_STEP_KEY)][0..jps_keylen]
+	                          * UTF-8 key (points into `js_path' of the owning selection) */
+	size_t       jps_keylen; /* [valid_if(jps_kind == JSON_PATH_STEP_KEY)] Length of `jps_key' */
+	size_t       jps_index;  /* [valid_if(jps_kind == JSON_PATH_STEP_INDEX)] Array index */
+};
+
+typedef struct {
+	OBJECT_HEAD
+#ifndef CONFIG_NO_THREADS
+	Dee_shared_lock_t                        js_lock;   /* Lock for `js_stream' */
+#endif /* !CONFIG_NO_THREADS */
+	struct json_stream                       js_stream; /* [lock(js_lock)] Underlying stream */
+	DREF DeeObject                          *js_path;   /* [1..1][const] Path string (buffer for `jps_key') */
+	size_t                                   js_stepc;  /* [const] # of path steps */
+	COMPILER_FLEXIBLE_ARRAY(struct json_path_step, js_stepv); /* [const][js_stepc] Path steps */
+} DeeJsonSelectionObject;
+
+#define DeeJsonSelection_LockAcquire(self) Dee_shared_lock_acquire(&(self)->js_lock)
+#define DeeJsonSelection_LockRelease(self) Dee_shared_lock_release(&(self)->js_lock)
+
+PRIVATE ATTR_COLD NONNULL((1)) int DCALL
+err_json_invalid_path(DeeObject *__restrict path) {
+	return DeeError_Throwf(&DeeError_ValueError, "Invalid JSON path: %r", path);
+}
+
+/* Parse `path' into `stepv' (which must be able to hold at least
+ * one step per character in `path', which is more than enough).
+ * @return: * : The number of steps
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) size_t DCALL
+json_path_compile(DeeObject *__restrict path,
+                  struct json_path_step *__restrict stepv) {
+	size_t stepc = 0;
+	char const *iter, *end;
+	iter = DeeString_AsUtf8(path);
+	if unlikely(!iter)
+		goto err;
+	end = iter + WSTR_LENGTH(iter);
+	if (iter < end && *iter == '$')
+		++iter;
+	while (iter < end) {
+		struct json_path_step *step = &stepv[stepc];
+		char ch = *iter++;
+		if (ch == '.') {
+			char const *name = iter;
+			if (iter < end && *iter == '*') {
+				++iter;
+				step->jps_kind = JSON_PATH_STEP_ANY;
+			} else {
+				while (iter < end && *iter != '.' && *iter != '[')
+					++iter;
+				if (iter == name)
+					goto err_path;
+				step->jps_kind   = JSON_PATH_STEP_KEY;
+				step->jps_key    = name;
+				step->jps_keylen = (size_t)(iter - name);
+			}
+		} else if (ch == '[') {
+			if (iter >= end)
+				goto err_path;
+			ch = *iter;
+			if (ch == '*') {
+				++iter;
+				step->jps_kind = JSON_PATH_STEP_ANY;
+			} else if (ch == '\'' || ch == '\"') {
+				char const *name = ++iter;
+				while (iter < end && *iter != ch)
+					++iter;
+				if (iter >= end)
+					goto err_path;
+				step->jps_kind   = JSON_PATH_STEP_KEY;
+				step->jps_key    = name;
+				step->jps_keylen = (size_t)(iter - name);
+				++iter;
+			} else if (ch >= '0' && ch <= '9') {
+				size_t index = 0;
+				do {
+					size_t new_index = index * 10 + (size_t)(*iter - '0');
+					if unlikely(new_index < index)
+						goto err_path;
+					index = new_index;
+					++iter;
+				} while (iter < end && *iter >= '0' && *iter <= '9');
+				step->jps_kind  = JSON_PATH_STEP_INDEX;
+				step->jps_index = index;
+			} else {
+				goto err_path;
+			}
+			if (iter >= end || *iter != ']')
+				goto err_path;
+			++iter;
+		} else {
+			goto err_path;
+		}
+		++stepc;
+	}
+	return stepc;
+err_path:
+	err_json_invalid_path(path);
+err:
+	return (size_t)-1;
+}
+
+/* Create a new selection for `path' in `data' */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeJsonSelectionObject *DCALL
+DeeJsonSelection_New(DeeObject *data, DeeObject *path, size_t bufsize) {
+	DREF DeeJsonSelectionObject *result;
+	size_t stepc;
+	result = (DREF DeeJsonSelectionObject *)DeeObject_Malloc(offsetof(DeeJsonSelectionObject, js_stepv) +
+	                                                         DeeString_WLEN(path) *
+	                                                         sizeof(struct json_path_step));
+	if unlikely(!result)
+		goto err;
+	stepc = json_path_compile(path, result->js_stepv);
+	if unlikely(stepc == (size_t)-1)
+		goto err_r;
+	if unlikely(json_stream_init(&result->js_stream, data, bufsize))
+		goto err_r;
+	Dee_shared_lock_init(&result->js_lock);
+	Dee_Incref(path);
+	result->js_path  = path;
+	result->js_stepc = stepc;
+	DeeObject_Init(result, &DeeJsonSelection_Type);
+	return result;
+err_r:
+	DeeObject_Free(result);
+err:
+	return NULL;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+jsel_fini(DeeJsonSelectionObject *__restrict self) {
+	json_stream_fini(&self->js_stream);
+	Dee_Decref(self->js_path);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+jsel_visit(DeeJsonSelectionObject *__restrict self, dvisit_t proc, void *arg) {
+	json_stream_visit(&self->js_stream, proc, arg);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jsel_iter_self(DeeJsonSelectionObject *__restrict self) {
+	return_reference_((DeeObject *)self);
+}
+
+/* Check if the object member `key' matches `step' */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_path_step_matchkey(struct json_path_step const *__restrict step,
+                        DeeObject *__restrict key) {
+	char const *utf8;
+	if (step->jps_kind != JSON_PATH_STEP_KEY)
+		return step->jps_kind == JSON_PATH_STEP_ANY ? 1 : 0;
+	utf8 = DeeString_AsUtf8(key);
+	if unlikely(!utf8)
+		return -1;
+	return WSTR_LENGTH(utf8) == step->jps_keylen &&
+	       memcmp(utf8, step->jps_key, step->jps_keylen * sizeof(char)) == 0;
+}
+
+/* Check if the array element `index' matches `step' */
+#define json_path_step_matchindex(step, index)     \
+	((step)->jps_kind == JSON_PATH_STEP_ANY ||     \
+	 ((step)->jps_kind == JSON_PATH_STEP_INDEX && \
+	  (step)->jps_index == (index)))
+
+/* Walk the stream until the next value that matches the selection's path.
+ * Objects and arrays are only entered while they lie along the path, and
+ * everything else is skipped without constructing any objects. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jsel_next_locked(DeeJsonSelectionObject *__restrict self) {
+	struct json_stream *stream = &self->js_stream;
+	for (;;) {
+		size_t depth = stream->js_stackc;
+		int tok = json_stream_advance(stream);
+		switch (tok) {
+
+		case JSON_STREAM_TOK_EOF:
+			return ITER_DONE;
+
+		case JSON_STREAM_TOK_END:
+			json_stream_leave(stream);
+			continue;
+
+		case JSON_STREAM_TOK_KEY: {
+			int match;
+			DREF DeeObject *key;
+			ASSERT(depth >= 1 && depth <= self->js_stepc);
+			key   = json_stream_takekey(stream);
+			match = json_path_step_matchkey(&self->js_stepv[depth - 1], key);
+			Dee_Decref(key);
+			if unlikely(match < 0)
+				goto err;
+			if (!match)
+				goto skip_value;
+		}	break;
+
+		case JSON_STREAM_TOK_VALUE:
+			if (depth != 0) {
+				ASSERT(depth <= self->js_stepc);
+				if (!json_path_step_matchindex(&self->js_stepv[depth - 1],
+				                               stream->js_index))
+					goto skip_value;
+			}
+			break;
+
+		default:
+			goto err;
+		}
+
+		/* The next value lies along the path. */
+		if (depth == self->js_stepc)
+			return json_stream_read(stream);
+		tok = json_stream_enter(stream);
+		if (tok == 0)
+			continue;
+		if unlikely(tok < 0)
+			goto err;
+		/* Value cannot be descended into -> skip it. */
+skip_value:
+		if unlikely(json_stream_skip(stream))
+			goto err;
+	}
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+jsel_next(DeeJsonSelectionObject *__restrict self) {
+	DREF DeeObject *result;
+	if (DeeJsonSelection_LockAcquire(self))
+		goto err;
+	result = jsel_next_locked(self);
+	DeeJsonSelection_LockRelease(self);
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE struct type_member tpconst jsel_members[] = {
+	TYPE_MEMBER_FIELD_DOC("path", STRUCT_OBJECT, offsetof(DeeJsonSelectionObject, js_path), "->?Dstring"),
+	TYPE_MEMBER_END
+};
+
+PRIVATE struct type_seq jsel_seq = {
+	/* .tp_iter_self = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&jsel_iter_self
+};
+
+INTERN DeeTypeObject DeeJsonSelection_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "_JsonSelection",
+	/* .tp_doc      = */ NULL,
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL | TP_FVARIABLE,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeIterator_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_var = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				/* .tp_free      = */ (dfunptr_t)NULL
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&jsel_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&jsel_visit,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ &jsel_seq,
+	/* .tp_iter_next     = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&jsel_next,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ NULL,
+	/* .tp_getsets       = */ NULL,
+	/* .tp_members       = */ jsel_members,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+PRIVATE struct keyword select_kwlist[] = { K(data), K(path), K(bufsize), KEND };
+PRIVATE WUNUSED DREF DeeObject *DCALL
+f_libjson_select(size_t argc, DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *data, *path;
+	size_t bufsize = JSON_STREAM_DEFAULT_BUFSIZE;
+	if (DeeArg_UnpackKw(argc, argv, kw, select_kwlist, "oo|" UNPuSIZ ":select",
+	                    &data, &path, &bufsize))
+		goto err;
+	if (DeeObject_AssertTypeExact(path, &DeeString_Type))
+		goto err;
+	return (DREF DeeObject *)DeeJsonSelection_New(data, path, bufsize);
+err:
+	return NULL;
+}
+
+PRIVATE struct keyword ndjson_kwlist[] = { K(data), K(bufsize), KEND };
+PRIVATE WUNUSED DREF DeeObject *DCALL
+f_libjson_ndjson(size_t argc, DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *data;
+	size_t bufsize = JSON_STREAM_DEFAULT_BUFSIZE;
+	if (DeeArg_UnpackKw(argc, argv, kw, ndjson_kwlist, "o|" UNPuSIZ ":ndjson",
+	                    &data, &bufsize))
+		goto err;
+	return (DREF DeeObject *)DeeJsonSelection_New(data, Dee_EmptyString, bufsize);
+err:
+	return NULL;
+}
+
+PRIVATE DEFINE_KWCMETHOD(libjson_select, &f_libjson_select);
+PRIVATE DEFINE_KWCMETHOD(libjson_ndjson, &f_libjson_ndjson);
+
+DECL_END
+
+#endif /* !GUARD_DEX_JSON_STREAM_C_INL */
@@ -0,0 +1,418 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_JSON_WRITER_C_INL
+#define GUARD_DEX_JSON_WRITER_C_INL 1
+#ifdef __INTELLISENSE__
+#include "libjson.c"
+#endif /* __INTELLISENSE__ */
+
+#include "simd.h"
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/class.h>
+#include <deemon/file.h>
+#include <deemon/object.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* memcpy(), bzero() */
+#include <deemon/util/atomic.h>
+#include <deemon/util/lock.h>
+
+DECL_BEGIN
+
+/* Fast paths used by `json.write()':
+ * - Strings that don't need any escaping are written as-is
+ * - Instances of user-defined classes are written using a list of fields
+ *   that is computed once per class (rather than enumerating attributes
+ *   and looking each one up by name for every instance)
+ * - Output written to a `File' is buffered, such that the underlying
+ *   file only sees a couple of large writes, rather than one write for
+ *   every token. */
+
+
+/************************************************************************/
+/* Buffered File output                                                 */
+/************************************************************************/
+#define JSON_WRITER_DEFAULT_BUFSIZE (8 * 1024)
+
+struct json_fileprinter {
+	DeeObject *jfp_file; /* [1..1] The file to which data is written */
+	char      *jfp_buf;  /* [0..jfp_size][owned] Output buffer */
+	size_t     jfp_size; /* Size of `jfp_buf' */
+	size_t     jfp_used; /* # of bytes currently in `jfp_buf' */
+};
+
+/* @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_fileprinter_init(struct json_fileprinter *__restrict self,
+                      DeeObject *__restrict file, size_t bufsize) {
+	if (bufsize < 16)
+		bufsize = 16;
+	self->jfp_buf = (char *)Dee_Malloc(bufsize);
+	if unlikely(!self->jfp_buf)
+		goto err;
+	self->jfp_file = file;
+	self->jfp_size = bufsize;
+	self->jfp_used = 0;
+	return 0;
+err:
+	return -1;
+}
+
+#define json_fileprinter_fini(self) Dee_Free((self)->jfp_buf)
+
+/* Write all buffered data to the underlying file.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+json_fileprinter_flush(struct json_fileprinter *__restrict self) {
+	if (self->jfp_used) {
+		if unlikely(DeeFile_WriteAll(self->jfp_file, self->jfp_buf, self->jfp_used) == (size_t)-1)
+			goto err;
+		self->jfp_used = 0;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) dssize_t DCALL
+json_fileprinter_print(void *arg, char const *__restrict data, size_t datalen) {
+	struct json_fileprinter *me = (struct json_fileprinter *)arg;
+	if likely(datalen <= me->jfp_size - me->jfp_used) {
+		memcpy(me->jfp_buf + me->jfp_used, data, datalen);
+		me->jfp_used += datalen;
+		return (dssize_t)datalen;
+	}
+	if unlikely(json_fileprinter_flush(me))
+		goto err;
+	if (datalen >= me->jfp_size)
+		return (dssize_t)DeeFile_WriteAll(me->jfp_file, data, datalen);
+	memcpy(me->jfp_buf, data, datalen);
+	me->jfp_used = datalen;
+	return (dssize_t)datalen;
+err:
+	return -1;
+}
+
+
+
+/************************************************************************/
+/* Strings                                                              */
+/************************************************************************/
+
+/* Write `str' as a JSON string, but only if none of its characters need
+ * to be escaped (which is checked 16 characters at a time when SSE2 is
+ * available). Such strings are written as-is, and without first having
+ * to be converted to UTF-8.
+ * @return: 1 : `str' needs escaping (nothing was written)
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_writer_putplainstring(DeeJsonWriter *__restrict self,
+                           DeeObject *__restrict str) {
+	unsigned char const *start, *end;
+	if (DeeString_WIDTH(str) != STRING_WIDTH_1BYTE)
+		goto nope;
+	start = (unsigned char const *)DeeString_STR(str);
+	end   = start + DeeString_SIZE(str);
+	if (json_findescape(start, end) != end)
+		goto nope;
+	if unlikely(libjson_writer_putvalue(&self->djw_writer))
+		goto err;
+	if unlikely(json_print(&self->djw_writer, "\"", 1))
+		goto err;
+	if unlikely(json_print(&self->djw_writer, (char const *)start, (size_t)(end - start)))
+		goto err;
+	if unlikely(json_print(&self->djw_writer, "\"", 1))
+		goto err;
+	return 0;
+err:
+	return -1;
+nope:
+	return 1;
+}
+
+
+
+/************************************************************************/
+/* Compiled writers for user-defined classes                            */
+/************************************************************************/
+
+struct json_classfield {
+	struct class_desc *jcf_desc;    /* [1..1] Class that declares the field */
+	char const        *jcf_name;    /* [1..jcf_namelen] UTF-8 name of the field */
+	size_t             jcf_namelen; /* Length of `jcf_name' (in bytes) */
+	uint16_t           jcf_addr;    /* Address of the field in the instance (or class) member table */
+	uint16_t           jcf_flag;    /* Set of `CLASS_ATTRIBUTE_FCLASSMEM' */
+};
+
+#define JSON_CLASSWRITER_GENERIC ((size_t)-1)
+struct json_classwriter {
+	Dee_refcnt_t       jcw_refcnt; /* Reference counter */
+	struct Dee_weakref jcw_type;   /* [0..1] The class for which this writer was compiled.
+	                                * Pointers in `jcw_fieldv' are only valid while this is bound. */
+	size_t             jcw_fieldc; /* # of fields, or `JSON_CLASSWRITER_GENERIC' if instances
+	                                * must be written by enumerating their attributes. */
+	COMPILER_FLEXIBLE_ARRAY(struct json_classfield, jcw_fieldv); /* [jcw_fieldc] Fields (in the same
+	                                                              * order as `DeeObject_EnumAttr()') */
+};
+
+#define json_classwriter_incref(self) atomic_inc(&(self)->jcw_refcnt)
+#define json_classwriter_decref(self)                   \
+	(void)(atomic_decfetch(&(self)->jcw_refcnt) != 0 || \
+	       (json_classwriter_destroy(self), 0))
+
+PRIVATE NONNULL((1)) void DCALL
+json_classwriter_destroy(struct json_classwriter *__restrict self) {
+	Dee_weakref_fini(&self->jcw_type);
+	Dee_Free(self);
+}
+
+/* Cache of compiled class writers (indexed by `Dee_HashPointer(type)') */
+#define JSON_CLASSWRITER_CACHESIZE 64
+PRIVATE struct json_classwriter *json_classwriter_cache[JSON_CLASSWRITER_CACHESIZE];
+#ifndef CONFIG_NO_THREADS
+PRIVATE Dee_atomic_rwlock_t json_classwriter_cache_lock = DEE_ATOMIC_RWLOCK_INIT;
+#endif /* !CONFIG_NO_THREADS */
+#define json_classwriter_cache_lock_reading()    Dee_atomic_rwlock_reading(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_writing()    Dee_atomic_rwlock_writing(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_tryread()    Dee_atomic_rwlock_tryread(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_trywrite()   Dee_atomic_rwlock_trywrite(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_canread()    Dee_atomic_rwlock_canread(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_canwrite()   Dee_atomic_rwlock_canwrite(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_waitread()   Dee_atomic_rwlock_waitread(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_waitwrite()  Dee_atomic_rwlock_waitwrite(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_read()       Dee_atomic_rwlock_read(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_write()      Dee_atomic_rwlock_write(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_tryupgrade() Dee_atomic_rwlock_tryupgrade(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_upgrade()    Dee_atomic_rwlock_upgrade(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_downgrade()  Dee_atomic_rwlock_downgrade(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_endwrite()   Dee_atomic_rwlock_endwrite(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_endread()    Dee_atomic_rwlock_endread(&json_classwriter_cache_lock)
+#define json_classwriter_cache_lock_end()        Dee_atomic_rwlock_end(&json_classwriter_cache_lock)
+
+/* Clear the cache of compiled class writers.
+ * @return: true:  At least one writer was freed
+ * @return: false: The cache was already empty */
+PRIVATE bool DCALL json_classwriter_cache_clear(void) {
+	size_t i;
+	bool result = false;
+	struct json_classwriter *old_cache[JSON_CLASSWRITER_CACHESIZE];
+	json_classwriter_cache_lock_write();
+	memcpy(old_cache, json_classwriter_cache, sizeof(old_cache));
+	bzero(json_classwriter_cache, sizeof(json_classwriter_cache));
+	json_classwriter_cache_lock_endwrite();
+	for (i = 0; i < JSON_CLASSWRITER_CACHESIZE; ++i) {
+		if (old_cache[i]) {
+			json_classwriter_decref(old_cache[i]);
+			result = true;
+		}
+	}
+	return result;
+}
+
+/* Check if a class attribute is written by `json_foreach_write_attribute()':
+ * it must be public, and neither a property nor a method. */
+#define json_classwriter_isfield(attr)                                         \
+	((attr)->ca_name != NULL &&                                                \
+	 !((attr)->ca_flag & (CLASS_ATTRIBUTE_FPRIVATE | CLASS_ATTRIBUTE_FGETSET | \
+	                      CLASS_ATTRIBUTE_FMETHOD)))
+
+/* Compile the writer for instances of `type' by walking its MRO the same way
+ * that `DeeObject_EnumAttr()' does. If any type in the MRO defines custom
+ * attribute operators, or C-level members (other than `Object' itself), the
+ * returned writer is marked as `JSON_CLASSWRITER_GENERIC'.
+ * @return: * :   The compiled writer (with `jcw_refcnt == 1' and `jcw_type' unbound)
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) struct json_classwriter *DCALL
+json_classwriter_compile(DeeTypeObject *__restrict type) {
+	struct json_classwriter *result;
+	struct json_classfield *field;
+	DeeTypeObject *iter;
+	DeeTypeMRO mro;
+	size_t i, count = 0;
+	iter = DeeTypeMRO_Init(&mro, type);
+	do {
+		if (iter->tp_attr != NULL)
+			goto generic;
+		if (DeeType_IsClass(iter)) {
+			DeeClassDescriptorObject *desc = DeeClass_DESC(iter)->cd_desc;
+			for (i = 0; i <= desc->cd_iattr_mask; ++i) {
+				if (json_classwriter_isfield(&desc->cd_iattr_list[i]))
+					++count;
+			}
+		} else if (iter != &DeeObject_Type && iter != &DeeType_Type) {
+			if (iter->tp_members != NULL)
+				goto generic;
+		}
+	} while ((iter = DeeTypeMRO_Next(&mro, iter)) != NULL);
+
+	/* Allocate the writer and fill in fields. */
+	result = (struct json_classwriter *)Dee_Malloc(offsetof(struct json_classwriter, jcw_fieldv) +
+	                                               count * sizeof(struct json_classfield));
+	if unlikely(!result)
+		goto err;
+	result->jcw_refcnt = 1;
+	result->jcw_fieldc = count;
+	Dee_weakref_null(&result->jcw_type);
+	field = result->jcw_fieldv;
+	iter  = DeeTypeMRO_Init(&mro, type);
+	do {
+		struct class_desc *my_class;
+		DeeClassDescriptorObject *desc;
+		if (!DeeType_IsClass(iter))
+			continue;
+		my_class = DeeClass_DESC(iter);
+		desc     = my_class->cd_desc;
+		for (i = 0; i <= desc->cd_iattr_mask; ++i) {
+			struct class_attribute *attr = &desc->cd_iattr_list[i];
+			char const *name;
+			if (!json_classwriter_isfield(attr))
+				continue;
+			name = DeeString_AsUtf8((DeeObject *)attr->ca_name);
+			if unlikely(!name)
+				goto err_r;
+			field->jcf_desc    = my_class;
+			field->jcf_name    = name;
+			field->jcf_namelen = WSTR_LENGTH(name);
+			field->jcf_addr    = attr->ca_addr;
+			field->jcf_flag    = attr->ca_flag & CLASS_ATTRIBUTE_FCLASSMEM;
+			++field;
+		}
+	} while ((iter = DeeTypeMRO_Next(&mro, iter)) != NULL);
+	ASSERT(field == result->jcw_fieldv + count);
+	return result;
+generic:
+	result = (struct json_classwriter *)Dee_Malloc(offsetof(struct json_classwriter, jcw_fieldv));
+	if unlikely(!result)
+		goto err;
+	result->jcw_refcnt = 1;
+	result->jcw_fieldc = JSON_CLASSWRITER_GENERIC;
+	Dee_weakref_null(&result->jcw_type);
+	return result;
+err_r:
+	Dee_Free(result);
+err:
+	return NULL;
+}
+
+/* Return a reference to the (possibly cached) writer for instances of `type'
+ * @return: * :   The writer (must be released using `json_classwriter_decref()')
+ * @return: NULL: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) struct json_classwriter *DCALL
+json_classwriter_get(DeeTypeObject *__restrict type) {
+	struct json_classwriter *result, *old_writer;
+	size_t slot = Dee_HashPointer(type) % JSON_CLASSWRITER_CACHESIZE;
+
+	/* Since the caller is holding an instance of `type', `type' can't
+	 * die while we compare it against the cached writer's weakref. And
+	 * since weakrefs are cleared when their object dies, there is no
+	 * chance of a false match if `type' re-uses a dead class' address. */
+	json_classwriter_cache_lock_read();
+	result = json_classwriter_cache[slot];
+	if (result && atomic_read(&result->jcw_type.wr_obj) == (DeeObject *)type) {
+		json_classwriter_incref(result);
+		json_classwriter_cache_lock_endread();
+		return result;
+	}
+	json_classwriter_cache_lock_endread();
+
+	/* Compile a new writer and (try to) cache it. */
+	result = json_classwriter_compile(type);
+	if unlikely(!result)
+		goto err;
+	if unlikely(!Dee_weakref_init(&result->jcw_type, (DeeObject *)type, NULL))
+		return result; /* Shouldn't happen (types can be weakly referenced) */
+	json_classwriter_incref(result); /* For `json_classwriter_cache' */
+	json_classwriter_cache_lock_write();
+	old_writer = json_classwriter_cache[slot];
+	json_classwriter_cache[slot] = result;
+	json_classwriter_cache_lock_endwrite();
+	if (old_writer)
+		json_classwriter_decref(old_writer);
+	return result;
+err:
+	return NULL;
+}
+
+/* Write the fields of `obj' (without the surrounding `{' and `}')
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
+json_classwriter_writefields(struct json_classwriter const *__restrict self,
+                             DeeJsonWriter *__restrict writer,
+                             DeeObject *__restrict obj) {
+	size_t i;
+	for (i = 0; i < self->jcw_fieldc; ++i) {
+		int error;
+		DREF DeeObject *value;
+		struct instance_desc *inst;
+		struct json_classfield const *field = &self->jcw_fieldv[i];
+		if (field->jcf_flag & CLASS_ATTRIBUTE_FCLASSMEM) {
+			inst = class_desc_as_instance(field->jcf_desc);
+		} else {
+			inst = DeeInstance_DESC(field->jcf_desc, obj);
+		}
+		Dee_instance_desc_lock_read(inst);
+		value = inst->id_vtab[field->jcf_addr];
+		Dee_XIncref(value);
+		Dee_instance_desc_lock_endread(inst);
+
+		/* Unbound fields simply aren't included in JSON blobs. */
+		if (!value)
+			continue;
+		error = libjson_writer_addfield(&writer->djw_writer, field->jcf_name, field->jcf_namelen);
+		if likely(error == 0)
+			error = DeeJson_WriteObject(writer, value);
+		Dee_Decref(value);
+		if unlikely(error)
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Write the fields of `obj' (an instance of a user-defined class)
+ * @return: 1 : Instances of `Dee_TYPE(obj)' must be written generically (nothing was written)
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+json_writer_putclassfields(DeeJsonWriter *__restrict self,
+                           DeeObject *__restrict obj) {
+	int result;
+	struct json_classwriter *writer;
+	writer = json_classwriter_get(Dee_TYPE(obj));
+	if unlikely(!writer)
+		goto err;
+	result = 1;
+	if (writer->jcw_fieldc != JSON_CLASSWRITER_GENERIC)
+		result = json_classwriter_writefields(writer, self, obj);
+	json_classwriter_decref(writer);
+	return result;
+err:
+	return -1;
+}
+
+DECL_END
+
+#endif /* !GUARD_DEX_JSON_WRITER_C_INL */
@@ -0,0 +1,2042 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_SOCKET_EVENTLOOP_C
+#define GUARD_DEX_SOCKET_EVENTLOOP_C 1
+#define DEE_SOURCE
+
+#include "libnet.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/error.h>
+#include <deemon/gc.h>
+#include <deemon/int.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/seq.h>
+#include <deemon/thread.h>
+#include <deemon/tuple.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/lock.h>
+
+DECL_BEGIN
+
+/* The event loop runs "tasks", which are iterators (usually those of yield
+ * functions). Every time a task is resumed, it runs until its next `yield',
+ * with the yielded value describing what the task is waiting for:
+ *   - none:                      Resume the task once other ready tasks had their turn
+ *   - `EventLoop.readable(fd)':  Resume the task once `fd' can be read from (or accepted)
+ *   - `EventLoop.writable(fd)':  Resume the task once `fd' can be written to (or has connected)
+ *   - `EventLoop.sleep(ns)':     Resume the task after `ns' nanoseconds have passed
+ *   - `EventLoop.Task':          Resume the task once the given task has finished
+ *   - `x' with `x.whendone(cb)': Resume the task once `x' invokes `cb' (e.g. `threading.Future')
+ * The last kind is how tasks wait for blocking calls offloaded to a thread pool
+ * (s.a. `EventLoop.submit()'); the pool's worker wakes the loop using a pipe.
+ * Readiness is level-triggered and may be spurious, meaning that a resumed task
+ * must use the non-blocking socket functions (`tryrecv()', `trysend()', ...) and
+ * simply wait again if those indicate that the operation would have blocked. */
+
+#ifdef CONFIG_HAVE_EPOLL
+#undef CONFIG_HAVE_POLL /* Not needed */
+#endif /* CONFIG_HAVE_EPOLL */
+
+/* Max time (in milliseconds) spent waiting for I/O before checking for interrupts. */
+#define EVENTLOOP_POLL_SLICE_MS 100
+
+/* Max # of events retrieved by a single call to `epoll_wait()' */
+#define EVENTLOOP_EPOLL_MAXEVENTS 256
+
+#ifdef CONFIG_HOST_WINDOWS
+#define ev_fdhash(fd) ((size_t)(fd) >> 2) /* SOCKET handles are multiples of 4 */
+#define ev_poll(v, c, timeout_ms) WSAPoll(v, (ULONG)(c), timeout_ms)
+#else /* CONFIG_HOST_WINDOWS */
+#define ev_fdhash(fd) ((size_t)(fd))
+#define ev_poll(v, c, timeout_ms) poll(v, (nfds_t)(c), timeout_ms)
+#endif /* !CONFIG_HOST_WINDOWS */
+
+
+/************************************************************************/
+/* EventLoop.Wait                                                       */
+/************************************************************************/
+
+#define EVWAIT_READ  0 /* Wait for `ew_fd' to become readable */
+#define EVWAIT_WRITE 1 /* Wait for `ew_fd' to become writable */
+#define EVWAIT_SLEEP 2 /* Wait for `ew_delay' microseconds to pass */
+
+typedef struct {
+	OBJECT_HEAD
+	unsigned int ew_kind;  /* [const] One of `EVWAIT_*' */
+	sock_t       ew_fd;    /* [const][valid_if(EVWAIT_READ || EVWAIT_WRITE)] The descriptor to wait for. */
+	uint64_t     ew_delay; /* [const][valid_if(EVWAIT_SLEEP)] Delay (in microseconds). */
+} DeeEventLoopWaitObject;
+
+INTDEF DeeTypeObject DeeEventLoopWait_Type;
+
+PRIVATE WUNUSED NONNULL((1)) dssize_t DCALL
+evwait_print(DeeEventLoopWaitObject *__restrict self,
+             dformatprinter printer, void *arg) {
+	switch (self->ew_kind) {
+	case EVWAIT_READ:
+		return DeeFormat_Printf(printer, arg, "<EventLoop.readable(%" PRFu64 ")>", (uint64_t)self->ew_fd);
+	case EVWAIT_WRITE:
+		return DeeFormat_Printf(printer, arg, "<EventLoop.writable(%" PRFu64 ")>", (uint64_t)self->ew_fd);
+	default: break;
+	}
+	return DeeFormat_Printf(printer, arg, "<EventLoop.sleep(%" PRFu64 ")>", self->ew_delay * 1000);
+}
+
+INTERN DeeTypeObject DeeEventLoopWait_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Wait",
+	/* .tp_doc      = */ DOC("A request to be resumed once an event has happened. Created by "
+	                         /**/ "?Areadable?GEventLoop, ?Awritable?GEventLoop or ?Asleep?GEventLoop "
+	                         /**/ "and yielded by tasks run by an ?GEventLoop\n"
+	                         "Wait requests are immutable and may be yielded any number of times"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeEventLoopWaitObject)
+			}
+		},
+		/* .tp_dtor        = */ NULL,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL,
+		/* .tp_print     = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&evwait_print,
+		/* .tp_printrepr = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ NULL,
+	/* .tp_getsets       = */ NULL,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+PRIVATE WUNUSED DREF DeeEventLoopWaitObject *DCALL
+evwait_new(unsigned int kind, sock_t fd, uint64_t delay) {
+	DREF DeeEventLoopWaitObject *result;
+	result = DeeObject_MALLOC(DeeEventLoopWaitObject);
+	if unlikely(!result)
+		goto done;
+	result->ew_kind  = kind;
+	result->ew_fd    = fd;
+	result->ew_delay = delay;
+	DeeObject_Init(result, &DeeEventLoopWait_Type);
+done:
+	return result;
+}
+
+
+
+
+/************************************************************************/
+/* EventLoop.Timer                                                      */
+/************************************************************************/
+
+typedef struct {
+	OBJECT_HEAD
+	Dee_atomic_lock_t    et_lock; /* Lock for the fields below */
+	DREF DeeObject      *et_func; /* [0..1][lock(et_lock)] The callback (NULL once fired or cancelled). */
+	DREF DeeTupleObject *et_args; /* [0..1][lock(et_lock)] Arguments for `et_func'. */
+} DeeEventLoopTimerObject;
+
+#define DeeEventLoopTimer_LockAcquire(self) Dee_atomic_lock_acquire(&(self)->et_lock)
+#define DeeEventLoopTimer_LockRelease(self) Dee_atomic_lock_release(&(self)->et_lock)
+
+INTDEF DeeTypeObject DeeEventLoopTimer_Type;
+
+PRIVATE NONNULL((1)) void DCALL
+evtimer_fini(DeeEventLoopTimerObject *__restrict self) {
+	Dee_XDecref(self->et_func);
+	Dee_XDecref(self->et_args);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+evtimer_visit(DeeEventLoopTimerObject *__restrict self, dvisit_t proc, void *arg) {
+	DeeEventLoopTimer_LockAcquire(self);
+	Dee_XVisit(self->et_func);
+	Dee_XVisit(self->et_args);
+	DeeEventLoopTimer_LockRelease(self);
+}
+
+/* Steal the timer's callback. Returns `false' if it had already fired or was cancelled. */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) bool DCALL
+evtimer_steal(DeeEventLoopTimerObject *__restrict self,
+              DREF DeeObject **__restrict p_func,
+              DREF DeeTupleObject **__restrict p_args) {
+	DeeEventLoopTimer_LockAcquire(self);
+	*p_func = self->et_func;
+	*p_args = self->et_args;
+	self->et_func = NULL;
+	self->et_args = NULL;
+	DeeEventLoopTimer_LockRelease(self);
+	return *p_func != NULL;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+evtimer_clear(DeeEventLoopTimerObject *__restrict self) {
+	DREF DeeObject *func;
+	DREF DeeTupleObject *args;
+	if (evtimer_steal(self, &func, &args)) {
+		Dee_Decref(func);
+		Dee_Decref(args);
+	}
+}
+
+PRIVATE struct type_gc tpconst evtimer_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&evtimer_clear
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evtimer_cancel(DeeEventLoopTimerObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *func;
+	DREF DeeTupleObject *args;
+	if (DeeArg_Unpack(argc, argv, ":cancel"))
+		goto err;
+	if (!evtimer_steal(self, &func, &args))
+		return_false;
+	Dee_Decref(func);
+	Dee_Decref(args);
+	return_true;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evtimer_pending_get(DeeEventLoopTimerObject *__restrict self) {
+	return_bool(atomic_read(&self->et_func) != NULL);
+}
+
+PRIVATE struct type_method tpconst evtimer_methods[] = {
+	TYPE_METHOD("cancel", &evtimer_cancel,
+	            "->?Dbool\n"
+	            "Cancel @this timer, returning ?f if it has already fired or was cancelled before"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst evtimer_getsets[] = {
+	TYPE_GETTER("pending", &evtimer_pending_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this timer has neither fired, nor been cancelled"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeEventLoopTimer_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Timer",
+	/* .tp_doc      = */ DOC("A callback scheduled using ?Acall_later?GEventLoop"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeEventLoopTimerObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&evtimer_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&evtimer_visit,
+	/* .tp_gc            = */ &evtimer_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ evtimer_methods,
+	/* .tp_getsets       = */ evtimer_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+
+
+/************************************************************************/
+/* EventLoop                                                            */
+/************************************************************************/
+
+typedef struct eventloop_object DeeEventLoopObject;
+typedef struct eventloop_task_object DeeEventLoopTaskObject;
+
+#if !defined(CONFIG_HOST_WINDOWS) && defined(CONFIG_HAVE_pipe) && \
+    (defined(CONFIG_HAVE_EPOLL) || defined(CONFIG_HAVE_POLL))
+/* Other threads wake the loop by writing to a pipe being polled alongside
+ * sockets. Elsewhere, the loop notices such events after at most
+ * `EVENTLOOP_POLL_SLICE_MS' milliseconds. */
+#define EVENTLOOP_HAVE_WAKEFD
+#endif /* ... */
+
+struct ev_timer {
+	uint64_t        t_when; /* Expiration time (s.a. `DeeThread_GetTimeMicroSeconds()') */
+	uint64_t        t_seq;  /* Sequence number (timers with identical `t_when' fire in FIFO order) */
+	DREF DeeObject *t_obj;  /* [1..1] A sleeping `DeeEventLoopTaskObject', or a `DeeEventLoopTimerObject' */
+};
+
+#define ev_timer_before(a, b) \
+	((a)->t_when < (b)->t_when || ((a)->t_when == (b)->t_when && (a)->t_seq < (b)->t_seq))
+
+struct ev_fdwait {
+	sock_t                       fw_fd; /* The descriptor being waited for. */
+	DREF DeeEventLoopTaskObject *fw_rd; /* [0..1] Task waiting for `fw_fd' to become readable. */
+	DREF DeeEventLoopTaskObject *fw_wr; /* [0..1] Task waiting for `fw_fd' to become writable. */
+#ifdef CONFIG_HAVE_EPOLL
+	uint32_t                     fw_ev; /* Events currently registered with epoll. */
+#endif /* CONFIG_HAVE_EPOLL */
+};
+#define ev_fdwait_isused(self) ((self)->fw_rd != NULL || (self)->fw_wr != NULL)
+
+struct eventloop_object {
+	OBJECT_HEAD
+	Dee_atomic_lock_t             el_lock;       /* Lock for the fields below */
+	size_t                        el_readyc;     /* [lock(el_lock)] # of tasks that are ready to run. */
+	size_t                        el_readya;     /* [lock(el_lock)] Allocated size of `el_readyv' */
+	DREF DeeEventLoopTaskObject **el_readyv;     /* [1..1][0..el_readyc][owned][lock(el_lock)] Tasks that are ready to run (in order). */
+	DREF DeeEventLoopTaskObject **el_sparev;     /* [0..el_sparea][owned][lock(el_lock)] Spare buffer for `el_readyv' */
+	size_t                        el_sparea;     /* [lock(el_lock)] Allocated size of `el_sparev' */
+	size_t                        el_timerc;     /* [lock(el_lock)] # of pending timers. */
+	size_t                        el_timera;     /* [lock(el_lock)] Allocated size of `el_timerv' */
+	struct ev_timer              *el_timerv;     /* [0..el_timerc][owned][lock(el_lock)] Min-heap of pending timers. */
+	uint64_t                      el_timerseq;   /* [lock(el_lock)] Next timer sequence number. */
+	size_t                        el_fdused;     /* [lock(el_lock)] # of used entries in `el_fdv' */
+	size_t                        el_fdmask;     /* [lock(el_lock)] Hash-mask of `el_fdv' */
+	struct ev_fdwait             *el_fdv;        /* [0..el_fdmask+1][owned][lock(el_lock)] Hash-table of I/O waits (linear probing). */
+	DREF DeeObject               *el_executor;   /* [0..1][lock(el_lock)] Executor for `submit()' (lazily allocated) */
+	size_t                        el_external;   /* [lock(ATOMIC)] # of tasks waiting for external objects (e.g. futures). */
+#ifdef CONFIG_HAVE_EPOLL
+	int                           el_epfd;       /* [const] The epoll descriptor. */
+#elif defined(CONFIG_HAVE_POLL)
+	struct pollfd                *el_pollv;      /* [0..el_polla][owned][lock(el_running)] Scratch buffer for `poll()' */
+	size_t                        el_polla;      /* [lock(el_running)] Allocated size of `el_pollv' */
+#endif /* ... */
+#ifdef EVENTLOOP_HAVE_WAKEFD
+	int                           el_wakefd[2];  /* [const] Wake-up pipe (read-end, write-end) */
+	bool                          el_wakeup;     /* [lock(ATOMIC)] Set when a wake-up is pending in `el_wakefd' */
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+	bool                          el_running;    /* [lock(ATOMIC)] Set while `run()' is executing. */
+	bool                          el_stop;       /* [lock(ATOMIC)] Set by `stop()' */
+};
+
+#define DeeEventLoop_LockAcquire(self) Dee_atomic_lock_acquire(&(self)->el_lock)
+#define DeeEventLoop_LockRelease(self) Dee_atomic_lock_release(&(self)->el_lock)
+
+INTDEF DeeTypeObject DeeEventLoop_Type;
+
+
+
+
+/************************************************************************/
+/* EventLoop.Task                                                       */
+/************************************************************************/
+
+struct eventloop_task_object {
+	OBJECT_HEAD
+	DREF DeeEventLoopObject      *t_loop;  /* [1..1][const] The event loop running this task. */
+	Dee_atomic_lock_t             t_lock;  /* Lock for the fields below */
+	DREF DeeObject               *t_iter;  /* [0..1][lock(t_lock)] The iterator being run (NULL once finished or cancelled). */
+	DREF DeeObject               *t_error; /* [0..1][lock(t_lock)] The error that terminated the task. */
+	size_t                        t_waitc; /* [lock(t_lock)] # of tasks waiting for this one to finish. */
+	size_t                        t_waita; /* [lock(t_lock)] Allocated size of `t_waitv' */
+	DREF DeeEventLoopTaskObject **t_waitv; /* [1..1][0..t_waitc][owned][lock(t_lock)] Tasks waiting for this one to finish. */
+};
+
+#define DeeEventLoopTask_LockAcquire(self) Dee_atomic_lock_acquire(&(self)->t_lock)
+#define DeeEventLoopTask_LockRelease(self) Dee_atomic_lock_release(&(self)->t_lock)
+
+INTDEF DeeTypeObject DeeEventLoopTask_Type;
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+eventloop_pushready(DeeEventLoopObject *__restrict self,
+                    DeeEventLoopTaskObject *__restrict task);
+PRIVATE NONNULL((1)) void DCALL
+eventloop_wake(DeeEventLoopObject *__restrict self);
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeEventLoopTaskObject *DCALL
+evtask_new(DeeEventLoopObject *__restrict loop, DeeObject *__restrict seq) {
+	DREF DeeEventLoopTaskObject *result;
+	result = DeeGCObject_MALLOC(DeeEventLoopTaskObject);
+	if unlikely(!result)
+		goto err;
+	result->t_iter = DeeObject_IterSelf(seq);
+	if unlikely(!result->t_iter)
+		goto err_r;
+	result->t_loop = loop;
+	Dee_Incref(loop);
+	Dee_atomic_lock_init(&result->t_lock);
+	result->t_error = NULL;
+	result->t_waitc = 0;
+	result->t_waita = 0;
+	result->t_waitv = NULL;
+	DeeObject_Init(result, &DeeEventLoopTask_Type);
+	return (DREF DeeEventLoopTaskObject *)DeeGC_Track((DeeObject *)result);
+err_r:
+	DeeGCObject_FREE(result);
+err:
+	return NULL;
+}
+
+/* Mark `self' as finished (with `error' as its error, if non-NULL),
+ * and schedule all tasks waiting for it to be resumed. */
+PRIVATE NONNULL((1)) void DCALL
+evtask_finish(DeeEventLoopTaskObject *__restrict self, DeeObject *error) {
+	size_t i, waitc;
+	DREF DeeObject *iter;
+	DREF DeeEventLoopTaskObject **waitv;
+	Dee_XIncref(error);
+	DeeEventLoopTask_LockAcquire(self);
+	iter  = self->t_iter;
+	waitc = self->t_waitc;
+	waitv = self->t_waitv;
+	self->t_iter  = NULL;
+	self->t_waitc = 0;
+	self->t_waita = 0;
+	self->t_waitv = NULL;
+	if (!self->t_error) {
+		self->t_error = error;
+		error = NULL;
+	}
+	DeeEventLoopTask_LockRelease(self);
+	Dee_XDecref(iter);
+	Dee_XDecref(error);
+	for (i = 0; i < waitc; ++i) {
+		DeeEventLoopTaskObject *waiter = waitv[i];
+		if unlikely(eventloop_pushready(waiter->t_loop, waiter))
+			DeeError_Handled(ERROR_HANDLED_RESTORE); /* Out of memory: discard the task */
+		if (waiter->t_loop != self->t_loop)
+			eventloop_wake(waiter->t_loop);
+		Dee_Decref(waiter);
+	}
+	Dee_Free(waitv);
+}
+
+/* Register `waiter' to be resumed once `self' has finished.
+ * @return: 1 : `self' has already finished
+ * @return: 0 : Success
+ * @return: -1: Error */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+evtask_addwaiter(DeeEventLoopTaskObject *__restrict self,
+                 DeeEventLoopTaskObject *__restrict waiter) {
+again:
+	DeeEventLoopTask_LockAcquire(self);
+	if (!self->t_iter) {
+		DeeEventLoopTask_LockRelease(self);
+		return 1;
+	}
+	if (self->t_waitc >= self->t_waita) {
+		DREF DeeEventLoopTaskObject **new_vector;
+		size_t new_alloc = self->t_waita * 2;
+		if (!new_alloc)
+			new_alloc = 4;
+		new_vector = (DREF DeeEventLoopTaskObject **)Dee_TryReallocc(self->t_waitv, new_alloc,
+		                                                            sizeof(DREF DeeEventLoopTaskObject *));
+		if unlikely(!new_vector) {
+			DeeEventLoopTask_LockRelease(self);
+			if (Dee_CollectMemory(new_alloc * sizeof(DREF DeeEventLoopTaskObject *)))
+				goto again;
+			return -1;
+		}
+		self->t_waitv = new_vector;
+		self->t_waita = new_alloc;
+	}
+	Dee_Incref(waiter);
+	self->t_waitv[self->t_waitc++] = waiter;
+	DeeEventLoopTask_LockRelease(self);
+	return 0;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+evtask_fini(DeeEventLoopTaskObject *__restrict self) {
+	Dee_Decref(self->t_loop);
+	Dee_XDecref(self->t_iter);
+	Dee_XDecref(self->t_error);
+	Dee_Decrefv(self->t_waitv, self->t_waitc);
+	Dee_Free(self->t_waitv);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+evtask_visit(DeeEventLoopTaskObject *__restrict self, dvisit_t proc, void *arg) {
+	Dee_Visit(self->t_loop);
+	DeeEventLoopTask_LockAcquire(self);
+	Dee_XVisit(self->t_iter);
+	Dee_XVisit(self->t_error);
+	Dee_Visitv(self->t_waitv, self->t_waitc);
+	DeeEventLoopTask_LockRelease(self);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+evtask_clear(DeeEventLoopTaskObject *__restrict self) {
+	size_t waitc;
+	DREF DeeObject *iter, *error;
+	DREF DeeEventLoopTaskObject **waitv;
+	DeeEventLoopTask_LockAcquire(self);
+	iter  = self->t_iter;
+	error = self->t_error;
+	waitc = self->t_waitc;
+	waitv = self->t_waitv;
+	self->t_iter  = NULL;
+	self->t_error = NULL;
+	self->t_waitc = 0;
+	self->t_waita = 0;
+	self->t_waitv = NULL;
+	DeeEventLoopTask_LockRelease(self);
+	Dee_XDecref(iter);
+	Dee_XDecref(error);
+	Dee_Decrefv(waitv, waitc);
+	Dee_Free(waitv);
+}
+
+PRIVATE struct type_gc tpconst evtask_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&evtask_clear
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evtask_cancel(DeeEventLoopTaskObject *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":cancel"))
+		goto err;
+	if (!atomic_read(&self->t_iter))
+		return_false;
+	evtask_finish(self, NULL);
+	return_true;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evtask_done_get(DeeEventLoopTaskObject *__restrict self) {
+	return_bool(atomic_read(&self->t_iter) == NULL);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evtask_error_get(DeeEventLoopTaskObject *__restrict self) {
+	DREF DeeObject *result;
+	DeeEventLoopTask_LockAcquire(self);
+	result = self->t_error;
+	if (!result)
+		result = Dee_None;
+	Dee_Incref(result);
+	DeeEventLoopTask_LockRelease(self);
+	return result;
+}
+
+PRIVATE struct type_method tpconst evtask_methods[] = {
+	TYPE_METHOD("cancel", &evtask_cancel,
+	            "->?Dbool\n"
+	            "Cancel @this task, returning ?f if it has already finished. The task is "
+	            /**/ "never resumed again, and tasks waiting for it are resumed"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst evtask_getsets[] = {
+	TYPE_GETTER("done", &evtask_done_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this task has finished, failed, or was cancelled"),
+	TYPE_GETTER("error", &evtask_error_get,
+	            "->?X2?O?N\n"
+	            "The error that terminated @this task, or ?N"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeEventLoopTask_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Task",
+	/* .tp_doc      = */ DOC("A task being run by an ?GEventLoop (s.a. ?Aspawn?GEventLoop)\n"
+	                         "Other tasks can yield @this task to be resumed once it has finished"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeEventLoopTaskObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&evtask_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&evtask_visit,
+	/* .tp_gc            = */ &evtask_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ evtask_methods,
+	/* .tp_getsets       = */ evtask_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+
+
+/************************************************************************/
+/* EventLoop (queues)                                                   */
+/************************************************************************/
+
+/* Wake up the thread executing `run()' (if it is waiting for I/O) */
+PRIVATE NONNULL((1)) void DCALL
+eventloop_wake(DeeEventLoopObject *__restrict self) {
+#ifdef EVENTLOOP_HAVE_WAKEFD
+	if (!atomic_xch(&self->el_wakeup, true)) {
+		char c = 0;
+		DBG_ALIGNMENT_DISABLE();
+		(void)write(self->el_wakefd[1], &c, 1);
+		DBG_ALIGNMENT_ENABLE();
+	}
+#else /* EVENTLOOP_HAVE_WAKEFD */
+	(void)self;
+#endif /* !EVENTLOOP_HAVE_WAKEFD */
+}
+
+#ifdef EVENTLOOP_HAVE_WAKEFD
+PRIVATE NONNULL((1)) void DCALL
+eventloop_drainwake(DeeEventLoopObject *__restrict self) {
+	char buf[64];
+	atomic_write(&self->el_wakeup, false);
+	DBG_ALIGNMENT_DISABLE();
+	while (read(self->el_wakefd[0], buf, sizeof(buf)) > 0)
+		;
+	DBG_ALIGNMENT_ENABLE();
+}
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+
+/* Append `task' to the ready-queue (on success, a reference is stored) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+eventloop_pushready(DeeEventLoopObject *__restrict self,
+                    DeeEventLoopTaskObject *__restrict task) {
+again:
+	DeeEventLoop_LockAcquire(self);
+	if (self->el_readyc >= self->el_readya) {
+		DREF DeeEventLoopTaskObject **new_vector;
+		size_t new_alloc = self->el_readya * 2;
+		if (!new_alloc)
+			new_alloc = 16;
+		new_vector = (DREF DeeEventLoopTaskObject **)Dee_TryReallocc(self->el_readyv, new_alloc,
+		                                                            sizeof(DREF DeeEventLoopTaskObject *));
+		if unlikely(!new_vector) {
+			DeeEventLoop_LockRelease(self);
+			if (Dee_CollectMemory(new_alloc * sizeof(DREF DeeEventLoopTaskObject *)))
+				goto again;
+			return -1;
+		}
+		self->el_readyv = new_vector;
+		self->el_readya = new_alloc;
+	}
+	Dee_Incref(task);
+	self->el_readyv[self->el_readyc++] = task;
+	DeeEventLoop_LockRelease(self);
+	return 0;
+}
+
+/* Schedule `obj' (a task or timer) to be resumed at `when' (on success, a reference is stored) */
+PRIVATE WUNUSED NONNULL((1, 3)) int DCALL
+eventloop_pushtimer(DeeEventLoopObject *__restrict self,
+                    uint64_t when, DeeObject *obj) {
+	size_t i;
+	struct ev_timer *heap;
+again:
+	DeeEventLoop_LockAcquire(self);
+	if (self->el_timerc >= self->el_timera) {
+		struct ev_timer *new_vector;
+		size_t new_alloc = self->el_timera * 2;
+		if (!new_alloc)
+			new_alloc = 16;
+		new_vector = (struct ev_timer *)Dee_TryReallocc(self->el_timerv, new_alloc,
+		                                                sizeof(struct ev_timer));
+		if unlikely(!new_vector) {
+			DeeEventLoop_LockRelease(self);
+			if (Dee_CollectMemory(new_alloc * sizeof(struct ev_timer)))
+				goto again;
+			return -1;
+		}
+		self->el_timerv = new_vector;
+		self->el_timera = new_alloc;
+	}
+	/* Sift the new timer up the heap. */
+	heap = self->el_timerv;
+	i    = self->el_timerc++;
+	while (i) {
+		size_t parent = (i - 1) / 2;
+		if (heap[parent].t_when <= when)
+			break; /* `parent' has a smaller sequence number, so it fires first. */
+		heap[i] = heap[parent];
+		i = parent;
+	}
+	Dee_Incref(obj);
+	heap[i].t_when = when;
+	heap[i].t_seq  = self->el_timerseq++;
+	heap[i].t_obj  = obj;
+	DeeEventLoop_LockRelease(self);
+	return 0;
+}
+
+/* Remove and return the first timer, if it has expired by `now' (else: return NULL) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_poptimer_locked(DeeEventLoopObject *__restrict self, uint64_t now) {
+	DREF DeeObject *result;
+	struct ev_timer *heap = self->el_timerv;
+	struct ev_timer last;
+	size_t i, count;
+	if (!self->el_timerc || heap[0].t_when > now)
+		return NULL;
+	result = heap[0].t_obj;
+	count  = --self->el_timerc;
+	if (count) {
+		/* Sift the last timer down from the root. */
+		last = heap[count];
+		i    = 0;
+		for (;;) {
+			size_t child = i * 2 + 1;
+			if (child >= count)
+				break;
+			if (child + 1 < count && ev_timer_before(&heap[child + 1], &heap[child]))
+				++child;
+			if (!ev_timer_before(&heap[child], &last))
+				break;
+			heap[i] = heap[child];
+			i = child;
+		}
+		heap[i] = last;
+	}
+	return result;
+}
+
+PRIVATE WUNUSED NONNULL((1)) struct ev_fdwait *DCALL
+eventloop_fdlookup_locked(DeeEventLoopObject *__restrict self, sock_t fd) {
+	size_t i;
+	if (!self->el_fdv)
+		return NULL;
+	for (i = ev_fdhash(fd) & self->el_fdmask;; i = (i + 1) & self->el_fdmask) {
+		struct ev_fdwait *ent = &self->el_fdv[i];
+		if (!ev_fdwait_isused(ent))
+			break;
+		if (ent->fw_fd == fd)
+			return ent;
+	}
+	return NULL;
+}
+
+/* Remove an entry that no longer has any waiters (backward-shift deletion) */
+PRIVATE NONNULL((1, 2)) void DCALL
+eventloop_fdremove_locked(DeeEventLoopObject *__restrict self,
+                          struct ev_fdwait *__restrict ent) {
+	size_t mask = self->el_fdmask;
+	size_t i    = (size_t)(ent - self->el_fdv);
+	size_t j    = i;
+	for (;;) {
+		size_t k;
+		j = (j + 1) & mask;
+		if (!ev_fdwait_isused(&self->el_fdv[j]))
+			break;
+		k = ev_fdhash(self->el_fdv[j].fw_fd) & mask;
+		/* Move `j' into the hole at `i', unless its home slot `k' lies in `(i, j]' */
+		if (i <= j ? (k <= i || k > j) : (k <= i && k > j)) {
+			self->el_fdv[i] = self->el_fdv[j];
+			i = j;
+		}
+	}
+	self->el_fdv[i].fw_rd = NULL;
+	self->el_fdv[i].fw_wr = NULL;
+	--self->el_fdused;
+}
+
+#ifdef CONFIG_HAVE_EPOLL
+/* Synchronize the epoll registration of `ent' with its waiters.
+ * @return: 0 : Success
+ * @return: * : Error (errno) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+eventloop_epollsync_locked(DeeEventLoopObject *__restrict self,
+                           struct ev_fdwait *__restrict ent) {
+	struct epoll_event ev;
+	int op, error;
+	ev.events   = (ent->fw_rd ? EPOLLIN : 0) | (ent->fw_wr ? EPOLLOUT : 0);
+	ev.data.u64 = 0;
+	ev.data.fd  = ent->fw_fd;
+	if (ev.events == ent->fw_ev)
+		return 0;
+	op = !ent->fw_ev ? EPOLL_CTL_ADD : !ev.events ? EPOLL_CTL_DEL : EPOLL_CTL_MOD;
+	DBG_ALIGNMENT_DISABLE();
+	error = epoll_ctl(self->el_epfd, op, ent->fw_fd, &ev);
+	if unlikely(error < 0) {
+		error = (int)GET_NET_ERROR();
+		if (op == EPOLL_CTL_DEL) {
+			/* Closing a descriptor automatically removes it from epoll. */
+			error = 0;
+		} else if (op == EPOLL_CTL_ADD && error == EEXIST) {
+			/* The descriptor is still registered because it has been re-used
+			 * after being closed while its old instance was being waited for. */
+			error = epoll_ctl(self->el_epfd, EPOLL_CTL_MOD, ent->fw_fd, &ev);
+			if (error < 0)
+				error = (int)GET_NET_ERROR();
+		} else if (op == EPOLL_CTL_MOD && error == ENOENT) {
+			/* The descriptor is no longer registered because it was closed
+			 * (which removed it from epoll), and then re-opened. */
+			error = epoll_ctl(self->el_epfd, EPOLL_CTL_ADD, ent->fw_fd, &ev);
+			if (error < 0)
+				error = (int)GET_NET_ERROR();
+		}
+	}
+	DBG_ALIGNMENT_ENABLE();
+	if likely(error == 0)
+		ent->fw_ev = ev.events;
+	return error;
+}
+#endif /* CONFIG_HAVE_EPOLL */
+
+/* Register `task' to be resumed once `fd' becomes readable/writable */
+PRIVATE WUNUSED NONNULL((1, 3)) int DCALL
+eventloop_addwait(DeeEventLoopObject *__restrict self, sock_t fd,
+                  DeeEventLoopTaskObject *__restrict task, bool write) {
+#if defined(CONFIG_HAVE_EPOLL) || defined(CONFIG_HAVE_POLL)
+	struct ev_fdwait *ent;
+	DREF DeeEventLoopTaskObject **p_slot;
+again:
+	DeeEventLoop_LockAcquire(self);
+	ent = eventloop_fdlookup_locked(self, fd);
+	if (!ent) {
+		size_t i;
+		/* Keep the load factor below 2/3 */
+		if (!self->el_fdv || (self->el_fdused + 1) * 3 > (self->el_fdmask + 1) * 2) {
+			struct ev_fdwait *new_vector;
+			size_t j, new_mask = self->el_fdv ? (self->el_fdmask * 2) + 1 : 63;
+			new_vector = (struct ev_fdwait *)Dee_TryCallocc(new_mask + 1, sizeof(struct ev_fdwait));
+			if unlikely(!new_vector) {
+				DeeEventLoop_LockRelease(self);
+				if (Dee_CollectMemory((new_mask + 1) * sizeof(struct ev_fdwait)))
+					goto again;
+				return -1;
+			}
+			if (self->el_fdv) {
+				for (j = 0; j <= self->el_fdmask; ++j) {
+					struct ev_fdwait *old = &self->el_fdv[j];
+					if (!ev_fdwait_isused(old))
+						continue;
+					for (i = ev_fdhash(old->fw_fd) & new_mask;
+					     ev_fdwait_isused(&new_vector[i]);
+					     i = (i + 1) & new_mask)
+						;
+					new_vector[i] = *old;
+				}
+				Dee_Free(self->el_fdv);
+			}
+			self->el_fdv    = new_vector;
+			self->el_fdmask = new_mask;
+		}
+		for (i = ev_fdhash(fd) & self->el_fdmask;
+		     ev_fdwait_isused(&self->el_fdv[i]);
+		     i = (i + 1) & self->el_fdmask)
+			;
+		ent = &self->el_fdv[i];
+		ent->fw_fd = fd;
+#ifdef CONFIG_HAVE_EPOLL
+		ent->fw_ev = 0;
+#endif /* CONFIG_HAVE_EPOLL */
+		++self->el_fdused;
+	}
+	p_slot = write ? &ent->fw_wr : &ent->fw_rd;
+	if unlikely(*p_slot) {
+		DeeEventLoop_LockRelease(self);
+		return DeeError_Throwf(&DeeError_ValueError,
+		                       "Another task is already waiting for descriptor %" PRFu64 " to become %s",
+		                       (uint64_t)fd, write ? "writable" : "readable");
+	}
+	Dee_Incref(task);
+	*p_slot = task;
+#ifdef CONFIG_HAVE_EPOLL
+	{
+		int error = eventloop_epollsync_locked(self, ent);
+		if unlikely(error != 0) {
+			*p_slot = NULL;
+			if (!ev_fdwait_isused(ent))
+				eventloop_fdremove_locked(self, ent);
+			DeeEventLoop_LockRelease(self);
+			Dee_DecrefNokill(task);
+			return DeeNet_ThrowErrorf(&DeeError_NetError, (neterrno_t)error,
+			                          "Failed to wait for descriptor %" PRFu64,
+			                          (uint64_t)fd);
+		}
+	}
+#endif /* CONFIG_HAVE_EPOLL */
+	DeeEventLoop_LockRelease(self);
+	return 0;
+#else /* CONFIG_HAVE_EPOLL || CONFIG_HAVE_POLL */
+	(void)self;
+	(void)fd;
+	(void)task;
+	(void)write;
+	return DeeError_Throwf(&DeeError_UnsupportedAPI,
+	                       "Waiting for I/O is not supported on this host");
+#endif /* !CONFIG_HAVE_EPOLL && !CONFIG_HAVE_POLL */
+}
+
+
+
+/************************************************************************/
+/* Resuming tasks waiting for external objects                          */
+/************************************************************************/
+
+/* The callback passed to `whendone()' of objects yielded by tasks */
+typedef struct {
+	OBJECT_HEAD
+	DREF DeeEventLoopTaskObject *r_task; /* [0..1][lock(ATOMIC)] The task to resume (NULL once resumed) */
+} DeeEventLoopResumeObject;
+
+INTDEF DeeTypeObject DeeEventLoopResume_Type;
+
+PRIVATE NONNULL((1)) void DCALL
+evresume_fini(DeeEventLoopResumeObject *__restrict self) {
+	Dee_XDecref(self->r_task);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+evresume_visit(DeeEventLoopResumeObject *__restrict self, dvisit_t proc, void *arg) {
+	Dee_XVisit(atomic_read(&self->r_task));
+}
+
+/* Take the task out of `self'. When it hadn't been taken, yet,
+ * the caller inherits the task's reference to its loop's `el_external' */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeEventLoopTaskObject *DCALL
+evresume_take(DeeEventLoopResumeObject *__restrict self) {
+	return atomic_xch(&self->r_task, NULL);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+evresume_clear(DeeEventLoopResumeObject *__restrict self) {
+	DREF DeeEventLoopTaskObject *task = evresume_take(self);
+	if (task) {
+		atomic_dec(&task->t_loop->el_external);
+		Dee_Decref(task);
+	}
+}
+
+PRIVATE struct type_gc tpconst evresume_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&evresume_clear
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+evresume_call(DeeEventLoopResumeObject *self, size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
+	int error;
+	DeeEventLoopObject *loop;
+	DREF DeeEventLoopTaskObject *task = evresume_take(self);
+	if (!task)
+		return_none; /* Already resumed */
+	loop  = task->t_loop;
+	error = eventloop_pushready(loop, task);
+	atomic_dec(&loop->el_external);
+	eventloop_wake(loop);
+	Dee_Decref(task);
+	if unlikely(error)
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+INTERN DeeTypeObject DeeEventLoopResume_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "_EventLoopResume",
+	/* .tp_doc      = */ DOC("(args!)\n"
+	                         "Resume the ?GTask waiting for the object this callback was passed to"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeEventLoopResumeObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&evresume_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ (DREF DeeObject *(DCALL *)(DeeObject *, size_t, DeeObject *const *))&evresume_call,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&evresume_visit,
+	/* .tp_gc            = */ &evresume_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ NULL,
+	/* .tp_getsets       = */ NULL,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+/* Suspend `task' until `obj.whendone(callback)' invokes its callback */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
+eventloop_awaitexternal(DeeEventLoopObject *__restrict self,
+                        DeeEventLoopTaskObject *__restrict task,
+                        DeeObject *__restrict obj) {
+	DREF DeeObject *status;
+	DREF DeeEventLoopResumeObject *resume;
+	int has = DeeObject_HasAttrString(obj, "whendone");
+	if unlikely(has <= 0) {
+		if (has == 0) {
+			DeeError_Throwf(&DeeError_TypeError,
+			                "Event loop task %k yielded %k, but expected none, a Task, an "
+			                "object with a `whendone()' function (e.g. a Future), or the "
+			                "return value of `readable()', `writable()' or `sleep()'",
+			                task, obj);
+		}
+		goto err;
+	}
+	resume = DeeGCObject_MALLOC(DeeEventLoopResumeObject);
+	if unlikely(!resume)
+		goto err;
+	resume->r_task = task;
+	Dee_Incref(task);
+	DeeObject_Init(resume, &DeeEventLoopResume_Type);
+	resume = (DREF DeeEventLoopResumeObject *)DeeGC_Track((DeeObject *)resume);
+	atomic_inc(&self->el_external);
+	status = DeeObject_CallAttrString(obj, "whendone", 1, (DeeObject *const *)&resume);
+	if unlikely(!status) {
+		evresume_clear(resume); /* No-op if the callback was already invoked. */
+		Dee_Decref(resume);
+		goto err;
+	}
+	Dee_Decref(status);
+	Dee_Decref(resume);
+	return 0;
+err:
+	return -1;
+}
+
+
+
+/************************************************************************/
+/* EventLoop (scheduling)                                               */
+/************************************************************************/
+
+/* Resume `task', and handle whatever it yields.
+ * @return: 0 : Success
+ * @return: -1: Error (either thrown by the task itself, or while handling its request) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+eventloop_step(DeeEventLoopObject *__restrict self,
+               /*inherit(always)*/ DREF DeeEventLoopTaskObject *task) {
+	int result;
+	DREF DeeObject *iter, *req;
+	DeeEventLoopTask_LockAcquire(task);
+	iter = task->t_iter;
+	Dee_XIncref(iter);
+	DeeEventLoopTask_LockRelease(task);
+	if unlikely(!iter) {
+		/* Cancelled */
+		Dee_Decref(task);
+		return 0;
+	}
+	req = DeeObject_IterNext(iter);
+	Dee_Decref(iter);
+	if (req == ITER_DONE) {
+		evtask_finish(task, NULL);
+		Dee_Decref(task);
+		return 0;
+	}
+	if unlikely(!req) {
+		evtask_finish(task, DeeError_Current());
+		goto err_task;
+	}
+	if (DeeNone_Check(req)) {
+		Dee_DecrefNokill(req);
+		result = eventloop_pushready(self, task);
+	} else if (Dee_TYPE(req) == &DeeEventLoopWait_Type) {
+		DeeEventLoopWaitObject *wait = (DeeEventLoopWaitObject *)req;
+		if (wait->ew_kind == EVWAIT_SLEEP) {
+			result = eventloop_pushtimer(self, DeeThread_GetTimeMicroSeconds() + wait->ew_delay,
+			                             (DeeObject *)task);
+		} else {
+			result = eventloop_addwait(self, wait->ew_fd, task, wait->ew_kind == EVWAIT_WRITE);
+		}
+		Dee_Decref(req);
+	} else if (Dee_TYPE(req) == &DeeEventLoopTask_Type) {
+		if unlikely(req == (DeeObject *)task) {
+			result = DeeError_Throwf(&DeeError_ValueError,
+			                         "Event loop task %k cannot wait for itself",
+			                         task);
+		} else {
+			result = evtask_addwaiter((DeeEventLoopTaskObject *)req, task);
+			if (result > 0)
+				result = eventloop_pushready(self, task); /* Already finished */
+		}
+		Dee_Decref(req);
+	} else {
+		result = eventloop_awaitexternal(self, task, req);
+		Dee_Decref(req);
+	}
+	if unlikely(result)
+		evtask_finish(task, DeeError_Current());
+	Dee_Decref(task);
+	return result;
+err_task:
+	Dee_Decref(task);
+	return -1;
+}
+
+/* Resume all tasks that are currently ready.
+ * Tasks that become ready in the mean time are run during the next pass. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_runready(DeeEventLoopObject *__restrict self) {
+	size_t i, count, alloc;
+	DREF DeeEventLoopTaskObject **vector;
+	DeeEventLoop_LockAcquire(self);
+	count  = self->el_readyc;
+	alloc  = self->el_readya;
+	vector = self->el_readyv;
+	self->el_readyc = 0;
+	self->el_readya = self->el_sparea;
+	self->el_readyv = self->el_sparev;
+	self->el_sparea = 0;
+	self->el_sparev = NULL;
+	DeeEventLoop_LockRelease(self);
+	for (i = 0; i < count; ++i) {
+		if unlikely(eventloop_step(self, vector[i])) {
+			/* Re-queue remaining tasks. */
+			for (++i; i < count; ++i) {
+				if unlikely(eventloop_pushready(self, vector[i]))
+					DeeError_Handled(ERROR_HANDLED_RESTORE); /* Out of memory: discard the task */
+				Dee_Decref(vector[i]);
+			}
+			Dee_Free(vector);
+			goto err;
+		}
+	}
+	/* Keep the buffer around for the next pass. */
+	DeeEventLoop_LockAcquire(self);
+	if (!self->el_sparev) {
+		self->el_sparev = vector;
+		self->el_sparea = alloc;
+		vector = NULL;
+	}
+	DeeEventLoop_LockRelease(self);
+	Dee_Free(vector);
+	return 0;
+err:
+	return -1;
+}
+
+/* Fire all timers that have expired by `now' */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_runtimers(DeeEventLoopObject *__restrict self, uint64_t now) {
+	for (;;) {
+		DREF DeeObject *obj;
+		DeeEventLoop_LockAcquire(self);
+		obj = eventloop_poptimer_locked(self, now);
+		DeeEventLoop_LockRelease(self);
+		if (!obj)
+			break;
+		if (Dee_TYPE(obj) == &DeeEventLoopTimer_Type) {
+			DREF DeeObject *func, *result;
+			DREF DeeTupleObject *args;
+			bool fire = evtimer_steal((DeeEventLoopTimerObject *)obj, &func, &args);
+			Dee_Decref(obj);
+			if (!fire)
+				continue; /* Cancelled */
+			result = DeeObject_CallTuple(func, (DeeObject *)args);
+			Dee_Decref(args);
+			Dee_Decref(func);
+			if unlikely(!result)
+				goto err;
+			Dee_Decref(result);
+		} else {
+			if unlikely(eventloop_step(self, (DREF DeeEventLoopTaskObject *)obj))
+				goto err;
+		}
+	}
+	return 0;
+err:
+	return -1;
+}
+
+/* Wake tasks waiting for `fd' (called after the backend reported events)
+ * @param: rd: When true, wake the task waiting for `fd' to become readable.
+ * @param: wr: When true, wake the task waiting for `fd' to become writable. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_wakefd(DeeEventLoopObject *__restrict self,
+                 sock_t fd, bool rd, bool wr) {
+	struct ev_fdwait *ent;
+	DREF DeeEventLoopTaskObject *rd_task = NULL;
+	DREF DeeEventLoopTaskObject *wr_task = NULL;
+	DeeEventLoop_LockAcquire(self);
+	ent = eventloop_fdlookup_locked(self, fd);
+	if likely(ent) {
+		if (rd) {
+			rd_task = ent->fw_rd;
+			ent->fw_rd = NULL;
+		}
+		if (wr) {
+			wr_task = ent->fw_wr;
+			ent->fw_wr = NULL;
+		}
+#ifdef CONFIG_HAVE_EPOLL
+		if unlikely(eventloop_epollsync_locked(self, ent) != 0) {
+			/* Failed to narrow the registration down to the remaining waiter.
+			 * Since epoll is level-triggered, leaving it as-is would have us
+			 * keep on receiving events that no-one is waiting for. So instead,
+			 * drop the registration entirely and (spuriously) wake the other
+			 * waiter, which will then re-register itself once it yields again. */
+			struct epoll_event ev;
+			ev.events   = 0;
+			ev.data.u64 = 0;
+			DBG_ALIGNMENT_DISABLE();
+			(void)epoll_ctl(self->el_epfd, EPOLL_CTL_DEL, ent->fw_fd, &ev);
+			DBG_ALIGNMENT_ENABLE();
+			ent->fw_ev = 0;
+			if (ent->fw_rd) {
+				rd_task    = ent->fw_rd;
+				ent->fw_rd = NULL;
+			}
+			if (ent->fw_wr) {
+				wr_task    = ent->fw_wr;
+				ent->fw_wr = NULL;
+			}
+		}
+#endif /* CONFIG_HAVE_EPOLL */
+		if (!ev_fdwait_isused(ent))
+			eventloop_fdremove_locked(self, ent);
+	}
+	DeeEventLoop_LockRelease(self);
+	if (rd_task && unlikely(eventloop_step(self, rd_task))) {
+		if (wr_task && unlikely(eventloop_pushready(self, wr_task)))
+			DeeError_Handled(ERROR_HANDLED_RESTORE); /* Out of memory: discard the task */
+		Dee_XDecref(wr_task);
+		goto err;
+	}
+	if (wr_task && unlikely(eventloop_step(self, wr_task)))
+		goto err;
+	return 0;
+err:
+	return -1;
+}
+
+/* Wait for I/O for at most `timeout_ms' milliseconds, and resume tasks whose descriptors are ready. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_poll(DeeEventLoopObject *__restrict self, int timeout_ms) {
+#ifdef CONFIG_HAVE_EPOLL
+	int i, count;
+	struct epoll_event events[EVENTLOOP_EPOLL_MAXEVENTS];
+	DBG_ALIGNMENT_DISABLE();
+	count = epoll_wait(self->el_epfd, events, EVENTLOOP_EPOLL_MAXEVENTS, timeout_ms);
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(count < 0) {
+		int error = (int)GET_NET_ERROR();
+		if (error == EINTR)
+			return 0;
+		return DeeNet_ThrowErrorf(&DeeError_NetError, (neterrno_t)error,
+		                          "Failed to wait for I/O events");
+	}
+	for (i = 0; i < count; ++i) {
+		uint32_t ev = events[i].events;
+#ifdef EVENTLOOP_HAVE_WAKEFD
+		if (events[i].data.fd == self->el_wakefd[0]) {
+			eventloop_drainwake(self);
+			continue;
+		}
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+		if unlikely(eventloop_wakefd(self, (sock_t)events[i].data.fd,
+		                             (ev & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0,
+		                             (ev & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0))
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+#elif defined(CONFIG_HAVE_POLL)
+	size_t i, count;
+	int error;
+#ifndef EVENTLOOP_HAVE_WAKEFD
+	if (!self->el_fdused)
+		goto do_sleep;
+#endif /* !EVENTLOOP_HAVE_WAKEFD */
+again:
+	DeeEventLoop_LockAcquire(self);
+	count = self->el_fdused + 1;
+	if (count > self->el_polla) {
+		struct pollfd *new_vector;
+		new_vector = (struct pollfd *)Dee_TryReallocc(self->el_pollv, count, sizeof(struct pollfd));
+		if unlikely(!new_vector) {
+			DeeEventLoop_LockRelease(self);
+			if (Dee_CollectMemory(count * sizeof(struct pollfd)))
+				goto again;
+			goto err;
+		}
+		self->el_pollv = new_vector;
+		self->el_polla = count;
+	}
+	count = 0;
+	if (self->el_fdv) {
+		for (i = 0; i <= self->el_fdmask; ++i) {
+			struct ev_fdwait *ent = &self->el_fdv[i];
+			if (!ev_fdwait_isused(ent))
+				continue;
+			self->el_pollv[count].fd      = ent->fw_fd;
+			self->el_pollv[count].events  = (ent->fw_rd ? POLLIN : 0) | (ent->fw_wr ? POLLOUT : 0);
+			self->el_pollv[count].revents = 0;
+			++count;
+		}
+	}
+	DeeEventLoop_LockRelease(self);
+#ifdef EVENTLOOP_HAVE_WAKEFD
+	self->el_pollv[count].fd      = self->el_wakefd[0];
+	self->el_pollv[count].events  = POLLIN;
+	self->el_pollv[count].revents = 0;
+	++count;
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+	DBG_ALIGNMENT_DISABLE();
+	error = ev_poll(self->el_pollv, count, timeout_ms);
+	if unlikely(error < 0) {
+		error = (int)GET_NET_ERROR();
+		DBG_ALIGNMENT_ENABLE();
+#ifdef EINTR
+		if (error == EINTR)
+			return 0;
+#endif /* EINTR */
+		return DeeNet_ThrowErrorf(&DeeError_NetError, (neterrno_t)error,
+		                          "Failed to wait for I/O events");
+	}
+	DBG_ALIGNMENT_ENABLE();
+	for (i = 0; i < count && error; ++i) {
+		short ev = self->el_pollv[i].revents;
+		if (!ev)
+			continue;
+		--error;
+#ifdef EVENTLOOP_HAVE_WAKEFD
+		if (self->el_pollv[i].fd == self->el_wakefd[0]) {
+			eventloop_drainwake(self);
+			continue;
+		}
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+		if unlikely(eventloop_wakefd(self, self->el_pollv[i].fd,
+		                             (ev & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) != 0,
+		                             (ev & (POLLOUT | POLLERR | POLLHUP | POLLNVAL)) != 0))
+			goto err;
+	}
+	return 0;
+#ifndef EVENTLOOP_HAVE_WAKEFD
+do_sleep:
+	return DeeThread_Sleep((uint64_t)timeout_ms * 1000);
+#endif /* !EVENTLOOP_HAVE_WAKEFD */
+err:
+	return -1;
+#else /* ... */
+	/* Without I/O notifications, there can only be timers to wait for. */
+	return DeeThread_Sleep((uint64_t)timeout_ms * 1000);
+#endif /* !... */
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_run_impl(DeeEventLoopObject *__restrict self) {
+	for (;;) {
+		uint64_t now;
+		int timeout_ms;
+		if (DeeThread_CheckInterrupt())
+			goto err;
+		if (atomic_read(&self->el_stop))
+			break;
+		if unlikely(eventloop_runready(self))
+			goto err;
+		if unlikely(eventloop_runtimers(self, DeeThread_GetTimeMicroSeconds()))
+			goto err;
+		/* Figure out how long to wait for I/O */
+		now = DeeThread_GetTimeMicroSeconds();
+		timeout_ms = EVENTLOOP_POLL_SLICE_MS;
+		DeeEventLoop_LockAcquire(self);
+		if (self->el_readyc) {
+			timeout_ms = 0;
+		} else if (self->el_timerc) {
+			uint64_t when = self->el_timerv[0].t_when;
+			if (when <= now) {
+				timeout_ms = 0;
+			} else if ((when - now) < (uint64_t)EVENTLOOP_POLL_SLICE_MS * 1000) {
+				timeout_ms = (int)(((when - now) + 999) / 1000);
+			}
+		} else if (!self->el_fdused && !atomic_read(&self->el_external)) {
+			/* Nothing left to do. */
+			DeeEventLoop_LockRelease(self);
+			break;
+		}
+		DeeEventLoop_LockRelease(self);
+		if unlikely(eventloop_poll(self, timeout_ms))
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_init(DeeEventLoopObject *__restrict self,
+               size_t argc, DeeObject *const *argv) {
+	DeeObject *executor = NULL;
+	if (DeeArg_Unpack(argc, argv, "|o:EventLoop", &executor))
+		goto err;
+	if (executor && DeeNone_Check(executor))
+		executor = NULL;
+	Dee_atomic_lock_init(&self->el_lock);
+	self->el_readyc   = 0;
+	self->el_readya   = 0;
+	self->el_readyv   = NULL;
+	self->el_sparev   = NULL;
+	self->el_sparea   = 0;
+	self->el_timerc   = 0;
+	self->el_timera   = 0;
+	self->el_timerv   = NULL;
+	self->el_timerseq = 0;
+	self->el_fdused   = 0;
+	self->el_fdmask   = 0;
+	self->el_fdv      = NULL;
+	self->el_external = 0;
+	self->el_running  = false;
+	self->el_stop     = false;
+#ifdef CONFIG_HAVE_EPOLL
+	DBG_ALIGNMENT_DISABLE();
+#ifdef EPOLL_CLOEXEC
+	self->el_epfd = epoll_create1(EPOLL_CLOEXEC);
+#else /* EPOLL_CLOEXEC */
+	self->el_epfd = epoll_create(64);
+#endif /* !EPOLL_CLOEXEC */
+	DBG_ALIGNMENT_ENABLE();
+	if unlikely(self->el_epfd < 0) {
+		DeeNet_ThrowErrorf(&DeeError_NetError, GET_NET_ERROR(),
+		                   "Failed to create epoll descriptor");
+		goto err;
+	}
+#elif defined(CONFIG_HAVE_POLL)
+	self->el_pollv = NULL;
+	self->el_polla = 0;
+#endif /* ... */
+#ifdef EVENTLOOP_HAVE_WAKEFD
+	self->el_wakeup = false;
+	DBG_ALIGNMENT_DISABLE();
+	if unlikely(pipe(self->el_wakefd) != 0)
+		goto err_wakefd;
+	(void)fcntl(self->el_wakefd[0], F_SETFL, O_NONBLOCK);
+	(void)fcntl(self->el_wakefd[1], F_SETFL, O_NONBLOCK);
+#ifdef FD_CLOEXEC
+	(void)fcntl(self->el_wakefd[0], F_SETFD, FD_CLOEXEC);
+	(void)fcntl(self->el_wakefd[1], F_SETFD, FD_CLOEXEC);
+#endif /* FD_CLOEXEC */
+#ifdef CONFIG_HAVE_EPOLL
+	{
+		struct epoll_event ev;
+		ev.events   = EPOLLIN;
+		ev.data.u64 = 0;
+		ev.data.fd  = self->el_wakefd[0];
+		if unlikely(epoll_ctl(self->el_epfd, EPOLL_CTL_ADD, self->el_wakefd[0], &ev) != 0) {
+			int error = (int)GET_NET_ERROR();
+			(void)close(self->el_wakefd[0]);
+			(void)close(self->el_wakefd[1]);
+			errno = error;
+			goto err_wakefd;
+		}
+	}
+#endif /* CONFIG_HAVE_EPOLL */
+	DBG_ALIGNMENT_ENABLE();
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+	self->el_executor = executor;
+	Dee_XIncref(executor);
+	return 0;
+#ifdef EVENTLOOP_HAVE_WAKEFD
+err_wakefd:
+	{
+		neterrno_t error = GET_NET_ERROR();
+		DBG_ALIGNMENT_ENABLE();
+#ifdef CONFIG_HAVE_EPOLL
+		(void)close(self->el_epfd);
+#endif /* CONFIG_HAVE_EPOLL */
+		DeeNet_ThrowErrorf(&DeeError_NetError, error,
+		                   "Failed to create event loop wake-up pipe");
+	}
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+eventloop_ctor(DeeEventLoopObject *__restrict self) {
+	return eventloop_init(self, 0, NULL);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+eventloop_fini(DeeEventLoopObject *__restrict self) {
+	size_t i;
+	Dee_Decrefv(self->el_readyv, self->el_readyc);
+	Dee_Free(self->el_readyv);
+	Dee_Free(self->el_sparev);
+	for (i = 0; i < self->el_timerc; ++i)
+		Dee_Decref(self->el_timerv[i].t_obj);
+	Dee_Free(self->el_timerv);
+	if (self->el_fdv) {
+		for (i = 0; i <= self->el_fdmask; ++i) {
+			Dee_XDecref(self->el_fdv[i].fw_rd);
+			Dee_XDecref(self->el_fdv[i].fw_wr);
+		}
+		Dee_Free(self->el_fdv);
+	}
+	Dee_XDecref(self->el_executor);
+	DBG_ALIGNMENT_DISABLE();
+#ifdef EVENTLOOP_HAVE_WAKEFD
+	(void)close(self->el_wakefd[0]);
+	(void)close(self->el_wakefd[1]);
+#endif /* EVENTLOOP_HAVE_WAKEFD */
+#ifdef CONFIG_HAVE_EPOLL
+	(void)close(self->el_epfd);
+#elif defined(CONFIG_HAVE_POLL)
+	Dee_Free(self->el_pollv);
+#endif /* ... */
+	DBG_ALIGNMENT_ENABLE();
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+eventloop_visit(DeeEventLoopObject *__restrict self, dvisit_t proc, void *arg) {
+	size_t i;
+	DeeEventLoop_LockAcquire(self);
+	Dee_Visitv(self->el_readyv, self->el_readyc);
+	for (i = 0; i < self->el_timerc; ++i)
+		Dee_Visit(self->el_timerv[i].t_obj);
+	if (self->el_fdv) {
+		for (i = 0; i <= self->el_fdmask; ++i) {
+			Dee_XVisit(self->el_fdv[i].fw_rd);
+			Dee_XVisit(self->el_fdv[i].fw_wr);
+		}
+	}
+	Dee_XVisit(self->el_executor);
+	DeeEventLoop_LockRelease(self);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+eventloop_clear(DeeEventLoopObject *__restrict self) {
+	size_t i, readyc, timerc, fdmask;
+	DREF DeeEventLoopTaskObject **readyv;
+	struct ev_timer *timerv;
+	struct ev_fdwait *fdv;
+	DREF DeeObject *executor;
+	DeeEventLoop_LockAcquire(self);
+	readyc   = self->el_readyc;
+	readyv   = self->el_readyv;
+	timerc   = self->el_timerc;
+	timerv   = self->el_timerv;
+	fdmask   = self->el_fdmask;
+	fdv      = self->el_fdv;
+	executor = self->el_executor;
+	self->el_readyc   = 0;
+	self->el_readya   = 0;
+	self->el_readyv   = NULL;
+	self->el_timerc   = 0;
+	self->el_timera   = 0;
+	self->el_timerv   = NULL;
+	self->el_fdused   = 0;
+	self->el_fdmask   = 0;
+	self->el_fdv      = NULL;
+	self->el_executor = NULL;
+	DeeEventLoop_LockRelease(self);
+	Dee_Decrefv(readyv, readyc);
+	Dee_Free(readyv);
+	for (i = 0; i < timerc; ++i)
+		Dee_Decref(timerv[i].t_obj);
+	Dee_Free(timerv);
+	if (fdv) {
+		/* Stale epoll registrations are harmless: events for
+		 * descriptors without waiters are simply ignored. */
+		for (i = 0; i <= fdmask; ++i) {
+			Dee_XDecref(fdv[i].fw_rd);
+			Dee_XDecref(fdv[i].fw_wr);
+		}
+		Dee_Free(fdv);
+	}
+	Dee_XDecref(executor);
+}
+
+PRIVATE struct type_gc tpconst eventloop_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&eventloop_clear
+};
+
+/* Extract the descriptor of a socket (or integer file descriptor) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+eventloop_getfd(DeeObject *__restrict obj, sock_t *__restrict p_fd) {
+	if (DeeObject_InstanceOf(obj, &DeeSocket_Type)) {
+		DeeSocketObject *sock = (DeeSocketObject *)obj;
+		socket_read(sock);
+		if unlikely(!(sock->s_state & SOCKET_FOPENED)) {
+			socket_endread(sock);
+			return err_socket_closed(EBADF, sock);
+		}
+		*p_fd = sock->s_socket;
+		socket_endread(sock);
+		return 0;
+	}
+#ifdef CONFIG_HOST_WINDOWS
+	return DeeObject_AsUIntptr(obj, p_fd);
+#else /* CONFIG_HOST_WINDOWS */
+	return DeeObject_AsInt(obj, p_fd);
+#endif /* !CONFIG_HOST_WINDOWS */
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+eventloop_makefdwait(unsigned int kind, size_t argc,
+                     DeeObject *const *argv, char const *format) {
+	sock_t fd;
+	DeeObject *obj;
+	if (DeeArg_Unpack(argc, argv, format, &obj))
+		goto err;
+	if unlikely(eventloop_getfd(obj, &fd))
+		goto err;
+	return (DREF DeeObject *)evwait_new(kind, fd, 0);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+eventloop_readable(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	return eventloop_makefdwait(EVWAIT_READ, argc, argv, "o:readable");
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+eventloop_writable(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	return eventloop_makefdwait(EVWAIT_WRITE, argc, argv, "o:writable");
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+eventloop_sleep(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	uint64_t timeout_nanoseconds;
+	if (DeeArg_Unpack(argc, argv, UNPu64 ":sleep", &timeout_nanoseconds))
+		goto err;
+	return (DREF DeeObject *)evwait_new(EVWAIT_SLEEP, (sock_t)0, timeout_nanoseconds / 1000);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeEventLoopTaskObject *DCALL
+eventloop_dospawn(DeeEventLoopObject *__restrict self, DeeObject *__restrict seq) {
+	DREF DeeEventLoopTaskObject *task;
+	task = evtask_new(self, seq);
+	if unlikely(!task)
+		goto err;
+	if unlikely(eventloop_pushready(self, task))
+		goto err_task;
+	eventloop_wake(self);
+	return task;
+err_task:
+	Dee_Decref(task);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_spawn(DeeEventLoopObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *seq;
+	if (DeeArg_Unpack(argc, argv, "o:spawn", &seq))
+		goto err;
+	return (DREF DeeObject *)eventloop_dospawn(self, seq);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_call_later(DeeEventLoopObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t delay_nanoseconds;
+	DREF DeeEventLoopTimerObject *result;
+	if unlikely(argc < 2) {
+		DeeError_Throwf(&DeeError_TypeError,
+		                "function call_later() expects at least 2 arguments");
+		goto err;
+	}
+	if (DeeObject_AsUInt64(argv[0], &delay_nanoseconds))
+		goto err;
+	result = DeeGCObject_MALLOC(DeeEventLoopTimerObject);
+	if unlikely(!result)
+		goto err;
+	result->et_args = (DREF DeeTupleObject *)DeeTuple_NewVector(argc - 2, argv + 2);
+	if unlikely(!result->et_args)
+		goto err_r;
+	result->et_func = argv[1];
+	Dee_Incref(argv[1]);
+	Dee_atomic_lock_init(&result->et_lock);
+	DeeObject_Init(result, &DeeEventLoopTimer_Type);
+	result = (DREF DeeEventLoopTimerObject *)DeeGC_Track((DeeObject *)result);
+	if unlikely(eventloop_pushtimer(self,
+	                                DeeThread_GetTimeMicroSeconds() + delay_nanoseconds / 1000,
+	                                (DeeObject *)result))
+		goto err_r_inited;
+	eventloop_wake(self);
+	return (DREF DeeObject *)result;
+err_r_inited:
+	Dee_Decref(result);
+	goto err;
+err_r:
+	DeeGCObject_FREE(result);
+err:
+	return NULL;
+}
+
+/* Return the executor used by `submit()', allocating a `threading.ThreadPool' if necessary. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_getexecutor(DeeEventLoopObject *__restrict self) {
+	DREF DeeObject *result;
+	DeeEventLoop_LockAcquire(self);
+	result = self->el_executor;
+	if (result) {
+		Dee_Incref(result);
+		DeeEventLoop_LockRelease(self);
+		return result;
+	}
+	DeeEventLoop_LockRelease(self);
+	result = DeeModule_CallExternString("threading", "ThreadPool", 0, NULL);
+	if unlikely(!result)
+		goto err;
+	DeeEventLoop_LockAcquire(self);
+	if unlikely(self->el_executor) {
+		/* Another thread was faster. */
+		DREF DeeObject *existing = self->el_executor;
+		Dee_Incref(existing);
+		DeeEventLoop_LockRelease(self);
+		Dee_Decref(result);
+		return existing;
+	}
+	Dee_Incref(result);
+	self->el_executor = result;
+	DeeEventLoop_LockRelease(self);
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_submit(DeeEventLoopObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *executor, *result;
+	if unlikely(argc < 1) {
+		DeeError_Throwf(&DeeError_TypeError,
+		                "function submit() expects at least 1 argument");
+		goto err;
+	}
+	executor = eventloop_getexecutor(self);
+	if unlikely(!executor)
+		goto err;
+	result = DeeObject_CallAttrString(executor, "submit", argc, argv);
+	Dee_Decref(executor);
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_run(DeeEventLoopObject *self, size_t argc, DeeObject *const *argv) {
+	int error;
+	DeeObject *seq = NULL;
+	if (DeeArg_Unpack(argc, argv, "|o:run", &seq))
+		goto err;
+	if (!atomic_cmpxch(&self->el_running, false, true)) {
+		DeeError_Throwf(&DeeError_RuntimeError,
+		                "Event loop %k is already running", self);
+		goto err;
+	}
+	atomic_write(&self->el_stop, false);
+	error = 0;
+	if (seq) {
+		DREF DeeEventLoopTaskObject *task;
+		task = eventloop_dospawn(self, seq);
+		if unlikely(!task) {
+			error = -1;
+		} else {
+			Dee_Decref(task);
+		}
+	}
+	if likely(error == 0)
+		error = eventloop_run_impl(self);
+	atomic_write(&self->el_running, false);
+	if unlikely(error)
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_stop(DeeEventLoopObject *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":stop"))
+		goto err;
+	atomic_write(&self->el_stop, true);
+	eventloop_wake(self);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_isrunning_get(DeeEventLoopObject *__restrict self) {
+	return_bool(atomic_read(&self->el_running));
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_pending_get(DeeEventLoopObject *__restrict self) {
+	size_t result;
+	size_t i;
+	DeeEventLoop_LockAcquire(self);
+	result = self->el_readyc + self->el_timerc;
+	if (self->el_fdv) {
+		for (i = 0; i <= self->el_fdmask; ++i) {
+			result += self->el_fdv[i].fw_rd != NULL;
+			result += self->el_fdv[i].fw_wr != NULL;
+		}
+	}
+	DeeEventLoop_LockRelease(self);
+	result += atomic_read(&self->el_external);
+	return DeeInt_NewSize(result);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+eventloop_executor_get(DeeEventLoopObject *__restrict self) {
+	return eventloop_getexecutor(self);
+}
+
+PRIVATE struct type_method tpconst eventloop_methods[] = {
+	TYPE_METHOD("spawn", &eventloop_spawn,
+	            "(task:?DSequence)->?ATask?.\n"
+	            "Schedule @task (usually the return value of a yield-function) to be run by @this event loop"),
+	TYPE_METHOD("call_later", &eventloop_call_later,
+	            "(delay_nanoseconds:?Dint,func:?DCallable,args!)->?ATimer?.\n"
+	            "Schedule ${func(args...)} to be called after @delay_nanoseconds have passed"),
+	TYPE_METHOD("submit", &eventloop_submit,
+	            "(func:?DCallable,args!)->?Ethreading:Future\n"
+	            "Run a blocking ${func(args...)} using ?#executor, returning a ?Ethreading:Future "
+	            /**/ "that a task can yield to be resumed once the call has completed:\n"
+	            "${"
+	            /**/ "function task(loop) {\n"
+	            /**/ "	local f = loop.submit(expensiveFunction, 42);\n"
+	            /**/ "	yield f;\n"
+	            /**/ "	print f.result;\n"
+	            /**/ "}"
+	            "}"),
+	TYPE_METHOD("run", &eventloop_run,
+	            "(task?:?DSequence)\n"
+	            "#tRuntimeError{@this event loop is already running}"
+	            "#t{:Interrupt}"
+	            "Run tasks until none are left, or until ?#stop is called. When given, "
+	            "@task is ?#{spawn}ed first\n"
+	            "Errors thrown by tasks or timer callbacks are propagated (and stored in "
+	            "?Aerror?ATask?.), after which ?#run may be called again to continue"),
+	TYPE_METHOD("stop", &eventloop_stop,
+	            "()\n"
+	            "Cause ?#run to return once the current pass over ready tasks has finished"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst eventloop_getsets[] = {
+	TYPE_GETTER("isrunning", &eventloop_isrunning_get,
+	            "->?Dbool\n"
+	            "Returns ?t while ?#run is executing"),
+	TYPE_GETTER("pending", &eventloop_pending_get,
+	            "->?Dint\n"
+	            "The number of tasks and timers that are ready, sleeping, or waiting"),
+	TYPE_GETTER("executor", &eventloop_executor_get,
+	            "->\n"
+	            "The executor used by ?#submit (the one passed to the constructor, "
+	            "or a ?Ethreading:ThreadPool allocated on first use)"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_method tpconst eventloop_class_methods[] = {
+	TYPE_METHOD("readable", &eventloop_readable,
+	            "(fd:?X2?Gsocket?Dint)->?AWait?.\n"
+	            "#tFileClosed{The given socket has been closed}"
+	            "Returns a wait request that a task can yield to be resumed once @fd "
+	            "has data to ?Arecv?Gsocket, or a connection to ?Aaccept?Gsocket"),
+	TYPE_METHOD("writable", &eventloop_writable,
+	            "(fd:?X2?Gsocket?Dint)->?AWait?.\n"
+	            "#tFileClosed{The given socket has been closed}"
+	            "Returns a wait request that a task can yield to be resumed once @fd "
+	            "can ?Asend?Gsocket data, or has finished ?Atryconnect?Gsocketing"),
+	TYPE_METHOD("sleep", &eventloop_sleep,
+	            "(timeout_nanoseconds:?Dint)->?AWait?.\n"
+	            "Returns a wait request that a task can yield to be resumed "
+	            "after @timeout_nanoseconds have passed"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_member tpconst eventloop_class_members[] = {
+	TYPE_MEMBER_CONST("Task", &DeeEventLoopTask_Type),
+	TYPE_MEMBER_CONST("Wait", &DeeEventLoopWait_Type),
+	TYPE_MEMBER_CONST("Timer", &DeeEventLoopTimer_Type),
+	TYPE_MEMBER_END
+};
+
+INTERN DeeTypeObject DeeEventLoop_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "EventLoop",
+	/* .tp_doc      = */ DOC("A single-threaded event loop for running many tasks cooperatively, using "
+	                         /**/ "epoll (or poll where that isn't available) to wait for sockets\n"
+	                         "Tasks are yield functions that can yield:\n"
+	                         "#T{Value|Task is resumed...~"
+	                         /**/ "?N|once other ready tasks had their turn&"
+	                         /**/ "${EventLoop.readable(fd)}|once @fd can be read from (or accepted)&"
+	                         /**/ "${EventLoop.writable(fd)}|once @fd can be written to (or has connected)&"
+	                         /**/ "${EventLoop.sleep(ns)}|after @ns nanoseconds have passed&"
+	                         /**/ "?ATask?.|once the given task has finished&"
+	                         /**/ "Any object with a ${whendone(callback)} function (e.g. "
+	                         /**/ /**/ "?Ethreading:Future)|once that object invokes its callback"
+	                         "}\n"
+	                         "Readiness may be spurious, so tasks should use the non-blocking functions "
+	                         /**/ "of ?Gsocket (?Atryrecv?Gsocket, ?Atrysend?Gsocket, ?Atryaccept?Gsocket, "
+	                         /**/ "?Atryconnect?Gsocket) and wait again when those indicate that the "
+	                         /**/ "operation would block:\n"
+	                         "${"
+	                         /**/ "import EventLoop, socket from net;\n"
+	                         /**/ "function echo(conn: socket) {\n"
+	                         /**/ "	for (;;) {\n"
+	                         /**/ "		local data = conn.tryrecv();\n"
+	                         /**/ "		if (data is none) {\n"
+	                         /**/ "			yield EventLoop.readable(conn);\n"
+	                         /**/ "			continue;\n"
+	                         /**/ "		}\n"
+	                         /**/ "		if (!data)\n"
+	                         /**/ "			break;\n"
+	                         /**/ "		while (data) {\n"
+	                         /**/ "			local sent = conn.trysend(data);\n"
+	                         /**/ "			if (sent is none) {\n"
+	                         /**/ "				yield EventLoop.writable(conn);\n"
+	                         /**/ "				continue;\n"
+	                         /**/ "			}\n"
+	                         /**/ "			data = data[sent:];\n"
+	                         /**/ "		}\n"
+	                         /**/ "	}\n"
+	                         /**/ "	conn.close();\n"
+	                         /**/ "}"
+	                         "}\n"
+	                         "\n"
+	                         "(executor?)\n"
+	                         "#pexecutor{An object with a ${submit(func, args...)} function used to run "
+	                         /**/ "blocking calls (s.a. ?#submit). Defaults to a ?Ethreading:ThreadPool}"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)&eventloop_ctor,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)&eventloop_init,
+				TYPE_FIXED_ALLOCATOR_GC(DeeEventLoopObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&eventloop_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&eventloop_visit,
+	/* .tp_gc            = */ &eventloop_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ eventloop_methods,
+	/* .tp_getsets       = */ eventloop_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ eventloop_class_methods,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ eventloop_class_members
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_SOCKET_EVENTLOOP_C */
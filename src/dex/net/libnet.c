@@ -213,6 +213,7 @@ PRIVATE struct dex_symbol symbols[] = {
 	{ "socket", (DeeObject *)&DeeSocket_Type, MODSYM_FREADONLY },
 	{ "sockaddr", (DeeObject *)&DeeSockAddr_Type, MODSYM_FREADONLY },
 	{ "NetError", (DeeObject *)&DeeError_NetError, MODSYM_FREADONLY },
+	{ "EventLoop", (DeeObject *)&DeeEventLoop_Type, MODSYM_FREADONLY },
 	{ "getafname", (DeeObject *)&lib_getafname, MODSYM_FREADONLY,
 	  DOC("(id:?Dint)->?Dstring\n"
 	      "(id:?Dint)->?Dint\n"
@@ -53,6 +53,44 @@
 #endif /* CONFIG_HOST_UNIX */
 #endif /* !CONFIG_HOST_WINDOWS */
 
+/* I/O readiness notification backends (used by `EventLoop') */
+#ifdef CONFIG_NO_EPOLL
+#undef CONFIG_HAVE_EPOLL
+#elif !defined(CONFIG_HAVE_EPOLL) && !defined(CONFIG_HOST_WINDOWS) && \
+      (__has_include(<sys/epoll.h>) || (defined(__NO_has_include) && \
+       (defined(__linux__) || defined(__linux) || defined(linux))))
+#define CONFIG_HAVE_EPOLL
+#endif
+
+#ifdef CONFIG_NO_POLL
+#undef CONFIG_HAVE_POLL
+#elif !defined(CONFIG_HAVE_POLL) && \
+      (defined(CONFIG_HOST_WINDOWS) ? (defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0600) : \
+       (__has_include(<poll.h>) || (defined(__NO_has_include) && defined(CONFIG_HOST_UNIX))))
+#define CONFIG_HAVE_POLL
+#endif
+
+#ifdef CONFIG_HAVE_EPOLL
+#include <sys/epoll.h>
+#endif /* CONFIG_HAVE_EPOLL */
+
+#if defined(CONFIG_HAVE_POLL) && !defined(CONFIG_HOST_WINDOWS)
+#include <poll.h>
+#endif /* CONFIG_HAVE_POLL && !CONFIG_HOST_WINDOWS */
+
+/* Scatter/gather I/O (`sendmsg()', `recvmsg()'), and batched datagram I/O (`sendmmsg()', `recvmmsg()') */
+#ifdef CONFIG_NO_SENDMSG
+#undef CONFIG_HAVE_SENDMSG
+#elif !defined(CONFIG_HAVE_SENDMSG) && defined(CONFIG_HOST_UNIX)
+#define CONFIG_HAVE_SENDMSG
+#endif
+
+#ifdef CONFIG_NO_SENDMMSG
+#undef CONFIG_HAVE_SENDMMSG
+#elif !defined(CONFIG_HAVE_SENDMMSG) && defined(CONFIG_HAVE_SENDMSG) && defined(MSG_WAITFORONE)
+#define CONFIG_HAVE_SENDMMSG
+#endif
+
 #ifdef CONFIG_HAVE_LIMITS_H
 #include <limits.h>
 #endif /* CONFIG_HAVE_LIMITS_H */
@@ -678,6 +716,7 @@ struct socket_object {
 #define SOCKET_FRECVCONFOK     0x0100 /* The recv timeout has been configured appropriately. */
 #define SOCKET_FSENDCONFOK     0x0200 /* The send timeout has been configured appropriately. */
 #endif /* SOCKET_HAVE_CONFIGURE_SENDRECV */
+#define SOCKET_FNONBLOCK       0x0400 /* The socket descriptor is in non-blocking mode (s.a. `DeeSocket_SetBlocking()'). */
 #define SOCKET_FHASSOCKADDR    0x1000 /* The socket's `s_sockaddr' field has been initialized. */
 #define SOCKET_FHASPEERADDR    0x2000 /* The socket's `s_peeraddr' field has been initialized. */
 #define SOCKET_FOPENED         0x4000 /* Socket hasn't been closed (yet). */
@@ -718,6 +757,24 @@ DeeSocket_Connect(DeeSocketObject *__restrict self,
 INTDEF WUNUSED NONNULL((1)) int DCALL
 DeeSocket_Listen(DeeSocketObject *__restrict self, int max_backlog);
 
+/* Start connecting a socket without waiting for the connection to be established.
+ * Puts the socket into non-blocking mode. Call again to poll for completion.
+ * @return: -1: An error occurred.
+ * @return:  0: The socket is connected.
+ * @return:  1: The connection is still being established. */
+INTDEF WUNUSED NONNULL((1, 2)) int DCALL
+DeeSocket_TryConnect(DeeSocketObject *__restrict self,
+                     SockAddr const *__restrict addr);
+
+/* Put the socket's descriptor into blocking- or non-blocking mode.
+ * In non-blocking mode, try-operations (timeout=0) no longer poll the
+ * socket before performing the actual system call, meaning that their
+ * cost is that of a single system call.
+ * @return: -1: An error occurred.
+ * @return:  0: Success. */
+INTDEF WUNUSED NONNULL((1)) int DCALL
+DeeSocket_SetBlocking(DeeSocketObject *__restrict self, bool blocking);
+
 /* Accept a new connection.
  * @return: -1: An error occurred.
  * @return:  0: Successfully accepted a new connection.
@@ -755,6 +812,39 @@ DeeSocket_SendTo(DeeSocketObject *__restrict self,
                  void const *__restrict buf, size_t bufsize,
                  int flags, SockAddr const *__restrict target);
 
+#ifdef CONFIG_HAVE_SENDMSG
+/* Same as `DeeSocket_Send()' / `DeeSocket_Recv()', but use `sendmsg()' / `recvmsg()',
+ * thus allowing data to be transferred from/to multiple buffers at once. */
+INTDEF WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_SendMsg(DeeSocketObject *__restrict self,
+                  uint64_t timeout_nanoseconds,
+                  struct msghdr const *__restrict msg,
+                  int flags);
+INTDEF WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_RecvMsg(DeeSocketObject *__restrict self,
+                  uint64_t timeout_nanoseconds,
+                  struct msghdr *__restrict msg,
+                  int flags);
+#endif /* CONFIG_HAVE_SENDMSG */
+
+#ifdef CONFIG_HAVE_SENDMMSG
+/* Send/Receive up to `count' datagrams using a single system call.
+ * `DeeSocket_RecvMMsg()' only waits for the first datagram to arrive.
+ * @return: * : The number of transferred datagrams (`msg_len' is filled in for each)
+ * @return: -1: An error occurred.
+ * @return: -2: The given `timeout_nanoseconds' has expired. */
+INTDEF WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_SendMMsg(DeeSocketObject *__restrict self,
+                   uint64_t timeout_nanoseconds,
+                   struct mmsghdr *__restrict msgv,
+                   size_t count, int flags);
+INTDEF WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_RecvMMsg(DeeSocketObject *__restrict self,
+                   uint64_t timeout_nanoseconds,
+                   struct mmsghdr *__restrict msgv,
+                   size_t count, int flags);
+#endif /* CONFIG_HAVE_SENDMMSG */
+
 /* Receive data from the given source, or the bound peer (when `source' is NULL)
  * NOTE: When the given `timeout_nanoseconds' has expired, `ITER_DONE' is returned. */
 INTDEF WUNUSED NONNULL((1)) DREF DeeObject *DCALL
@@ -805,6 +895,9 @@ struct sockaddr_object {
 };
 INTDEF DeeTypeObject DeeSockAddr_Type;
 
+/* Single-threaded event loop for running yield-function tasks (s.a. "eventloop.c") */
+INTDEF DeeTypeObject DeeEventLoop_Type;
+
 
 
 
@@ -32,6 +32,7 @@
 #include <deemon/dex.h>
 #include <deemon/error.h>
 #include <deemon/file.h>
+#include <deemon/filetypes.h>
 #include <deemon/format.h>
 #include <deemon/int.h>
 #include <deemon/none.h>
@@ -41,6 +42,10 @@
 #include <deemon/tuple.h>
 #include <deemon/util/atomic.h>
 
+#if defined(CONFIG_HAVE_sendfile) && defined(CONFIG_HAVE_SYS_SENDFILE_H)
+#include <sys/sendfile.h>
+#endif /* CONFIG_HAVE_sendfile && CONFIG_HAVE_SYS_SENDFILE_H */
+
 DECL_BEGIN
 
 typedef DeeSocketObject Socket;
@@ -572,9 +577,12 @@ err_network_down(neterrno_t error, Socket *__restrict socket,
 	                                            SOCKADDR_STR_FNODNS));
 }
 
-INTERN WUNUSED NONNULL((1, 2)) int DCALL
-DeeSocket_Connect(DeeSocketObject *__restrict self,
-                  SockAddr const *__restrict addr) {
+/* @param: nonblock: When true, don't wait for an in-progress connect to complete.
+ * @return: 1: [nonblock] The connection is still being established. */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+socket_do_connect(Socket *__restrict self,
+                  SockAddr const *__restrict addr,
+                  bool nonblock) {
 	int error;
 	socklen_t addrlen;
 again:
@@ -598,6 +606,20 @@ again:
 		DBG_ALIGNMENT_DISABLE();
 		error = (int)GET_NET_ERROR();
 		DBG_ALIGNMENT_ENABLE();
+		if (nonblock) {
+			/* A previously started connect() has completed. */
+			if (error == EISCONN)
+				goto connected;
+			if (error == EINPROGRESS || error == EALREADY ||
+#ifdef EINTR
+			    error == EINTR ||
+#endif /* EINTR */
+			    error == EWOULDBLOCK) {
+				atomic_and(&self->s_state, ~SOCKET_FCONNECTING);
+				socket_endread(self);
+				return 1;
+			}
+		}
 		if (error == EINPROGRESS
 #ifdef EINTR
 		    || error == EINTR
@@ -655,8 +677,11 @@ restart_select:
 			DBG_ALIGNMENT_ENABLE();
 			if unlikely(error)
 				goto err_connect_failure;
+		} else {
+			goto err_connect_failure;
 		}
 	}
+connected:
 	atomic_or(&self->s_state, SOCKET_FCONNECTED | SOCKET_FHASSOCKADDR);
 	/* Unset the connecting-flag. */
 	atomic_and(&self->s_state, ~SOCKET_FCONNECTING);
@@ -713,6 +738,75 @@ err:
 	return -1;
 }
 
+INTERN WUNUSED NONNULL((1, 2)) int DCALL
+DeeSocket_Connect(DeeSocketObject *__restrict self,
+                  SockAddr const *__restrict addr) {
+	return socket_do_connect(self, addr, false);
+}
+
+INTERN WUNUSED NONNULL((1, 2)) int DCALL
+DeeSocket_TryConnect(DeeSocketObject *__restrict self,
+                     SockAddr const *__restrict addr) {
+	if (!(self->s_state & SOCKET_FNONBLOCK)) {
+		if unlikely(DeeSocket_SetBlocking(self, false))
+			goto err;
+	}
+	return socket_do_connect(self, addr, true);
+err:
+	return -1;
+}
+
+INTERN WUNUSED NONNULL((1)) int DCALL
+DeeSocket_SetBlocking(DeeSocketObject *__restrict self, bool blocking) {
+	int error;
+	socket_write(self);
+	if (!(self->s_state & SOCKET_FNONBLOCK) == blocking) {
+		socket_endwrite(self);
+		return 0;
+	}
+	if (!(self->s_state & SOCKET_FOPENED)) {
+		socket_endwrite(self);
+		return err_socket_closed(EBADF, self);
+	}
+	DBG_ALIGNMENT_DISABLE();
+#ifdef CONFIG_HOST_WINDOWS
+	{
+		u_long mode = blocking ? 0 : 1;
+		error = ioctlsocket(self->s_socket, FIONBIO, &mode);
+	}
+#elif defined(CONFIG_HAVE_fcntl) && defined(CONFIG_HAVE_F_GETFL) && \
+      defined(CONFIG_HAVE_F_SETFL) && defined(CONFIG_HAVE_O_NONBLOCK)
+	error = fcntl(self->s_socket, F_GETFL);
+	if (error >= 0) {
+		error = fcntl(self->s_socket, F_SETFL,
+		              blocking ? (error & ~O_NONBLOCK)
+		                       : (error | O_NONBLOCK));
+	}
+#else /* ... */
+	/* Non-blocking descriptors aren't supported by the host. Leave `SOCKET_FNONBLOCK'
+	 * unset, such that try-operations continue to poll the socket beforehand. */
+	DBG_ALIGNMENT_ENABLE();
+	socket_endwrite(self);
+	return 0;
+#endif /* !... */
+	if unlikely(error < 0) {
+		error = (int)GET_NET_ERROR();
+		DBG_ALIGNMENT_ENABLE();
+		socket_endwrite(self);
+		return DeeNet_ThrowErrorf(&DeeError_NetError, error,
+		                          "Failed to put socket %k into %s mode",
+		                          self, blocking ? "blocking" : "non-blocking");
+	}
+	DBG_ALIGNMENT_ENABLE();
+	if (blocking) {
+		atomic_and(&self->s_state, ~SOCKET_FNONBLOCK);
+	} else {
+		atomic_or(&self->s_state, SOCKET_FNONBLOCK);
+	}
+	socket_endwrite(self);
+	return 0;
+}
+
 
 #ifdef CONFIG_NO_NOTIFICATIONS
 
@@ -878,6 +972,14 @@ do_try_select:
 			error = EBADF;
 			goto socket_was_closed;
 		}
+		if (self->s_state & SOCKET_FNONBLOCK) {
+			/* accept() itself fails with `EWOULDBLOCK' if no client is pending. */
+			DBG_ALIGNMENT_DISABLE();
+			client_socket = accept(self->s_socket, &addr->sa, &socklen);
+			DBG_ALIGNMENT_ENABLE();
+			socket_endread(self);
+			goto check_client_socket;
+		}
 #ifdef CONFIG_HOST_WINDOWS
 		error = select_interruptible(self->s_socket, FD_ACCEPT | FD_CLOSE, 0);
 		if (error != WSA_WAIT_EVENT_0) {
@@ -1024,6 +1126,7 @@ do_timed_select:
 		socket_endwrite(self);
 	}
 	/* Check for errors and save the new socket in the caller-given pointer. */
+check_client_socket:
 	if (client_socket == INVALID_SOCKET)
 		goto handle_accept_error_neterror;
 	*sock_fd = client_socket;
@@ -1161,6 +1264,10 @@ PRIVATE WUNUSED NONNULL((1)) int DCALL
 wait_for_data(Socket *__restrict self,
               uint64_t end_time, int mode) {
 	int error;
+	/* Non-blocking descriptors report `EWOULDBLOCK' from the
+	 * actual system call, so there is no need to poll first. */
+	if (end_time == 0 && (self->s_state & SOCKET_FNONBLOCK))
+		return 0;
 #ifdef EINTR
 restart:
 #endif /* EINTR */
@@ -1340,6 +1447,65 @@ err_connect_reset(neterrno_t error, Socket *__restrict socket) {
 }
 
 
+PRIVATE ATTR_COLD NONNULL((2)) int DCALL
+err_send_failed(neterrno_t error, Socket *__restrict self,
+                size_t bufsize, int flags) {
+	if (error == EBADF || error == ENOTSOCK)
+		return err_socket_closed(error, self);
+	if (error == EOPNOTSUPP)
+		return err_invalid_transfer_mode(error, self, transfer_context_send, flags);
+	if (error == ENOTCONN
+#ifdef EPIPE
+	    || (error == EPIPE && !(self->s_state & SOCKET_FSHUTDOWN_W))
+#endif /* EPIPE */
+	    ) {
+		return DeeNet_ThrowErrorf(&DeeError_NotConnected, error,
+		                          "Cannot send data through unconnected socket %k",
+		                          self);
+	}
+#ifdef EPIPE
+	if (error == EPIPE)
+		return err_socket_closed(error, self);
+#endif /* EPIPE */
+	if (error == EMSGSIZE)
+		return err_message_too_large(error, self, bufsize);
+	if (error == ECONNRESET)
+		return err_connect_reset(error, self);
+	if (error == EDESTADDRREQ) {
+		return DeeNet_ThrowErrorf(&DeeError_NotBound, error,
+		                          "Socket %k isn't connection-oriented and has no peer address set",
+		                          self);
+	}
+	if (error == ENETDOWN || error == ENETUNREACH) {
+		return DeeNet_ThrowErrorf(&DeeError_NetUnreachable, error,
+		                          "No route to network of connected to socket %k can be established",
+		                          self);
+	}
+	return DeeNet_ThrowErrorf(&DeeError_NetError, error,
+	                          "Failed to send %" PRFuSIZ " bytes of data through socket %k",
+	                          bufsize, self);
+}
+
+PRIVATE ATTR_COLD NONNULL((2)) int DCALL
+err_recv_failed(neterrno_t error, Socket *__restrict self, int flags) {
+	if (error == EBADF || error == ENOTSOCK)
+		return err_socket_closed(error, self);
+	if (error == ECONNRESET)
+		return err_connect_reset(error, self);
+	if (error == ENOTCONN)
+		return err_receive_not_connected(error, self);
+	if (error == EOPNOTSUPP)
+		return err_invalid_transfer_mode(error, self, transfer_context_recv, flags);
+	if (error == ETIMEDOUT) {
+		/* Different kind of timeout: The connection timed out, not the data transfer! */
+		return err_receive_timed_out(error, self);
+	}
+	return DeeNet_ThrowErrorf(&DeeError_NetError, error,
+	                          "Failed to receive data through socket %k",
+	                          self);
+}
+
+
 INTERN WUNUSED NONNULL((1, 3)) dssize_t DCALL
 DeeSocket_Send(DeeSocketObject *__restrict self,
                uint64_t timeout_nanoseconds,
@@ -1405,39 +1571,7 @@ again:
 			}
 			goto again;
 		}
-		if (error == EBADF || error == ENOTSOCK) {
-			err_socket_closed(error, self);
-		} else if (error == EOPNOTSUPP) {
-			err_invalid_transfer_mode(error, self, transfer_context_send, flags);
-		} else if (error == ENOTCONN
-#ifdef EPIPE
-		           || (error == EPIPE && !(self->s_state & SOCKET_FSHUTDOWN_W))
-#endif /* EPIPE */
-		           ) {
-			DeeNet_ThrowErrorf(&DeeError_NotConnected, error,
-			                   "Cannot send data through unconnected socket %k",
-			                   self);
-#ifdef EPIPE
-		} else if (error == EPIPE) {
-			err_socket_closed(error, self);
-#endif /* EPIPE */
-		} else if (error == EMSGSIZE) {
-			err_message_too_large(error, self, bufsize);
-		} else if (error == ECONNRESET) {
-			err_connect_reset(error, self);
-		} else if (error == EDESTADDRREQ) {
-			DeeNet_ThrowErrorf(&DeeError_NotBound, error,
-			                   "Socket %k isn't connection-oriented and has no peer address set",
-			                   self);
-		} else if (error == ENETDOWN || error == ENETUNREACH) {
-			DeeNet_ThrowErrorf(&DeeError_NetUnreachable, error,
-			                   "No route to network of connected to socket %k can be established",
-			                   socket);
-		} else {
-			DeeNet_ThrowErrorf(&DeeError_NetError, error,
-			                   "Failed to send %" PRFuSIZ " bytes of data through socket %k",
-			                   bufsize, self);
-		}
+		err_send_failed(error, self, bufsize, flags);
 		goto err;
 	}
 done:
@@ -1518,28 +1652,14 @@ again:
 			goto err;
 		}
 #endif /* ENOMEM */
-		if (error == EBADF || error == ENOTSOCK) {
-			err_socket_closed(error, self);
 #ifdef MSG_OOB
-		} else if (error == EINVAL && (flags & MSG_OOB)) {
+		if (error == EINVAL && (flags & MSG_OOB)) {
 			/* Indicate that nothing was read by returning 0. */
 			result = 0;
 			goto done;
-#endif /* MSG_OOB */
-		} else if (error == ECONNRESET) {
-			err_connect_reset(error, self);
-		} else if (error == ENOTCONN) {
-			err_receive_not_connected(error, self);
-		} else if (error == EOPNOTSUPP) {
-			err_invalid_transfer_mode(error, self, transfer_context_recv, flags);
-		} else if (error == ETIMEDOUT) {
-			/* Different kind of timeout: The connection timed out, not the data transfer! */
-			err_receive_timed_out(error, self);
-		} else {
-			DeeNet_ThrowErrorf(&DeeError_NetError, error,
-			                   "Failed to receive data through socket %k",
-			                   self);
 		}
+#endif /* MSG_OOB */
+		err_recv_failed(error, self, flags);
 		goto err;
 	}
 done:
@@ -1793,6 +1913,190 @@ err:
 	return -1;
 }
 
+#if defined(CONFIG_HAVE_SENDMSG) || defined(CONFIG_HAVE_SENDMMSG)
+#define SOCKET_XFER_SENDMSG     0 /* sendmsg(2) */
+#define SOCKET_XFER_RECVMSG     1 /* recvmsg(2) */
+#define SOCKET_XFER_SENDMMSG    2 /* sendmmsg(2) */
+#define SOCKET_XFER_RECVMMSG    3 /* recvmmsg(2) */
+#define SOCKET_XFER_ISRECV(op) ((op) & 1)
+
+/* Return the # of bytes being transferred (only used for error messages) */
+PRIVATE ATTR_PURE WUNUSED NONNULL((2)) size_t DCALL
+socket_xfer_size(unsigned int op, void const *__restrict arg) {
+	size_t i, result = 0;
+	struct msghdr const *msg;
+	msg = op >= SOCKET_XFER_SENDMMSG
+	      ? &((struct mmsghdr const *)arg)->msg_hdr
+	      : (struct msghdr const *)arg;
+	for (i = 0; i < (size_t)msg->msg_iovlen; ++i)
+		result += msg->msg_iov[i].iov_len;
+	return result;
+}
+
+/* Common implementation of `DeeSocket_(Send|Recv)[M]Msg()' */
+PRIVATE WUNUSED NONNULL((1, 4)) dssize_t DCALL
+socket_xfer(Socket *__restrict self, uint64_t timeout_nanoseconds,
+            unsigned int op, void *__restrict arg, size_t count, int flags) {
+	dssize_t result;
+	uint64_t end_time, timeout_microseconds;
+	timeout_microseconds = timeout_nanoseconds / 1000;
+	if (timeout_nanoseconds == (uint64_t)-1)
+		timeout_microseconds = (uint64_t)-1;
+	end_time = timeout_microseconds;
+	if (timeout_microseconds && timeout_microseconds != (uint64_t)-1)
+		end_time = DeeThread_GetTimeMicroSeconds() + timeout_microseconds;
+again:
+	if (timeout_microseconds && DeeThread_CheckInterrupt())
+		goto err;
+	socket_read(self);
+#ifdef SOCKET_HAVE_CONFIGURE_SENDRECV
+	{
+		uint16_t confok = SOCKET_XFER_ISRECV(op) ? SOCKET_FRECVCONFOK : SOCKET_FSENDCONFOK;
+		if (!(self->s_state & confok)) {
+			if (socket_upgrade(self) || !(self->s_state & confok)) {
+				if (SOCKET_XFER_ISRECV(op)) {
+					result = socket_configure_recv(self);
+					if unlikely(result) {
+						socket_endwrite(self);
+						err_configure_recv(self);
+						goto err;
+					}
+				} else {
+					result = socket_configure_send(self);
+					if unlikely(result) {
+						socket_endwrite(self);
+						err_configure_send(self);
+						goto err;
+					}
+				}
+				atomic_or(&self->s_state, confok);
+				socket_downgrade(self);
+			}
+		}
+	}
+#endif /* SOCKET_HAVE_CONFIGURE_SENDRECV */
+	result = SOCKET_XFER_ISRECV(op)
+	         ? wait_for_recv(self, end_time)
+	         : wait_for_send(self, end_time);
+	/* NOTE: in the event of a timeout or error,
+	 *      `wait_for_data()' will have unlocked the socket. */
+	if unlikely(result)
+		goto done;
+	DBG_ALIGNMENT_DISABLE();
+	switch (op) {
+
+	case SOCKET_XFER_SENDMSG:
+		result = sendmsg(self->s_socket, (struct msghdr const *)arg, flags);
+		break;
+
+	case SOCKET_XFER_RECVMSG:
+		result = recvmsg(self->s_socket, (struct msghdr *)arg, flags);
+		break;
+
+#ifdef CONFIG_HAVE_SENDMMSG
+	case SOCKET_XFER_SENDMMSG:
+		result = sendmmsg(self->s_socket, (struct mmsghdr *)arg, (unsigned int)count, flags);
+		break;
+
+	case SOCKET_XFER_RECVMMSG:
+		/* Only wait for the first datagram; take whatever else is already queued. */
+		result = recvmmsg(self->s_socket, (struct mmsghdr *)arg, (unsigned int)count,
+		                  flags | MSG_WAITFORONE, NULL);
+		break;
+#endif /* CONFIG_HAVE_SENDMMSG */
+
+	default: __builtin_unreachable();
+	}
+	DBG_ALIGNMENT_ENABLE();
+	socket_endread(self);
+	if unlikely(result < 0) {
+		neterrno_t error;
+		DBG_ALIGNMENT_DISABLE();
+		error = GET_NET_ERROR();
+		DBG_ALIGNMENT_ENABLE();
+		if (error == EWOULDBLOCK
+#if defined(EAGAIN) && EAGAIN != EWOULDBLOCK
+		    || error == EAGAIN
+#endif /* EAGAIN && EAGAIN != EWOULDBLOCK */
+#ifdef EINTR
+		    || error == EINTR
+#endif /* EINTR */
+		    ) {
+			if (timeout_microseconds != (uint64_t)-1) {
+				if (!timeout_microseconds ||
+				    DeeThread_GetTimeMicroSeconds() >= end_time)
+					return -2; /* Timeout */
+			}
+			goto again;
+		}
+#ifdef ENOMEM
+		if (error == ENOMEM) {
+			if (Dee_CollectMemory(1))
+				goto again;
+			goto err;
+		}
+#endif /* ENOMEM */
+		if (SOCKET_XFER_ISRECV(op)) {
+#ifdef MSG_OOB
+			if (error == EINVAL && (flags & MSG_OOB)) {
+				/* Indicate that nothing was read by returning 0. */
+				result = 0;
+				goto done;
+			}
+#endif /* MSG_OOB */
+			err_recv_failed(error, self, flags);
+		} else {
+			err_send_failed(error, self, socket_xfer_size(op, arg), flags);
+		}
+		goto err;
+	}
+done:
+	return result;
+err:
+	return -1;
+}
+#endif /* CONFIG_HAVE_SENDMSG || CONFIG_HAVE_SENDMMSG */
+
+#ifdef CONFIG_HAVE_SENDMSG
+INTERN WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_SendMsg(DeeSocketObject *__restrict self,
+                  uint64_t timeout_nanoseconds,
+                  struct msghdr const *__restrict msg,
+                  int flags) {
+	return socket_xfer(self, timeout_nanoseconds, SOCKET_XFER_SENDMSG,
+	                   (void *)msg, 1, flags);
+}
+
+INTERN WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_RecvMsg(DeeSocketObject *__restrict self,
+                  uint64_t timeout_nanoseconds,
+                  struct msghdr *__restrict msg,
+                  int flags) {
+	return socket_xfer(self, timeout_nanoseconds, SOCKET_XFER_RECVMSG,
+	                   msg, 1, flags);
+}
+#endif /* CONFIG_HAVE_SENDMSG */
+
+#ifdef CONFIG_HAVE_SENDMMSG
+INTERN WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_SendMMsg(DeeSocketObject *__restrict self,
+                   uint64_t timeout_nanoseconds,
+                   struct mmsghdr *__restrict msgv,
+                   size_t count, int flags) {
+	return socket_xfer(self, timeout_nanoseconds, SOCKET_XFER_SENDMMSG,
+	                   msgv, count, flags);
+}
+
+INTERN WUNUSED NONNULL((1, 3)) dssize_t DCALL
+DeeSocket_RecvMMsg(DeeSocketObject *__restrict self,
+                   uint64_t timeout_nanoseconds,
+                   struct mmsghdr *__restrict msgv,
+                   size_t count, int flags) {
+	return socket_xfer(self, timeout_nanoseconds, SOCKET_XFER_RECVMMSG,
+	                   msgv, count, flags);
+}
+#endif /* CONFIG_HAVE_SENDMMSG */
+
 PRIVATE WUNUSED size_t DCALL get_recv_chunksize(void) {
 	/* XXX: Consult an environment variable? */
 #if 0
@@ -1920,6 +2224,27 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_tryconnect(Socket *self, size_t argc, DeeObject *const *argv) {
+	int error;
+	SockAddr addr;
+	if unlikely(SockAddr_FromArgv(&addr,
+	                              self->s_sockaddr.sa.sa_family,
+	                              self->s_proto,
+	                              self->s_type,
+	                              argc,
+	                              argv))
+		goto err;
+	DBG_ALIGNMENT_ENABLE();
+	error = DeeSocket_TryConnect(self, &addr);
+	if unlikely(error < 0)
+		goto err;
+	return_bool_(error == 0);
+err:
+	DBG_ALIGNMENT_ENABLE();
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 socket_listen(Socket *self, size_t argc, DeeObject *const *argv) {
 	int max_backlog = -1;
@@ -2041,6 +2366,39 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_tryrecv(Socket *self, size_t argc, DeeObject *const *argv) {
+	size_t max_size = (size_t)-1;
+	int flags = 0;
+	DeeObject *arg_0 = NULL, *arg_1 = NULL;
+	DREF DeeObject *result;
+	if (DeeArg_Unpack(argc, argv, "|oo:tryrecv", &arg_0, &arg_1))
+		goto err;
+	if (arg_0) {
+		if (!arg_1 && DeeString_Check(arg_0)) {
+			/* "(flags:?Dstring)->?X2?DBytes?N\n" */
+			if (sock_getmsgflagsof(arg_0, &flags))
+				goto err;
+		} else {
+			if (DeeObject_AsSSize(arg_0, (dssize_t *)&max_size))
+				goto err;
+			if (arg_1 && sock_getmsgflagsof(arg_1, &flags))
+				goto err;
+		}
+	}
+	if (!(self->s_state & SOCKET_FNONBLOCK)) {
+		if unlikely(DeeSocket_SetBlocking(self, false))
+			goto err;
+	}
+	result = DeeSocket_RecvData(self, 0, max_size, flags, NULL);
+	/* Unlike `recv()', distinguish "no data yet" from end-of-stream. */
+	if (result == ITER_DONE)
+		return_none;
+	return result;
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 socket_recvinto(Socket *self, size_t argc, DeeObject *const *argv) {
 	DeeBuffer buffer;
@@ -2315,6 +2673,37 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_trysend(Socket *self, size_t argc, DeeObject *const *argv) {
+	DeeBuffer buffer;
+	DeeObject *data, *arg_0 = NULL;
+	int flags = 0;
+	dssize_t result;
+	if (DeeArg_Unpack(argc, argv, "o|o:trysend", &data, &arg_0))
+		goto err;
+	if (arg_0 && sock_getmsgflagsof(arg_0, &flags))
+		goto err;
+	if (!(self->s_state & SOCKET_FNONBLOCK)) {
+		if unlikely(DeeSocket_SetBlocking(self, false))
+			goto err;
+	}
+	if (DeeObject_GetBuf(data, &buffer, Dee_BUFFER_FREADONLY))
+		goto err;
+	result = DeeSocket_Send(self, 0,
+	                        buffer.bb_base,
+	                        buffer.bb_size,
+	                        flags);
+	DeeObject_PutBuf(data, &buffer, Dee_BUFFER_FREADONLY);
+	if unlikely(result < 0) {
+		if (result != -2)
+			goto err;
+		return_none;
+	}
+	return DeeInt_NewSize((size_t)result);
+err:
+	return NULL;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 socket_sendto(Socket *self, size_t argc, DeeObject *const *argv) {
 	DeeBuffer buffer;
@@ -2388,6 +2777,542 @@ err:
 	return NULL;
 }
 
+/* Decode the optional `timeout_nanoseconds' and `flags' arguments of the
+ * vectored transfer functions (using the same overloads as `send()') */
+PRIVATE WUNUSED NONNULL((3, 4)) int DCALL
+socket_gettimeoutflags(DeeObject *arg_0, DeeObject *arg_1,
+                       uint64_t *__restrict p_timeout,
+                       int *__restrict p_flags) {
+	*p_timeout = (uint64_t)-1;
+	*p_flags   = 0;
+	if (!arg_0)
+		return 0;
+	if (!arg_1 && DeeString_Check(arg_0))
+		return sock_getmsgflagsof(arg_0, p_flags);
+	if (DeeObject_AsInt64(arg_0, (int64_t *)p_timeout))
+		goto err;
+	if (arg_1)
+		return sock_getmsgflagsof(arg_1, p_flags);
+	return 0;
+err:
+	return -1;
+}
+
+/* A sequence of buffers used for scatter/gather I/O */
+struct socket_bufvec {
+	DREF DeeObject *bv_items; /* [1..1] Tuple of objects implementing the buffer interface. */
+	size_t          bv_count; /* # of buffers (== DeeTuple_SIZE(bv_items)) */
+	DeeBuffer      *bv_bufs;  /* [0..bv_count][owned] Buffers acquired from `bv_items' */
+	size_t          bv_total; /* Total size of all buffers (in bytes) */
+};
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+socket_bufvec_init(struct socket_bufvec *__restrict self,
+                   DeeObject *__restrict seq, unsigned int flags) {
+	size_t i;
+	self->bv_items = DeeTuple_FromSequence(seq);
+	if unlikely(!self->bv_items)
+		goto err;
+	self->bv_count = DeeTuple_SIZE(self->bv_items);
+	self->bv_bufs  = (DeeBuffer *)Dee_Mallocc(self->bv_count, sizeof(DeeBuffer));
+	if unlikely(!self->bv_bufs)
+		goto err_items;
+	self->bv_total = 0;
+	for (i = 0; i < self->bv_count; ++i) {
+		if (DeeObject_GetBuf(DeeTuple_GET(self->bv_items, i), &self->bv_bufs[i], flags))
+			goto err_bufs;
+		self->bv_total += self->bv_bufs[i].bb_size;
+	}
+	return 0;
+err_bufs:
+	while (i--)
+		DeeObject_PutBuf(DeeTuple_GET(self->bv_items, i), &self->bv_bufs[i], flags);
+	Dee_Free(self->bv_bufs);
+err_items:
+	Dee_Decref(self->bv_items);
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+socket_bufvec_fini(struct socket_bufvec *__restrict self, unsigned int flags) {
+	size_t i;
+	for (i = 0; i < self->bv_count; ++i)
+		DeeObject_PutBuf(DeeTuple_GET(self->bv_items, i), &self->bv_bufs[i], flags);
+	Dee_Free(self->bv_bufs);
+	Dee_Decref(self->bv_items);
+}
+
+#ifdef CONFIG_HAVE_SENDMSG
+#ifdef IOV_MAX
+#define SOCKET_IOV_MAX IOV_MAX
+#elif defined(UIO_MAXIOV)
+#define SOCKET_IOV_MAX UIO_MAXIOV
+#else /* ... */
+#define SOCKET_IOV_MAX 16 /* Minimum required by POSIX */
+#endif /* !... */
+
+/* Transfer data from/to (up to `SOCKET_IOV_MAX' of) the buffers of `bufs' */
+PRIVATE WUNUSED NONNULL((1, 3)) dssize_t DCALL
+socket_bufvec_xfer(Socket *__restrict self, uint64_t timeout,
+                   struct socket_bufvec const *__restrict bufs,
+                   int flags, bool recv) {
+	size_t i, count;
+	dssize_t result;
+	struct msghdr msg;
+	struct iovec *iov;
+	count = bufs->bv_count;
+	if (count > SOCKET_IOV_MAX)
+		count = SOCKET_IOV_MAX;
+	iov = (struct iovec *)Dee_Mallocac(count, sizeof(struct iovec));
+	if unlikely(!iov)
+		goto err;
+	for (i = 0; i < count; ++i) {
+		iov[i].iov_base = bufs->bv_bufs[i].bb_base;
+		iov[i].iov_len  = bufs->bv_bufs[i].bb_size;
+	}
+	bzero(&msg, sizeof(msg));
+	msg.msg_iov    = iov;
+	msg.msg_iovlen = count;
+	result = recv ? DeeSocket_RecvMsg(self, timeout, &msg, flags)
+	              : DeeSocket_SendMsg(self, timeout, &msg, flags);
+	Dee_Freea(iov);
+	return result;
+err:
+	return -1;
+}
+#else /* CONFIG_HAVE_SENDMSG */
+
+/* Transfer data from/to the buffers of `bufs' using a bounce buffer */
+PRIVATE WUNUSED NONNULL((1, 3)) dssize_t DCALL
+socket_bufvec_xfer(Socket *__restrict self, uint64_t timeout,
+                   struct socket_bufvec const *__restrict bufs,
+                   int flags, bool recv) {
+	size_t i, offset;
+	dssize_t result;
+	uint8_t *buf = (uint8_t *)Dee_Malloc(bufs->bv_total);
+	if unlikely(!buf)
+		goto err;
+	if (recv) {
+		result = DeeSocket_Recv(self, timeout, buf, bufs->bv_total, flags);
+		for (i = 0, offset = 0; result > 0 && offset < (size_t)result; ++i) {
+			size_t part = bufs->bv_bufs[i].bb_size;
+			if (part > (size_t)result - offset)
+				part = (size_t)result - offset;
+			memcpy(bufs->bv_bufs[i].bb_base, buf + offset, part);
+			offset += part;
+		}
+	} else {
+		for (i = 0, offset = 0; i < bufs->bv_count; ++i) {
+			memcpy(buf + offset, bufs->bv_bufs[i].bb_base, bufs->bv_bufs[i].bb_size);
+			offset += bufs->bv_bufs[i].bb_size;
+		}
+		result = DeeSocket_Send(self, timeout, buf, bufs->bv_total, flags);
+	}
+	Dee_Free(buf);
+	return result;
+err:
+	return -1;
+}
+#endif /* !CONFIG_HAVE_SENDMSG */
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_sendv(Socket *self, size_t argc, DeeObject *const *argv) {
+	struct socket_bufvec bufs;
+	DeeObject *data, *arg_0 = NULL, *arg_1 = NULL;
+	uint64_t timeout;
+	int flags;
+	dssize_t result;
+	if (DeeArg_Unpack(argc, argv, "o|oo:sendv", &data, &arg_0, &arg_1))
+		goto err;
+	if (socket_gettimeoutflags(arg_0, arg_1, &timeout, &flags))
+		goto err;
+	if (socket_bufvec_init(&bufs, data, Dee_BUFFER_FREADONLY))
+		goto err;
+	result = socket_bufvec_xfer(self, timeout, &bufs, flags, false);
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FREADONLY);
+	if unlikely(result < 0) {
+		if (result != -2)
+			goto err;
+		result = 0;
+	}
+	return DeeInt_NewSize((size_t)result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_recvv(Socket *self, size_t argc, DeeObject *const *argv) {
+	struct socket_bufvec bufs;
+	DeeObject *dst, *arg_0 = NULL, *arg_1 = NULL;
+	uint64_t timeout;
+	int flags;
+	dssize_t result;
+	if (DeeArg_Unpack(argc, argv, "o|oo:recvv", &dst, &arg_0, &arg_1))
+		goto err;
+	if (socket_gettimeoutflags(arg_0, arg_1, &timeout, &flags))
+		goto err;
+	if (socket_bufvec_init(&bufs, dst, Dee_BUFFER_FWRITABLE))
+		goto err;
+	result = socket_bufvec_xfer(self, timeout, &bufs, flags, true);
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FWRITABLE);
+	if unlikely(result < 0) {
+		if (result != -2)
+			goto err;
+		result = 0;
+	}
+	return DeeInt_NewSize((size_t)result);
+err:
+	return NULL;
+}
+
+/* Max # of datagrams transferred by a single call to `sendmmsg()' / `recvmmsg()' */
+#define SOCKET_MMSG_MAXBATCH 1024
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_sendmany(Socket *self, size_t argc, DeeObject *const *argv) {
+	struct socket_bufvec bufs;
+	DeeObject *data, *arg_0 = NULL, *arg_1 = NULL;
+	uint64_t timeout;
+	int flags;
+	size_t sent = 0;
+	if (DeeArg_Unpack(argc, argv, "o|oo:sendmany", &data, &arg_0, &arg_1))
+		goto err;
+	if (socket_gettimeoutflags(arg_0, arg_1, &timeout, &flags))
+		goto err;
+	if (socket_bufvec_init(&bufs, data, Dee_BUFFER_FREADONLY))
+		goto err;
+#ifdef CONFIG_HAVE_SENDMMSG
+	if (bufs.bv_count) {
+		struct mmsghdr *msgv;
+		struct iovec *iov;
+		size_t i, batch = bufs.bv_count;
+		if (batch > SOCKET_MMSG_MAXBATCH)
+			batch = SOCKET_MMSG_MAXBATCH;
+		msgv = (struct mmsghdr *)Dee_Callocc(batch, sizeof(struct mmsghdr) + sizeof(struct iovec));
+		if unlikely(!msgv)
+			goto err_bufs;
+		iov = (struct iovec *)(msgv + batch);
+		while (sent < bufs.bv_count) {
+			dssize_t count;
+			size_t todo = bufs.bv_count - sent;
+			if (todo > batch)
+				todo = batch;
+			for (i = 0; i < todo; ++i) {
+				iov[i].iov_base = bufs.bv_bufs[sent + i].bb_base;
+				iov[i].iov_len  = bufs.bv_bufs[sent + i].bb_size;
+				msgv[i].msg_hdr.msg_iov    = &iov[i];
+				msgv[i].msg_hdr.msg_iovlen = 1;
+			}
+			count = DeeSocket_SendMMsg(self, timeout, msgv, todo, flags);
+			if unlikely(count < 0) {
+				if (count == -2)
+					break; /* Timeout */
+				Dee_Free(msgv);
+				goto err_bufs;
+			}
+			sent += (size_t)count;
+			if ((size_t)count < todo)
+				break; /* Partial transfer */
+		}
+		Dee_Free(msgv);
+	}
+#else /* CONFIG_HAVE_SENDMMSG */
+	for (; sent < bufs.bv_count; ++sent) {
+		dssize_t error;
+		error = DeeSocket_Send(self, timeout,
+		                       bufs.bv_bufs[sent].bb_base,
+		                       bufs.bv_bufs[sent].bb_size,
+		                       flags);
+		if unlikely(error < 0) {
+			if (error == -2)
+				break; /* Timeout */
+			goto err_bufs;
+		}
+	}
+#endif /* !CONFIG_HAVE_SENDMMSG */
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FREADONLY);
+	return DeeInt_NewSize(sent);
+err_bufs:
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FREADONLY);
+err:
+	return NULL;
+}
+
+/* A datagram received by `recvmany()' */
+struct socket_datagram {
+	SockAddr dg_addr; /* Address of the sender */
+	size_t   dg_size; /* # of bytes written to the associated buffer */
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_recvmany(Socket *self, size_t argc, DeeObject *const *argv) {
+	struct socket_bufvec bufs;
+	struct socket_datagram *dgv;
+	DeeObject *dst, *arg_0 = NULL, *arg_1 = NULL;
+	DREF DeeTupleObject *result;
+	uint64_t timeout;
+	int flags;
+	size_t i, batch, count;
+	if (DeeArg_Unpack(argc, argv, "o|oo:recvmany", &dst, &arg_0, &arg_1))
+		goto err;
+	if (socket_gettimeoutflags(arg_0, arg_1, &timeout, &flags))
+		goto err;
+	if (socket_bufvec_init(&bufs, dst, Dee_BUFFER_FWRITABLE))
+		goto err;
+	batch = bufs.bv_count;
+	if (batch > SOCKET_MMSG_MAXBATCH)
+		batch = SOCKET_MMSG_MAXBATCH;
+	/* Zero-initialize, since the kernel only writes the first `msg_namelen' bytes
+	 * of each address (which may be fewer, or none for unconnected protocols) */
+	dgv = (struct socket_datagram *)Dee_Callocc(batch, sizeof(struct socket_datagram));
+	if unlikely(!dgv)
+		goto err_bufs;
+	count = 0;
+#ifdef CONFIG_HAVE_SENDMMSG
+	if (batch) {
+		dssize_t error;
+		struct mmsghdr *msgv;
+		struct iovec *iov;
+		msgv = (struct mmsghdr *)Dee_Callocc(batch, sizeof(struct mmsghdr) + sizeof(struct iovec));
+		if unlikely(!msgv)
+			goto err_bufs_dgv;
+		iov = (struct iovec *)(msgv + batch);
+		for (i = 0; i < batch; ++i) {
+			iov[i].iov_base = bufs.bv_bufs[i].bb_base;
+			iov[i].iov_len  = bufs.bv_bufs[i].bb_size;
+			msgv[i].msg_hdr.msg_name    = &dgv[i].dg_addr;
+			msgv[i].msg_hdr.msg_namelen = sizeof(SockAddr);
+			msgv[i].msg_hdr.msg_iov     = &iov[i];
+			msgv[i].msg_hdr.msg_iovlen  = 1;
+		}
+		error = DeeSocket_RecvMMsg(self, timeout, msgv, batch, flags);
+		if likely(error > 0) {
+			count = (size_t)error;
+			for (i = 0; i < count; ++i)
+				dgv[i].dg_size = msgv[i].msg_len;
+		}
+		Dee_Free(msgv);
+		if unlikely(error == -1)
+			goto err_bufs_dgv;
+	}
+#else /* CONFIG_HAVE_SENDMMSG */
+	/* Wait for the first datagram, then take whatever else is already queued. */
+	for (; count < batch; ++count) {
+		dssize_t error;
+		error = DeeSocket_RecvFrom(self, count ? 0 : timeout,
+		                           bufs.bv_bufs[count].bb_base,
+		                           bufs.bv_bufs[count].bb_size,
+		                           flags, &dgv[count].dg_addr);
+		if unlikely(error < 0) {
+			if (error == -2)
+				break; /* Timeout / nothing left */
+			goto err_bufs_dgv;
+		}
+		dgv[count].dg_size = (size_t)error;
+	}
+#endif /* !CONFIG_HAVE_SENDMMSG */
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FWRITABLE);
+
+	/* Package received datagrams as `(sockaddr, size)' pairs (like `recvfrominto()') */
+	result = DeeTuple_NewUninitialized(count);
+	if unlikely(!result)
+		goto err_dgv;
+	for (i = 0; i < count; ++i) {
+		DREF DeeObject *pair, *size_ob;
+		DREF DeeSockAddrObject *addr;
+		addr = DeeObject_MALLOC(DeeSockAddrObject);
+		if unlikely(!addr)
+			goto err_dgv_r;
+		memcpy(&addr->sa_addr, &dgv[i].dg_addr, sizeof(SockAddr));
+		DeeObject_Init(addr, &DeeSockAddr_Type);
+		size_ob = DeeInt_NewSize(dgv[i].dg_size);
+		if unlikely(!size_ob) {
+			Dee_Decref(addr);
+			goto err_dgv_r;
+		}
+		pair = DeeTuple_Pack(2, addr, size_ob);
+		Dee_Decref(size_ob);
+		Dee_Decref(addr);
+		if unlikely(!pair)
+			goto err_dgv_r;
+		DeeTuple_SET(result, i, pair); /* Inherit reference */
+	}
+	Dee_Free(dgv);
+	return (DREF DeeObject *)result;
+err_dgv_r:
+	Dee_Decrefv(DeeTuple_ELEM(result), i);
+	DeeTuple_FreeUninitialized(result);
+	goto err_dgv;
+err_bufs_dgv:
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FWRITABLE);
+err_dgv:
+	Dee_Free(dgv);
+	goto err;
+err_bufs:
+	socket_bufvec_fini(&bufs, Dee_BUFFER_FWRITABLE);
+err:
+	return NULL;
+}
+
+#undef SOCKET_HAVE_SENDFILE_SYSFD
+#if defined(CONFIG_HAVE_sendfile) && defined(DeeSystemFile_GetHandle) && defined(DEESYSTEM_FILE_USE_UNIX)
+#define SOCKET_HAVE_SENDFILE_SYSFD
+#endif /* CONFIG_HAVE_sendfile && DeeSystemFile_GetHandle && DEESYSTEM_FILE_USE_UNIX */
+
+#ifdef SOCKET_HAVE_SENDFILE_SYSFD
+#ifndef LINUX_SENDFILE_MAXCOUNT
+#define LINUX_SENDFILE_MAXCOUNT 0x7ffff000
+#endif /* !LINUX_SENDFILE_MAXCOUNT */
+
+/* Send up to `count' bytes from `fd' using `sendfile(2)', starting at `*p_offset'
+ * (which is updated), or at the file's current position when `p_offset' is NULL.
+ * @param: p_sent: Incremented by the # of bytes sent.
+ * @return: 0 : Done (`count' bytes were sent, `fd' reached its end, or the
+ *              non-blocking socket `self' can't accept any more data)
+ * @return: 1 : `sendfile(2)' can't be used: send the remainder by hand.
+ * @return: -1: An error occurred. */
+PRIVATE WUNUSED NONNULL((1, 5)) int DCALL
+socket_sendfile_sysfd(Socket *__restrict self, int fd, off_t *p_offset,
+                      uint64_t count, uint64_t *__restrict p_sent) {
+	while (*p_sent < count) {
+		ssize_t status;
+		int error;
+		size_t chunk = LINUX_SENDFILE_MAXCOUNT;
+		if (chunk > count - *p_sent)
+			chunk = (size_t)(count - *p_sent);
+		socket_read(self);
+		error = wait_for_send(self, (self->s_state & SOCKET_FNONBLOCK) ? 0 : (uint64_t)-1);
+		/* NOTE: in the event of a timeout or error,
+		 *      `wait_for_send()' will have unlocked the socket. */
+		if unlikely(error)
+			return error == -2 ? 0 : -1;
+		DBG_ALIGNMENT_DISABLE();
+		status = sendfile(self->s_socket, fd, p_offset, chunk);
+		DBG_ALIGNMENT_ENABLE();
+		socket_endread(self);
+		if (status == 0)
+			break; /* End of file */
+		if (status < 0) {
+			neterrno_t neterr;
+			DBG_ALIGNMENT_DISABLE();
+			neterr = GET_NET_ERROR();
+			DBG_ALIGNMENT_ENABLE();
+			if (neterr == EWOULDBLOCK
+#if defined(EAGAIN) && EAGAIN != EWOULDBLOCK
+			    || neterr == EAGAIN
+#endif /* EAGAIN && EAGAIN != EWOULDBLOCK */
+			    ) {
+				if (self->s_state & SOCKET_FNONBLOCK)
+					break;
+				continue;
+			}
+#ifdef EINTR
+			if (neterr == EINTR) {
+				if (DeeThread_CheckInterrupt())
+					goto err;
+				continue;
+			}
+#endif /* EINTR */
+			if (neterr == ECONNRESET || neterr == ENOTCONN
+#ifdef EPIPE
+			    || neterr == EPIPE
+#endif /* EPIPE */
+			    ) {
+				err_send_failed(neterr, self, chunk, 0);
+				goto err;
+			}
+			/* `EINVAL' / `ESPIPE' / `ENOSYS' / ...: `fd' can't be used with `sendfile(2)' */
+			return 1;
+		}
+		*p_sent += (size_t)status;
+		if (DeeThread_CheckInterrupt())
+			goto err;
+	}
+	return 0;
+err:
+	return -1;
+}
+#endif /* SOCKET_HAVE_SENDFILE_SYSFD */
+
+/* Buffer size used by `sendfile()' when data has to be copied by hand. */
+#define SOCKET_SENDFILE_BUFSIZE (64 * 1024)
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_sendfile(Socket *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *file, *offset_ob = Dee_None;
+	uint64_t offset = 0, count = (uint64_t)-1, sent = 0;
+	size_t bufsize;
+	uint8_t *buffer;
+	if (DeeArg_Unpack(argc, argv, "o|o" UNPd64 ":sendfile", &file, &offset_ob, &count))
+		goto err;
+	if (!DeeNone_Check(offset_ob) && DeeObject_AsUInt64(offset_ob, &offset))
+		goto err;
+#ifdef SOCKET_HAVE_SENDFILE_SYSFD
+	if (DeeSystemFile_Check(file)) {
+		int fd = DeeSystemFile_GetHandle(file);
+		if (fd != -1) {
+			int status;
+			off_t sysoff = (off_t)offset;
+			status = socket_sendfile_sysfd(self, fd, DeeNone_Check(offset_ob) ? NULL : &sysoff,
+			                               count, &sent);
+			if unlikely(status < 0)
+				goto err;
+			if (status == 0)
+				goto done;
+		}
+	}
+#endif /* SOCKET_HAVE_SENDFILE_SYSFD */
+
+	/* Send (the remainder) by hand. */
+	if (sent >= count)
+		goto done;
+	bufsize = SOCKET_SENDFILE_BUFSIZE;
+	if (bufsize > count - sent)
+		bufsize = (size_t)(count - sent);
+	buffer = (uint8_t *)Dee_Malloc(bufsize);
+	if unlikely(!buffer)
+		goto err;
+	while (sent < count) {
+		size_t avail, done;
+		avail = bufsize;
+		if (avail > count - sent)
+			avail = (size_t)(count - sent);
+		avail = DeeNone_Check(offset_ob)
+		        ? DeeFile_Read(file, buffer, avail)
+		        : DeeFile_PRead(file, buffer, avail, (Dee_pos_t)(offset + sent));
+		if unlikely(avail == (size_t)-1)
+			goto err_buffer;
+		if (!avail)
+			break; /* End of file */
+		for (done = 0; done < avail;) {
+			dssize_t status;
+			status = DeeSocket_Send(self,
+			                        (self->s_state & SOCKET_FNONBLOCK) ? 0 : (uint64_t)-1,
+			                        buffer + done, avail - done, 0);
+			if unlikely(status < 0) {
+				if (status != -2)
+					goto err_buffer;
+				/* Non-blocking socket is full. Rewind the file to the first unsent byte. */
+				if (DeeNone_Check(offset_ob) &&
+				    DeeFile_Seek(file, -(Dee_off_t)(avail - done), SEEK_CUR) == (Dee_pos_t)-1)
+					goto err_buffer;
+				sent += done;
+				Dee_Free(buffer);
+				goto done;
+			}
+			done += (size_t)status;
+		}
+		sent += avail;
+	}
+	Dee_Free(buffer);
+done:
+	return DeeInt_NewUInt64(sent);
+err_buffer:
+	Dee_Free(buffer);
+err:
+	return NULL;
+}
 
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 socket_wasshutdown(Socket *self, size_t argc, DeeObject *const *argv) {
@@ -2429,6 +3354,21 @@ err:
 	return NULL;
 }
 
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+socket_blocking_get(Socket *__restrict self) {
+	return_bool(!(self->s_state & SOCKET_FNONBLOCK));
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+socket_blocking_set(Socket *__restrict self, DeeObject *value) {
+	int blocking = DeeObject_Bool(value);
+	if unlikely(blocking < 0)
+		goto err;
+	return DeeSocket_SetBlocking(self, blocking != 0);
+err:
+	return -1;
+}
+
 PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
 socket_wasclosed(Socket *__restrict self) {
 	return_bool(!(self->s_state & SOCKET_FOPENED));
@@ -2483,6 +3423,16 @@ PRIVATE struct type_method tpconst socket_methods[] = {
 	            "#tFileClosed{@this socket has already been closed}"
 	            "Connect @this socket with a given address.\n"
 	            "Accepted arguments are the same as ${sockaddr(this.sock_af, args...)} when creating ?Gsockaddr"),
+	TYPE_METHOD("tryconnect", &socket_tryconnect,
+	            "(args!)->?Dbool\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#connect}"
+	            "#tFileClosed{@this socket has already been closed}"
+	            "Start connecting @this socket with a given address without waiting for the connection "
+	            "to be established. Puts @this socket into non-blocking mode (s.a. ?#blocking)\n"
+	            "Returns ?t once the connection has been established, or ?f while it is still in progress, "
+	            "in which case ?#tryconnect should be called again (with the same address) once @this "
+	            "socket has become writable (s.a. ?Awritable?GEventLoop)"),
 	TYPE_METHOD("listen", &socket_listen,
 	            "(max_backlog=!-1)\n"
 	            "#t{:Interrupt}"
@@ -2516,7 +3466,9 @@ PRIVATE struct type_method tpconst socket_methods[] = {
 	            "#t{?ANoSupport?GNetError}{The type of @this socket does not allow accepting of incoming connections}"
 	            "#tNetError{Failed to start accept a connection for some reason}"
 	            "#tFileClosed{@this socket has already been closed or was shut down}"
-	            "Same as calling ?#accept with a timeout_nanoseconds argument of ${0}"),
+	            "Same as calling ?#accept with a timeout_nanoseconds argument of ${0}\n"
+	            "When @this socket is in non-blocking mode (s.a. ?#blocking), this "
+	            "function doesn't poll the socket before invoking the system call"),
 	TYPE_METHOD("recv", &socket_recv,
 	            "(flags:?Dstring)->?DBytes\n"
 	            "(max_size=!-1,flags=!P{})->?DBytes\n"
@@ -2542,6 +3494,17 @@ PRIVATE struct type_method tpconst socket_methods[] = {
 	            "When @timeout_nanoseconds expires before any data is received, an empty string is returned\n"
 	            "Some protocols may also cause this function to return an empty string to indicate a graceful "
 	            "termination of the connection"),
+	TYPE_METHOD("tryrecv", &socket_tryrecv,
+	            "(flags:?Dstring)->?X2?DBytes?N\n"
+	            "(max_size=!-1,flags=!P{})->?X2?DBytes?N\n"
+	            "(max_size=!-1,flags=!0)->?X2?DBytes?N\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#recv}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "Receive data that is already available without blocking, putting @this socket "
+	            "into non-blocking mode (s.a. ?#blocking)\n"
+	            "Unlike ?#recv, this function returns ?N when no data is available yet, and an "
+	            "empty ?DBytes object once the peer has gracefully terminated the connection"),
 	TYPE_METHOD("recvinto", &socket_recvinto,
 	            "(dst:?DBytes,flags=!P{})->?Dint\n"
 	            "(dst:?DBytes,timeout_nanoseconds=!-1)->?Dint\n"
@@ -2605,6 +3568,15 @@ PRIVATE struct type_method tpconst socket_methods[] = {
 	            "#pflags{A set of flags used during delivery. See ?#recv for information on the string-encoded version}"
 	            "#r{The total number of bytes that was sent}"
 	            "Send @data over the network to the peer of a connected socket"),
+	TYPE_METHOD("trysend", &socket_trysend,
+	            "(data:?DBytes,flags=!P{})->?X2?Dint?N\n"
+	            "(data:?DBytes,flags=!0)->?X2?Dint?N\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#send}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "Send as much of @data as can be sent without blocking, putting @this socket "
+	            "into non-blocking mode (s.a. ?#blocking)\n"
+	            "Returns the number of bytes sent, or ?N if the socket's send buffer is full"),
 	TYPE_METHOD("sendto", &socket_sendto,
 	            "(target:?DBytes,data:?DBytes,flags=!P{})->?Dint\n"
 	            "(target:?DBytes,data:?DBytes,timeout_nanoseconds=!-1,flags=!0)->?Dint\n"
@@ -2626,6 +3598,72 @@ PRIVATE struct type_method tpconst socket_methods[] = {
 	            "the same purpose in ${target = target is Tuple ? sockaddr(this.sock_af, target...) : sockaddr(this.sock_af, target)}.}"
 	            "#r{The total number of bytes that was sent}"
 	            "Same as ?#send, but used to transmit data to a specific network target, rather than one that is already connected."),
+	TYPE_METHOD("sendv", &socket_sendv,
+	            "(data:?S?DBytes,flags=!P{})->?Dint\n"
+	            "(data:?S?DBytes,timeout_nanoseconds=!-1,flags=!0)->?Dint\n"
+	            "(data:?S?DBytes,timeout_nanoseconds=!-1,flags=!P{})->?Dint\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#send}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "#pflags{A set of flags used during delivery. See ?#recv for information on the string-encoded version}"
+	            "#r{The total number of bytes that was sent}"
+	            "Same as ?#send, but send the concatenation of all buffers from @data using a single "
+	            /**/ "system call (${sendmsg(2)}), without copying them into a temporary ?DBytes object first"),
+	TYPE_METHOD("recvv", &socket_recvv,
+	            "(dst:?S?DBytes,flags=!P{})->?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1)->?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1,flags=!P{})->?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1,flags=!0)->?Dint\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#recvinto}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "#pflags{A set of flags used during delivery. See ?#recv for information on the string-encoded version}"
+	            "#r{The total number of bytes that were received}"
+	            "Same as ?#recvinto, but received data is scattered across the buffers of @dst "
+	            /**/ "(in order) using a single system call (${recvmsg(2)})"),
+	TYPE_METHOD("sendmany", &socket_sendmany,
+	            "(datagrams:?S?DBytes,flags=!P{})->?Dint\n"
+	            "(datagrams:?S?DBytes,timeout_nanoseconds=!-1,flags=!0)->?Dint\n"
+	            "(datagrams:?S?DBytes,timeout_nanoseconds=!-1,flags=!P{})->?Dint\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#send}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "#pflags{A set of flags used during delivery. See ?#recv for information on the string-encoded version}"
+	            "#r{The number of datagrams that were sent}"
+	            "Send each buffer of @datagrams as a separate datagram to the peer of @this "
+	            /**/ "socket, batching many datagrams into a single system call (${sendmmsg(2)}) "
+	            /**/ "where supported\n"
+	            "Stops early (returning less than ${#datagrams}) when @timeout_nanoseconds expires"),
+	TYPE_METHOD("recvmany", &socket_recvmany,
+	            "(dst:?S?DBytes,flags=!P{})->?S?T2?Gsockaddr?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1)->?S?T2?Gsockaddr?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1,flags=!P{})->?S?T2?Gsockaddr?Dint\n"
+	            "(dst:?S?DBytes,timeout_nanoseconds=!-1,flags=!0)->?S?T2?Gsockaddr?Dint\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#recvfrominto}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "#pflags{A set of flags used during delivery. See ?#recv for information on the string-encoded version}"
+	            "Wait for at least one datagram to arrive, then receive as many datagrams as are "
+	            /**/ "available (up to ${#dst}) using a single system call (${recvmmsg(2)}) where supported\n"
+	            "The i'th datagram is written into ${dst[i]}, and described by the i'th element of "
+	            /**/ "the returned sequence, which contains the sender's address, and the datagram's "
+	            /**/ "size (s.a. ?#recvfrominto). Re-using the same buffers for every call avoids "
+	            /**/ "allocating memory for the received data\n"
+	            "When @timeout_nanoseconds expires before any datagram arrives, an empty sequence is returned"),
+	TYPE_METHOD("sendfile", &socket_sendfile,
+	            "(file:?DFile,offset?:?Dint,count=!-1)->?Dint\n"
+	            "#t{:Interrupt}"
+	            "#tNetError{Same errors as ?#send}"
+	            "#tFileClosed{@this socket has already been closed or was shut down}"
+	            "#poffset{The position in @file to start reading from, or ?N to read from (and advance) "
+	            /**/ "the current file position}"
+	            "#pcount{The max number of bytes to send, or ${-1} to send everything until the end of @file}"
+	            "#r{The number of bytes that were sent}"
+	            "Send the contents of @file to the peer of @this socket. When @file is a system file, "
+	            "data is transferred directly by the kernel (${sendfile(2)}) without being copied "
+	            "into user-space; otherwise, data is read and sent in chunks\n"
+	            "When @this socket is non-blocking, stops early (returning less than @count) "
+	            "once no more data can be sent without blocking"),
 	TYPE_METHOD("wasshutdown", &socket_wasshutdown,
 	            "(how:?Dint)->?Dbool\n"
 	            "(how=!?rw)->?Dbool\n"
@@ -2652,6 +3690,15 @@ PRIVATE struct type_getset tpconst socket_getsets[] = {
 	            "#t{?ANoSupport?GNetError}{@this socket's protocol does not allow for peer addresses}"
 	            "#tNetError{Failed to query the peer address for some unknown reason}"
 	            "Returns the peer (remote) address of @this socket"),
+	TYPE_GETSET("blocking", &socket_blocking_get, NULL, &socket_blocking_set,
+	            "->?Dbool\n"
+	            "#tNetError{Failed to change the mode of @this socket}"
+	            "#tFileClosed{@this socket has been closed}"
+	            "Get or set whether @this socket's descriptor is in blocking mode (the default)\n"
+	            "Operations with a timeout continue to work as before in non-blocking mode, however "
+	            "try-operations (?#tryaccept, ?#tryrecv, ?#trysend, ?#tryconnect, or any operation "
+	            "with a timeout of $0) no longer have to poll the socket before invoking the actual "
+	            "system call. ?#tryrecv, ?#trysend and ?#tryconnect switch to non-blocking mode automatically"),
 	TYPE_GETTER("wasclosed", &socket_wasclosed,
 	            "->?Dbool\n"
 	            "Returns ?t if @this socket has been ?#{close}ed"),
@@ -26,38 +26,6 @@
 
 DECL_BEGIN
 
-/* Figure out how we want to implement `cpu_count()' */
-#undef posix_cpu_count_USE_GetSystemInfo
-#undef posix_cpu_count_USE_sysconf__SC_NPROCESSORS_ONLN
-#undef posix_cpu_count_USE_sysctl__HW_AVAILCPU__HW_NCPU
-#undef posix_cpu_count_USE_sysctl__HW_AVAILCPU
-#undef posix_cpu_count_USE_sysctl__HW_NCPU
-#undef posix_cpu_count_USE_mpctl__MPC_GETNUMSPUS
-#undef posix_cpu_count_USE_sysconf__SC_NPROC_ONLN
-#undef posix_cpu_count_USE_open_AND_proc_cpuinfo
-#undef posix_cpu_count_USE_STUB
-#if defined(CONFIG_HOST_WINDOWS)
-#define posix_cpu_count_USE_GetSystemInfo
-#elif defined(CONFIG_HAVE_sysconf) && defined(CONFIG_HAVE__SC_NPROCESSORS_ONLN)
-#define posix_cpu_count_USE_sysconf__SC_NPROCESSORS_ONLN
-#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_AVAILCPU) && defined(CONFIG_HAVE_HW_NCPU)
-#define posix_cpu_count_USE_sysctl__HW_AVAILCPU__HW_NCPU
-#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_AVAILCPU)
-#define posix_cpu_count_USE_sysctl__HW_AVAILCPU
-#elif defined(CONFIG_HAVE_sysctl) && defined(CONFIG_HAVE_CTL_HW) && defined(CONFIG_HAVE_HW_NCPU)
-#define posix_cpu_count_USE_sysctl__HW_NCPU
-#elif defined(CONFIG_HAVE_mpctl) && defined(CONFIG_HAVE_MPC_GETNUMSPUS)
-#define posix_cpu_count_USE_mpctl__MPC_GETNUMSPUS
-#elif defined(CONFIG_HAVE_sysconf) && defined(CONFIG_HAVE__SC_NPROC_ONLN)
-#define posix_cpu_count_USE_sysconf__SC_NPROC_ONLN
-#elif defined(CONFIG_HAVE_PROCFS)
-#define posix_cpu_count_USE_open_AND_proc_cpuinfo
-#else /* ... */
-#define posix_cpu_count_USE_STUB
-#endif /* !... */
-
-
-
 /*[[[deemon import("rt.gen.dexutils").gw("cpu_count", "->?Dint", libname: "posix"); ]]]*/
 FORCELOCAL WUNUSED DREF DeeObject *DCALL posix_cpu_count_f_impl(void);
 PRIVATE WUNUSED DREF DeeObject *DCALL posix_cpu_count_f(size_t argc, DeeObject *const *argv);
@@ -74,115 +42,7 @@ err:
 FORCELOCAL WUNUSED DREF DeeObject *DCALL posix_cpu_count_f_impl(void)
 /*[[[end]]]*/
 {
-	/* Implementation variants taken from here:
-	 * https://stackoverflow.com/questions/150355/programmatically-find-the-number-of-cores-on-a-machine */
-
-#ifdef posix_cpu_count_USE_GetSystemInfo
-	SYSTEM_INFO sysinfo;
-	GetSystemInfo(&sysinfo);
-	return DeeInt_NewUInt32(sysinfo.dwNumberOfProcessors);
-#endif /* posix_cpu_count_USE_GetSystemInfo */
-
-#ifdef posix_cpu_count_USE_sysconf__SC_NPROCESSORS_ONLN
-	int result;
-	result = sysconf(_SC_NPROCESSORS_ONLN);
-	if unlikely(result <= 0)
-		result = 1; /* Shouldn't happen... */
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_sysconf__SC_NPROCESSORS_ONLN */
-
-#ifdef posix_cpu_count_USE_sysctl__HW_AVAILCPU__HW_NCPU
-	int mib[4], result = 0;
-	size_t len = sizeof(result);
-	mib[0] = CTL_HW;
-	mib[1] = HW_AVAILCPU;
-	sysctl(mib, 2, &result, &len, NULL, 0);
-	if (result <= 0) {
-		mib[1] = HW_NCPU;
-		sysctl(mib, 2, &result, &len, NULL, 0);
-		if (result <= 0)
-			result = 1;
-	}
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_sysctl__HW_AVAILCPU__HW_NCPU */
-
-#ifdef posix_cpu_count_USE_sysctl__HW_AVAILCPU
-	int mib[4], result = 0;
-	size_t len = sizeof(result);
-	mib[0] = CTL_HW;
-	mib[1] = HW_AVAILCPU;
-	sysctl(mib, 2, &result, &len, NULL, 0);
-	if (result <= 0)
-		result = 1;
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_sysctl__HW_AVAILCPU */
-
-#ifdef posix_cpu_count_USE_sysctl__HW_NCPU
-	int mib[4], result = 0;
-	size_t len = sizeof(result);
-	mib[0] = CTL_HW;
-	mib[1] = HW_NCPU;
-	sysctl(mib, 2, &result, &len, NULL, 0);
-	if (result <= 0)
-		result = 1;
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_sysctl__HW_NCPU */
-
-#ifdef posix_cpu_count_USE_mpctl__MPC_GETNUMSPUS
-	int result;
-	result = mpctl(MPC_GETNUMSPUS, NULL, NULL);
-	if unlikely(result <= 0)
-		result = 1; /* Shouldn't happen... */
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_mpctl__MPC_GETNUMSPUS */
-
-#ifdef posix_cpu_count_USE_sysconf__SC_NPROC_ONLN
-	int result;
-	result = sysconf(_SC_NPROC_ONLN);
-	if unlikely(result <= 0)
-		result = 1; /* Shouldn't happen... */
-	return DeeInt_NewUInt((unsigned int)result);
-#endif /* posix_cpu_count_USE_sysconf__SC_NPROC_ONLN */
-
-#ifdef posix_cpu_count_USE_open_AND_proc_cpuinfo
-	unsigned int result = 0;
-	DREF DeeObject *file;
-	file = DeeFile_OpenString("/proc/cpuinfo",
-	                          OPEN_FRDONLY, 0);
-	if unlikely(!file)
-		goto fallback;
-	/* Count the # of lines that begin with `processor'
-	 * The cpuinfo file contains one such line for every configured processor on the system. */
-	for (;;) {
-		PRIVATE char const str_processor[] = "processor";
-		DREF DeeBytesObject *line;
-		line = (DREF DeeBytesObject *)DeeFile_ReadLine(file, (size_t)-1, false);
-		if (!ITER_ISOK(line)) {
-			if unlikely(!line)
-				goto fallback_fp;
-			break;
-		}
-		ASSERT(DeeBytes_Check(line));
-		if (DeeBytes_SIZE(line) >= COMPILER_STRLEN(str_processor) &&
-		    bcmpc(DeeBytes_DATA(line), str_processor,
-		          COMPILER_STRLEN(str_processor), sizeof(char)) == 0)
-			++result; /* Found one! */
-		Dee_Decref(line);
-	}
-	Dee_Decref_likely(file);
-	if unlikely(!result)
-		result = 1; /* Shouldn't happen... */
-	return DeeInt_NewUInt(result);
-fallback_fp:
-	Dee_Decref_likely(file);
-fallback:
-	DeeError_Handled(Dee_ERROR_HANDLED_RESTORE);
-	return_reference(DeeInt_One);
-#endif /* posix_cpu_count_USE_open_AND_proc_cpuinfo */
-
-#ifdef posix_cpu_count_USE_STUB
-	return_reference(DeeInt_One);
-#endif /* posix_cpu_count_USE_STUB */
+	return DeeInt_NewSize(DeeSystem_GetCpuCount());
 }
 
 
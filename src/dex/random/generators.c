@@ -0,0 +1,392 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_RANDOM_GENERATORS_C
+#define GUARD_DEX_RANDOM_GENERATORS_C 1
+#define DEE_SOURCE
+
+#include "librandom.h"
+/**/
+
+#include <deemon/api.h>
+#include <deemon/error.h>
+#include <deemon/system.h>          /* DeeSystem_GetWalltime() */
+#include <deemon/system-features.h> /* exp(), log(), sqrt() */
+#include <deemon/thread.h>
+#include <deemon/util/atomic.h>
+
+#include <hybrid/__rotate.h>
+#include <hybrid/typecore.h>
+
+#ifdef CONFIG_HAVE_MATH_H
+#include <math.h>
+#endif /* CONFIG_HAVE_MATH_H */
+
+DECL_BEGIN
+
+/************************************************************************/
+/* splitmix64 (used to expand seeds)                                    */
+/************************************************************************/
+#define SPLITMIX64_GAMMA UINT64_C(0x9e3779b97f4a7c15)
+
+LOCAL ATTR_CONST uint64_t DCALL
+splitmix64_mix(uint64_t z) {
+	z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+	return z ^ (z >> 31);
+}
+
+LOCAL NONNULL((1)) uint64_t DCALL
+splitmix64_next(uint64_t *__restrict p_state) {
+	*p_state += SPLITMIX64_GAMMA;
+	return splitmix64_mix(*p_state);
+}
+
+
+
+/************************************************************************/
+/* xoshiro256** (Blackman & Vigna)                                      */
+/************************************************************************/
+FORCELOCAL NONNULL((1)) uint64_t DCALL
+xoshiro256ss_step(uint64_t s[4]) {
+	uint64_t result = __hybrid_rol64(s[1] * 5, 7) * 9;
+	uint64_t t      = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = __hybrid_rol64(s[3], 45);
+	return result;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+xoshiro256ss_seed(union drandom_state *__restrict self, uint64_t seed) {
+	self->rs_xoshiro[0] = splitmix64_next(&seed);
+	self->rs_xoshiro[1] = splitmix64_next(&seed);
+	self->rs_xoshiro[2] = splitmix64_next(&seed);
+	self->rs_xoshiro[3] = splitmix64_next(&seed);
+}
+
+PRIVATE NONNULL((1)) uint64_t DCALL
+xoshiro256ss_next(union drandom_state *__restrict self) {
+	return xoshiro256ss_step(self->rs_xoshiro);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+xoshiro256ss_fill(union drandom_state *__restrict self,
+                  uint64_t *__restrict buf, size_t count) {
+	uint64_t s[4];
+	s[0] = self->rs_xoshiro[0];
+	s[1] = self->rs_xoshiro[1];
+	s[2] = self->rs_xoshiro[2];
+	s[3] = self->rs_xoshiro[3];
+	while (count--)
+		*buf++ = xoshiro256ss_step(s);
+	self->rs_xoshiro[0] = s[0];
+	self->rs_xoshiro[1] = s[1];
+	self->rs_xoshiro[2] = s[2];
+	self->rs_xoshiro[3] = s[3];
+}
+
+PRIVATE NONNULL((1)) void DCALL
+xoshiro256ss_jump(union drandom_state *__restrict self) {
+	/* Characteristic polynomial for 2^128 steps */
+	PRIVATE uint64_t const jump_poly[4] = {
+		UINT64_C(0x180ec6d33cfd0aba), UINT64_C(0xd5a61266f0c9392c),
+		UINT64_C(0xa9582618e03fc9aa), UINT64_C(0x39abdc4529b1661c)
+	};
+	unsigned int i, b;
+	uint64_t s[4] = { 0, 0, 0, 0 };
+	for (i = 0; i < 4; ++i) {
+		for (b = 0; b < 64; ++b) {
+			if (jump_poly[i] & ((uint64_t)1 << b)) {
+				s[0] ^= self->rs_xoshiro[0];
+				s[1] ^= self->rs_xoshiro[1];
+				s[2] ^= self->rs_xoshiro[2];
+				s[3] ^= self->rs_xoshiro[3];
+			}
+			xoshiro256ss_step(self->rs_xoshiro);
+		}
+	}
+	self->rs_xoshiro[0] = s[0];
+	self->rs_xoshiro[1] = s[1];
+	self->rs_xoshiro[2] = s[2];
+	self->rs_xoshiro[3] = s[3];
+}
+
+INTERN struct drandom_algo const drandom_xoshiro256ss = {
+	/* .ra_name = */ "xoshiro256**",
+	/* .ra_seed = */ &xoshiro256ss_seed,
+	/* .ra_next = */ &xoshiro256ss_next,
+	/* .ra_fill = */ &xoshiro256ss_fill,
+	/* .ra_jump = */ &xoshiro256ss_jump
+};
+
+
+
+/************************************************************************/
+/* PCG64 (O'Neill; XSL-RR output on a 128-bit LCG)                      */
+/************************************************************************/
+#define PCG64_MULT_HI UINT64_C(0x2360ed051fc65da4)
+#define PCG64_MULT_LO UINT64_C(0x4385df649fccf645)
+#define PCG64_INC_HI  UINT64_C(0x5851f42d4c957f2d) /* Default stream of the reference implementation */
+#define PCG64_INC_LO  UINT64_C(0x14057b7ef767814f)
+
+/* Return the low 64 bits of `a * b', and store the high 64 bits in `*p_hi' */
+FORCELOCAL NONNULL((3)) uint64_t DCALL
+mul64x64(uint64_t a, uint64_t b, uint64_t *__restrict p_hi) {
+#ifdef __UINT128_TYPE__
+	__UINT128_TYPE__ r = (__UINT128_TYPE__)a * b;
+	*p_hi = (uint64_t)(r >> 64);
+	return (uint64_t)r;
+#else /* __UINT128_TYPE__ */
+	uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+	uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+	uint64_t ll = a_lo * b_lo;
+	uint64_t lh = a_lo * b_hi;
+	uint64_t hl = a_hi * b_lo;
+	uint64_t hh = a_hi * b_hi;
+	uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+	*p_hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+	return (mid << 32) | (uint32_t)ll;
+#endif /* !__UINT128_TYPE__ */
+}
+
+/* (*p_hi:*p_lo) = (*p_hi:*p_lo) * (m_hi:m_lo) + (a_hi:a_lo)   (mod 2^128) */
+FORCELOCAL NONNULL((1, 2)) void DCALL
+muladd128(uint64_t *__restrict p_lo, uint64_t *__restrict p_hi,
+          uint64_t m_lo, uint64_t m_hi, uint64_t a_lo, uint64_t a_hi) {
+	uint64_t hi, lo;
+	lo = mul64x64(*p_lo, m_lo, &hi);
+	hi += *p_lo * m_hi + *p_hi * m_lo;
+	lo += a_lo;
+	hi += a_hi + (lo < a_lo);
+	*p_lo = lo;
+	*p_hi = hi;
+}
+
+FORCELOCAL NONNULL((1)) uint64_t DCALL
+pcg64_step(uint64_t *__restrict p_lo, uint64_t *__restrict p_hi) {
+	uint64_t x;
+	unsigned int rot;
+	muladd128(p_lo, p_hi, PCG64_MULT_LO, PCG64_MULT_HI, PCG64_INC_LO, PCG64_INC_HI);
+	x   = *p_hi ^ *p_lo;
+	rot = (unsigned int)(*p_hi >> 58);
+	return (x >> rot) | (x << ((64 - rot) & 63));
+}
+
+PRIVATE NONNULL((1)) void DCALL
+pcg64_seed(union drandom_state *__restrict self, uint64_t seed) {
+	uint64_t init_lo, init_hi;
+	init_hi = splitmix64_next(&seed);
+	init_lo = splitmix64_next(&seed);
+	self->rs_pcg.p_lo = 0;
+	self->rs_pcg.p_hi = 0;
+	pcg64_step(&self->rs_pcg.p_lo, &self->rs_pcg.p_hi);
+	self->rs_pcg.p_lo += init_lo;
+	self->rs_pcg.p_hi += init_hi + (self->rs_pcg.p_lo < init_lo);
+	pcg64_step(&self->rs_pcg.p_lo, &self->rs_pcg.p_hi);
+}
+
+PRIVATE NONNULL((1)) uint64_t DCALL
+pcg64_next(union drandom_state *__restrict self) {
+	return pcg64_step(&self->rs_pcg.p_lo, &self->rs_pcg.p_hi);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+pcg64_fill(union drandom_state *__restrict self,
+           uint64_t *__restrict buf, size_t count) {
+	uint64_t lo = self->rs_pcg.p_lo;
+	uint64_t hi = self->rs_pcg.p_hi;
+	while (count--)
+		*buf++ = pcg64_step(&lo, &hi);
+	self->rs_pcg.p_lo = lo;
+	self->rs_pcg.p_hi = hi;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+pcg64_jump(union drandom_state *__restrict self) {
+	/* Advance by `delta' steps in O(log(delta)) (Brown, "Random Number
+	 * Generation with Arbitrary Stride"). `delta' is the same value as
+	 * used by numpy, which is `(golden_ratio - 1) * 2^128' */
+	uint64_t delta_lo = UINT64_C(0xf39cc0605cedc835);
+	uint64_t delta_hi = UINT64_C(0x9e3779b97f4a7c15);
+	uint64_t acc_mult_lo = 1, acc_mult_hi = 0;
+	uint64_t acc_plus_lo = 0, acc_plus_hi = 0;
+	uint64_t cur_mult_lo = PCG64_MULT_LO, cur_mult_hi = PCG64_MULT_HI;
+	uint64_t cur_plus_lo = PCG64_INC_LO, cur_plus_hi = PCG64_INC_HI;
+	while (delta_lo | delta_hi) {
+		if (delta_lo & 1) {
+			muladd128(&acc_mult_lo, &acc_mult_hi, cur_mult_lo, cur_mult_hi, 0, 0);
+			muladd128(&acc_plus_lo, &acc_plus_hi, cur_mult_lo, cur_mult_hi, cur_plus_lo, cur_plus_hi);
+		}
+		/* cur_plus = (cur_mult + 1) * cur_plus */
+		{
+			uint64_t m_lo = cur_mult_lo + 1;
+			uint64_t m_hi = cur_mult_hi + (m_lo == 0);
+			muladd128(&cur_plus_lo, &cur_plus_hi, m_lo, m_hi, 0, 0);
+		}
+		/* cur_mult = cur_mult * cur_mult */
+		{
+			uint64_t m_lo = cur_mult_lo;
+			uint64_t m_hi = cur_mult_hi;
+			muladd128(&cur_mult_lo, &cur_mult_hi, m_lo, m_hi, 0, 0);
+		}
+		delta_lo = (delta_lo >> 1) | (delta_hi << 63);
+		delta_hi >>= 1;
+	}
+	muladd128(&self->rs_pcg.p_lo, &self->rs_pcg.p_hi,
+	          acc_mult_lo, acc_mult_hi,
+	          acc_plus_lo, acc_plus_hi);
+}
+
+INTERN struct drandom_algo const drandom_pcg64 = {
+	/* .ra_name = */ "pcg64",
+	/* .ra_seed = */ &pcg64_seed,
+	/* .ra_next = */ &pcg64_next,
+	/* .ra_fill = */ &pcg64_fill,
+	/* .ra_jump = */ &pcg64_jump
+};
+
+
+
+PRIVATE struct drandom_algo const *tpconst drandom_algos[] = {
+	&drandom_xoshiro256ss,
+	&drandom_pcg64,
+};
+
+/* Compare algorithm names, ignoring casing, as well as "-" and "_" */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+drandom_algo_namecmp(char const *canon, char const *name) {
+	for (;;) {
+		char ch = *name++;
+		if (ch == '-' || ch == '_')
+			continue;
+		if (ch >= 'A' && ch <= 'Z')
+			ch += 'a' - 'A';
+		if (ch != *canon)
+			return false;
+		if (!ch)
+			break;
+		++canon;
+	}
+	return true;
+}
+
+INTERN WUNUSED NONNULL((1)) struct drandom_algo const *DCALL
+drandom_algo_find(char const *__restrict name) {
+	size_t i;
+	for (i = 0; i < COMPILER_LENOF(drandom_algos); ++i) {
+		if (drandom_algo_namecmp(drandom_algos[i]->ra_name, name))
+			return drandom_algos[i];
+	}
+	DeeError_Throwf(&DeeError_ValueError,
+	                "Unknown random number generator %q",
+	                name);
+	return NULL;
+}
+
+
+
+PRIVATE uint64_t drandom_entropy_counter = 0;
+
+INTERN WUNUSED uint64_t DCALL drandom_entropy(void) {
+	uint64_t result;
+	/* Mix the current time with a counter (so that generators created within
+	 * the same microsecond still differ), and the address of the calling thread
+	 * (so that threads started at the same time still differ) */
+	result = atomic_fetchadd(&drandom_entropy_counter, SPLITMIX64_GAMMA);
+	result ^= splitmix64_mix(DeeSystem_GetWalltime());
+	result ^= splitmix64_mix((uint64_t)(uintptr_t)DeeThread_Self());
+	return splitmix64_mix(result);
+}
+
+INTERN WUNUSED NONNULL((1)) uint64_t DCALL
+drandom_gen_below(struct drandom_gen *__restrict self, uint64_t bound) {
+	uint64_t hi, lo;
+	ASSERT(bound != 0);
+	lo = mul64x64(drandom_gen_next(self), bound, &hi);
+	if unlikely(lo < bound) {
+		uint64_t threshold = (0 - bound) % bound;
+		while (lo < threshold)
+			lo = mul64x64(drandom_gen_next(self), bound, &hi);
+	}
+	return hi;
+}
+
+
+
+#ifdef DRANDOM_HAVE_NORMAL
+/************************************************************************/
+/* Ziggurat (Marsaglia & Tsang) with 256 layers                         */
+/************************************************************************/
+#define ZIGGURAT_R 3.6541528853610088    /* Start of the tail */
+#define ZIGGURAT_V 0.00492867323399      /* Area of each layer */
+
+PRIVATE double ziggurat_x[257]; /* Right edge of each layer (x[256] == 0) */
+PRIVATE double ziggurat_f[257]; /* `exp(-x*x/2)' for every `ziggurat_x' */
+
+INTERN void DCALL drandom_normal_init(void) {
+	unsigned int i;
+	ziggurat_x[0] = ZIGGURAT_V / exp(-0.5 * ZIGGURAT_R * ZIGGURAT_R);
+	ziggurat_x[1] = ZIGGURAT_R;
+	for (i = 1; i < 255; ++i) {
+		double x = ziggurat_x[i];
+		ziggurat_x[i + 1] = sqrt(-2.0 * log(ZIGGURAT_V / x + exp(-0.5 * x * x)));
+	}
+	ziggurat_x[256] = 0.0;
+	for (i = 0; i < 256; ++i)
+		ziggurat_f[i] = exp(-0.5 * ziggurat_x[i] * ziggurat_x[i]);
+	ziggurat_f[256] = 1.0;
+}
+
+/* Uniformly distributed double in `(0, 1)' */
+#define drandom_open01(bits) (((double)((bits) >> 12) + 0.5) * (1.0 / 4503599627370496.0))
+
+INTERN WUNUSED NONNULL((1)) double DCALL
+drandom_normal(struct drandom_gen *__restrict self, uint64_t bits) {
+	for (;;) {
+		unsigned int i = (unsigned int)(bits & 0xff);
+		/* Bits [11,64) as a signed value in `[-1, 1)' */
+		double u = (double)((int64_t)bits >> 11) * (1.0 / 4503599627370496.0);
+		double x = u * ziggurat_x[i];
+		if ((x < 0.0 ? -x : x) < ziggurat_x[i + 1])
+			return x; /* Fast path: inside the layer's rectangle */
+		if (i == 0) {
+			/* Sample from the tail */
+			double tx, ty;
+			do {
+				tx = log(drandom_open01(drandom_gen_next(self))) / ZIGGURAT_R;
+				ty = log(drandom_open01(drandom_gen_next(self)));
+			} while (-2.0 * ty < tx * tx);
+			return u < 0.0 ? tx - ZIGGURAT_R : ZIGGURAT_R - tx;
+		}
+		if (ziggurat_f[i + 1] + (ziggurat_f[i] - ziggurat_f[i + 1]) *
+		                        drandom_uniform(drandom_gen_next(self)) <
+		    exp(-0.5 * x * x))
+			return x;
+		bits = drandom_gen_next(self);
+	}
+}
+#endif /* DRANDOM_HAVE_NORMAL */
+
+DECL_END
+
+#endif /* !GUARD_DEX_RANDOM_GENERATORS_C */
@@ -0,0 +1,761 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_RANDOM_LIBRANDOM_C
+#define GUARD_DEX_RANDOM_LIBRANDOM_C 1
+#define DEE_SOURCE
+
+#include "librandom.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/bytes.h>
+#include <deemon/dex.h>
+#include <deemon/error.h>
+#include <deemon/float.h>
+#include <deemon/gc.h>
+#include <deemon/int.h>
+#include <deemon/list.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* memcpy() */
+
+#include <hybrid/byteswap.h>
+
+DECL_BEGIN
+
+/* Number of values generated at once by bulk operations. */
+#define DRANDOM_BLOCK 128
+
+
+#ifdef DRANDOM_CURRENT_IS_THREADLOCAL
+PRIVATE ATTR_THREAD bool drandom_current_didinit = false;
+PRIVATE ATTR_THREAD struct drandom_gen drandom_current_tls;
+
+INTERN WUNUSED ATTR_RETNONNULL struct drandom_gen *DCALL
+drandom_current_gen(void) {
+	struct drandom_gen *result = &drandom_current_tls;
+	if unlikely(!drandom_current_didinit) {
+		result->rg_algo = &drandom_xoshiro256ss;
+		drandom_gen_seed(result, drandom_entropy());
+		drandom_current_didinit = true;
+	}
+	return result;
+}
+#endif /* DRANDOM_CURRENT_IS_THREADLOCAL */
+
+
+PRIVATE DEFINE_KWLIST(random_kwlist, { K(seed), K(algorithm), KEND });
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+random_init_kw(DeeRandomObject *__restrict self, size_t argc,
+               DeeObject *const *argv, DeeObject *kw) {
+	DeeObject *seed = Dee_None;
+	char const *algorithm = NULL;
+	uint64_t seed_value;
+	if (DeeArg_UnpackKw(argc, argv, kw, random_kwlist, "|os:Random", &seed, &algorithm))
+		goto err;
+	self->r_gen.rg_algo = &drandom_xoshiro256ss;
+	if (algorithm) {
+		self->r_gen.rg_algo = drandom_algo_find(algorithm);
+		if unlikely(!self->r_gen.rg_algo)
+			goto err;
+	}
+	if (DeeNone_Check(seed)) {
+		seed_value = drandom_entropy();
+	} else {
+		if (DeeObject_Get64Bit(seed, (int64_t *)&seed_value) < 0)
+			goto err;
+	}
+	drandom_gen_seed(&self->r_gen, seed_value);
+	Dee_atomic_lock_init(&self->r_lock);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+random_copy(DeeRandomObject *__restrict self,
+            DeeRandomObject *__restrict other) {
+	struct drandom_gen *gen = DeeRandom_Acquire(other);
+	memcpy(&self->r_gen, gen, sizeof(struct drandom_gen));
+	DeeRandom_Release(other);
+	Dee_atomic_lock_init(&self->r_lock);
+	return 0;
+}
+
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_rand32(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t result;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, ":rand32"))
+		goto err;
+	gen    = DeeRandom_Acquire(self);
+	result = drandom_gen_next(gen);
+	DeeRandom_Release(self);
+	return DeeInt_NewUInt32((uint32_t)(result >> 32));
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_rand64(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t result;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, ":rand64"))
+		goto err;
+	gen    = DeeRandom_Acquire(self);
+	result = drandom_gen_next(gen);
+	DeeRandom_Release(self);
+	return DeeInt_NewUInt64(result);
+err:
+	return NULL;
+}
+
+/* Parse the `[begin,]end' arguments of `randint()' and `randints()'
+ * @return: 0:  Success (`*p_begin' and `*p_span' were filled in)
+ * @return: -1: Error */
+PRIVATE WUNUSED NONNULL((3, 4)) int DCALL
+random_parse_range(DeeObject *begin, DeeObject *end,
+                   int64_t *__restrict p_begin,
+                   uint64_t *__restrict p_span) {
+	int64_t end_value;
+	*p_begin = 0;
+	if (begin && DeeObject_AsInt64(begin, p_begin))
+		goto err;
+	if (DeeObject_AsInt64(end, &end_value))
+		goto err;
+	if unlikely(end_value <= *p_begin) {
+		DeeError_Throwf(&DeeError_ValueError,
+		                "Empty range [%" PRFd64 ", %" PRFd64 ")",
+		                *p_begin, end_value);
+		goto err;
+	}
+	*p_span = (uint64_t)end_value - (uint64_t)*p_begin;
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_randint(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	int64_t begin;
+	uint64_t span, result;
+	DeeObject *arg1, *arg2 = NULL;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, "o|o:randint", &arg1, &arg2))
+		goto err;
+	if (arg2 ? random_parse_range(arg1, arg2, &begin, &span)
+	         : random_parse_range(NULL, arg1, &begin, &span))
+		goto err;
+	gen    = DeeRandom_Acquire(self);
+	result = drandom_gen_below(gen, span);
+	DeeRandom_Release(self);
+	return DeeInt_NewInt64((int64_t)((uint64_t)begin + result));
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_onein(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t n, result;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, UNPu64 ":onein", &n))
+		goto err;
+	if unlikely(!n) {
+		DeeError_Throwf(&DeeError_ValueError, "onein(0) is undefined");
+		goto err;
+	}
+	gen    = DeeRandom_Acquire(self);
+	result = drandom_gen_below(gen, n);
+	DeeRandom_Release(self);
+	return_bool(result == 0);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_uniform(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t bits;
+	double begin = 0.0, end = 1.0;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, "|DD:uniform", &begin, &end))
+		goto err;
+	gen  = DeeRandom_Acquire(self);
+	bits = drandom_gen_next(gen);
+	DeeRandom_Release(self);
+	return DeeFloat_New(begin + (end - begin) * drandom_uniform(bits));
+err:
+	return NULL;
+}
+
+#ifdef DRANDOM_HAVE_NORMAL
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_normal(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	double result, mean = 0.0, stddev = 1.0;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, "|DD:normal", &mean, &stddev))
+		goto err;
+	gen    = DeeRandom_Acquire(self);
+	result = drandom_normal(gen, drandom_gen_next(gen));
+	DeeRandom_Release(self);
+	return DeeFloat_New(mean + stddev * result);
+err:
+	return NULL;
+}
+#endif /* DRANDOM_HAVE_NORMAL */
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_bytes(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t count;
+	uint8_t *dst;
+	struct drandom_gen *gen;
+	DREF DeeObject *result;
+	uint64_t block[DRANDOM_BLOCK];
+	if (DeeArg_Unpack(argc, argv, UNPuSIZ ":bytes", &count))
+		goto err;
+	result = DeeBytes_NewBufferUninitialized(count);
+	if unlikely(!result)
+		goto err;
+	dst = DeeBytes_DATA(result);
+	gen = DeeRandom_Acquire(self);
+	while (count) {
+		size_t i, n_words, n_bytes;
+		n_words = (count + 7) / 8;
+		if (n_words > DRANDOM_BLOCK)
+			n_words = DRANDOM_BLOCK;
+		drandom_gen_fill(gen, block, n_words);
+		/* Always produce the same byte-sequence, regardless of host endian */
+		for (i = 0; i < n_words; ++i)
+			block[i] = HTOLE64(block[i]);
+		n_bytes = n_words * 8;
+		if (n_bytes > count)
+			n_bytes = count;
+		memcpy(dst, block, n_bytes);
+		dst += n_bytes;
+		count -= n_bytes;
+	}
+	DeeRandom_Release(self);
+	return result;
+err:
+	return NULL;
+}
+
+
+#define RANDOM_LIST_RAND64  0 /* randints(count) */
+#define RANDOM_LIST_RANDINT 1 /* randints(count, [begin,] end) */
+#define RANDOM_LIST_UNIFORM 2 /* uniforms(count, begin, end) */
+#define RANDOM_LIST_NORMAL  3 /* normals(count, mean, stddev) */
+
+union random_list_args {
+	struct {
+		int64_t  begin;
+		uint64_t span;
+	}      rla_int;
+	struct {
+		double offset; /* begin / mean */
+		double scale;  /* (end - begin) / stddev */
+	}      rla_float;
+};
+
+/* Generate a list of `count' random values of the given `kind'. Values are
+ * generated in blocks of `DRANDOM_BLOCK', such that the generator is only
+ * locked once per block, and the tight loops producing raw bits and turning
+ * them into floats can be inlined and vectorized by the compiler. */
+PRIVATE WUNUSED NONNULL((1, 4)) DREF DeeObject *DCALL
+random_newlist(DeeRandomObject *self, size_t count, unsigned int kind,
+               union random_list_args const *__restrict args) {
+	size_t i, done = 0;
+	DREF DeeListObject *result;
+	uint64_t bits[DRANDOM_BLOCK];
+	double values[DRANDOM_BLOCK];
+	result = DeeList_NewUninitialized(count);
+	if unlikely(!result)
+		goto err;
+	while (done < count) {
+		struct drandom_gen *gen;
+		size_t n = count - done;
+		if (n > DRANDOM_BLOCK)
+			n = DRANDOM_BLOCK;
+		gen = DeeRandom_Acquire(self);
+		switch (kind) {
+
+		case RANDOM_LIST_RANDINT:
+			for (i = 0; i < n; ++i)
+				bits[i] = (uint64_t)args->rla_int.begin + drandom_gen_below(gen, args->rla_int.span);
+			break;
+
+		case RANDOM_LIST_UNIFORM:
+			drandom_gen_fill(gen, bits, n);
+			for (i = 0; i < n; ++i)
+				values[i] = args->rla_float.offset + args->rla_float.scale * drandom_uniform(bits[i]);
+			break;
+
+#ifdef DRANDOM_HAVE_NORMAL
+		case RANDOM_LIST_NORMAL:
+			drandom_gen_fill(gen, bits, n);
+			for (i = 0; i < n; ++i)
+				values[i] = args->rla_float.offset + args->rla_float.scale * drandom_normal(gen, bits[i]);
+			break;
+#endif /* DRANDOM_HAVE_NORMAL */
+
+		default:
+			drandom_gen_fill(gen, bits, n);
+			break;
+		}
+		DeeRandom_Release(self);
+
+		/* Wrap the generated values in objects */
+		for (i = 0; i < n; ++i) {
+			DREF DeeObject *elem;
+			switch (kind) {
+			case RANDOM_LIST_RAND64:
+				elem = DeeInt_NewUInt64(bits[i]);
+				break;
+			case RANDOM_LIST_RANDINT:
+				elem = DeeInt_NewInt64((int64_t)bits[i]);
+				break;
+			default:
+				elem = DeeFloat_New(values[i]);
+				break;
+			}
+			if unlikely(!elem)
+				goto err_r;
+			DeeList_SET(result, done, elem); /* Inherit reference */
+			++done;
+		}
+	}
+	DeeGC_Track((DeeObject *)result);
+	return (DREF DeeObject *)result;
+err_r:
+	Dee_Decrefv(DeeList_ELEM(result), done);
+	DeeList_FreeUninitialized(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_randints(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t count;
+	DeeObject *arg1 = NULL, *arg2 = NULL;
+	union random_list_args args;
+	if (DeeArg_Unpack(argc, argv, UNPuSIZ "|oo:randints", &count, &arg1, &arg2))
+		goto err;
+	if (!arg1)
+		return random_newlist(self, count, RANDOM_LIST_RAND64, &args);
+	if (arg2 ? random_parse_range(arg1, arg2, &args.rla_int.begin, &args.rla_int.span)
+	         : random_parse_range(NULL, arg1, &args.rla_int.begin, &args.rla_int.span))
+		goto err;
+	return random_newlist(self, count, RANDOM_LIST_RANDINT, &args);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_uniforms(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t count;
+	double begin = 0.0, end = 1.0;
+	union random_list_args args;
+	if (DeeArg_Unpack(argc, argv, UNPuSIZ "|DD:uniforms", &count, &begin, &end))
+		goto err;
+	args.rla_float.offset = begin;
+	args.rla_float.scale  = end - begin;
+	return random_newlist(self, count, RANDOM_LIST_UNIFORM, &args);
+err:
+	return NULL;
+}
+
+#ifdef DRANDOM_HAVE_NORMAL
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_normals(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t count;
+	double mean = 0.0, stddev = 1.0;
+	union random_list_args args;
+	if (DeeArg_Unpack(argc, argv, UNPuSIZ "|DD:normals", &count, &mean, &stddev))
+		goto err;
+	args.rla_float.offset = mean;
+	args.rla_float.scale  = stddev;
+	return random_newlist(self, count, RANDOM_LIST_NORMAL, &args);
+err:
+	return NULL;
+}
+#endif /* DRANDOM_HAVE_NORMAL */
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_jump(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t count = 1;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, "|" UNPuSIZ ":jump", &count))
+		goto err;
+	gen = DeeRandom_Acquire(self);
+	while (count--)
+		(*gen->rg_algo->ra_jump)(&gen->rg_state);
+	DeeRandom_Release(self);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_spawn(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	size_t i, count;
+	DREF DeeListObject *result;
+	if (DeeArg_Unpack(argc, argv, UNPuSIZ ":spawn", &count))
+		goto err;
+	result = DeeList_NewUninitialized(count);
+	if unlikely(!result)
+		goto err;
+	for (i = 0; i < count; ++i) {
+		struct drandom_gen *gen;
+		DREF DeeRandomObject *child;
+		child = DeeObject_MALLOC(DeeRandomObject);
+		if unlikely(!child)
+			goto err_r_i;
+		DeeObject_Init(child, &DeeRandom_Type);
+		Dee_atomic_lock_init(&child->r_lock);
+		gen = DeeRandom_Acquire(self);
+		memcpy(&child->r_gen, gen, sizeof(struct drandom_gen));
+		(*gen->rg_algo->ra_jump)(&gen->rg_state);
+		DeeRandom_Release(self);
+		DeeList_SET(result, i, (DeeObject *)child); /* Inherit reference */
+	}
+	DeeGC_Track((DeeObject *)result);
+	return (DREF DeeObject *)result;
+err_r_i:
+	Dee_Decrefv(DeeList_ELEM(result), i);
+	DeeList_FreeUninitialized(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_randomize(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	uint64_t seed;
+	struct drandom_gen *gen;
+	if (DeeArg_Unpack(argc, argv, ":randomize"))
+		goto err;
+	seed = drandom_entropy();
+	gen  = DeeRandom_Acquire(self);
+	drandom_gen_seed(gen, seed);
+	DeeRandom_Release(self);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+random_next_impl(DeeRandomObject *self, DeeTypeObject *type) {
+	uint64_t bits;
+	struct drandom_gen *gen;
+	if unlikely(type != &DeeInt_Type &&
+	            type != &DeeFloat_Type &&
+	            type != &DeeBool_Type)
+		goto err_type;
+	gen  = DeeRandom_Acquire(self);
+	bits = drandom_gen_next(gen);
+	DeeRandom_Release(self);
+	if (type == &DeeInt_Type)
+		return DeeInt_NewUInt32((uint32_t)(bits >> 32));
+	if (type == &DeeFloat_Type)
+		return DeeFloat_New(drandom_uniform(bits));
+	return_bool((bits >> 63) != 0);
+err_type:
+	DeeError_Throwf(&DeeError_TypeError,
+	                "Cannot generate random data of type %k",
+	                type);
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_next(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	DeeTypeObject *type;
+	if (DeeArg_Unpack(argc, argv, "o:next", &type))
+		goto err;
+	if (DeeObject_AssertType(type, &DeeType_Type))
+		goto err;
+	return random_next_impl(self, type);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_call(DeeRandomObject *self, size_t argc, DeeObject *const *argv) {
+	DeeTypeObject *type;
+	if (DeeArg_Unpack(argc, argv, "o:Random", &type))
+		goto err;
+	if (DeeObject_AssertType(type, &DeeType_Type))
+		goto err;
+	return random_next_impl(self, type);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_getseed(DeeRandomObject *__restrict self) {
+	uint64_t seed;
+	struct drandom_gen *gen;
+	gen  = DeeRandom_Acquire(self);
+	seed = gen->rg_seed;
+	DeeRandom_Release(self);
+	return DeeInt_NewUInt64(seed);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+random_setseed(DeeRandomObject *self, DeeObject *value) {
+	uint64_t seed;
+	struct drandom_gen *gen;
+	if (DeeObject_Get64Bit(value, (int64_t *)&seed) < 0)
+		goto err;
+	gen = DeeRandom_Acquire(self);
+	drandom_gen_seed(gen, seed);
+	DeeRandom_Release(self);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_getalgorithm(DeeRandomObject *__restrict self) {
+	char const *name;
+	struct drandom_gen *gen;
+	gen  = DeeRandom_Acquire(self);
+	name = gen->rg_algo->ra_name;
+	DeeRandom_Release(self);
+	return DeeString_New(name);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+random_class_getcurrent(DeeObject *__restrict UNUSED(self)) {
+	return_reference_((DeeObject *)&DeeRandom_Current);
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+random_class_thread_local(DeeObject *UNUSED(self),
+                          size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":thread_local"))
+		goto err;
+	return_reference_((DeeObject *)&DeeRandom_Current);
+err:
+	return NULL;
+}
+
+PRIVATE struct type_method tpconst random_methods[] = {
+	TYPE_METHOD("rand32", &random_rand32,
+	            "->?Dint\n"
+	            "Return a 32-bit unsigned integer populated entirely with pseudo-random bits"),
+	TYPE_METHOD("rand64", &random_rand64,
+	            "->?Dint\n"
+	            "Return a 64-bit unsigned integer populated entirely with pseudo-random bits"),
+	TYPE_METHOD("randint", &random_randint,
+	            "(end:?Dint)->?Dint\n"
+	            "(begin:?Dint,end:?Dint)->?Dint\n"
+	            "#tValueError{@end isn't greater than @begin}"
+	            "Return a uniformly distributed integer in ${[begin, end)} "
+	            /**/ "(where @begin defaults to $0), without any modulo bias"),
+	TYPE_METHOD("onein", &random_onein,
+	            "(n:?Dint)->?Dbool\n"
+	            "#tValueError{@n is $0}"
+	            "Return ?t for (on average) every one in @n calls"),
+	TYPE_METHOD("uniform", &random_uniform,
+	            "(begin=!0.0,end=!1.0)->?Dfloat\n"
+	            "Return a uniformly distributed float in ${[begin, end)}"),
+#ifdef DRANDOM_HAVE_NORMAL
+	TYPE_METHOD("normal", &random_normal,
+	            "(mean=!0.0,stddev=!1.0)->?Dfloat\n"
+	            "Return a normally distributed float"),
+#endif /* DRANDOM_HAVE_NORMAL */
+	TYPE_METHOD("bytes", &random_bytes,
+	            "(count:?Dint)->?DBytes\n"
+	            "Return @count random bytes. The bytes produced are the same "
+	            /**/ "as the little-endian representations of ?#rand64 results"),
+	TYPE_METHOD("randints", &random_randints,
+	            "(count:?Dint)->?S?Dint\n"
+	            "(count:?Dint,end:?Dint)->?S?Dint\n"
+	            "(count:?Dint,begin:?Dint,end:?Dint)->?S?Dint\n"
+	            "Return a ?DList of @count integers, as produced by ?#rand64 "
+	            /**/ "(when no range is given) or ?#randint"),
+	TYPE_METHOD("uniforms", &random_uniforms,
+	            "(count:?Dint,begin=!0.0,end=!1.0)->?S?Dfloat\n"
+	            "Return a ?DList of @count floats, as produced by ?#uniform"),
+#ifdef DRANDOM_HAVE_NORMAL
+	TYPE_METHOD("normals", &random_normals,
+	            "(count:?Dint,mean=!0.0,stddev=!1.0)->?S?Dfloat\n"
+	            "Return a ?DList of @count floats, as produced by ?#normal"),
+#endif /* DRANDOM_HAVE_NORMAL */
+	TYPE_METHOD("jump", &random_jump,
+	            "(count=!1)\n"
+	            "Advance the generator @count times by a huge number of steps "
+	            /**/ "($2^128 for $\"xoshiro256**\"), such that the values produced "
+	            /**/ "from here on don't overlap with those that would have been "
+	            /**/ "produced before the jump (s.a. ?#spawn)"),
+	TYPE_METHOD("spawn", &random_spawn,
+	            "(count:?Dint)->?S?.\n"
+	            "Return a ?DList of @count generators for use by parallel workers. "
+	            /**/ "Every generator is a copy of @this one, after which @this one is "
+	            /**/ "?#jump'd, meaning that all of them produce non-overlapping "
+	            /**/ "sequences of values"),
+	TYPE_METHOD("randomize", &random_randomize,
+	            "()\n"
+	            "Re-seed the generator with an unpredictable value"),
+	TYPE_METHOD("next", &random_next,
+	            "(T:?DType)->?O\n"
+	            "#tTypeError{Random values of type @T can't be generated}"
+	            "Generate a random value of type @T, which may be ?Dint "
+	            /**/ "(same as ?#rand32), ?Dfloat (same as ?#uniform), or ?Dbool"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst random_getsets[] = {
+	TYPE_GETSET("seed", &random_getseed, NULL, &random_setseed,
+	            "->?Dint\n"
+	            "The seed most recently used to initialize the generator. "
+	            /**/ "Assigning a value re-seeds the generator"),
+	TYPE_GETTER("algorithm", &random_getalgorithm,
+	            "->?Dstring\n"
+	            "The (canonical) name of the algorithm used by the generator"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_method tpconst random_class_methods[] = {
+	TYPE_METHOD("thread_local", &random_class_thread_local,
+	            "->?.\n"
+	            "Deprecated alias for ?#current"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst random_class_getsets[] = {
+	TYPE_GETTER("current", &random_class_getcurrent,
+	            "->?.\n"
+	            "A lazily seeded generator that is local to the calling thread. "
+	            /**/ "The same object is returned in every thread, but every thread "
+	            /**/ "that uses it operates on its own, independent ${\"xoshiro256**\"} "
+	            /**/ "state, meaning that no locking is needed"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeRandom_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Random",
+	/* .tp_doc      = */ DOC("A pseudo-random number generator. Supported algorithms "
+	                         /**/ "are $\"xoshiro256**\" (the default) and $\"pcg64\". "
+	                         /**/ "Neither is suitable for cryptographic purposes\n"
+	                         "${"
+	                         /**/ "import Random from random;\n"
+	                         /**/ "local r = Random(42);\n"
+	                         /**/ "print r.randint(1, 7);  /* Roll a die */\n"
+	                         /**/ "print r.normals(10);    /* 10 normally distributed samples */"
+	                         "}\n"
+	                         "\n"
+	                         "(seed?:?Dint,algorithm=!P{xoshiro256**})\n"
+	                         "#tValueError{Unknown @algorithm}"
+	                         "#tIntegerOverflow{@seed doesn't fit into 64 bits}"
+	                         "Construct a new generator. When no @seed (or ?N) is given, "
+	                         /**/ "an unpredictable seed is used\n"
+	                         "\n"
+	                         "copy->\n"
+	                         "Duplicate the generator's state, such that the copy "
+	                         /**/ "produces the same values as @this one\n"
+	                         "\n"
+	                         "call(T:?DType)->?O\n"
+	                         "Alias for ?#next"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)&random_copy,
+				/* .tp_deep_ctor = */ (dfunptr_t)&random_copy,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeRandomObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&random_init_kw
+			}
+		},
+		/* .tp_dtor        = */ NULL,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str  = */ NULL,
+		/* .tp_repr = */ NULL,
+		/* .tp_bool = */ NULL
+	},
+	/* .tp_call          = */ (DREF DeeObject *(DCALL *)(DeeObject *, size_t, DeeObject *const *))&random_call,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ random_methods,
+	/* .tp_getsets       = */ random_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ random_class_methods,
+	/* .tp_class_getsets = */ random_class_getsets,
+	/* .tp_class_members = */ NULL
+};
+
+INTERN DeeRandomObject DeeRandom_Current = {
+	OBJECT_HEAD_INIT(&DeeRandom_Type),
+	/* .r_lock = */ DEE_ATOMIC_LOCK_INIT,
+	/* .r_gen  = */ {
+		/* .rg_algo  = */ &drandom_xoshiro256ss,
+		/* .rg_seed  = */ 0,
+		/* .rg_state = */ { { 0, 0, 0, 0 } }
+	}
+};
+
+
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+librandom_init(DeeDexObject *__restrict UNUSED(self)) {
+#ifdef DRANDOM_HAVE_NORMAL
+	drandom_normal_init();
+#endif /* DRANDOM_HAVE_NORMAL */
+#ifndef DRANDOM_CURRENT_IS_THREADLOCAL
+	drandom_gen_seed(&DeeRandom_Current.r_gen, drandom_entropy());
+#endif /* !DRANDOM_CURRENT_IS_THREADLOCAL */
+	return 0;
+}
+
+PRIVATE struct dex_symbol symbols[] = {
+	{ "Random", (DeeObject *)&DeeRandom_Type, MODSYM_FNORMAL },
+	{ NULL }
+};
+
+PUBLIC struct dex DEX = {
+	/* .d_symbols = */ symbols,
+	/* .d_init    = */ &librandom_init,
+	/* .d_fini    = */ NULL,
+	/* .d_imports = */ { NULL }
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_RANDOM_LIBRANDOM_C */
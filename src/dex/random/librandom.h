@@ -0,0 +1,150 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_RANDOM_LIBRANDOM_H
+#define GUARD_DEX_RANDOM_LIBRANDOM_H 1
+
+#include <deemon/api.h>
+#include <deemon/dex.h>
+#include <deemon/object.h>
+#include <deemon/system-features.h>
+#include <deemon/util/lock.h>
+
+#include <hybrid/compiler.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+DECL_BEGIN
+
+/* Generator state (large enough for every supported algorithm) */
+union drandom_state {
+	uint64_t rs_xoshiro[4]; /* xoshiro256** */
+	struct {
+		uint64_t p_lo;      /* Low 64 bits of the 128-bit LCG state */
+		uint64_t p_hi;      /* High 64 bits of the 128-bit LCG state */
+	}        rs_pcg;        /* PCG64 (XSL-RR 128/64, default stream) */
+};
+
+struct drandom_algo {
+	char const *ra_name; /* Canonical algorithm name (e.g. "xoshiro256**") */
+	/* Initialize `self' from `seed' (the seed is expanded using splitmix64) */
+	NONNULL((1)) void (DCALL *ra_seed)(union drandom_state *__restrict self, uint64_t seed);
+	/* Return the next 64 random bits. */
+	NONNULL((1)) uint64_t (DCALL *ra_next)(union drandom_state *__restrict self);
+	/* Same as calling `ra_next()' `count' times, storing the results in `buf' */
+	NONNULL((1, 2)) void (DCALL *ra_fill)(union drandom_state *__restrict self,
+	                                      uint64_t *__restrict buf, size_t count);
+	/* Advance the generator to the start of the next non-overlapping sub-sequence:
+	 *  - xoshiro256**: 2^128 steps (period: 2^256-1)
+	 *  - PCG64:        ~0.618 * 2^128 steps (compatible with numpy's `PCG64.jumped()') */
+	NONNULL((1)) void (DCALL *ra_jump)(union drandom_state *__restrict self);
+};
+
+INTDEF struct drandom_algo const drandom_xoshiro256ss;
+INTDEF struct drandom_algo const drandom_pcg64;
+
+/* Lookup a generator algorithm by name (case-insensitive, ignoring "-" and "_").
+ * @return: NULL: Unknown algorithm (an error was thrown) */
+INTDEF WUNUSED NONNULL((1)) struct drandom_algo const *DCALL
+drandom_algo_find(char const *__restrict name);
+
+/* A seeded generator. */
+struct drandom_gen {
+	struct drandom_algo const *rg_algo;  /* [1..1] Algorithm used by this generator */
+	uint64_t                   rg_seed;  /* The seed most recently passed to `rg_algo->ra_seed' */
+	union drandom_state        rg_state; /* Generator state */
+};
+
+#define drandom_gen_seed(self, seed) \
+	((self)->rg_seed = (seed), (*(self)->rg_algo->ra_seed)(&(self)->rg_state, (self)->rg_seed))
+#define drandom_gen_next(self) \
+	(*(self)->rg_algo->ra_next)(&(self)->rg_state)
+#define drandom_gen_fill(self, buf, count) \
+	(*(self)->rg_algo->ra_fill)(&(self)->rg_state, buf, count)
+
+/* Return a new, unpredictable seed */
+INTDEF WUNUSED uint64_t DCALL drandom_entropy(void);
+
+/* Return a uniformly distributed integer in `[0, bound)' (`bound' must not be 0)
+ * Uses Lemire's multiply-shift method, meaning that there is no modulo bias. */
+INTDEF WUNUSED NONNULL((1)) uint64_t DCALL
+drandom_gen_below(struct drandom_gen *__restrict self, uint64_t bound);
+
+/* Convert 64 random bits into a uniformly distributed double in `[0, 1)' */
+#define drandom_uniform(bits) ((double)((bits) >> 11) * (1.0 / 9007199254740992.0))
+
+#define DRANDOM_HAVE_NORMAL
+#if !defined(CONFIG_HAVE_exp) || !defined(CONFIG_HAVE_log) || !defined(CONFIG_HAVE_sqrt)
+#undef DRANDOM_HAVE_NORMAL
+#endif /* !CONFIG_HAVE_exp || !CONFIG_HAVE_log || !CONFIG_HAVE_sqrt */
+
+#ifdef DRANDOM_HAVE_NORMAL
+/* Build the ziggurat tables used by `drandom_normal()' */
+INTDEF void DCALL drandom_normal_init(void);
+
+/* Return a standard-normal distributed double (mean: 0, stddev: 1),
+ * using a 256-layer ziggurat. `bits' are the first 64 random bits to
+ * use, and are enough to produce a result ~99% of the time. Anything
+ * else is taken from `self'. */
+INTDEF WUNUSED NONNULL((1)) double DCALL
+drandom_normal(struct drandom_gen *__restrict self, uint64_t bits);
+#endif /* DRANDOM_HAVE_NORMAL */
+
+
+
+typedef struct {
+	OBJECT_HEAD
+	Dee_atomic_lock_t  r_lock; /* Lock for `r_gen' */
+	struct drandom_gen r_gen;  /* [lock(r_lock)] The underlying generator */
+} DeeRandomObject;
+
+INTDEF DeeTypeObject DeeRandom_Type;
+
+/* The object returned by `Random.current'. When `DRANDOM_CURRENT_IS_THREADLOCAL'
+ * is defined, this is a proxy for a per-thread generator that lives in native
+ * thread-local storage: every thread that uses it (lazily) gets its own randomly
+ * seeded xoshiro256** generator, without any locking or TLS-object lookups.
+ * Otherwise, it's just a regular (shared) generator. */
+INTDEF DeeRandomObject DeeRandom_Current;
+
+#undef DRANDOM_CURRENT_IS_THREADLOCAL
+#if !defined(CONFIG_NO_THREADS) && !defined(__NO_ATTR_THREAD)
+#define DRANDOM_CURRENT_IS_THREADLOCAL
+#endif /* !CONFIG_NO_THREADS && !__NO_ATTR_THREAD */
+
+#ifdef DRANDOM_CURRENT_IS_THREADLOCAL
+/* Return the calling thread's generator (seeding it on first use) */
+INTDEF WUNUSED ATTR_RETNONNULL struct drandom_gen *DCALL drandom_current_gen(void);
+
+#define DeeRandom_Acquire(self)                \
+	((self) == &DeeRandom_Current              \
+	 ? drandom_current_gen()                   \
+	 : (Dee_atomic_lock_acquire(&(self)->r_lock), &(self)->r_gen))
+#define DeeRandom_Release(self)                \
+	((self) == &DeeRandom_Current              \
+	 ? (void)0                                 \
+	 : Dee_atomic_lock_release(&(self)->r_lock))
+#else /* DRANDOM_CURRENT_IS_THREADLOCAL */
+#define DeeRandom_Acquire(self) (Dee_atomic_lock_acquire(&(self)->r_lock), &(self)->r_gen)
+#define DeeRandom_Release(self) Dee_atomic_lock_release(&(self)->r_lock)
+#endif /* !DRANDOM_CURRENT_IS_THREADLOCAL */
+
+DECL_END
+
+#endif /* !GUARD_DEX_RANDOM_LIBRANDOM_H */
@@ -205,7 +205,7 @@ LOCAL WUNUSED DREF DeeObject *DCALL
 librt_get_TypeBasesIterator_impl_f(void) {
 	return get_iterator_of(librt_get_TypeBases_impl_f());
 }
-
+
 PRIVATE WUNUSED DREF DeeObject *DCALL
 librt_get_ClassOperatorTable_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
 	return librt_get_ClassOperatorTable_impl_f();
@@ -240,17 +240,17 @@ PRIVATE WUNUSED DREF DeeObject *DCALL
 librt_get_TypeMRO_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
 	return librt_get_TypeMRO_impl_f();
 }
-
+
 PRIVATE WUNUSED DREF DeeObject *DCALL
 librt_get_TypeMROIterator_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
 	return librt_get_TypeMROIterator_impl_f();
 }
-
+
 PRIVATE WUNUSED DREF DeeObject *DCALL
 librt_get_TypeBases_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
 	return librt_get_TypeBases_impl_f();
 }
-
+
 PRIVATE WUNUSED DREF DeeObject *DCALL
 librt_get_TypeBasesIterator_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
 	return librt_get_TypeBasesIterator_impl_f();
@@ -922,6 +922,11 @@ librt_get_SeqRepeatIterator_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv
 	return get_iterator_of(librt_get_SeqRepeat_impl_f());
 }
 
+PRIVATE WUNUSED DREF DeeObject *DCALL
+librt_get_SeqParallel_f(size_t UNUSED(argc), DeeObject *const *UNUSED(argv)) {
+	return get_type_of(DeeObject_CallAttrString(Dee_EmptySeq, "parallel", 0, NULL));
+}
+
 LOCAL WUNUSED DREF DeeObject *DCALL
 librt_get_SeqItemRepeat_impl_f(void) {
 	DeeObject *argv[] = { Dee_None, DeeInt_One };
@@ -1751,6 +1756,7 @@ PRIVATE DEFINE_CMETHOD(librt_get_SeqIntRange, &librt_get_SeqIntRange_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqIntRangeIterator, &librt_get_SeqIntRangeIterator_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqRepeat, &librt_get_SeqRepeat_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqRepeatIterator, &librt_get_SeqRepeatIterator_f);
+PRIVATE DEFINE_CMETHOD(librt_get_SeqParallel, &librt_get_SeqParallel_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqItemRepeat, &librt_get_SeqItemRepeat_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqItemRepeatIterator, &librt_get_SeqItemRepeatIterator_f);
 PRIVATE DEFINE_CMETHOD(librt_get_SeqIds, &librt_get_SeqIds_f);
@@ -2015,6 +2021,7 @@ PRIVATE struct dex_symbol symbols[] = {
 	{ "SeqIntRangeIterator", (DeeObject *)&librt_get_SeqIntRangeIterator, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                     /* SeqIntRangeIterator_Type */
 	{ "SeqRepeat", (DeeObject *)&librt_get_SeqRepeat, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                                         /* SeqRepeat_Type */
 	{ "SeqRepeatIterator", (DeeObject *)&librt_get_SeqRepeatIterator, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                         /* SeqRepeatIterator_Type */
+	{ "SeqParallel", (DeeObject *)&librt_get_SeqParallel, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                                     /* SeqParallel_Type */
 	{ "SeqItemRepeat", (DeeObject *)&librt_get_SeqItemRepeat, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                                 /* SeqItemRepeat_Type */
 	{ "SeqItemRepeatIterator", (DeeObject *)&librt_get_SeqItemRepeatIterator, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                 /* SeqItemRepeatIterator_Type */
 	{ "SeqIds", (DeeObject *)&librt_get_SeqIds, MODSYM_FREADONLY | MODSYM_FPROPERTY | MODSYM_FCONSTEXPR },                                               /* SeqIds_Type */
@@ -0,0 +1,997 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_THREADING_AIO_C
+#define GUARD_DEX_THREADING_AIO_C 1
+#define CONFIG_BUILDING_LIBTHREADING
+#define DEE_SOURCE
+
+#include "libthreading.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bytes.h>
+#include <deemon/dex.h>
+#include <deemon/error.h>
+#include <deemon/file.h>
+#include <deemon/filetypes.h>
+#include <deemon/int.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/objmethod.h>
+#include <deemon/seq.h>
+#include <deemon/string.h>
+#include <deemon/system-features.h> /* memset() */
+#include <deemon/system.h>
+#include <deemon/thread.h>
+#include <deemon/tuple.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/lock.h>
+
+/* Figure out if we can use io_uring(7) */
+#ifdef CONFIG_NO_IO_URING
+#undef CONFIG_HAVE_IO_URING
+#elif !defined(CONFIG_HAVE_IO_URING) && !defined(CONFIG_NO_THREADS) && \
+      defined(__linux__) && defined(DEESYSTEM_FILE_USE_UNIX) && defined(__has_include)
+#if (__has_include(<linux/io_uring.h>) && __has_include(<sys/mman.h>) && \
+     __has_include(<sys/syscall.h>) && __has_include(<sys/uio.h>))
+#define CONFIG_HAVE_IO_URING
+#endif /* __has_include(...) */
+#endif /* ... */
+
+#ifdef CONFIG_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if (!defined(SYS_io_uring_setup) || !defined(SYS_io_uring_enter) || \
+     !defined(IORING_OFF_SQ_RING) || !defined(IORING_ENTER_GETEVENTS))
+#undef CONFIG_HAVE_IO_URING
+#endif /* !SYS_io_uring_setup || ... */
+#endif /* CONFIG_HAVE_IO_URING */
+
+DECL_BEGIN
+
+/* Asynchronous, positional file I/O.
+ *
+ * Every operation immediately returns a pending ?GFuture. When the file is
+ * a system file and io_uring(7) is available, operations are placed in the
+ * submission queue of a ring that is owned by the `AsyncIO' object, and any
+ * number of operations submitted together only cost a single system call.
+ * Completions are reaped by a reaper thread that only runs for as long as
+ * operations are in flight (it holds a reference to the `AsyncIO' object,
+ * such that the ring can't go away while the kernel is still using it).
+ *
+ * Everything else (non-system files, hosts without io_uring, or a full ring)
+ * is executed by a ?GThreadPool using the regular `DeeFile_PRead()' and
+ * `DeeFile_PWrite()' functions. */
+
+#ifdef CONFIG_HAVE_IO_URING
+/* Max # of bytes transferred by a single operation (the kernel's `MAX_RW_COUNT') */
+#define AIO_MAXCOUNT 0x7ffff000
+
+struct aio_ring {
+	int                  r_fd;        /* [const] The io_uring file descriptor (or `-1' if not available) */
+	unsigned int         r_sqentries; /* [const] # of submission queue entries */
+	unsigned int         r_cqentries; /* [const] # of completion queue entries */
+	void                *r_sqmap;     /* [1..r_sqmapsize][const][owned] Submission queue ring mapping */
+	size_t               r_sqmapsize; /* [const] Size of `r_sqmap' */
+	void                *r_cqmap;     /* [1..r_cqmapsize][const][owned_if(!= r_sqmap)] Completion queue ring mapping */
+	size_t               r_cqmapsize; /* [const] Size of `r_cqmap' */
+	struct io_uring_sqe *r_sqes;      /* [1..r_sqentries][const][owned] Submission queue entries */
+	unsigned int        *r_sqhead;    /* [1..1][const] Submission queue head (written by the kernel) */
+	unsigned int        *r_sqtail;    /* [1..1][const] Submission queue tail (written by us) */
+	unsigned int         r_sqmask;    /* [const] Submission queue index mask */
+	unsigned int        *r_sqarray;   /* [1..r_sqentries][const] Submission queue index array */
+	unsigned int        *r_cqhead;    /* [1..1][const] Completion queue head (written by us) */
+	unsigned int        *r_cqtail;    /* [1..1][const] Completion queue tail (written by the kernel) */
+	unsigned int         r_cqmask;    /* [const] Completion queue index mask */
+	struct io_uring_cqe *r_cqes;      /* [1..r_cqentries][const] Completion queue entries */
+};
+
+#define sys_io_uring_setup(entries, p) \
+	(int)syscall(SYS_io_uring_setup, (unsigned int)(entries), p)
+#define sys_io_uring_enter(fd, to_submit, min_complete, flags) \
+	(int)syscall(SYS_io_uring_enter, fd, (unsigned int)(to_submit), (unsigned int)(min_complete), flags, NULL, 0)
+
+/* Try to initialize `self' as a ring with (at least) `entries' entries.
+ * Upon failure, `self->r_fd' is set to `-1' (no error is thrown) */
+PRIVATE NONNULL((1)) void DCALL
+aio_ring_init(struct aio_ring *__restrict self, unsigned int entries) {
+	struct io_uring_params params;
+	char *sqmap, *cqmap;
+	bzero(&params, sizeof(params));
+	self->r_fd = sys_io_uring_setup(entries, &params);
+	if (self->r_fd < 0)
+		goto fail;
+	self->r_sqentries = params.sq_entries;
+	self->r_cqentries = params.cq_entries;
+	self->r_sqmapsize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	self->r_cqmapsize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		if (self->r_sqmapsize < self->r_cqmapsize)
+			self->r_sqmapsize = self->r_cqmapsize;
+		self->r_cqmapsize = self->r_sqmapsize;
+	}
+#endif /* IORING_FEAT_SINGLE_MMAP */
+	sqmap = (char *)mmap(NULL, self->r_sqmapsize, PROT_READ | PROT_WRITE,
+	                     MAP_SHARED | MAP_POPULATE, self->r_fd, IORING_OFF_SQ_RING);
+	if (sqmap == (char *)MAP_FAILED)
+		goto fail_fd;
+	cqmap = sqmap;
+#ifdef IORING_FEAT_SINGLE_MMAP
+	if (!(params.features & IORING_FEAT_SINGLE_MMAP))
+#endif /* IORING_FEAT_SINGLE_MMAP */
+	{
+		cqmap = (char *)mmap(NULL, self->r_cqmapsize, PROT_READ | PROT_WRITE,
+		                     MAP_SHARED | MAP_POPULATE, self->r_fd, IORING_OFF_CQ_RING);
+		if (cqmap == (char *)MAP_FAILED)
+			goto fail_sqmap;
+	}
+	self->r_sqes = (struct io_uring_sqe *)mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe),
+	                                           PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+	                                           self->r_fd, IORING_OFF_SQES);
+	if (self->r_sqes == (struct io_uring_sqe *)MAP_FAILED)
+		goto fail_cqmap;
+	self->r_sqmap   = sqmap;
+	self->r_cqmap   = cqmap;
+	self->r_sqhead  = (unsigned int *)(sqmap + params.sq_off.head);
+	self->r_sqtail  = (unsigned int *)(sqmap + params.sq_off.tail);
+	self->r_sqmask  = *(unsigned int *)(sqmap + params.sq_off.ring_mask);
+	self->r_sqarray = (unsigned int *)(sqmap + params.sq_off.array);
+	self->r_cqhead  = (unsigned int *)(cqmap + params.cq_off.head);
+	self->r_cqtail  = (unsigned int *)(cqmap + params.cq_off.tail);
+	self->r_cqmask  = *(unsigned int *)(cqmap + params.cq_off.ring_mask);
+	self->r_cqes    = (struct io_uring_cqe *)(cqmap + params.cq_off.cqes);
+	return;
+fail_cqmap:
+	if (cqmap != sqmap)
+		(void)munmap(cqmap, self->r_cqmapsize);
+fail_sqmap:
+	(void)munmap(sqmap, self->r_sqmapsize);
+fail_fd:
+	(void)close(self->r_fd);
+	self->r_fd = -1;
+fail:
+	/* io_uring is unavailable (e.g. `ENOSYS' on old kernels, or
+	 * `EPERM' when blocked by a seccomp filter): use the fallback. */
+	return;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+aio_ring_fini(struct aio_ring *__restrict self) {
+	if (self->r_fd < 0)
+		return;
+	(void)munmap(self->r_sqes, self->r_sqentries * sizeof(struct io_uring_sqe));
+	if (self->r_cqmap != self->r_sqmap)
+		(void)munmap(self->r_cqmap, self->r_cqmapsize);
+	(void)munmap(self->r_sqmap, self->r_sqmapsize);
+	(void)close(self->r_fd);
+}
+
+/* An operation that was submitted to the ring. */
+struct aio_op {
+	DREF DeeObject *ao_future; /* [1..1] The future completed by this operation. */
+	DREF DeeObject *ao_file;   /* [1..1] The file being accessed. */
+	DREF DeeObject *ao_data;   /* [1..1] Reads: the Bytes object being filled; Writes: the source of data. */
+	DeeBuffer       ao_buffer; /* [valid_if(ao_write)] Buffer view of `ao_data' */
+	struct iovec    ao_iov;    /* I/O vector referenced by the SQE */
+	Dee_pos_t       ao_pos;    /* File position to access */
+	bool            ao_write;  /* True if this is a write-operation */
+};
+#endif /* CONFIG_HAVE_IO_URING */
+
+typedef struct {
+	OBJECT_HEAD
+	DREF DeeObject   *aio_executor; /* [0..1][lock(aio_lock && WRITE_ONCE)] ThreadPool used for the fallback. */
+	Dee_atomic_lock_t aio_lock;     /* Lock for lazily allocating `aio_executor' and submitting to `aio_ring' */
+#ifdef CONFIG_HAVE_IO_URING
+	struct aio_ring   aio_ring;     /* [const] The io_uring of this object. */
+	size_t            aio_inflight; /* [lock(aio_lock)] # of submitted operations that haven't been reaped, yet. */
+	bool              aio_reaping;  /* [lock(aio_lock)] Set while a reaper thread is running. */
+#endif /* CONFIG_HAVE_IO_URING */
+} DeeAsyncIOObject;
+
+#define DeeAsyncIO_LockAcquire(self) Dee_atomic_lock_acquire(&(self)->aio_lock)
+#define DeeAsyncIO_LockRelease(self) Dee_atomic_lock_release(&(self)->aio_lock)
+
+/* A single request, as passed to `aio_dosubmit()' */
+struct aio_request {
+	DeeObject *ar_file; /* [1..1] The file to access */
+	DeeObject *ar_data; /* [0..1] Data to write (NULL for reads) */
+	Dee_pos_t  ar_pos;  /* File position to access */
+	size_t     ar_size; /* [valid_if(!ar_data)] # of bytes to read */
+};
+
+
+
+/************************************************************************/
+/* Fallback (thread pool)                                               */
+/************************************************************************/
+
+/* (future:?GFuture, file:?DFile, pos:?Dint, maxbytes:?Dint) */
+PRIVATE WUNUSED DREF DeeObject *DCALL
+aio_fallback_pread_f(size_t argc, DeeObject *const *argv) {
+	DeeObject *future, *file;
+	DREF DeeObject *result;
+	Dee_pos_t pos;
+	size_t maxbytes, count;
+	if (DeeArg_Unpack(argc, argv, "oo" UNPdN(DEE_SIZEOF_DEE_POS_T) UNPuSIZ ":pread",
+	                  &future, &file, &pos, &maxbytes))
+		goto err;
+	result = DeeBytes_NewBufferUninitialized(maxbytes);
+	if unlikely(!result)
+		goto err_future;
+	count = DeeFile_PRead(file, DeeBytes_DATA(result), maxbytes, pos);
+	if unlikely(count == (size_t)-1) {
+		Dee_Decref(result);
+		goto err_future;
+	}
+	DeeFuture_Resolve(future, DeeBytes_TruncateBuffer(result, count));
+	return_none;
+err_future:
+	DeeFuture_RejectCurrent(future);
+	return_none;
+err:
+	return NULL;
+}
+
+/* (future:?GFuture, file:?DFile, data:?DBytes, pos:?Dint) */
+PRIVATE WUNUSED DREF DeeObject *DCALL
+aio_fallback_pwrite_f(size_t argc, DeeObject *const *argv) {
+	DeeObject *future, *file, *data;
+	DREF DeeObject *result;
+	DeeBuffer buffer;
+	Dee_pos_t pos;
+	size_t count;
+	if (DeeArg_Unpack(argc, argv, "ooo" UNPdN(DEE_SIZEOF_DEE_POS_T) ":pwrite",
+	                  &future, &file, &data, &pos))
+		goto err;
+	if (DeeObject_GetBuf(data, &buffer, Dee_BUFFER_FREADONLY))
+		goto err_future;
+	count = DeeFile_PWrite(file, buffer.bb_base, buffer.bb_size, pos);
+	DeeObject_PutBuf(data, &buffer, Dee_BUFFER_FREADONLY);
+	if unlikely(count == (size_t)-1)
+		goto err_future;
+	result = DeeInt_NewSize(count);
+	if unlikely(!result)
+		goto err_future;
+	DeeFuture_Resolve(future, result);
+	return_none;
+err_future:
+	DeeFuture_RejectCurrent(future);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE DEFINE_CMETHOD(aio_fallback_pread, &aio_fallback_pread_f);
+PRIVATE DEFINE_CMETHOD(aio_fallback_pwrite, &aio_fallback_pwrite_f);
+
+/* Return (a reference to) the thread pool of `self', lazily allocating it. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_getexecutor(DeeAsyncIOObject *__restrict self) {
+	DREF DeeObject *result;
+	DeeAsyncIO_LockAcquire(self);
+	result = self->aio_executor;
+	if (result) {
+		Dee_Incref(result);
+		DeeAsyncIO_LockRelease(self);
+		return result;
+	}
+	DeeAsyncIO_LockRelease(self);
+	result = DeeObject_NewDefault(&DeeThreadPool_Type);
+	if unlikely(!result)
+		goto err;
+	DeeAsyncIO_LockAcquire(self);
+	if unlikely(self->aio_executor) {
+		/* Another thread was faster. */
+		DREF DeeObject *existing = self->aio_executor;
+		Dee_Incref(existing);
+		DeeAsyncIO_LockRelease(self);
+		Dee_Decref(result);
+		return existing;
+	}
+	Dee_Incref(result);
+	self->aio_executor = result;
+	DeeAsyncIO_LockRelease(self);
+	return result;
+err:
+	return NULL;
+}
+
+/* Execute `req' using the thread pool of `self', completing `future' */
+PRIVATE WUNUSED NONNULL((1, 2, 3)) int DCALL
+aio_fallback(DeeAsyncIOObject *self, struct aio_request const *req,
+             DeeObject *future) {
+	DREF DeeObject *executor, *pos_ob, *temp;
+	DeeObject *argv[5];
+	executor = aio_getexecutor(self);
+	if unlikely(!executor)
+		goto err;
+	pos_ob = DeeInt_NewUInt64((uint64_t)req->ar_pos);
+	if unlikely(!pos_ob)
+		goto err_executor;
+	argv[1] = future;
+	argv[2] = req->ar_file;
+	if (req->ar_data) {
+		argv[0] = (DeeObject *)&aio_fallback_pwrite;
+		argv[3] = req->ar_data;
+		argv[4] = pos_ob;
+		temp    = DeeObject_CallAttrString(executor, "submit", 5, argv);
+	} else {
+		argv[0] = (DeeObject *)&aio_fallback_pread;
+		argv[3] = pos_ob;
+		argv[4] = DeeInt_NewSize(req->ar_size);
+		if unlikely(!argv[4])
+			goto err_executor_pos;
+		temp = DeeObject_CallAttrString(executor, "submit", 5, argv);
+		Dee_Decref(argv[4]);
+	}
+	Dee_Decref(pos_ob);
+	Dee_Decref(executor);
+	if unlikely(!temp)
+		goto err;
+	Dee_Decref(temp); /* The thread pool's own future (we're completing `future' ourselves) */
+	return 0;
+err_executor_pos:
+	Dee_Decref(pos_ob);
+err_executor:
+	Dee_Decref(executor);
+err:
+	return -1;
+}
+
+
+
+/************************************************************************/
+/* io_uring                                                             */
+/************************************************************************/
+#ifdef CONFIG_HAVE_IO_URING
+
+/* Allocate a new operation for `req' (returns NULL if `req' can't use the ring)
+ * @return: ITER_DONE: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2)) struct aio_op *DCALL
+aio_op_new(struct aio_request const *req, DeeObject *future) {
+	struct aio_op *result;
+	int fd;
+	if (!DeeSystemFile_Check(req->ar_file))
+		return NULL;
+	fd = (int)DeeSystemFile_GetHandle(req->ar_file);
+	if (fd < 0)
+		return NULL; /* Closed (let the fallback throw the error) */
+	result = (struct aio_op *)Dee_Malloc(sizeof(struct aio_op));
+	if unlikely(!result)
+		goto err;
+	result->ao_write = req->ar_data != NULL;
+	if (result->ao_write) {
+		if (DeeObject_GetBuf(req->ar_data, &result->ao_buffer, Dee_BUFFER_FREADONLY))
+			goto err_r;
+		if (result->ao_buffer.bb_size > AIO_MAXCOUNT) {
+			DeeObject_PutBuf(req->ar_data, &result->ao_buffer, Dee_BUFFER_FREADONLY);
+			Dee_Free(result);
+			return NULL;
+		}
+		result->ao_data = req->ar_data;
+		Dee_Incref(result->ao_data);
+		result->ao_iov.iov_base = result->ao_buffer.bb_base;
+		result->ao_iov.iov_len  = result->ao_buffer.bb_size;
+	} else {
+		if (req->ar_size > AIO_MAXCOUNT) {
+			Dee_Free(result);
+			return NULL;
+		}
+		result->ao_data = DeeBytes_NewBufferUninitialized(req->ar_size);
+		if unlikely(!result->ao_data)
+			goto err_r;
+		result->ao_iov.iov_base = DeeBytes_DATA(result->ao_data);
+		result->ao_iov.iov_len  = req->ar_size;
+	}
+	result->ao_pos    = req->ar_pos;
+	result->ao_future = future;
+	result->ao_file   = req->ar_file;
+	Dee_Incref(future);
+	Dee_Incref(req->ar_file);
+	return result;
+err_r:
+	Dee_Free(result);
+err:
+	return (struct aio_op *)ITER_DONE;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+aio_op_destroy(struct aio_op *__restrict self) {
+	if (self->ao_write)
+		DeeObject_PutBuf(self->ao_data, &self->ao_buffer, Dee_BUFFER_FREADONLY);
+	Dee_XDecref(self->ao_data);
+	Dee_Decref(self->ao_file);
+	Dee_Decref(self->ao_future);
+	Dee_Free(self);
+}
+
+/* Complete `self' with the result `res' of its CQE, then destroy it. */
+PRIVATE NONNULL((1)) void DCALL
+aio_op_complete(struct aio_op *__restrict self, int res) {
+	DREF DeeObject *result;
+	if unlikely(res < 0) {
+		DeeUnixSystem_ThrowErrorf(&DeeError_FSError, -res,
+		                          "Failed to %s %r",
+		                          self->ao_write ? "write to" : "read from",
+		                          self->ao_file);
+		goto err;
+	}
+	if (self->ao_write) {
+		result = DeeInt_NewUInt((unsigned int)res);
+		if unlikely(!result)
+			goto err;
+	} else {
+		result = DeeBytes_TruncateBuffer(self->ao_data, (size_t)(unsigned int)res);
+		self->ao_data = NULL;
+	}
+	DeeFuture_Resolve(self->ao_future, result);
+	aio_op_destroy(self);
+	return;
+err:
+	DeeFuture_RejectCurrent(self->ao_future);
+	aio_op_destroy(self);
+}
+
+/* Reap completions until there are no more operations in flight. */
+PRIVATE NONNULL((1)) void DCALL
+aio_reap(DeeAsyncIOObject *__restrict self) {
+	struct aio_ring *ring = &self->aio_ring;
+	for (;;) {
+		unsigned int head = *ring->r_cqhead;
+		unsigned int tail = atomic_read(ring->r_cqtail);
+		size_t count;
+		if (head == tail) {
+			DeeAsyncIO_LockAcquire(self);
+			if (self->aio_inflight == 0) {
+				self->aio_reaping = false;
+				DeeAsyncIO_LockRelease(self);
+				break;
+			}
+			DeeAsyncIO_LockRelease(self);
+			/* NOTE: Interrupts are ignored here: the reaper must not stop while
+			 *       the kernel is still using memory of pending operations (it
+			 *       stops on its own as soon as all of them have completed). */
+			(void)sys_io_uring_enter(ring->r_fd, 0, 1, IORING_ENTER_GETEVENTS);
+			continue;
+		}
+		for (count = 0; head != tail; ++head, ++count) {
+			struct io_uring_cqe *cqe = &ring->r_cqes[head & ring->r_cqmask];
+			struct aio_op *op = (struct aio_op *)(uintptr_t)cqe->user_data;
+			int res = cqe->res;
+			atomic_write(ring->r_cqhead, head + 1);
+			aio_op_complete(op, res);
+		}
+		DeeAsyncIO_LockAcquire(self);
+		self->aio_inflight -= count;
+		DeeAsyncIO_LockRelease(self);
+	}
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+aio_reaper_main_f(size_t argc, DeeObject *const *argv) {
+	ASSERT(argc == 1);
+	(void)argc;
+	aio_reap((DeeAsyncIOObject *)argv[0]);
+	return_none;
+}
+
+PRIVATE DEFINE_CMETHOD(aio_reaper_main, &aio_reaper_main_f);
+PRIVATE DEFINE_STRING(aio_reaper_name, "AsyncIO");
+
+/* Start a reaper thread for `self'. If that isn't possible,
+ * completions are reaped by the calling thread instead. */
+PRIVATE NONNULL((1)) void DCALL
+aio_startreaper(DeeAsyncIOObject *__restrict self) {
+	DREF DeeObject *thread, *args;
+	DeeObject *argv[3];
+	args = DeeTuple_Pack(1, self);
+	if unlikely(!args)
+		goto err;
+	argv[0] = (DeeObject *)&aio_reaper_name;
+	argv[1] = (DeeObject *)&aio_reaper_main;
+	argv[2] = args;
+	thread = DeeObject_New(&DeeThread_Type, 3, argv);
+	Dee_Decref(args);
+	if unlikely(!thread)
+		goto err;
+	if unlikely(DeeThread_Start(thread) < 0)
+		goto err_thread;
+	if unlikely(DeeThread_Detach(thread) < 0) {
+		Dee_Decref(thread);
+		DeeError_Handled(ERROR_HANDLED_RESTORE);
+		return; /* The thread is running (that's all we need) */
+	}
+	Dee_Decref(thread);
+	return;
+err_thread:
+	Dee_Decref(thread);
+err:
+	DeeError_Handled(ERROR_HANDLED_RESTORE);
+	aio_reap(self);
+}
+
+/* Submit `opv[0..opc-1]' to the ring of `self'
+ * @return: * : The # of leading operations that were submitted (and are now owned by the ring). */
+PRIVATE WUNUSED NONNULL((1)) size_t DCALL
+aio_ring_submit(DeeAsyncIOObject *__restrict self,
+                struct aio_op **opv, size_t opc) {
+	struct aio_ring *ring = &self->aio_ring;
+	unsigned int tail, avail;
+	size_t i;
+	int status;
+	bool startreaper;
+	DeeAsyncIO_LockAcquire(self);
+
+	/* Never have more operations in flight than there are CQEs, such
+	 * that completions can't be dropped (or cause `EBUSY') on any kernel. */
+	avail = ring->r_sqentries - (*ring->r_sqtail - atomic_read(ring->r_sqhead));
+	if ((size_t)avail > ring->r_cqentries - self->aio_inflight)
+		avail = (unsigned int)(ring->r_cqentries - self->aio_inflight);
+	if ((size_t)avail > opc)
+		avail = (unsigned int)opc;
+	if unlikely(!avail) {
+		DeeAsyncIO_LockRelease(self);
+		return 0;
+	}
+	tail = *ring->r_sqtail;
+	for (i = 0; i < avail; ++i) {
+		struct aio_op *op = opv[i];
+		unsigned int index = (tail + (unsigned int)i) & ring->r_sqmask;
+		struct io_uring_sqe *sqe = &ring->r_sqes[index];
+		bzero(sqe, sizeof(*sqe));
+		sqe->opcode    = op->ao_write ? IORING_OP_WRITEV : IORING_OP_READV;
+		sqe->fd        = (int)DeeSystemFile_GetHandle(op->ao_file);
+		sqe->addr      = (uint64_t)(uintptr_t)&op->ao_iov;
+		sqe->len       = 1;
+		sqe->off       = (uint64_t)op->ao_pos;
+		sqe->user_data = (uint64_t)(uintptr_t)op;
+		ring->r_sqarray[index] = index;
+	}
+	atomic_write(ring->r_sqtail, tail + avail);
+	status = sys_io_uring_enter(ring->r_fd, avail, 0, 0);
+	if unlikely(status < 0)
+		status = 0;
+	if unlikely((unsigned int)status < avail) {
+		/* Take back entries not consumed by the kernel (for the fallback).
+		 * The kernel only reads our tail during `io_uring_enter()', and we're
+		 * the only ones to call it for submitting, so this is safe. */
+		atomic_write(ring->r_sqtail, tail + (unsigned int)status);
+	}
+	self->aio_inflight += (unsigned int)status;
+	startreaper = status != 0 && !self->aio_reaping;
+	if (startreaper)
+		self->aio_reaping = true;
+	DeeAsyncIO_LockRelease(self);
+	if (startreaper) {
+		Dee_Incref(self); /* Keep `self' alive during `aio_startreaper()' (it may reap inline) */
+		aio_startreaper(self);
+		Dee_Decref(self);
+	}
+	return (size_t)(unsigned int)status;
+}
+#endif /* CONFIG_HAVE_IO_URING */
+
+
+
+/************************************************************************/
+/* AsyncIO                                                              */
+/************************************************************************/
+
+/* Submit `reqv[0..reqc-1]', storing a new, pending future for each request
+ * in `resultv[0..reqc-1]'. All requests that can use the ring of `self' are
+ * submitted using as few system calls as possible.
+ * @return: 0 : Success.
+ * @return: -1: An error was thrown. */
+PRIVATE WUNUSED NONNULL((1, 2, 4)) int DCALL
+aio_dosubmit(DeeAsyncIOObject *__restrict self,
+             struct aio_request const *reqv, size_t reqc,
+             /*out*/ DREF DeeObject **resultv) {
+	size_t i;
+	for (i = 0; i < reqc; ++i) {
+		resultv[i] = DeeFuture_NewPending();
+		if unlikely(!resultv[i])
+			goto err_resultv_i;
+	}
+#ifdef CONFIG_HAVE_IO_URING
+	if (self->aio_ring.r_fd >= 0) {
+		struct aio_op **opv;
+		size_t opc = 0, done = 0;
+		opv = (struct aio_op **)Dee_Mallocac(reqc, sizeof(struct aio_op *));
+		if unlikely(!opv)
+			goto err_resultv;
+		for (i = 0; i < reqc; ++i) {
+			struct aio_op *op = aio_op_new(&reqv[i], resultv[i]);
+			if (op == NULL) {
+				if unlikely(aio_fallback(self, &reqv[i], resultv[i]))
+					goto err_opv;
+			} else if unlikely(op == (struct aio_op *)ITER_DONE) {
+				goto err_opv;
+			} else {
+				opv[opc++] = op;
+			}
+		}
+		while (done < opc) {
+			size_t count = aio_ring_submit(self, opv + done, opc - done);
+			if (!count)
+				break; /* The ring is full */
+			done += count;
+		}
+
+		/* Operations that didn't fit into the ring are handled by the thread pool. */
+		for (; done < opc; ++done) {
+			struct aio_op *op = opv[done];
+			struct aio_request req;
+			int status;
+			req.ar_file = op->ao_file;
+			req.ar_data = op->ao_write ? op->ao_data : NULL;
+			req.ar_pos  = op->ao_pos;
+			req.ar_size = op->ao_iov.iov_len;
+			status = aio_fallback(self, &req, op->ao_future);
+			aio_op_destroy(op);
+			if unlikely(status) {
+				++done;
+				goto err_opv;
+			}
+		}
+		Dee_Freea(opv);
+		return 0;
+err_opv:
+		for (; done < opc; ++done)
+			aio_op_destroy(opv[done]);
+		Dee_Freea(opv);
+		goto err_resultv;
+	}
+#endif /* CONFIG_HAVE_IO_URING */
+	for (i = 0; i < reqc; ++i) {
+		if unlikely(aio_fallback(self, &reqv[i], resultv[i]))
+			goto err_resultv;
+	}
+	return 0;
+err_resultv:
+	i = reqc;
+err_resultv_i:
+	Dee_Decrefv(resultv, i);
+	return -1;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+aio_submitone(DeeAsyncIOObject *__restrict self,
+              struct aio_request const *__restrict req) {
+	DREF DeeObject *result;
+	if unlikely(aio_dosubmit(self, req, 1, &result))
+		goto err;
+	return result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_pread(DeeAsyncIOObject *self, size_t argc, DeeObject *const *argv) {
+	struct aio_request req;
+	req.ar_data = NULL;
+	if (DeeArg_Unpack(argc, argv, "o" UNPdN(DEE_SIZEOF_DEE_POS_T) UNPuSIZ ":pread",
+	                  &req.ar_file, &req.ar_pos, &req.ar_size))
+		goto err;
+	return aio_submitone(self, &req);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_pwrite(DeeAsyncIOObject *self, size_t argc, DeeObject *const *argv) {
+	struct aio_request req;
+	if (DeeArg_Unpack(argc, argv, "oo" UNPdN(DEE_SIZEOF_DEE_POS_T) ":pwrite",
+	                  &req.ar_file, &req.ar_data, &req.ar_pos))
+		goto err;
+	req.ar_size = 0;
+	return aio_submitone(self, &req);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_submit(DeeAsyncIOObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *ops_ob;
+	DREF DeeObject *ops, *result;
+	DREF DeeObject **refv; /* [2 * count] The file and data/size of every operation */
+	struct aio_request *reqv;
+	size_t i, count;
+	if (DeeArg_Unpack(argc, argv, "o:submit", &ops_ob))
+		goto err;
+	ops = DeeTuple_FromSequence(ops_ob);
+	if unlikely(!ops)
+		goto err;
+	count = DeeTuple_SIZE(ops);
+	reqv  = (struct aio_request *)Dee_Mallocac(count, sizeof(struct aio_request));
+	if unlikely(!reqv)
+		goto err_ops;
+	refv = (DREF DeeObject **)Dee_Mallocac(count * 2, sizeof(DREF DeeObject *));
+	if unlikely(!refv)
+		goto err_ops_reqv;
+	for (i = 0; i < count; ++i) {
+		DREF DeeObject *elem[3];
+		struct aio_request *req = &reqv[i];
+		uint64_t pos;
+		if (DeeObject_Unpack(DeeTuple_GET(ops, i), 3, elem))
+			goto err_ops_reqv_refv_i;
+		if (DeeObject_AsUInt64(elem[1], &pos))
+			goto err_ops_reqv_refv_i_elem;
+		req->ar_file = elem[0];
+		req->ar_pos  = (Dee_pos_t)pos;
+		req->ar_data = NULL;
+		req->ar_size = 0;
+		if (DeeInt_Check(elem[2])) {
+			if (DeeObject_AsSize(elem[2], &req->ar_size))
+				goto err_ops_reqv_refv_i_elem;
+		} else {
+			req->ar_data = elem[2];
+		}
+		Dee_Decref(elem[1]);
+		refv[i * 2 + 0] = elem[0];
+		refv[i * 2 + 1] = elem[2];
+		continue;
+err_ops_reqv_refv_i_elem:
+		Dee_Decrefv(elem, 3);
+		goto err_ops_reqv_refv_i;
+	}
+	result = (DREF DeeObject *)DeeTuple_NewUninitialized(count);
+	if unlikely(!result)
+		goto err_ops_reqv_refv_i;
+	if unlikely(aio_dosubmit(self, reqv, count, DeeTuple_ELEM(result))) {
+		DeeTuple_FreeUninitialized((DREF DeeTupleObject *)result);
+		goto err_ops_reqv_refv_i;
+	}
+	Dee_Decrefv(refv, count * 2);
+	Dee_Freea(refv);
+	Dee_Freea(reqv);
+	Dee_Decref(ops);
+	return result;
+err_ops_reqv_refv_i:
+	Dee_Decrefv(refv, i * 2);
+	Dee_Freea(refv);
+err_ops_reqv:
+	Dee_Freea(reqv);
+err_ops:
+	Dee_Decref(ops);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_backend_get(DeeAsyncIOObject *__restrict self) {
+#ifdef CONFIG_HAVE_IO_URING
+	if (self->aio_ring.r_fd >= 0)
+		return DeeString_New("io_uring");
+#endif /* CONFIG_HAVE_IO_URING */
+	(void)self;
+	return DeeString_New("threadpool");
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+aio_executor_get(DeeAsyncIOObject *__restrict self) {
+	return aio_getexecutor(self);
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+aio_init_kw(DeeAsyncIOObject *__restrict self, size_t argc,
+            DeeObject *const *argv, DeeObject *kw) {
+	PRIVATE DEFINE_KWLIST(aio_kwlist, { K(entries), K(executor), K(uring), KEND });
+	size_t entries      = 256;
+	DeeObject *executor = Dee_None;
+	bool uring          = true;
+	if (DeeArg_UnpackKw(argc, argv, kw, aio_kwlist, "|" UNPuSIZ "ob:AsyncIO",
+	                    &entries, &executor, &uring))
+		goto err;
+	if (DeeNone_Check(executor)) {
+		executor = NULL;
+	} else if (DeeObject_AssertType(executor, &DeeThreadPool_Type)) {
+		goto err;
+	}
+	if unlikely(!entries) {
+		DeeError_Throwf(&DeeError_ValueError, "AsyncIO requires at least 1 entry");
+		goto err;
+	}
+	self->aio_executor = executor;
+	Dee_XIncref(executor);
+	Dee_atomic_lock_init(&self->aio_lock);
+#ifdef CONFIG_HAVE_IO_URING
+	self->aio_inflight = 0;
+	self->aio_reaping  = false;
+	self->aio_ring.r_fd = -1;
+	if (uring)
+		aio_ring_init(&self->aio_ring, entries > 4096 ? 4096 : (unsigned int)entries);
+#else /* CONFIG_HAVE_IO_URING */
+	(void)uring;
+#endif /* !CONFIG_HAVE_IO_URING */
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+aio_fini(DeeAsyncIOObject *__restrict self) {
+#ifdef CONFIG_HAVE_IO_URING
+	ASSERT(self->aio_inflight == 0);
+	aio_ring_fini(&self->aio_ring);
+#endif /* CONFIG_HAVE_IO_URING */
+	Dee_XDecref(self->aio_executor);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+aio_visit(DeeAsyncIOObject *__restrict self, dvisit_t proc, void *arg) {
+	DeeAsyncIO_LockAcquire(self);
+	Dee_XVisit(self->aio_executor);
+	DeeAsyncIO_LockRelease(self);
+}
+
+
+/* The default AsyncIO instance (s.a. `AsyncIO.default') */
+PRIVATE DREF DeeAsyncIOObject *aio_default = NULL;
+PRIVATE Dee_atomic_lock_t aio_default_lock = DEE_ATOMIC_LOCK_INIT;
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+aio_default_get(DeeObject *__restrict UNUSED(self)) {
+	DREF DeeAsyncIOObject *result;
+	Dee_atomic_lock_acquire(&aio_default_lock);
+	result = aio_default;
+	if (result) {
+		Dee_Incref(result);
+		Dee_atomic_lock_release(&aio_default_lock);
+		return (DREF DeeObject *)result;
+	}
+	Dee_atomic_lock_release(&aio_default_lock);
+	result = (DREF DeeAsyncIOObject *)DeeObject_NewDefault(&DeeAsyncIO_Type);
+	if unlikely(!result)
+		goto err;
+	Dee_atomic_lock_acquire(&aio_default_lock);
+	if unlikely(aio_default) {
+		DREF DeeAsyncIOObject *existing = aio_default;
+		Dee_Incref(existing);
+		Dee_atomic_lock_release(&aio_default_lock);
+		Dee_Decref(result);
+		return (DREF DeeObject *)existing;
+	}
+	Dee_Incref(result);
+	aio_default = result;
+	Dee_atomic_lock_release(&aio_default_lock);
+	return (DREF DeeObject *)result;
+err:
+	return NULL;
+}
+
+/* Clear the default AsyncIO instance (called by `libthreading_clear()' / `libthreading_fini()') */
+INTERN bool DCALL libthreading_aio_clear(void) {
+	DREF DeeAsyncIOObject *old;
+	Dee_atomic_lock_acquire(&aio_default_lock);
+	old = aio_default;
+	aio_default = NULL;
+	Dee_atomic_lock_release(&aio_default_lock);
+	if (!old)
+		return false;
+	Dee_Decref(old);
+	return true;
+}
+
+
+PRIVATE struct type_method tpconst aio_methods[] = {
+	TYPE_METHOD("pread", &aio_pread,
+	            "(file:?DFile,pos:?Dint,maxbytes:?Dint)->?GFuture\n"
+	            "Start reading up to @maxbytes bytes from @file at @pos. Returns a ?GFuture "
+	            /**/ "for the ?DBytes that were read (which are shorter than @maxbytes when "
+	            /**/ "the end of @file was reached, or when the read was only partially completed)"),
+	TYPE_METHOD("pwrite", &aio_pwrite,
+	            "(file:?DFile,data:?DBytes,pos:?Dint)->?GFuture\n"
+	            "Start writing @data to @file at @pos. Returns a ?GFuture for the "
+	            /**/ "number of bytes that were written"),
+	TYPE_METHOD("submit", &aio_submit,
+	            "(ops:?S?T3?DFile?Dint?X2?Dint?DBytes)->?S?GFuture\n"
+	            "Start a batch of operations, each given as ${(file, pos, maxbytes)} for a "
+	            /**/ "read (see ?#pread), or ${(file, pos, data)} for a write (see ?#pwrite), "
+	            /**/ "and return a ?GFuture for each of them. When using io_uring, the whole "
+	            /**/ "batch is submitted to the kernel using a single system call"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst aio_getsets[] = {
+	TYPE_GETTER("backend", &aio_backend_get,
+	            "->?Dstring\n"
+	            "Either $\"io_uring\" or $\"threadpool\", depending on how operations "
+	            /**/ "on system files are executed"),
+	TYPE_GETTER("executor", &aio_executor_get,
+	            "->?GThreadPool\n"
+	            "The ?GThreadPool used for operations that can't use io_uring"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_getset tpconst aio_class_getsets[] = {
+	TYPE_GETTER("default", &aio_default_get,
+	            "->?.\n"
+	            "A lazily created, shared instance of ?. (used by ?Apreadasync?DFile "
+	            /**/ "and ?Apwriteasync?DFile)"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeAsyncIO_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "AsyncIO",
+	/* .tp_doc      = */ DOC("Asynchronous, positional file I/O. Every operation returns a ?GFuture "
+	                         /**/ "immediately, which can be waited for by threads, or awaited by any "
+	                         /**/ "scheduler that understands ?Awhendone?GFuture\n"
+	                         "When available, operations on system files are executed by the kernel "
+	                         /**/ "using io_uring(7), such that no thread is blocked per operation. "
+	                         /**/ "Everything else is executed by a ?GThreadPool\n"
+	                         "\n"
+	                         "(entries=!256,executor?:?GThreadPool,uring=!t)\n"
+	                         "#tValueError{@entries is $0}"
+	                         "Construct a new ?. with an io_uring of (at least) @entries entries "
+	                         /**/ "(unless @uring is ?f, or io_uring isn't available). When @executor "
+	                         /**/ "isn't given, a ?GThreadPool is created the first time it is needed"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeAsyncIOObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&aio_init_kw
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&aio_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&aio_visit,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ aio_methods,
+	/* .tp_getsets       = */ aio_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ aio_class_getsets,
+	/* .tp_class_members = */ NULL
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_THREADING_AIO_C */
@@ -74,6 +74,16 @@ PRIVATE struct dex_symbol symbols[] = {
 
 	/* ThreadLocalStorage */
 	{ "TLS", (DeeObject *)&DeeTLS_Type },
+
+	/* Thread pool */
+	{ "ThreadPool", (DeeObject *)&DeeThreadPool_Type },
+	{ "Future", (DeeObject *)&DeeFuture_Type },
+	{ "Promise", (DeeObject *)&DeePromise_Type },
+	{ "AsyncIO", (DeeObject *)&DeeAsyncIO_Type },
+
+	/* Queues */
+	{ "Queue", (DeeObject *)&DeeQueue_Type },
+	{ "Channel", (DeeObject *)&DeeChannel_Type },
 	{ NULL }
 };
 
@@ -89,22 +99,33 @@ libthreading_init(DeeDexObject *__restrict UNUSED(self)) {
 	_DeeThread_TlsCallbacks.tc_fini  = (void(DCALL *)(void *__restrict)) & thread_tls_fini;
 	return 0;
 }
+#endif /* !CONFIG_NO_THREADS */
 
 PRIVATE NONNULL((1)) void DCALL
 libthreading_fini(DeeDexObject *__restrict UNUSED(self)) {
+	libthreading_aio_clear();
+#ifndef CONFIG_NO_THREADS
 	/* Restore the original TLS callback hooks. */
 	memcpy(&_DeeThread_TlsCallbacks, &orig_hooks, sizeof(struct tls_callback_hooks));
+#endif /* !CONFIG_NO_THREADS */
 }
 
-#endif /* !CONFIG_NO_THREADS */
+PRIVATE NONNULL((1)) bool DCALL
+libthreading_clear(DeeDexObject *__restrict UNUSED(self)) {
+	return libthreading_aio_clear();
+}
 
 
 PUBLIC struct dex DEX = {
-	/* .d_symbols      = */ symbols,
+	/* .d_symbols = */ symbols,
 #ifndef CONFIG_NO_THREADS
-	/* .d_init         = */ &libthreading_init,
-	/* .d_fini         = */ &libthreading_fini
-#endif /* !CONFIG_NO_THREADS */
+	/* .d_init    = */ &libthreading_init,
+#else /* !CONFIG_NO_THREADS */
+	/* .d_init    = */ NULL,
+#endif /* CONFIG_NO_THREADS */
+	/* .d_fini    = */ &libthreading_fini,
+	/* .d_imports = */ { NULL },
+	/* .d_clear   = */ &libthreading_clear
 };
 
 DECL_END
@@ -73,6 +73,28 @@ INTDEF DeeTypeObject DeeOnce_Type;
  * >> } */
 INTDEF DeeTypeObject DeeLockUnion_Type;
 
+INTDEF DeeTypeObject DeeThreadPool_Type;
+INTDEF DeeTypeObject DeeFuture_Type;
+INTDEF DeeTypeObject DeePromise_Type;
+
+/* Create a new, pending ?GFuture that is completed by native code:
+ * - DeeFuture_Resolve:       Complete with `value' (no-op if the future was cancelled)
+ * - DeeFuture_RejectCurrent: Complete with (and handle) the current exception */
+INTDEF WUNUSED DREF DeeObject *DCALL DeeFuture_NewPending(void);
+INTDEF NONNULL((1, 2)) void DCALL
+DeeFuture_Resolve(DeeObject *__restrict self,
+                  /*inherit(always)*/ DREF DeeObject *__restrict value);
+INTDEF NONNULL((1)) void DCALL
+DeeFuture_RejectCurrent(DeeObject *__restrict self);
+
+INTDEF DeeTypeObject DeeAsyncIO_Type;
+
+/* Clear the cached `AsyncIO.default' instance. */
+INTDEF bool DCALL libthreading_aio_clear(void);
+
+INTDEF DeeTypeObject DeeQueue_Type;
+INTDEF DeeTypeObject DeeChannel_Type;
+
 
 #ifndef CONFIG_NO_THREADS
 struct tls_descriptor {
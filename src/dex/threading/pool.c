@@ -0,0 +1,1407 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_THREADING_POOL_C
+#define GUARD_DEX_THREADING_POOL_C 1
+#define CONFIG_BUILDING_LIBTHREADING
+#define DEE_SOURCE
+
+#include "libthreading.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/dex.h>
+#include <deemon/error.h>
+#include <deemon/format.h>
+#include <deemon/gc.h>
+#include <deemon/int.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/objmethod.h>
+#include <deemon/string.h>
+#include <deemon/system.h>
+#include <deemon/thread.h>
+#include <deemon/tuple.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/futex.h>
+#include <deemon/util/lock.h>
+#include <deemon/util/workerpool.h>
+
+DECL_BEGIN
+
+/************************************************************************/
+/* Future                                                               */
+/************************************************************************/
+
+#define FUTURE_PENDING   0 /* Not yet started (or a Promise that hasn't been fulfilled) */
+#define FUTURE_RUNNING   1 /* Currently being executed by `f_thread' */
+#define FUTURE_DONE      2 /* Completed successfully (`f_value' is the result) */
+#define FUTURE_FAILED    3 /* Completed with an error (`f_value' is the error) */
+#define FUTURE_CANCELLED 4 /* Cancelled (`f_value' is NULL) */
+#define FUTURE_ISCOMPLETE(state) ((state) >= FUTURE_DONE)
+
+typedef struct future_object DeeFutureObject;
+struct future_object {
+	OBJECT_HEAD
+	uint32_t               f_state;     /* [lock(READ(atomic), WRITE(f_lock))] Future state (one of `FUTURE_*'; futex word) */
+	bool                   f_cancel;    /* [lock(f_lock)] Set once cancellation of a running future was requested. */
+	bool                   f_always;    /* [const] This continuation is triggered by any kind of completion of its
+	                                     *         parent, and is passed the parent future (s.a. `whendone()') */
+	Dee_atomic_lock_t      f_lock;      /* Lock for this future. */
+	DREF DeeObject        *f_func;      /* [0..1][lock(f_lock)][valid_if(FUTURE_PENDING)] Callable to invoke. */
+	DREF DeeTupleObject   *f_args;      /* [0..1][lock(f_lock)][valid_if(FUTURE_PENDING)] Arguments for `f_func'
+	                                     * (NULL for continuations that haven't been triggered, yet) */
+	DREF DeeThreadObject  *f_thread;    /* [0..1][lock(f_lock)][valid_if(FUTURE_RUNNING)] The thread executing `f_func' */
+	DREF DeeObject        *f_cancelerr; /* [0..1][lock(f_thread)] The interrupt thrown to cancel this future. */
+	DREF DeeObject        *f_value;     /* [0..1][lock(WRITE_ONCE)][valid_if(FUTURE_ISCOMPLETE(f_state))] Result/error. */
+	DREF DeeFutureObject  *f_then;      /* [0..1][lock(f_lock)] Chain of continuations (linked via `f_thennext') */
+	DREF DeeFutureObject  *f_thennext;  /* [0..1][lock(:f_lock)] Next continuation of the same future. */
+	DREF DeeFutureObject  *f_trignext;  /* [0..1][lock(PRIVATE(future_trigger()))] Next completed future whose
+	                                     * continuations have yet to be triggered (s.a. `future_trigger()') */
+};
+
+#define DeeFuture_LockAcquire(self) Dee_atomic_lock_acquire(&(self)->f_lock)
+#define DeeFuture_LockRelease(self) Dee_atomic_lock_release(&(self)->f_lock)
+
+/* [atomic] Incremented (and broadcast) every time any future completes.
+ * Used to implement `Future.waitany()' */
+PRIVATE uint32_t future_completions = 0;
+
+PRIVATE ATTR_COLD int DCALL err_future_cancelled(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "Future was cancelled");
+}
+
+PRIVATE ATTR_COLD int DCALL err_future_not_complete(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "Future has not completed");
+}
+
+/* Construct a new, pending future.
+ * When `args' is NULL, the future is a continuation (or a promise) */
+PRIVATE WUNUSED DREF DeeFutureObject *DCALL
+future_new(DeeObject *func, DeeTupleObject *args) {
+	DREF DeeFutureObject *result;
+	result = DeeGCObject_MALLOC(DeeFutureObject);
+	if unlikely(!result)
+		goto done;
+	result->f_state  = FUTURE_PENDING;
+	result->f_cancel = false;
+	result->f_always = false;
+	Dee_atomic_lock_init(&result->f_lock);
+	result->f_func = func;
+	Dee_XIncref(func);
+	result->f_args = args;
+	Dee_XIncref(args);
+	result->f_thread    = NULL;
+	result->f_cancelerr = NULL;
+	result->f_value     = NULL;
+	result->f_then      = NULL;
+	result->f_thennext  = NULL;
+	result->f_trignext  = NULL;
+	DeeObject_Init(result, &DeeFuture_Type);
+	result = (DREF DeeFutureObject *)DeeGC_Track((DeeObject *)result);
+done:
+	return result;
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+future_chain(DeeFutureObject *__restrict self, DeeFutureObject *__restrict parent);
+
+/* Complete `self' with the given `state' and `value', but don't trigger its
+ * continuations (the caller must pass `self' to `future_trigger()' for that).
+ * The caller must be holding the lock of `self', and `self' must not be complete. */
+PRIVATE NONNULL((1)) void DCALL
+future_complete_and_unlock_nochain(DeeFutureObject *__restrict self, uint32_t state,
+                                   /*inherit(always)*/ DREF DeeObject *value) {
+	DREF DeeThreadObject *thread;
+	DREF DeeObject *cancelerr, *func;
+	DREF DeeTupleObject *args;
+	ASSERT(!FUTURE_ISCOMPLETE(self->f_state));
+	ASSERT((value != NULL) == (state != FUTURE_CANCELLED));
+	self->f_value     = value;
+	thread            = self->f_thread;
+	cancelerr         = self->f_cancelerr;
+	func              = self->f_func;
+	args              = self->f_args;
+	self->f_thread    = NULL;
+	self->f_cancelerr = NULL;
+	self->f_func      = NULL;
+	self->f_args      = NULL;
+	atomic_write(&self->f_state, state);
+	DeeFuture_LockRelease(self);
+	DeeFutex_WakeAll(&self->f_state);
+	atomic_inc(&future_completions);
+	DeeFutex_WakeAll(&future_completions);
+	Dee_XDecref(thread);
+	Dee_XDecref(cancelerr);
+	Dee_XDecref(func);
+	Dee_XDecref(args);
+}
+
+/* Trigger the continuations of `self', which has just been completed by the caller.
+ * Continuations that are completed in the process are queued (rather than having
+ * their own continuations be triggered recursively), such that long chains of
+ * `then()' can't overflow the stack. */
+PRIVATE NONNULL((1)) void DCALL
+future_trigger(DeeFutureObject *__restrict self) {
+	DREF DeeFutureObject *queue, *tail;
+	Dee_Incref(self);
+	queue = tail = self;
+	do {
+		DREF DeeFutureObject *parent = queue;
+		queue = parent->f_trignext;
+		parent->f_trignext = NULL;
+		for (;;) {
+			DREF DeeFutureObject *then;
+			DeeFuture_LockAcquire(parent);
+			then = parent->f_then;
+			if (!then) {
+				DeeFuture_LockRelease(parent);
+				break;
+			}
+			parent->f_then   = then->f_thennext;
+			then->f_thennext = NULL;
+			DeeFuture_LockRelease(parent);
+			if (future_chain(then, parent)) {
+				/* Inherit reference into the queue. */
+				if (queue) {
+					tail->f_trignext = then;
+				} else {
+					queue = then;
+				}
+				tail = then;
+			} else {
+				Dee_Decref(then);
+			}
+		}
+		Dee_Decref(parent);
+	} while (queue);
+}
+
+/* Complete `self' with the given `state' and `value', and trigger its continuations.
+ * The caller must be holding the lock of `self', and `self' must not be complete. */
+PRIVATE NONNULL((1)) void DCALL
+future_complete_and_unlock(DeeFutureObject *__restrict self, uint32_t state,
+                           /*inherit(always)*/ DREF DeeObject *value) {
+	future_complete_and_unlock_nochain(self, state, value);
+	future_trigger(self);
+}
+
+/* Execute a pending future in the calling thread, but don't trigger its continuations.
+ * @return: true:  The future was executed (and completed by the caller)
+ * @return: false: The future was cancelled */
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+future_exec_nochain(DeeFutureObject *__restrict self) {
+	DREF DeeObject *func, *result;
+	DREF DeeTupleObject *args;
+	DeeThreadObject *caller = DeeThread_Self();
+	DeeFuture_LockAcquire(self);
+	if unlikely(self->f_state != FUTURE_PENDING) {
+		DeeFuture_LockRelease(self);
+		return false; /* Cancelled */
+	}
+	func = self->f_func;
+	args = self->f_args;
+	ASSERT(func);
+	ASSERT(args);
+	self->f_func   = NULL;
+	self->f_args   = NULL;
+	self->f_thread = caller;
+	Dee_Incref(caller);
+	atomic_write(&self->f_state, FUTURE_RUNNING);
+	DeeFuture_LockRelease(self);
+	result = DeeObject_CallTuple(func, (DeeObject *)args);
+	Dee_Decref(func);
+	Dee_Decref(args);
+	if likely(result) {
+		DeeFuture_LockAcquire(self);
+		future_complete_and_unlock_nochain(self, FUTURE_DONE, result);
+	} else {
+		DREF DeeObject *error = DeeError_Current();
+		if (self->f_cancelerr != NULL && error == self->f_cancelerr) {
+			/* The interrupt we've thrown to cancel the future. */
+			DeeError_Handled(ERROR_HANDLED_INTERRUPT);
+			DeeFuture_LockAcquire(self);
+			future_complete_and_unlock_nochain(self, FUTURE_CANCELLED, NULL);
+		} else {
+			/* Interrupts not meant for us are re-scheduled
+			 * such that they still reach the calling thread. */
+			Dee_Incref(error);
+			DeeError_Handled(ERROR_HANDLED_RESTORE);
+			DeeFuture_LockAcquire(self);
+			future_complete_and_unlock_nochain(self, FUTURE_FAILED, error);
+		}
+	}
+	return true;
+}
+
+/* Execute a pending future in the calling thread (no-op if the future was cancelled) */
+PRIVATE NONNULL((1)) void DCALL
+future_exec(DeeFutureObject *__restrict self) {
+	if (future_exec_nochain(self))
+		future_trigger(self);
+}
+
+/* Trigger the continuation `self' after its `parent' completed (but
+ * don't trigger the continuations of `self' itself)
+ * @return: true:  `self' was completed by the caller
+ * @return: false: `self' had already been completed (i.e. it was cancelled) */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+future_chain(DeeFutureObject *__restrict self, DeeFutureObject *__restrict parent) {
+	uint32_t state  = atomic_read(&parent->f_state);
+	DeeObject *value = parent->f_value;
+	ASSERT(FUTURE_ISCOMPLETE(state));
+	if (state == FUTURE_DONE || self->f_always) {
+		DREF DeeTupleObject *args;
+		args = (DREF DeeTupleObject *)DeeTuple_Pack(1, self->f_always ? (DeeObject *)parent : value);
+		if unlikely(!args) {
+			DREF DeeObject *error = DeeError_Current();
+			Dee_Incref(error);
+			DeeError_Handled(ERROR_HANDLED_RESTORE);
+			DeeFuture_LockAcquire(self);
+			if (self->f_state != FUTURE_PENDING) {
+				DeeFuture_LockRelease(self);
+				Dee_Decref(error);
+				return false;
+			}
+			future_complete_and_unlock_nochain(self, FUTURE_FAILED, error);
+			return true;
+		}
+		DeeFuture_LockAcquire(self);
+		if (self->f_state == FUTURE_PENDING) {
+			self->f_args = args;
+			args = NULL;
+		}
+		DeeFuture_LockRelease(self);
+		if unlikely(args) {
+			Dee_Decref(args); /* Already cancelled */
+			return false;
+		}
+		return future_exec_nochain(self);
+	}
+
+	/* Propagate errors and cancellation. */
+	DeeFuture_LockAcquire(self);
+	if (self->f_state != FUTURE_PENDING) {
+		DeeFuture_LockRelease(self);
+		return false;
+	}
+	Dee_XIncref(value);
+	future_complete_and_unlock_nochain(self, state, value);
+	return true;
+}
+
+/* Wait for `self' to complete.
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+future_wait(DeeFutureObject *__restrict self) {
+	for (;;) {
+		uint32_t state = atomic_read(&self->f_state);
+		if (FUTURE_ISCOMPLETE(state))
+			return 0;
+		if (DeeFutex_Wait32(&self->f_state, state))
+			return -1;
+	}
+}
+
+/* Same as `future_wait()', but give up after `timeout_nanoseconds'
+ * @return: 1 : The given timeout expired */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+future_wait_timed(DeeFutureObject *__restrict self, uint64_t timeout_nanoseconds) {
+	uint64_t now_microseconds, then_microseconds;
+	if (timeout_nanoseconds == (uint64_t)-1)
+		return future_wait(self);
+	now_microseconds  = DeeThread_GetTimeMicroSeconds();
+	then_microseconds = now_microseconds + timeout_nanoseconds / 1000;
+	for (;;) {
+		int error;
+		uint32_t state = atomic_read(&self->f_state);
+		if (FUTURE_ISCOMPLETE(state))
+			return 0;
+		if (now_microseconds >= then_microseconds)
+			return 1;
+		error = DeeFutex_Wait32Timed(&self->f_state, state,
+		                             (then_microseconds - now_microseconds) * 1000);
+		if unlikely(error < 0)
+			return error;
+		now_microseconds = DeeThread_GetTimeMicroSeconds();
+	}
+}
+
+/* Return the result of a completed future, or re-throw its error. */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_getresult(DeeFutureObject *__restrict self) {
+	switch (atomic_read(&self->f_state)) {
+
+	case FUTURE_DONE:
+		return_reference_(self->f_value);
+
+	case FUTURE_FAILED:
+		DeeError_Throw(self->f_value);
+		break;
+
+	case FUTURE_CANCELLED:
+		err_future_cancelled();
+		break;
+
+	default:
+		err_future_not_complete();
+		break;
+	}
+	return NULL;
+}
+
+/* Invoked (as an interrupt) in the thread executing a future that should be cancelled. */
+PRIVATE WUNUSED DREF DeeObject *DCALL
+future_cancel_interrupt_f(size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *error;
+	DeeFutureObject *self;
+	ASSERT(argc == 1);
+	(void)argc;
+	self = (DeeFutureObject *)argv[0];
+	DeeFuture_LockAcquire(self);
+	if (self->f_state != FUTURE_RUNNING || self->f_thread != DeeThread_Self()) {
+		/* The future already finished. */
+		DeeFuture_LockRelease(self);
+		return_none;
+	}
+	DeeFuture_LockRelease(self);
+	error = DeeObject_NewDefault(&DeeError_Interrupt);
+	if unlikely(!error)
+		goto err;
+	ASSERT(!self->f_cancelerr);
+	self->f_cancelerr = error; /* Inherit reference */
+	DeeError_Throw(error);
+err:
+	return NULL;
+}
+
+PRIVATE DEFINE_CMETHOD(future_cancel_interrupt, &future_cancel_interrupt_f);
+
+/* Try to cancel `self'
+ * @return: true:  The future was cancelled, or its cancellation was requested.
+ * @return: false: The future has already completed.
+ * @return: -1:    An error was thrown. */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+future_cancel(DeeFutureObject *__restrict self) {
+	DREF DeeThreadObject *thread;
+	DREF DeeObject *args;
+	int error;
+	DeeFuture_LockAcquire(self);
+	switch (self->f_state) {
+
+	case FUTURE_PENDING:
+		future_complete_and_unlock(self, FUTURE_CANCELLED, NULL);
+		return 1;
+
+	case FUTURE_RUNNING:
+		if (self->f_cancel)
+			break;
+		self->f_cancel = true;
+		thread = self->f_thread;
+		Dee_Incref(thread);
+		DeeFuture_LockRelease(self);
+		args = DeeTuple_Pack(1, self);
+		if unlikely(!args) {
+			Dee_Decref(thread);
+			goto err;
+		}
+		error = DeeThread_Interrupt((DeeObject *)thread,
+		                            (DeeObject *)&future_cancel_interrupt,
+		                            args);
+		Dee_Decref(args);
+		Dee_Decref(thread);
+		if unlikely(error < 0)
+			goto err;
+		return 1;
+
+	default: break;
+	}
+	DeeFuture_LockRelease(self);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+future_fini(DeeFutureObject *__restrict self) {
+	Dee_XDecref(self->f_func);
+	Dee_XDecref(self->f_args);
+	Dee_XDecref(self->f_thread);
+	Dee_XDecref(self->f_cancelerr);
+	Dee_XDecref(self->f_value);
+	Dee_XDecref(self->f_then);
+	Dee_XDecref(self->f_thennext);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+future_visit(DeeFutureObject *__restrict self, dvisit_t proc, void *arg) {
+	DeeFuture_LockAcquire(self);
+	Dee_XVisit(self->f_func);
+	Dee_XVisit(self->f_args);
+	Dee_XVisit(self->f_value);
+	Dee_XVisit(self->f_then);
+	Dee_XVisit(self->f_thennext);
+	DeeFuture_LockRelease(self);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+future_clear(DeeFutureObject *__restrict self) {
+	DREF DeeObject *func, *value;
+	DREF DeeTupleObject *args;
+	DREF DeeFutureObject *then, *thennext;
+	DeeFuture_LockAcquire(self);
+	func     = self->f_func;
+	args     = self->f_args;
+	then     = self->f_then;
+	thennext = self->f_thennext;
+	value    = self->f_value;
+	self->f_func     = NULL;
+	self->f_args     = NULL;
+	self->f_then     = NULL;
+	self->f_thennext = NULL;
+	if (value) {
+		/* Keep the future bound, but drop the reference to its result. */
+		Dee_Incref(Dee_None);
+		self->f_value = Dee_None;
+	}
+	DeeFuture_LockRelease(self);
+	Dee_XDecref(func);
+	Dee_XDecref(args);
+	Dee_XDecref(then);
+	Dee_XDecref(thennext);
+	Dee_XDecref(value);
+}
+
+PRIVATE struct type_gc tpconst future_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&future_clear
+};
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+future_print(DeeFutureObject *__restrict self,
+             dformatprinter printer, void *arg) {
+	PRIVATE char const future_state_names[][10] = {
+		/* [FUTURE_PENDING]   = */ "pending",
+		/* [FUTURE_RUNNING]   = */ "running",
+		/* [FUTURE_DONE]      = */ "done",
+		/* [FUTURE_FAILED]    = */ "failed",
+		/* [FUTURE_CANCELLED] = */ "cancelled",
+	};
+	uint32_t state = atomic_read(&self->f_state);
+	return DeeFormat_Printf(printer, arg, "<Future %s>", future_state_names[state]);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_wait_f(DeeFutureObject *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":wait"))
+		goto err;
+	if unlikely(future_wait(self))
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_timedwait(DeeFutureObject *self, size_t argc, DeeObject *const *argv) {
+	int error;
+	uint64_t timeout_nanoseconds;
+	if (DeeArg_Unpack(argc, argv, UNPu64 ":timedwait", &timeout_nanoseconds))
+		goto err;
+	error = future_wait_timed(self, timeout_nanoseconds);
+	if unlikely(error < 0)
+		goto err;
+	return_bool_(error == 0);
+err:
+	return NULL;
+}
+
+/* Create a continuation of `self' that invokes `callback' (s.a. `then()' and `whendone()') */
+PRIVATE WUNUSED NONNULL((1, 2)) DREF DeeObject *DCALL
+future_continue(DeeFutureObject *self, DeeObject *callback, bool always) {
+	DREF DeeFutureObject *result;
+	uint32_t state;
+	result = future_new(callback, NULL);
+	if unlikely(!result)
+		goto err;
+	result->f_always = always;
+	DeeFuture_LockAcquire(self);
+	state = self->f_state;
+	if (!FUTURE_ISCOMPLETE(state)) {
+		/* Append to the chain of continuations (such that they run in order) */
+		DREF DeeFutureObject **p_then = &self->f_then;
+		while (*p_then)
+			p_then = &(*p_then)->f_thennext;
+		Dee_Incref(result);
+		*p_then = result;
+		DeeFuture_LockRelease(self);
+		return (DREF DeeObject *)result;
+	}
+	DeeFuture_LockRelease(self);
+
+	/* Already completed -> trigger the continuation immediately. */
+	if (future_chain(result, self))
+		future_trigger(result);
+	return (DREF DeeObject *)result;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_then(DeeFutureObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *callback;
+	if (DeeArg_Unpack(argc, argv, "o:then", &callback))
+		goto err;
+	return future_continue(self, callback, false);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_whendone(DeeFutureObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *callback;
+	if (DeeArg_Unpack(argc, argv, "o:whendone", &callback))
+		goto err;
+	return future_continue(self, callback, true);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_cancel_f(DeeFutureObject *self, size_t argc, DeeObject *const *argv) {
+	int result;
+	if (DeeArg_Unpack(argc, argv, ":cancel"))
+		goto err;
+	result = future_cancel(self);
+	if unlikely(result < 0)
+		goto err;
+	return_bool_(result != 0);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_result_get(DeeFutureObject *__restrict self) {
+	if unlikely(future_wait(self))
+		goto err;
+	return future_getresult(self);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_error_get(DeeFutureObject *__restrict self) {
+	if unlikely(future_wait(self))
+		goto err;
+	if (atomic_read(&self->f_state) == FUTURE_FAILED)
+		return_reference_(self->f_value);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_done_get(DeeFutureObject *__restrict self) {
+	return_bool(FUTURE_ISCOMPLETE(atomic_read(&self->f_state)));
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_running_get(DeeFutureObject *__restrict self) {
+	return_bool(atomic_read(&self->f_state) == FUTURE_RUNNING);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+future_cancelled_get(DeeFutureObject *__restrict self) {
+	return_bool(atomic_read(&self->f_state) == FUTURE_CANCELLED);
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+future_waitall(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	size_t i;
+	DREF DeeTupleObject *result;
+	for (i = 0; i < argc; ++i) {
+		if (DeeObject_AssertTypeExact(argv[i], &DeeFuture_Type))
+			goto err;
+	}
+	for (i = 0; i < argc; ++i) {
+		if unlikely(future_wait((DeeFutureObject *)argv[i]))
+			goto err;
+	}
+	result = DeeTuple_NewUninitialized(argc);
+	if unlikely(!result)
+		goto err;
+	for (i = 0; i < argc; ++i) {
+		DREF DeeObject *value;
+		value = future_getresult((DeeFutureObject *)argv[i]);
+		if unlikely(!value)
+			goto err_r_i;
+		DeeTuple_SET(result, i, value);
+	}
+	return (DREF DeeObject *)result;
+err_r_i:
+	Dee_Decrefv(DeeTuple_ELEM(result), i);
+	DeeTuple_FreeUninitialized(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+future_waitany(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	size_t i;
+	for (i = 0; i < argc; ++i) {
+		if (DeeObject_AssertTypeExact(argv[i], &DeeFuture_Type))
+			goto err;
+	}
+	if unlikely(!argc) {
+		DeeError_Throwf(&DeeError_ValueError, "No futures given");
+		goto err;
+	}
+	for (;;) {
+		uint32_t version = atomic_read(&future_completions);
+		for (i = 0; i < argc; ++i) {
+			DeeFutureObject *future = (DeeFutureObject *)argv[i];
+			if (FUTURE_ISCOMPLETE(atomic_read(&future->f_state)))
+				return_reference_((DeeObject *)future);
+		}
+		if (DeeFutex_Wait32(&future_completions, version))
+			goto err;
+	}
+err:
+	return NULL;
+}
+
+PRIVATE struct type_method tpconst future_methods[] = {
+	TYPE_METHOD("wait", &future_wait_f,
+	            "()\n"
+	            "Wait until @this ?GFuture has completed (successfully, with an error, or by being cancelled)"),
+	TYPE_METHOD("timedwait", &future_timedwait,
+	            "(timeout_nanoseconds:?Dint)->?Dbool\n"
+	            "Same as ?#wait, but give up after @timeout_nanoseconds have passed, "
+	            /**/ "returning ?f in that case, and ?t if @this ?GFuture has completed"),
+	TYPE_METHOD("then", &future_then,
+	            "(callback:?DCallable)->?.\n"
+	            "Return a new ?GFuture that completes with ${callback(this.result)} once @this "
+	            /**/ "?GFuture completes successfully. The @callback is invoked by the thread that "
+	            /**/ "completes @this ?GFuture (or by the calling thread if it already completed). "
+	            /**/ "If @this ?GFuture fails or is cancelled, so is the returned ?GFuture"),
+	TYPE_METHOD("whendone", &future_whendone,
+	            "(callback:?DCallable)->?.\n"
+	            "Same as ?#then, but @callback is invoked as ${callback(this)} once @this ?GFuture "
+	            /**/ "completes in any way (successfully, with an error, or by being cancelled)\n"
+	            "This is the completion hook used by ?Enet:EventLoop to let its tasks wait for a ?GFuture"),
+	TYPE_METHOD("cancel", &future_cancel_f,
+	            "->?Dbool\n"
+	            "Cancel @this ?GFuture, returning ?f if it has already completed.\n"
+	            "If @this ?GFuture hasn't started, yet, it is cancelled immediately and will never "
+	            /**/ "run. If it is currently running, an ?E:Interrupt is delivered to the executing "
+	            /**/ "thread the next time it checks for interrupts, and the ?GFuture is marked as "
+	            /**/ "cancelled once that interrupt unwinds its callback"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst future_getsets[] = {
+	TYPE_GETTER("result", &future_result_get,
+	            "#tValueError{@this ?GFuture was cancelled}"
+	            "Wait for @this ?GFuture to complete and return its result, "
+	            /**/ "or re-throw the error that was thrown by its callback"),
+	TYPE_GETTER("error", &future_error_get,
+	            "Wait for @this ?GFuture to complete and return the error thrown "
+	            /**/ "by its callback, or ?N if it didn't fail"),
+	TYPE_GETTER("done", &future_done_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this ?GFuture has completed"),
+	TYPE_GETTER("running", &future_running_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this ?GFuture is currently being executed"),
+	TYPE_GETTER("cancelled", &future_cancelled_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this ?GFuture was cancelled"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_method tpconst future_class_methods[] = {
+	TYPE_METHOD("waitall", &future_waitall,
+	            "(futures!:?.)->?DTuple\n"
+	            "Wait for all of the given @futures to complete, and return their results. "
+	            /**/ "If any of them failed, the error of the first such ?GFuture is re-thrown"),
+	TYPE_METHOD("waitany", &future_waitany,
+	            "(futures!:?.)->?.\n"
+	            "#tValueError{No @futures were given}"
+	            "Wait until at least one of the given @futures has completed, and return it"),
+	TYPE_METHOD_END
+};
+
+INTERN DeeTypeObject DeeFuture_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Future",
+	/* .tp_doc      = */ DOC("The pending result of a task submitted to a ?GThreadPool, "
+	                         /**/ "or of a ?GPromise"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeFutureObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&future_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL,
+		/* .tp_print     = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&future_print,
+		/* .tp_printrepr = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&future_visit,
+	/* .tp_gc            = */ &future_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ future_methods,
+	/* .tp_getsets       = */ future_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ future_class_methods,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+
+
+
+/************************************************************************/
+/* Promise                                                              */
+/************************************************************************/
+
+typedef struct {
+	OBJECT_HEAD
+	DREF DeeFutureObject *p_future; /* [1..1][const] The future being fulfilled by this promise. */
+} DeePromiseObject;
+
+PRIVATE DEFINE_STRING(str_promise_destroyed, "Promise was destroyed without a result");
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+promise_ctor(DeePromiseObject *__restrict self) {
+	self->p_future = future_new(NULL, NULL);
+	if unlikely(!self->p_future)
+		goto err;
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+promise_fini(DeePromiseObject *__restrict self) {
+	DeeFutureObject *future = self->p_future;
+	if (atomic_read(&future->f_state) == FUTURE_PENDING) {
+		/* The promise can no longer be fulfilled, so fail its future, such
+		 * that anyone waiting for it (or its continuations) isn't stuck forever. */
+		DREF DeeObject *error;
+		DeeObject *message = (DeeObject *)&str_promise_destroyed;
+		error = DeeObject_New(&DeeError_ValueError, 1, &message);
+		if unlikely(!error) /* Cancel the future if we can't allocate an error */
+			DeeError_Handled(ERROR_HANDLED_RESTORE);
+		DeeFuture_LockAcquire(future);
+		if (future->f_state != FUTURE_PENDING) {
+			DeeFuture_LockRelease(future);
+			Dee_XDecref(error);
+		} else {
+			future_complete_and_unlock(future, error ? FUTURE_FAILED : FUTURE_CANCELLED, error);
+		}
+	}
+	Dee_Decref(future);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+promise_visit(DeePromiseObject *__restrict self, dvisit_t proc, void *arg) {
+	Dee_Visit(self->p_future);
+}
+
+/* Fulfill the future of `self'
+ * @return: true:  Success
+ * @return: false: The future has already completed (or was cancelled) */
+PRIVATE WUNUSED NONNULL((1, 3)) bool DCALL
+promise_complete(DeePromiseObject *__restrict self,
+                 uint32_t state, DeeObject *value) {
+	DeeFutureObject *future = self->p_future;
+	DeeFuture_LockAcquire(future);
+	if (future->f_state != FUTURE_PENDING) {
+		DeeFuture_LockRelease(future);
+		return false;
+	}
+	Dee_Incref(value);
+	future_complete_and_unlock(future, state, value);
+	return true;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+promise_set(DeePromiseObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *value;
+	if (DeeArg_Unpack(argc, argv, "o:set", &value))
+		goto err;
+	return_bool(promise_complete(self, FUTURE_DONE, value));
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+promise_fail(DeePromiseObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *error;
+	if (DeeArg_Unpack(argc, argv, "o:fail", &error))
+		goto err;
+	return_bool(promise_complete(self, FUTURE_FAILED, error));
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+promise_future_get(DeePromiseObject *__restrict self) {
+	return_reference_((DeeObject *)self->p_future);
+}
+
+PRIVATE struct type_method tpconst promise_methods[] = {
+	TYPE_METHOD("set", &promise_set,
+	            "(value)->?Dbool\n"
+	            "Complete ?#future with the given @value. Returns ?f if ?#future "
+	            /**/ "has already completed, or was cancelled"),
+	TYPE_METHOD("fail", &promise_fail,
+	            "(error)->?Dbool\n"
+	            "Complete ?#future such that accessing its result throws @error. "
+	            /**/ "Returns ?f if ?#future has already completed, or was cancelled"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst promise_getsets[] = {
+	TYPE_GETTER("future", &promise_future_get,
+	            "->?GFuture\n"
+	            "The ?GFuture that is completed by @this ?GPromise"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeePromise_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Promise",
+	/* .tp_doc      = */ DOC("A ?GFuture that is completed explicitly by calling ?#set or ?#fail\n"
+	                         "\n"
+	                         "()\n"
+	                         "Construct a new promise with a pending ?#future"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)&promise_ctor,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeePromiseObject)
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&promise_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&promise_visit,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ promise_methods,
+	/* .tp_getsets       = */ promise_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+/* Helpers for completing futures from native code (s.a. `aio.c') */
+INTERN WUNUSED DREF DeeObject *DCALL DeeFuture_NewPending(void) {
+	return (DREF DeeObject *)future_new(NULL, NULL);
+}
+
+INTERN NONNULL((1, 2)) void DCALL
+DeeFuture_Resolve(DeeObject *__restrict self,
+                  /*inherit(always)*/ DREF DeeObject *__restrict value) {
+	DeeFutureObject *me = (DeeFutureObject *)self;
+	DeeFuture_LockAcquire(me);
+	if unlikely(me->f_state != FUTURE_PENDING) {
+		DeeFuture_LockRelease(me);
+		Dee_Decref(value); /* Cancelled */
+		return;
+	}
+	future_complete_and_unlock(me, FUTURE_DONE, value);
+}
+
+INTERN NONNULL((1)) void DCALL
+DeeFuture_RejectCurrent(DeeObject *__restrict self) {
+	DeeFutureObject *me = (DeeFutureObject *)self;
+	DREF DeeObject *error = DeeError_Current();
+	ASSERT(error);
+	Dee_Incref(error);
+	DeeError_Handled(ERROR_HANDLED_RESTORE);
+	DeeFuture_LockAcquire(me);
+	if unlikely(me->f_state != FUTURE_PENDING) {
+		DeeFuture_LockRelease(me);
+		Dee_Decref(error); /* Cancelled */
+		return;
+	}
+	future_complete_and_unlock(me, FUTURE_FAILED, error);
+}
+
+
+
+
+/************************************************************************/
+/* ThreadPool                                                           */
+/************************************************************************/
+
+/* Double-ended queue of pending tasks.
+ * The owning worker pushes and pops at the back (LIFO, which is good for
+ * cache locality when tasks spawn sub-tasks), while other workers steal
+ * from the front (FIFO, which takes the oldest, and usually largest task) */
+struct task_deque {
+	Dee_atomic_lock_t      td_lock;  /* Lock for this deque. */
+	size_t                 td_head;  /* [lock(td_lock)] Index of the first element (in `td_vec') */
+	size_t                 td_size;  /* [lock(td_lock)] # of elements in the deque. */
+	size_t                 td_alloc; /* [lock(td_lock)] Allocated buffer size (power-of-2, or 0) */
+	DREF DeeFutureObject **td_vec;   /* [1..1][0..td_size][owned][lock(td_lock)] Ring buffer of tasks. */
+};
+
+#define task_deque_init(self)                \
+	(Dee_atomic_lock_init(&(self)->td_lock), \
+	 (self)->td_head = (self)->td_size = 0,  \
+	 (self)->td_alloc = 0, (self)->td_vec = NULL)
+#define task_deque_acquire(self) Dee_atomic_lock_acquire(&(self)->td_lock)
+#define task_deque_release(self) Dee_atomic_lock_release(&(self)->td_lock)
+
+PRIVATE NONNULL((1)) void DCALL
+task_deque_fini(struct task_deque *__restrict self) {
+	size_t i;
+	for (i = 0; i < self->td_size; ++i)
+		Dee_Decref(self->td_vec[(self->td_head + i) & (self->td_alloc - 1)]);
+	Dee_Free(self->td_vec);
+}
+
+/* Append `task' to the back of `self'
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+task_deque_pushback(struct task_deque *__restrict self,
+                    DeeFutureObject *__restrict task) {
+	DREF DeeFutureObject **new_vec;
+	size_t i, new_alloc;
+again:
+	task_deque_acquire(self);
+	if likely(self->td_size < self->td_alloc) {
+		Dee_Incref(task);
+		self->td_vec[(self->td_head + self->td_size) & (self->td_alloc - 1)] = task;
+		++self->td_size;
+		task_deque_release(self);
+		return 0;
+	}
+	new_alloc = self->td_alloc ? self->td_alloc * 2 : 16;
+	task_deque_release(self);
+
+	/* Grow the buffer (without holding the lock) */
+	new_vec = (DREF DeeFutureObject **)Dee_Mallocc(new_alloc, sizeof(DREF DeeFutureObject *));
+	if unlikely(!new_vec)
+		goto err;
+	task_deque_acquire(self);
+	if unlikely(self->td_alloc >= new_alloc) {
+		/* Someone else already grew the buffer. */
+		task_deque_release(self);
+		Dee_Free(new_vec);
+		goto again;
+	}
+	for (i = 0; i < self->td_size; ++i)
+		new_vec[i] = self->td_vec[(self->td_head + i) & (self->td_alloc - 1)];
+	Dee_Free(self->td_vec);
+	self->td_vec   = new_vec;
+	self->td_head  = 0;
+	self->td_alloc = new_alloc;
+	task_deque_release(self);
+	goto again;
+err:
+	return -1;
+}
+
+/* Pop a task from the back of `self' (or return NULL if empty) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeFutureObject *DCALL
+task_deque_popback(struct task_deque *__restrict self) {
+	DREF DeeFutureObject *result = NULL;
+	task_deque_acquire(self);
+	if (self->td_size) {
+		--self->td_size;
+		result = self->td_vec[(self->td_head + self->td_size) & (self->td_alloc - 1)];
+	}
+	task_deque_release(self);
+	return result;
+}
+
+/* Pop a task from the front of `self' (or return NULL if empty) */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeFutureObject *DCALL
+task_deque_popfront(struct task_deque *__restrict self) {
+	DREF DeeFutureObject *result = NULL;
+	task_deque_acquire(self);
+	if (self->td_size) {
+		result = self->td_vec[self->td_head];
+		self->td_head = (self->td_head + 1) & (self->td_alloc - 1);
+		--self->td_size;
+	}
+	task_deque_release(self);
+	return result;
+}
+
+typedef struct {
+	DeeWorkerPoolObject tp_pool;   /* The underlying worker pool (`wp_pending' is the # of tasks
+	                                * that are queued, but not yet taken by a worker) */
+	struct task_deque  *tp_local;  /* [0..tp_pool.wp_workermax][owned] Per-worker task deques. */
+	struct task_deque   tp_inject; /* Tasks submitted by threads other than workers. */
+} DeeThreadPoolObject;
+
+PRIVATE ATTR_COLD int DCALL err_threadpool_shutdown(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "ThreadPool has been shut down");
+}
+
+/* Called after a task was taken from a deque. */
+PRIVATE NONNULL((1)) void DCALL
+threadpool_taken(DeeThreadPoolObject *__restrict self) {
+	/* If this was the last task of a pool being shut down,
+	 * wake up idle workers such that they can exit. */
+	if (atomic_decfetch(&self->tp_pool.wp_pending) == 0 &&
+	    atomic_read(&self->tp_pool.wp_shutdown))
+		Dee_workerpool_broadcast(&self->tp_pool);
+}
+
+/* Take the next task to execute for the worker with the given `index' */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeFutureObject *DCALL
+threadpool_take(DeeThreadPoolObject *__restrict self, size_t index) {
+	size_t i, count;
+	DREF DeeFutureObject *result;
+
+	/* Own tasks first (most recently submitted one first) */
+	result = task_deque_popback(&self->tp_local[index]);
+	if (result)
+		return result;
+
+	/* Then tasks submitted by outside threads. */
+	result = task_deque_popfront(&self->tp_inject);
+	if (result)
+		return result;
+
+	/* Steal the oldest task of some other worker. */
+	count = atomic_read(&self->tp_pool.wp_workerc);
+	for (i = 1; i < count; ++i) {
+		result = task_deque_popfront(&self->tp_local[(index + i) % count]);
+		if (result)
+			return result;
+	}
+	return NULL;
+}
+
+/* Take and execute one task (called by worker threads) */
+PRIVATE WUNUSED NONNULL((1)) bool DCALL
+threadpool_work(DeeWorkerPoolObject *__restrict pool, size_t index) {
+	DeeThreadPoolObject *self = (DeeThreadPoolObject *)pool;
+	DREF DeeFutureObject *task = threadpool_take(self, index);
+	if (!task)
+		return false;
+	threadpool_taken(self);
+	future_exec(task);
+	Dee_Decref(task);
+	return true;
+}
+
+PRIVATE DEFINE_STRING(threadpool_worker_name, "ThreadPool");
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+threadpool_init_kw(DeeThreadPoolObject *__restrict self, size_t argc,
+                   DeeObject *const *argv, DeeObject *kw) {
+	PRIVATE DEFINE_KWLIST(threadpool_kwlist, { K(workers), KEND });
+	size_t i, workers = (size_t)-1;
+	if (DeeArg_UnpackKw(argc, argv, kw, threadpool_kwlist, "|" UNPuSIZ ":ThreadPool", &workers))
+		goto err;
+#ifdef CONFIG_NO_THREADS
+	workers = 0;
+#else /* CONFIG_NO_THREADS */
+	if (workers == (size_t)-1)
+		workers = DeeSystem_GetCpuCount();
+#endif /* !CONFIG_NO_THREADS */
+	self->tp_local = NULL;
+	if (workers) {
+		self->tp_local = (struct task_deque *)Dee_Mallocc(workers, sizeof(struct task_deque));
+		if unlikely(!self->tp_local)
+			goto err;
+		for (i = 0; i < workers; ++i)
+			task_deque_init(&self->tp_local[i]);
+	}
+	task_deque_init(&self->tp_inject);
+	Dee_workerpool_init(&self->tp_pool, &threadpool_work,
+	                    &threadpool_worker_name, workers);
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+threadpool_fini(DeeThreadPoolObject *__restrict self) {
+	size_t i;
+	/* Workers hold references to the pool, so they've all exited by now. */
+	ASSERT(self->tp_pool.wp_running == 0);
+	for (i = 0; i < self->tp_pool.wp_workermax; ++i)
+		task_deque_fini(&self->tp_local[i]);
+	task_deque_fini(&self->tp_inject);
+	Dee_Free(self->tp_local);
+	Dee_workerpool_fini(&self->tp_pool);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+threadpool_submit(DeeThreadPoolObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeFutureObject *result;
+	DREF DeeObject *args;
+	size_t index;
+	if unlikely(argc < 1) {
+		DeeError_Throwf(&DeeError_TypeError,
+		                "function submit() expects at least 1 argument");
+		goto err;
+	}
+	args = DeeTuple_NewVector(argc - 1, argv + 1);
+	if unlikely(!args)
+		goto err;
+	result = future_new(argv[0], (DeeTupleObject *)args);
+	Dee_Decref(args);
+	if unlikely(!result)
+		goto err;
+	if (self->tp_pool.wp_workermax == 0) {
+		/* No worker threads -> run the task now. */
+		if unlikely(atomic_read(&self->tp_pool.wp_shutdown))
+			goto err_shutdown;
+		future_exec(result);
+		return (DREF DeeObject *)result;
+	}
+
+	/* Account for the task before checking for shutdown, such
+	 * that workers won't exit before picking it up. */
+	atomic_inc(&self->tp_pool.wp_pending);
+	if unlikely(atomic_read(&self->tp_pool.wp_shutdown))
+		goto err_shutdown_pending;
+	if unlikely(Dee_workerpool_start(&self->tp_pool))
+		goto err_pending;
+	index = Dee_workerpool_selfindex(&self->tp_pool);
+	if unlikely(task_deque_pushback(index == (size_t)-1
+	                                ? &self->tp_inject
+	                                : &self->tp_local[index],
+	                                result))
+		goto err_pending;
+	Dee_workerpool_notify(&self->tp_pool);
+	return (DREF DeeObject *)result;
+err_shutdown_pending:
+	err_threadpool_shutdown();
+err_pending:
+	threadpool_taken(self);
+	Dee_Decref(result);
+	goto err;
+err_shutdown:
+	err_threadpool_shutdown();
+	Dee_Decref(result);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+threadpool_shutdown(DeeThreadPoolObject *self, size_t argc,
+                    DeeObject *const *argv, DeeObject *kw) {
+	PRIVATE DEFINE_KWLIST(shutdown_kwlist, { K(wait), KEND });
+	bool wait = true;
+	if (DeeArg_UnpackKw(argc, argv, kw, shutdown_kwlist, "|b:shutdown", &wait))
+		goto err;
+	if unlikely(Dee_workerpool_shutdown(&self->tp_pool, wait))
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+threadpool_enter(DeeThreadPoolObject *__restrict self) {
+	(void)self;
+	return 0;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+threadpool_leave(DeeThreadPoolObject *__restrict self) {
+	return Dee_workerpool_shutdown(&self->tp_pool, true);
+}
+
+PRIVATE struct type_with threadpool_with = {
+	/* .tp_enter = */ (int (DCALL *)(DeeObject *__restrict))&threadpool_enter,
+	/* .tp_leave = */ (int (DCALL *)(DeeObject *__restrict))&threadpool_leave
+};
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+threadpool_workers_get(DeeThreadPoolObject *__restrict self) {
+	return DeeInt_NewSize(self->tp_pool.wp_workermax);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+threadpool_pending_get(DeeThreadPoolObject *__restrict self) {
+	return DeeInt_NewSize(atomic_read(&self->tp_pool.wp_pending));
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+threadpool_isshutdown_get(DeeThreadPoolObject *__restrict self) {
+	return_bool(atomic_read(&self->tp_pool.wp_shutdown) != 0);
+}
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+threadpool_printrepr(DeeThreadPoolObject *__restrict self,
+                     dformatprinter printer, void *arg) {
+	return DeeFormat_Printf(printer, arg, "ThreadPool(workers: %" PRFuSIZ ")",
+	                        self->tp_pool.wp_workermax);
+}
+
+PRIVATE struct type_method tpconst threadpool_methods[] = {
+	TYPE_METHOD("submit", &threadpool_submit,
+	            "(func:?DCallable,args!)->?GFuture\n"
+	            "#tValueError{@this ?GThreadPool has been shut down}"
+	            "Schedule ${func(args...)} to be executed by one of the worker threads, "
+	            /**/ "and return a ?GFuture for its result.\n"
+	            "When called from one of the pool's own workers, the task is pushed onto "
+	            /**/ "that worker's local queue (from which idle workers may steal it)"),
+	TYPE_KWMETHOD("shutdown", &threadpool_shutdown,
+	              "(wait=!t)\n"
+	              "Stop accepting new tasks. Already submitted tasks are still executed, "
+	              /**/ "after which worker threads exit. When @wait is true, also wait "
+	              /**/ "for this to happen (unless called by one of the workers)"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst threadpool_getsets[] = {
+	TYPE_GETTER("workers", &threadpool_workers_get,
+	            "->?Dint\n"
+	            "The # of worker threads used by @this ?GThreadPool"),
+	TYPE_GETTER("pending", &threadpool_pending_get,
+	            "->?Dint\n"
+	            "The # of tasks that have been submitted, but haven't started, yet"),
+	TYPE_GETTER("isshutdown", &threadpool_isshutdown_get,
+	            "->?Dbool\n"
+	            "Returns ?t if ?#shutdown has been called"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeThreadPool_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "ThreadPool",
+	/* .tp_doc      = */ DOC("A pool of worker threads that execute submitted tasks. Every "
+	                         /**/ "worker has its own queue of tasks, and idle workers steal "
+	                         /**/ "tasks from the queues of other workers.\n"
+	                         "Worker threads are spawned when the first task is submitted, and "
+	                         /**/ "keep running until ?#shutdown is called (which also happens when "
+	                         /**/ "a ${with}-block using the pool is left).\n"
+	                         "Note that a task that waits for a ?GFuture of the same pool "
+	                         /**/ "blocks its worker while doing so (other workers keep running)\n"
+	                         "${"
+	                         /**/ "import ThreadPool, Future from threading;\n"
+	                         /**/ "with (local pool = ThreadPool()) {\n"
+	                         /**/ "	local futures = [for (local x: [:10]) pool.submit(y -\\> y * y, x)];\n"
+	                         /**/ "	print repr Future.waitall(futures...); /* (0, 1, 4, 9, ...) */\n"
+	                         /**/ "}"
+	                         "}\n"
+	                         "\n"
+	                         "(workers?:?Dint)\n"
+	                         "Construct a new thread pool with @workers threads (defaulting "
+	                         /**/ "to the number of CPUs). When @workers is $0, tasks are executed "
+	                         /**/ "immediately by the thread calling ?#submit"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR(DeeThreadPoolObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&threadpool_init_kw
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&threadpool_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL,
+		/* .tp_print     = */ NULL,
+		/* .tp_printrepr = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&threadpool_printrepr
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ NULL,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ &threadpool_with,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ threadpool_methods,
+	/* .tp_getsets       = */ threadpool_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_THREADING_POOL_C */
@@ -0,0 +1,834 @@
+/* Copyright (c) 2018-2023 Griefer@Work                                       *
+ *                                                                            *
+ * This software is provided 'as-is', without any express or implied          *
+ * warranty. In no event will the authors be held liable for any damages      *
+ * arising from the use of this software.                                     *
+ *                                                                            *
+ * Permission is granted to anyone to use this software for any purpose,      *
+ * including commercial applications, and to alter it and redistribute it     *
+ * freely, subject to the following restrictions:                             *
+ *                                                                            *
+ * 1. The origin of this software must not be misrepresented; you must not    *
+ *    claim that you wrote the original software. If you use this software    *
+ *    in a product, an acknowledgement (see the following) in the product     *
+ *    documentation is required:                                              *
+ *    Portions Copyright (c) 2018-2023 Griefer@Work                           *
+ * 2. Altered source versions must be plainly marked as such, and must not be *
+ *    misrepresented as being the original software.                          *
+ * 3. This notice may not be removed or altered from any source distribution. *
+ */
+#ifndef GUARD_DEX_THREADING_QUEUE_C
+#define GUARD_DEX_THREADING_QUEUE_C 1
+#define CONFIG_BUILDING_LIBTHREADING
+#define DEE_SOURCE
+
+#include "libthreading.h"
+/**/
+
+#include <deemon/alloc.h>
+#include <deemon/api.h>
+#include <deemon/arg.h>
+#include <deemon/bool.h>
+#include <deemon/dex.h>
+#include <deemon/error.h>
+#include <deemon/format.h>
+#include <deemon/gc.h>
+#include <deemon/int.h>
+#include <deemon/none.h>
+#include <deemon/object.h>
+#include <deemon/thread.h>
+#include <deemon/tuple.h>
+#include <deemon/util/atomic.h>
+#include <deemon/util/futex.h>
+#include <deemon/util/lock.h>
+
+DECL_BEGIN
+
+/* Multi-producer, multi-consumer queue.
+ *
+ * Items are stored in a ring buffer of cells, each of which carries a
+ * sequence number that tells producers/consumers if the cell is ready
+ * for them (see Dmitry Vyukov's bounded MPMC queue). Producers and
+ * consumers only ever synchronize through atomic operations on the
+ * head/tail indices and the cell sequence numbers, so pushes and pops
+ * never exclude each other.
+ *
+ * `q_lock' is only ever acquired for writing in order to grow the ring
+ * buffer of unbounded queues (and for GC visit/clear). Pushes and pops
+ * hold a read-lock while they access the ring buffer.
+ *
+ * Blocking is implemented using futex words that are only ever touched
+ * by a push/pop when some thread is actually waiting (as indicated by
+ * `q_wait_pop' / `q_wait_push'). */
+struct mpmc_cell {
+	size_t          mc_seq;  /* [atomic] Sequence number */
+	DREF DeeObject *mc_item; /* [0..1] Stored item (bound when `mc_seq == pos + 1') */
+};
+
+typedef struct {
+	OBJECT_HEAD
+	Dee_atomic_rwlock_t q_lock;      /* Lock for `q_mask' and `q_cells' (see above) */
+	size_t              q_capacity;  /* [const] Max # of items, or `(size_t)-1' if unbounded. */
+	size_t              q_mask;      /* [lock(q_lock)] Ring buffer size minus 1 (size is a power-of-2) */
+	struct mpmc_cell   *q_cells;     /* [1..1][lock(q_lock)][0..q_mask+1][owned] Ring buffer. */
+	size_t              q_head;      /* [atomic] Position of the next item to pop. */
+	size_t              q_tail;      /* [atomic] Position of the next item to push. */
+	size_t              q_wait_pop;  /* [atomic] # of threads waiting for items to be pushed. */
+	size_t              q_wait_push; /* [atomic] # of threads waiting for items to be popped. */
+	uint32_t            q_pushed;    /* [atomic] Incremented after pushes while `q_wait_pop != 0' (futex word) */
+	uint32_t            q_popped;    /* [atomic] Incremented after pops while `q_wait_push != 0' (futex word) */
+	uint32_t            q_closed;    /* [atomic] Non-zero once the channel was closed (always 0 for `Queue') */
+} DeeQueueObject;
+
+#define QUEUE_ISBOUNDED(self) ((self)->q_capacity != (size_t)-1)
+#define QUEUE_INITSIZE        16
+
+/* [atomic] # of threads blocking in `Channel.select()' */
+PRIVATE size_t channel_selectors = 0;
+
+/* [atomic] Incremented (and broadcast) after channel pushes while `channel_selectors != 0' */
+PRIVATE uint32_t channel_select_version = 0;
+
+PRIVATE ATTR_COLD int DCALL err_channel_closed(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "Channel has been closed");
+}
+
+PRIVATE ATTR_COLD int DCALL err_queue_empty(void) {
+	return DeeError_Throwf(&DeeError_ValueError, "Queue is empty");
+}
+
+/* Try to push `item' into `self' (without blocking).
+ * @return: true:  Success (a reference to `item' was stored)
+ * @return: false: The queue is full */
+PRIVATE WUNUSED NONNULL((1, 2)) bool DCALL
+queue_trypush_locked(DeeQueueObject *__restrict self, DeeObject *__restrict item) {
+	struct mpmc_cell *cell;
+	size_t pos = atomic_read(&self->q_tail);
+	for (;;) {
+		size_t seq;
+		cell = &self->q_cells[pos & self->q_mask];
+		seq  = atomic_read(&cell->mc_seq);
+		if (seq == pos) {
+			if (atomic_cmpxch_weak(&self->q_tail, pos, pos + 1))
+				break;
+		} else if ((ssize_t)(seq - pos) < 0) {
+			return false; /* Cell still holds an item from the previous lap */
+		}
+		pos = atomic_read(&self->q_tail);
+	}
+	Dee_Incref(item);
+	cell->mc_item = item;
+	atomic_write(&cell->mc_seq, pos + 1);
+	return true;
+}
+
+/* Try to pop an item from `self' (without blocking).
+ * @return: * :   The popped item
+ * @return: NULL: The queue is empty */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_trypop_locked(DeeQueueObject *__restrict self) {
+	struct mpmc_cell *cell;
+	DREF DeeObject *result;
+	size_t pos = atomic_read(&self->q_head);
+	for (;;) {
+		size_t seq;
+		cell = &self->q_cells[pos & self->q_mask];
+		seq  = atomic_read(&cell->mc_seq);
+		if (seq == pos + 1) {
+			if (atomic_cmpxch_weak(&self->q_head, pos, pos + 1))
+				break;
+		} else if ((ssize_t)(seq - (pos + 1)) < 0) {
+			return NULL; /* Cell hasn't been filled, yet */
+		}
+		pos = atomic_read(&self->q_head);
+	}
+	result = cell->mc_item;
+	cell->mc_item = NULL;
+	atomic_write(&cell->mc_seq, pos + self->q_mask + 1);
+	return result;
+}
+
+/* Initialize the cells of a ring buffer of `mask + 1' elements,
+ * such that it can be used for positions starting at `head'. */
+PRIVATE NONNULL((1)) void DCALL
+mpmc_cells_init(struct mpmc_cell *__restrict cells, size_t mask, size_t head) {
+	size_t pos;
+	for (pos = head; pos != head + mask + 1; ++pos) {
+		cells[pos & mask].mc_seq  = pos;
+		cells[pos & mask].mc_item = NULL;
+	}
+}
+
+/* Double the ring buffer size of an unbounded queue (unless some other thread already did)
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+queue_grow(DeeQueueObject *__restrict self, size_t old_mask) {
+	size_t pos, head, tail, new_mask = (old_mask << 1) | 1;
+	struct mpmc_cell *new_cells, *old_cells;
+	new_cells = (struct mpmc_cell *)Dee_Mallocc(new_mask + 1, sizeof(struct mpmc_cell));
+	if unlikely(!new_cells)
+		goto err;
+	Dee_atomic_rwlock_write(&self->q_lock);
+	if unlikely(self->q_mask != old_mask) {
+		/* Someone else already grew the buffer. */
+		Dee_atomic_rwlock_endwrite(&self->q_lock);
+		Dee_Free(new_cells);
+		return 0;
+	}
+
+	/* No pushes/pops are in progress -> every cell in [head, tail) holds an item */
+	head      = self->q_head;
+	tail      = self->q_tail;
+	old_cells = self->q_cells;
+	mpmc_cells_init(new_cells, new_mask, head);
+	for (pos = head; pos != tail; ++pos) {
+		new_cells[pos & new_mask].mc_item = old_cells[pos & old_mask].mc_item;
+		new_cells[pos & new_mask].mc_seq  = pos + 1;
+	}
+	self->q_cells = new_cells;
+	self->q_mask  = new_mask;
+	Dee_atomic_rwlock_endwrite(&self->q_lock);
+	Dee_Free(old_cells);
+	return 0;
+err:
+	return -1;
+}
+
+/* Wake up threads waiting for `self' to become non-empty. */
+PRIVATE NONNULL((1)) void DCALL
+queue_notify_pushed(DeeQueueObject *__restrict self) {
+	if (atomic_read(&self->q_wait_pop) != 0) {
+		atomic_inc(&self->q_pushed);
+		DeeFutex_WakeOne(&self->q_pushed);
+	}
+	if (atomic_read(&channel_selectors) != 0) {
+		atomic_inc(&channel_select_version);
+		DeeFutex_WakeAll(&channel_select_version);
+	}
+}
+
+/* Wake up threads waiting for `self' to become non-full. */
+PRIVATE NONNULL((1)) void DCALL
+queue_notify_popped(DeeQueueObject *__restrict self) {
+	if (atomic_read(&self->q_wait_push) != 0) {
+		atomic_inc(&self->q_popped);
+		DeeFutex_WakeOne(&self->q_popped);
+	}
+}
+
+/* Try to push `item' into `self' (without blocking).
+ * @return: 1 : The queue is full
+ * @return: 0 : Success
+ * @return: -1: An error was thrown (the channel was closed) */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+queue_trypush(DeeQueueObject *__restrict self, DeeObject *__restrict item) {
+	size_t mask;
+	if unlikely(atomic_read(&self->q_closed))
+		return err_channel_closed();
+again:
+	Dee_atomic_rwlock_read(&self->q_lock);
+	if likely(queue_trypush_locked(self, item)) {
+		Dee_atomic_rwlock_endread(&self->q_lock);
+		queue_notify_pushed(self);
+		return 0;
+	}
+	mask = self->q_mask;
+	Dee_atomic_rwlock_endread(&self->q_lock);
+	if (QUEUE_ISBOUNDED(self))
+		return 1;
+	if unlikely(queue_grow(self, mask))
+		return -1;
+	goto again;
+}
+
+/* Try to pop an item from `self' (without blocking).
+ * @return: * :   The popped item
+ * @return: NULL: The queue is empty */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_trypop(DeeQueueObject *__restrict self) {
+	DREF DeeObject *result;
+	Dee_atomic_rwlock_read(&self->q_lock);
+	result = queue_trypop_locked(self);
+	Dee_atomic_rwlock_endread(&self->q_lock);
+	if (result)
+		queue_notify_popped(self);
+	return result;
+}
+
+/* Convert a relative timeout into an absolute deadline (in microseconds) */
+PRIVATE WUNUSED uint64_t DCALL
+queue_deadline(uint64_t timeout_nanoseconds) {
+	if (timeout_nanoseconds == (uint64_t)-1)
+		return (uint64_t)-1;
+	return DeeThread_GetTimeMicroSeconds() + timeout_nanoseconds / 1000;
+}
+
+/* Wait until `*p_version != version', or until `deadline' has passed.
+ * @return: 1 : The deadline has passed
+ * @return: 0 : Success (or spurious wake-up)
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+queue_waitfor(uint32_t *p_version, uint32_t version, uint64_t deadline) {
+	uint64_t now;
+	if (deadline == (uint64_t)-1)
+		return DeeFutex_Wait32(p_version, version);
+	now = DeeThread_GetTimeMicroSeconds();
+	if (now >= deadline)
+		return 1;
+	return DeeFutex_Wait32Timed(p_version, version, (deadline - now) * 1000);
+}
+
+/* Push `item' into `self', blocking while the queue is full.
+ * @return: 1 : The given deadline has passed
+ * @return: 0 : Success
+ * @return: -1: An error was thrown */
+PRIVATE WUNUSED NONNULL((1, 2)) int DCALL
+queue_push(DeeQueueObject *__restrict self,
+           DeeObject *__restrict item, uint64_t deadline) {
+	for (;;) {
+		int status;
+		uint32_t version;
+		status = queue_trypush(self, item);
+		if (status <= 0)
+			return status;
+		atomic_inc(&self->q_wait_push);
+		version = atomic_read(&self->q_popped);
+		status  = queue_trypush(self, item);
+		if (status <= 0) {
+			atomic_dec(&self->q_wait_push);
+			return status;
+		}
+		status = queue_waitfor(&self->q_popped, version, deadline);
+		atomic_dec(&self->q_wait_push);
+		if (status != 0)
+			return status;
+	}
+}
+
+/* Pop an item from `self', blocking while the queue is empty.
+ * @return: * :         The popped item
+ * @return: ITER_DONE:  The given deadline has passed, or the channel was closed (and is empty)
+ * @return: NULL:       An error was thrown */
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_pop(DeeQueueObject *__restrict self, uint64_t deadline) {
+	for (;;) {
+		int status;
+		uint32_t version;
+		DREF DeeObject *result;
+		result = queue_trypop(self);
+		if (result)
+			return result;
+		atomic_inc(&self->q_wait_pop);
+		version = atomic_read(&self->q_pushed);
+		result  = queue_trypop(self);
+		if (result) {
+			atomic_dec(&self->q_wait_pop);
+			return result;
+		}
+		if (atomic_read(&self->q_closed)) {
+			atomic_dec(&self->q_wait_pop);
+			return ITER_DONE;
+		}
+		status = queue_waitfor(&self->q_pushed, version, deadline);
+		atomic_dec(&self->q_wait_pop);
+		if unlikely(status < 0)
+			return NULL;
+		if (status > 0) {
+			/* One last try (in case we were woken up just as the deadline passed) */
+			result = queue_trypop(self);
+			return result ? result : ITER_DONE;
+		}
+	}
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+queue_init_kw(DeeQueueObject *__restrict self, size_t argc,
+              DeeObject *const *argv, DeeObject *kw) {
+	PRIVATE DEFINE_KWLIST(queue_kwlist, { K(capacity), KEND });
+	size_t size, capacity = (size_t)-1;
+	if (DeeArg_UnpackKw(argc, argv, kw, queue_kwlist, "|" UNPuSIZ ":Queue", &capacity))
+		goto err;
+	if (capacity == (size_t)-1) {
+		size = QUEUE_INITSIZE;
+	} else {
+		if unlikely(!capacity) {
+			DeeError_Throwf(&DeeError_ValueError, "Queue capacity cannot be 0");
+			goto err;
+		}
+
+		/* Round up to the next power-of-2 (as required by the ring buffer) */
+		for (size = 1; size < capacity; size <<= 1) {
+			if unlikely(size > ((size_t)-1 / 4)) {
+				DeeError_Throwf(&DeeError_IntegerOverflow,
+				                "Queue capacity %" PRFuSIZ " is too large",
+				                capacity);
+				goto err;
+			}
+		}
+		capacity = size;
+	}
+	self->q_cells = (struct mpmc_cell *)Dee_Mallocc(size, sizeof(struct mpmc_cell));
+	if unlikely(!self->q_cells)
+		goto err;
+	mpmc_cells_init(self->q_cells, size - 1, 0);
+	Dee_atomic_rwlock_init(&self->q_lock);
+	self->q_capacity  = capacity;
+	self->q_mask      = size - 1;
+	self->q_head      = 0;
+	self->q_tail      = 0;
+	self->q_wait_pop  = 0;
+	self->q_wait_push = 0;
+	self->q_pushed    = 0;
+	self->q_popped    = 0;
+	self->q_closed    = 0;
+	return 0;
+err:
+	return -1;
+}
+
+PRIVATE NONNULL((1)) void DCALL
+queue_fini(DeeQueueObject *__restrict self) {
+	size_t pos;
+	for (pos = self->q_head; pos != self->q_tail; ++pos)
+		Dee_XDecref(self->q_cells[pos & self->q_mask].mc_item);
+	Dee_Free(self->q_cells);
+}
+
+PRIVATE NONNULL((1, 2)) void DCALL
+queue_visit(DeeQueueObject *__restrict self, dvisit_t proc, void *arg) {
+	size_t pos;
+	Dee_atomic_rwlock_write(&self->q_lock);
+	for (pos = self->q_head; pos != self->q_tail; ++pos)
+		Dee_XVisit(self->q_cells[pos & self->q_mask].mc_item);
+	Dee_atomic_rwlock_endwrite(&self->q_lock);
+}
+
+PRIVATE NONNULL((1)) void DCALL
+queue_clear(DeeQueueObject *__restrict self) {
+	DREF DeeObject *item;
+	while ((item = queue_trypop(self)) != NULL)
+		Dee_Decref(item);
+}
+
+PRIVATE struct type_gc tpconst queue_gc = {
+	/* .tp_clear = */ (void (DCALL *)(DeeObject *__restrict))&queue_clear
+};
+
+PRIVATE WUNUSED NONNULL((1)) size_t DCALL
+queue_getsize(DeeQueueObject *__restrict self) {
+	size_t head = atomic_read(&self->q_head);
+	size_t tail = atomic_read(&self->q_tail);
+	return (ssize_t)(tail - head) > 0 ? tail - head : 0;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+queue_bool(DeeQueueObject *__restrict self) {
+	return queue_getsize(self) != 0;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_size(DeeQueueObject *__restrict self) {
+	return DeeInt_NewSize(queue_getsize(self));
+}
+
+PRIVATE struct type_seq queue_seq = {
+	/* .tp_iter_self = */ NULL,
+	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&queue_size
+};
+
+PRIVATE WUNUSED NONNULL((1, 2)) dssize_t DCALL
+queue_printrepr(DeeQueueObject *__restrict self,
+                dformatprinter printer, void *arg) {
+	if (!QUEUE_ISBOUNDED(self))
+		return DeeFormat_Printf(printer, arg, "%s()", Dee_TYPE(self)->tp_name);
+	return DeeFormat_Printf(printer, arg, "%s(capacity: %" PRFuSIZ ")",
+	                        Dee_TYPE(self)->tp_name, self->q_capacity);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_push_f(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	DeeObject *item;
+	if (DeeArg_Unpack(argc, argv, "o:push", &item))
+		goto err;
+	if unlikely(queue_push(self, item, (uint64_t)-1))
+		goto err;
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_trypush_f(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	int status;
+	DeeObject *item;
+	if (DeeArg_Unpack(argc, argv, "o:trypush", &item))
+		goto err;
+	status = queue_trypush(self, item);
+	if unlikely(status < 0)
+		goto err;
+	return_bool_(status == 0);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_timedpush(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	int status;
+	DeeObject *item;
+	uint64_t timeout_nanoseconds;
+	if (DeeArg_Unpack(argc, argv, "o" UNPu64 ":timedpush", &item, &timeout_nanoseconds))
+		goto err;
+	status = queue_push(self, item, queue_deadline(timeout_nanoseconds));
+	if unlikely(status < 0)
+		goto err;
+	return_bool_(status == 0);
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_pop_f(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *result;
+	if (DeeArg_Unpack(argc, argv, ":pop"))
+		goto err;
+	result = queue_pop(self, (uint64_t)-1);
+	if unlikely(result == ITER_DONE)
+		goto err_closed;
+	return result;
+err_closed:
+	err_channel_closed();
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_trypop_f(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *result;
+	DeeObject *def = NULL;
+	if (DeeArg_Unpack(argc, argv, "|o:trypop", &def))
+		goto err;
+	result = queue_trypop(self);
+	if (result)
+		return result;
+	if (def)
+		return_reference_(def);
+	err_queue_empty();
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_timedpop(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	DREF DeeObject *result;
+	DeeObject *def = NULL;
+	uint64_t timeout_nanoseconds;
+	if (DeeArg_Unpack(argc, argv, UNPu64 "|o:timedpop", &timeout_nanoseconds, &def))
+		goto err;
+	result = queue_pop(self, queue_deadline(timeout_nanoseconds));
+	if (result != ITER_DONE)
+		return result;
+	if (def)
+		return_reference_(def);
+	if (atomic_read(&self->q_closed)) {
+		err_channel_closed();
+	} else {
+		err_queue_empty();
+	}
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+queue_capacity_get(DeeQueueObject *__restrict self) {
+	if (!QUEUE_ISBOUNDED(self))
+		return_none;
+	return DeeInt_NewSize(self->q_capacity);
+}
+
+PRIVATE struct type_method tpconst queue_methods[] = {
+	TYPE_METHOD("push", &queue_push_f,
+	            "(item)\n"
+	            "Append @item to the end of @this queue, blocking while the queue is full"),
+	TYPE_METHOD("trypush", &queue_trypush_f,
+	            "(item)->?Dbool\n"
+	            "Try to append @item to the end of @this queue, returning ?f if it is full"),
+	TYPE_METHOD("timedpush", &queue_timedpush,
+	            "(item,timeout_nanoseconds:?Dint)->?Dbool\n"
+	            "Same as ?#push, but give up and return ?f after @timeout_nanoseconds have passed"),
+	TYPE_METHOD("pop", &queue_pop_f,
+	            "->\n"
+	            "Remove and return the oldest item of @this queue, blocking while the queue is empty"),
+	TYPE_METHOD("trypop", &queue_trypop_f,
+	            "(def?)->\n"
+	            "#tValueError{@this queue is empty, and no @def was given}"
+	            "Try to remove and return the oldest item of @this queue, "
+	            /**/ "returning @def if the queue is empty"),
+	TYPE_METHOD("timedpop", &queue_timedpop,
+	            "(timeout_nanoseconds:?Dint,def?)->\n"
+	            "#tValueError{The timeout expired, and no @def was given}"
+	            "Same as ?#pop, but give up after @timeout_nanoseconds have passed"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst queue_getsets[] = {
+	TYPE_GETTER("capacity", &queue_capacity_get,
+	            "->?X2?Dint?N\n"
+	            "The max # of items in @this queue, or ?N if it is unbounded"),
+	TYPE_GETSET_END
+};
+
+INTERN DeeTypeObject DeeQueue_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Queue",
+	/* .tp_doc      = */ DOC("A FIFO queue that can be used by any number of producer and "
+	                         /**/ "consumer threads at the same time. Pushing and popping items "
+	                         /**/ "is lock-free, such that producers and consumers don't have to "
+	                         /**/ "wait for each other unless the queue is full or empty\n"
+	                         "\n"
+	                         "(capacity?:?Dint)\n"
+	                         "#tValueError{@capacity is $0}"
+	                         "Construct a new queue. When @capacity is given, the queue is bounded "
+	                         /**/ "and ?#push blocks while it is full. The capacity is rounded up "
+	                         /**/ "to the next power of 2.\n"
+	                         "\n"
+	                         "bool->\n"
+	                         "Returns ?t if @this queue is non-empty\n"
+	                         "\n"
+	                         "#->\n"
+	                         "Returns the (approximate) # of items in @this queue"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeObject_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeQueueObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&queue_init_kw
+			}
+		},
+		/* .tp_dtor        = */ (void (DCALL *)(DeeObject *__restrict))&queue_fini,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ (int (DCALL *)(DeeObject *__restrict))&queue_bool,
+		/* .tp_print     = */ NULL,
+		/* .tp_printrepr = */ (dssize_t (DCALL *)(DeeObject *__restrict, dformatprinter, void *))&queue_printrepr
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ (void (DCALL *)(DeeObject *__restrict, dvisit_t, void *))&queue_visit,
+	/* .tp_gc            = */ &queue_gc,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ &queue_seq,
+	/* .tp_iter_next     = */ NULL,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ NULL,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ queue_methods,
+	/* .tp_getsets       = */ queue_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ NULL,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+
+
+
+
+/************************************************************************/
+/* Channel                                                              */
+/************************************************************************/
+
+PRIVATE NONNULL((1)) void DCALL
+channel_doclose(DeeQueueObject *__restrict self) {
+	atomic_write(&self->q_closed, 1);
+	atomic_inc(&self->q_pushed);
+	atomic_inc(&self->q_popped);
+	DeeFutex_WakeAll(&self->q_pushed);
+	DeeFutex_WakeAll(&self->q_popped);
+	atomic_inc(&channel_select_version);
+	DeeFutex_WakeAll(&channel_select_version);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+channel_close(DeeQueueObject *self, size_t argc, DeeObject *const *argv) {
+	if (DeeArg_Unpack(argc, argv, ":close"))
+		goto err;
+	channel_doclose(self);
+	return_none;
+err:
+	return NULL;
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+channel_closed_get(DeeQueueObject *__restrict self) {
+	return_bool(atomic_read(&self->q_closed) != 0);
+}
+
+PRIVATE WUNUSED NONNULL((1)) DREF DeeObject *DCALL
+channel_iter_next(DeeQueueObject *__restrict self) {
+	return queue_pop(self, (uint64_t)-1);
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+channel_enter(DeeQueueObject *__restrict self) {
+	(void)self;
+	return 0;
+}
+
+PRIVATE WUNUSED NONNULL((1)) int DCALL
+channel_leave(DeeQueueObject *__restrict self) {
+	channel_doclose(self);
+	return 0;
+}
+
+PRIVATE struct type_with channel_with = {
+	/* .tp_enter = */ (int (DCALL *)(DeeObject *__restrict))&channel_enter,
+	/* .tp_leave = */ (int (DCALL *)(DeeObject *__restrict))&channel_leave
+};
+
+PRIVATE WUNUSED DREF DeeObject *DCALL
+channel_select(DeeObject *UNUSED(self), size_t argc, DeeObject *const *argv) {
+	size_t i;
+	for (i = 0; i < argc; ++i) {
+		if (DeeObject_AssertType(argv[i], &DeeChannel_Type))
+			goto err;
+	}
+	for (;;) {
+		int status;
+		uint32_t version;
+		bool allclosed = true;
+		atomic_inc(&channel_selectors);
+		version = atomic_read(&channel_select_version);
+		for (i = 0; i < argc; ++i) {
+			DeeQueueObject *channel = (DeeQueueObject *)argv[i];
+			DREF DeeObject *item = queue_trypop(channel);
+			if (item) {
+				DREF DeeObject *result;
+				atomic_dec(&channel_selectors);
+				result = DeeTuple_Pack(2, channel, item);
+				Dee_Decref(item);
+				return result;
+			}
+			if (!atomic_read(&channel->q_closed))
+				allclosed = false;
+		}
+		if (allclosed) {
+			atomic_dec(&channel_selectors);
+			return_none;
+		}
+		status = DeeFutex_Wait32(&channel_select_version, version);
+		atomic_dec(&channel_selectors);
+		if unlikely(status < 0)
+			goto err;
+	}
+err:
+	return NULL;
+}
+
+PRIVATE struct type_seq channel_seq = {
+	/* .tp_iter_self = */ &DeeObject_NewRef,
+	/* .tp_size      = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&queue_size
+};
+
+PRIVATE struct type_method tpconst channel_methods[] = {
+	TYPE_METHOD("close", &channel_close,
+	            "()\n"
+	            "Close @this channel. Once closed, ?#push throws an error, and ?#pop "
+	            /**/ "(as well as iteration) stops once all remaining items have been taken"),
+	TYPE_METHOD_END
+};
+
+PRIVATE struct type_getset tpconst channel_getsets[] = {
+	TYPE_GETTER("closed", &channel_closed_get,
+	            "->?Dbool\n"
+	            "Returns ?t if @this channel has been closed"),
+	TYPE_GETSET_END
+};
+
+PRIVATE struct type_method tpconst channel_class_methods[] = {
+	TYPE_METHOD("select", &channel_select,
+	            "(channels!:?.)->?X2?T2?.?O?N\n"
+	            "Wait until an item can be popped from any of the given @channels, and return "
+	            /**/ "a tuple of the channel and the popped item. Returns ?N once all of the "
+	            /**/ "given @channels have been closed and are empty"),
+	TYPE_METHOD_END
+};
+
+INTERN DeeTypeObject DeeChannel_Type = {
+	OBJECT_HEAD_INIT(&DeeType_Type),
+	/* .tp_name     = */ "Channel",
+	/* .tp_doc      = */ DOC("A ?GQueue that can be closed by its producers. Iterating a "
+	                         /**/ "channel pops items until it has been closed and is empty. "
+	                         /**/ "Leaving a ${with}-block using a channel closes it\n"
+	                         "${"
+	                         /**/ "import Channel from threading;\n"
+	                         /**/ "local ch = Channel(64);\n"
+	                         /**/ "Thread(() -\\> {\n"
+	                         /**/ "	with (ch) {\n"
+	                         /**/ "		for (local x: [:100])\n"
+	                         /**/ "			ch.push(x);\n"
+	                         /**/ "	}\n"
+	                         /**/ "}).start();\n"
+	                         /**/ "for (local x: ch)\n"
+	                         /**/ "	print x;"
+	                         "}\n"
+	                         "\n"
+	                         "(capacity?:?Dint)\n"
+	                         "#tValueError{@capacity is $0}"
+	                         "Construct a new channel (s.a. ?#{op:constructor} of ?GQueue)"),
+	/* .tp_flags    = */ TP_FNORMAL | TP_FGC | TP_FFINAL,
+	/* .tp_weakrefs = */ 0,
+	/* .tp_features = */ TF_NONE,
+	/* .tp_base     = */ &DeeQueue_Type,
+	/* .tp_init = */ {
+		{
+			/* .tp_alloc = */ {
+				/* .tp_ctor      = */ (dfunptr_t)NULL,
+				/* .tp_copy_ctor = */ (dfunptr_t)NULL,
+				/* .tp_deep_ctor = */ (dfunptr_t)NULL,
+				/* .tp_any_ctor  = */ (dfunptr_t)NULL,
+				TYPE_FIXED_ALLOCATOR_GC(DeeQueueObject),
+				/* .tp_any_ctor_kw = */ (dfunptr_t)&queue_init_kw
+			}
+		},
+		/* .tp_dtor        = */ NULL,
+		/* .tp_assign      = */ NULL,
+		/* .tp_move_assign = */ NULL
+	},
+	/* .tp_cast = */ {
+		/* .tp_str       = */ NULL,
+		/* .tp_repr      = */ NULL,
+		/* .tp_bool      = */ NULL
+	},
+	/* .tp_call          = */ NULL,
+	/* .tp_visit         = */ NULL,
+	/* .tp_gc            = */ NULL,
+	/* .tp_math          = */ NULL,
+	/* .tp_cmp           = */ NULL,
+	/* .tp_seq           = */ &channel_seq,
+	/* .tp_iter_next     = */ (DREF DeeObject *(DCALL *)(DeeObject *__restrict))&channel_iter_next,
+	/* .tp_attr          = */ NULL,
+	/* .tp_with          = */ &channel_with,
+	/* .tp_buffer        = */ NULL,
+	/* .tp_methods       = */ channel_methods,
+	/* .tp_getsets       = */ channel_getsets,
+	/* .tp_members       = */ NULL,
+	/* .tp_class_methods = */ channel_class_methods,
+	/* .tp_class_getsets = */ NULL,
+	/* .tp_class_members = */ NULL
+};
+
+DECL_END
+
+#endif /* !GUARD_DEX_THREADING_QUEUE_C */